@@ -0,0 +1,29 @@
+// Ring of system call requests run by submit_batch() in a
+// single kernel entry. The process fills sq[] and advances
+// sq_tail; the kernel consumes from sq_head and posts each
+// result to cq[], advancing cq_tail. Indexes run freely and
+// are taken modulo NBATCH. The ring may not be in shared memory.
+
+#define NBATCH 32       // Ring entries; a power of two
+#define BATCH_MAXARGS 5
+
+struct batch_sqe
+{
+  int num;                 // SYS_ number
+  int args[BATCH_MAXARGS]; // As they would be pushed for the call
+};
+
+struct batch_cqe
+{
+  int result;
+};
+
+struct batch_ring
+{
+  uint sq_head;
+  uint sq_tail;
+  uint cq_head;
+  uint cq_tail;
+  struct batch_sqe sq[NBATCH];
+  struct batch_cqe cq[NBATCH];
+};
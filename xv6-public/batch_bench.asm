@@ -0,0 +1,1973 @@
+
+_batch_bench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rdtsc>:
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+   6:	0f 31                	rdtsc
+   8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+   b:	89 55 fc             	mov    %edx,-0x4(%ebp)
+   e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  11:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  14:	c9                   	leave
+  15:	c3                   	ret
+
+00000016 <queue>:
+{
+  16:	55                   	push   %ebp
+  17:	89 e5                	mov    %esp,%ebp
+  19:	83 ec 18             	sub    $0x18,%esp
+    sqe = &ring.sq[ring.sq_tail % NBATCH];
+  1c:	a1 a4 13 00 00       	mov    0x13a4,%eax
+  21:	83 e0 1f             	and    $0x1f,%eax
+  24:	89 c2                	mov    %eax,%edx
+  26:	89 d0                	mov    %edx,%eax
+  28:	01 c0                	add    %eax,%eax
+  2a:	01 d0                	add    %edx,%eax
+  2c:	c1 e0 03             	shl    $0x3,%eax
+  2f:	83 c0 10             	add    $0x10,%eax
+  32:	05 a0 13 00 00       	add    $0x13a0,%eax
+  37:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    sqe->num = num;
+  3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  40:	89 10                	mov    %edx,(%eax)
+    sqe->args[0] = fd;
+  42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  45:	8b 55 0c             	mov    0xc(%ebp),%edx
+  48:	89 50 04             	mov    %edx,0x4(%eax)
+    sqe->args[1] = (int)p;
+  4b:	8b 55 10             	mov    0x10(%ebp),%edx
+  4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  51:	89 50 08             	mov    %edx,0x8(%eax)
+    sqe->args[2] = n;
+  54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  57:	8b 55 14             	mov    0x14(%ebp),%edx
+  5a:	89 50 0c             	mov    %edx,0xc(%eax)
+    ring.sq_tail++;
+  5d:	a1 a4 13 00 00       	mov    0x13a4,%eax
+  62:	83 c0 01             	add    $0x1,%eax
+  65:	a3 a4 13 00 00       	mov    %eax,0x13a4
+    if (ring.sq_tail - ring.sq_head == NBATCH)
+  6a:	8b 15 a4 13 00 00    	mov    0x13a4,%edx
+  70:	a1 a0 13 00 00       	mov    0x13a0,%eax
+  75:	29 c2                	sub    %eax,%edx
+  77:	83 fa 20             	cmp    $0x20,%edx
+  7a:	75 1a                	jne    96 <queue+0x80>
+        submit_batch(&ring);
+  7c:	83 ec 0c             	sub    $0xc,%esp
+  7f:	68 a0 13 00 00       	push   $0x13a0
+  84:	e8 ee 06 00 00       	call   777 <submit_batch>
+  89:	83 c4 10             	add    $0x10,%esp
+        ring.cq_head = ring.cq_tail;
+  8c:	a1 ac 13 00 00       	mov    0x13ac,%eax
+  91:	a3 a8 13 00 00       	mov    %eax,0x13a8
+}
+  96:	90                   	nop
+  97:	c9                   	leave
+  98:	c3                   	ret
+
+00000099 <run>:
+{
+  99:	55                   	push   %ebp
+  9a:	89 e5                	mov    %esp,%ebp
+  9c:	83 ec 18             	sub    $0x18,%esp
+    fd = open("batchfile", num == SYS_write ? O_CREATE | O_RDWR : O_RDONLY);
+  9f:	83 7d 0c 10          	cmpl   $0x10,0xc(%ebp)
+  a3:	75 07                	jne    ac <run+0x13>
+  a5:	b8 02 02 00 00       	mov    $0x202,%eax
+  aa:	eb 05                	jmp    b1 <run+0x18>
+  ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  b1:	83 ec 08             	sub    $0x8,%esp
+  b4:	50                   	push   %eax
+  b5:	68 6c 0e 00 00       	push   $0xe6c
+  ba:	e8 78 05 00 00       	call   637 <open>
+  bf:	83 c4 10             	add    $0x10,%esp
+  c2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if (fd < 0)
+  c5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  c9:	79 17                	jns    e2 <run+0x49>
+        printf(1, "batch_bench: cannot open batchfile\n");
+  cb:	83 ec 08             	sub    $0x8,%esp
+  ce:	68 78 0e 00 00       	push   $0xe78
+  d3:	6a 01                	push   $0x1
+  d5:	e8 89 07 00 00       	call   863 <printf>
+  da:	83 c4 10             	add    $0x10,%esp
+        exit();
+  dd:	e8 15 05 00 00       	call   5f7 <exit>
+    start = rdtsc();
+  e2:	e8 19 ff ff ff       	call   0 <rdtsc>
+  e7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  ea:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    for (i = 0; i < NOPS; i++)
+  ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  f4:	eb 53                	jmp    149 <run+0xb0>
+        if (batched)
+  f6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  fa:	74 17                	je     113 <run+0x7a>
+            queue(num, fd, buf, CHUNK);
+  fc:	6a 10                	push   $0x10
+  fe:	68 30 17 00 00       	push   $0x1730
+ 103:	ff 75 f0             	push   -0x10(%ebp)
+ 106:	ff 75 0c             	push   0xc(%ebp)
+ 109:	e8 08 ff ff ff       	call   16 <queue>
+ 10e:	83 c4 10             	add    $0x10,%esp
+ 111:	eb 32                	jmp    145 <run+0xac>
+        else if (num == SYS_write)
+ 113:	83 7d 0c 10          	cmpl   $0x10,0xc(%ebp)
+ 117:	75 17                	jne    130 <run+0x97>
+            write(fd, buf, CHUNK);
+ 119:	83 ec 04             	sub    $0x4,%esp
+ 11c:	6a 10                	push   $0x10
+ 11e:	68 30 17 00 00       	push   $0x1730
+ 123:	ff 75 f0             	push   -0x10(%ebp)
+ 126:	e8 ec 04 00 00       	call   617 <write>
+ 12b:	83 c4 10             	add    $0x10,%esp
+ 12e:	eb 15                	jmp    145 <run+0xac>
+            read(fd, buf, CHUNK);
+ 130:	83 ec 04             	sub    $0x4,%esp
+ 133:	6a 10                	push   $0x10
+ 135:	68 30 17 00 00       	push   $0x1730
+ 13a:	ff 75 f0             	push   -0x10(%ebp)
+ 13d:	e8 cd 04 00 00       	call   60f <read>
+ 142:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < NOPS; i++)
+ 145:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 149:	81 7d f4 ff 01 00 00 	cmpl   $0x1ff,-0xc(%ebp)
+ 150:	7e a4                	jle    f6 <run+0x5d>
+    if (batched && ring.sq_head != ring.sq_tail)
+ 152:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 156:	74 29                	je     181 <run+0xe8>
+ 158:	8b 15 a0 13 00 00    	mov    0x13a0,%edx
+ 15e:	a1 a4 13 00 00       	mov    0x13a4,%eax
+ 163:	39 c2                	cmp    %eax,%edx
+ 165:	74 1a                	je     181 <run+0xe8>
+        submit_batch(&ring);
+ 167:	83 ec 0c             	sub    $0xc,%esp
+ 16a:	68 a0 13 00 00       	push   $0x13a0
+ 16f:	e8 03 06 00 00       	call   777 <submit_batch>
+ 174:	83 c4 10             	add    $0x10,%esp
+        ring.cq_head = ring.cq_tail;
+ 177:	a1 ac 13 00 00       	mov    0x13ac,%eax
+ 17c:	a3 a8 13 00 00       	mov    %eax,0x13a8
+    start = rdtsc() - start;
+ 181:	e8 7a fe ff ff       	call   0 <rdtsc>
+ 186:	2b 45 e8             	sub    -0x18(%ebp),%eax
+ 189:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+ 18c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 18f:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    close(fd);
+ 192:	83 ec 0c             	sub    $0xc,%esp
+ 195:	ff 75 f0             	push   -0x10(%ebp)
+ 198:	e8 82 04 00 00       	call   61f <close>
+ 19d:	83 c4 10             	add    $0x10,%esp
+    return start;
+ 1a0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 1a3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+}
+ 1a6:	c9                   	leave
+ 1a7:	c3                   	ret
+
+000001a8 <main>:
+{
+ 1a8:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 1ac:	83 e4 f0             	and    $0xfffffff0,%esp
+ 1af:	ff 71 fc             	push   -0x4(%ecx)
+ 1b2:	55                   	push   %ebp
+ 1b3:	89 e5                	mov    %esp,%ebp
+ 1b5:	51                   	push   %ecx
+ 1b6:	83 ec 04             	sub    $0x4,%esp
+    memset(buf, 'a', CHUNK);
+ 1b9:	83 ec 04             	sub    $0x4,%esp
+ 1bc:	6a 10                	push   $0x10
+ 1be:	6a 61                	push   $0x61
+ 1c0:	68 30 17 00 00       	push   $0x1730
+ 1c5:	e8 b8 01 00 00       	call   382 <memset>
+ 1ca:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d ops of %d bytes, cycles per op:\n", NOPS, CHUNK);
+ 1cd:	6a 10                	push   $0x10
+ 1cf:	68 00 02 00 00       	push   $0x200
+ 1d4:	68 9c 0e 00 00       	push   $0xe9c
+ 1d9:	6a 01                	push   $0x1
+ 1db:	e8 83 06 00 00       	call   863 <printf>
+ 1e0:	83 c4 10             	add    $0x10,%esp
+    printf(1, "write, one syscall each: %d\n", (int)udiv64(run(0, SYS_write), NOPS));
+ 1e3:	83 ec 08             	sub    $0x8,%esp
+ 1e6:	6a 10                	push   $0x10
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	e8 aa fe ff ff       	call   99 <run>
+ 1ef:	83 c4 10             	add    $0x10,%esp
+ 1f2:	83 ec 04             	sub    $0x4,%esp
+ 1f5:	68 00 02 00 00       	push   $0x200
+ 1fa:	52                   	push   %edx
+ 1fb:	50                   	push   %eax
+ 1fc:	e8 14 03 00 00       	call   515 <udiv64>
+ 201:	83 c4 10             	add    $0x10,%esp
+ 204:	83 ec 04             	sub    $0x4,%esp
+ 207:	50                   	push   %eax
+ 208:	68 c0 0e 00 00       	push   $0xec0
+ 20d:	6a 01                	push   $0x1
+ 20f:	e8 4f 06 00 00       	call   863 <printf>
+ 214:	83 c4 10             	add    $0x10,%esp
+    printf(1, "write, batched by %d:    %d\n", NBATCH, (int)udiv64(run(1, SYS_write), NOPS));
+ 217:	83 ec 08             	sub    $0x8,%esp
+ 21a:	6a 10                	push   $0x10
+ 21c:	6a 01                	push   $0x1
+ 21e:	e8 76 fe ff ff       	call   99 <run>
+ 223:	83 c4 10             	add    $0x10,%esp
+ 226:	83 ec 04             	sub    $0x4,%esp
+ 229:	68 00 02 00 00       	push   $0x200
+ 22e:	52                   	push   %edx
+ 22f:	50                   	push   %eax
+ 230:	e8 e0 02 00 00       	call   515 <udiv64>
+ 235:	83 c4 10             	add    $0x10,%esp
+ 238:	50                   	push   %eax
+ 239:	6a 20                	push   $0x20
+ 23b:	68 dd 0e 00 00       	push   $0xedd
+ 240:	6a 01                	push   $0x1
+ 242:	e8 1c 06 00 00       	call   863 <printf>
+ 247:	83 c4 10             	add    $0x10,%esp
+    printf(1, "read, one syscall each:  %d\n", (int)udiv64(run(0, SYS_read), NOPS));
+ 24a:	83 ec 08             	sub    $0x8,%esp
+ 24d:	6a 05                	push   $0x5
+ 24f:	6a 00                	push   $0x0
+ 251:	e8 43 fe ff ff       	call   99 <run>
+ 256:	83 c4 10             	add    $0x10,%esp
+ 259:	83 ec 04             	sub    $0x4,%esp
+ 25c:	68 00 02 00 00       	push   $0x200
+ 261:	52                   	push   %edx
+ 262:	50                   	push   %eax
+ 263:	e8 ad 02 00 00       	call   515 <udiv64>
+ 268:	83 c4 10             	add    $0x10,%esp
+ 26b:	83 ec 04             	sub    $0x4,%esp
+ 26e:	50                   	push   %eax
+ 26f:	68 fa 0e 00 00       	push   $0xefa
+ 274:	6a 01                	push   $0x1
+ 276:	e8 e8 05 00 00       	call   863 <printf>
+ 27b:	83 c4 10             	add    $0x10,%esp
+    printf(1, "read, batched by %d:     %d\n", NBATCH, (int)udiv64(run(1, SYS_read), NOPS));
+ 27e:	83 ec 08             	sub    $0x8,%esp
+ 281:	6a 05                	push   $0x5
+ 283:	6a 01                	push   $0x1
+ 285:	e8 0f fe ff ff       	call   99 <run>
+ 28a:	83 c4 10             	add    $0x10,%esp
+ 28d:	83 ec 04             	sub    $0x4,%esp
+ 290:	68 00 02 00 00       	push   $0x200
+ 295:	52                   	push   %edx
+ 296:	50                   	push   %eax
+ 297:	e8 79 02 00 00       	call   515 <udiv64>
+ 29c:	83 c4 10             	add    $0x10,%esp
+ 29f:	50                   	push   %eax
+ 2a0:	6a 20                	push   $0x20
+ 2a2:	68 17 0f 00 00       	push   $0xf17
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 b5 05 00 00       	call   863 <printf>
+ 2ae:	83 c4 10             	add    $0x10,%esp
+    unlink("batchfile");
+ 2b1:	83 ec 0c             	sub    $0xc,%esp
+ 2b4:	68 6c 0e 00 00       	push   $0xe6c
+ 2b9:	e8 89 03 00 00       	call   647 <unlink>
+ 2be:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 2c1:	e8 31 03 00 00       	call   5f7 <exit>
+
+000002c6 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 2c6:	55                   	push   %ebp
+ 2c7:	89 e5                	mov    %esp,%ebp
+ 2c9:	57                   	push   %edi
+ 2ca:	53                   	push   %ebx
+{
+ 2cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2ce:	8b 55 10             	mov    0x10(%ebp),%edx
+ 2d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2d4:	89 cb                	mov    %ecx,%ebx
+ 2d6:	89 df                	mov    %ebx,%edi
+ 2d8:	89 d1                	mov    %edx,%ecx
+ 2da:	fc                   	cld
+ 2db:	f3 aa                	rep stos %al,%es:(%edi)
+ 2dd:	89 ca                	mov    %ecx,%edx
+ 2df:	89 fb                	mov    %edi,%ebx
+ 2e1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 2e4:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 2e7:	90                   	nop
+ 2e8:	5b                   	pop    %ebx
+ 2e9:	5f                   	pop    %edi
+ 2ea:	5d                   	pop    %ebp
+ 2eb:	c3                   	ret
+
+000002ec <strcpy>:
+{
+ 2ec:	55                   	push   %ebp
+ 2ed:	89 e5                	mov    %esp,%ebp
+ 2ef:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 2f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 2f8:	90                   	nop
+ 2f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2fc:	8d 42 01             	lea    0x1(%edx),%eax
+ 2ff:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 302:	8b 45 08             	mov    0x8(%ebp),%eax
+ 305:	8d 48 01             	lea    0x1(%eax),%ecx
+ 308:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 30b:	0f b6 12             	movzbl (%edx),%edx
+ 30e:	88 10                	mov    %dl,(%eax)
+ 310:	0f b6 00             	movzbl (%eax),%eax
+ 313:	84 c0                	test   %al,%al
+ 315:	75 e2                	jne    2f9 <strcpy+0xd>
+  return os;
+ 317:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+
+0000031c <strcmp>:
+{
+ 31c:	55                   	push   %ebp
+ 31d:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 31f:	eb 08                	jmp    329 <strcmp+0xd>
+    p++, q++;
+ 321:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 325:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 329:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32c:	0f b6 00             	movzbl (%eax),%eax
+ 32f:	84 c0                	test   %al,%al
+ 331:	74 10                	je     343 <strcmp+0x27>
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	0f b6 10             	movzbl (%eax),%edx
+ 339:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 33c:	0f b6 00             	movzbl (%eax),%eax
+ 33f:	38 c2                	cmp    %al,%dl
+ 341:	74 de                	je     321 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	0f b6 00             	movzbl (%eax),%eax
+ 349:	0f b6 d0             	movzbl %al,%edx
+ 34c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 34f:	0f b6 00             	movzbl (%eax),%eax
+ 352:	0f b6 c0             	movzbl %al,%eax
+ 355:	29 c2                	sub    %eax,%edx
+ 357:	89 d0                	mov    %edx,%eax
+}
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+
+0000035b <strlen>:
+{
+ 35b:	55                   	push   %ebp
+ 35c:	89 e5                	mov    %esp,%ebp
+ 35e:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 361:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 368:	eb 04                	jmp    36e <strlen+0x13>
+ 36a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 36e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 371:	8b 45 08             	mov    0x8(%ebp),%eax
+ 374:	01 d0                	add    %edx,%eax
+ 376:	0f b6 00             	movzbl (%eax),%eax
+ 379:	84 c0                	test   %al,%al
+ 37b:	75 ed                	jne    36a <strlen+0xf>
+  return n;
+ 37d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 380:	c9                   	leave
+ 381:	c3                   	ret
+
+00000382 <memset>:
+{
+ 382:	55                   	push   %ebp
+ 383:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 385:	8b 45 10             	mov    0x10(%ebp),%eax
+ 388:	50                   	push   %eax
+ 389:	ff 75 0c             	push   0xc(%ebp)
+ 38c:	ff 75 08             	push   0x8(%ebp)
+ 38f:	e8 32 ff ff ff       	call   2c6 <stosb>
+ 394:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 397:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 39a:	c9                   	leave
+ 39b:	c3                   	ret
+
+0000039c <strchr>:
+{
+ 39c:	55                   	push   %ebp
+ 39d:	89 e5                	mov    %esp,%ebp
+ 39f:	83 ec 04             	sub    $0x4,%esp
+ 3a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3a5:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 3a8:	eb 14                	jmp    3be <strchr+0x22>
+    if(*s == c)
+ 3aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ad:	0f b6 00             	movzbl (%eax),%eax
+ 3b0:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3b3:	75 05                	jne    3ba <strchr+0x1e>
+      return (char*)s;
+ 3b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b8:	eb 13                	jmp    3cd <strchr+0x31>
+  for(; *s; s++)
+ 3ba:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c1:	0f b6 00             	movzbl (%eax),%eax
+ 3c4:	84 c0                	test   %al,%al
+ 3c6:	75 e2                	jne    3aa <strchr+0xe>
+  return 0;
+ 3c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3cd:	c9                   	leave
+ 3ce:	c3                   	ret
+
+000003cf <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3cf:	55                   	push   %ebp
+ 3d0:	89 e5                	mov    %esp,%ebp
+ 3d2:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3d5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3dc:	eb 42                	jmp    420 <gets+0x51>
+    cc = read(0, &c, 1);
+ 3de:	83 ec 04             	sub    $0x4,%esp
+ 3e1:	6a 01                	push   $0x1
+ 3e3:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 3e6:	50                   	push   %eax
+ 3e7:	6a 00                	push   $0x0
+ 3e9:	e8 21 02 00 00       	call   60f <read>
+ 3ee:	83 c4 10             	add    $0x10,%esp
+ 3f1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 3f4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 3f8:	7e 33                	jle    42d <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 3fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3fd:	8d 50 01             	lea    0x1(%eax),%edx
+ 400:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 403:	89 c2                	mov    %eax,%edx
+ 405:	8b 45 08             	mov    0x8(%ebp),%eax
+ 408:	01 c2                	add    %eax,%edx
+ 40a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 40e:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 410:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 414:	3c 0a                	cmp    $0xa,%al
+ 416:	74 16                	je     42e <gets+0x5f>
+ 418:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 41c:	3c 0d                	cmp    $0xd,%al
+ 41e:	74 0e                	je     42e <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 423:	83 c0 01             	add    $0x1,%eax
+ 426:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 429:	7f b3                	jg     3de <gets+0xf>
+ 42b:	eb 01                	jmp    42e <gets+0x5f>
+      break;
+ 42d:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 42e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 431:	8b 45 08             	mov    0x8(%ebp),%eax
+ 434:	01 d0                	add    %edx,%eax
+ 436:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 439:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 43c:	c9                   	leave
+ 43d:	c3                   	ret
+
+0000043e <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 43e:	55                   	push   %ebp
+ 43f:	89 e5                	mov    %esp,%ebp
+ 441:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 444:	83 ec 08             	sub    $0x8,%esp
+ 447:	6a 00                	push   $0x0
+ 449:	ff 75 08             	push   0x8(%ebp)
+ 44c:	e8 e6 01 00 00       	call   637 <open>
+ 451:	83 c4 10             	add    $0x10,%esp
+ 454:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 457:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 45b:	79 07                	jns    464 <stat+0x26>
+    return -1;
+ 45d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 462:	eb 25                	jmp    489 <stat+0x4b>
+  r = fstat(fd, st);
+ 464:	83 ec 08             	sub    $0x8,%esp
+ 467:	ff 75 0c             	push   0xc(%ebp)
+ 46a:	ff 75 f4             	push   -0xc(%ebp)
+ 46d:	e8 dd 01 00 00       	call   64f <fstat>
+ 472:	83 c4 10             	add    $0x10,%esp
+ 475:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 478:	83 ec 0c             	sub    $0xc,%esp
+ 47b:	ff 75 f4             	push   -0xc(%ebp)
+ 47e:	e8 9c 01 00 00       	call   61f <close>
+ 483:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 486:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 489:	c9                   	leave
+ 48a:	c3                   	ret
+
+0000048b <atoi>:
+
+int
+atoi(const char *s)
+{
+ 48b:	55                   	push   %ebp
+ 48c:	89 e5                	mov    %esp,%ebp
+ 48e:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 491:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 498:	eb 25                	jmp    4bf <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 49a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 49d:	89 d0                	mov    %edx,%eax
+ 49f:	c1 e0 02             	shl    $0x2,%eax
+ 4a2:	01 d0                	add    %edx,%eax
+ 4a4:	01 c0                	add    %eax,%eax
+ 4a6:	89 c1                	mov    %eax,%ecx
+ 4a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ab:	8d 50 01             	lea    0x1(%eax),%edx
+ 4ae:	89 55 08             	mov    %edx,0x8(%ebp)
+ 4b1:	0f b6 00             	movzbl (%eax),%eax
+ 4b4:	0f be c0             	movsbl %al,%eax
+ 4b7:	01 c8                	add    %ecx,%eax
+ 4b9:	83 e8 30             	sub    $0x30,%eax
+ 4bc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c2:	0f b6 00             	movzbl (%eax),%eax
+ 4c5:	3c 2f                	cmp    $0x2f,%al
+ 4c7:	7e 0a                	jle    4d3 <atoi+0x48>
+ 4c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4cc:	0f b6 00             	movzbl (%eax),%eax
+ 4cf:	3c 39                	cmp    $0x39,%al
+ 4d1:	7e c7                	jle    49a <atoi+0xf>
+  return n;
+ 4d3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4d6:	c9                   	leave
+ 4d7:	c3                   	ret
+
+000004d8 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4d8:	55                   	push   %ebp
+ 4d9:	89 e5                	mov    %esp,%ebp
+ 4db:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 4de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4e7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 4ea:	eb 17                	jmp    503 <memmove+0x2b>
+    *dst++ = *src++;
+ 4ec:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4ef:	8d 42 01             	lea    0x1(%edx),%eax
+ 4f2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4f8:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4fb:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4fe:	0f b6 12             	movzbl (%edx),%edx
+ 501:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 503:	8b 45 10             	mov    0x10(%ebp),%eax
+ 506:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 509:	89 55 10             	mov    %edx,0x10(%ebp)
+ 50c:	85 c0                	test   %eax,%eax
+ 50e:	7f dc                	jg     4ec <memmove+0x14>
+  return vdst;
+ 510:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 513:	c9                   	leave
+ 514:	c3                   	ret
+
+00000515 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 515:	55                   	push   %ebp
+ 516:	89 e5                	mov    %esp,%ebp
+ 518:	57                   	push   %edi
+ 519:	56                   	push   %esi
+ 51a:	83 ec 30             	sub    $0x30,%esp
+ 51d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 520:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 523:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 526:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 529:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 530:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 537:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 53a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 53d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 540:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 543:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 54a:	e9 89 00 00 00       	jmp    5d8 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 54f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 552:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 555:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 559:	01 c0                	add    %eax,%eax
+ 55b:	89 c6                	mov    %eax,%esi
+ 55d:	89 d7                	mov    %edx,%edi
+ 55f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 562:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 565:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 568:	0f ad d0             	shrd   %cl,%edx,%eax
+ 56b:	d3 ea                	shr    %cl,%edx
+ 56d:	f6 c1 20             	test   $0x20,%cl
+ 570:	74 04                	je     576 <udiv64+0x61>
+ 572:	89 d0                	mov    %edx,%eax
+ 574:	31 d2                	xor    %edx,%edx
+ 576:	83 e0 01             	and    $0x1,%eax
+ 579:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 57c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 583:	89 f0                	mov    %esi,%eax
+ 585:	89 fa                	mov    %edi,%edx
+ 587:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 58a:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 58d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 590:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 593:	8b 45 10             	mov    0x10(%ebp),%eax
+ 596:	ba 00 00 00 00       	mov    $0x0,%edx
+ 59b:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 59e:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 5a1:	19 d1                	sbb    %edx,%ecx
+ 5a3:	72 2f                	jb     5d4 <udiv64+0xbf>
+      r -= d;
+ 5a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5a8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5ad:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 5b0:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 5b3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 5b6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5bb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5c0:	0f a5 c2             	shld   %cl,%eax,%edx
+ 5c3:	d3 e0                	shl    %cl,%eax
+ 5c5:	f6 c1 20             	test   $0x20,%cl
+ 5c8:	74 04                	je     5ce <udiv64+0xb9>
+ 5ca:	89 c2                	mov    %eax,%edx
+ 5cc:	31 c0                	xor    %eax,%eax
+ 5ce:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 5d1:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 5d4:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 5d8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 5dc:	0f 89 6d ff ff ff    	jns    54f <udiv64+0x3a>
+    }
+  }
+  return q;
+ 5e2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5e5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 5e8:	83 c4 30             	add    $0x30,%esp
+ 5eb:	5e                   	pop    %esi
+ 5ec:	5f                   	pop    %edi
+ 5ed:	5d                   	pop    %ebp
+ 5ee:	c3                   	ret
+
+000005ef <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5ef:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5f4:	cd 40                	int    $0x40
+ 5f6:	c3                   	ret
+
+000005f7 <exit>:
+SYSCALL(exit)
+ 5f7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5fc:	cd 40                	int    $0x40
+ 5fe:	c3                   	ret
+
+000005ff <wait>:
+SYSCALL(wait)
+ 5ff:	b8 03 00 00 00       	mov    $0x3,%eax
+ 604:	cd 40                	int    $0x40
+ 606:	c3                   	ret
+
+00000607 <pipe>:
+SYSCALL(pipe)
+ 607:	b8 04 00 00 00       	mov    $0x4,%eax
+ 60c:	cd 40                	int    $0x40
+ 60e:	c3                   	ret
+
+0000060f <read>:
+SYSCALL(read)
+ 60f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 614:	cd 40                	int    $0x40
+ 616:	c3                   	ret
+
+00000617 <write>:
+SYSCALL(write)
+ 617:	b8 10 00 00 00       	mov    $0x10,%eax
+ 61c:	cd 40                	int    $0x40
+ 61e:	c3                   	ret
+
+0000061f <close>:
+SYSCALL(close)
+ 61f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 624:	cd 40                	int    $0x40
+ 626:	c3                   	ret
+
+00000627 <kill>:
+SYSCALL(kill)
+ 627:	b8 06 00 00 00       	mov    $0x6,%eax
+ 62c:	cd 40                	int    $0x40
+ 62e:	c3                   	ret
+
+0000062f <exec>:
+SYSCALL(exec)
+ 62f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 634:	cd 40                	int    $0x40
+ 636:	c3                   	ret
+
+00000637 <open>:
+SYSCALL(open)
+ 637:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 63c:	cd 40                	int    $0x40
+ 63e:	c3                   	ret
+
+0000063f <mknod>:
+SYSCALL(mknod)
+ 63f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 644:	cd 40                	int    $0x40
+ 646:	c3                   	ret
+
+00000647 <unlink>:
+SYSCALL(unlink)
+ 647:	b8 12 00 00 00       	mov    $0x12,%eax
+ 64c:	cd 40                	int    $0x40
+ 64e:	c3                   	ret
+
+0000064f <fstat>:
+SYSCALL(fstat)
+ 64f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 654:	cd 40                	int    $0x40
+ 656:	c3                   	ret
+
+00000657 <link>:
+SYSCALL(link)
+ 657:	b8 13 00 00 00       	mov    $0x13,%eax
+ 65c:	cd 40                	int    $0x40
+ 65e:	c3                   	ret
+
+0000065f <mkdir>:
+SYSCALL(mkdir)
+ 65f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <chdir>:
+SYSCALL(chdir)
+ 667:	b8 09 00 00 00       	mov    $0x9,%eax
+ 66c:	cd 40                	int    $0x40
+ 66e:	c3                   	ret
+
+0000066f <dup>:
+SYSCALL(dup)
+ 66f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 674:	cd 40                	int    $0x40
+ 676:	c3                   	ret
+
+00000677 <getpid>:
+SYSCALL(getpid)
+ 677:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 67c:	cd 40                	int    $0x40
+ 67e:	c3                   	ret
+
+0000067f <sbrk>:
+SYSCALL(sbrk)
+ 67f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <sleep>:
+SYSCALL(sleep)
+ 687:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 68c:	cd 40                	int    $0x40
+ 68e:	c3                   	ret
+
+0000068f <uptime>:
+SYSCALL(uptime)
+ 68f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 697:	b8 16 00 00 00       	mov    $0x16,%eax
+ 69c:	cd 40                	int    $0x40
+ 69e:	c3                   	ret
+
+0000069f <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 69f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6a4:	cd 40                	int    $0x40
+ 6a6:	c3                   	ret
+
+000006a7 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 6a7:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6ac:	cd 40                	int    $0x40
+ 6ae:	c3                   	ret
+
+000006af <copy_file>:
+SYSCALL(copy_file)
+ 6af:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6b4:	cd 40                	int    $0x40
+ 6b6:	c3                   	ret
+
+000006b7 <change_queue>:
+SYSCALL(change_queue)
+ 6b7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6bc:	cd 40                	int    $0x40
+ 6be:	c3                   	ret
+
+000006bf <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 6bf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6c4:	cd 40                	int    $0x40
+ 6c6:	c3                   	ret
+
+000006c7 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 6c7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6cc:	cd 40                	int    $0x40
+ 6ce:	c3                   	ret
+
+000006cf <print_process_info>:
+SYSCALL(print_process_info)
+ 6cf:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6d4:	cd 40                	int    $0x40
+ 6d6:	c3                   	ret
+
+000006d7 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 6d7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6dc:	cd 40                	int    $0x40
+ 6de:	c3                   	ret
+
+000006df <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 6df:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6e4:	cd 40                	int    $0x40
+ 6e6:	c3                   	ret
+
+000006e7 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 6e7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6ec:	cd 40                	int    $0x40
+ 6ee:	c3                   	ret
+
+000006ef <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 6ef:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6f4:	cd 40                	int    $0x40
+ 6f6:	c3                   	ret
+
+000006f7 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 6f7:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6fc:	cd 40                	int    $0x40
+ 6fe:	c3                   	ret
+
+000006ff <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 6ff:	b8 23 00 00 00       	mov    $0x23,%eax
+ 704:	cd 40                	int    $0x40
+ 706:	c3                   	ret
+
+00000707 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 707:	b8 24 00 00 00       	mov    $0x24,%eax
+ 70c:	cd 40                	int    $0x40
+ 70e:	c3                   	ret
+
+0000070f <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 70f:	b8 25 00 00 00       	mov    $0x25,%eax
+ 714:	cd 40                	int    $0x40
+ 716:	c3                   	ret
+
+00000717 <set_affinity>:
+SYSCALL(set_affinity)
+ 717:	b8 26 00 00 00       	mov    $0x26,%eax
+ 71c:	cd 40                	int    $0x40
+ 71e:	c3                   	ret
+
+0000071f <setsched>:
+SYSCALL(setsched)
+ 71f:	b8 27 00 00 00       	mov    $0x27,%eax
+ 724:	cd 40                	int    $0x40
+ 726:	c3                   	ret
+
+00000727 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 727:	b8 28 00 00 00       	mov    $0x28,%eax
+ 72c:	cd 40                	int    $0x40
+ 72e:	c3                   	ret
+
+0000072f <set_quantum>:
+SYSCALL(set_quantum)
+ 72f:	b8 29 00 00 00       	mov    $0x29,%eax
+ 734:	cd 40                	int    $0x40
+ 736:	c3                   	ret
+
+00000737 <schedtrace>:
+SYSCALL(schedtrace)
+ 737:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 73c:	cd 40                	int    $0x40
+ 73e:	c3                   	ret
+
+0000073f <getrusage>:
+SYSCALL(getrusage)
+ 73f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 744:	cd 40                	int    $0x40
+ 746:	c3                   	ret
+
+00000747 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 747:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 74c:	cd 40                	int    $0x40
+ 74e:	c3                   	ret
+
+0000074f <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 74f:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 754:	cd 40                	int    $0x40
+ 756:	c3                   	ret
+
+00000757 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 757:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 75c:	cd 40                	int    $0x40
+ 75e:	c3                   	ret
+
+0000075f <futex_wait>:
+SYSCALL(futex_wait)
+ 75f:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 764:	cd 40                	int    $0x40
+ 766:	c3                   	ret
+
+00000767 <futex_wake>:
+SYSCALL(futex_wake)
+ 767:	b8 30 00 00 00       	mov    $0x30,%eax
+ 76c:	cd 40                	int    $0x40
+ 76e:	c3                   	ret
+
+0000076f <syscall_latency>:
+SYSCALL(syscall_latency)
+ 76f:	b8 31 00 00 00       	mov    $0x31,%eax
+ 774:	cd 40                	int    $0x40
+ 776:	c3                   	ret
+
+00000777 <submit_batch>:
+SYSCALL(submit_batch)
+ 777:	b8 32 00 00 00       	mov    $0x32,%eax
+ 77c:	cd 40                	int    $0x40
+ 77e:	c3                   	ret
+
+0000077f <kmem_stats>:
+SYSCALL(kmem_stats)
+ 77f:	b8 33 00 00 00       	mov    $0x33,%eax
+ 784:	cd 40                	int    $0x40
+ 786:	c3                   	ret
+
+00000787 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 787:	b8 34 00 00 00       	mov    $0x34,%eax
+ 78c:	cd 40                	int    $0x40
+ 78e:	c3                   	ret
+
+0000078f <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 78f:	55                   	push   %ebp
+ 790:	89 e5                	mov    %esp,%ebp
+ 792:	83 ec 18             	sub    $0x18,%esp
+ 795:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 798:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 79b:	83 ec 04             	sub    $0x4,%esp
+ 79e:	6a 01                	push   $0x1
+ 7a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 7a3:	50                   	push   %eax
+ 7a4:	ff 75 08             	push   0x8(%ebp)
+ 7a7:	e8 6b fe ff ff       	call   617 <write>
+ 7ac:	83 c4 10             	add    $0x10,%esp
+}
+ 7af:	90                   	nop
+ 7b0:	c9                   	leave
+ 7b1:	c3                   	ret
+
+000007b2 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7b2:	55                   	push   %ebp
+ 7b3:	89 e5                	mov    %esp,%ebp
+ 7b5:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 7b8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 7bf:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 7c3:	74 17                	je     7dc <printint+0x2a>
+ 7c5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 7c9:	79 11                	jns    7dc <printint+0x2a>
+    neg = 1;
+ 7cb:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 7d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7d5:	f7 d8                	neg    %eax
+ 7d7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7da:	eb 06                	jmp    7e2 <printint+0x30>
+  } else {
+    x = xx;
+ 7dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7df:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 7e2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 7e9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7ec:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7ef:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7f4:	f7 f1                	div    %ecx
+ 7f6:	89 d1                	mov    %edx,%ecx
+ 7f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7fb:	8d 50 01             	lea    0x1(%eax),%edx
+ 7fe:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 801:	0f b6 91 88 13 00 00 	movzbl 0x1388(%ecx),%edx
+ 808:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 80c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 80f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 812:	ba 00 00 00 00       	mov    $0x0,%edx
+ 817:	f7 f1                	div    %ecx
+ 819:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 81c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 820:	75 c7                	jne    7e9 <printint+0x37>
+  if(neg)
+ 822:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 826:	74 2d                	je     855 <printint+0xa3>
+    buf[i++] = '-';
+ 828:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 82b:	8d 50 01             	lea    0x1(%eax),%edx
+ 82e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 831:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 836:	eb 1d                	jmp    855 <printint+0xa3>
+    putc(fd, buf[i]);
+ 838:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 83b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 83e:	01 d0                	add    %edx,%eax
+ 840:	0f b6 00             	movzbl (%eax),%eax
+ 843:	0f be c0             	movsbl %al,%eax
+ 846:	83 ec 08             	sub    $0x8,%esp
+ 849:	50                   	push   %eax
+ 84a:	ff 75 08             	push   0x8(%ebp)
+ 84d:	e8 3d ff ff ff       	call   78f <putc>
+ 852:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 855:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 859:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 85d:	79 d9                	jns    838 <printint+0x86>
+}
+ 85f:	90                   	nop
+ 860:	90                   	nop
+ 861:	c9                   	leave
+ 862:	c3                   	ret
+
+00000863 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 863:	55                   	push   %ebp
+ 864:	89 e5                	mov    %esp,%ebp
+ 866:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 869:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 870:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 873:	83 c0 04             	add    $0x4,%eax
+ 876:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 879:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 880:	e9 59 01 00 00       	jmp    9de <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 885:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 888:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 88b:	01 d0                	add    %edx,%eax
+ 88d:	0f b6 00             	movzbl (%eax),%eax
+ 890:	0f be c0             	movsbl %al,%eax
+ 893:	25 ff 00 00 00       	and    $0xff,%eax
+ 898:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 89b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 89f:	75 2c                	jne    8cd <printf+0x6a>
+      if(c == '%'){
+ 8a1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8a5:	75 0c                	jne    8b3 <printf+0x50>
+        state = '%';
+ 8a7:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 8ae:	e9 27 01 00 00       	jmp    9da <printf+0x177>
+      } else {
+        putc(fd, c);
+ 8b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8b6:	0f be c0             	movsbl %al,%eax
+ 8b9:	83 ec 08             	sub    $0x8,%esp
+ 8bc:	50                   	push   %eax
+ 8bd:	ff 75 08             	push   0x8(%ebp)
+ 8c0:	e8 ca fe ff ff       	call   78f <putc>
+ 8c5:	83 c4 10             	add    $0x10,%esp
+ 8c8:	e9 0d 01 00 00       	jmp    9da <printf+0x177>
+      }
+    } else if(state == '%'){
+ 8cd:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 8d1:	0f 85 03 01 00 00    	jne    9da <printf+0x177>
+      if(c == 'd'){
+ 8d7:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 8db:	75 1e                	jne    8fb <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 8dd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8e0:	8b 00                	mov    (%eax),%eax
+ 8e2:	6a 01                	push   $0x1
+ 8e4:	6a 0a                	push   $0xa
+ 8e6:	50                   	push   %eax
+ 8e7:	ff 75 08             	push   0x8(%ebp)
+ 8ea:	e8 c3 fe ff ff       	call   7b2 <printint>
+ 8ef:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8f2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8f6:	e9 d8 00 00 00       	jmp    9d3 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 8fb:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 8ff:	74 06                	je     907 <printf+0xa4>
+ 901:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 905:	75 1e                	jne    925 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 907:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 90a:	8b 00                	mov    (%eax),%eax
+ 90c:	6a 00                	push   $0x0
+ 90e:	6a 10                	push   $0x10
+ 910:	50                   	push   %eax
+ 911:	ff 75 08             	push   0x8(%ebp)
+ 914:	e8 99 fe ff ff       	call   7b2 <printint>
+ 919:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 91c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 920:	e9 ae 00 00 00       	jmp    9d3 <printf+0x170>
+      } else if(c == 's'){
+ 925:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 929:	75 43                	jne    96e <printf+0x10b>
+        s = (char*)*ap;
+ 92b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 92e:	8b 00                	mov    (%eax),%eax
+ 930:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 933:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 937:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 93b:	75 25                	jne    962 <printf+0xff>
+          s = "(null)";
+ 93d:	c7 45 f4 34 0f 00 00 	movl   $0xf34,-0xc(%ebp)
+        while(*s != 0){
+ 944:	eb 1c                	jmp    962 <printf+0xff>
+          putc(fd, *s);
+ 946:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 949:	0f b6 00             	movzbl (%eax),%eax
+ 94c:	0f be c0             	movsbl %al,%eax
+ 94f:	83 ec 08             	sub    $0x8,%esp
+ 952:	50                   	push   %eax
+ 953:	ff 75 08             	push   0x8(%ebp)
+ 956:	e8 34 fe ff ff       	call   78f <putc>
+ 95b:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 95e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 962:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 965:	0f b6 00             	movzbl (%eax),%eax
+ 968:	84 c0                	test   %al,%al
+ 96a:	75 da                	jne    946 <printf+0xe3>
+ 96c:	eb 65                	jmp    9d3 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 96e:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 972:	75 1d                	jne    991 <printf+0x12e>
+        putc(fd, *ap);
+ 974:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 977:	8b 00                	mov    (%eax),%eax
+ 979:	0f be c0             	movsbl %al,%eax
+ 97c:	83 ec 08             	sub    $0x8,%esp
+ 97f:	50                   	push   %eax
+ 980:	ff 75 08             	push   0x8(%ebp)
+ 983:	e8 07 fe ff ff       	call   78f <putc>
+ 988:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 98b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 98f:	eb 42                	jmp    9d3 <printf+0x170>
+      } else if(c == '%'){
+ 991:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 995:	75 17                	jne    9ae <printf+0x14b>
+        putc(fd, c);
+ 997:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 99a:	0f be c0             	movsbl %al,%eax
+ 99d:	83 ec 08             	sub    $0x8,%esp
+ 9a0:	50                   	push   %eax
+ 9a1:	ff 75 08             	push   0x8(%ebp)
+ 9a4:	e8 e6 fd ff ff       	call   78f <putc>
+ 9a9:	83 c4 10             	add    $0x10,%esp
+ 9ac:	eb 25                	jmp    9d3 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 9ae:	83 ec 08             	sub    $0x8,%esp
+ 9b1:	6a 25                	push   $0x25
+ 9b3:	ff 75 08             	push   0x8(%ebp)
+ 9b6:	e8 d4 fd ff ff       	call   78f <putc>
+ 9bb:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 9be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9c1:	0f be c0             	movsbl %al,%eax
+ 9c4:	83 ec 08             	sub    $0x8,%esp
+ 9c7:	50                   	push   %eax
+ 9c8:	ff 75 08             	push   0x8(%ebp)
+ 9cb:	e8 bf fd ff ff       	call   78f <putc>
+ 9d0:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 9d3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9da:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 9de:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9e4:	01 d0                	add    %edx,%eax
+ 9e6:	0f b6 00             	movzbl (%eax),%eax
+ 9e9:	84 c0                	test   %al,%al
+ 9eb:	0f 85 94 fe ff ff    	jne    885 <printf+0x22>
+    }
+  }
+}
+ 9f1:	90                   	nop
+ 9f2:	90                   	nop
+ 9f3:	c9                   	leave
+ 9f4:	c3                   	ret
+
+000009f5 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9f5:	55                   	push   %ebp
+ 9f6:	89 e5                	mov    %esp,%ebp
+ 9f8:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 9fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9fe:	83 e8 08             	sub    $0x8,%eax
+ a01:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a04:	a1 48 17 00 00       	mov    0x1748,%eax
+ a09:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a0c:	eb 24                	jmp    a32 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a0e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a11:	8b 00                	mov    (%eax),%eax
+ a13:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a16:	72 12                	jb     a2a <free+0x35>
+ a18:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a1b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a1e:	72 24                	jb     a44 <free+0x4f>
+ a20:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a23:	8b 00                	mov    (%eax),%eax
+ a25:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a28:	72 1a                	jb     a44 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a2a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a2d:	8b 00                	mov    (%eax),%eax
+ a2f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a32:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a35:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a38:	73 d4                	jae    a0e <free+0x19>
+ a3a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a3d:	8b 00                	mov    (%eax),%eax
+ a3f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a42:	73 ca                	jae    a0e <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a44:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a47:	8b 40 04             	mov    0x4(%eax),%eax
+ a4a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a51:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a54:	01 c2                	add    %eax,%edx
+ a56:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a59:	8b 00                	mov    (%eax),%eax
+ a5b:	39 c2                	cmp    %eax,%edx
+ a5d:	75 24                	jne    a83 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ a5f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a62:	8b 50 04             	mov    0x4(%eax),%edx
+ a65:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a68:	8b 00                	mov    (%eax),%eax
+ a6a:	8b 40 04             	mov    0x4(%eax),%eax
+ a6d:	01 c2                	add    %eax,%edx
+ a6f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a72:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a75:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a78:	8b 00                	mov    (%eax),%eax
+ a7a:	8b 10                	mov    (%eax),%edx
+ a7c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a7f:	89 10                	mov    %edx,(%eax)
+ a81:	eb 0a                	jmp    a8d <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a83:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a86:	8b 10                	mov    (%eax),%edx
+ a88:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a8b:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ a8d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a90:	8b 40 04             	mov    0x4(%eax),%eax
+ a93:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a9a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a9d:	01 d0                	add    %edx,%eax
+ a9f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ aa2:	75 20                	jne    ac4 <free+0xcf>
+    p->s.size += bp->s.size;
+ aa4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa7:	8b 50 04             	mov    0x4(%eax),%edx
+ aaa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aad:	8b 40 04             	mov    0x4(%eax),%eax
+ ab0:	01 c2                	add    %eax,%edx
+ ab2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab5:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ ab8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ abb:	8b 10                	mov    (%eax),%edx
+ abd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac0:	89 10                	mov    %edx,(%eax)
+ ac2:	eb 08                	jmp    acc <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ ac4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac7:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ aca:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ acc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ acf:	a3 48 17 00 00       	mov    %eax,0x1748
+}
+ ad4:	90                   	nop
+ ad5:	c9                   	leave
+ ad6:	c3                   	ret
+
+00000ad7 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ ad7:	55                   	push   %ebp
+ ad8:	89 e5                	mov    %esp,%ebp
+ ada:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ add:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ ae4:	77 07                	ja     aed <morecore+0x16>
+    nu = 4096;
+ ae6:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ aed:	8b 45 08             	mov    0x8(%ebp),%eax
+ af0:	c1 e0 03             	shl    $0x3,%eax
+ af3:	83 ec 0c             	sub    $0xc,%esp
+ af6:	50                   	push   %eax
+ af7:	e8 83 fb ff ff       	call   67f <sbrk>
+ afc:	83 c4 10             	add    $0x10,%esp
+ aff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ b02:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b06:	75 07                	jne    b0f <morecore+0x38>
+    return 0;
+ b08:	b8 00 00 00 00       	mov    $0x0,%eax
+ b0d:	eb 26                	jmp    b35 <morecore+0x5e>
+  hp = (Header*)p;
+ b0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b12:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ b15:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b18:	8b 55 08             	mov    0x8(%ebp),%edx
+ b1b:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ b1e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b21:	83 c0 08             	add    $0x8,%eax
+ b24:	83 ec 0c             	sub    $0xc,%esp
+ b27:	50                   	push   %eax
+ b28:	e8 c8 fe ff ff       	call   9f5 <free>
+ b2d:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ b30:	a1 48 17 00 00       	mov    0x1748,%eax
+}
+ b35:	c9                   	leave
+ b36:	c3                   	ret
+
+00000b37 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b37:	55                   	push   %ebp
+ b38:	89 e5                	mov    %esp,%ebp
+ b3a:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b3d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b40:	83 c0 07             	add    $0x7,%eax
+ b43:	c1 e8 03             	shr    $0x3,%eax
+ b46:	83 c0 01             	add    $0x1,%eax
+ b49:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ b4c:	a1 48 17 00 00       	mov    0x1748,%eax
+ b51:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b54:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b58:	75 23                	jne    b7d <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ b5a:	c7 45 f0 40 17 00 00 	movl   $0x1740,-0x10(%ebp)
+ b61:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b64:	a3 48 17 00 00       	mov    %eax,0x1748
+ b69:	a1 48 17 00 00       	mov    0x1748,%eax
+ b6e:	a3 40 17 00 00       	mov    %eax,0x1740
+    base.s.size = 0;
+ b73:	c7 05 44 17 00 00 00 	movl   $0x0,0x1744
+ b7a:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b7d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b80:	8b 00                	mov    (%eax),%eax
+ b82:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b88:	8b 40 04             	mov    0x4(%eax),%eax
+ b8b:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b8e:	72 4d                	jb     bdd <malloc+0xa6>
+      if(p->s.size == nunits)
+ b90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b93:	8b 40 04             	mov    0x4(%eax),%eax
+ b96:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b99:	75 0c                	jne    ba7 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ b9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b9e:	8b 10                	mov    (%eax),%edx
+ ba0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ba3:	89 10                	mov    %edx,(%eax)
+ ba5:	eb 26                	jmp    bcd <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ ba7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ baa:	8b 40 04             	mov    0x4(%eax),%eax
+ bad:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ bb0:	89 c2                	mov    %eax,%edx
+ bb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bb5:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ bb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bbb:	8b 40 04             	mov    0x4(%eax),%eax
+ bbe:	c1 e0 03             	shl    $0x3,%eax
+ bc1:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ bc4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bc7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ bca:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ bcd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bd0:	a3 48 17 00 00       	mov    %eax,0x1748
+      return (void*)(p + 1);
+ bd5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bd8:	83 c0 08             	add    $0x8,%eax
+ bdb:	eb 3b                	jmp    c18 <malloc+0xe1>
+    }
+    if(p == freep)
+ bdd:	a1 48 17 00 00       	mov    0x1748,%eax
+ be2:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ be5:	75 1e                	jne    c05 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ be7:	83 ec 0c             	sub    $0xc,%esp
+ bea:	ff 75 ec             	push   -0x14(%ebp)
+ bed:	e8 e5 fe ff ff       	call   ad7 <morecore>
+ bf2:	83 c4 10             	add    $0x10,%esp
+ bf5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ bf8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bfc:	75 07                	jne    c05 <malloc+0xce>
+        return 0;
+ bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+ c03:	eb 13                	jmp    c18 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c08:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c0e:	8b 00                	mov    (%eax),%eax
+ c10:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c13:	e9 6d ff ff ff       	jmp    b85 <malloc+0x4e>
+  }
+}
+ c18:	c9                   	leave
+ c19:	c3                   	ret
+
+00000c1a <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ c1a:	55                   	push   %ebp
+ c1b:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ c1d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c20:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c26:	90                   	nop
+ c27:	5d                   	pop    %ebp
+ c28:	c3                   	ret
+
+00000c29 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ c29:	55                   	push   %ebp
+ c2a:	89 e5                	mov    %esp,%ebp
+ c2c:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ c2f:	8b 55 08             	mov    0x8(%ebp),%edx
+ c32:	b8 00 00 00 00       	mov    $0x0,%eax
+ c37:	b9 01 00 00 00       	mov    $0x1,%ecx
+ c3c:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c40:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c43:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c47:	74 3b                	je     c84 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ c49:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ c4d:	74 2d                	je     c7c <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ c4f:	8b 55 08             	mov    0x8(%ebp),%edx
+ c52:	b8 02 00 00 00       	mov    $0x2,%eax
+ c57:	87 02                	xchg   %eax,(%edx)
+ c59:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ c5c:	eb 1e                	jmp    c7c <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ c5e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c61:	83 ec 08             	sub    $0x8,%esp
+ c64:	6a 02                	push   $0x2
+ c66:	50                   	push   %eax
+ c67:	e8 f3 fa ff ff       	call   75f <futex_wait>
+ c6c:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ c6f:	8b 55 08             	mov    0x8(%ebp),%edx
+ c72:	b8 02 00 00 00       	mov    $0x2,%eax
+ c77:	87 02                	xchg   %eax,(%edx)
+ c79:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ c7c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c80:	75 dc                	jne    c5e <mutex_lock+0x35>
+ c82:	eb 01                	jmp    c85 <mutex_lock+0x5c>
+    return;
+ c84:	90                   	nop
+  }
+}
+ c85:	c9                   	leave
+ c86:	c3                   	ret
+
+00000c87 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ c87:	55                   	push   %ebp
+ c88:	89 e5                	mov    %esp,%ebp
+ c8a:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ c8d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c90:	ba 01 00 00 00       	mov    $0x1,%edx
+ c95:	f7 da                	neg    %edx
+ c97:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ c9b:	83 fa 01             	cmp    $0x1,%edx
+ c9e:	74 1a                	je     cba <mutex_unlock+0x33>
+    m->state = 0;
+ ca0:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+ cac:	83 ec 08             	sub    $0x8,%esp
+ caf:	6a 01                	push   $0x1
+ cb1:	50                   	push   %eax
+ cb2:	e8 b0 fa ff ff       	call   767 <futex_wake>
+ cb7:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ cba:	90                   	nop
+ cbb:	c9                   	leave
+ cbc:	c3                   	ret
+
+00000cbd <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ cbd:	55                   	push   %ebp
+ cbe:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ cc0:	8b 45 08             	mov    0x8(%ebp),%eax
+ cc3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ cc9:	8b 45 08             	mov    0x8(%ebp),%eax
+ ccc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ cd3:	90                   	nop
+ cd4:	5d                   	pop    %ebp
+ cd5:	c3                   	ret
+
+00000cd6 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ cd6:	55                   	push   %ebp
+ cd7:	89 e5                	mov    %esp,%ebp
+ cd9:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ cdc:	8b 45 08             	mov    0x8(%ebp),%eax
+ cdf:	83 c0 04             	add    $0x4,%eax
+ ce2:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce9:	83 ec 08             	sub    $0x8,%esp
+ cec:	ff 75 0c             	push   0xc(%ebp)
+ cef:	50                   	push   %eax
+ cf0:	e8 6a fa ff ff       	call   75f <futex_wait>
+ cf5:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ cf8:	8b 45 08             	mov    0x8(%ebp),%eax
+ cfb:	83 c0 04             	add    $0x4,%eax
+ cfe:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ d02:	90                   	nop
+ d03:	c9                   	leave
+ d04:	c3                   	ret
+
+00000d05 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ d05:	55                   	push   %ebp
+ d06:	89 e5                	mov    %esp,%ebp
+ d08:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ d0b:	8b 45 08             	mov    0x8(%ebp),%eax
+ d0e:	8b 00                	mov    (%eax),%eax
+ d10:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ d13:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d17:	78 17                	js     d30 <rwlock_rdlock+0x2b>
+ d19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d1c:	83 c0 01             	add    $0x1,%eax
+ d1f:	89 c1                	mov    %eax,%ecx
+ d21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d24:	8b 55 08             	mov    0x8(%ebp),%edx
+ d27:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ d2b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d2e:	74 19                	je     d49 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ d30:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d34:	79 d5                	jns    d0b <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ d36:	83 ec 08             	sub    $0x8,%esp
+ d39:	ff 75 f4             	push   -0xc(%ebp)
+ d3c:	ff 75 08             	push   0x8(%ebp)
+ d3f:	e8 92 ff ff ff       	call   cd6 <rwlock_sleep>
+ d44:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ d47:	eb c2                	jmp    d0b <rwlock_rdlock+0x6>
+      return;
+ d49:	90                   	nop
+  }
+}
+ d4a:	c9                   	leave
+ d4b:	c3                   	ret
+
+00000d4c <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ d4c:	55                   	push   %ebp
+ d4d:	89 e5                	mov    %esp,%ebp
+ d4f:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ d52:	eb 11                	jmp    d65 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ d54:	83 ec 08             	sub    $0x8,%esp
+ d57:	ff 75 f4             	push   -0xc(%ebp)
+ d5a:	ff 75 08             	push   0x8(%ebp)
+ d5d:	e8 74 ff ff ff       	call   cd6 <rwlock_sleep>
+ d62:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ d65:	8b 55 08             	mov    0x8(%ebp),%edx
+ d68:	b8 00 00 00 00       	mov    $0x0,%eax
+ d6d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ d72:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ d76:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d79:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d7d:	75 d5                	jne    d54 <rwlock_wrlock+0x8>
+}
+ d7f:	90                   	nop
+ d80:	90                   	nop
+ d81:	c9                   	leave
+ d82:	c3                   	ret
+
+00000d83 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ d83:	55                   	push   %ebp
+ d84:	89 e5                	mov    %esp,%ebp
+ d86:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ d89:	8b 45 08             	mov    0x8(%ebp),%eax
+ d8c:	8b 00                	mov    (%eax),%eax
+ d8e:	85 c0                	test   %eax,%eax
+ d90:	79 0c                	jns    d9e <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ d92:	8b 45 08             	mov    0x8(%ebp),%eax
+ d95:	ba 00 00 00 00       	mov    $0x0,%edx
+ d9a:	87 10                	xchg   %edx,(%eax)
+ d9c:	eb 18                	jmp    db6 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ d9e:	8b 55 08             	mov    0x8(%ebp),%edx
+ da1:	b8 01 00 00 00       	mov    $0x1,%eax
+ da6:	f7 d8                	neg    %eax
+ da8:	89 c1                	mov    %eax,%ecx
+ daa:	89 c8                	mov    %ecx,%eax
+ dac:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ db0:	01 c8                	add    %ecx,%eax
+ db2:	85 c0                	test   %eax,%eax
+ db4:	75 20                	jne    dd6 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ db6:	8b 45 08             	mov    0x8(%ebp),%eax
+ db9:	8b 40 04             	mov    0x4(%eax),%eax
+ dbc:	85 c0                	test   %eax,%eax
+ dbe:	74 17                	je     dd7 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ dc0:	8b 45 08             	mov    0x8(%ebp),%eax
+ dc3:	83 ec 08             	sub    $0x8,%esp
+ dc6:	68 ff ff ff 7f       	push   $0x7fffffff
+ dcb:	50                   	push   %eax
+ dcc:	e8 96 f9 ff ff       	call   767 <futex_wake>
+ dd1:	83 c4 10             	add    $0x10,%esp
+ dd4:	eb 01                	jmp    dd7 <rwlock_unlock+0x54>
+    return;
+ dd6:	90                   	nop
+}
+ dd7:	c9                   	leave
+ dd8:	c3                   	ret
+
+00000dd9 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ dd9:	55                   	push   %ebp
+ dda:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ ddc:	8b 45 08             	mov    0x8(%ebp),%eax
+ ddf:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ de5:	90                   	nop
+ de6:	5d                   	pop    %ebp
+ de7:	c3                   	ret
+
+00000de8 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ de8:	55                   	push   %ebp
+ de9:	89 e5                	mov    %esp,%ebp
+ deb:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ dee:	8b 45 08             	mov    0x8(%ebp),%eax
+ df1:	8b 00                	mov    (%eax),%eax
+ df3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ df6:	83 ec 0c             	sub    $0xc,%esp
+ df9:	ff 75 0c             	push   0xc(%ebp)
+ dfc:	e8 86 fe ff ff       	call   c87 <mutex_unlock>
+ e01:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ e04:	8b 45 08             	mov    0x8(%ebp),%eax
+ e07:	83 ec 08             	sub    $0x8,%esp
+ e0a:	ff 75 f4             	push   -0xc(%ebp)
+ e0d:	50                   	push   %eax
+ e0e:	e8 4c f9 ff ff       	call   75f <futex_wait>
+ e13:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ e16:	83 ec 0c             	sub    $0xc,%esp
+ e19:	ff 75 0c             	push   0xc(%ebp)
+ e1c:	e8 08 fe ff ff       	call   c29 <mutex_lock>
+ e21:	83 c4 10             	add    $0x10,%esp
+}
+ e24:	90                   	nop
+ e25:	c9                   	leave
+ e26:	c3                   	ret
+
+00000e27 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ e27:	55                   	push   %ebp
+ e28:	89 e5                	mov    %esp,%ebp
+ e2a:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ e2d:	8b 45 08             	mov    0x8(%ebp),%eax
+ e30:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ e34:	8b 45 08             	mov    0x8(%ebp),%eax
+ e37:	83 ec 08             	sub    $0x8,%esp
+ e3a:	6a 01                	push   $0x1
+ e3c:	50                   	push   %eax
+ e3d:	e8 25 f9 ff ff       	call   767 <futex_wake>
+ e42:	83 c4 10             	add    $0x10,%esp
+}
+ e45:	90                   	nop
+ e46:	c9                   	leave
+ e47:	c3                   	ret
+
+00000e48 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ e48:	55                   	push   %ebp
+ e49:	89 e5                	mov    %esp,%ebp
+ e4b:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ e4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ e51:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ e55:	8b 45 08             	mov    0x8(%ebp),%eax
+ e58:	83 ec 08             	sub    $0x8,%esp
+ e5b:	68 ff ff ff 7f       	push   $0x7fffffff
+ e60:	50                   	push   %eax
+ e61:	e8 01 f9 ff ff       	call   767 <futex_wake>
+ e66:	83 c4 10             	add    $0x10,%esp
+}
+ e69:	90                   	nop
+ e6a:	c9                   	leave
+ e6b:	c3                   	ret
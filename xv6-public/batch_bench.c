@@ -0,0 +1,80 @@
+#include "types.h"
+#include "x86.h"
+#include "user.h"
+#include "fcntl.h"
+#include "syscall.h"
+#include "batch.h"
+
+// Small writes and reads of a file, stressfs style, issued once as
+// one system call each and once through submit_batch(), reporting
+// TSC cycles per operation for both.
+
+#define NOPS 512
+#define CHUNK 16
+
+static struct batch_ring ring;
+static char buf[CHUNK];
+
+void queue(int num, int fd, char *p, int n)
+{
+    struct batch_sqe *sqe;
+
+    // The completion queue is drained before each submit, so the
+    // submission queue only fills up to NBATCH here.
+    sqe = &ring.sq[ring.sq_tail % NBATCH];
+    sqe->num = num;
+    sqe->args[0] = fd;
+    sqe->args[1] = (int)p;
+    sqe->args[2] = n;
+    ring.sq_tail++;
+    if (ring.sq_tail - ring.sq_head == NBATCH)
+    {
+        submit_batch(&ring);
+        ring.cq_head = ring.cq_tail;
+    }
+}
+
+uint64 run(int batched, int num)
+{
+    uint64 start;
+    int fd, i;
+
+    fd = open("batchfile", num == SYS_write ? O_CREATE | O_RDWR : O_RDONLY);
+    if (fd < 0)
+    {
+        printf(1, "batch_bench: cannot open batchfile\n");
+        exit();
+    }
+    start = rdtsc();
+    for (i = 0; i < NOPS; i++)
+    {
+        if (batched)
+            queue(num, fd, buf, CHUNK);
+        else if (num == SYS_write)
+            write(fd, buf, CHUNK);
+        else
+            read(fd, buf, CHUNK);
+    }
+    if (batched && ring.sq_head != ring.sq_tail)
+    {
+        submit_batch(&ring);
+        ring.cq_head = ring.cq_tail;
+    }
+    start = rdtsc() - start;
+    close(fd);
+    return start;
+}
+
+int main(int argc, char *argv[])
+{
+    memset(buf, 'a', CHUNK);
+
+    printf(1, "%d ops of %d bytes, cycles per op:\n", NOPS, CHUNK);
+    printf(1, "write, one syscall each: %d\n", (int)udiv64(run(0, SYS_write), NOPS));
+    printf(1, "write, batched by %d:    %d\n", NBATCH, (int)udiv64(run(1, SYS_write), NOPS));
+    printf(1, "read, one syscall each:  %d\n", (int)udiv64(run(0, SYS_read), NOPS));
+    printf(1, "read, batched by %d:     %d\n", NBATCH, (int)udiv64(run(1, SYS_read), NOPS));
+
+    unlink("batchfile");
+    exit();
+}
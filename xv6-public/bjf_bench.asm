@@ -0,0 +1,2004 @@
+
+_bjf_bench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rdtsc>:
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+   6:	0f 31                	rdtsc
+   8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+   b:	89 55 fc             	mov    %edx,-0x4(%ebp)
+   e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  11:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  14:	c9                   	leave
+  15:	c3                   	ret
+
+00000016 <child_work>:
+{
+  16:	55                   	push   %ebp
+  17:	89 e5                	mov    %esp,%ebp
+  19:	57                   	push   %edi
+  1a:	56                   	push   %esi
+  1b:	53                   	push   %ebx
+  1c:	83 ec 4c             	sub    $0x4c,%esp
+  volatile int x = 0;
+  1f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  change_queue(getpid(), BJF_QUEUE);
+  26:	e8 8c 06 00 00       	call   6b7 <getpid>
+  2b:	83 ec 08             	sub    $0x8,%esp
+  2e:	6a 03                	push   $0x3
+  30:	50                   	push   %eax
+  31:	e8 c1 06 00 00       	call   6f7 <change_queue>
+  36:	83 c4 10             	add    $0x10,%esp
+  if (read(go, &start, sizeof(start)) != sizeof(start))
+  39:	83 ec 04             	sub    $0x4,%esp
+  3c:	6a 08                	push   $0x8
+  3e:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  41:	50                   	push   %eax
+  42:	ff 75 08             	push   0x8(%ebp)
+  45:	e8 05 06 00 00       	call   64f <read>
+  4a:	83 c4 10             	add    $0x10,%esp
+  4d:	83 f8 08             	cmp    $0x8,%eax
+  50:	74 05                	je     57 <child_work+0x41>
+    exit();
+  52:	e8 e0 05 00 00       	call   637 <exit>
+  cycles = rdtsc() - start;
+  57:	e8 a4 ff ff ff       	call   0 <rdtsc>
+  5c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  5f:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+  62:	29 c8                	sub    %ecx,%eax
+  64:	19 da                	sbb    %ebx,%edx
+  66:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  69:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  waited = cycles >> 10 > 0xffffffff ? 0xffffffff : cycles >> 10;
+  6c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  6f:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  72:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+  76:	c1 ea 0a             	shr    $0xa,%edx
+  79:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  83:	39 c1                	cmp    %eax,%ecx
+  85:	89 de                	mov    %ebx,%esi
+  87:	19 d6                	sbb    %edx,%esi
+  89:	89 cf                	mov    %ecx,%edi
+  8b:	0f 43 f8             	cmovae %eax,%edi
+  8e:	89 7d b0             	mov    %edi,-0x50(%ebp)
+  91:	0f 43 da             	cmovae %edx,%ebx
+  94:	89 5d b4             	mov    %ebx,-0x4c(%ebp)
+  97:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  9a:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  for (int i = 0; i < ROUNDS; i++)
+  9d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  a4:	eb 23                	jmp    c9 <child_work+0xb3>
+    for (int j = 0; j < 100000; j++)
+  a6:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  ad:	eb 0d                	jmp    bc <child_work+0xa6>
+      x++;
+  af:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  b2:	83 c0 01             	add    $0x1,%eax
+  b5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    for (int j = 0; j < 100000; j++)
+  b8:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+  bc:	81 7d e0 9f 86 01 00 	cmpl   $0x1869f,-0x20(%ebp)
+  c3:	7e ea                	jle    af <child_work+0x99>
+  for (int i = 0; i < ROUNDS; i++)
+  c5:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  c9:	81 7d e4 c7 00 00 00 	cmpl   $0xc7,-0x1c(%ebp)
+  d0:	7e d4                	jle    a6 <child_work+0x90>
+  write(fd, &waited, sizeof(waited));
+  d2:	83 ec 04             	sub    $0x4,%esp
+  d5:	6a 04                	push   $0x4
+  d7:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  da:	50                   	push   %eax
+  db:	ff 75 0c             	push   0xc(%ebp)
+  de:	e8 74 05 00 00       	call   657 <write>
+  e3:	83 c4 10             	add    $0x10,%esp
+  exit();
+  e6:	e8 4c 05 00 00       	call   637 <exit>
+
+000000eb <main>:
+{
+  eb:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  ef:	83 e4 f0             	and    $0xfffffff0,%esp
+  f2:	ff 71 fc             	push   -0x4(%ecx)
+  f5:	55                   	push   %ebp
+  f6:	89 e5                	mov    %esp,%ebp
+  f8:	51                   	push   %ecx
+  f9:	81 ec 34 02 00 00    	sub    $0x234,%esp
+  uint64 starts[NCHILD], start, total = 0;
+  ff:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 106:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  uint waited, max = 0;
+ 10d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  if (pipe(fds) < 0 || pipe(gofds) < 0)
+ 114:	83 ec 0c             	sub    $0xc,%esp
+ 117:	8d 45 c0             	lea    -0x40(%ebp),%eax
+ 11a:	50                   	push   %eax
+ 11b:	e8 27 05 00 00       	call   647 <pipe>
+ 120:	83 c4 10             	add    $0x10,%esp
+ 123:	85 c0                	test   %eax,%eax
+ 125:	78 13                	js     13a <main+0x4f>
+ 127:	83 ec 0c             	sub    $0xc,%esp
+ 12a:	8d 45 b8             	lea    -0x48(%ebp),%eax
+ 12d:	50                   	push   %eax
+ 12e:	e8 14 05 00 00       	call   647 <pipe>
+ 133:	83 c4 10             	add    $0x10,%esp
+ 136:	85 c0                	test   %eax,%eax
+ 138:	79 17                	jns    151 <main+0x66>
+    printf(1, "Pipe failed.\n");
+ 13a:	83 ec 08             	sub    $0x8,%esp
+ 13d:	68 ac 0e 00 00       	push   $0xeac
+ 142:	6a 01                	push   $0x1
+ 144:	e8 5a 07 00 00       	call   8a3 <printf>
+ 149:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 14c:	e8 e6 04 00 00       	call   637 <exit>
+  for (forked = 0; forked < NCHILD; forked++)
+ 151:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 158:	eb 49                	jmp    1a3 <main+0xb8>
+    int pid = fork();
+ 15a:	e8 d0 04 00 00       	call   62f <fork>
+ 15f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    if (pid < 0)
+ 162:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+ 166:	78 43                	js     1ab <main+0xc0>
+    if (pid == 0)
+ 168:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+ 16c:	75 31                	jne    19f <main+0xb4>
+      close(fds[0]);
+ 16e:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 171:	83 ec 0c             	sub    $0xc,%esp
+ 174:	50                   	push   %eax
+ 175:	e8 e5 04 00 00       	call   65f <close>
+ 17a:	83 c4 10             	add    $0x10,%esp
+      close(gofds[1]);
+ 17d:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 180:	83 ec 0c             	sub    $0xc,%esp
+ 183:	50                   	push   %eax
+ 184:	e8 d6 04 00 00       	call   65f <close>
+ 189:	83 c4 10             	add    $0x10,%esp
+      child_work(gofds[0], fds[1]);
+ 18c:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 18f:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 192:	83 ec 08             	sub    $0x8,%esp
+ 195:	52                   	push   %edx
+ 196:	50                   	push   %eax
+ 197:	e8 7a fe ff ff       	call   16 <child_work>
+ 19c:	83 c4 10             	add    $0x10,%esp
+  for (forked = 0; forked < NCHILD; forked++)
+ 19f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1a3:	83 7d f4 3b          	cmpl   $0x3b,-0xc(%ebp)
+ 1a7:	7e b1                	jle    15a <main+0x6f>
+ 1a9:	eb 01                	jmp    1ac <main+0xc1>
+      break;
+ 1ab:	90                   	nop
+  close(fds[1]);
+ 1ac:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 1af:	83 ec 0c             	sub    $0xc,%esp
+ 1b2:	50                   	push   %eax
+ 1b3:	e8 a7 04 00 00       	call   65f <close>
+ 1b8:	83 c4 10             	add    $0x10,%esp
+  close(gofds[0]);
+ 1bb:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 1be:	83 ec 0c             	sub    $0xc,%esp
+ 1c1:	50                   	push   %eax
+ 1c2:	e8 98 04 00 00       	call   65f <close>
+ 1c7:	83 c4 10             	add    $0x10,%esp
+  sleep(10);
+ 1ca:	83 ec 0c             	sub    $0xc,%esp
+ 1cd:	6a 0a                	push   $0xa
+ 1cf:	e8 f3 04 00 00       	call   6c7 <sleep>
+ 1d4:	83 c4 10             	add    $0x10,%esp
+  ticks = uptime();
+ 1d7:	e8 f3 04 00 00       	call   6cf <uptime>
+ 1dc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  start = rdtsc();
+ 1df:	e8 1c fe ff ff       	call   0 <rdtsc>
+ 1e4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 1e7:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  for (int i = 0; i < forked; i++)
+ 1ea:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 1f1:	eb 1b                	jmp    20e <main+0x123>
+    starts[i] = start;
+ 1f3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 1f6:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 1f9:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 1fc:	89 84 cd d8 fd ff ff 	mov    %eax,-0x228(%ebp,%ecx,8)
+ 203:	89 94 cd dc fd ff ff 	mov    %edx,-0x224(%ebp,%ecx,8)
+  for (int i = 0; i < forked; i++)
+ 20a:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 20e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 211:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+ 214:	7c dd                	jl     1f3 <main+0x108>
+  write(gofds[1], starts, forked * sizeof(starts[0]));
+ 216:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 219:	c1 e0 03             	shl    $0x3,%eax
+ 21c:	89 c2                	mov    %eax,%edx
+ 21e:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 221:	83 ec 04             	sub    $0x4,%esp
+ 224:	52                   	push   %edx
+ 225:	8d 95 d8 fd ff ff    	lea    -0x228(%ebp),%edx
+ 22b:	52                   	push   %edx
+ 22c:	50                   	push   %eax
+ 22d:	e8 25 04 00 00       	call   657 <write>
+ 232:	83 c4 10             	add    $0x10,%esp
+  close(gofds[1]);
+ 235:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 238:	83 ec 0c             	sub    $0xc,%esp
+ 23b:	50                   	push   %eax
+ 23c:	e8 1e 04 00 00       	call   65f <close>
+ 241:	83 c4 10             	add    $0x10,%esp
+  for (int i = 0; i < forked; i++)
+ 244:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 24b:	eb 46                	jmp    293 <main+0x1a8>
+    if (read(fds[0], &waited, sizeof(waited)) != sizeof(waited))
+ 24d:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 04                	push   $0x4
+ 255:	8d 95 d4 fd ff ff    	lea    -0x22c(%ebp),%edx
+ 25b:	52                   	push   %edx
+ 25c:	50                   	push   %eax
+ 25d:	e8 ed 03 00 00       	call   64f <read>
+ 262:	83 c4 10             	add    $0x10,%esp
+ 265:	83 f8 04             	cmp    $0x4,%eax
+ 268:	75 33                	jne    29d <main+0x1b2>
+    total += waited;
+ 26a:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+ 270:	ba 00 00 00 00       	mov    $0x0,%edx
+ 275:	01 45 e8             	add    %eax,-0x18(%ebp)
+ 278:	11 55 ec             	adc    %edx,-0x14(%ebp)
+    if (waited > max)
+ 27b:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+ 281:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+ 284:	73 09                	jae    28f <main+0x1a4>
+      max = waited;
+ 286:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+ 28c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (int i = 0; i < forked; i++)
+ 28f:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+ 293:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 296:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+ 299:	7c b2                	jl     24d <main+0x162>
+ 29b:	eb 01                	jmp    29e <main+0x1b3>
+      break;
+ 29d:	90                   	nop
+  while (wait() != -1)
+ 29e:	90                   	nop
+ 29f:	e8 9b 03 00 00       	call   63f <wait>
+ 2a4:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 2a7:	75 f6                	jne    29f <main+0x1b4>
+  printf(1, "%d BJF processes finished in %d ticks\n", forked, uptime() - ticks);
+ 2a9:	e8 21 04 00 00       	call   6cf <uptime>
+ 2ae:	2b 45 d4             	sub    -0x2c(%ebp),%eax
+ 2b1:	50                   	push   %eax
+ 2b2:	ff 75 f4             	push   -0xc(%ebp)
+ 2b5:	68 bc 0e 00 00       	push   $0xebc
+ 2ba:	6a 01                	push   $0x1
+ 2bc:	e8 e2 05 00 00       	call   8a3 <printf>
+ 2c1:	83 c4 10             	add    $0x10,%esp
+  if (forked > 0)
+ 2c4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2c8:	7e 28                	jle    2f2 <main+0x207>
+           (int)udiv64(total, forked), max);
+ 2ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2cd:	83 ec 04             	sub    $0x4,%esp
+ 2d0:	50                   	push   %eax
+ 2d1:	ff 75 ec             	push   -0x14(%ebp)
+ 2d4:	ff 75 e8             	push   -0x18(%ebp)
+ 2d7:	e8 79 02 00 00       	call   555 <udiv64>
+ 2dc:	83 c4 10             	add    $0x10,%esp
+    printf(1, "first run latency: avg %d Kcycles, max %d Kcycles\n",
+ 2df:	ff 75 e4             	push   -0x1c(%ebp)
+ 2e2:	50                   	push   %eax
+ 2e3:	68 e4 0e 00 00       	push   $0xee4
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 b4 05 00 00       	call   8a3 <printf>
+ 2ef:	83 c4 10             	add    $0x10,%esp
+  close(fds[0]);
+ 2f2:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 2f5:	83 ec 0c             	sub    $0xc,%esp
+ 2f8:	50                   	push   %eax
+ 2f9:	e8 61 03 00 00       	call   65f <close>
+ 2fe:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 301:	e8 31 03 00 00       	call   637 <exit>
+
+00000306 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 306:	55                   	push   %ebp
+ 307:	89 e5                	mov    %esp,%ebp
+ 309:	57                   	push   %edi
+ 30a:	53                   	push   %ebx
+{
+ 30b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 30e:	8b 55 10             	mov    0x10(%ebp),%edx
+ 311:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 314:	89 cb                	mov    %ecx,%ebx
+ 316:	89 df                	mov    %ebx,%edi
+ 318:	89 d1                	mov    %edx,%ecx
+ 31a:	fc                   	cld
+ 31b:	f3 aa                	rep stos %al,%es:(%edi)
+ 31d:	89 ca                	mov    %ecx,%edx
+ 31f:	89 fb                	mov    %edi,%ebx
+ 321:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 324:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 327:	90                   	nop
+ 328:	5b                   	pop    %ebx
+ 329:	5f                   	pop    %edi
+ 32a:	5d                   	pop    %ebp
+ 32b:	c3                   	ret
+
+0000032c <strcpy>:
+{
+ 32c:	55                   	push   %ebp
+ 32d:	89 e5                	mov    %esp,%ebp
+ 32f:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 332:	8b 45 08             	mov    0x8(%ebp),%eax
+ 335:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 338:	90                   	nop
+ 339:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 33c:	8d 42 01             	lea    0x1(%edx),%eax
+ 33f:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 342:	8b 45 08             	mov    0x8(%ebp),%eax
+ 345:	8d 48 01             	lea    0x1(%eax),%ecx
+ 348:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 34b:	0f b6 12             	movzbl (%edx),%edx
+ 34e:	88 10                	mov    %dl,(%eax)
+ 350:	0f b6 00             	movzbl (%eax),%eax
+ 353:	84 c0                	test   %al,%al
+ 355:	75 e2                	jne    339 <strcpy+0xd>
+  return os;
+ 357:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 35a:	c9                   	leave
+ 35b:	c3                   	ret
+
+0000035c <strcmp>:
+{
+ 35c:	55                   	push   %ebp
+ 35d:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 35f:	eb 08                	jmp    369 <strcmp+0xd>
+    p++, q++;
+ 361:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 365:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 369:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36c:	0f b6 00             	movzbl (%eax),%eax
+ 36f:	84 c0                	test   %al,%al
+ 371:	74 10                	je     383 <strcmp+0x27>
+ 373:	8b 45 08             	mov    0x8(%ebp),%eax
+ 376:	0f b6 10             	movzbl (%eax),%edx
+ 379:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 37c:	0f b6 00             	movzbl (%eax),%eax
+ 37f:	38 c2                	cmp    %al,%dl
+ 381:	74 de                	je     361 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	0f b6 00             	movzbl (%eax),%eax
+ 389:	0f b6 d0             	movzbl %al,%edx
+ 38c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 38f:	0f b6 00             	movzbl (%eax),%eax
+ 392:	0f b6 c0             	movzbl %al,%eax
+ 395:	29 c2                	sub    %eax,%edx
+ 397:	89 d0                	mov    %edx,%eax
+}
+ 399:	5d                   	pop    %ebp
+ 39a:	c3                   	ret
+
+0000039b <strlen>:
+{
+ 39b:	55                   	push   %ebp
+ 39c:	89 e5                	mov    %esp,%ebp
+ 39e:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 3a1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3a8:	eb 04                	jmp    3ae <strlen+0x13>
+ 3aa:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3ae:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b4:	01 d0                	add    %edx,%eax
+ 3b6:	0f b6 00             	movzbl (%eax),%eax
+ 3b9:	84 c0                	test   %al,%al
+ 3bb:	75 ed                	jne    3aa <strlen+0xf>
+  return n;
+ 3bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3c0:	c9                   	leave
+ 3c1:	c3                   	ret
+
+000003c2 <memset>:
+{
+ 3c2:	55                   	push   %ebp
+ 3c3:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 3c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3c8:	50                   	push   %eax
+ 3c9:	ff 75 0c             	push   0xc(%ebp)
+ 3cc:	ff 75 08             	push   0x8(%ebp)
+ 3cf:	e8 32 ff ff ff       	call   306 <stosb>
+ 3d4:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 3d7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3da:	c9                   	leave
+ 3db:	c3                   	ret
+
+000003dc <strchr>:
+{
+ 3dc:	55                   	push   %ebp
+ 3dd:	89 e5                	mov    %esp,%ebp
+ 3df:	83 ec 04             	sub    $0x4,%esp
+ 3e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3e5:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 3e8:	eb 14                	jmp    3fe <strchr+0x22>
+    if(*s == c)
+ 3ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ed:	0f b6 00             	movzbl (%eax),%eax
+ 3f0:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3f3:	75 05                	jne    3fa <strchr+0x1e>
+      return (char*)s;
+ 3f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f8:	eb 13                	jmp    40d <strchr+0x31>
+  for(; *s; s++)
+ 3fa:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 401:	0f b6 00             	movzbl (%eax),%eax
+ 404:	84 c0                	test   %al,%al
+ 406:	75 e2                	jne    3ea <strchr+0xe>
+  return 0;
+ 408:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 40d:	c9                   	leave
+ 40e:	c3                   	ret
+
+0000040f <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 40f:	55                   	push   %ebp
+ 410:	89 e5                	mov    %esp,%ebp
+ 412:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 415:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 41c:	eb 42                	jmp    460 <gets+0x51>
+    cc = read(0, &c, 1);
+ 41e:	83 ec 04             	sub    $0x4,%esp
+ 421:	6a 01                	push   $0x1
+ 423:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 426:	50                   	push   %eax
+ 427:	6a 00                	push   $0x0
+ 429:	e8 21 02 00 00       	call   64f <read>
+ 42e:	83 c4 10             	add    $0x10,%esp
+ 431:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 434:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 438:	7e 33                	jle    46d <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 43a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 43d:	8d 50 01             	lea    0x1(%eax),%edx
+ 440:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 443:	89 c2                	mov    %eax,%edx
+ 445:	8b 45 08             	mov    0x8(%ebp),%eax
+ 448:	01 c2                	add    %eax,%edx
+ 44a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 44e:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 450:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 454:	3c 0a                	cmp    $0xa,%al
+ 456:	74 16                	je     46e <gets+0x5f>
+ 458:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 45c:	3c 0d                	cmp    $0xd,%al
+ 45e:	74 0e                	je     46e <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 460:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 463:	83 c0 01             	add    $0x1,%eax
+ 466:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 469:	7f b3                	jg     41e <gets+0xf>
+ 46b:	eb 01                	jmp    46e <gets+0x5f>
+      break;
+ 46d:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 46e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 471:	8b 45 08             	mov    0x8(%ebp),%eax
+ 474:	01 d0                	add    %edx,%eax
+ 476:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 479:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 47c:	c9                   	leave
+ 47d:	c3                   	ret
+
+0000047e <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 47e:	55                   	push   %ebp
+ 47f:	89 e5                	mov    %esp,%ebp
+ 481:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 484:	83 ec 08             	sub    $0x8,%esp
+ 487:	6a 00                	push   $0x0
+ 489:	ff 75 08             	push   0x8(%ebp)
+ 48c:	e8 e6 01 00 00       	call   677 <open>
+ 491:	83 c4 10             	add    $0x10,%esp
+ 494:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 497:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 49b:	79 07                	jns    4a4 <stat+0x26>
+    return -1;
+ 49d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4a2:	eb 25                	jmp    4c9 <stat+0x4b>
+  r = fstat(fd, st);
+ 4a4:	83 ec 08             	sub    $0x8,%esp
+ 4a7:	ff 75 0c             	push   0xc(%ebp)
+ 4aa:	ff 75 f4             	push   -0xc(%ebp)
+ 4ad:	e8 dd 01 00 00       	call   68f <fstat>
+ 4b2:	83 c4 10             	add    $0x10,%esp
+ 4b5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 4b8:	83 ec 0c             	sub    $0xc,%esp
+ 4bb:	ff 75 f4             	push   -0xc(%ebp)
+ 4be:	e8 9c 01 00 00       	call   65f <close>
+ 4c3:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 4c6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4c9:	c9                   	leave
+ 4ca:	c3                   	ret
+
+000004cb <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4cb:	55                   	push   %ebp
+ 4cc:	89 e5                	mov    %esp,%ebp
+ 4ce:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 4d1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4d8:	eb 25                	jmp    4ff <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 4da:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 4dd:	89 d0                	mov    %edx,%eax
+ 4df:	c1 e0 02             	shl    $0x2,%eax
+ 4e2:	01 d0                	add    %edx,%eax
+ 4e4:	01 c0                	add    %eax,%eax
+ 4e6:	89 c1                	mov    %eax,%ecx
+ 4e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4eb:	8d 50 01             	lea    0x1(%eax),%edx
+ 4ee:	89 55 08             	mov    %edx,0x8(%ebp)
+ 4f1:	0f b6 00             	movzbl (%eax),%eax
+ 4f4:	0f be c0             	movsbl %al,%eax
+ 4f7:	01 c8                	add    %ecx,%eax
+ 4f9:	83 e8 30             	sub    $0x30,%eax
+ 4fc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 502:	0f b6 00             	movzbl (%eax),%eax
+ 505:	3c 2f                	cmp    $0x2f,%al
+ 507:	7e 0a                	jle    513 <atoi+0x48>
+ 509:	8b 45 08             	mov    0x8(%ebp),%eax
+ 50c:	0f b6 00             	movzbl (%eax),%eax
+ 50f:	3c 39                	cmp    $0x39,%al
+ 511:	7e c7                	jle    4da <atoi+0xf>
+  return n;
+ 513:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 516:	c9                   	leave
+ 517:	c3                   	ret
+
+00000518 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 518:	55                   	push   %ebp
+ 519:	89 e5                	mov    %esp,%ebp
+ 51b:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 51e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 521:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 524:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 527:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 52a:	eb 17                	jmp    543 <memmove+0x2b>
+    *dst++ = *src++;
+ 52c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 52f:	8d 42 01             	lea    0x1(%edx),%eax
+ 532:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 535:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 538:	8d 48 01             	lea    0x1(%eax),%ecx
+ 53b:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 53e:	0f b6 12             	movzbl (%edx),%edx
+ 541:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 543:	8b 45 10             	mov    0x10(%ebp),%eax
+ 546:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 549:	89 55 10             	mov    %edx,0x10(%ebp)
+ 54c:	85 c0                	test   %eax,%eax
+ 54e:	7f dc                	jg     52c <memmove+0x14>
+  return vdst;
+ 550:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 553:	c9                   	leave
+ 554:	c3                   	ret
+
+00000555 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 555:	55                   	push   %ebp
+ 556:	89 e5                	mov    %esp,%ebp
+ 558:	57                   	push   %edi
+ 559:	56                   	push   %esi
+ 55a:	83 ec 30             	sub    $0x30,%esp
+ 55d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 560:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 563:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 566:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 569:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 570:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 577:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 57a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 57d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 580:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 583:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 58a:	e9 89 00 00 00       	jmp    618 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 58f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 592:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 595:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 599:	01 c0                	add    %eax,%eax
+ 59b:	89 c6                	mov    %eax,%esi
+ 59d:	89 d7                	mov    %edx,%edi
+ 59f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 5a2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5a5:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5a8:	0f ad d0             	shrd   %cl,%edx,%eax
+ 5ab:	d3 ea                	shr    %cl,%edx
+ 5ad:	f6 c1 20             	test   $0x20,%cl
+ 5b0:	74 04                	je     5b6 <udiv64+0x61>
+ 5b2:	89 d0                	mov    %edx,%eax
+ 5b4:	31 d2                	xor    %edx,%edx
+ 5b6:	83 e0 01             	and    $0x1,%eax
+ 5b9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 5bc:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 5c3:	89 f0                	mov    %esi,%eax
+ 5c5:	89 fa                	mov    %edi,%edx
+ 5c7:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 5ca:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 5cd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 5d0:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 5d3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5d6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5db:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 5de:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 5e1:	19 d1                	sbb    %edx,%ecx
+ 5e3:	72 2f                	jb     614 <udiv64+0xbf>
+      r -= d;
+ 5e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5e8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5ed:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 5f0:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 5f3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 5f6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5fb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 600:	0f a5 c2             	shld   %cl,%eax,%edx
+ 603:	d3 e0                	shl    %cl,%eax
+ 605:	f6 c1 20             	test   $0x20,%cl
+ 608:	74 04                	je     60e <udiv64+0xb9>
+ 60a:	89 c2                	mov    %eax,%edx
+ 60c:	31 c0                	xor    %eax,%eax
+ 60e:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 611:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 614:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 618:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 61c:	0f 89 6d ff ff ff    	jns    58f <udiv64+0x3a>
+    }
+  }
+  return q;
+ 622:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 625:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 628:	83 c4 30             	add    $0x30,%esp
+ 62b:	5e                   	pop    %esi
+ 62c:	5f                   	pop    %edi
+ 62d:	5d                   	pop    %ebp
+ 62e:	c3                   	ret
+
+0000062f <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 62f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 634:	cd 40                	int    $0x40
+ 636:	c3                   	ret
+
+00000637 <exit>:
+SYSCALL(exit)
+ 637:	b8 02 00 00 00       	mov    $0x2,%eax
+ 63c:	cd 40                	int    $0x40
+ 63e:	c3                   	ret
+
+0000063f <wait>:
+SYSCALL(wait)
+ 63f:	b8 03 00 00 00       	mov    $0x3,%eax
+ 644:	cd 40                	int    $0x40
+ 646:	c3                   	ret
+
+00000647 <pipe>:
+SYSCALL(pipe)
+ 647:	b8 04 00 00 00       	mov    $0x4,%eax
+ 64c:	cd 40                	int    $0x40
+ 64e:	c3                   	ret
+
+0000064f <read>:
+SYSCALL(read)
+ 64f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 654:	cd 40                	int    $0x40
+ 656:	c3                   	ret
+
+00000657 <write>:
+SYSCALL(write)
+ 657:	b8 10 00 00 00       	mov    $0x10,%eax
+ 65c:	cd 40                	int    $0x40
+ 65e:	c3                   	ret
+
+0000065f <close>:
+SYSCALL(close)
+ 65f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <kill>:
+SYSCALL(kill)
+ 667:	b8 06 00 00 00       	mov    $0x6,%eax
+ 66c:	cd 40                	int    $0x40
+ 66e:	c3                   	ret
+
+0000066f <exec>:
+SYSCALL(exec)
+ 66f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 674:	cd 40                	int    $0x40
+ 676:	c3                   	ret
+
+00000677 <open>:
+SYSCALL(open)
+ 677:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 67c:	cd 40                	int    $0x40
+ 67e:	c3                   	ret
+
+0000067f <mknod>:
+SYSCALL(mknod)
+ 67f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <unlink>:
+SYSCALL(unlink)
+ 687:	b8 12 00 00 00       	mov    $0x12,%eax
+ 68c:	cd 40                	int    $0x40
+ 68e:	c3                   	ret
+
+0000068f <fstat>:
+SYSCALL(fstat)
+ 68f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <link>:
+SYSCALL(link)
+ 697:	b8 13 00 00 00       	mov    $0x13,%eax
+ 69c:	cd 40                	int    $0x40
+ 69e:	c3                   	ret
+
+0000069f <mkdir>:
+SYSCALL(mkdir)
+ 69f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6a4:	cd 40                	int    $0x40
+ 6a6:	c3                   	ret
+
+000006a7 <chdir>:
+SYSCALL(chdir)
+ 6a7:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6ac:	cd 40                	int    $0x40
+ 6ae:	c3                   	ret
+
+000006af <dup>:
+SYSCALL(dup)
+ 6af:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6b4:	cd 40                	int    $0x40
+ 6b6:	c3                   	ret
+
+000006b7 <getpid>:
+SYSCALL(getpid)
+ 6b7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6bc:	cd 40                	int    $0x40
+ 6be:	c3                   	ret
+
+000006bf <sbrk>:
+SYSCALL(sbrk)
+ 6bf:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6c4:	cd 40                	int    $0x40
+ 6c6:	c3                   	ret
+
+000006c7 <sleep>:
+SYSCALL(sleep)
+ 6c7:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6cc:	cd 40                	int    $0x40
+ 6ce:	c3                   	ret
+
+000006cf <uptime>:
+SYSCALL(uptime)
+ 6cf:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6d4:	cd 40                	int    $0x40
+ 6d6:	c3                   	ret
+
+000006d7 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 6d7:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6dc:	cd 40                	int    $0x40
+ 6de:	c3                   	ret
+
+000006df <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 6df:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6e4:	cd 40                	int    $0x40
+ 6e6:	c3                   	ret
+
+000006e7 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 6e7:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6ec:	cd 40                	int    $0x40
+ 6ee:	c3                   	ret
+
+000006ef <copy_file>:
+SYSCALL(copy_file)
+ 6ef:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6f4:	cd 40                	int    $0x40
+ 6f6:	c3                   	ret
+
+000006f7 <change_queue>:
+SYSCALL(change_queue)
+ 6f7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6fc:	cd 40                	int    $0x40
+ 6fe:	c3                   	ret
+
+000006ff <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 6ff:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 704:	cd 40                	int    $0x40
+ 706:	c3                   	ret
+
+00000707 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 707:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 70c:	cd 40                	int    $0x40
+ 70e:	c3                   	ret
+
+0000070f <print_process_info>:
+SYSCALL(print_process_info)
+ 70f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 714:	cd 40                	int    $0x40
+ 716:	c3                   	ret
+
+00000717 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 717:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 71c:	cd 40                	int    $0x40
+ 71e:	c3                   	ret
+
+0000071f <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 71f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 724:	cd 40                	int    $0x40
+ 726:	c3                   	ret
+
+00000727 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 727:	b8 20 00 00 00       	mov    $0x20,%eax
+ 72c:	cd 40                	int    $0x40
+ 72e:	c3                   	ret
+
+0000072f <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 72f:	b8 21 00 00 00       	mov    $0x21,%eax
+ 734:	cd 40                	int    $0x40
+ 736:	c3                   	ret
+
+00000737 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 737:	b8 22 00 00 00       	mov    $0x22,%eax
+ 73c:	cd 40                	int    $0x40
+ 73e:	c3                   	ret
+
+0000073f <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 73f:	b8 23 00 00 00       	mov    $0x23,%eax
+ 744:	cd 40                	int    $0x40
+ 746:	c3                   	ret
+
+00000747 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 747:	b8 24 00 00 00       	mov    $0x24,%eax
+ 74c:	cd 40                	int    $0x40
+ 74e:	c3                   	ret
+
+0000074f <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 74f:	b8 25 00 00 00       	mov    $0x25,%eax
+ 754:	cd 40                	int    $0x40
+ 756:	c3                   	ret
+
+00000757 <set_affinity>:
+SYSCALL(set_affinity)
+ 757:	b8 26 00 00 00       	mov    $0x26,%eax
+ 75c:	cd 40                	int    $0x40
+ 75e:	c3                   	ret
+
+0000075f <setsched>:
+SYSCALL(setsched)
+ 75f:	b8 27 00 00 00       	mov    $0x27,%eax
+ 764:	cd 40                	int    $0x40
+ 766:	c3                   	ret
+
+00000767 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 767:	b8 28 00 00 00       	mov    $0x28,%eax
+ 76c:	cd 40                	int    $0x40
+ 76e:	c3                   	ret
+
+0000076f <set_quantum>:
+SYSCALL(set_quantum)
+ 76f:	b8 29 00 00 00       	mov    $0x29,%eax
+ 774:	cd 40                	int    $0x40
+ 776:	c3                   	ret
+
+00000777 <schedtrace>:
+SYSCALL(schedtrace)
+ 777:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 77c:	cd 40                	int    $0x40
+ 77e:	c3                   	ret
+
+0000077f <getrusage>:
+SYSCALL(getrusage)
+ 77f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 784:	cd 40                	int    $0x40
+ 786:	c3                   	ret
+
+00000787 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 787:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 78c:	cd 40                	int    $0x40
+ 78e:	c3                   	ret
+
+0000078f <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 78f:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 794:	cd 40                	int    $0x40
+ 796:	c3                   	ret
+
+00000797 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 797:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 79c:	cd 40                	int    $0x40
+ 79e:	c3                   	ret
+
+0000079f <futex_wait>:
+SYSCALL(futex_wait)
+ 79f:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 7a4:	cd 40                	int    $0x40
+ 7a6:	c3                   	ret
+
+000007a7 <futex_wake>:
+SYSCALL(futex_wake)
+ 7a7:	b8 30 00 00 00       	mov    $0x30,%eax
+ 7ac:	cd 40                	int    $0x40
+ 7ae:	c3                   	ret
+
+000007af <syscall_latency>:
+SYSCALL(syscall_latency)
+ 7af:	b8 31 00 00 00       	mov    $0x31,%eax
+ 7b4:	cd 40                	int    $0x40
+ 7b6:	c3                   	ret
+
+000007b7 <submit_batch>:
+SYSCALL(submit_batch)
+ 7b7:	b8 32 00 00 00       	mov    $0x32,%eax
+ 7bc:	cd 40                	int    $0x40
+ 7be:	c3                   	ret
+
+000007bf <kmem_stats>:
+SYSCALL(kmem_stats)
+ 7bf:	b8 33 00 00 00       	mov    $0x33,%eax
+ 7c4:	cd 40                	int    $0x40
+ 7c6:	c3                   	ret
+
+000007c7 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 7c7:	b8 34 00 00 00       	mov    $0x34,%eax
+ 7cc:	cd 40                	int    $0x40
+ 7ce:	c3                   	ret
+
+000007cf <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 7cf:	55                   	push   %ebp
+ 7d0:	89 e5                	mov    %esp,%ebp
+ 7d2:	83 ec 18             	sub    $0x18,%esp
+ 7d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7d8:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 7db:	83 ec 04             	sub    $0x4,%esp
+ 7de:	6a 01                	push   $0x1
+ 7e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 7e3:	50                   	push   %eax
+ 7e4:	ff 75 08             	push   0x8(%ebp)
+ 7e7:	e8 6b fe ff ff       	call   657 <write>
+ 7ec:	83 c4 10             	add    $0x10,%esp
+}
+ 7ef:	90                   	nop
+ 7f0:	c9                   	leave
+ 7f1:	c3                   	ret
+
+000007f2 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7f2:	55                   	push   %ebp
+ 7f3:	89 e5                	mov    %esp,%ebp
+ 7f5:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 7f8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 7ff:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 803:	74 17                	je     81c <printint+0x2a>
+ 805:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 809:	79 11                	jns    81c <printint+0x2a>
+    neg = 1;
+ 80b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 812:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 815:	f7 d8                	neg    %eax
+ 817:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 81a:	eb 06                	jmp    822 <printint+0x30>
+  } else {
+    x = xx;
+ 81c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 81f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 822:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 829:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 82c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 82f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 834:	f7 f1                	div    %ecx
+ 836:	89 d1                	mov    %edx,%ecx
+ 838:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 83b:	8d 50 01             	lea    0x1(%eax),%edx
+ 83e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 841:	0f b6 91 4c 13 00 00 	movzbl 0x134c(%ecx),%edx
+ 848:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 84c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 84f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 852:	ba 00 00 00 00       	mov    $0x0,%edx
+ 857:	f7 f1                	div    %ecx
+ 859:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 85c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 860:	75 c7                	jne    829 <printint+0x37>
+  if(neg)
+ 862:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 866:	74 2d                	je     895 <printint+0xa3>
+    buf[i++] = '-';
+ 868:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 86b:	8d 50 01             	lea    0x1(%eax),%edx
+ 86e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 871:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 876:	eb 1d                	jmp    895 <printint+0xa3>
+    putc(fd, buf[i]);
+ 878:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 87b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 87e:	01 d0                	add    %edx,%eax
+ 880:	0f b6 00             	movzbl (%eax),%eax
+ 883:	0f be c0             	movsbl %al,%eax
+ 886:	83 ec 08             	sub    $0x8,%esp
+ 889:	50                   	push   %eax
+ 88a:	ff 75 08             	push   0x8(%ebp)
+ 88d:	e8 3d ff ff ff       	call   7cf <putc>
+ 892:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 895:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 899:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 89d:	79 d9                	jns    878 <printint+0x86>
+}
+ 89f:	90                   	nop
+ 8a0:	90                   	nop
+ 8a1:	c9                   	leave
+ 8a2:	c3                   	ret
+
+000008a3 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8a3:	55                   	push   %ebp
+ 8a4:	89 e5                	mov    %esp,%ebp
+ 8a6:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 8a9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 8b0:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 8b3:	83 c0 04             	add    $0x4,%eax
+ 8b6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8b9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 8c0:	e9 59 01 00 00       	jmp    a1e <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 8c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8c8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8cb:	01 d0                	add    %edx,%eax
+ 8cd:	0f b6 00             	movzbl (%eax),%eax
+ 8d0:	0f be c0             	movsbl %al,%eax
+ 8d3:	25 ff 00 00 00       	and    $0xff,%eax
+ 8d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 8db:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8df:	75 2c                	jne    90d <printf+0x6a>
+      if(c == '%'){
+ 8e1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8e5:	75 0c                	jne    8f3 <printf+0x50>
+        state = '%';
+ 8e7:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 8ee:	e9 27 01 00 00       	jmp    a1a <printf+0x177>
+      } else {
+        putc(fd, c);
+ 8f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8f6:	0f be c0             	movsbl %al,%eax
+ 8f9:	83 ec 08             	sub    $0x8,%esp
+ 8fc:	50                   	push   %eax
+ 8fd:	ff 75 08             	push   0x8(%ebp)
+ 900:	e8 ca fe ff ff       	call   7cf <putc>
+ 905:	83 c4 10             	add    $0x10,%esp
+ 908:	e9 0d 01 00 00       	jmp    a1a <printf+0x177>
+      }
+    } else if(state == '%'){
+ 90d:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 911:	0f 85 03 01 00 00    	jne    a1a <printf+0x177>
+      if(c == 'd'){
+ 917:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 91b:	75 1e                	jne    93b <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 91d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 920:	8b 00                	mov    (%eax),%eax
+ 922:	6a 01                	push   $0x1
+ 924:	6a 0a                	push   $0xa
+ 926:	50                   	push   %eax
+ 927:	ff 75 08             	push   0x8(%ebp)
+ 92a:	e8 c3 fe ff ff       	call   7f2 <printint>
+ 92f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 932:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 936:	e9 d8 00 00 00       	jmp    a13 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 93b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 93f:	74 06                	je     947 <printf+0xa4>
+ 941:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 945:	75 1e                	jne    965 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 947:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 94a:	8b 00                	mov    (%eax),%eax
+ 94c:	6a 00                	push   $0x0
+ 94e:	6a 10                	push   $0x10
+ 950:	50                   	push   %eax
+ 951:	ff 75 08             	push   0x8(%ebp)
+ 954:	e8 99 fe ff ff       	call   7f2 <printint>
+ 959:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 95c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 960:	e9 ae 00 00 00       	jmp    a13 <printf+0x170>
+      } else if(c == 's'){
+ 965:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 969:	75 43                	jne    9ae <printf+0x10b>
+        s = (char*)*ap;
+ 96b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 96e:	8b 00                	mov    (%eax),%eax
+ 970:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 973:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 977:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 97b:	75 25                	jne    9a2 <printf+0xff>
+          s = "(null)";
+ 97d:	c7 45 f4 17 0f 00 00 	movl   $0xf17,-0xc(%ebp)
+        while(*s != 0){
+ 984:	eb 1c                	jmp    9a2 <printf+0xff>
+          putc(fd, *s);
+ 986:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 989:	0f b6 00             	movzbl (%eax),%eax
+ 98c:	0f be c0             	movsbl %al,%eax
+ 98f:	83 ec 08             	sub    $0x8,%esp
+ 992:	50                   	push   %eax
+ 993:	ff 75 08             	push   0x8(%ebp)
+ 996:	e8 34 fe ff ff       	call   7cf <putc>
+ 99b:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 99e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 9a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a5:	0f b6 00             	movzbl (%eax),%eax
+ 9a8:	84 c0                	test   %al,%al
+ 9aa:	75 da                	jne    986 <printf+0xe3>
+ 9ac:	eb 65                	jmp    a13 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 9ae:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 9b2:	75 1d                	jne    9d1 <printf+0x12e>
+        putc(fd, *ap);
+ 9b4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9b7:	8b 00                	mov    (%eax),%eax
+ 9b9:	0f be c0             	movsbl %al,%eax
+ 9bc:	83 ec 08             	sub    $0x8,%esp
+ 9bf:	50                   	push   %eax
+ 9c0:	ff 75 08             	push   0x8(%ebp)
+ 9c3:	e8 07 fe ff ff       	call   7cf <putc>
+ 9c8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9cb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9cf:	eb 42                	jmp    a13 <printf+0x170>
+      } else if(c == '%'){
+ 9d1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9d5:	75 17                	jne    9ee <printf+0x14b>
+        putc(fd, c);
+ 9d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9da:	0f be c0             	movsbl %al,%eax
+ 9dd:	83 ec 08             	sub    $0x8,%esp
+ 9e0:	50                   	push   %eax
+ 9e1:	ff 75 08             	push   0x8(%ebp)
+ 9e4:	e8 e6 fd ff ff       	call   7cf <putc>
+ 9e9:	83 c4 10             	add    $0x10,%esp
+ 9ec:	eb 25                	jmp    a13 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 9ee:	83 ec 08             	sub    $0x8,%esp
+ 9f1:	6a 25                	push   $0x25
+ 9f3:	ff 75 08             	push   0x8(%ebp)
+ 9f6:	e8 d4 fd ff ff       	call   7cf <putc>
+ 9fb:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 9fe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a01:	0f be c0             	movsbl %al,%eax
+ a04:	83 ec 08             	sub    $0x8,%esp
+ a07:	50                   	push   %eax
+ a08:	ff 75 08             	push   0x8(%ebp)
+ a0b:	e8 bf fd ff ff       	call   7cf <putc>
+ a10:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a13:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a1a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a1e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a21:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a24:	01 d0                	add    %edx,%eax
+ a26:	0f b6 00             	movzbl (%eax),%eax
+ a29:	84 c0                	test   %al,%al
+ a2b:	0f 85 94 fe ff ff    	jne    8c5 <printf+0x22>
+    }
+  }
+}
+ a31:	90                   	nop
+ a32:	90                   	nop
+ a33:	c9                   	leave
+ a34:	c3                   	ret
+
+00000a35 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a35:	55                   	push   %ebp
+ a36:	89 e5                	mov    %esp,%ebp
+ a38:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ a3b:	8b 45 08             	mov    0x8(%ebp),%eax
+ a3e:	83 e8 08             	sub    $0x8,%eax
+ a41:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a44:	a1 68 13 00 00       	mov    0x1368,%eax
+ a49:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a4c:	eb 24                	jmp    a72 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a4e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a51:	8b 00                	mov    (%eax),%eax
+ a53:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a56:	72 12                	jb     a6a <free+0x35>
+ a58:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a5b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a5e:	72 24                	jb     a84 <free+0x4f>
+ a60:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a63:	8b 00                	mov    (%eax),%eax
+ a65:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a68:	72 1a                	jb     a84 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a6a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a6d:	8b 00                	mov    (%eax),%eax
+ a6f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a72:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a75:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a78:	73 d4                	jae    a4e <free+0x19>
+ a7a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a7d:	8b 00                	mov    (%eax),%eax
+ a7f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a82:	73 ca                	jae    a4e <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a84:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a87:	8b 40 04             	mov    0x4(%eax),%eax
+ a8a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a91:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a94:	01 c2                	add    %eax,%edx
+ a96:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a99:	8b 00                	mov    (%eax),%eax
+ a9b:	39 c2                	cmp    %eax,%edx
+ a9d:	75 24                	jne    ac3 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ a9f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aa2:	8b 50 04             	mov    0x4(%eax),%edx
+ aa5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa8:	8b 00                	mov    (%eax),%eax
+ aaa:	8b 40 04             	mov    0x4(%eax),%eax
+ aad:	01 c2                	add    %eax,%edx
+ aaf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ab2:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ab5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab8:	8b 00                	mov    (%eax),%eax
+ aba:	8b 10                	mov    (%eax),%edx
+ abc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ abf:	89 10                	mov    %edx,(%eax)
+ ac1:	eb 0a                	jmp    acd <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ ac3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac6:	8b 10                	mov    (%eax),%edx
+ ac8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ acb:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ acd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ad0:	8b 40 04             	mov    0x4(%eax),%eax
+ ad3:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ada:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ add:	01 d0                	add    %edx,%eax
+ adf:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ ae2:	75 20                	jne    b04 <free+0xcf>
+    p->s.size += bp->s.size;
+ ae4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae7:	8b 50 04             	mov    0x4(%eax),%edx
+ aea:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aed:	8b 40 04             	mov    0x4(%eax),%eax
+ af0:	01 c2                	add    %eax,%edx
+ af2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af5:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ af8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ afb:	8b 10                	mov    (%eax),%edx
+ afd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b00:	89 10                	mov    %edx,(%eax)
+ b02:	eb 08                	jmp    b0c <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ b04:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b07:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ b0a:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b0c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0f:	a3 68 13 00 00       	mov    %eax,0x1368
+}
+ b14:	90                   	nop
+ b15:	c9                   	leave
+ b16:	c3                   	ret
+
+00000b17 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ b17:	55                   	push   %ebp
+ b18:	89 e5                	mov    %esp,%ebp
+ b1a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ b1d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ b24:	77 07                	ja     b2d <morecore+0x16>
+    nu = 4096;
+ b26:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ b2d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b30:	c1 e0 03             	shl    $0x3,%eax
+ b33:	83 ec 0c             	sub    $0xc,%esp
+ b36:	50                   	push   %eax
+ b37:	e8 83 fb ff ff       	call   6bf <sbrk>
+ b3c:	83 c4 10             	add    $0x10,%esp
+ b3f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ b42:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b46:	75 07                	jne    b4f <morecore+0x38>
+    return 0;
+ b48:	b8 00 00 00 00       	mov    $0x0,%eax
+ b4d:	eb 26                	jmp    b75 <morecore+0x5e>
+  hp = (Header*)p;
+ b4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b52:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ b55:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b58:	8b 55 08             	mov    0x8(%ebp),%edx
+ b5b:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ b5e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b61:	83 c0 08             	add    $0x8,%eax
+ b64:	83 ec 0c             	sub    $0xc,%esp
+ b67:	50                   	push   %eax
+ b68:	e8 c8 fe ff ff       	call   a35 <free>
+ b6d:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ b70:	a1 68 13 00 00       	mov    0x1368,%eax
+}
+ b75:	c9                   	leave
+ b76:	c3                   	ret
+
+00000b77 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b77:	55                   	push   %ebp
+ b78:	89 e5                	mov    %esp,%ebp
+ b7a:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b7d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b80:	83 c0 07             	add    $0x7,%eax
+ b83:	c1 e8 03             	shr    $0x3,%eax
+ b86:	83 c0 01             	add    $0x1,%eax
+ b89:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ b8c:	a1 68 13 00 00       	mov    0x1368,%eax
+ b91:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b94:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b98:	75 23                	jne    bbd <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ b9a:	c7 45 f0 60 13 00 00 	movl   $0x1360,-0x10(%ebp)
+ ba1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ba4:	a3 68 13 00 00       	mov    %eax,0x1368
+ ba9:	a1 68 13 00 00       	mov    0x1368,%eax
+ bae:	a3 60 13 00 00       	mov    %eax,0x1360
+    base.s.size = 0;
+ bb3:	c7 05 64 13 00 00 00 	movl   $0x0,0x1364
+ bba:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bbd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bc0:	8b 00                	mov    (%eax),%eax
+ bc2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ bc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bc8:	8b 40 04             	mov    0x4(%eax),%eax
+ bcb:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ bce:	72 4d                	jb     c1d <malloc+0xa6>
+      if(p->s.size == nunits)
+ bd0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bd3:	8b 40 04             	mov    0x4(%eax),%eax
+ bd6:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ bd9:	75 0c                	jne    be7 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ bdb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bde:	8b 10                	mov    (%eax),%edx
+ be0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ be3:	89 10                	mov    %edx,(%eax)
+ be5:	eb 26                	jmp    c0d <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ be7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bea:	8b 40 04             	mov    0x4(%eax),%eax
+ bed:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ bf0:	89 c2                	mov    %eax,%edx
+ bf2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf5:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ bf8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bfb:	8b 40 04             	mov    0x4(%eax),%eax
+ bfe:	c1 e0 03             	shl    $0x3,%eax
+ c01:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ c04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c07:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ c0a:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ c0d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c10:	a3 68 13 00 00       	mov    %eax,0x1368
+      return (void*)(p + 1);
+ c15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c18:	83 c0 08             	add    $0x8,%eax
+ c1b:	eb 3b                	jmp    c58 <malloc+0xe1>
+    }
+    if(p == freep)
+ c1d:	a1 68 13 00 00       	mov    0x1368,%eax
+ c22:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c25:	75 1e                	jne    c45 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ c27:	83 ec 0c             	sub    $0xc,%esp
+ c2a:	ff 75 ec             	push   -0x14(%ebp)
+ c2d:	e8 e5 fe ff ff       	call   b17 <morecore>
+ c32:	83 c4 10             	add    $0x10,%esp
+ c35:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c38:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c3c:	75 07                	jne    c45 <malloc+0xce>
+        return 0;
+ c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+ c43:	eb 13                	jmp    c58 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c48:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c4e:	8b 00                	mov    (%eax),%eax
+ c50:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c53:	e9 6d ff ff ff       	jmp    bc5 <malloc+0x4e>
+  }
+}
+ c58:	c9                   	leave
+ c59:	c3                   	ret
+
+00000c5a <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ c5a:	55                   	push   %ebp
+ c5b:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ c5d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c60:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c66:	90                   	nop
+ c67:	5d                   	pop    %ebp
+ c68:	c3                   	ret
+
+00000c69 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ c69:	55                   	push   %ebp
+ c6a:	89 e5                	mov    %esp,%ebp
+ c6c:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ c6f:	8b 55 08             	mov    0x8(%ebp),%edx
+ c72:	b8 00 00 00 00       	mov    $0x0,%eax
+ c77:	b9 01 00 00 00       	mov    $0x1,%ecx
+ c7c:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c80:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c83:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c87:	74 3b                	je     cc4 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ c89:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ c8d:	74 2d                	je     cbc <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ c8f:	8b 55 08             	mov    0x8(%ebp),%edx
+ c92:	b8 02 00 00 00       	mov    $0x2,%eax
+ c97:	87 02                	xchg   %eax,(%edx)
+ c99:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ c9c:	eb 1e                	jmp    cbc <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ c9e:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca1:	83 ec 08             	sub    $0x8,%esp
+ ca4:	6a 02                	push   $0x2
+ ca6:	50                   	push   %eax
+ ca7:	e8 f3 fa ff ff       	call   79f <futex_wait>
+ cac:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ caf:	8b 55 08             	mov    0x8(%ebp),%edx
+ cb2:	b8 02 00 00 00       	mov    $0x2,%eax
+ cb7:	87 02                	xchg   %eax,(%edx)
+ cb9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ cbc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cc0:	75 dc                	jne    c9e <mutex_lock+0x35>
+ cc2:	eb 01                	jmp    cc5 <mutex_lock+0x5c>
+    return;
+ cc4:	90                   	nop
+  }
+}
+ cc5:	c9                   	leave
+ cc6:	c3                   	ret
+
+00000cc7 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ cc7:	55                   	push   %ebp
+ cc8:	89 e5                	mov    %esp,%ebp
+ cca:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ ccd:	8b 45 08             	mov    0x8(%ebp),%eax
+ cd0:	ba 01 00 00 00       	mov    $0x1,%edx
+ cd5:	f7 da                	neg    %edx
+ cd7:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ cdb:	83 fa 01             	cmp    $0x1,%edx
+ cde:	74 1a                	je     cfa <mutex_unlock+0x33>
+    m->state = 0;
+ ce0:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+ cec:	83 ec 08             	sub    $0x8,%esp
+ cef:	6a 01                	push   $0x1
+ cf1:	50                   	push   %eax
+ cf2:	e8 b0 fa ff ff       	call   7a7 <futex_wake>
+ cf7:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ cfa:	90                   	nop
+ cfb:	c9                   	leave
+ cfc:	c3                   	ret
+
+00000cfd <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ cfd:	55                   	push   %ebp
+ cfe:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ d00:	8b 45 08             	mov    0x8(%ebp),%eax
+ d03:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ d09:	8b 45 08             	mov    0x8(%ebp),%eax
+ d0c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ d13:	90                   	nop
+ d14:	5d                   	pop    %ebp
+ d15:	c3                   	ret
+
+00000d16 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ d16:	55                   	push   %ebp
+ d17:	89 e5                	mov    %esp,%ebp
+ d19:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+ d1f:	83 c0 04             	add    $0x4,%eax
+ d22:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ d26:	8b 45 08             	mov    0x8(%ebp),%eax
+ d29:	83 ec 08             	sub    $0x8,%esp
+ d2c:	ff 75 0c             	push   0xc(%ebp)
+ d2f:	50                   	push   %eax
+ d30:	e8 6a fa ff ff       	call   79f <futex_wait>
+ d35:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ d38:	8b 45 08             	mov    0x8(%ebp),%eax
+ d3b:	83 c0 04             	add    $0x4,%eax
+ d3e:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ d42:	90                   	nop
+ d43:	c9                   	leave
+ d44:	c3                   	ret
+
+00000d45 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ d45:	55                   	push   %ebp
+ d46:	89 e5                	mov    %esp,%ebp
+ d48:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+ d4e:	8b 00                	mov    (%eax),%eax
+ d50:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ d53:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d57:	78 17                	js     d70 <rwlock_rdlock+0x2b>
+ d59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d5c:	83 c0 01             	add    $0x1,%eax
+ d5f:	89 c1                	mov    %eax,%ecx
+ d61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d64:	8b 55 08             	mov    0x8(%ebp),%edx
+ d67:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ d6b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d6e:	74 19                	je     d89 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ d70:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d74:	79 d5                	jns    d4b <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ d76:	83 ec 08             	sub    $0x8,%esp
+ d79:	ff 75 f4             	push   -0xc(%ebp)
+ d7c:	ff 75 08             	push   0x8(%ebp)
+ d7f:	e8 92 ff ff ff       	call   d16 <rwlock_sleep>
+ d84:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ d87:	eb c2                	jmp    d4b <rwlock_rdlock+0x6>
+      return;
+ d89:	90                   	nop
+  }
+}
+ d8a:	c9                   	leave
+ d8b:	c3                   	ret
+
+00000d8c <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ d8c:	55                   	push   %ebp
+ d8d:	89 e5                	mov    %esp,%ebp
+ d8f:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ d92:	eb 11                	jmp    da5 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ d94:	83 ec 08             	sub    $0x8,%esp
+ d97:	ff 75 f4             	push   -0xc(%ebp)
+ d9a:	ff 75 08             	push   0x8(%ebp)
+ d9d:	e8 74 ff ff ff       	call   d16 <rwlock_sleep>
+ da2:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ da5:	8b 55 08             	mov    0x8(%ebp),%edx
+ da8:	b8 00 00 00 00       	mov    $0x0,%eax
+ dad:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ db2:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ db6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ db9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ dbd:	75 d5                	jne    d94 <rwlock_wrlock+0x8>
+}
+ dbf:	90                   	nop
+ dc0:	90                   	nop
+ dc1:	c9                   	leave
+ dc2:	c3                   	ret
+
+00000dc3 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ dc3:	55                   	push   %ebp
+ dc4:	89 e5                	mov    %esp,%ebp
+ dc6:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ dc9:	8b 45 08             	mov    0x8(%ebp),%eax
+ dcc:	8b 00                	mov    (%eax),%eax
+ dce:	85 c0                	test   %eax,%eax
+ dd0:	79 0c                	jns    dde <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ dd2:	8b 45 08             	mov    0x8(%ebp),%eax
+ dd5:	ba 00 00 00 00       	mov    $0x0,%edx
+ dda:	87 10                	xchg   %edx,(%eax)
+ ddc:	eb 18                	jmp    df6 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ dde:	8b 55 08             	mov    0x8(%ebp),%edx
+ de1:	b8 01 00 00 00       	mov    $0x1,%eax
+ de6:	f7 d8                	neg    %eax
+ de8:	89 c1                	mov    %eax,%ecx
+ dea:	89 c8                	mov    %ecx,%eax
+ dec:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ df0:	01 c8                	add    %ecx,%eax
+ df2:	85 c0                	test   %eax,%eax
+ df4:	75 20                	jne    e16 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ df6:	8b 45 08             	mov    0x8(%ebp),%eax
+ df9:	8b 40 04             	mov    0x4(%eax),%eax
+ dfc:	85 c0                	test   %eax,%eax
+ dfe:	74 17                	je     e17 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ e00:	8b 45 08             	mov    0x8(%ebp),%eax
+ e03:	83 ec 08             	sub    $0x8,%esp
+ e06:	68 ff ff ff 7f       	push   $0x7fffffff
+ e0b:	50                   	push   %eax
+ e0c:	e8 96 f9 ff ff       	call   7a7 <futex_wake>
+ e11:	83 c4 10             	add    $0x10,%esp
+ e14:	eb 01                	jmp    e17 <rwlock_unlock+0x54>
+    return;
+ e16:	90                   	nop
+}
+ e17:	c9                   	leave
+ e18:	c3                   	ret
+
+00000e19 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ e19:	55                   	push   %ebp
+ e1a:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ e1c:	8b 45 08             	mov    0x8(%ebp),%eax
+ e1f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ e25:	90                   	nop
+ e26:	5d                   	pop    %ebp
+ e27:	c3                   	ret
+
+00000e28 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ e28:	55                   	push   %ebp
+ e29:	89 e5                	mov    %esp,%ebp
+ e2b:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ e2e:	8b 45 08             	mov    0x8(%ebp),%eax
+ e31:	8b 00                	mov    (%eax),%eax
+ e33:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ e36:	83 ec 0c             	sub    $0xc,%esp
+ e39:	ff 75 0c             	push   0xc(%ebp)
+ e3c:	e8 86 fe ff ff       	call   cc7 <mutex_unlock>
+ e41:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ e44:	8b 45 08             	mov    0x8(%ebp),%eax
+ e47:	83 ec 08             	sub    $0x8,%esp
+ e4a:	ff 75 f4             	push   -0xc(%ebp)
+ e4d:	50                   	push   %eax
+ e4e:	e8 4c f9 ff ff       	call   79f <futex_wait>
+ e53:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ e56:	83 ec 0c             	sub    $0xc,%esp
+ e59:	ff 75 0c             	push   0xc(%ebp)
+ e5c:	e8 08 fe ff ff       	call   c69 <mutex_lock>
+ e61:	83 c4 10             	add    $0x10,%esp
+}
+ e64:	90                   	nop
+ e65:	c9                   	leave
+ e66:	c3                   	ret
+
+00000e67 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ e67:	55                   	push   %ebp
+ e68:	89 e5                	mov    %esp,%ebp
+ e6a:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ e6d:	8b 45 08             	mov    0x8(%ebp),%eax
+ e70:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ e74:	8b 45 08             	mov    0x8(%ebp),%eax
+ e77:	83 ec 08             	sub    $0x8,%esp
+ e7a:	6a 01                	push   $0x1
+ e7c:	50                   	push   %eax
+ e7d:	e8 25 f9 ff ff       	call   7a7 <futex_wake>
+ e82:	83 c4 10             	add    $0x10,%esp
+}
+ e85:	90                   	nop
+ e86:	c9                   	leave
+ e87:	c3                   	ret
+
+00000e88 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ e88:	55                   	push   %ebp
+ e89:	89 e5                	mov    %esp,%ebp
+ e8b:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ e8e:	8b 45 08             	mov    0x8(%ebp),%eax
+ e91:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ e95:	8b 45 08             	mov    0x8(%ebp),%eax
+ e98:	83 ec 08             	sub    $0x8,%esp
+ e9b:	68 ff ff ff 7f       	push   $0x7fffffff
+ ea0:	50                   	push   %eax
+ ea1:	e8 01 f9 ff ff       	call   7a7 <futex_wake>
+ ea6:	83 c4 10             	add    $0x10,%esp
+}
+ ea9:	90                   	nop
+ eaa:	c9                   	leave
+ eab:	c3                   	ret
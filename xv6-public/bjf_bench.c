@@ -0,0 +1,92 @@
+#include "types.h"
+#include "x86.h"
+#include "user.h"
+
+#define NCHILD 60
+#define ROUNDS 200
+#define BJF_QUEUE 3
+
+// Every child moves itself to the BJF queue and blocks on a pipe
+// before anything is timed. The parent then releases them all at
+// once, so the scheduler has up to NCHILD runnable BJF processes to
+// choose among, and each child reports how long after the release
+// it first ran, in units of 2^10 TSC cycles since ticks are far too
+// coarse for it. The children then burn CPU, and the parent prints
+// the latencies and the total time for the whole batch. Forking is
+// done before the release, outside every timed interval.
+
+void child_work(int go, int fd)
+{
+  volatile int x = 0;
+  uint64 start, cycles;
+  uint waited;
+
+  change_queue(getpid(), BJF_QUEUE);
+  if (read(go, &start, sizeof(start)) != sizeof(start))
+    exit();
+  cycles = rdtsc() - start;
+  waited = cycles >> 10 > 0xffffffff ? 0xffffffff : cycles >> 10;
+  for (int i = 0; i < ROUNDS; i++)
+    for (int j = 0; j < 100000; j++)
+      x++;
+  write(fd, &waited, sizeof(waited));
+  exit();
+}
+
+int main()
+{
+  int fds[2], gofds[2], ticks, forked;
+  uint64 starts[NCHILD], start, total = 0;
+  uint waited, max = 0;
+
+  if (pipe(fds) < 0 || pipe(gofds) < 0)
+  {
+    printf(1, "Pipe failed.\n");
+    exit();
+  }
+
+  for (forked = 0; forked < NCHILD; forked++)
+  {
+    int pid = fork();
+    if (pid < 0)
+      break;
+    if (pid == 0)
+    {
+      close(fds[0]);
+      close(gofds[1]);
+      child_work(gofds[0], fds[1]);
+    }
+  }
+  close(fds[1]);
+  close(gofds[0]);
+
+  // Let every child reach its read() before the release.
+  sleep(10);
+
+  // Each child reads one copy of the start time. NCHILD of them
+  // fit in the pipe, so the release is a single write.
+  ticks = uptime();
+  start = rdtsc();
+  for (int i = 0; i < forked; i++)
+    starts[i] = start;
+  write(gofds[1], starts, forked * sizeof(starts[0]));
+  close(gofds[1]);
+
+  for (int i = 0; i < forked; i++)
+  {
+    if (read(fds[0], &waited, sizeof(waited)) != sizeof(waited))
+      break;
+    total += waited;
+    if (waited > max)
+      max = waited;
+  }
+  while (wait() != -1)
+    ;
+
+  printf(1, "%d BJF processes finished in %d ticks\n", forked, uptime() - ticks);
+  if (forked > 0)
+    printf(1, "first run latency: avg %d Kcycles, max %d Kcycles\n",
+           (int)udiv64(total, forked), max);
+  close(fds[0]);
+  exit();
+}
@@ -0,0 +1,1841 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+   6:	eb 31                	jmp    39 <cat+0x39>
+    if (write(1, buf, n) != n) {
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	ff 75 f4             	push   -0xc(%ebp)
+   e:	68 40 11 00 00       	push   $0x1140
+  13:	6a 01                	push   $0x1
+  15:	e8 62 04 00 00       	call   47c <write>
+  1a:	83 c4 10             	add    $0x10,%esp
+  1d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+  20:	74 17                	je     39 <cat+0x39>
+      printf(1, "cat: write error\n");
+  22:	83 ec 08             	sub    $0x8,%esp
+  25:	68 d1 0c 00 00       	push   $0xcd1
+  2a:	6a 01                	push   $0x1
+  2c:	e8 97 06 00 00       	call   6c8 <printf>
+  31:	83 c4 10             	add    $0x10,%esp
+      exit();
+  34:	e8 23 04 00 00       	call   45c <exit>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  39:	83 ec 04             	sub    $0x4,%esp
+  3c:	68 00 02 00 00       	push   $0x200
+  41:	68 40 11 00 00       	push   $0x1140
+  46:	ff 75 08             	push   0x8(%ebp)
+  49:	e8 26 04 00 00       	call   474 <read>
+  4e:	83 c4 10             	add    $0x10,%esp
+  51:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  54:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  58:	7f ae                	jg     8 <cat+0x8>
+    }
+  }
+  if(n < 0){
+  5a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  5e:	79 17                	jns    77 <cat+0x77>
+    printf(1, "cat: read error\n");
+  60:	83 ec 08             	sub    $0x8,%esp
+  63:	68 e3 0c 00 00       	push   $0xce3
+  68:	6a 01                	push   $0x1
+  6a:	e8 59 06 00 00       	call   6c8 <printf>
+  6f:	83 c4 10             	add    $0x10,%esp
+    exit();
+  72:	e8 e5 03 00 00       	call   45c <exit>
+  }
+}
+  77:	90                   	nop
+  78:	c9                   	leave
+  79:	c3                   	ret
+
+0000007a <main>:
+
+int
+main(int argc, char *argv[])
+{
+  7a:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  7e:	83 e4 f0             	and    $0xfffffff0,%esp
+  81:	ff 71 fc             	push   -0x4(%ecx)
+  84:	55                   	push   %ebp
+  85:	89 e5                	mov    %esp,%ebp
+  87:	53                   	push   %ebx
+  88:	51                   	push   %ecx
+  89:	83 ec 10             	sub    $0x10,%esp
+  8c:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  8e:	83 3b 01             	cmpl   $0x1,(%ebx)
+  91:	7f 12                	jg     a5 <main+0x2b>
+    cat(0);
+  93:	83 ec 0c             	sub    $0xc,%esp
+  96:	6a 00                	push   $0x0
+  98:	e8 63 ff ff ff       	call   0 <cat>
+  9d:	83 c4 10             	add    $0x10,%esp
+    exit();
+  a0:	e8 b7 03 00 00       	call   45c <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  a5:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  ac:	eb 71                	jmp    11f <main+0xa5>
+    if((fd = open(argv[i], 0)) < 0){
+  ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  b1:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  b8:	8b 43 04             	mov    0x4(%ebx),%eax
+  bb:	01 d0                	add    %edx,%eax
+  bd:	8b 00                	mov    (%eax),%eax
+  bf:	83 ec 08             	sub    $0x8,%esp
+  c2:	6a 00                	push   $0x0
+  c4:	50                   	push   %eax
+  c5:	e8 d2 03 00 00       	call   49c <open>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  d0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  d4:	79 29                	jns    ff <main+0x85>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  d9:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  e0:	8b 43 04             	mov    0x4(%ebx),%eax
+  e3:	01 d0                	add    %edx,%eax
+  e5:	8b 00                	mov    (%eax),%eax
+  e7:	83 ec 04             	sub    $0x4,%esp
+  ea:	50                   	push   %eax
+  eb:	68 f4 0c 00 00       	push   $0xcf4
+  f0:	6a 01                	push   $0x1
+  f2:	e8 d1 05 00 00       	call   6c8 <printf>
+  f7:	83 c4 10             	add    $0x10,%esp
+      exit();
+  fa:	e8 5d 03 00 00       	call   45c <exit>
+    }
+    cat(fd);
+  ff:	83 ec 0c             	sub    $0xc,%esp
+ 102:	ff 75 f0             	push   -0x10(%ebp)
+ 105:	e8 f6 fe ff ff       	call   0 <cat>
+ 10a:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 10d:	83 ec 0c             	sub    $0xc,%esp
+ 110:	ff 75 f0             	push   -0x10(%ebp)
+ 113:	e8 6c 03 00 00       	call   484 <close>
+ 118:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+ 11b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 11f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 122:	3b 03                	cmp    (%ebx),%eax
+ 124:	7c 88                	jl     ae <main+0x34>
+  }
+  exit();
+ 126:	e8 31 03 00 00       	call   45c <exit>
+
+0000012b <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 12b:	55                   	push   %ebp
+ 12c:	89 e5                	mov    %esp,%ebp
+ 12e:	57                   	push   %edi
+ 12f:	53                   	push   %ebx
+{
+ 130:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 133:	8b 55 10             	mov    0x10(%ebp),%edx
+ 136:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 139:	89 cb                	mov    %ecx,%ebx
+ 13b:	89 df                	mov    %ebx,%edi
+ 13d:	89 d1                	mov    %edx,%ecx
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+ 142:	89 ca                	mov    %ecx,%edx
+ 144:	89 fb                	mov    %edi,%ebx
+ 146:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 149:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 14c:	90                   	nop
+ 14d:	5b                   	pop    %ebx
+ 14e:	5f                   	pop    %edi
+ 14f:	5d                   	pop    %ebp
+ 150:	c3                   	ret
+
+00000151 <strcpy>:
+{
+ 151:	55                   	push   %ebp
+ 152:	89 e5                	mov    %esp,%ebp
+ 154:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 157:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 15d:	90                   	nop
+ 15e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 161:	8d 42 01             	lea    0x1(%edx),%eax
+ 164:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 167:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 16d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 170:	0f b6 12             	movzbl (%edx),%edx
+ 173:	88 10                	mov    %dl,(%eax)
+ 175:	0f b6 00             	movzbl (%eax),%eax
+ 178:	84 c0                	test   %al,%al
+ 17a:	75 e2                	jne    15e <strcpy+0xd>
+  return os;
+ 17c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 17f:	c9                   	leave
+ 180:	c3                   	ret
+
+00000181 <strcmp>:
+{
+ 181:	55                   	push   %ebp
+ 182:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 184:	eb 08                	jmp    18e <strcmp+0xd>
+    p++, q++;
+ 186:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 18a:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 18e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 191:	0f b6 00             	movzbl (%eax),%eax
+ 194:	84 c0                	test   %al,%al
+ 196:	74 10                	je     1a8 <strcmp+0x27>
+ 198:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19b:	0f b6 10             	movzbl (%eax),%edx
+ 19e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a1:	0f b6 00             	movzbl (%eax),%eax
+ 1a4:	38 c2                	cmp    %al,%dl
+ 1a6:	74 de                	je     186 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ab:	0f b6 00             	movzbl (%eax),%eax
+ 1ae:	0f b6 d0             	movzbl %al,%edx
+ 1b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1b4:	0f b6 00             	movzbl (%eax),%eax
+ 1b7:	0f b6 c0             	movzbl %al,%eax
+ 1ba:	29 c2                	sub    %eax,%edx
+ 1bc:	89 d0                	mov    %edx,%eax
+}
+ 1be:	5d                   	pop    %ebp
+ 1bf:	c3                   	ret
+
+000001c0 <strlen>:
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1c6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1cd:	eb 04                	jmp    1d3 <strlen+0x13>
+ 1cf:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1d3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d9:	01 d0                	add    %edx,%eax
+ 1db:	0f b6 00             	movzbl (%eax),%eax
+ 1de:	84 c0                	test   %al,%al
+ 1e0:	75 ed                	jne    1cf <strlen+0xf>
+  return n;
+ 1e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1e5:	c9                   	leave
+ 1e6:	c3                   	ret
+
+000001e7 <memset>:
+{
+ 1e7:	55                   	push   %ebp
+ 1e8:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1ea:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1ed:	50                   	push   %eax
+ 1ee:	ff 75 0c             	push   0xc(%ebp)
+ 1f1:	ff 75 08             	push   0x8(%ebp)
+ 1f4:	e8 32 ff ff ff       	call   12b <stosb>
+ 1f9:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1fc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1ff:	c9                   	leave
+ 200:	c3                   	ret
+
+00000201 <strchr>:
+{
+ 201:	55                   	push   %ebp
+ 202:	89 e5                	mov    %esp,%ebp
+ 204:	83 ec 04             	sub    $0x4,%esp
+ 207:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 20a:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 20d:	eb 14                	jmp    223 <strchr+0x22>
+    if(*s == c)
+ 20f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 212:	0f b6 00             	movzbl (%eax),%eax
+ 215:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 218:	75 05                	jne    21f <strchr+0x1e>
+      return (char*)s;
+ 21a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21d:	eb 13                	jmp    232 <strchr+0x31>
+  for(; *s; s++)
+ 21f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	0f b6 00             	movzbl (%eax),%eax
+ 229:	84 c0                	test   %al,%al
+ 22b:	75 e2                	jne    20f <strchr+0xe>
+  return 0;
+ 22d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 232:	c9                   	leave
+ 233:	c3                   	ret
+
+00000234 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 234:	55                   	push   %ebp
+ 235:	89 e5                	mov    %esp,%ebp
+ 237:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 23a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 241:	eb 42                	jmp    285 <gets+0x51>
+    cc = read(0, &c, 1);
+ 243:	83 ec 04             	sub    $0x4,%esp
+ 246:	6a 01                	push   $0x1
+ 248:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 24b:	50                   	push   %eax
+ 24c:	6a 00                	push   $0x0
+ 24e:	e8 21 02 00 00       	call   474 <read>
+ 253:	83 c4 10             	add    $0x10,%esp
+ 256:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 259:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 25d:	7e 33                	jle    292 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 25f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 262:	8d 50 01             	lea    0x1(%eax),%edx
+ 265:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 268:	89 c2                	mov    %eax,%edx
+ 26a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26d:	01 c2                	add    %eax,%edx
+ 26f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 273:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 275:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 279:	3c 0a                	cmp    $0xa,%al
+ 27b:	74 16                	je     293 <gets+0x5f>
+ 27d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 281:	3c 0d                	cmp    $0xd,%al
+ 283:	74 0e                	je     293 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 285:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 288:	83 c0 01             	add    $0x1,%eax
+ 28b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 28e:	7f b3                	jg     243 <gets+0xf>
+ 290:	eb 01                	jmp    293 <gets+0x5f>
+      break;
+ 292:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 293:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 296:	8b 45 08             	mov    0x8(%ebp),%eax
+ 299:	01 d0                	add    %edx,%eax
+ 29b:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 29e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2a1:	c9                   	leave
+ 2a2:	c3                   	ret
+
+000002a3 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a3:	55                   	push   %ebp
+ 2a4:	89 e5                	mov    %esp,%ebp
+ 2a6:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	6a 00                	push   $0x0
+ 2ae:	ff 75 08             	push   0x8(%ebp)
+ 2b1:	e8 e6 01 00 00       	call   49c <open>
+ 2b6:	83 c4 10             	add    $0x10,%esp
+ 2b9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2c0:	79 07                	jns    2c9 <stat+0x26>
+    return -1;
+ 2c2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2c7:	eb 25                	jmp    2ee <stat+0x4b>
+  r = fstat(fd, st);
+ 2c9:	83 ec 08             	sub    $0x8,%esp
+ 2cc:	ff 75 0c             	push   0xc(%ebp)
+ 2cf:	ff 75 f4             	push   -0xc(%ebp)
+ 2d2:	e8 dd 01 00 00       	call   4b4 <fstat>
+ 2d7:	83 c4 10             	add    $0x10,%esp
+ 2da:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2dd:	83 ec 0c             	sub    $0xc,%esp
+ 2e0:	ff 75 f4             	push   -0xc(%ebp)
+ 2e3:	e8 9c 01 00 00       	call   484 <close>
+ 2e8:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2ee:	c9                   	leave
+ 2ef:	c3                   	ret
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2fd:	eb 25                	jmp    324 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2ff:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 302:	89 d0                	mov    %edx,%eax
+ 304:	c1 e0 02             	shl    $0x2,%eax
+ 307:	01 d0                	add    %edx,%eax
+ 309:	01 c0                	add    %eax,%eax
+ 30b:	89 c1                	mov    %eax,%ecx
+ 30d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 310:	8d 50 01             	lea    0x1(%eax),%edx
+ 313:	89 55 08             	mov    %edx,0x8(%ebp)
+ 316:	0f b6 00             	movzbl (%eax),%eax
+ 319:	0f be c0             	movsbl %al,%eax
+ 31c:	01 c8                	add    %ecx,%eax
+ 31e:	83 e8 30             	sub    $0x30,%eax
+ 321:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 324:	8b 45 08             	mov    0x8(%ebp),%eax
+ 327:	0f b6 00             	movzbl (%eax),%eax
+ 32a:	3c 2f                	cmp    $0x2f,%al
+ 32c:	7e 0a                	jle    338 <atoi+0x48>
+ 32e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 331:	0f b6 00             	movzbl (%eax),%eax
+ 334:	3c 39                	cmp    $0x39,%al
+ 336:	7e c7                	jle    2ff <atoi+0xf>
+  return n;
+ 338:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 33b:	c9                   	leave
+ 33c:	c3                   	ret
+
+0000033d <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 33d:	55                   	push   %ebp
+ 33e:	89 e5                	mov    %esp,%ebp
+ 340:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 349:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 34c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 34f:	eb 17                	jmp    368 <memmove+0x2b>
+    *dst++ = *src++;
+ 351:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 354:	8d 42 01             	lea    0x1(%edx),%eax
+ 357:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 35a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 35d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 360:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 363:	0f b6 12             	movzbl (%edx),%edx
+ 366:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 368:	8b 45 10             	mov    0x10(%ebp),%eax
+ 36b:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 36e:	89 55 10             	mov    %edx,0x10(%ebp)
+ 371:	85 c0                	test   %eax,%eax
+ 373:	7f dc                	jg     351 <memmove+0x14>
+  return vdst;
+ 375:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 378:	c9                   	leave
+ 379:	c3                   	ret
+
+0000037a <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 37a:	55                   	push   %ebp
+ 37b:	89 e5                	mov    %esp,%ebp
+ 37d:	57                   	push   %edi
+ 37e:	56                   	push   %esi
+ 37f:	83 ec 30             	sub    $0x30,%esp
+ 382:	8b 45 08             	mov    0x8(%ebp),%eax
+ 385:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 388:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 38b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 38e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 395:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 39c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 39f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3a2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 3a5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3a8:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 3af:	e9 89 00 00 00       	jmp    43d <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 3b4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3b7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3ba:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 3be:	01 c0                	add    %eax,%eax
+ 3c0:	89 c6                	mov    %eax,%esi
+ 3c2:	89 d7                	mov    %edx,%edi
+ 3c4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3c7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 3ca:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 3cd:	0f ad d0             	shrd   %cl,%edx,%eax
+ 3d0:	d3 ea                	shr    %cl,%edx
+ 3d2:	f6 c1 20             	test   $0x20,%cl
+ 3d5:	74 04                	je     3db <udiv64+0x61>
+ 3d7:	89 d0                	mov    %edx,%eax
+ 3d9:	31 d2                	xor    %edx,%edx
+ 3db:	83 e0 01             	and    $0x1,%eax
+ 3de:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 3e1:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 3e8:	89 f0                	mov    %esi,%eax
+ 3ea:	89 fa                	mov    %edi,%edx
+ 3ec:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 3ef:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 3f2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 3f5:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 3f8:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3fb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 400:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 403:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 406:	19 d1                	sbb    %edx,%ecx
+ 408:	72 2f                	jb     439 <udiv64+0xbf>
+      r -= d;
+ 40a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 40d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 412:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 415:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 418:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 41b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 420:	ba 00 00 00 00       	mov    $0x0,%edx
+ 425:	0f a5 c2             	shld   %cl,%eax,%edx
+ 428:	d3 e0                	shl    %cl,%eax
+ 42a:	f6 c1 20             	test   $0x20,%cl
+ 42d:	74 04                	je     433 <udiv64+0xb9>
+ 42f:	89 c2                	mov    %eax,%edx
+ 431:	31 c0                	xor    %eax,%eax
+ 433:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 436:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 439:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 43d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 441:	0f 89 6d ff ff ff    	jns    3b4 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 447:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 44a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 44d:	83 c4 30             	add    $0x30,%esp
+ 450:	5e                   	pop    %esi
+ 451:	5f                   	pop    %edi
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+
+00000454 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 454:	b8 01 00 00 00       	mov    $0x1,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <exit>:
+SYSCALL(exit)
+ 45c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <wait>:
+SYSCALL(wait)
+ 464:	b8 03 00 00 00       	mov    $0x3,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <pipe>:
+SYSCALL(pipe)
+ 46c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <read>:
+SYSCALL(read)
+ 474:	b8 05 00 00 00       	mov    $0x5,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <write>:
+SYSCALL(write)
+ 47c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <close>:
+SYSCALL(close)
+ 484:	b8 15 00 00 00       	mov    $0x15,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <kill>:
+SYSCALL(kill)
+ 48c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <exec>:
+SYSCALL(exec)
+ 494:	b8 07 00 00 00       	mov    $0x7,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <open>:
+SYSCALL(open)
+ 49c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <mknod>:
+SYSCALL(mknod)
+ 4a4:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <unlink>:
+SYSCALL(unlink)
+ 4ac:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <fstat>:
+SYSCALL(fstat)
+ 4b4:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <link>:
+SYSCALL(link)
+ 4bc:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <mkdir>:
+SYSCALL(mkdir)
+ 4c4:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <chdir>:
+SYSCALL(chdir)
+ 4cc:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <dup>:
+SYSCALL(dup)
+ 4d4:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <getpid>:
+SYSCALL(getpid)
+ 4dc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <sbrk>:
+SYSCALL(sbrk)
+ 4e4:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <sleep>:
+SYSCALL(sleep)
+ 4ec:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4f1:	cd 40                	int    $0x40
+ 4f3:	c3                   	ret
+
+000004f4 <uptime>:
+SYSCALL(uptime)
+ 4f4:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4f9:	cd 40                	int    $0x40
+ 4fb:	c3                   	ret
+
+000004fc <find_digital_root>:
+SYSCALL(find_digital_root)
+ 4fc:	b8 16 00 00 00       	mov    $0x16,%eax
+ 501:	cd 40                	int    $0x40
+ 503:	c3                   	ret
+
+00000504 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 504:	b8 17 00 00 00       	mov    $0x17,%eax
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 50c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 511:	cd 40                	int    $0x40
+ 513:	c3                   	ret
+
+00000514 <copy_file>:
+SYSCALL(copy_file)
+ 514:	b8 19 00 00 00       	mov    $0x19,%eax
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <change_queue>:
+SYSCALL(change_queue)
+ 51c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 521:	cd 40                	int    $0x40
+ 523:	c3                   	ret
+
+00000524 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 524:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 52c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 531:	cd 40                	int    $0x40
+ 533:	c3                   	ret
+
+00000534 <print_process_info>:
+SYSCALL(print_process_info)
+ 534:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 539:	cd 40                	int    $0x40
+ 53b:	c3                   	ret
+
+0000053c <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 53c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 544:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 549:	cd 40                	int    $0x40
+ 54b:	c3                   	ret
+
+0000054c <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 54c:	b8 20 00 00 00       	mov    $0x20,%eax
+ 551:	cd 40                	int    $0x40
+ 553:	c3                   	ret
+
+00000554 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 554:	b8 21 00 00 00       	mov    $0x21,%eax
+ 559:	cd 40                	int    $0x40
+ 55b:	c3                   	ret
+
+0000055c <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 55c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 561:	cd 40                	int    $0x40
+ 563:	c3                   	ret
+
+00000564 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 564:	b8 23 00 00 00       	mov    $0x23,%eax
+ 569:	cd 40                	int    $0x40
+ 56b:	c3                   	ret
+
+0000056c <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 56c:	b8 24 00 00 00       	mov    $0x24,%eax
+ 571:	cd 40                	int    $0x40
+ 573:	c3                   	ret
+
+00000574 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 574:	b8 25 00 00 00       	mov    $0x25,%eax
+ 579:	cd 40                	int    $0x40
+ 57b:	c3                   	ret
+
+0000057c <set_affinity>:
+SYSCALL(set_affinity)
+ 57c:	b8 26 00 00 00       	mov    $0x26,%eax
+ 581:	cd 40                	int    $0x40
+ 583:	c3                   	ret
+
+00000584 <setsched>:
+SYSCALL(setsched)
+ 584:	b8 27 00 00 00       	mov    $0x27,%eax
+ 589:	cd 40                	int    $0x40
+ 58b:	c3                   	ret
+
+0000058c <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 58c:	b8 28 00 00 00       	mov    $0x28,%eax
+ 591:	cd 40                	int    $0x40
+ 593:	c3                   	ret
+
+00000594 <set_quantum>:
+SYSCALL(set_quantum)
+ 594:	b8 29 00 00 00       	mov    $0x29,%eax
+ 599:	cd 40                	int    $0x40
+ 59b:	c3                   	ret
+
+0000059c <schedtrace>:
+SYSCALL(schedtrace)
+ 59c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5a1:	cd 40                	int    $0x40
+ 5a3:	c3                   	ret
+
+000005a4 <getrusage>:
+SYSCALL(getrusage)
+ 5a4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5a9:	cd 40                	int    $0x40
+ 5ab:	c3                   	ret
+
+000005ac <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 5ac:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5b1:	cd 40                	int    $0x40
+ 5b3:	c3                   	ret
+
+000005b4 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 5b4:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5b9:	cd 40                	int    $0x40
+ 5bb:	c3                   	ret
+
+000005bc <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 5bc:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5c1:	cd 40                	int    $0x40
+ 5c3:	c3                   	ret
+
+000005c4 <futex_wait>:
+SYSCALL(futex_wait)
+ 5c4:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5c9:	cd 40                	int    $0x40
+ 5cb:	c3                   	ret
+
+000005cc <futex_wake>:
+SYSCALL(futex_wake)
+ 5cc:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5d1:	cd 40                	int    $0x40
+ 5d3:	c3                   	ret
+
+000005d4 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 5d4:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5d9:	cd 40                	int    $0x40
+ 5db:	c3                   	ret
+
+000005dc <submit_batch>:
+SYSCALL(submit_batch)
+ 5dc:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5e1:	cd 40                	int    $0x40
+ 5e3:	c3                   	ret
+
+000005e4 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 5e4:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5e9:	cd 40                	int    $0x40
+ 5eb:	c3                   	ret
+
+000005ec <kmem_junk>:
+SYSCALL(kmem_junk)
+ 5ec:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5f1:	cd 40                	int    $0x40
+ 5f3:	c3                   	ret
+
+000005f4 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5f4:	55                   	push   %ebp
+ 5f5:	89 e5                	mov    %esp,%ebp
+ 5f7:	83 ec 18             	sub    $0x18,%esp
+ 5fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5fd:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	6a 01                	push   $0x1
+ 605:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 608:	50                   	push   %eax
+ 609:	ff 75 08             	push   0x8(%ebp)
+ 60c:	e8 6b fe ff ff       	call   47c <write>
+ 611:	83 c4 10             	add    $0x10,%esp
+}
+ 614:	90                   	nop
+ 615:	c9                   	leave
+ 616:	c3                   	ret
+
+00000617 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 617:	55                   	push   %ebp
+ 618:	89 e5                	mov    %esp,%ebp
+ 61a:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 61d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 624:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 628:	74 17                	je     641 <printint+0x2a>
+ 62a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 62e:	79 11                	jns    641 <printint+0x2a>
+    neg = 1;
+ 630:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 637:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 63a:	f7 d8                	neg    %eax
+ 63c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 63f:	eb 06                	jmp    647 <printint+0x30>
+  } else {
+    x = xx;
+ 641:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 644:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 647:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 64e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 651:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 654:	ba 00 00 00 00       	mov    $0x0,%edx
+ 659:	f7 f1                	div    %ecx
+ 65b:	89 d1                	mov    %edx,%ecx
+ 65d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 660:	8d 50 01             	lea    0x1(%eax),%edx
+ 663:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 666:	0f b6 91 20 11 00 00 	movzbl 0x1120(%ecx),%edx
+ 66d:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 671:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 674:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 677:	ba 00 00 00 00       	mov    $0x0,%edx
+ 67c:	f7 f1                	div    %ecx
+ 67e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 681:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 685:	75 c7                	jne    64e <printint+0x37>
+  if(neg)
+ 687:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 68b:	74 2d                	je     6ba <printint+0xa3>
+    buf[i++] = '-';
+ 68d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 690:	8d 50 01             	lea    0x1(%eax),%edx
+ 693:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 696:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 69b:	eb 1d                	jmp    6ba <printint+0xa3>
+    putc(fd, buf[i]);
+ 69d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6a3:	01 d0                	add    %edx,%eax
+ 6a5:	0f b6 00             	movzbl (%eax),%eax
+ 6a8:	0f be c0             	movsbl %al,%eax
+ 6ab:	83 ec 08             	sub    $0x8,%esp
+ 6ae:	50                   	push   %eax
+ 6af:	ff 75 08             	push   0x8(%ebp)
+ 6b2:	e8 3d ff ff ff       	call   5f4 <putc>
+ 6b7:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 6ba:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 6be:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6c2:	79 d9                	jns    69d <printint+0x86>
+}
+ 6c4:	90                   	nop
+ 6c5:	90                   	nop
+ 6c6:	c9                   	leave
+ 6c7:	c3                   	ret
+
+000006c8 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6c8:	55                   	push   %ebp
+ 6c9:	89 e5                	mov    %esp,%ebp
+ 6cb:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 6ce:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6d5:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6d8:	83 c0 04             	add    $0x4,%eax
+ 6db:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6de:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6e5:	e9 59 01 00 00       	jmp    843 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 6ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6ed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6f0:	01 d0                	add    %edx,%eax
+ 6f2:	0f b6 00             	movzbl (%eax),%eax
+ 6f5:	0f be c0             	movsbl %al,%eax
+ 6f8:	25 ff 00 00 00       	and    $0xff,%eax
+ 6fd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 700:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 704:	75 2c                	jne    732 <printf+0x6a>
+      if(c == '%'){
+ 706:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 70a:	75 0c                	jne    718 <printf+0x50>
+        state = '%';
+ 70c:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 713:	e9 27 01 00 00       	jmp    83f <printf+0x177>
+      } else {
+        putc(fd, c);
+ 718:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 71b:	0f be c0             	movsbl %al,%eax
+ 71e:	83 ec 08             	sub    $0x8,%esp
+ 721:	50                   	push   %eax
+ 722:	ff 75 08             	push   0x8(%ebp)
+ 725:	e8 ca fe ff ff       	call   5f4 <putc>
+ 72a:	83 c4 10             	add    $0x10,%esp
+ 72d:	e9 0d 01 00 00       	jmp    83f <printf+0x177>
+      }
+    } else if(state == '%'){
+ 732:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 736:	0f 85 03 01 00 00    	jne    83f <printf+0x177>
+      if(c == 'd'){
+ 73c:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 740:	75 1e                	jne    760 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 742:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 745:	8b 00                	mov    (%eax),%eax
+ 747:	6a 01                	push   $0x1
+ 749:	6a 0a                	push   $0xa
+ 74b:	50                   	push   %eax
+ 74c:	ff 75 08             	push   0x8(%ebp)
+ 74f:	e8 c3 fe ff ff       	call   617 <printint>
+ 754:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 757:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 75b:	e9 d8 00 00 00       	jmp    838 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 760:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 764:	74 06                	je     76c <printf+0xa4>
+ 766:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 76a:	75 1e                	jne    78a <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 76c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 76f:	8b 00                	mov    (%eax),%eax
+ 771:	6a 00                	push   $0x0
+ 773:	6a 10                	push   $0x10
+ 775:	50                   	push   %eax
+ 776:	ff 75 08             	push   0x8(%ebp)
+ 779:	e8 99 fe ff ff       	call   617 <printint>
+ 77e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 781:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 785:	e9 ae 00 00 00       	jmp    838 <printf+0x170>
+      } else if(c == 's'){
+ 78a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 78e:	75 43                	jne    7d3 <printf+0x10b>
+        s = (char*)*ap;
+ 790:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 793:	8b 00                	mov    (%eax),%eax
+ 795:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 798:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 79c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7a0:	75 25                	jne    7c7 <printf+0xff>
+          s = "(null)";
+ 7a2:	c7 45 f4 09 0d 00 00 	movl   $0xd09,-0xc(%ebp)
+        while(*s != 0){
+ 7a9:	eb 1c                	jmp    7c7 <printf+0xff>
+          putc(fd, *s);
+ 7ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ae:	0f b6 00             	movzbl (%eax),%eax
+ 7b1:	0f be c0             	movsbl %al,%eax
+ 7b4:	83 ec 08             	sub    $0x8,%esp
+ 7b7:	50                   	push   %eax
+ 7b8:	ff 75 08             	push   0x8(%ebp)
+ 7bb:	e8 34 fe ff ff       	call   5f4 <putc>
+ 7c0:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 7c3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 7c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ca:	0f b6 00             	movzbl (%eax),%eax
+ 7cd:	84 c0                	test   %al,%al
+ 7cf:	75 da                	jne    7ab <printf+0xe3>
+ 7d1:	eb 65                	jmp    838 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 7d3:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 7d7:	75 1d                	jne    7f6 <printf+0x12e>
+        putc(fd, *ap);
+ 7d9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7dc:	8b 00                	mov    (%eax),%eax
+ 7de:	0f be c0             	movsbl %al,%eax
+ 7e1:	83 ec 08             	sub    $0x8,%esp
+ 7e4:	50                   	push   %eax
+ 7e5:	ff 75 08             	push   0x8(%ebp)
+ 7e8:	e8 07 fe ff ff       	call   5f4 <putc>
+ 7ed:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7f0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7f4:	eb 42                	jmp    838 <printf+0x170>
+      } else if(c == '%'){
+ 7f6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7fa:	75 17                	jne    813 <printf+0x14b>
+        putc(fd, c);
+ 7fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7ff:	0f be c0             	movsbl %al,%eax
+ 802:	83 ec 08             	sub    $0x8,%esp
+ 805:	50                   	push   %eax
+ 806:	ff 75 08             	push   0x8(%ebp)
+ 809:	e8 e6 fd ff ff       	call   5f4 <putc>
+ 80e:	83 c4 10             	add    $0x10,%esp
+ 811:	eb 25                	jmp    838 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 813:	83 ec 08             	sub    $0x8,%esp
+ 816:	6a 25                	push   $0x25
+ 818:	ff 75 08             	push   0x8(%ebp)
+ 81b:	e8 d4 fd ff ff       	call   5f4 <putc>
+ 820:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 823:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 826:	0f be c0             	movsbl %al,%eax
+ 829:	83 ec 08             	sub    $0x8,%esp
+ 82c:	50                   	push   %eax
+ 82d:	ff 75 08             	push   0x8(%ebp)
+ 830:	e8 bf fd ff ff       	call   5f4 <putc>
+ 835:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 838:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 83f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 843:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 846:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 849:	01 d0                	add    %edx,%eax
+ 84b:	0f b6 00             	movzbl (%eax),%eax
+ 84e:	84 c0                	test   %al,%al
+ 850:	0f 85 94 fe ff ff    	jne    6ea <printf+0x22>
+    }
+  }
+}
+ 856:	90                   	nop
+ 857:	90                   	nop
+ 858:	c9                   	leave
+ 859:	c3                   	ret
+
+0000085a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 85a:	55                   	push   %ebp
+ 85b:	89 e5                	mov    %esp,%ebp
+ 85d:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 860:	8b 45 08             	mov    0x8(%ebp),%eax
+ 863:	83 e8 08             	sub    $0x8,%eax
+ 866:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 869:	a1 48 13 00 00       	mov    0x1348,%eax
+ 86e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 871:	eb 24                	jmp    897 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 873:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 876:	8b 00                	mov    (%eax),%eax
+ 878:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 87b:	72 12                	jb     88f <free+0x35>
+ 87d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 880:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 883:	72 24                	jb     8a9 <free+0x4f>
+ 885:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 888:	8b 00                	mov    (%eax),%eax
+ 88a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 88d:	72 1a                	jb     8a9 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 88f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 892:	8b 00                	mov    (%eax),%eax
+ 894:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 897:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 89a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 89d:	73 d4                	jae    873 <free+0x19>
+ 89f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a2:	8b 00                	mov    (%eax),%eax
+ 8a4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8a7:	73 ca                	jae    873 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8a9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ac:	8b 40 04             	mov    0x4(%eax),%eax
+ 8af:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8b6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8b9:	01 c2                	add    %eax,%edx
+ 8bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8be:	8b 00                	mov    (%eax),%eax
+ 8c0:	39 c2                	cmp    %eax,%edx
+ 8c2:	75 24                	jne    8e8 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 8c4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c7:	8b 50 04             	mov    0x4(%eax),%edx
+ 8ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8cd:	8b 00                	mov    (%eax),%eax
+ 8cf:	8b 40 04             	mov    0x4(%eax),%eax
+ 8d2:	01 c2                	add    %eax,%edx
+ 8d4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d7:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8dd:	8b 00                	mov    (%eax),%eax
+ 8df:	8b 10                	mov    (%eax),%edx
+ 8e1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e4:	89 10                	mov    %edx,(%eax)
+ 8e6:	eb 0a                	jmp    8f2 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 8e8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8eb:	8b 10                	mov    (%eax),%edx
+ 8ed:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8f0:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 8f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f5:	8b 40 04             	mov    0x4(%eax),%eax
+ 8f8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8ff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 902:	01 d0                	add    %edx,%eax
+ 904:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 907:	75 20                	jne    929 <free+0xcf>
+    p->s.size += bp->s.size;
+ 909:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 90c:	8b 50 04             	mov    0x4(%eax),%edx
+ 90f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 912:	8b 40 04             	mov    0x4(%eax),%eax
+ 915:	01 c2                	add    %eax,%edx
+ 917:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 91a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 91d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 920:	8b 10                	mov    (%eax),%edx
+ 922:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 925:	89 10                	mov    %edx,(%eax)
+ 927:	eb 08                	jmp    931 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 929:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 92c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 92f:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 931:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 934:	a3 48 13 00 00       	mov    %eax,0x1348
+}
+ 939:	90                   	nop
+ 93a:	c9                   	leave
+ 93b:	c3                   	ret
+
+0000093c <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 93c:	55                   	push   %ebp
+ 93d:	89 e5                	mov    %esp,%ebp
+ 93f:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 942:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 949:	77 07                	ja     952 <morecore+0x16>
+    nu = 4096;
+ 94b:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 952:	8b 45 08             	mov    0x8(%ebp),%eax
+ 955:	c1 e0 03             	shl    $0x3,%eax
+ 958:	83 ec 0c             	sub    $0xc,%esp
+ 95b:	50                   	push   %eax
+ 95c:	e8 83 fb ff ff       	call   4e4 <sbrk>
+ 961:	83 c4 10             	add    $0x10,%esp
+ 964:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 967:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 96b:	75 07                	jne    974 <morecore+0x38>
+    return 0;
+ 96d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 972:	eb 26                	jmp    99a <morecore+0x5e>
+  hp = (Header*)p;
+ 974:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 977:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 97a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 97d:	8b 55 08             	mov    0x8(%ebp),%edx
+ 980:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 983:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 986:	83 c0 08             	add    $0x8,%eax
+ 989:	83 ec 0c             	sub    $0xc,%esp
+ 98c:	50                   	push   %eax
+ 98d:	e8 c8 fe ff ff       	call   85a <free>
+ 992:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 995:	a1 48 13 00 00       	mov    0x1348,%eax
+}
+ 99a:	c9                   	leave
+ 99b:	c3                   	ret
+
+0000099c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 99c:	55                   	push   %ebp
+ 99d:	89 e5                	mov    %esp,%ebp
+ 99f:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9a5:	83 c0 07             	add    $0x7,%eax
+ 9a8:	c1 e8 03             	shr    $0x3,%eax
+ 9ab:	83 c0 01             	add    $0x1,%eax
+ 9ae:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 9b1:	a1 48 13 00 00       	mov    0x1348,%eax
+ 9b6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9b9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9bd:	75 23                	jne    9e2 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 9bf:	c7 45 f0 40 13 00 00 	movl   $0x1340,-0x10(%ebp)
+ 9c6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9c9:	a3 48 13 00 00       	mov    %eax,0x1348
+ 9ce:	a1 48 13 00 00       	mov    0x1348,%eax
+ 9d3:	a3 40 13 00 00       	mov    %eax,0x1340
+    base.s.size = 0;
+ 9d8:	c7 05 44 13 00 00 00 	movl   $0x0,0x1344
+ 9df:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9e2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9e5:	8b 00                	mov    (%eax),%eax
+ 9e7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ed:	8b 40 04             	mov    0x4(%eax),%eax
+ 9f0:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 9f3:	72 4d                	jb     a42 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 9f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9f8:	8b 40 04             	mov    0x4(%eax),%eax
+ 9fb:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9fe:	75 0c                	jne    a0c <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a03:	8b 10                	mov    (%eax),%edx
+ a05:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a08:	89 10                	mov    %edx,(%eax)
+ a0a:	eb 26                	jmp    a32 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a0f:	8b 40 04             	mov    0x4(%eax),%eax
+ a12:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a15:	89 c2                	mov    %eax,%edx
+ a17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a1a:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a20:	8b 40 04             	mov    0x4(%eax),%eax
+ a23:	c1 e0 03             	shl    $0x3,%eax
+ a26:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a2c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a2f:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a32:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a35:	a3 48 13 00 00       	mov    %eax,0x1348
+      return (void*)(p + 1);
+ a3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a3d:	83 c0 08             	add    $0x8,%eax
+ a40:	eb 3b                	jmp    a7d <malloc+0xe1>
+    }
+    if(p == freep)
+ a42:	a1 48 13 00 00       	mov    0x1348,%eax
+ a47:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a4a:	75 1e                	jne    a6a <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a4c:	83 ec 0c             	sub    $0xc,%esp
+ a4f:	ff 75 ec             	push   -0x14(%ebp)
+ a52:	e8 e5 fe ff ff       	call   93c <morecore>
+ a57:	83 c4 10             	add    $0x10,%esp
+ a5a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a5d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a61:	75 07                	jne    a6a <malloc+0xce>
+        return 0;
+ a63:	b8 00 00 00 00       	mov    $0x0,%eax
+ a68:	eb 13                	jmp    a7d <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a6d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a73:	8b 00                	mov    (%eax),%eax
+ a75:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a78:	e9 6d ff ff ff       	jmp    9ea <malloc+0x4e>
+  }
+}
+ a7d:	c9                   	leave
+ a7e:	c3                   	ret
+
+00000a7f <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ a7f:	55                   	push   %ebp
+ a80:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ a82:	8b 45 08             	mov    0x8(%ebp),%eax
+ a85:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ a8b:	90                   	nop
+ a8c:	5d                   	pop    %ebp
+ a8d:	c3                   	ret
+
+00000a8e <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ a8e:	55                   	push   %ebp
+ a8f:	89 e5                	mov    %esp,%ebp
+ a91:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ a94:	8b 55 08             	mov    0x8(%ebp),%edx
+ a97:	b8 00 00 00 00       	mov    $0x0,%eax
+ a9c:	b9 01 00 00 00       	mov    $0x1,%ecx
+ aa1:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ aa5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ aa8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ aac:	74 3b                	je     ae9 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ aae:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ ab2:	74 2d                	je     ae1 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ ab4:	8b 55 08             	mov    0x8(%ebp),%edx
+ ab7:	b8 02 00 00 00       	mov    $0x2,%eax
+ abc:	87 02                	xchg   %eax,(%edx)
+ abe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ ac1:	eb 1e                	jmp    ae1 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac6:	83 ec 08             	sub    $0x8,%esp
+ ac9:	6a 02                	push   $0x2
+ acb:	50                   	push   %eax
+ acc:	e8 f3 fa ff ff       	call   5c4 <futex_wait>
+ ad1:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ ad4:	8b 55 08             	mov    0x8(%ebp),%edx
+ ad7:	b8 02 00 00 00       	mov    $0x2,%eax
+ adc:	87 02                	xchg   %eax,(%edx)
+ ade:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ ae1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ae5:	75 dc                	jne    ac3 <mutex_lock+0x35>
+ ae7:	eb 01                	jmp    aea <mutex_lock+0x5c>
+    return;
+ ae9:	90                   	nop
+  }
+}
+ aea:	c9                   	leave
+ aeb:	c3                   	ret
+
+00000aec <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ aec:	55                   	push   %ebp
+ aed:	89 e5                	mov    %esp,%ebp
+ aef:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ af2:	8b 45 08             	mov    0x8(%ebp),%eax
+ af5:	ba 01 00 00 00       	mov    $0x1,%edx
+ afa:	f7 da                	neg    %edx
+ afc:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ b00:	83 fa 01             	cmp    $0x1,%edx
+ b03:	74 1a                	je     b1f <mutex_unlock+0x33>
+    m->state = 0;
+ b05:	8b 45 08             	mov    0x8(%ebp),%eax
+ b08:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ b0e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b11:	83 ec 08             	sub    $0x8,%esp
+ b14:	6a 01                	push   $0x1
+ b16:	50                   	push   %eax
+ b17:	e8 b0 fa ff ff       	call   5cc <futex_wake>
+ b1c:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ b1f:	90                   	nop
+ b20:	c9                   	leave
+ b21:	c3                   	ret
+
+00000b22 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ b22:	55                   	push   %ebp
+ b23:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ b25:	8b 45 08             	mov    0x8(%ebp),%eax
+ b28:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ b2e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b31:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ b38:	90                   	nop
+ b39:	5d                   	pop    %ebp
+ b3a:	c3                   	ret
+
+00000b3b <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ b3b:	55                   	push   %ebp
+ b3c:	89 e5                	mov    %esp,%ebp
+ b3e:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ b41:	8b 45 08             	mov    0x8(%ebp),%eax
+ b44:	83 c0 04             	add    $0x4,%eax
+ b47:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ b4b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4e:	83 ec 08             	sub    $0x8,%esp
+ b51:	ff 75 0c             	push   0xc(%ebp)
+ b54:	50                   	push   %eax
+ b55:	e8 6a fa ff ff       	call   5c4 <futex_wait>
+ b5a:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ b5d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b60:	83 c0 04             	add    $0x4,%eax
+ b63:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ b67:	90                   	nop
+ b68:	c9                   	leave
+ b69:	c3                   	ret
+
+00000b6a <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ b6a:	55                   	push   %ebp
+ b6b:	89 e5                	mov    %esp,%ebp
+ b6d:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ b70:	8b 45 08             	mov    0x8(%ebp),%eax
+ b73:	8b 00                	mov    (%eax),%eax
+ b75:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ b78:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b7c:	78 17                	js     b95 <rwlock_rdlock+0x2b>
+ b7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b81:	83 c0 01             	add    $0x1,%eax
+ b84:	89 c1                	mov    %eax,%ecx
+ b86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b89:	8b 55 08             	mov    0x8(%ebp),%edx
+ b8c:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b90:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b93:	74 19                	je     bae <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ b95:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b99:	79 d5                	jns    b70 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ b9b:	83 ec 08             	sub    $0x8,%esp
+ b9e:	ff 75 f4             	push   -0xc(%ebp)
+ ba1:	ff 75 08             	push   0x8(%ebp)
+ ba4:	e8 92 ff ff ff       	call   b3b <rwlock_sleep>
+ ba9:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ bac:	eb c2                	jmp    b70 <rwlock_rdlock+0x6>
+      return;
+ bae:	90                   	nop
+  }
+}
+ baf:	c9                   	leave
+ bb0:	c3                   	ret
+
+00000bb1 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ bb1:	55                   	push   %ebp
+ bb2:	89 e5                	mov    %esp,%ebp
+ bb4:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ bb7:	eb 11                	jmp    bca <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ bb9:	83 ec 08             	sub    $0x8,%esp
+ bbc:	ff 75 f4             	push   -0xc(%ebp)
+ bbf:	ff 75 08             	push   0x8(%ebp)
+ bc2:	e8 74 ff ff ff       	call   b3b <rwlock_sleep>
+ bc7:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ bca:	8b 55 08             	mov    0x8(%ebp),%edx
+ bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+ bd2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ bd7:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ bdb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ bde:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ be2:	75 d5                	jne    bb9 <rwlock_wrlock+0x8>
+}
+ be4:	90                   	nop
+ be5:	90                   	nop
+ be6:	c9                   	leave
+ be7:	c3                   	ret
+
+00000be8 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ be8:	55                   	push   %ebp
+ be9:	89 e5                	mov    %esp,%ebp
+ beb:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ bee:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf1:	8b 00                	mov    (%eax),%eax
+ bf3:	85 c0                	test   %eax,%eax
+ bf5:	79 0c                	jns    c03 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+ bfa:	ba 00 00 00 00       	mov    $0x0,%edx
+ bff:	87 10                	xchg   %edx,(%eax)
+ c01:	eb 18                	jmp    c1b <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ c03:	8b 55 08             	mov    0x8(%ebp),%edx
+ c06:	b8 01 00 00 00       	mov    $0x1,%eax
+ c0b:	f7 d8                	neg    %eax
+ c0d:	89 c1                	mov    %eax,%ecx
+ c0f:	89 c8                	mov    %ecx,%eax
+ c11:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ c15:	01 c8                	add    %ecx,%eax
+ c17:	85 c0                	test   %eax,%eax
+ c19:	75 20                	jne    c3b <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ c1b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1e:	8b 40 04             	mov    0x4(%eax),%eax
+ c21:	85 c0                	test   %eax,%eax
+ c23:	74 17                	je     c3c <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ c25:	8b 45 08             	mov    0x8(%ebp),%eax
+ c28:	83 ec 08             	sub    $0x8,%esp
+ c2b:	68 ff ff ff 7f       	push   $0x7fffffff
+ c30:	50                   	push   %eax
+ c31:	e8 96 f9 ff ff       	call   5cc <futex_wake>
+ c36:	83 c4 10             	add    $0x10,%esp
+ c39:	eb 01                	jmp    c3c <rwlock_unlock+0x54>
+    return;
+ c3b:	90                   	nop
+}
+ c3c:	c9                   	leave
+ c3d:	c3                   	ret
+
+00000c3e <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ c3e:	55                   	push   %ebp
+ c3f:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ c41:	8b 45 08             	mov    0x8(%ebp),%eax
+ c44:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c4a:	90                   	nop
+ c4b:	5d                   	pop    %ebp
+ c4c:	c3                   	ret
+
+00000c4d <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ c4d:	55                   	push   %ebp
+ c4e:	89 e5                	mov    %esp,%ebp
+ c50:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ c53:	8b 45 08             	mov    0x8(%ebp),%eax
+ c56:	8b 00                	mov    (%eax),%eax
+ c58:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ c5b:	83 ec 0c             	sub    $0xc,%esp
+ c5e:	ff 75 0c             	push   0xc(%ebp)
+ c61:	e8 86 fe ff ff       	call   aec <mutex_unlock>
+ c66:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ c69:	8b 45 08             	mov    0x8(%ebp),%eax
+ c6c:	83 ec 08             	sub    $0x8,%esp
+ c6f:	ff 75 f4             	push   -0xc(%ebp)
+ c72:	50                   	push   %eax
+ c73:	e8 4c f9 ff ff       	call   5c4 <futex_wait>
+ c78:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ c7b:	83 ec 0c             	sub    $0xc,%esp
+ c7e:	ff 75 0c             	push   0xc(%ebp)
+ c81:	e8 08 fe ff ff       	call   a8e <mutex_lock>
+ c86:	83 c4 10             	add    $0x10,%esp
+}
+ c89:	90                   	nop
+ c8a:	c9                   	leave
+ c8b:	c3                   	ret
+
+00000c8c <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ c8c:	55                   	push   %ebp
+ c8d:	89 e5                	mov    %esp,%ebp
+ c8f:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c92:	8b 45 08             	mov    0x8(%ebp),%eax
+ c95:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ c99:	8b 45 08             	mov    0x8(%ebp),%eax
+ c9c:	83 ec 08             	sub    $0x8,%esp
+ c9f:	6a 01                	push   $0x1
+ ca1:	50                   	push   %eax
+ ca2:	e8 25 f9 ff ff       	call   5cc <futex_wake>
+ ca7:	83 c4 10             	add    $0x10,%esp
+}
+ caa:	90                   	nop
+ cab:	c9                   	leave
+ cac:	c3                   	ret
+
+00000cad <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ cad:	55                   	push   %ebp
+ cae:	89 e5                	mov    %esp,%ebp
+ cb0:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb6:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ cba:	8b 45 08             	mov    0x8(%ebp),%eax
+ cbd:	83 ec 08             	sub    $0x8,%esp
+ cc0:	68 ff ff ff 7f       	push   $0x7fffffff
+ cc5:	50                   	push   %eax
+ cc6:	e8 01 f9 ff ff       	call   5cc <futex_wake>
+ ccb:	83 c4 10             	add    $0x10,%esp
+}
+ cce:	90                   	nop
+ ccf:	c9                   	leave
+ cd0:	c3                   	ret
@@ -0,0 +1,1769 @@
+
+_copy_file:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "fcntl.h"
+#include "stat.h"
+
+int main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+  11:	89 c8                	mov    %ecx,%eax
+    if (argc < 3)
+  13:	83 38 02             	cmpl   $0x2,(%eax)
+  16:	7f 19                	jg     31 <main+0x31>
+    {
+        printf(1, "2 args required. provided %d\n", argc);
+  18:	83 ec 04             	sub    $0x4,%esp
+  1b:	ff 30                	push   (%eax)
+  1d:	68 30 0c 00 00       	push   $0xc30
+  22:	6a 01                	push   $0x1
+  24:	e8 fd 05 00 00       	call   626 <printf>
+  29:	83 c4 10             	add    $0x10,%esp
+        exit();
+  2c:	e8 89 03 00 00       	call   3ba <exit>
+    }
+    char *src = argv[1];
+  31:	8b 50 04             	mov    0x4(%eax),%edx
+  34:	8b 52 04             	mov    0x4(%edx),%edx
+  37:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    char *dst = argv[2];
+  3a:	8b 40 04             	mov    0x4(%eax),%eax
+  3d:	8b 40 08             	mov    0x8(%eax),%eax
+  40:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    if (copy_file(src, dst) < 0)
+  43:	83 ec 08             	sub    $0x8,%esp
+  46:	ff 75 f0             	push   -0x10(%ebp)
+  49:	ff 75 f4             	push   -0xc(%ebp)
+  4c:	e8 21 04 00 00       	call   472 <copy_file>
+  51:	83 c4 10             	add    $0x10,%esp
+  54:	85 c0                	test   %eax,%eax
+  56:	79 17                	jns    6f <main+0x6f>
+    {
+        printf(1, "uanble to copy file\n");
+  58:	83 ec 08             	sub    $0x8,%esp
+  5b:	68 4e 0c 00 00       	push   $0xc4e
+  60:	6a 01                	push   $0x1
+  62:	e8 bf 05 00 00       	call   626 <printf>
+  67:	83 c4 10             	add    $0x10,%esp
+        exit();
+  6a:	e8 4b 03 00 00       	call   3ba <exit>
+    }
+
+    printf(1, "file %s copied to %s successfuly\n", src, dst);
+  6f:	ff 75 f0             	push   -0x10(%ebp)
+  72:	ff 75 f4             	push   -0xc(%ebp)
+  75:	68 64 0c 00 00       	push   $0xc64
+  7a:	6a 01                	push   $0x1
+  7c:	e8 a5 05 00 00       	call   626 <printf>
+  81:	83 c4 10             	add    $0x10,%esp
+    exit();
+  84:	e8 31 03 00 00       	call   3ba <exit>
+
+00000089 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+  89:	55                   	push   %ebp
+  8a:	89 e5                	mov    %esp,%ebp
+  8c:	57                   	push   %edi
+  8d:	53                   	push   %ebx
+{
+  8e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  91:	8b 55 10             	mov    0x10(%ebp),%edx
+  94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  97:	89 cb                	mov    %ecx,%ebx
+  99:	89 df                	mov    %ebx,%edi
+  9b:	89 d1                	mov    %edx,%ecx
+  9d:	fc                   	cld
+  9e:	f3 aa                	rep stos %al,%es:(%edi)
+  a0:	89 ca                	mov    %ecx,%edx
+  a2:	89 fb                	mov    %edi,%ebx
+  a4:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  a7:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+  aa:	90                   	nop
+  ab:	5b                   	pop    %ebx
+  ac:	5f                   	pop    %edi
+  ad:	5d                   	pop    %ebp
+  ae:	c3                   	ret
+
+000000af <strcpy>:
+{
+  af:	55                   	push   %ebp
+  b0:	89 e5                	mov    %esp,%ebp
+  b2:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  b8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  bb:	90                   	nop
+  bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  bf:	8d 42 01             	lea    0x1(%edx),%eax
+  c2:	89 45 0c             	mov    %eax,0xc(%ebp)
+  c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  c8:	8d 48 01             	lea    0x1(%eax),%ecx
+  cb:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  ce:	0f b6 12             	movzbl (%edx),%edx
+  d1:	88 10                	mov    %dl,(%eax)
+  d3:	0f b6 00             	movzbl (%eax),%eax
+  d6:	84 c0                	test   %al,%al
+  d8:	75 e2                	jne    bc <strcpy+0xd>
+  return os;
+  da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  dd:	c9                   	leave
+  de:	c3                   	ret
+
+000000df <strcmp>:
+{
+  df:	55                   	push   %ebp
+  e0:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  e2:	eb 08                	jmp    ec <strcmp+0xd>
+    p++, q++;
+  e4:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  e8:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  ef:	0f b6 00             	movzbl (%eax),%eax
+  f2:	84 c0                	test   %al,%al
+  f4:	74 10                	je     106 <strcmp+0x27>
+  f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  f9:	0f b6 10             	movzbl (%eax),%edx
+  fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ff:	0f b6 00             	movzbl (%eax),%eax
+ 102:	38 c2                	cmp    %al,%dl
+ 104:	74 de                	je     e4 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 106:	8b 45 08             	mov    0x8(%ebp),%eax
+ 109:	0f b6 00             	movzbl (%eax),%eax
+ 10c:	0f b6 d0             	movzbl %al,%edx
+ 10f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 112:	0f b6 00             	movzbl (%eax),%eax
+ 115:	0f b6 c0             	movzbl %al,%eax
+ 118:	29 c2                	sub    %eax,%edx
+ 11a:	89 d0                	mov    %edx,%eax
+}
+ 11c:	5d                   	pop    %ebp
+ 11d:	c3                   	ret
+
+0000011e <strlen>:
+{
+ 11e:	55                   	push   %ebp
+ 11f:	89 e5                	mov    %esp,%ebp
+ 121:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 124:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 12b:	eb 04                	jmp    131 <strlen+0x13>
+ 12d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 131:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 134:	8b 45 08             	mov    0x8(%ebp),%eax
+ 137:	01 d0                	add    %edx,%eax
+ 139:	0f b6 00             	movzbl (%eax),%eax
+ 13c:	84 c0                	test   %al,%al
+ 13e:	75 ed                	jne    12d <strlen+0xf>
+  return n;
+ 140:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+
+00000145 <memset>:
+{
+ 145:	55                   	push   %ebp
+ 146:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 148:	8b 45 10             	mov    0x10(%ebp),%eax
+ 14b:	50                   	push   %eax
+ 14c:	ff 75 0c             	push   0xc(%ebp)
+ 14f:	ff 75 08             	push   0x8(%ebp)
+ 152:	e8 32 ff ff ff       	call   89 <stosb>
+ 157:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 15a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 15d:	c9                   	leave
+ 15e:	c3                   	ret
+
+0000015f <strchr>:
+{
+ 15f:	55                   	push   %ebp
+ 160:	89 e5                	mov    %esp,%ebp
+ 162:	83 ec 04             	sub    $0x4,%esp
+ 165:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 168:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 16b:	eb 14                	jmp    181 <strchr+0x22>
+    if(*s == c)
+ 16d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 170:	0f b6 00             	movzbl (%eax),%eax
+ 173:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 176:	75 05                	jne    17d <strchr+0x1e>
+      return (char*)s;
+ 178:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17b:	eb 13                	jmp    190 <strchr+0x31>
+  for(; *s; s++)
+ 17d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 181:	8b 45 08             	mov    0x8(%ebp),%eax
+ 184:	0f b6 00             	movzbl (%eax),%eax
+ 187:	84 c0                	test   %al,%al
+ 189:	75 e2                	jne    16d <strchr+0xe>
+  return 0;
+ 18b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 190:	c9                   	leave
+ 191:	c3                   	ret
+
+00000192 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 192:	55                   	push   %ebp
+ 193:	89 e5                	mov    %esp,%ebp
+ 195:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 198:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 19f:	eb 42                	jmp    1e3 <gets+0x51>
+    cc = read(0, &c, 1);
+ 1a1:	83 ec 04             	sub    $0x4,%esp
+ 1a4:	6a 01                	push   $0x1
+ 1a6:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1a9:	50                   	push   %eax
+ 1aa:	6a 00                	push   $0x0
+ 1ac:	e8 21 02 00 00       	call   3d2 <read>
+ 1b1:	83 c4 10             	add    $0x10,%esp
+ 1b4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1b7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1bb:	7e 33                	jle    1f0 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c0:	8d 50 01             	lea    0x1(%eax),%edx
+ 1c3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1c6:	89 c2                	mov    %eax,%edx
+ 1c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1cb:	01 c2                	add    %eax,%edx
+ 1cd:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1d1:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1d3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1d7:	3c 0a                	cmp    $0xa,%al
+ 1d9:	74 16                	je     1f1 <gets+0x5f>
+ 1db:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1df:	3c 0d                	cmp    $0xd,%al
+ 1e1:	74 0e                	je     1f1 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1e6:	83 c0 01             	add    $0x1,%eax
+ 1e9:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1ec:	7f b3                	jg     1a1 <gets+0xf>
+ 1ee:	eb 01                	jmp    1f1 <gets+0x5f>
+      break;
+ 1f0:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1f1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1f4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f7:	01 d0                	add    %edx,%eax
+ 1f9:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1fc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1ff:	c9                   	leave
+ 200:	c3                   	ret
+
+00000201 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 201:	55                   	push   %ebp
+ 202:	89 e5                	mov    %esp,%ebp
+ 204:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 207:	83 ec 08             	sub    $0x8,%esp
+ 20a:	6a 00                	push   $0x0
+ 20c:	ff 75 08             	push   0x8(%ebp)
+ 20f:	e8 e6 01 00 00       	call   3fa <open>
+ 214:	83 c4 10             	add    $0x10,%esp
+ 217:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 21a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 21e:	79 07                	jns    227 <stat+0x26>
+    return -1;
+ 220:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 225:	eb 25                	jmp    24c <stat+0x4b>
+  r = fstat(fd, st);
+ 227:	83 ec 08             	sub    $0x8,%esp
+ 22a:	ff 75 0c             	push   0xc(%ebp)
+ 22d:	ff 75 f4             	push   -0xc(%ebp)
+ 230:	e8 dd 01 00 00       	call   412 <fstat>
+ 235:	83 c4 10             	add    $0x10,%esp
+ 238:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 23b:	83 ec 0c             	sub    $0xc,%esp
+ 23e:	ff 75 f4             	push   -0xc(%ebp)
+ 241:	e8 9c 01 00 00       	call   3e2 <close>
+ 246:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 249:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 24c:	c9                   	leave
+ 24d:	c3                   	ret
+
+0000024e <atoi>:
+
+int
+atoi(const char *s)
+{
+ 24e:	55                   	push   %ebp
+ 24f:	89 e5                	mov    %esp,%ebp
+ 251:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 254:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 25b:	eb 25                	jmp    282 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 25d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 260:	89 d0                	mov    %edx,%eax
+ 262:	c1 e0 02             	shl    $0x2,%eax
+ 265:	01 d0                	add    %edx,%eax
+ 267:	01 c0                	add    %eax,%eax
+ 269:	89 c1                	mov    %eax,%ecx
+ 26b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26e:	8d 50 01             	lea    0x1(%eax),%edx
+ 271:	89 55 08             	mov    %edx,0x8(%ebp)
+ 274:	0f b6 00             	movzbl (%eax),%eax
+ 277:	0f be c0             	movsbl %al,%eax
+ 27a:	01 c8                	add    %ecx,%eax
+ 27c:	83 e8 30             	sub    $0x30,%eax
+ 27f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 282:	8b 45 08             	mov    0x8(%ebp),%eax
+ 285:	0f b6 00             	movzbl (%eax),%eax
+ 288:	3c 2f                	cmp    $0x2f,%al
+ 28a:	7e 0a                	jle    296 <atoi+0x48>
+ 28c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28f:	0f b6 00             	movzbl (%eax),%eax
+ 292:	3c 39                	cmp    $0x39,%al
+ 294:	7e c7                	jle    25d <atoi+0xf>
+  return n;
+ 296:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 299:	c9                   	leave
+ 29a:	c3                   	ret
+
+0000029b <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 29b:	55                   	push   %ebp
+ 29c:	89 e5                	mov    %esp,%ebp
+ 29e:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 2a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2aa:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2ad:	eb 17                	jmp    2c6 <memmove+0x2b>
+    *dst++ = *src++;
+ 2af:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2b2:	8d 42 01             	lea    0x1(%edx),%eax
+ 2b5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2b8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2bb:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2be:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2c1:	0f b6 12             	movzbl (%edx),%edx
+ 2c4:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2c6:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2c9:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2cc:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2cf:	85 c0                	test   %eax,%eax
+ 2d1:	7f dc                	jg     2af <memmove+0x14>
+  return vdst;
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2d6:	c9                   	leave
+ 2d7:	c3                   	ret
+
+000002d8 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 2d8:	55                   	push   %ebp
+ 2d9:	89 e5                	mov    %esp,%ebp
+ 2db:	57                   	push   %edi
+ 2dc:	56                   	push   %esi
+ 2dd:	83 ec 30             	sub    $0x30,%esp
+ 2e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 2e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 2ec:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 2f3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 2fa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2fd:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 300:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 303:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 306:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 30d:	e9 89 00 00 00       	jmp    39b <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 312:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 315:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 318:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 31c:	01 c0                	add    %eax,%eax
+ 31e:	89 c6                	mov    %eax,%esi
+ 320:	89 d7                	mov    %edx,%edi
+ 322:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 325:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 328:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 32b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 32e:	d3 ea                	shr    %cl,%edx
+ 330:	f6 c1 20             	test   $0x20,%cl
+ 333:	74 04                	je     339 <udiv64+0x61>
+ 335:	89 d0                	mov    %edx,%eax
+ 337:	31 d2                	xor    %edx,%edx
+ 339:	83 e0 01             	and    $0x1,%eax
+ 33c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 33f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 346:	89 f0                	mov    %esi,%eax
+ 348:	89 fa                	mov    %edi,%edx
+ 34a:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 34d:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 350:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 353:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 356:	8b 45 10             	mov    0x10(%ebp),%eax
+ 359:	ba 00 00 00 00       	mov    $0x0,%edx
+ 35e:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 361:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 364:	19 d1                	sbb    %edx,%ecx
+ 366:	72 2f                	jb     397 <udiv64+0xbf>
+      r -= d;
+ 368:	8b 45 10             	mov    0x10(%ebp),%eax
+ 36b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 370:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 373:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 376:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 379:	b8 01 00 00 00       	mov    $0x1,%eax
+ 37e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 383:	0f a5 c2             	shld   %cl,%eax,%edx
+ 386:	d3 e0                	shl    %cl,%eax
+ 388:	f6 c1 20             	test   $0x20,%cl
+ 38b:	74 04                	je     391 <udiv64+0xb9>
+ 38d:	89 c2                	mov    %eax,%edx
+ 38f:	31 c0                	xor    %eax,%eax
+ 391:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 394:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 397:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 39b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 39f:	0f 89 6d ff ff ff    	jns    312 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 3a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 3a8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 3ab:	83 c4 30             	add    $0x30,%esp
+ 3ae:	5e                   	pop    %esi
+ 3af:	5f                   	pop    %edi
+ 3b0:	5d                   	pop    %ebp
+ 3b1:	c3                   	ret
+
+000003b2 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3b2:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3b7:	cd 40                	int    $0x40
+ 3b9:	c3                   	ret
+
+000003ba <exit>:
+SYSCALL(exit)
+ 3ba:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3bf:	cd 40                	int    $0x40
+ 3c1:	c3                   	ret
+
+000003c2 <wait>:
+SYSCALL(wait)
+ 3c2:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3c7:	cd 40                	int    $0x40
+ 3c9:	c3                   	ret
+
+000003ca <pipe>:
+SYSCALL(pipe)
+ 3ca:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3cf:	cd 40                	int    $0x40
+ 3d1:	c3                   	ret
+
+000003d2 <read>:
+SYSCALL(read)
+ 3d2:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3d7:	cd 40                	int    $0x40
+ 3d9:	c3                   	ret
+
+000003da <write>:
+SYSCALL(write)
+ 3da:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3df:	cd 40                	int    $0x40
+ 3e1:	c3                   	ret
+
+000003e2 <close>:
+SYSCALL(close)
+ 3e2:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+000003ea <kill>:
+SYSCALL(kill)
+ 3ea:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3ef:	cd 40                	int    $0x40
+ 3f1:	c3                   	ret
+
+000003f2 <exec>:
+SYSCALL(exec)
+ 3f2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+000003fa <open>:
+SYSCALL(open)
+ 3fa:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ff:	cd 40                	int    $0x40
+ 401:	c3                   	ret
+
+00000402 <mknod>:
+SYSCALL(mknod)
+ 402:	b8 11 00 00 00       	mov    $0x11,%eax
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+0000040a <unlink>:
+SYSCALL(unlink)
+ 40a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 40f:	cd 40                	int    $0x40
+ 411:	c3                   	ret
+
+00000412 <fstat>:
+SYSCALL(fstat)
+ 412:	b8 08 00 00 00       	mov    $0x8,%eax
+ 417:	cd 40                	int    $0x40
+ 419:	c3                   	ret
+
+0000041a <link>:
+SYSCALL(link)
+ 41a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 41f:	cd 40                	int    $0x40
+ 421:	c3                   	ret
+
+00000422 <mkdir>:
+SYSCALL(mkdir)
+ 422:	b8 14 00 00 00       	mov    $0x14,%eax
+ 427:	cd 40                	int    $0x40
+ 429:	c3                   	ret
+
+0000042a <chdir>:
+SYSCALL(chdir)
+ 42a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 42f:	cd 40                	int    $0x40
+ 431:	c3                   	ret
+
+00000432 <dup>:
+SYSCALL(dup)
+ 432:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 437:	cd 40                	int    $0x40
+ 439:	c3                   	ret
+
+0000043a <getpid>:
+SYSCALL(getpid)
+ 43a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 43f:	cd 40                	int    $0x40
+ 441:	c3                   	ret
+
+00000442 <sbrk>:
+SYSCALL(sbrk)
+ 442:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 447:	cd 40                	int    $0x40
+ 449:	c3                   	ret
+
+0000044a <sleep>:
+SYSCALL(sleep)
+ 44a:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 44f:	cd 40                	int    $0x40
+ 451:	c3                   	ret
+
+00000452 <uptime>:
+SYSCALL(uptime)
+ 452:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 457:	cd 40                	int    $0x40
+ 459:	c3                   	ret
+
+0000045a <find_digital_root>:
+SYSCALL(find_digital_root)
+ 45a:	b8 16 00 00 00       	mov    $0x16,%eax
+ 45f:	cd 40                	int    $0x40
+ 461:	c3                   	ret
+
+00000462 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 462:	b8 17 00 00 00       	mov    $0x17,%eax
+ 467:	cd 40                	int    $0x40
+ 469:	c3                   	ret
+
+0000046a <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 46a:	b8 18 00 00 00       	mov    $0x18,%eax
+ 46f:	cd 40                	int    $0x40
+ 471:	c3                   	ret
+
+00000472 <copy_file>:
+SYSCALL(copy_file)
+ 472:	b8 19 00 00 00       	mov    $0x19,%eax
+ 477:	cd 40                	int    $0x40
+ 479:	c3                   	ret
+
+0000047a <change_queue>:
+SYSCALL(change_queue)
+ 47a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 47f:	cd 40                	int    $0x40
+ 481:	c3                   	ret
+
+00000482 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 482:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 487:	cd 40                	int    $0x40
+ 489:	c3                   	ret
+
+0000048a <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 48a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 48f:	cd 40                	int    $0x40
+ 491:	c3                   	ret
+
+00000492 <print_process_info>:
+SYSCALL(print_process_info)
+ 492:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 497:	cd 40                	int    $0x40
+ 499:	c3                   	ret
+
+0000049a <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 49a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 49f:	cd 40                	int    $0x40
+ 4a1:	c3                   	ret
+
+000004a2 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 4a2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4a7:	cd 40                	int    $0x40
+ 4a9:	c3                   	ret
+
+000004aa <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 4aa:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4af:	cd 40                	int    $0x40
+ 4b1:	c3                   	ret
+
+000004b2 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 4b2:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4b7:	cd 40                	int    $0x40
+ 4b9:	c3                   	ret
+
+000004ba <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 4ba:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4bf:	cd 40                	int    $0x40
+ 4c1:	c3                   	ret
+
+000004c2 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 4c2:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4c7:	cd 40                	int    $0x40
+ 4c9:	c3                   	ret
+
+000004ca <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 4ca:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4cf:	cd 40                	int    $0x40
+ 4d1:	c3                   	ret
+
+000004d2 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 4d2:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4d7:	cd 40                	int    $0x40
+ 4d9:	c3                   	ret
+
+000004da <set_affinity>:
+SYSCALL(set_affinity)
+ 4da:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4df:	cd 40                	int    $0x40
+ 4e1:	c3                   	ret
+
+000004e2 <setsched>:
+SYSCALL(setsched)
+ 4e2:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4e7:	cd 40                	int    $0x40
+ 4e9:	c3                   	ret
+
+000004ea <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 4ea:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4ef:	cd 40                	int    $0x40
+ 4f1:	c3                   	ret
+
+000004f2 <set_quantum>:
+SYSCALL(set_quantum)
+ 4f2:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4f7:	cd 40                	int    $0x40
+ 4f9:	c3                   	ret
+
+000004fa <schedtrace>:
+SYSCALL(schedtrace)
+ 4fa:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4ff:	cd 40                	int    $0x40
+ 501:	c3                   	ret
+
+00000502 <getrusage>:
+SYSCALL(getrusage)
+ 502:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 507:	cd 40                	int    $0x40
+ 509:	c3                   	ret
+
+0000050a <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 50a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 50f:	cd 40                	int    $0x40
+ 511:	c3                   	ret
+
+00000512 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 512:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 517:	cd 40                	int    $0x40
+ 519:	c3                   	ret
+
+0000051a <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 51a:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 51f:	cd 40                	int    $0x40
+ 521:	c3                   	ret
+
+00000522 <futex_wait>:
+SYSCALL(futex_wait)
+ 522:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 527:	cd 40                	int    $0x40
+ 529:	c3                   	ret
+
+0000052a <futex_wake>:
+SYSCALL(futex_wake)
+ 52a:	b8 30 00 00 00       	mov    $0x30,%eax
+ 52f:	cd 40                	int    $0x40
+ 531:	c3                   	ret
+
+00000532 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 532:	b8 31 00 00 00       	mov    $0x31,%eax
+ 537:	cd 40                	int    $0x40
+ 539:	c3                   	ret
+
+0000053a <submit_batch>:
+SYSCALL(submit_batch)
+ 53a:	b8 32 00 00 00       	mov    $0x32,%eax
+ 53f:	cd 40                	int    $0x40
+ 541:	c3                   	ret
+
+00000542 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 542:	b8 33 00 00 00       	mov    $0x33,%eax
+ 547:	cd 40                	int    $0x40
+ 549:	c3                   	ret
+
+0000054a <kmem_junk>:
+SYSCALL(kmem_junk)
+ 54a:	b8 34 00 00 00       	mov    $0x34,%eax
+ 54f:	cd 40                	int    $0x40
+ 551:	c3                   	ret
+
+00000552 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 552:	55                   	push   %ebp
+ 553:	89 e5                	mov    %esp,%ebp
+ 555:	83 ec 18             	sub    $0x18,%esp
+ 558:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 55b:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 55e:	83 ec 04             	sub    $0x4,%esp
+ 561:	6a 01                	push   $0x1
+ 563:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 566:	50                   	push   %eax
+ 567:	ff 75 08             	push   0x8(%ebp)
+ 56a:	e8 6b fe ff ff       	call   3da <write>
+ 56f:	83 c4 10             	add    $0x10,%esp
+}
+ 572:	90                   	nop
+ 573:	c9                   	leave
+ 574:	c3                   	ret
+
+00000575 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 575:	55                   	push   %ebp
+ 576:	89 e5                	mov    %esp,%ebp
+ 578:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 57b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 582:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 586:	74 17                	je     59f <printint+0x2a>
+ 588:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 58c:	79 11                	jns    59f <printint+0x2a>
+    neg = 1;
+ 58e:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 595:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 598:	f7 d8                	neg    %eax
+ 59a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 59d:	eb 06                	jmp    5a5 <printint+0x30>
+  } else {
+    x = xx;
+ 59f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5a5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5ac:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5af:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5b2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5b7:	f7 f1                	div    %ecx
+ 5b9:	89 d1                	mov    %edx,%ecx
+ 5bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5be:	8d 50 01             	lea    0x1(%eax),%edx
+ 5c1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5c4:	0f b6 91 7c 10 00 00 	movzbl 0x107c(%ecx),%edx
+ 5cb:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5cf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5d2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5d5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5da:	f7 f1                	div    %ecx
+ 5dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5df:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5e3:	75 c7                	jne    5ac <printint+0x37>
+  if(neg)
+ 5e5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5e9:	74 2d                	je     618 <printint+0xa3>
+    buf[i++] = '-';
+ 5eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5ee:	8d 50 01             	lea    0x1(%eax),%edx
+ 5f1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5f4:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5f9:	eb 1d                	jmp    618 <printint+0xa3>
+    putc(fd, buf[i]);
+ 5fb:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 601:	01 d0                	add    %edx,%eax
+ 603:	0f b6 00             	movzbl (%eax),%eax
+ 606:	0f be c0             	movsbl %al,%eax
+ 609:	83 ec 08             	sub    $0x8,%esp
+ 60c:	50                   	push   %eax
+ 60d:	ff 75 08             	push   0x8(%ebp)
+ 610:	e8 3d ff ff ff       	call   552 <putc>
+ 615:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 618:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 61c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 620:	79 d9                	jns    5fb <printint+0x86>
+}
+ 622:	90                   	nop
+ 623:	90                   	nop
+ 624:	c9                   	leave
+ 625:	c3                   	ret
+
+00000626 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 626:	55                   	push   %ebp
+ 627:	89 e5                	mov    %esp,%ebp
+ 629:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 62c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 633:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 636:	83 c0 04             	add    $0x4,%eax
+ 639:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 63c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 643:	e9 59 01 00 00       	jmp    7a1 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 648:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 64b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 64e:	01 d0                	add    %edx,%eax
+ 650:	0f b6 00             	movzbl (%eax),%eax
+ 653:	0f be c0             	movsbl %al,%eax
+ 656:	25 ff 00 00 00       	and    $0xff,%eax
+ 65b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 65e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 662:	75 2c                	jne    690 <printf+0x6a>
+      if(c == '%'){
+ 664:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 668:	75 0c                	jne    676 <printf+0x50>
+        state = '%';
+ 66a:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 671:	e9 27 01 00 00       	jmp    79d <printf+0x177>
+      } else {
+        putc(fd, c);
+ 676:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 679:	0f be c0             	movsbl %al,%eax
+ 67c:	83 ec 08             	sub    $0x8,%esp
+ 67f:	50                   	push   %eax
+ 680:	ff 75 08             	push   0x8(%ebp)
+ 683:	e8 ca fe ff ff       	call   552 <putc>
+ 688:	83 c4 10             	add    $0x10,%esp
+ 68b:	e9 0d 01 00 00       	jmp    79d <printf+0x177>
+      }
+    } else if(state == '%'){
+ 690:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 694:	0f 85 03 01 00 00    	jne    79d <printf+0x177>
+      if(c == 'd'){
+ 69a:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 69e:	75 1e                	jne    6be <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 6a0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6a3:	8b 00                	mov    (%eax),%eax
+ 6a5:	6a 01                	push   $0x1
+ 6a7:	6a 0a                	push   $0xa
+ 6a9:	50                   	push   %eax
+ 6aa:	ff 75 08             	push   0x8(%ebp)
+ 6ad:	e8 c3 fe ff ff       	call   575 <printint>
+ 6b2:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6b5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6b9:	e9 d8 00 00 00       	jmp    796 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6be:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6c2:	74 06                	je     6ca <printf+0xa4>
+ 6c4:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6c8:	75 1e                	jne    6e8 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6ca:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6cd:	8b 00                	mov    (%eax),%eax
+ 6cf:	6a 00                	push   $0x0
+ 6d1:	6a 10                	push   $0x10
+ 6d3:	50                   	push   %eax
+ 6d4:	ff 75 08             	push   0x8(%ebp)
+ 6d7:	e8 99 fe ff ff       	call   575 <printint>
+ 6dc:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6df:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6e3:	e9 ae 00 00 00       	jmp    796 <printf+0x170>
+      } else if(c == 's'){
+ 6e8:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6ec:	75 43                	jne    731 <printf+0x10b>
+        s = (char*)*ap;
+ 6ee:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f1:	8b 00                	mov    (%eax),%eax
+ 6f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6f6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6fa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6fe:	75 25                	jne    725 <printf+0xff>
+          s = "(null)";
+ 700:	c7 45 f4 86 0c 00 00 	movl   $0xc86,-0xc(%ebp)
+        while(*s != 0){
+ 707:	eb 1c                	jmp    725 <printf+0xff>
+          putc(fd, *s);
+ 709:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 70c:	0f b6 00             	movzbl (%eax),%eax
+ 70f:	0f be c0             	movsbl %al,%eax
+ 712:	83 ec 08             	sub    $0x8,%esp
+ 715:	50                   	push   %eax
+ 716:	ff 75 08             	push   0x8(%ebp)
+ 719:	e8 34 fe ff ff       	call   552 <putc>
+ 71e:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 721:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 725:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 728:	0f b6 00             	movzbl (%eax),%eax
+ 72b:	84 c0                	test   %al,%al
+ 72d:	75 da                	jne    709 <printf+0xe3>
+ 72f:	eb 65                	jmp    796 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 731:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 735:	75 1d                	jne    754 <printf+0x12e>
+        putc(fd, *ap);
+ 737:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 73a:	8b 00                	mov    (%eax),%eax
+ 73c:	0f be c0             	movsbl %al,%eax
+ 73f:	83 ec 08             	sub    $0x8,%esp
+ 742:	50                   	push   %eax
+ 743:	ff 75 08             	push   0x8(%ebp)
+ 746:	e8 07 fe ff ff       	call   552 <putc>
+ 74b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 74e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 752:	eb 42                	jmp    796 <printf+0x170>
+      } else if(c == '%'){
+ 754:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 758:	75 17                	jne    771 <printf+0x14b>
+        putc(fd, c);
+ 75a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 75d:	0f be c0             	movsbl %al,%eax
+ 760:	83 ec 08             	sub    $0x8,%esp
+ 763:	50                   	push   %eax
+ 764:	ff 75 08             	push   0x8(%ebp)
+ 767:	e8 e6 fd ff ff       	call   552 <putc>
+ 76c:	83 c4 10             	add    $0x10,%esp
+ 76f:	eb 25                	jmp    796 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 771:	83 ec 08             	sub    $0x8,%esp
+ 774:	6a 25                	push   $0x25
+ 776:	ff 75 08             	push   0x8(%ebp)
+ 779:	e8 d4 fd ff ff       	call   552 <putc>
+ 77e:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 781:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 784:	0f be c0             	movsbl %al,%eax
+ 787:	83 ec 08             	sub    $0x8,%esp
+ 78a:	50                   	push   %eax
+ 78b:	ff 75 08             	push   0x8(%ebp)
+ 78e:	e8 bf fd ff ff       	call   552 <putc>
+ 793:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 796:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 79d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7a4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7a7:	01 d0                	add    %edx,%eax
+ 7a9:	0f b6 00             	movzbl (%eax),%eax
+ 7ac:	84 c0                	test   %al,%al
+ 7ae:	0f 85 94 fe ff ff    	jne    648 <printf+0x22>
+    }
+  }
+}
+ 7b4:	90                   	nop
+ 7b5:	90                   	nop
+ 7b6:	c9                   	leave
+ 7b7:	c3                   	ret
+
+000007b8 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7b8:	55                   	push   %ebp
+ 7b9:	89 e5                	mov    %esp,%ebp
+ 7bb:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c1:	83 e8 08             	sub    $0x8,%eax
+ 7c4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c7:	a1 98 10 00 00       	mov    0x1098,%eax
+ 7cc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7cf:	eb 24                	jmp    7f5 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d4:	8b 00                	mov    (%eax),%eax
+ 7d6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7d9:	72 12                	jb     7ed <free+0x35>
+ 7db:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7de:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7e1:	72 24                	jb     807 <free+0x4f>
+ 7e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e6:	8b 00                	mov    (%eax),%eax
+ 7e8:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7eb:	72 1a                	jb     807 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f0:	8b 00                	mov    (%eax),%eax
+ 7f2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7f5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7fb:	73 d4                	jae    7d1 <free+0x19>
+ 7fd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 800:	8b 00                	mov    (%eax),%eax
+ 802:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 805:	73 ca                	jae    7d1 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 807:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 80a:	8b 40 04             	mov    0x4(%eax),%eax
+ 80d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 814:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 817:	01 c2                	add    %eax,%edx
+ 819:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 81c:	8b 00                	mov    (%eax),%eax
+ 81e:	39 c2                	cmp    %eax,%edx
+ 820:	75 24                	jne    846 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 822:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 825:	8b 50 04             	mov    0x4(%eax),%edx
+ 828:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 82b:	8b 00                	mov    (%eax),%eax
+ 82d:	8b 40 04             	mov    0x4(%eax),%eax
+ 830:	01 c2                	add    %eax,%edx
+ 832:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 835:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 838:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83b:	8b 00                	mov    (%eax),%eax
+ 83d:	8b 10                	mov    (%eax),%edx
+ 83f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 842:	89 10                	mov    %edx,(%eax)
+ 844:	eb 0a                	jmp    850 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 846:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 849:	8b 10                	mov    (%eax),%edx
+ 84b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 84e:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 850:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 853:	8b 40 04             	mov    0x4(%eax),%eax
+ 856:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 85d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 860:	01 d0                	add    %edx,%eax
+ 862:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 865:	75 20                	jne    887 <free+0xcf>
+    p->s.size += bp->s.size;
+ 867:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86a:	8b 50 04             	mov    0x4(%eax),%edx
+ 86d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 870:	8b 40 04             	mov    0x4(%eax),%eax
+ 873:	01 c2                	add    %eax,%edx
+ 875:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 878:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 87b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 87e:	8b 10                	mov    (%eax),%edx
+ 880:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 883:	89 10                	mov    %edx,(%eax)
+ 885:	eb 08                	jmp    88f <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 887:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 88d:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 88f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 892:	a3 98 10 00 00       	mov    %eax,0x1098
+}
+ 897:	90                   	nop
+ 898:	c9                   	leave
+ 899:	c3                   	ret
+
+0000089a <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 89a:	55                   	push   %ebp
+ 89b:	89 e5                	mov    %esp,%ebp
+ 89d:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 8a0:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8a7:	77 07                	ja     8b0 <morecore+0x16>
+    nu = 4096;
+ 8a9:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 8b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8b3:	c1 e0 03             	shl    $0x3,%eax
+ 8b6:	83 ec 0c             	sub    $0xc,%esp
+ 8b9:	50                   	push   %eax
+ 8ba:	e8 83 fb ff ff       	call   442 <sbrk>
+ 8bf:	83 c4 10             	add    $0x10,%esp
+ 8c2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 8c5:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8c9:	75 07                	jne    8d2 <morecore+0x38>
+    return 0;
+ 8cb:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8d0:	eb 26                	jmp    8f8 <morecore+0x5e>
+  hp = (Header*)p;
+ 8d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 8d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8db:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8de:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8e4:	83 c0 08             	add    $0x8,%eax
+ 8e7:	83 ec 0c             	sub    $0xc,%esp
+ 8ea:	50                   	push   %eax
+ 8eb:	e8 c8 fe ff ff       	call   7b8 <free>
+ 8f0:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 8f3:	a1 98 10 00 00       	mov    0x1098,%eax
+}
+ 8f8:	c9                   	leave
+ 8f9:	c3                   	ret
+
+000008fa <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8fa:	55                   	push   %ebp
+ 8fb:	89 e5                	mov    %esp,%ebp
+ 8fd:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 900:	8b 45 08             	mov    0x8(%ebp),%eax
+ 903:	83 c0 07             	add    $0x7,%eax
+ 906:	c1 e8 03             	shr    $0x3,%eax
+ 909:	83 c0 01             	add    $0x1,%eax
+ 90c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 90f:	a1 98 10 00 00       	mov    0x1098,%eax
+ 914:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 917:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 91b:	75 23                	jne    940 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 91d:	c7 45 f0 90 10 00 00 	movl   $0x1090,-0x10(%ebp)
+ 924:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 927:	a3 98 10 00 00       	mov    %eax,0x1098
+ 92c:	a1 98 10 00 00       	mov    0x1098,%eax
+ 931:	a3 90 10 00 00       	mov    %eax,0x1090
+    base.s.size = 0;
+ 936:	c7 05 94 10 00 00 00 	movl   $0x0,0x1094
+ 93d:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 940:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 943:	8b 00                	mov    (%eax),%eax
+ 945:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 948:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 94b:	8b 40 04             	mov    0x4(%eax),%eax
+ 94e:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 951:	72 4d                	jb     9a0 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 953:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 956:	8b 40 04             	mov    0x4(%eax),%eax
+ 959:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 95c:	75 0c                	jne    96a <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 95e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 961:	8b 10                	mov    (%eax),%edx
+ 963:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 966:	89 10                	mov    %edx,(%eax)
+ 968:	eb 26                	jmp    990 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 96a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 96d:	8b 40 04             	mov    0x4(%eax),%eax
+ 970:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 973:	89 c2                	mov    %eax,%edx
+ 975:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 978:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 97b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97e:	8b 40 04             	mov    0x4(%eax),%eax
+ 981:	c1 e0 03             	shl    $0x3,%eax
+ 984:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 987:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 98a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 98d:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 990:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 993:	a3 98 10 00 00       	mov    %eax,0x1098
+      return (void*)(p + 1);
+ 998:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99b:	83 c0 08             	add    $0x8,%eax
+ 99e:	eb 3b                	jmp    9db <malloc+0xe1>
+    }
+    if(p == freep)
+ 9a0:	a1 98 10 00 00       	mov    0x1098,%eax
+ 9a5:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9a8:	75 1e                	jne    9c8 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 9aa:	83 ec 0c             	sub    $0xc,%esp
+ 9ad:	ff 75 ec             	push   -0x14(%ebp)
+ 9b0:	e8 e5 fe ff ff       	call   89a <morecore>
+ 9b5:	83 c4 10             	add    $0x10,%esp
+ 9b8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9bb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9bf:	75 07                	jne    9c8 <malloc+0xce>
+        return 0;
+ 9c1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9c6:	eb 13                	jmp    9db <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9cb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d1:	8b 00                	mov    (%eax),%eax
+ 9d3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9d6:	e9 6d ff ff ff       	jmp    948 <malloc+0x4e>
+  }
+}
+ 9db:	c9                   	leave
+ 9dc:	c3                   	ret
+
+000009dd <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ 9dd:	55                   	push   %ebp
+ 9de:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 9e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9e3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 9e9:	90                   	nop
+ 9ea:	5d                   	pop    %ebp
+ 9eb:	c3                   	ret
+
+000009ec <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 9ec:	55                   	push   %ebp
+ 9ed:	89 e5                	mov    %esp,%ebp
+ 9ef:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 9f2:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9f5:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9fa:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 9ff:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ a03:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a06:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a0a:	74 3b                	je     a47 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ a0c:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ a10:	74 2d                	je     a3f <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a12:	8b 55 08             	mov    0x8(%ebp),%edx
+ a15:	b8 02 00 00 00       	mov    $0x2,%eax
+ a1a:	87 02                	xchg   %eax,(%edx)
+ a1c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a1f:	eb 1e                	jmp    a3f <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ a21:	8b 45 08             	mov    0x8(%ebp),%eax
+ a24:	83 ec 08             	sub    $0x8,%esp
+ a27:	6a 02                	push   $0x2
+ a29:	50                   	push   %eax
+ a2a:	e8 f3 fa ff ff       	call   522 <futex_wait>
+ a2f:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a32:	8b 55 08             	mov    0x8(%ebp),%edx
+ a35:	b8 02 00 00 00       	mov    $0x2,%eax
+ a3a:	87 02                	xchg   %eax,(%edx)
+ a3c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a3f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a43:	75 dc                	jne    a21 <mutex_lock+0x35>
+ a45:	eb 01                	jmp    a48 <mutex_lock+0x5c>
+    return;
+ a47:	90                   	nop
+  }
+}
+ a48:	c9                   	leave
+ a49:	c3                   	ret
+
+00000a4a <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ a4a:	55                   	push   %ebp
+ a4b:	89 e5                	mov    %esp,%ebp
+ a4d:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ a50:	8b 45 08             	mov    0x8(%ebp),%eax
+ a53:	ba 01 00 00 00       	mov    $0x1,%edx
+ a58:	f7 da                	neg    %edx
+ a5a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ a5e:	83 fa 01             	cmp    $0x1,%edx
+ a61:	74 1a                	je     a7d <mutex_unlock+0x33>
+    m->state = 0;
+ a63:	8b 45 08             	mov    0x8(%ebp),%eax
+ a66:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ a6c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a6f:	83 ec 08             	sub    $0x8,%esp
+ a72:	6a 01                	push   $0x1
+ a74:	50                   	push   %eax
+ a75:	e8 b0 fa ff ff       	call   52a <futex_wake>
+ a7a:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ a7d:	90                   	nop
+ a7e:	c9                   	leave
+ a7f:	c3                   	ret
+
+00000a80 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ a83:	8b 45 08             	mov    0x8(%ebp),%eax
+ a86:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ a8c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a8f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ a96:	90                   	nop
+ a97:	5d                   	pop    %ebp
+ a98:	c3                   	ret
+
+00000a99 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ a99:	55                   	push   %ebp
+ a9a:	89 e5                	mov    %esp,%ebp
+ a9c:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa2:	83 c0 04             	add    $0x4,%eax
+ aa5:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ aa9:	8b 45 08             	mov    0x8(%ebp),%eax
+ aac:	83 ec 08             	sub    $0x8,%esp
+ aaf:	ff 75 0c             	push   0xc(%ebp)
+ ab2:	50                   	push   %eax
+ ab3:	e8 6a fa ff ff       	call   522 <futex_wait>
+ ab8:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ abb:	8b 45 08             	mov    0x8(%ebp),%eax
+ abe:	83 c0 04             	add    $0x4,%eax
+ ac1:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ ac5:	90                   	nop
+ ac6:	c9                   	leave
+ ac7:	c3                   	ret
+
+00000ac8 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ ac8:	55                   	push   %ebp
+ ac9:	89 e5                	mov    %esp,%ebp
+ acb:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ ace:	8b 45 08             	mov    0x8(%ebp),%eax
+ ad1:	8b 00                	mov    (%eax),%eax
+ ad3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ ad6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ada:	78 17                	js     af3 <rwlock_rdlock+0x2b>
+ adc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ adf:	83 c0 01             	add    $0x1,%eax
+ ae2:	89 c1                	mov    %eax,%ecx
+ ae4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae7:	8b 55 08             	mov    0x8(%ebp),%edx
+ aea:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ aee:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ af1:	74 19                	je     b0c <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ af3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ af7:	79 d5                	jns    ace <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ af9:	83 ec 08             	sub    $0x8,%esp
+ afc:	ff 75 f4             	push   -0xc(%ebp)
+ aff:	ff 75 08             	push   0x8(%ebp)
+ b02:	e8 92 ff ff ff       	call   a99 <rwlock_sleep>
+ b07:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ b0a:	eb c2                	jmp    ace <rwlock_rdlock+0x6>
+      return;
+ b0c:	90                   	nop
+  }
+}
+ b0d:	c9                   	leave
+ b0e:	c3                   	ret
+
+00000b0f <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ b0f:	55                   	push   %ebp
+ b10:	89 e5                	mov    %esp,%ebp
+ b12:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b15:	eb 11                	jmp    b28 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ b17:	83 ec 08             	sub    $0x8,%esp
+ b1a:	ff 75 f4             	push   -0xc(%ebp)
+ b1d:	ff 75 08             	push   0x8(%ebp)
+ b20:	e8 74 ff ff ff       	call   a99 <rwlock_sleep>
+ b25:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b28:	8b 55 08             	mov    0x8(%ebp),%edx
+ b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+ b30:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ b35:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b39:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b3c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b40:	75 d5                	jne    b17 <rwlock_wrlock+0x8>
+}
+ b42:	90                   	nop
+ b43:	90                   	nop
+ b44:	c9                   	leave
+ b45:	c3                   	ret
+
+00000b46 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ b46:	55                   	push   %ebp
+ b47:	89 e5                	mov    %esp,%ebp
+ b49:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ b4c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4f:	8b 00                	mov    (%eax),%eax
+ b51:	85 c0                	test   %eax,%eax
+ b53:	79 0c                	jns    b61 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ b55:	8b 45 08             	mov    0x8(%ebp),%eax
+ b58:	ba 00 00 00 00       	mov    $0x0,%edx
+ b5d:	87 10                	xchg   %edx,(%eax)
+ b5f:	eb 18                	jmp    b79 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ b61:	8b 55 08             	mov    0x8(%ebp),%edx
+ b64:	b8 01 00 00 00       	mov    $0x1,%eax
+ b69:	f7 d8                	neg    %eax
+ b6b:	89 c1                	mov    %eax,%ecx
+ b6d:	89 c8                	mov    %ecx,%eax
+ b6f:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ b73:	01 c8                	add    %ecx,%eax
+ b75:	85 c0                	test   %eax,%eax
+ b77:	75 20                	jne    b99 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ b79:	8b 45 08             	mov    0x8(%ebp),%eax
+ b7c:	8b 40 04             	mov    0x4(%eax),%eax
+ b7f:	85 c0                	test   %eax,%eax
+ b81:	74 17                	je     b9a <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ b83:	8b 45 08             	mov    0x8(%ebp),%eax
+ b86:	83 ec 08             	sub    $0x8,%esp
+ b89:	68 ff ff ff 7f       	push   $0x7fffffff
+ b8e:	50                   	push   %eax
+ b8f:	e8 96 f9 ff ff       	call   52a <futex_wake>
+ b94:	83 c4 10             	add    $0x10,%esp
+ b97:	eb 01                	jmp    b9a <rwlock_unlock+0x54>
+    return;
+ b99:	90                   	nop
+}
+ b9a:	c9                   	leave
+ b9b:	c3                   	ret
+
+00000b9c <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ b9c:	55                   	push   %ebp
+ b9d:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ b9f:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ ba8:	90                   	nop
+ ba9:	5d                   	pop    %ebp
+ baa:	c3                   	ret
+
+00000bab <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ bab:	55                   	push   %ebp
+ bac:	89 e5                	mov    %esp,%ebp
+ bae:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ bb1:	8b 45 08             	mov    0x8(%ebp),%eax
+ bb4:	8b 00                	mov    (%eax),%eax
+ bb6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ bb9:	83 ec 0c             	sub    $0xc,%esp
+ bbc:	ff 75 0c             	push   0xc(%ebp)
+ bbf:	e8 86 fe ff ff       	call   a4a <mutex_unlock>
+ bc4:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ bc7:	8b 45 08             	mov    0x8(%ebp),%eax
+ bca:	83 ec 08             	sub    $0x8,%esp
+ bcd:	ff 75 f4             	push   -0xc(%ebp)
+ bd0:	50                   	push   %eax
+ bd1:	e8 4c f9 ff ff       	call   522 <futex_wait>
+ bd6:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ bd9:	83 ec 0c             	sub    $0xc,%esp
+ bdc:	ff 75 0c             	push   0xc(%ebp)
+ bdf:	e8 08 fe ff ff       	call   9ec <mutex_lock>
+ be4:	83 c4 10             	add    $0x10,%esp
+}
+ be7:	90                   	nop
+ be8:	c9                   	leave
+ be9:	c3                   	ret
+
+00000bea <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ bea:	55                   	push   %ebp
+ beb:	89 e5                	mov    %esp,%ebp
+ bed:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ bf0:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf3:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+ bfa:	83 ec 08             	sub    $0x8,%esp
+ bfd:	6a 01                	push   $0x1
+ bff:	50                   	push   %eax
+ c00:	e8 25 f9 ff ff       	call   52a <futex_wake>
+ c05:	83 c4 10             	add    $0x10,%esp
+}
+ c08:	90                   	nop
+ c09:	c9                   	leave
+ c0a:	c3                   	ret
+
+00000c0b <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ c0b:	55                   	push   %ebp
+ c0c:	89 e5                	mov    %esp,%ebp
+ c0e:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c11:	8b 45 08             	mov    0x8(%ebp),%eax
+ c14:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ c18:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1b:	83 ec 08             	sub    $0x8,%esp
+ c1e:	68 ff ff ff 7f       	push   $0x7fffffff
+ c23:	50                   	push   %eax
+ c24:	e8 01 f9 ff ff       	call   52a <futex_wake>
+ c29:	83 c4 10             	add    $0x10,%esp
+}
+ c2c:	90                   	nop
+ c2d:	c9                   	leave
+ c2e:	c3                   	ret
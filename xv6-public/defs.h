@@ -10,6 +10,11 @@ struct sleeplock;
 struct stat;
 struct superblock;
 struct prioritylock;
+struct trace_event;
+struct rusage;
+struct syslat;
+struct kmemstat;
+struct kmem_cache;
 
 // bio.c
 void binit(void);
@@ -69,6 +74,13 @@ char *kalloc(void);
 void kfree(char *);
 void kinit1(void *, void *);
 void kinit2(void *, void *);
+void kref(char *);
+int krefs(char *);
+int kmem_stats(struct kmemstat *, int);
+char *kzalloc(void);
+int kzfill(void);
+int kfreepages(void);
+int kmem_junk(int);
 
 // kbd.c
 void kbdintr(void);
@@ -78,6 +90,7 @@ void cmostime(struct rtcdate *r);
 int lapicid(void);
 extern volatile uint *lapic;
 void lapiceoi(void);
+void lapicipi(int, int);
 void lapicinit(void);
 void lapicstartap(uchar, uint);
 void microdelay(int);
@@ -101,6 +114,7 @@ int pipealloc(struct file **, struct file **);
 void pipeclose(struct pipe *, int);
 int piperead(struct pipe *, char *, int);
 int pipewrite(struct pipe *, char *, int);
+void pipeinit(void);
 
 // PAGEBREAK: 16
 //  proc.c
@@ -120,12 +134,28 @@ void sleep(void *, struct spinlock *);
 void userinit(void);
 int wait(void);
 void wakeup(void *);
+void wakeproc(struct proc *, void *);
+int wakeup_n(void *, int);
+void inherit_priority(struct proc *, struct proc *);
+void restore_priority(struct proc *);
 void yield(void);
 int change_queue(int, int);
-int set_bjf_params_for_process(int, float, float, float, float);
-void set_bjf_params_for_system(float, float, float, float);
+int set_bjf_params_for_process(int, int, int, int, int);
+void set_bjf_params_for_system(int, int, int, int);
 void print_process_info();
 int set_bjf_priority(int, int);
+int set_affinity(int, uint);
+void balance_load(void);
+void update_bjf_rank(struct proc *);
+int setsched(int, int);
+void apply_sched_policy(struct proc *);
+void print_syscall_count(void);
+void reset_syscall_count(void);
+int get_idle_cycles(int, uint64 *);
+int slice_expired(void);
+int set_quantum(int, int);
+void charge_cycles(int);
+int getrusage(int, struct rusage *);
 
 // swtch.S
 void swtch(struct context **, struct context *);
@@ -146,10 +176,30 @@ int holdingsleep(struct sleeplock *);
 void initsleeplock(struct sleeplock *, char *);
 
 // prioritylock.c
-void acquirepriority(struct prioritylock *);
+int acquirepriority(struct prioritylock *);
 void releasepriority(struct prioritylock *);
 void initprioritylock(struct prioritylock *, char *);
 
+// prioritylock_test_util.c
+void plinit(void);
+void pl_fork(struct proc *, struct proc *);
+void pl_detach(struct proc *);
+
+// trace.c
+void initschedtrace(void);
+void trace_sched(int, struct proc *, int);
+int drain_schedtrace(struct trace_event *, int);
+
+// futex.c
+void futexinit(void);
+int futex_wait(uint, int);
+int futex_wake(uint, int);
+
+// slab.c
+void kmem_cache_init(struct kmem_cache *, char *, uint);
+void *kmem_cache_alloc(struct kmem_cache *);
+void kmem_cache_free(struct kmem_cache *, void *);
+
 // string.c
 int memcmp(const void *, const void *, uint);
 void *memmove(void *, const void *, uint);
@@ -160,12 +210,12 @@ int strncmp(const char *, const char *, uint);
 char *strncpy(char *, const char *, int);
 
 // syscall.c
+void syscall_latency(struct syslat *);
 int argint(int, int *);
-int argfloat(int, float *);
+int argfixed(int, int *);
 int argptr(int, char **, int);
 int argstr(int, char **);
 int fetchint(uint, int *);
-int fetchfloat(uint, float *);
 int fetchstr(uint, char **);
 void syscall(void);
 
@@ -194,11 +244,18 @@ void freevm(pde_t *);
 void inituvm(pde_t *, char *, uint);
 int loaduvm(pde_t *, char *, struct inode *, uint, uint);
 pde_t *copyuvm(pde_t *, uint);
+int cowfault(pde_t *, uint);
+int lazyfault(pde_t *, uint, uint);
+int pagefault(struct proc *, uint, uint);
+int uvmprefault(struct proc *, uint, uint, int);
 void switchuvm(struct proc *);
 void switchkvm(void);
 int copyout(pde_t *, uint, void *, uint);
 void clearpteu(pde_t *pgdir, char *uva);
 void shm_init(void);
+int shm_fault(struct proc *, uint);
+int shm_mapped(struct proc *, uint, uint);
+void shm_detach(struct proc *);
 uint *walkpgdir(pde_t *pgdir, const void *va, int alloc);
 int mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm);
 
@@ -0,0 +1,1750 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  for(i = 1; i < argc; i++)
+  14:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  1b:	eb 3c                	jmp    59 <main+0x59>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  20:	83 c0 01             	add    $0x1,%eax
+  23:	39 03                	cmp    %eax,(%ebx)
+  25:	7e 07                	jle    2e <main+0x2e>
+  27:	b9 0b 0c 00 00       	mov    $0xc0b,%ecx
+  2c:	eb 05                	jmp    33 <main+0x33>
+  2e:	b9 0d 0c 00 00       	mov    $0xc0d,%ecx
+  33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  36:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  40:	01 d0                	add    %edx,%eax
+  42:	8b 00                	mov    (%eax),%eax
+  44:	51                   	push   %ecx
+  45:	50                   	push   %eax
+  46:	68 0f 0c 00 00       	push   $0xc0f
+  4b:	6a 01                	push   $0x1
+  4d:	e8 b0 05 00 00       	call   602 <printf>
+  52:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  55:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5c:	3b 03                	cmp    (%ebx),%eax
+  5e:	7c bd                	jl     1d <main+0x1d>
+  exit();
+  60:	e8 31 03 00 00       	call   396 <exit>
+
+00000065 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+  65:	55                   	push   %ebp
+  66:	89 e5                	mov    %esp,%ebp
+  68:	57                   	push   %edi
+  69:	53                   	push   %ebx
+{
+  6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  73:	89 cb                	mov    %ecx,%ebx
+  75:	89 df                	mov    %ebx,%edi
+  77:	89 d1                	mov    %edx,%ecx
+  79:	fc                   	cld
+  7a:	f3 aa                	rep stos %al,%es:(%edi)
+  7c:	89 ca                	mov    %ecx,%edx
+  7e:	89 fb                	mov    %edi,%ebx
+  80:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  83:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+  86:	90                   	nop
+  87:	5b                   	pop    %ebx
+  88:	5f                   	pop    %edi
+  89:	5d                   	pop    %ebp
+  8a:	c3                   	ret
+
+0000008b <strcpy>:
+{
+  8b:	55                   	push   %ebp
+  8c:	89 e5                	mov    %esp,%ebp
+  8e:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  91:	8b 45 08             	mov    0x8(%ebp),%eax
+  94:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  97:	90                   	nop
+  98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  9b:	8d 42 01             	lea    0x1(%edx),%eax
+  9e:	89 45 0c             	mov    %eax,0xc(%ebp)
+  a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  a4:	8d 48 01             	lea    0x1(%eax),%ecx
+  a7:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  aa:	0f b6 12             	movzbl (%edx),%edx
+  ad:	88 10                	mov    %dl,(%eax)
+  af:	0f b6 00             	movzbl (%eax),%eax
+  b2:	84 c0                	test   %al,%al
+  b4:	75 e2                	jne    98 <strcpy+0xd>
+  return os;
+  b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  b9:	c9                   	leave
+  ba:	c3                   	ret
+
+000000bb <strcmp>:
+{
+  bb:	55                   	push   %ebp
+  bc:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  be:	eb 08                	jmp    c8 <strcmp+0xd>
+    p++, q++;
+  c0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  c4:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  cb:	0f b6 00             	movzbl (%eax),%eax
+  ce:	84 c0                	test   %al,%al
+  d0:	74 10                	je     e2 <strcmp+0x27>
+  d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  d5:	0f b6 10             	movzbl (%eax),%edx
+  d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  db:	0f b6 00             	movzbl (%eax),%eax
+  de:	38 c2                	cmp    %al,%dl
+  e0:	74 de                	je     c0 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  e5:	0f b6 00             	movzbl (%eax),%eax
+  e8:	0f b6 d0             	movzbl %al,%edx
+  eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ee:	0f b6 00             	movzbl (%eax),%eax
+  f1:	0f b6 c0             	movzbl %al,%eax
+  f4:	29 c2                	sub    %eax,%edx
+  f6:	89 d0                	mov    %edx,%eax
+}
+  f8:	5d                   	pop    %ebp
+  f9:	c3                   	ret
+
+000000fa <strlen>:
+{
+  fa:	55                   	push   %ebp
+  fb:	89 e5                	mov    %esp,%ebp
+  fd:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 100:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 107:	eb 04                	jmp    10d <strlen+0x13>
+ 109:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 10d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	01 d0                	add    %edx,%eax
+ 115:	0f b6 00             	movzbl (%eax),%eax
+ 118:	84 c0                	test   %al,%al
+ 11a:	75 ed                	jne    109 <strlen+0xf>
+  return n;
+ 11c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 11f:	c9                   	leave
+ 120:	c3                   	ret
+
+00000121 <memset>:
+{
+ 121:	55                   	push   %ebp
+ 122:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 124:	8b 45 10             	mov    0x10(%ebp),%eax
+ 127:	50                   	push   %eax
+ 128:	ff 75 0c             	push   0xc(%ebp)
+ 12b:	ff 75 08             	push   0x8(%ebp)
+ 12e:	e8 32 ff ff ff       	call   65 <stosb>
+ 133:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 136:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 139:	c9                   	leave
+ 13a:	c3                   	ret
+
+0000013b <strchr>:
+{
+ 13b:	55                   	push   %ebp
+ 13c:	89 e5                	mov    %esp,%ebp
+ 13e:	83 ec 04             	sub    $0x4,%esp
+ 141:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 144:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 147:	eb 14                	jmp    15d <strchr+0x22>
+    if(*s == c)
+ 149:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14c:	0f b6 00             	movzbl (%eax),%eax
+ 14f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 152:	75 05                	jne    159 <strchr+0x1e>
+      return (char*)s;
+ 154:	8b 45 08             	mov    0x8(%ebp),%eax
+ 157:	eb 13                	jmp    16c <strchr+0x31>
+  for(; *s; s++)
+ 159:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 15d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 160:	0f b6 00             	movzbl (%eax),%eax
+ 163:	84 c0                	test   %al,%al
+ 165:	75 e2                	jne    149 <strchr+0xe>
+  return 0;
+ 167:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 16c:	c9                   	leave
+ 16d:	c3                   	ret
+
+0000016e <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 16e:	55                   	push   %ebp
+ 16f:	89 e5                	mov    %esp,%ebp
+ 171:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 174:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 17b:	eb 42                	jmp    1bf <gets+0x51>
+    cc = read(0, &c, 1);
+ 17d:	83 ec 04             	sub    $0x4,%esp
+ 180:	6a 01                	push   $0x1
+ 182:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 185:	50                   	push   %eax
+ 186:	6a 00                	push   $0x0
+ 188:	e8 21 02 00 00       	call   3ae <read>
+ 18d:	83 c4 10             	add    $0x10,%esp
+ 190:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 193:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 197:	7e 33                	jle    1cc <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 19c:	8d 50 01             	lea    0x1(%eax),%edx
+ 19f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1a2:	89 c2                	mov    %eax,%edx
+ 1a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a7:	01 c2                	add    %eax,%edx
+ 1a9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ad:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1af:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1b3:	3c 0a                	cmp    $0xa,%al
+ 1b5:	74 16                	je     1cd <gets+0x5f>
+ 1b7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bb:	3c 0d                	cmp    $0xd,%al
+ 1bd:	74 0e                	je     1cd <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c2:	83 c0 01             	add    $0x1,%eax
+ 1c5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1c8:	7f b3                	jg     17d <gets+0xf>
+ 1ca:	eb 01                	jmp    1cd <gets+0x5f>
+      break;
+ 1cc:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d3:	01 d0                	add    %edx,%eax
+ 1d5:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1d8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1db:	c9                   	leave
+ 1dc:	c3                   	ret
+
+000001dd <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1dd:	55                   	push   %ebp
+ 1de:	89 e5                	mov    %esp,%ebp
+ 1e0:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e3:	83 ec 08             	sub    $0x8,%esp
+ 1e6:	6a 00                	push   $0x0
+ 1e8:	ff 75 08             	push   0x8(%ebp)
+ 1eb:	e8 e6 01 00 00       	call   3d6 <open>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+ 1f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1f6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1fa:	79 07                	jns    203 <stat+0x26>
+    return -1;
+ 1fc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 201:	eb 25                	jmp    228 <stat+0x4b>
+  r = fstat(fd, st);
+ 203:	83 ec 08             	sub    $0x8,%esp
+ 206:	ff 75 0c             	push   0xc(%ebp)
+ 209:	ff 75 f4             	push   -0xc(%ebp)
+ 20c:	e8 dd 01 00 00       	call   3ee <fstat>
+ 211:	83 c4 10             	add    $0x10,%esp
+ 214:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 217:	83 ec 0c             	sub    $0xc,%esp
+ 21a:	ff 75 f4             	push   -0xc(%ebp)
+ 21d:	e8 9c 01 00 00       	call   3be <close>
+ 222:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 225:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 228:	c9                   	leave
+ 229:	c3                   	ret
+
+0000022a <atoi>:
+
+int
+atoi(const char *s)
+{
+ 22a:	55                   	push   %ebp
+ 22b:	89 e5                	mov    %esp,%ebp
+ 22d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 230:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 237:	eb 25                	jmp    25e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 239:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 23c:	89 d0                	mov    %edx,%eax
+ 23e:	c1 e0 02             	shl    $0x2,%eax
+ 241:	01 d0                	add    %edx,%eax
+ 243:	01 c0                	add    %eax,%eax
+ 245:	89 c1                	mov    %eax,%ecx
+ 247:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24a:	8d 50 01             	lea    0x1(%eax),%edx
+ 24d:	89 55 08             	mov    %edx,0x8(%ebp)
+ 250:	0f b6 00             	movzbl (%eax),%eax
+ 253:	0f be c0             	movsbl %al,%eax
+ 256:	01 c8                	add    %ecx,%eax
+ 258:	83 e8 30             	sub    $0x30,%eax
+ 25b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 25e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 261:	0f b6 00             	movzbl (%eax),%eax
+ 264:	3c 2f                	cmp    $0x2f,%al
+ 266:	7e 0a                	jle    272 <atoi+0x48>
+ 268:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26b:	0f b6 00             	movzbl (%eax),%eax
+ 26e:	3c 39                	cmp    $0x39,%al
+ 270:	7e c7                	jle    239 <atoi+0xf>
+  return n;
+ 272:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 275:	c9                   	leave
+ 276:	c3                   	ret
+
+00000277 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 277:	55                   	push   %ebp
+ 278:	89 e5                	mov    %esp,%ebp
+ 27a:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 27d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 280:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 283:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 286:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 289:	eb 17                	jmp    2a2 <memmove+0x2b>
+    *dst++ = *src++;
+ 28b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 28e:	8d 42 01             	lea    0x1(%edx),%eax
+ 291:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 294:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 297:	8d 48 01             	lea    0x1(%eax),%ecx
+ 29a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 29d:	0f b6 12             	movzbl (%edx),%edx
+ 2a0:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2a2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2a5:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2a8:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2ab:	85 c0                	test   %eax,%eax
+ 2ad:	7f dc                	jg     28b <memmove+0x14>
+  return vdst;
+ 2af:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2b2:	c9                   	leave
+ 2b3:	c3                   	ret
+
+000002b4 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 2b4:	55                   	push   %ebp
+ 2b5:	89 e5                	mov    %esp,%ebp
+ 2b7:	57                   	push   %edi
+ 2b8:	56                   	push   %esi
+ 2b9:	83 ec 30             	sub    $0x30,%esp
+ 2bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2bf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 2c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2c5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 2c8:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 2cf:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 2d6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2d9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 2dc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 2df:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 2e2:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 2e9:	e9 89 00 00 00       	jmp    377 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 2ee:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2f1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 2f4:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 2f8:	01 c0                	add    %eax,%eax
+ 2fa:	89 c6                	mov    %eax,%esi
+ 2fc:	89 d7                	mov    %edx,%edi
+ 2fe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 301:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 304:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 307:	0f ad d0             	shrd   %cl,%edx,%eax
+ 30a:	d3 ea                	shr    %cl,%edx
+ 30c:	f6 c1 20             	test   $0x20,%cl
+ 30f:	74 04                	je     315 <udiv64+0x61>
+ 311:	89 d0                	mov    %edx,%eax
+ 313:	31 d2                	xor    %edx,%edx
+ 315:	83 e0 01             	and    $0x1,%eax
+ 318:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 31b:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 322:	89 f0                	mov    %esi,%eax
+ 324:	89 fa                	mov    %edi,%edx
+ 326:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 329:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 32c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 32f:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 332:	8b 45 10             	mov    0x10(%ebp),%eax
+ 335:	ba 00 00 00 00       	mov    $0x0,%edx
+ 33a:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 33d:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 340:	19 d1                	sbb    %edx,%ecx
+ 342:	72 2f                	jb     373 <udiv64+0xbf>
+      r -= d;
+ 344:	8b 45 10             	mov    0x10(%ebp),%eax
+ 347:	ba 00 00 00 00       	mov    $0x0,%edx
+ 34c:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 34f:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 352:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 355:	b8 01 00 00 00       	mov    $0x1,%eax
+ 35a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 35f:	0f a5 c2             	shld   %cl,%eax,%edx
+ 362:	d3 e0                	shl    %cl,%eax
+ 364:	f6 c1 20             	test   $0x20,%cl
+ 367:	74 04                	je     36d <udiv64+0xb9>
+ 369:	89 c2                	mov    %eax,%edx
+ 36b:	31 c0                	xor    %eax,%eax
+ 36d:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 370:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 373:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 377:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 37b:	0f 89 6d ff ff ff    	jns    2ee <udiv64+0x3a>
+    }
+  }
+  return q;
+ 381:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 384:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 387:	83 c4 30             	add    $0x30,%esp
+ 38a:	5e                   	pop    %esi
+ 38b:	5f                   	pop    %edi
+ 38c:	5d                   	pop    %ebp
+ 38d:	c3                   	ret
+
+0000038e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 38e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <exit>:
+SYSCALL(exit)
+ 396:	b8 02 00 00 00       	mov    $0x2,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <wait>:
+SYSCALL(wait)
+ 39e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <pipe>:
+SYSCALL(pipe)
+ 3a6:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <read>:
+SYSCALL(read)
+ 3ae:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <write>:
+SYSCALL(write)
+ 3b6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <close>:
+SYSCALL(close)
+ 3be:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <kill>:
+SYSCALL(kill)
+ 3c6:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3cb:	cd 40                	int    $0x40
+ 3cd:	c3                   	ret
+
+000003ce <exec>:
+SYSCALL(exec)
+ 3ce:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3d3:	cd 40                	int    $0x40
+ 3d5:	c3                   	ret
+
+000003d6 <open>:
+SYSCALL(open)
+ 3d6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3db:	cd 40                	int    $0x40
+ 3dd:	c3                   	ret
+
+000003de <mknod>:
+SYSCALL(mknod)
+ 3de:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3e3:	cd 40                	int    $0x40
+ 3e5:	c3                   	ret
+
+000003e6 <unlink>:
+SYSCALL(unlink)
+ 3e6:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3eb:	cd 40                	int    $0x40
+ 3ed:	c3                   	ret
+
+000003ee <fstat>:
+SYSCALL(fstat)
+ 3ee:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3f3:	cd 40                	int    $0x40
+ 3f5:	c3                   	ret
+
+000003f6 <link>:
+SYSCALL(link)
+ 3f6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3fb:	cd 40                	int    $0x40
+ 3fd:	c3                   	ret
+
+000003fe <mkdir>:
+SYSCALL(mkdir)
+ 3fe:	b8 14 00 00 00       	mov    $0x14,%eax
+ 403:	cd 40                	int    $0x40
+ 405:	c3                   	ret
+
+00000406 <chdir>:
+SYSCALL(chdir)
+ 406:	b8 09 00 00 00       	mov    $0x9,%eax
+ 40b:	cd 40                	int    $0x40
+ 40d:	c3                   	ret
+
+0000040e <dup>:
+SYSCALL(dup)
+ 40e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 413:	cd 40                	int    $0x40
+ 415:	c3                   	ret
+
+00000416 <getpid>:
+SYSCALL(getpid)
+ 416:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 41b:	cd 40                	int    $0x40
+ 41d:	c3                   	ret
+
+0000041e <sbrk>:
+SYSCALL(sbrk)
+ 41e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 423:	cd 40                	int    $0x40
+ 425:	c3                   	ret
+
+00000426 <sleep>:
+SYSCALL(sleep)
+ 426:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 42b:	cd 40                	int    $0x40
+ 42d:	c3                   	ret
+
+0000042e <uptime>:
+SYSCALL(uptime)
+ 42e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 433:	cd 40                	int    $0x40
+ 435:	c3                   	ret
+
+00000436 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 436:	b8 16 00 00 00       	mov    $0x16,%eax
+ 43b:	cd 40                	int    $0x40
+ 43d:	c3                   	ret
+
+0000043e <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 43e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 443:	cd 40                	int    $0x40
+ 445:	c3                   	ret
+
+00000446 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 446:	b8 18 00 00 00       	mov    $0x18,%eax
+ 44b:	cd 40                	int    $0x40
+ 44d:	c3                   	ret
+
+0000044e <copy_file>:
+SYSCALL(copy_file)
+ 44e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 453:	cd 40                	int    $0x40
+ 455:	c3                   	ret
+
+00000456 <change_queue>:
+SYSCALL(change_queue)
+ 456:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 45b:	cd 40                	int    $0x40
+ 45d:	c3                   	ret
+
+0000045e <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 45e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 463:	cd 40                	int    $0x40
+ 465:	c3                   	ret
+
+00000466 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 466:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 46b:	cd 40                	int    $0x40
+ 46d:	c3                   	ret
+
+0000046e <print_process_info>:
+SYSCALL(print_process_info)
+ 46e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 473:	cd 40                	int    $0x40
+ 475:	c3                   	ret
+
+00000476 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 476:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 47b:	cd 40                	int    $0x40
+ 47d:	c3                   	ret
+
+0000047e <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 47e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 483:	cd 40                	int    $0x40
+ 485:	c3                   	ret
+
+00000486 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 486:	b8 20 00 00 00       	mov    $0x20,%eax
+ 48b:	cd 40                	int    $0x40
+ 48d:	c3                   	ret
+
+0000048e <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 48e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 493:	cd 40                	int    $0x40
+ 495:	c3                   	ret
+
+00000496 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 496:	b8 22 00 00 00       	mov    $0x22,%eax
+ 49b:	cd 40                	int    $0x40
+ 49d:	c3                   	ret
+
+0000049e <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 49e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4a3:	cd 40                	int    $0x40
+ 4a5:	c3                   	ret
+
+000004a6 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 4a6:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4ab:	cd 40                	int    $0x40
+ 4ad:	c3                   	ret
+
+000004ae <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 4ae:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4b3:	cd 40                	int    $0x40
+ 4b5:	c3                   	ret
+
+000004b6 <set_affinity>:
+SYSCALL(set_affinity)
+ 4b6:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4bb:	cd 40                	int    $0x40
+ 4bd:	c3                   	ret
+
+000004be <setsched>:
+SYSCALL(setsched)
+ 4be:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4c3:	cd 40                	int    $0x40
+ 4c5:	c3                   	ret
+
+000004c6 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 4c6:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4cb:	cd 40                	int    $0x40
+ 4cd:	c3                   	ret
+
+000004ce <set_quantum>:
+SYSCALL(set_quantum)
+ 4ce:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4d3:	cd 40                	int    $0x40
+ 4d5:	c3                   	ret
+
+000004d6 <schedtrace>:
+SYSCALL(schedtrace)
+ 4d6:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4db:	cd 40                	int    $0x40
+ 4dd:	c3                   	ret
+
+000004de <getrusage>:
+SYSCALL(getrusage)
+ 4de:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4e3:	cd 40                	int    $0x40
+ 4e5:	c3                   	ret
+
+000004e6 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 4e6:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4eb:	cd 40                	int    $0x40
+ 4ed:	c3                   	ret
+
+000004ee <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 4ee:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4f3:	cd 40                	int    $0x40
+ 4f5:	c3                   	ret
+
+000004f6 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 4f6:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4fb:	cd 40                	int    $0x40
+ 4fd:	c3                   	ret
+
+000004fe <futex_wait>:
+SYSCALL(futex_wait)
+ 4fe:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 503:	cd 40                	int    $0x40
+ 505:	c3                   	ret
+
+00000506 <futex_wake>:
+SYSCALL(futex_wake)
+ 506:	b8 30 00 00 00       	mov    $0x30,%eax
+ 50b:	cd 40                	int    $0x40
+ 50d:	c3                   	ret
+
+0000050e <syscall_latency>:
+SYSCALL(syscall_latency)
+ 50e:	b8 31 00 00 00       	mov    $0x31,%eax
+ 513:	cd 40                	int    $0x40
+ 515:	c3                   	ret
+
+00000516 <submit_batch>:
+SYSCALL(submit_batch)
+ 516:	b8 32 00 00 00       	mov    $0x32,%eax
+ 51b:	cd 40                	int    $0x40
+ 51d:	c3                   	ret
+
+0000051e <kmem_stats>:
+SYSCALL(kmem_stats)
+ 51e:	b8 33 00 00 00       	mov    $0x33,%eax
+ 523:	cd 40                	int    $0x40
+ 525:	c3                   	ret
+
+00000526 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 526:	b8 34 00 00 00       	mov    $0x34,%eax
+ 52b:	cd 40                	int    $0x40
+ 52d:	c3                   	ret
+
+0000052e <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 52e:	55                   	push   %ebp
+ 52f:	89 e5                	mov    %esp,%ebp
+ 531:	83 ec 18             	sub    $0x18,%esp
+ 534:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 537:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 53a:	83 ec 04             	sub    $0x4,%esp
+ 53d:	6a 01                	push   $0x1
+ 53f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 542:	50                   	push   %eax
+ 543:	ff 75 08             	push   0x8(%ebp)
+ 546:	e8 6b fe ff ff       	call   3b6 <write>
+ 54b:	83 c4 10             	add    $0x10,%esp
+}
+ 54e:	90                   	nop
+ 54f:	c9                   	leave
+ 550:	c3                   	ret
+
+00000551 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 551:	55                   	push   %ebp
+ 552:	89 e5                	mov    %esp,%ebp
+ 554:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 557:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 55e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 562:	74 17                	je     57b <printint+0x2a>
+ 564:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 568:	79 11                	jns    57b <printint+0x2a>
+    neg = 1;
+ 56a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 571:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 574:	f7 d8                	neg    %eax
+ 576:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 579:	eb 06                	jmp    581 <printint+0x30>
+  } else {
+    x = xx;
+ 57b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 57e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 581:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 588:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 58b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 58e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 593:	f7 f1                	div    %ecx
+ 595:	89 d1                	mov    %edx,%ecx
+ 597:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 59a:	8d 50 01             	lea    0x1(%eax),%edx
+ 59d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5a0:	0f b6 91 0c 10 00 00 	movzbl 0x100c(%ecx),%edx
+ 5a7:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5ab:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5ae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5b1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5b6:	f7 f1                	div    %ecx
+ 5b8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5bb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5bf:	75 c7                	jne    588 <printint+0x37>
+  if(neg)
+ 5c1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5c5:	74 2d                	je     5f4 <printint+0xa3>
+    buf[i++] = '-';
+ 5c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5ca:	8d 50 01             	lea    0x1(%eax),%edx
+ 5cd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5d0:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5d5:	eb 1d                	jmp    5f4 <printint+0xa3>
+    putc(fd, buf[i]);
+ 5d7:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5dd:	01 d0                	add    %edx,%eax
+ 5df:	0f b6 00             	movzbl (%eax),%eax
+ 5e2:	0f be c0             	movsbl %al,%eax
+ 5e5:	83 ec 08             	sub    $0x8,%esp
+ 5e8:	50                   	push   %eax
+ 5e9:	ff 75 08             	push   0x8(%ebp)
+ 5ec:	e8 3d ff ff ff       	call   52e <putc>
+ 5f1:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 5f4:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 5f8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5fc:	79 d9                	jns    5d7 <printint+0x86>
+}
+ 5fe:	90                   	nop
+ 5ff:	90                   	nop
+ 600:	c9                   	leave
+ 601:	c3                   	ret
+
+00000602 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 602:	55                   	push   %ebp
+ 603:	89 e5                	mov    %esp,%ebp
+ 605:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 608:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 60f:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 612:	83 c0 04             	add    $0x4,%eax
+ 615:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 618:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 61f:	e9 59 01 00 00       	jmp    77d <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 624:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 627:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 62a:	01 d0                	add    %edx,%eax
+ 62c:	0f b6 00             	movzbl (%eax),%eax
+ 62f:	0f be c0             	movsbl %al,%eax
+ 632:	25 ff 00 00 00       	and    $0xff,%eax
+ 637:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 63a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 63e:	75 2c                	jne    66c <printf+0x6a>
+      if(c == '%'){
+ 640:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 644:	75 0c                	jne    652 <printf+0x50>
+        state = '%';
+ 646:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 64d:	e9 27 01 00 00       	jmp    779 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 652:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 655:	0f be c0             	movsbl %al,%eax
+ 658:	83 ec 08             	sub    $0x8,%esp
+ 65b:	50                   	push   %eax
+ 65c:	ff 75 08             	push   0x8(%ebp)
+ 65f:	e8 ca fe ff ff       	call   52e <putc>
+ 664:	83 c4 10             	add    $0x10,%esp
+ 667:	e9 0d 01 00 00       	jmp    779 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 66c:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 670:	0f 85 03 01 00 00    	jne    779 <printf+0x177>
+      if(c == 'd'){
+ 676:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 67a:	75 1e                	jne    69a <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 67c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 67f:	8b 00                	mov    (%eax),%eax
+ 681:	6a 01                	push   $0x1
+ 683:	6a 0a                	push   $0xa
+ 685:	50                   	push   %eax
+ 686:	ff 75 08             	push   0x8(%ebp)
+ 689:	e8 c3 fe ff ff       	call   551 <printint>
+ 68e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 691:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 695:	e9 d8 00 00 00       	jmp    772 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 69a:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 69e:	74 06                	je     6a6 <printf+0xa4>
+ 6a0:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6a4:	75 1e                	jne    6c4 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6a6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6a9:	8b 00                	mov    (%eax),%eax
+ 6ab:	6a 00                	push   $0x0
+ 6ad:	6a 10                	push   $0x10
+ 6af:	50                   	push   %eax
+ 6b0:	ff 75 08             	push   0x8(%ebp)
+ 6b3:	e8 99 fe ff ff       	call   551 <printint>
+ 6b8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6bb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6bf:	e9 ae 00 00 00       	jmp    772 <printf+0x170>
+      } else if(c == 's'){
+ 6c4:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6c8:	75 43                	jne    70d <printf+0x10b>
+        s = (char*)*ap;
+ 6ca:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6cd:	8b 00                	mov    (%eax),%eax
+ 6cf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6d2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6d6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6da:	75 25                	jne    701 <printf+0xff>
+          s = "(null)";
+ 6dc:	c7 45 f4 14 0c 00 00 	movl   $0xc14,-0xc(%ebp)
+        while(*s != 0){
+ 6e3:	eb 1c                	jmp    701 <printf+0xff>
+          putc(fd, *s);
+ 6e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e8:	0f b6 00             	movzbl (%eax),%eax
+ 6eb:	0f be c0             	movsbl %al,%eax
+ 6ee:	83 ec 08             	sub    $0x8,%esp
+ 6f1:	50                   	push   %eax
+ 6f2:	ff 75 08             	push   0x8(%ebp)
+ 6f5:	e8 34 fe ff ff       	call   52e <putc>
+ 6fa:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 6fd:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 701:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 704:	0f b6 00             	movzbl (%eax),%eax
+ 707:	84 c0                	test   %al,%al
+ 709:	75 da                	jne    6e5 <printf+0xe3>
+ 70b:	eb 65                	jmp    772 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 70d:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 711:	75 1d                	jne    730 <printf+0x12e>
+        putc(fd, *ap);
+ 713:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 716:	8b 00                	mov    (%eax),%eax
+ 718:	0f be c0             	movsbl %al,%eax
+ 71b:	83 ec 08             	sub    $0x8,%esp
+ 71e:	50                   	push   %eax
+ 71f:	ff 75 08             	push   0x8(%ebp)
+ 722:	e8 07 fe ff ff       	call   52e <putc>
+ 727:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 72a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 72e:	eb 42                	jmp    772 <printf+0x170>
+      } else if(c == '%'){
+ 730:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 734:	75 17                	jne    74d <printf+0x14b>
+        putc(fd, c);
+ 736:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 739:	0f be c0             	movsbl %al,%eax
+ 73c:	83 ec 08             	sub    $0x8,%esp
+ 73f:	50                   	push   %eax
+ 740:	ff 75 08             	push   0x8(%ebp)
+ 743:	e8 e6 fd ff ff       	call   52e <putc>
+ 748:	83 c4 10             	add    $0x10,%esp
+ 74b:	eb 25                	jmp    772 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 74d:	83 ec 08             	sub    $0x8,%esp
+ 750:	6a 25                	push   $0x25
+ 752:	ff 75 08             	push   0x8(%ebp)
+ 755:	e8 d4 fd ff ff       	call   52e <putc>
+ 75a:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 75d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 760:	0f be c0             	movsbl %al,%eax
+ 763:	83 ec 08             	sub    $0x8,%esp
+ 766:	50                   	push   %eax
+ 767:	ff 75 08             	push   0x8(%ebp)
+ 76a:	e8 bf fd ff ff       	call   52e <putc>
+ 76f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 772:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 779:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 77d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 780:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 783:	01 d0                	add    %edx,%eax
+ 785:	0f b6 00             	movzbl (%eax),%eax
+ 788:	84 c0                	test   %al,%al
+ 78a:	0f 85 94 fe ff ff    	jne    624 <printf+0x22>
+    }
+  }
+}
+ 790:	90                   	nop
+ 791:	90                   	nop
+ 792:	c9                   	leave
+ 793:	c3                   	ret
+
+00000794 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 794:	55                   	push   %ebp
+ 795:	89 e5                	mov    %esp,%ebp
+ 797:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 79a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79d:	83 e8 08             	sub    $0x8,%eax
+ 7a0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7a3:	a1 28 10 00 00       	mov    0x1028,%eax
+ 7a8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7ab:	eb 24                	jmp    7d1 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b0:	8b 00                	mov    (%eax),%eax
+ 7b2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7b5:	72 12                	jb     7c9 <free+0x35>
+ 7b7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ba:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7bd:	72 24                	jb     7e3 <free+0x4f>
+ 7bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7c2:	8b 00                	mov    (%eax),%eax
+ 7c4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7c7:	72 1a                	jb     7e3 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7cc:	8b 00                	mov    (%eax),%eax
+ 7ce:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7d1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7d4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7d7:	73 d4                	jae    7ad <free+0x19>
+ 7d9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7dc:	8b 00                	mov    (%eax),%eax
+ 7de:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7e1:	73 ca                	jae    7ad <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7e3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7e6:	8b 40 04             	mov    0x4(%eax),%eax
+ 7e9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7f0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f3:	01 c2                	add    %eax,%edx
+ 7f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f8:	8b 00                	mov    (%eax),%eax
+ 7fa:	39 c2                	cmp    %eax,%edx
+ 7fc:	75 24                	jne    822 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 7fe:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 801:	8b 50 04             	mov    0x4(%eax),%edx
+ 804:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 807:	8b 00                	mov    (%eax),%eax
+ 809:	8b 40 04             	mov    0x4(%eax),%eax
+ 80c:	01 c2                	add    %eax,%edx
+ 80e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 811:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 814:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 817:	8b 00                	mov    (%eax),%eax
+ 819:	8b 10                	mov    (%eax),%edx
+ 81b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 81e:	89 10                	mov    %edx,(%eax)
+ 820:	eb 0a                	jmp    82c <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 822:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 825:	8b 10                	mov    (%eax),%edx
+ 827:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 82a:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 82c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 82f:	8b 40 04             	mov    0x4(%eax),%eax
+ 832:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 839:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83c:	01 d0                	add    %edx,%eax
+ 83e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 841:	75 20                	jne    863 <free+0xcf>
+    p->s.size += bp->s.size;
+ 843:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 846:	8b 50 04             	mov    0x4(%eax),%edx
+ 849:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 84c:	8b 40 04             	mov    0x4(%eax),%eax
+ 84f:	01 c2                	add    %eax,%edx
+ 851:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 854:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 857:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 85a:	8b 10                	mov    (%eax),%edx
+ 85c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 85f:	89 10                	mov    %edx,(%eax)
+ 861:	eb 08                	jmp    86b <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 863:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 866:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 869:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 86b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86e:	a3 28 10 00 00       	mov    %eax,0x1028
+}
+ 873:	90                   	nop
+ 874:	c9                   	leave
+ 875:	c3                   	ret
+
+00000876 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 876:	55                   	push   %ebp
+ 877:	89 e5                	mov    %esp,%ebp
+ 879:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 87c:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 883:	77 07                	ja     88c <morecore+0x16>
+    nu = 4096;
+ 885:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 88c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 88f:	c1 e0 03             	shl    $0x3,%eax
+ 892:	83 ec 0c             	sub    $0xc,%esp
+ 895:	50                   	push   %eax
+ 896:	e8 83 fb ff ff       	call   41e <sbrk>
+ 89b:	83 c4 10             	add    $0x10,%esp
+ 89e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 8a1:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8a5:	75 07                	jne    8ae <morecore+0x38>
+    return 0;
+ 8a7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8ac:	eb 26                	jmp    8d4 <morecore+0x5e>
+  hp = (Header*)p;
+ 8ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 8b4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8b7:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8ba:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8bd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8c0:	83 c0 08             	add    $0x8,%eax
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	50                   	push   %eax
+ 8c7:	e8 c8 fe ff ff       	call   794 <free>
+ 8cc:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 8cf:	a1 28 10 00 00       	mov    0x1028,%eax
+}
+ 8d4:	c9                   	leave
+ 8d5:	c3                   	ret
+
+000008d6 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8d6:	55                   	push   %ebp
+ 8d7:	89 e5                	mov    %esp,%ebp
+ 8d9:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8df:	83 c0 07             	add    $0x7,%eax
+ 8e2:	c1 e8 03             	shr    $0x3,%eax
+ 8e5:	83 c0 01             	add    $0x1,%eax
+ 8e8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 8eb:	a1 28 10 00 00       	mov    0x1028,%eax
+ 8f0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8f3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8f7:	75 23                	jne    91c <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 8f9:	c7 45 f0 20 10 00 00 	movl   $0x1020,-0x10(%ebp)
+ 900:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 903:	a3 28 10 00 00       	mov    %eax,0x1028
+ 908:	a1 28 10 00 00       	mov    0x1028,%eax
+ 90d:	a3 20 10 00 00       	mov    %eax,0x1020
+    base.s.size = 0;
+ 912:	c7 05 24 10 00 00 00 	movl   $0x0,0x1024
+ 919:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 91c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 91f:	8b 00                	mov    (%eax),%eax
+ 921:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 924:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 927:	8b 40 04             	mov    0x4(%eax),%eax
+ 92a:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 92d:	72 4d                	jb     97c <malloc+0xa6>
+      if(p->s.size == nunits)
+ 92f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 932:	8b 40 04             	mov    0x4(%eax),%eax
+ 935:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 938:	75 0c                	jne    946 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 93a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 93d:	8b 10                	mov    (%eax),%edx
+ 93f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 942:	89 10                	mov    %edx,(%eax)
+ 944:	eb 26                	jmp    96c <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 946:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 949:	8b 40 04             	mov    0x4(%eax),%eax
+ 94c:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 94f:	89 c2                	mov    %eax,%edx
+ 951:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 954:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 957:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 95a:	8b 40 04             	mov    0x4(%eax),%eax
+ 95d:	c1 e0 03             	shl    $0x3,%eax
+ 960:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 963:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 966:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 969:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 96c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 96f:	a3 28 10 00 00       	mov    %eax,0x1028
+      return (void*)(p + 1);
+ 974:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 977:	83 c0 08             	add    $0x8,%eax
+ 97a:	eb 3b                	jmp    9b7 <malloc+0xe1>
+    }
+    if(p == freep)
+ 97c:	a1 28 10 00 00       	mov    0x1028,%eax
+ 981:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 984:	75 1e                	jne    9a4 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 986:	83 ec 0c             	sub    $0xc,%esp
+ 989:	ff 75 ec             	push   -0x14(%ebp)
+ 98c:	e8 e5 fe ff ff       	call   876 <morecore>
+ 991:	83 c4 10             	add    $0x10,%esp
+ 994:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 997:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 99b:	75 07                	jne    9a4 <malloc+0xce>
+        return 0;
+ 99d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9a2:	eb 13                	jmp    9b7 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ad:	8b 00                	mov    (%eax),%eax
+ 9af:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9b2:	e9 6d ff ff ff       	jmp    924 <malloc+0x4e>
+  }
+}
+ 9b7:	c9                   	leave
+ 9b8:	c3                   	ret
+
+000009b9 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ 9b9:	55                   	push   %ebp
+ 9ba:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 9bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9bf:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 9c5:	90                   	nop
+ 9c6:	5d                   	pop    %ebp
+ 9c7:	c3                   	ret
+
+000009c8 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 9c8:	55                   	push   %ebp
+ 9c9:	89 e5                	mov    %esp,%ebp
+ 9cb:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 9ce:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9d1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9d6:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 9db:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ 9df:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9e2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9e6:	74 3b                	je     a23 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ 9e8:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 9ec:	74 2d                	je     a1b <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ 9ee:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9f1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 9f6:	87 02                	xchg   %eax,(%edx)
+ 9f8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 9fb:	eb 1e                	jmp    a1b <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ 9fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ a00:	83 ec 08             	sub    $0x8,%esp
+ a03:	6a 02                	push   $0x2
+ a05:	50                   	push   %eax
+ a06:	e8 f3 fa ff ff       	call   4fe <futex_wait>
+ a0b:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a0e:	8b 55 08             	mov    0x8(%ebp),%edx
+ a11:	b8 02 00 00 00       	mov    $0x2,%eax
+ a16:	87 02                	xchg   %eax,(%edx)
+ a18:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a1b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a1f:	75 dc                	jne    9fd <mutex_lock+0x35>
+ a21:	eb 01                	jmp    a24 <mutex_lock+0x5c>
+    return;
+ a23:	90                   	nop
+  }
+}
+ a24:	c9                   	leave
+ a25:	c3                   	ret
+
+00000a26 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ a26:	55                   	push   %ebp
+ a27:	89 e5                	mov    %esp,%ebp
+ a29:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ a2c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a2f:	ba 01 00 00 00       	mov    $0x1,%edx
+ a34:	f7 da                	neg    %edx
+ a36:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ a3a:	83 fa 01             	cmp    $0x1,%edx
+ a3d:	74 1a                	je     a59 <mutex_unlock+0x33>
+    m->state = 0;
+ a3f:	8b 45 08             	mov    0x8(%ebp),%eax
+ a42:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ a48:	8b 45 08             	mov    0x8(%ebp),%eax
+ a4b:	83 ec 08             	sub    $0x8,%esp
+ a4e:	6a 01                	push   $0x1
+ a50:	50                   	push   %eax
+ a51:	e8 b0 fa ff ff       	call   506 <futex_wake>
+ a56:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ a59:	90                   	nop
+ a5a:	c9                   	leave
+ a5b:	c3                   	ret
+
+00000a5c <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ a5c:	55                   	push   %ebp
+ a5d:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ a5f:	8b 45 08             	mov    0x8(%ebp),%eax
+ a62:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ a68:	8b 45 08             	mov    0x8(%ebp),%eax
+ a6b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ a72:	90                   	nop
+ a73:	5d                   	pop    %ebp
+ a74:	c3                   	ret
+
+00000a75 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ a75:	55                   	push   %ebp
+ a76:	89 e5                	mov    %esp,%ebp
+ a78:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ a7b:	8b 45 08             	mov    0x8(%ebp),%eax
+ a7e:	83 c0 04             	add    $0x4,%eax
+ a81:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ a85:	8b 45 08             	mov    0x8(%ebp),%eax
+ a88:	83 ec 08             	sub    $0x8,%esp
+ a8b:	ff 75 0c             	push   0xc(%ebp)
+ a8e:	50                   	push   %eax
+ a8f:	e8 6a fa ff ff       	call   4fe <futex_wait>
+ a94:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ a97:	8b 45 08             	mov    0x8(%ebp),%eax
+ a9a:	83 c0 04             	add    $0x4,%eax
+ a9d:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ aa1:	90                   	nop
+ aa2:	c9                   	leave
+ aa3:	c3                   	ret
+
+00000aa4 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ aa4:	55                   	push   %ebp
+ aa5:	89 e5                	mov    %esp,%ebp
+ aa7:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ aaa:	8b 45 08             	mov    0x8(%ebp),%eax
+ aad:	8b 00                	mov    (%eax),%eax
+ aaf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ ab2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ab6:	78 17                	js     acf <rwlock_rdlock+0x2b>
+ ab8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ abb:	83 c0 01             	add    $0x1,%eax
+ abe:	89 c1                	mov    %eax,%ecx
+ ac0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac3:	8b 55 08             	mov    0x8(%ebp),%edx
+ ac6:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ aca:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ acd:	74 19                	je     ae8 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ acf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ad3:	79 d5                	jns    aaa <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ ad5:	83 ec 08             	sub    $0x8,%esp
+ ad8:	ff 75 f4             	push   -0xc(%ebp)
+ adb:	ff 75 08             	push   0x8(%ebp)
+ ade:	e8 92 ff ff ff       	call   a75 <rwlock_sleep>
+ ae3:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ ae6:	eb c2                	jmp    aaa <rwlock_rdlock+0x6>
+      return;
+ ae8:	90                   	nop
+  }
+}
+ ae9:	c9                   	leave
+ aea:	c3                   	ret
+
+00000aeb <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ aeb:	55                   	push   %ebp
+ aec:	89 e5                	mov    %esp,%ebp
+ aee:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ af1:	eb 11                	jmp    b04 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ af3:	83 ec 08             	sub    $0x8,%esp
+ af6:	ff 75 f4             	push   -0xc(%ebp)
+ af9:	ff 75 08             	push   0x8(%ebp)
+ afc:	e8 74 ff ff ff       	call   a75 <rwlock_sleep>
+ b01:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b04:	8b 55 08             	mov    0x8(%ebp),%edx
+ b07:	b8 00 00 00 00       	mov    $0x0,%eax
+ b0c:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ b11:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b15:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b18:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b1c:	75 d5                	jne    af3 <rwlock_wrlock+0x8>
+}
+ b1e:	90                   	nop
+ b1f:	90                   	nop
+ b20:	c9                   	leave
+ b21:	c3                   	ret
+
+00000b22 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ b22:	55                   	push   %ebp
+ b23:	89 e5                	mov    %esp,%ebp
+ b25:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ b28:	8b 45 08             	mov    0x8(%ebp),%eax
+ b2b:	8b 00                	mov    (%eax),%eax
+ b2d:	85 c0                	test   %eax,%eax
+ b2f:	79 0c                	jns    b3d <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ b31:	8b 45 08             	mov    0x8(%ebp),%eax
+ b34:	ba 00 00 00 00       	mov    $0x0,%edx
+ b39:	87 10                	xchg   %edx,(%eax)
+ b3b:	eb 18                	jmp    b55 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ b3d:	8b 55 08             	mov    0x8(%ebp),%edx
+ b40:	b8 01 00 00 00       	mov    $0x1,%eax
+ b45:	f7 d8                	neg    %eax
+ b47:	89 c1                	mov    %eax,%ecx
+ b49:	89 c8                	mov    %ecx,%eax
+ b4b:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ b4f:	01 c8                	add    %ecx,%eax
+ b51:	85 c0                	test   %eax,%eax
+ b53:	75 20                	jne    b75 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ b55:	8b 45 08             	mov    0x8(%ebp),%eax
+ b58:	8b 40 04             	mov    0x4(%eax),%eax
+ b5b:	85 c0                	test   %eax,%eax
+ b5d:	74 17                	je     b76 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ b5f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b62:	83 ec 08             	sub    $0x8,%esp
+ b65:	68 ff ff ff 7f       	push   $0x7fffffff
+ b6a:	50                   	push   %eax
+ b6b:	e8 96 f9 ff ff       	call   506 <futex_wake>
+ b70:	83 c4 10             	add    $0x10,%esp
+ b73:	eb 01                	jmp    b76 <rwlock_unlock+0x54>
+    return;
+ b75:	90                   	nop
+}
+ b76:	c9                   	leave
+ b77:	c3                   	ret
+
+00000b78 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ b78:	55                   	push   %ebp
+ b79:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ b7b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b7e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b84:	90                   	nop
+ b85:	5d                   	pop    %ebp
+ b86:	c3                   	ret
+
+00000b87 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ b87:	55                   	push   %ebp
+ b88:	89 e5                	mov    %esp,%ebp
+ b8a:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ b8d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b90:	8b 00                	mov    (%eax),%eax
+ b92:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ b95:	83 ec 0c             	sub    $0xc,%esp
+ b98:	ff 75 0c             	push   0xc(%ebp)
+ b9b:	e8 86 fe ff ff       	call   a26 <mutex_unlock>
+ ba0:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba6:	83 ec 08             	sub    $0x8,%esp
+ ba9:	ff 75 f4             	push   -0xc(%ebp)
+ bac:	50                   	push   %eax
+ bad:	e8 4c f9 ff ff       	call   4fe <futex_wait>
+ bb2:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ bb5:	83 ec 0c             	sub    $0xc,%esp
+ bb8:	ff 75 0c             	push   0xc(%ebp)
+ bbb:	e8 08 fe ff ff       	call   9c8 <mutex_lock>
+ bc0:	83 c4 10             	add    $0x10,%esp
+}
+ bc3:	90                   	nop
+ bc4:	c9                   	leave
+ bc5:	c3                   	ret
+
+00000bc6 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ bc6:	55                   	push   %ebp
+ bc7:	89 e5                	mov    %esp,%ebp
+ bc9:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ bcc:	8b 45 08             	mov    0x8(%ebp),%eax
+ bcf:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd6:	83 ec 08             	sub    $0x8,%esp
+ bd9:	6a 01                	push   $0x1
+ bdb:	50                   	push   %eax
+ bdc:	e8 25 f9 ff ff       	call   506 <futex_wake>
+ be1:	83 c4 10             	add    $0x10,%esp
+}
+ be4:	90                   	nop
+ be5:	c9                   	leave
+ be6:	c3                   	ret
+
+00000be7 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ be7:	55                   	push   %ebp
+ be8:	89 e5                	mov    %esp,%ebp
+ bea:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ bed:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf0:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf7:	83 ec 08             	sub    $0x8,%esp
+ bfa:	68 ff ff ff 7f       	push   $0x7fffffff
+ bff:	50                   	push   %eax
+ c00:	e8 01 f9 ff ff       	call   506 <futex_wake>
+ c05:	83 c4 10             	add    $0x10,%esp
+}
+ c08:	90                   	nop
+ c09:	c9                   	leave
+ c0a:	c3                   	ret
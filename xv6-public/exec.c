@@ -92,13 +92,17 @@ exec(char *path, char **argv)
     if(*s == '/')
       last = s+1;
   safestrcpy(curproc->name, last, sizeof(curproc->name));
+  apply_sched_policy(curproc);
 
-  // Commit to the user image.
+  // Commit to the user image. Shared memory is not carried
+  // over; unmap it before freevm() sees it.
+  shm_detach(curproc);
   oldpgdir = curproc->pgdir;
   curproc->pgdir = pgdir;
   curproc->sz = sz;
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
+  update_bjf_rank(curproc);
   switchuvm(curproc);
   freevm(oldpgdir);
   return 0;
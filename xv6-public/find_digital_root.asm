@@ -0,0 +1,1819 @@
+
+_find_digital_root:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <find_digital_root_syscall>:
+
+#define INVALID_INPUT_ERROR "input must be non negative!\n"
+#define FEW_ARGUMANTS_ERROR "few arguements.needed one integer provided zero\n"
+
+int find_digital_root_syscall(int n)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+    int prev_ebx;
+    asm volatile(
+   6:	8b 45 08             	mov    0x8(%ebp),%eax
+   9:	89 d8                	mov    %ebx,%eax
+   b:	89 c3                	mov    %eax,%ebx
+   d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        "movl %%ebx, %0\n\t"
+        "movl %1, %%ebx"
+        : "=r"(prev_ebx)
+        : "r"(n));
+    int result = find_digital_root();
+  10:	e8 94 04 00 00       	call   4a9 <find_digital_root>
+  15:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    asm volatile(
+  18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1b:	89 c3                	mov    %eax,%ebx
+        "movl %0, %%ebx" ::"r"(prev_ebx));
+    return result;
+  1d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+  20:	c9                   	leave
+  21:	c3                   	ret
+
+00000022 <main>:
+
+int main(int argc, char *argv[])
+{
+  22:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  26:	83 e4 f0             	and    $0xfffffff0,%esp
+  29:	ff 71 fc             	push   -0x4(%ecx)
+  2c:	55                   	push   %ebp
+  2d:	89 e5                	mov    %esp,%ebp
+  2f:	51                   	push   %ecx
+  30:	83 ec 14             	sub    $0x14,%esp
+  33:	89 c8                	mov    %ecx,%eax
+    if (argc != 2)
+  35:	83 38 02             	cmpl   $0x2,(%eax)
+  38:	74 17                	je     51 <main+0x2f>
+    {
+        printf(2, FEW_ARGUMANTS_ERROR);
+  3a:	83 ec 08             	sub    $0x8,%esp
+  3d:	68 80 0c 00 00       	push   $0xc80
+  42:	6a 02                	push   $0x2
+  44:	e8 2c 06 00 00       	call   675 <printf>
+  49:	83 c4 10             	add    $0x10,%esp
+        exit();
+  4c:	e8 b8 03 00 00       	call   409 <exit>
+    }
+
+    int n = (*argv[1] == '-') ? -atoi(argv[1] + 1) : atoi(argv[1]);
+  51:	8b 50 04             	mov    0x4(%eax),%edx
+  54:	83 c2 04             	add    $0x4,%edx
+  57:	8b 12                	mov    (%edx),%edx
+  59:	0f b6 12             	movzbl (%edx),%edx
+  5c:	80 fa 2d             	cmp    $0x2d,%dl
+  5f:	75 1b                	jne    7c <main+0x5a>
+  61:	8b 40 04             	mov    0x4(%eax),%eax
+  64:	83 c0 04             	add    $0x4,%eax
+  67:	8b 00                	mov    (%eax),%eax
+  69:	83 c0 01             	add    $0x1,%eax
+  6c:	83 ec 0c             	sub    $0xc,%esp
+  6f:	50                   	push   %eax
+  70:	e8 28 02 00 00       	call   29d <atoi>
+  75:	83 c4 10             	add    $0x10,%esp
+  78:	f7 d8                	neg    %eax
+  7a:	eb 14                	jmp    90 <main+0x6e>
+  7c:	8b 40 04             	mov    0x4(%eax),%eax
+  7f:	83 c0 04             	add    $0x4,%eax
+  82:	8b 00                	mov    (%eax),%eax
+  84:	83 ec 0c             	sub    $0xc,%esp
+  87:	50                   	push   %eax
+  88:	e8 10 02 00 00       	call   29d <atoi>
+  8d:	83 c4 10             	add    $0x10,%esp
+  90:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    int result = find_digital_root_syscall(n);
+  93:	83 ec 0c             	sub    $0xc,%esp
+  96:	ff 75 f4             	push   -0xc(%ebp)
+  99:	e8 62 ff ff ff       	call   0 <find_digital_root_syscall>
+  9e:	83 c4 10             	add    $0x10,%esp
+  a1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if (result == -1)
+  a4:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+  a8:	75 14                	jne    be <main+0x9c>
+    {
+        printf(2, INVALID_INPUT_ERROR);
+  aa:	83 ec 08             	sub    $0x8,%esp
+  ad:	68 b1 0c 00 00       	push   $0xcb1
+  b2:	6a 02                	push   $0x2
+  b4:	e8 bc 05 00 00       	call   675 <printf>
+  b9:	83 c4 10             	add    $0x10,%esp
+  bc:	eb 15                	jmp    d3 <main+0xb1>
+    }
+    else
+    {
+        printf(1, "%d\n", result);
+  be:	83 ec 04             	sub    $0x4,%esp
+  c1:	ff 75 f0             	push   -0x10(%ebp)
+  c4:	68 ce 0c 00 00       	push   $0xcce
+  c9:	6a 01                	push   $0x1
+  cb:	e8 a5 05 00 00       	call   675 <printf>
+  d0:	83 c4 10             	add    $0x10,%esp
+    }
+
+    exit();
+  d3:	e8 31 03 00 00       	call   409 <exit>
+
+000000d8 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+  d8:	55                   	push   %ebp
+  d9:	89 e5                	mov    %esp,%ebp
+  db:	57                   	push   %edi
+  dc:	53                   	push   %ebx
+{
+  dd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e0:	8b 55 10             	mov    0x10(%ebp),%edx
+  e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e6:	89 cb                	mov    %ecx,%ebx
+  e8:	89 df                	mov    %ebx,%edi
+  ea:	89 d1                	mov    %edx,%ecx
+  ec:	fc                   	cld
+  ed:	f3 aa                	rep stos %al,%es:(%edi)
+  ef:	89 ca                	mov    %ecx,%edx
+  f1:	89 fb                	mov    %edi,%ebx
+  f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  f6:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+  f9:	90                   	nop
+  fa:	5b                   	pop    %ebx
+  fb:	5f                   	pop    %edi
+  fc:	5d                   	pop    %ebp
+  fd:	c3                   	ret
+
+000000fe <strcpy>:
+{
+  fe:	55                   	push   %ebp
+  ff:	89 e5                	mov    %esp,%ebp
+ 101:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 104:	8b 45 08             	mov    0x8(%ebp),%eax
+ 107:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 10a:	90                   	nop
+ 10b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 10e:	8d 42 01             	lea    0x1(%edx),%eax
+ 111:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 114:	8b 45 08             	mov    0x8(%ebp),%eax
+ 117:	8d 48 01             	lea    0x1(%eax),%ecx
+ 11a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 11d:	0f b6 12             	movzbl (%edx),%edx
+ 120:	88 10                	mov    %dl,(%eax)
+ 122:	0f b6 00             	movzbl (%eax),%eax
+ 125:	84 c0                	test   %al,%al
+ 127:	75 e2                	jne    10b <strcpy+0xd>
+  return os;
+ 129:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12c:	c9                   	leave
+ 12d:	c3                   	ret
+
+0000012e <strcmp>:
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 131:	eb 08                	jmp    13b <strcmp+0xd>
+    p++, q++;
+ 133:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 137:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 13b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 13e:	0f b6 00             	movzbl (%eax),%eax
+ 141:	84 c0                	test   %al,%al
+ 143:	74 10                	je     155 <strcmp+0x27>
+ 145:	8b 45 08             	mov    0x8(%ebp),%eax
+ 148:	0f b6 10             	movzbl (%eax),%edx
+ 14b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14e:	0f b6 00             	movzbl (%eax),%eax
+ 151:	38 c2                	cmp    %al,%dl
+ 153:	74 de                	je     133 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 155:	8b 45 08             	mov    0x8(%ebp),%eax
+ 158:	0f b6 00             	movzbl (%eax),%eax
+ 15b:	0f b6 d0             	movzbl %al,%edx
+ 15e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 161:	0f b6 00             	movzbl (%eax),%eax
+ 164:	0f b6 c0             	movzbl %al,%eax
+ 167:	29 c2                	sub    %eax,%edx
+ 169:	89 d0                	mov    %edx,%eax
+}
+ 16b:	5d                   	pop    %ebp
+ 16c:	c3                   	ret
+
+0000016d <strlen>:
+{
+ 16d:	55                   	push   %ebp
+ 16e:	89 e5                	mov    %esp,%ebp
+ 170:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 173:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 17a:	eb 04                	jmp    180 <strlen+0x13>
+ 17c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 180:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 183:	8b 45 08             	mov    0x8(%ebp),%eax
+ 186:	01 d0                	add    %edx,%eax
+ 188:	0f b6 00             	movzbl (%eax),%eax
+ 18b:	84 c0                	test   %al,%al
+ 18d:	75 ed                	jne    17c <strlen+0xf>
+  return n;
+ 18f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 192:	c9                   	leave
+ 193:	c3                   	ret
+
+00000194 <memset>:
+{
+ 194:	55                   	push   %ebp
+ 195:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 197:	8b 45 10             	mov    0x10(%ebp),%eax
+ 19a:	50                   	push   %eax
+ 19b:	ff 75 0c             	push   0xc(%ebp)
+ 19e:	ff 75 08             	push   0x8(%ebp)
+ 1a1:	e8 32 ff ff ff       	call   d8 <stosb>
+ 1a6:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1a9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1ac:	c9                   	leave
+ 1ad:	c3                   	ret
+
+000001ae <strchr>:
+{
+ 1ae:	55                   	push   %ebp
+ 1af:	89 e5                	mov    %esp,%ebp
+ 1b1:	83 ec 04             	sub    $0x4,%esp
+ 1b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1b7:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1ba:	eb 14                	jmp    1d0 <strchr+0x22>
+    if(*s == c)
+ 1bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bf:	0f b6 00             	movzbl (%eax),%eax
+ 1c2:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1c5:	75 05                	jne    1cc <strchr+0x1e>
+      return (char*)s;
+ 1c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ca:	eb 13                	jmp    1df <strchr+0x31>
+  for(; *s; s++)
+ 1cc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d3:	0f b6 00             	movzbl (%eax),%eax
+ 1d6:	84 c0                	test   %al,%al
+ 1d8:	75 e2                	jne    1bc <strchr+0xe>
+  return 0;
+ 1da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1df:	c9                   	leave
+ 1e0:	c3                   	ret
+
+000001e1 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1e1:	55                   	push   %ebp
+ 1e2:	89 e5                	mov    %esp,%ebp
+ 1e4:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1e7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1ee:	eb 42                	jmp    232 <gets+0x51>
+    cc = read(0, &c, 1);
+ 1f0:	83 ec 04             	sub    $0x4,%esp
+ 1f3:	6a 01                	push   $0x1
+ 1f5:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1f8:	50                   	push   %eax
+ 1f9:	6a 00                	push   $0x0
+ 1fb:	e8 21 02 00 00       	call   421 <read>
+ 200:	83 c4 10             	add    $0x10,%esp
+ 203:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 206:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 20a:	7e 33                	jle    23f <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 20c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 20f:	8d 50 01             	lea    0x1(%eax),%edx
+ 212:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 215:	89 c2                	mov    %eax,%edx
+ 217:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21a:	01 c2                	add    %eax,%edx
+ 21c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 220:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 222:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 226:	3c 0a                	cmp    $0xa,%al
+ 228:	74 16                	je     240 <gets+0x5f>
+ 22a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 22e:	3c 0d                	cmp    $0xd,%al
+ 230:	74 0e                	je     240 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 232:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 235:	83 c0 01             	add    $0x1,%eax
+ 238:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 23b:	7f b3                	jg     1f0 <gets+0xf>
+ 23d:	eb 01                	jmp    240 <gets+0x5f>
+      break;
+ 23f:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 240:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	01 d0                	add    %edx,%eax
+ 248:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 24b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 24e:	c9                   	leave
+ 24f:	c3                   	ret
+
+00000250 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 256:	83 ec 08             	sub    $0x8,%esp
+ 259:	6a 00                	push   $0x0
+ 25b:	ff 75 08             	push   0x8(%ebp)
+ 25e:	e8 e6 01 00 00       	call   449 <open>
+ 263:	83 c4 10             	add    $0x10,%esp
+ 266:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 269:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 26d:	79 07                	jns    276 <stat+0x26>
+    return -1;
+ 26f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 274:	eb 25                	jmp    29b <stat+0x4b>
+  r = fstat(fd, st);
+ 276:	83 ec 08             	sub    $0x8,%esp
+ 279:	ff 75 0c             	push   0xc(%ebp)
+ 27c:	ff 75 f4             	push   -0xc(%ebp)
+ 27f:	e8 dd 01 00 00       	call   461 <fstat>
+ 284:	83 c4 10             	add    $0x10,%esp
+ 287:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 28a:	83 ec 0c             	sub    $0xc,%esp
+ 28d:	ff 75 f4             	push   -0xc(%ebp)
+ 290:	e8 9c 01 00 00       	call   431 <close>
+ 295:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 298:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 29b:	c9                   	leave
+ 29c:	c3                   	ret
+
+0000029d <atoi>:
+
+int
+atoi(const char *s)
+{
+ 29d:	55                   	push   %ebp
+ 29e:	89 e5                	mov    %esp,%ebp
+ 2a0:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2aa:	eb 25                	jmp    2d1 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2ac:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2af:	89 d0                	mov    %edx,%eax
+ 2b1:	c1 e0 02             	shl    $0x2,%eax
+ 2b4:	01 d0                	add    %edx,%eax
+ 2b6:	01 c0                	add    %eax,%eax
+ 2b8:	89 c1                	mov    %eax,%ecx
+ 2ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2bd:	8d 50 01             	lea    0x1(%eax),%edx
+ 2c0:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2c3:	0f b6 00             	movzbl (%eax),%eax
+ 2c6:	0f be c0             	movsbl %al,%eax
+ 2c9:	01 c8                	add    %ecx,%eax
+ 2cb:	83 e8 30             	sub    $0x30,%eax
+ 2ce:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d4:	0f b6 00             	movzbl (%eax),%eax
+ 2d7:	3c 2f                	cmp    $0x2f,%al
+ 2d9:	7e 0a                	jle    2e5 <atoi+0x48>
+ 2db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2de:	0f b6 00             	movzbl (%eax),%eax
+ 2e1:	3c 39                	cmp    $0x39,%al
+ 2e3:	7e c7                	jle    2ac <atoi+0xf>
+  return n;
+ 2e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2e8:	c9                   	leave
+ 2e9:	c3                   	ret
+
+000002ea <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2ea:	55                   	push   %ebp
+ 2eb:	89 e5                	mov    %esp,%ebp
+ 2ed:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 2f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2f9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2fc:	eb 17                	jmp    315 <memmove+0x2b>
+    *dst++ = *src++;
+ 2fe:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 301:	8d 42 01             	lea    0x1(%edx),%eax
+ 304:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 307:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 30a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 30d:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 310:	0f b6 12             	movzbl (%edx),%edx
+ 313:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 315:	8b 45 10             	mov    0x10(%ebp),%eax
+ 318:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 31b:	89 55 10             	mov    %edx,0x10(%ebp)
+ 31e:	85 c0                	test   %eax,%eax
+ 320:	7f dc                	jg     2fe <memmove+0x14>
+  return vdst;
+ 322:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 325:	c9                   	leave
+ 326:	c3                   	ret
+
+00000327 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 327:	55                   	push   %ebp
+ 328:	89 e5                	mov    %esp,%ebp
+ 32a:	57                   	push   %edi
+ 32b:	56                   	push   %esi
+ 32c:	83 ec 30             	sub    $0x30,%esp
+ 32f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 332:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 335:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 338:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 33b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 342:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 349:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 34c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 34f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 352:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 355:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 35c:	e9 89 00 00 00       	jmp    3ea <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 361:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 364:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 367:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 36b:	01 c0                	add    %eax,%eax
+ 36d:	89 c6                	mov    %eax,%esi
+ 36f:	89 d7                	mov    %edx,%edi
+ 371:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 374:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 377:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 37a:	0f ad d0             	shrd   %cl,%edx,%eax
+ 37d:	d3 ea                	shr    %cl,%edx
+ 37f:	f6 c1 20             	test   $0x20,%cl
+ 382:	74 04                	je     388 <udiv64+0x61>
+ 384:	89 d0                	mov    %edx,%eax
+ 386:	31 d2                	xor    %edx,%edx
+ 388:	83 e0 01             	and    $0x1,%eax
+ 38b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 38e:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 395:	89 f0                	mov    %esi,%eax
+ 397:	89 fa                	mov    %edi,%edx
+ 399:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 39c:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 39f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 3a2:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 3a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3a8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3ad:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 3b0:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 3b3:	19 d1                	sbb    %edx,%ecx
+ 3b5:	72 2f                	jb     3e6 <udiv64+0xbf>
+      r -= d;
+ 3b7:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3ba:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3bf:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 3c2:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 3c5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3c8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3cd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3d2:	0f a5 c2             	shld   %cl,%eax,%edx
+ 3d5:	d3 e0                	shl    %cl,%eax
+ 3d7:	f6 c1 20             	test   $0x20,%cl
+ 3da:	74 04                	je     3e0 <udiv64+0xb9>
+ 3dc:	89 c2                	mov    %eax,%edx
+ 3de:	31 c0                	xor    %eax,%eax
+ 3e0:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 3e3:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3e6:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 3ea:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 3ee:	0f 89 6d ff ff ff    	jns    361 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 3f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 3f7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 3fa:	83 c4 30             	add    $0x30,%esp
+ 3fd:	5e                   	pop    %esi
+ 3fe:	5f                   	pop    %edi
+ 3ff:	5d                   	pop    %ebp
+ 400:	c3                   	ret
+
+00000401 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 401:	b8 01 00 00 00       	mov    $0x1,%eax
+ 406:	cd 40                	int    $0x40
+ 408:	c3                   	ret
+
+00000409 <exit>:
+SYSCALL(exit)
+ 409:	b8 02 00 00 00       	mov    $0x2,%eax
+ 40e:	cd 40                	int    $0x40
+ 410:	c3                   	ret
+
+00000411 <wait>:
+SYSCALL(wait)
+ 411:	b8 03 00 00 00       	mov    $0x3,%eax
+ 416:	cd 40                	int    $0x40
+ 418:	c3                   	ret
+
+00000419 <pipe>:
+SYSCALL(pipe)
+ 419:	b8 04 00 00 00       	mov    $0x4,%eax
+ 41e:	cd 40                	int    $0x40
+ 420:	c3                   	ret
+
+00000421 <read>:
+SYSCALL(read)
+ 421:	b8 05 00 00 00       	mov    $0x5,%eax
+ 426:	cd 40                	int    $0x40
+ 428:	c3                   	ret
+
+00000429 <write>:
+SYSCALL(write)
+ 429:	b8 10 00 00 00       	mov    $0x10,%eax
+ 42e:	cd 40                	int    $0x40
+ 430:	c3                   	ret
+
+00000431 <close>:
+SYSCALL(close)
+ 431:	b8 15 00 00 00       	mov    $0x15,%eax
+ 436:	cd 40                	int    $0x40
+ 438:	c3                   	ret
+
+00000439 <kill>:
+SYSCALL(kill)
+ 439:	b8 06 00 00 00       	mov    $0x6,%eax
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <exec>:
+SYSCALL(exec)
+ 441:	b8 07 00 00 00       	mov    $0x7,%eax
+ 446:	cd 40                	int    $0x40
+ 448:	c3                   	ret
+
+00000449 <open>:
+SYSCALL(open)
+ 449:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 44e:	cd 40                	int    $0x40
+ 450:	c3                   	ret
+
+00000451 <mknod>:
+SYSCALL(mknod)
+ 451:	b8 11 00 00 00       	mov    $0x11,%eax
+ 456:	cd 40                	int    $0x40
+ 458:	c3                   	ret
+
+00000459 <unlink>:
+SYSCALL(unlink)
+ 459:	b8 12 00 00 00       	mov    $0x12,%eax
+ 45e:	cd 40                	int    $0x40
+ 460:	c3                   	ret
+
+00000461 <fstat>:
+SYSCALL(fstat)
+ 461:	b8 08 00 00 00       	mov    $0x8,%eax
+ 466:	cd 40                	int    $0x40
+ 468:	c3                   	ret
+
+00000469 <link>:
+SYSCALL(link)
+ 469:	b8 13 00 00 00       	mov    $0x13,%eax
+ 46e:	cd 40                	int    $0x40
+ 470:	c3                   	ret
+
+00000471 <mkdir>:
+SYSCALL(mkdir)
+ 471:	b8 14 00 00 00       	mov    $0x14,%eax
+ 476:	cd 40                	int    $0x40
+ 478:	c3                   	ret
+
+00000479 <chdir>:
+SYSCALL(chdir)
+ 479:	b8 09 00 00 00       	mov    $0x9,%eax
+ 47e:	cd 40                	int    $0x40
+ 480:	c3                   	ret
+
+00000481 <dup>:
+SYSCALL(dup)
+ 481:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 486:	cd 40                	int    $0x40
+ 488:	c3                   	ret
+
+00000489 <getpid>:
+SYSCALL(getpid)
+ 489:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 48e:	cd 40                	int    $0x40
+ 490:	c3                   	ret
+
+00000491 <sbrk>:
+SYSCALL(sbrk)
+ 491:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 496:	cd 40                	int    $0x40
+ 498:	c3                   	ret
+
+00000499 <sleep>:
+SYSCALL(sleep)
+ 499:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 49e:	cd 40                	int    $0x40
+ 4a0:	c3                   	ret
+
+000004a1 <uptime>:
+SYSCALL(uptime)
+ 4a1:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4a6:	cd 40                	int    $0x40
+ 4a8:	c3                   	ret
+
+000004a9 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 4a9:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4ae:	cd 40                	int    $0x40
+ 4b0:	c3                   	ret
+
+000004b1 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 4b1:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4b6:	cd 40                	int    $0x40
+ 4b8:	c3                   	ret
+
+000004b9 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 4b9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4be:	cd 40                	int    $0x40
+ 4c0:	c3                   	ret
+
+000004c1 <copy_file>:
+SYSCALL(copy_file)
+ 4c1:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4c6:	cd 40                	int    $0x40
+ 4c8:	c3                   	ret
+
+000004c9 <change_queue>:
+SYSCALL(change_queue)
+ 4c9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4ce:	cd 40                	int    $0x40
+ 4d0:	c3                   	ret
+
+000004d1 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 4d1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4d6:	cd 40                	int    $0x40
+ 4d8:	c3                   	ret
+
+000004d9 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 4d9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4de:	cd 40                	int    $0x40
+ 4e0:	c3                   	ret
+
+000004e1 <print_process_info>:
+SYSCALL(print_process_info)
+ 4e1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4e6:	cd 40                	int    $0x40
+ 4e8:	c3                   	ret
+
+000004e9 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 4e9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4ee:	cd 40                	int    $0x40
+ 4f0:	c3                   	ret
+
+000004f1 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 4f1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4f6:	cd 40                	int    $0x40
+ 4f8:	c3                   	ret
+
+000004f9 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 4f9:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4fe:	cd 40                	int    $0x40
+ 500:	c3                   	ret
+
+00000501 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 501:	b8 21 00 00 00       	mov    $0x21,%eax
+ 506:	cd 40                	int    $0x40
+ 508:	c3                   	ret
+
+00000509 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 509:	b8 22 00 00 00       	mov    $0x22,%eax
+ 50e:	cd 40                	int    $0x40
+ 510:	c3                   	ret
+
+00000511 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 511:	b8 23 00 00 00       	mov    $0x23,%eax
+ 516:	cd 40                	int    $0x40
+ 518:	c3                   	ret
+
+00000519 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 519:	b8 24 00 00 00       	mov    $0x24,%eax
+ 51e:	cd 40                	int    $0x40
+ 520:	c3                   	ret
+
+00000521 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 521:	b8 25 00 00 00       	mov    $0x25,%eax
+ 526:	cd 40                	int    $0x40
+ 528:	c3                   	ret
+
+00000529 <set_affinity>:
+SYSCALL(set_affinity)
+ 529:	b8 26 00 00 00       	mov    $0x26,%eax
+ 52e:	cd 40                	int    $0x40
+ 530:	c3                   	ret
+
+00000531 <setsched>:
+SYSCALL(setsched)
+ 531:	b8 27 00 00 00       	mov    $0x27,%eax
+ 536:	cd 40                	int    $0x40
+ 538:	c3                   	ret
+
+00000539 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 539:	b8 28 00 00 00       	mov    $0x28,%eax
+ 53e:	cd 40                	int    $0x40
+ 540:	c3                   	ret
+
+00000541 <set_quantum>:
+SYSCALL(set_quantum)
+ 541:	b8 29 00 00 00       	mov    $0x29,%eax
+ 546:	cd 40                	int    $0x40
+ 548:	c3                   	ret
+
+00000549 <schedtrace>:
+SYSCALL(schedtrace)
+ 549:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 54e:	cd 40                	int    $0x40
+ 550:	c3                   	ret
+
+00000551 <getrusage>:
+SYSCALL(getrusage)
+ 551:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 556:	cd 40                	int    $0x40
+ 558:	c3                   	ret
+
+00000559 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 559:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 55e:	cd 40                	int    $0x40
+ 560:	c3                   	ret
+
+00000561 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 561:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 566:	cd 40                	int    $0x40
+ 568:	c3                   	ret
+
+00000569 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 569:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 56e:	cd 40                	int    $0x40
+ 570:	c3                   	ret
+
+00000571 <futex_wait>:
+SYSCALL(futex_wait)
+ 571:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 576:	cd 40                	int    $0x40
+ 578:	c3                   	ret
+
+00000579 <futex_wake>:
+SYSCALL(futex_wake)
+ 579:	b8 30 00 00 00       	mov    $0x30,%eax
+ 57e:	cd 40                	int    $0x40
+ 580:	c3                   	ret
+
+00000581 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 581:	b8 31 00 00 00       	mov    $0x31,%eax
+ 586:	cd 40                	int    $0x40
+ 588:	c3                   	ret
+
+00000589 <submit_batch>:
+SYSCALL(submit_batch)
+ 589:	b8 32 00 00 00       	mov    $0x32,%eax
+ 58e:	cd 40                	int    $0x40
+ 590:	c3                   	ret
+
+00000591 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 591:	b8 33 00 00 00       	mov    $0x33,%eax
+ 596:	cd 40                	int    $0x40
+ 598:	c3                   	ret
+
+00000599 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 599:	b8 34 00 00 00       	mov    $0x34,%eax
+ 59e:	cd 40                	int    $0x40
+ 5a0:	c3                   	ret
+
+000005a1 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5a1:	55                   	push   %ebp
+ 5a2:	89 e5                	mov    %esp,%ebp
+ 5a4:	83 ec 18             	sub    $0x18,%esp
+ 5a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5aa:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 5ad:	83 ec 04             	sub    $0x4,%esp
+ 5b0:	6a 01                	push   $0x1
+ 5b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5b5:	50                   	push   %eax
+ 5b6:	ff 75 08             	push   0x8(%ebp)
+ 5b9:	e8 6b fe ff ff       	call   429 <write>
+ 5be:	83 c4 10             	add    $0x10,%esp
+}
+ 5c1:	90                   	nop
+ 5c2:	c9                   	leave
+ 5c3:	c3                   	ret
+
+000005c4 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5c4:	55                   	push   %ebp
+ 5c5:	89 e5                	mov    %esp,%ebp
+ 5c7:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 5ca:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 5d1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5d5:	74 17                	je     5ee <printint+0x2a>
+ 5d7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5db:	79 11                	jns    5ee <printint+0x2a>
+    neg = 1;
+ 5dd:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 5e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5e7:	f7 d8                	neg    %eax
+ 5e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5ec:	eb 06                	jmp    5f4 <printint+0x30>
+  } else {
+    x = xx;
+ 5ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5f1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5f4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5fb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5fe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 601:	ba 00 00 00 00       	mov    $0x0,%edx
+ 606:	f7 f1                	div    %ecx
+ 608:	89 d1                	mov    %edx,%ecx
+ 60a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 60d:	8d 50 01             	lea    0x1(%eax),%edx
+ 610:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 613:	0f b6 91 e8 10 00 00 	movzbl 0x10e8(%ecx),%edx
+ 61a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 61e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 621:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 624:	ba 00 00 00 00       	mov    $0x0,%edx
+ 629:	f7 f1                	div    %ecx
+ 62b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 62e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 632:	75 c7                	jne    5fb <printint+0x37>
+  if(neg)
+ 634:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 638:	74 2d                	je     667 <printint+0xa3>
+    buf[i++] = '-';
+ 63a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 63d:	8d 50 01             	lea    0x1(%eax),%edx
+ 640:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 643:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 648:	eb 1d                	jmp    667 <printint+0xa3>
+    putc(fd, buf[i]);
+ 64a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 64d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 650:	01 d0                	add    %edx,%eax
+ 652:	0f b6 00             	movzbl (%eax),%eax
+ 655:	0f be c0             	movsbl %al,%eax
+ 658:	83 ec 08             	sub    $0x8,%esp
+ 65b:	50                   	push   %eax
+ 65c:	ff 75 08             	push   0x8(%ebp)
+ 65f:	e8 3d ff ff ff       	call   5a1 <putc>
+ 664:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 667:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 66b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 66f:	79 d9                	jns    64a <printint+0x86>
+}
+ 671:	90                   	nop
+ 672:	90                   	nop
+ 673:	c9                   	leave
+ 674:	c3                   	ret
+
+00000675 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 675:	55                   	push   %ebp
+ 676:	89 e5                	mov    %esp,%ebp
+ 678:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 67b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 682:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 685:	83 c0 04             	add    $0x4,%eax
+ 688:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 68b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 692:	e9 59 01 00 00       	jmp    7f0 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 697:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 69a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 69d:	01 d0                	add    %edx,%eax
+ 69f:	0f b6 00             	movzbl (%eax),%eax
+ 6a2:	0f be c0             	movsbl %al,%eax
+ 6a5:	25 ff 00 00 00       	and    $0xff,%eax
+ 6aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 6ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6b1:	75 2c                	jne    6df <printf+0x6a>
+      if(c == '%'){
+ 6b3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6b7:	75 0c                	jne    6c5 <printf+0x50>
+        state = '%';
+ 6b9:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6c0:	e9 27 01 00 00       	jmp    7ec <printf+0x177>
+      } else {
+        putc(fd, c);
+ 6c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6c8:	0f be c0             	movsbl %al,%eax
+ 6cb:	83 ec 08             	sub    $0x8,%esp
+ 6ce:	50                   	push   %eax
+ 6cf:	ff 75 08             	push   0x8(%ebp)
+ 6d2:	e8 ca fe ff ff       	call   5a1 <putc>
+ 6d7:	83 c4 10             	add    $0x10,%esp
+ 6da:	e9 0d 01 00 00       	jmp    7ec <printf+0x177>
+      }
+    } else if(state == '%'){
+ 6df:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 6e3:	0f 85 03 01 00 00    	jne    7ec <printf+0x177>
+      if(c == 'd'){
+ 6e9:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6ed:	75 1e                	jne    70d <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 6ef:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f2:	8b 00                	mov    (%eax),%eax
+ 6f4:	6a 01                	push   $0x1
+ 6f6:	6a 0a                	push   $0xa
+ 6f8:	50                   	push   %eax
+ 6f9:	ff 75 08             	push   0x8(%ebp)
+ 6fc:	e8 c3 fe ff ff       	call   5c4 <printint>
+ 701:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 704:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 708:	e9 d8 00 00 00       	jmp    7e5 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 70d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 711:	74 06                	je     719 <printf+0xa4>
+ 713:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 717:	75 1e                	jne    737 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 719:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 71c:	8b 00                	mov    (%eax),%eax
+ 71e:	6a 00                	push   $0x0
+ 720:	6a 10                	push   $0x10
+ 722:	50                   	push   %eax
+ 723:	ff 75 08             	push   0x8(%ebp)
+ 726:	e8 99 fe ff ff       	call   5c4 <printint>
+ 72b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 72e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 732:	e9 ae 00 00 00       	jmp    7e5 <printf+0x170>
+      } else if(c == 's'){
+ 737:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 73b:	75 43                	jne    780 <printf+0x10b>
+        s = (char*)*ap;
+ 73d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 740:	8b 00                	mov    (%eax),%eax
+ 742:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 745:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 749:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 74d:	75 25                	jne    774 <printf+0xff>
+          s = "(null)";
+ 74f:	c7 45 f4 d2 0c 00 00 	movl   $0xcd2,-0xc(%ebp)
+        while(*s != 0){
+ 756:	eb 1c                	jmp    774 <printf+0xff>
+          putc(fd, *s);
+ 758:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 75b:	0f b6 00             	movzbl (%eax),%eax
+ 75e:	0f be c0             	movsbl %al,%eax
+ 761:	83 ec 08             	sub    $0x8,%esp
+ 764:	50                   	push   %eax
+ 765:	ff 75 08             	push   0x8(%ebp)
+ 768:	e8 34 fe ff ff       	call   5a1 <putc>
+ 76d:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 770:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 774:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 777:	0f b6 00             	movzbl (%eax),%eax
+ 77a:	84 c0                	test   %al,%al
+ 77c:	75 da                	jne    758 <printf+0xe3>
+ 77e:	eb 65                	jmp    7e5 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 780:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 784:	75 1d                	jne    7a3 <printf+0x12e>
+        putc(fd, *ap);
+ 786:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 789:	8b 00                	mov    (%eax),%eax
+ 78b:	0f be c0             	movsbl %al,%eax
+ 78e:	83 ec 08             	sub    $0x8,%esp
+ 791:	50                   	push   %eax
+ 792:	ff 75 08             	push   0x8(%ebp)
+ 795:	e8 07 fe ff ff       	call   5a1 <putc>
+ 79a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 79d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7a1:	eb 42                	jmp    7e5 <printf+0x170>
+      } else if(c == '%'){
+ 7a3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7a7:	75 17                	jne    7c0 <printf+0x14b>
+        putc(fd, c);
+ 7a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7ac:	0f be c0             	movsbl %al,%eax
+ 7af:	83 ec 08             	sub    $0x8,%esp
+ 7b2:	50                   	push   %eax
+ 7b3:	ff 75 08             	push   0x8(%ebp)
+ 7b6:	e8 e6 fd ff ff       	call   5a1 <putc>
+ 7bb:	83 c4 10             	add    $0x10,%esp
+ 7be:	eb 25                	jmp    7e5 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 7c0:	83 ec 08             	sub    $0x8,%esp
+ 7c3:	6a 25                	push   $0x25
+ 7c5:	ff 75 08             	push   0x8(%ebp)
+ 7c8:	e8 d4 fd ff ff       	call   5a1 <putc>
+ 7cd:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 7d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7d3:	0f be c0             	movsbl %al,%eax
+ 7d6:	83 ec 08             	sub    $0x8,%esp
+ 7d9:	50                   	push   %eax
+ 7da:	ff 75 08             	push   0x8(%ebp)
+ 7dd:	e8 bf fd ff ff       	call   5a1 <putc>
+ 7e2:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 7e5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7ec:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7f6:	01 d0                	add    %edx,%eax
+ 7f8:	0f b6 00             	movzbl (%eax),%eax
+ 7fb:	84 c0                	test   %al,%al
+ 7fd:	0f 85 94 fe ff ff    	jne    697 <printf+0x22>
+    }
+  }
+}
+ 803:	90                   	nop
+ 804:	90                   	nop
+ 805:	c9                   	leave
+ 806:	c3                   	ret
+
+00000807 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 807:	55                   	push   %ebp
+ 808:	89 e5                	mov    %esp,%ebp
+ 80a:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 80d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 810:	83 e8 08             	sub    $0x8,%eax
+ 813:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 816:	a1 04 11 00 00       	mov    0x1104,%eax
+ 81b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 81e:	eb 24                	jmp    844 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 820:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 823:	8b 00                	mov    (%eax),%eax
+ 825:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 828:	72 12                	jb     83c <free+0x35>
+ 82a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 82d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 830:	72 24                	jb     856 <free+0x4f>
+ 832:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 835:	8b 00                	mov    (%eax),%eax
+ 837:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 83a:	72 1a                	jb     856 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 83c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83f:	8b 00                	mov    (%eax),%eax
+ 841:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 844:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 847:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 84a:	73 d4                	jae    820 <free+0x19>
+ 84c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 84f:	8b 00                	mov    (%eax),%eax
+ 851:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 854:	73 ca                	jae    820 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 856:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 859:	8b 40 04             	mov    0x4(%eax),%eax
+ 85c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 863:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 866:	01 c2                	add    %eax,%edx
+ 868:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86b:	8b 00                	mov    (%eax),%eax
+ 86d:	39 c2                	cmp    %eax,%edx
+ 86f:	75 24                	jne    895 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 871:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 874:	8b 50 04             	mov    0x4(%eax),%edx
+ 877:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 87a:	8b 00                	mov    (%eax),%eax
+ 87c:	8b 40 04             	mov    0x4(%eax),%eax
+ 87f:	01 c2                	add    %eax,%edx
+ 881:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 884:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 887:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88a:	8b 00                	mov    (%eax),%eax
+ 88c:	8b 10                	mov    (%eax),%edx
+ 88e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 891:	89 10                	mov    %edx,(%eax)
+ 893:	eb 0a                	jmp    89f <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 895:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 898:	8b 10                	mov    (%eax),%edx
+ 89a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 89d:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 89f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a2:	8b 40 04             	mov    0x4(%eax),%eax
+ 8a5:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8af:	01 d0                	add    %edx,%eax
+ 8b1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8b4:	75 20                	jne    8d6 <free+0xcf>
+    p->s.size += bp->s.size;
+ 8b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b9:	8b 50 04             	mov    0x4(%eax),%edx
+ 8bc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8bf:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c2:	01 c2                	add    %eax,%edx
+ 8c4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c7:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 8ca:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8cd:	8b 10                	mov    (%eax),%edx
+ 8cf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d2:	89 10                	mov    %edx,(%eax)
+ 8d4:	eb 08                	jmp    8de <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 8d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d9:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 8dc:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 8de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e1:	a3 04 11 00 00       	mov    %eax,0x1104
+}
+ 8e6:	90                   	nop
+ 8e7:	c9                   	leave
+ 8e8:	c3                   	ret
+
+000008e9 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8e9:	55                   	push   %ebp
+ 8ea:	89 e5                	mov    %esp,%ebp
+ 8ec:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 8ef:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8f6:	77 07                	ja     8ff <morecore+0x16>
+    nu = 4096;
+ 8f8:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 8ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 902:	c1 e0 03             	shl    $0x3,%eax
+ 905:	83 ec 0c             	sub    $0xc,%esp
+ 908:	50                   	push   %eax
+ 909:	e8 83 fb ff ff       	call   491 <sbrk>
+ 90e:	83 c4 10             	add    $0x10,%esp
+ 911:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 914:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 918:	75 07                	jne    921 <morecore+0x38>
+    return 0;
+ 91a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 91f:	eb 26                	jmp    947 <morecore+0x5e>
+  hp = (Header*)p;
+ 921:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 924:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 927:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 92a:	8b 55 08             	mov    0x8(%ebp),%edx
+ 92d:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 930:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 933:	83 c0 08             	add    $0x8,%eax
+ 936:	83 ec 0c             	sub    $0xc,%esp
+ 939:	50                   	push   %eax
+ 93a:	e8 c8 fe ff ff       	call   807 <free>
+ 93f:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 942:	a1 04 11 00 00       	mov    0x1104,%eax
+}
+ 947:	c9                   	leave
+ 948:	c3                   	ret
+
+00000949 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 949:	55                   	push   %ebp
+ 94a:	89 e5                	mov    %esp,%ebp
+ 94c:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 94f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 952:	83 c0 07             	add    $0x7,%eax
+ 955:	c1 e8 03             	shr    $0x3,%eax
+ 958:	83 c0 01             	add    $0x1,%eax
+ 95b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 95e:	a1 04 11 00 00       	mov    0x1104,%eax
+ 963:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 966:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 96a:	75 23                	jne    98f <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 96c:	c7 45 f0 fc 10 00 00 	movl   $0x10fc,-0x10(%ebp)
+ 973:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 976:	a3 04 11 00 00       	mov    %eax,0x1104
+ 97b:	a1 04 11 00 00       	mov    0x1104,%eax
+ 980:	a3 fc 10 00 00       	mov    %eax,0x10fc
+    base.s.size = 0;
+ 985:	c7 05 00 11 00 00 00 	movl   $0x0,0x1100
+ 98c:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 98f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 992:	8b 00                	mov    (%eax),%eax
+ 994:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 997:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99a:	8b 40 04             	mov    0x4(%eax),%eax
+ 99d:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 9a0:	72 4d                	jb     9ef <malloc+0xa6>
+      if(p->s.size == nunits)
+ 9a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a5:	8b 40 04             	mov    0x4(%eax),%eax
+ 9a8:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9ab:	75 0c                	jne    9b9 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 9ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b0:	8b 10                	mov    (%eax),%edx
+ 9b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9b5:	89 10                	mov    %edx,(%eax)
+ 9b7:	eb 26                	jmp    9df <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 9b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9bc:	8b 40 04             	mov    0x4(%eax),%eax
+ 9bf:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9c2:	89 c2                	mov    %eax,%edx
+ 9c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c7:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 9ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9cd:	8b 40 04             	mov    0x4(%eax),%eax
+ 9d0:	c1 e0 03             	shl    $0x3,%eax
+ 9d3:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 9d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9dc:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 9df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9e2:	a3 04 11 00 00       	mov    %eax,0x1104
+      return (void*)(p + 1);
+ 9e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ea:	83 c0 08             	add    $0x8,%eax
+ 9ed:	eb 3b                	jmp    a2a <malloc+0xe1>
+    }
+    if(p == freep)
+ 9ef:	a1 04 11 00 00       	mov    0x1104,%eax
+ 9f4:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9f7:	75 1e                	jne    a17 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 9f9:	83 ec 0c             	sub    $0xc,%esp
+ 9fc:	ff 75 ec             	push   -0x14(%ebp)
+ 9ff:	e8 e5 fe ff ff       	call   8e9 <morecore>
+ a04:	83 c4 10             	add    $0x10,%esp
+ a07:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a0a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a0e:	75 07                	jne    a17 <malloc+0xce>
+        return 0;
+ a10:	b8 00 00 00 00       	mov    $0x0,%eax
+ a15:	eb 13                	jmp    a2a <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a1a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a20:	8b 00                	mov    (%eax),%eax
+ a22:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a25:	e9 6d ff ff ff       	jmp    997 <malloc+0x4e>
+  }
+}
+ a2a:	c9                   	leave
+ a2b:	c3                   	ret
+
+00000a2c <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ a2c:	55                   	push   %ebp
+ a2d:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ a2f:	8b 45 08             	mov    0x8(%ebp),%eax
+ a32:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ a38:	90                   	nop
+ a39:	5d                   	pop    %ebp
+ a3a:	c3                   	ret
+
+00000a3b <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ a3b:	55                   	push   %ebp
+ a3c:	89 e5                	mov    %esp,%ebp
+ a3e:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ a41:	8b 55 08             	mov    0x8(%ebp),%edx
+ a44:	b8 00 00 00 00       	mov    $0x0,%eax
+ a49:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a4e:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ a52:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a55:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a59:	74 3b                	je     a96 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ a5b:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ a5f:	74 2d                	je     a8e <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a61:	8b 55 08             	mov    0x8(%ebp),%edx
+ a64:	b8 02 00 00 00       	mov    $0x2,%eax
+ a69:	87 02                	xchg   %eax,(%edx)
+ a6b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a6e:	eb 1e                	jmp    a8e <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ a70:	8b 45 08             	mov    0x8(%ebp),%eax
+ a73:	83 ec 08             	sub    $0x8,%esp
+ a76:	6a 02                	push   $0x2
+ a78:	50                   	push   %eax
+ a79:	e8 f3 fa ff ff       	call   571 <futex_wait>
+ a7e:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a81:	8b 55 08             	mov    0x8(%ebp),%edx
+ a84:	b8 02 00 00 00       	mov    $0x2,%eax
+ a89:	87 02                	xchg   %eax,(%edx)
+ a8b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a8e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a92:	75 dc                	jne    a70 <mutex_lock+0x35>
+ a94:	eb 01                	jmp    a97 <mutex_lock+0x5c>
+    return;
+ a96:	90                   	nop
+  }
+}
+ a97:	c9                   	leave
+ a98:	c3                   	ret
+
+00000a99 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ a99:	55                   	push   %ebp
+ a9a:	89 e5                	mov    %esp,%ebp
+ a9c:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa2:	ba 01 00 00 00       	mov    $0x1,%edx
+ aa7:	f7 da                	neg    %edx
+ aa9:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ aad:	83 fa 01             	cmp    $0x1,%edx
+ ab0:	74 1a                	je     acc <mutex_unlock+0x33>
+    m->state = 0;
+ ab2:	8b 45 08             	mov    0x8(%ebp),%eax
+ ab5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ abb:	8b 45 08             	mov    0x8(%ebp),%eax
+ abe:	83 ec 08             	sub    $0x8,%esp
+ ac1:	6a 01                	push   $0x1
+ ac3:	50                   	push   %eax
+ ac4:	e8 b0 fa ff ff       	call   579 <futex_wake>
+ ac9:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ acc:	90                   	nop
+ acd:	c9                   	leave
+ ace:	c3                   	ret
+
+00000acf <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ acf:	55                   	push   %ebp
+ ad0:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ ad2:	8b 45 08             	mov    0x8(%ebp),%eax
+ ad5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ adb:	8b 45 08             	mov    0x8(%ebp),%eax
+ ade:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ ae5:	90                   	nop
+ ae6:	5d                   	pop    %ebp
+ ae7:	c3                   	ret
+
+00000ae8 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ ae8:	55                   	push   %ebp
+ ae9:	89 e5                	mov    %esp,%ebp
+ aeb:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ aee:	8b 45 08             	mov    0x8(%ebp),%eax
+ af1:	83 c0 04             	add    $0x4,%eax
+ af4:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ af8:	8b 45 08             	mov    0x8(%ebp),%eax
+ afb:	83 ec 08             	sub    $0x8,%esp
+ afe:	ff 75 0c             	push   0xc(%ebp)
+ b01:	50                   	push   %eax
+ b02:	e8 6a fa ff ff       	call   571 <futex_wait>
+ b07:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ b0a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b0d:	83 c0 04             	add    $0x4,%eax
+ b10:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ b14:	90                   	nop
+ b15:	c9                   	leave
+ b16:	c3                   	ret
+
+00000b17 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ b17:	55                   	push   %ebp
+ b18:	89 e5                	mov    %esp,%ebp
+ b1a:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b20:	8b 00                	mov    (%eax),%eax
+ b22:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ b25:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b29:	78 17                	js     b42 <rwlock_rdlock+0x2b>
+ b2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b2e:	83 c0 01             	add    $0x1,%eax
+ b31:	89 c1                	mov    %eax,%ecx
+ b33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b36:	8b 55 08             	mov    0x8(%ebp),%edx
+ b39:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b3d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b40:	74 19                	je     b5b <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ b42:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b46:	79 d5                	jns    b1d <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ b48:	83 ec 08             	sub    $0x8,%esp
+ b4b:	ff 75 f4             	push   -0xc(%ebp)
+ b4e:	ff 75 08             	push   0x8(%ebp)
+ b51:	e8 92 ff ff ff       	call   ae8 <rwlock_sleep>
+ b56:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ b59:	eb c2                	jmp    b1d <rwlock_rdlock+0x6>
+      return;
+ b5b:	90                   	nop
+  }
+}
+ b5c:	c9                   	leave
+ b5d:	c3                   	ret
+
+00000b5e <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ b5e:	55                   	push   %ebp
+ b5f:	89 e5                	mov    %esp,%ebp
+ b61:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b64:	eb 11                	jmp    b77 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ b66:	83 ec 08             	sub    $0x8,%esp
+ b69:	ff 75 f4             	push   -0xc(%ebp)
+ b6c:	ff 75 08             	push   0x8(%ebp)
+ b6f:	e8 74 ff ff ff       	call   ae8 <rwlock_sleep>
+ b74:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b77:	8b 55 08             	mov    0x8(%ebp),%edx
+ b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+ b7f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ b84:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b88:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b8b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b8f:	75 d5                	jne    b66 <rwlock_wrlock+0x8>
+}
+ b91:	90                   	nop
+ b92:	90                   	nop
+ b93:	c9                   	leave
+ b94:	c3                   	ret
+
+00000b95 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ b95:	55                   	push   %ebp
+ b96:	89 e5                	mov    %esp,%ebp
+ b98:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ b9b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b9e:	8b 00                	mov    (%eax),%eax
+ ba0:	85 c0                	test   %eax,%eax
+ ba2:	79 0c                	jns    bb0 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ ba4:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba7:	ba 00 00 00 00       	mov    $0x0,%edx
+ bac:	87 10                	xchg   %edx,(%eax)
+ bae:	eb 18                	jmp    bc8 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ bb0:	8b 55 08             	mov    0x8(%ebp),%edx
+ bb3:	b8 01 00 00 00       	mov    $0x1,%eax
+ bb8:	f7 d8                	neg    %eax
+ bba:	89 c1                	mov    %eax,%ecx
+ bbc:	89 c8                	mov    %ecx,%eax
+ bbe:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ bc2:	01 c8                	add    %ecx,%eax
+ bc4:	85 c0                	test   %eax,%eax
+ bc6:	75 20                	jne    be8 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ bc8:	8b 45 08             	mov    0x8(%ebp),%eax
+ bcb:	8b 40 04             	mov    0x4(%eax),%eax
+ bce:	85 c0                	test   %eax,%eax
+ bd0:	74 17                	je     be9 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ bd2:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd5:	83 ec 08             	sub    $0x8,%esp
+ bd8:	68 ff ff ff 7f       	push   $0x7fffffff
+ bdd:	50                   	push   %eax
+ bde:	e8 96 f9 ff ff       	call   579 <futex_wake>
+ be3:	83 c4 10             	add    $0x10,%esp
+ be6:	eb 01                	jmp    be9 <rwlock_unlock+0x54>
+    return;
+ be8:	90                   	nop
+}
+ be9:	c9                   	leave
+ bea:	c3                   	ret
+
+00000beb <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ beb:	55                   	push   %ebp
+ bec:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ bee:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ bf7:	90                   	nop
+ bf8:	5d                   	pop    %ebp
+ bf9:	c3                   	ret
+
+00000bfa <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ bfa:	55                   	push   %ebp
+ bfb:	89 e5                	mov    %esp,%ebp
+ bfd:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ c00:	8b 45 08             	mov    0x8(%ebp),%eax
+ c03:	8b 00                	mov    (%eax),%eax
+ c05:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ c08:	83 ec 0c             	sub    $0xc,%esp
+ c0b:	ff 75 0c             	push   0xc(%ebp)
+ c0e:	e8 86 fe ff ff       	call   a99 <mutex_unlock>
+ c13:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ c16:	8b 45 08             	mov    0x8(%ebp),%eax
+ c19:	83 ec 08             	sub    $0x8,%esp
+ c1c:	ff 75 f4             	push   -0xc(%ebp)
+ c1f:	50                   	push   %eax
+ c20:	e8 4c f9 ff ff       	call   571 <futex_wait>
+ c25:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ c28:	83 ec 0c             	sub    $0xc,%esp
+ c2b:	ff 75 0c             	push   0xc(%ebp)
+ c2e:	e8 08 fe ff ff       	call   a3b <mutex_lock>
+ c33:	83 c4 10             	add    $0x10,%esp
+}
+ c36:	90                   	nop
+ c37:	c9                   	leave
+ c38:	c3                   	ret
+
+00000c39 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ c39:	55                   	push   %ebp
+ c3a:	89 e5                	mov    %esp,%ebp
+ c3c:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c3f:	8b 45 08             	mov    0x8(%ebp),%eax
+ c42:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ c46:	8b 45 08             	mov    0x8(%ebp),%eax
+ c49:	83 ec 08             	sub    $0x8,%esp
+ c4c:	6a 01                	push   $0x1
+ c4e:	50                   	push   %eax
+ c4f:	e8 25 f9 ff ff       	call   579 <futex_wake>
+ c54:	83 c4 10             	add    $0x10,%esp
+}
+ c57:	90                   	nop
+ c58:	c9                   	leave
+ c59:	c3                   	ret
+
+00000c5a <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ c5a:	55                   	push   %ebp
+ c5b:	89 e5                	mov    %esp,%ebp
+ c5d:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c60:	8b 45 08             	mov    0x8(%ebp),%eax
+ c63:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ c67:	8b 45 08             	mov    0x8(%ebp),%eax
+ c6a:	83 ec 08             	sub    $0x8,%esp
+ c6d:	68 ff ff ff 7f       	push   $0x7fffffff
+ c72:	50                   	push   %eax
+ c73:	e8 01 f9 ff ff       	call   579 <futex_wake>
+ c78:	83 c4 10             	add    $0x10,%esp
+}
+ c7b:	90                   	nop
+ c7c:	c9                   	leave
+ c7d:	c3                   	ret
@@ -0,0 +1,1772 @@
+
+_foo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+
+#define PROCS_NUM 5
+
+int main()
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+   6:	83 ec 20             	sub    $0x20,%esp
+    for (int i = 0; i < PROCS_NUM; ++i)
+   9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  10:	00 
+  11:	eb 55                	jmp    68 <main+0x68>
+    {
+        int pid = fork();
+  13:	e8 90 03 00 00       	call   3a8 <fork>
+  18:	89 44 24 10          	mov    %eax,0x10(%esp)
+        if (pid > 0)
+  1c:	83 7c 24 10 00       	cmpl   $0x0,0x10(%esp)
+  21:	7f 3f                	jg     62 <main+0x62>
+            continue;
+        if (pid == 0)
+  23:	83 7c 24 10 00       	cmpl   $0x0,0x10(%esp)
+  28:	75 39                	jne    63 <main+0x63>
+        {
+            // sleep(5000);
+            for (int j = 0; j < 100 * i; ++j)
+  2a:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  31:	00 
+  32:	90                   	nop
+  33:	8b 44 24 1c          	mov    0x1c(%esp),%eax
+  37:	6b c0 64             	imul   $0x64,%eax,%eax
+  3a:	39 44 24 0c          	cmp    %eax,0xc(%esp)
+  3e:	7d 1d                	jge    5d <main+0x5d>
+            {
+                int x = 1;
+  40:	c7 44 24 18 01 00 00 	movl   $0x1,0x18(%esp)
+  47:	00 
+                for (long k = 0; k < 1000000000000; ++k)
+  48:	c7 44 24 14 00 00 00 	movl   $0x0,0x14(%esp)
+  4f:	00 
+                    x++;
+  50:	83 44 24 18 01       	addl   $0x1,0x18(%esp)
+                for (long k = 0; k < 1000000000000; ++k)
+  55:	83 44 24 14 01       	addl   $0x1,0x14(%esp)
+                    x++;
+  5a:	90                   	nop
+  5b:	eb f3                	jmp    50 <main+0x50>
+            }
+            exit();
+  5d:	e8 4e 03 00 00       	call   3b0 <exit>
+            continue;
+  62:	90                   	nop
+    for (int i = 0; i < PROCS_NUM; ++i)
+  63:	83 44 24 1c 01       	addl   $0x1,0x1c(%esp)
+  68:	83 7c 24 1c 04       	cmpl   $0x4,0x1c(%esp)
+  6d:	7e a4                	jle    13 <main+0x13>
+        }
+    }
+    while (wait() != -1)
+  6f:	90                   	nop
+  70:	e8 43 03 00 00       	call   3b8 <wait>
+  75:	83 f8 ff             	cmp    $0xffffffff,%eax
+  78:	75 f6                	jne    70 <main+0x70>
+        ;
+    exit();
+  7a:	e8 31 03 00 00       	call   3b0 <exit>
+
+0000007f <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+  7f:	55                   	push   %ebp
+  80:	89 e5                	mov    %esp,%ebp
+  82:	57                   	push   %edi
+  83:	53                   	push   %ebx
+{
+  84:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  87:	8b 55 10             	mov    0x10(%ebp),%edx
+  8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8d:	89 cb                	mov    %ecx,%ebx
+  8f:	89 df                	mov    %ebx,%edi
+  91:	89 d1                	mov    %edx,%ecx
+  93:	fc                   	cld
+  94:	f3 aa                	rep stos %al,%es:(%edi)
+  96:	89 ca                	mov    %ecx,%edx
+  98:	89 fb                	mov    %edi,%ebx
+  9a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  9d:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+  a0:	90                   	nop
+  a1:	5b                   	pop    %ebx
+  a2:	5f                   	pop    %edi
+  a3:	5d                   	pop    %ebp
+  a4:	c3                   	ret
+
+000000a5 <strcpy>:
+{
+  a5:	55                   	push   %ebp
+  a6:	89 e5                	mov    %esp,%ebp
+  a8:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  ae:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  b1:	90                   	nop
+  b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b5:	8d 42 01             	lea    0x1(%edx),%eax
+  b8:	89 45 0c             	mov    %eax,0xc(%ebp)
+  bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  be:	8d 48 01             	lea    0x1(%eax),%ecx
+  c1:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  c4:	0f b6 12             	movzbl (%edx),%edx
+  c7:	88 10                	mov    %dl,(%eax)
+  c9:	0f b6 00             	movzbl (%eax),%eax
+  cc:	84 c0                	test   %al,%al
+  ce:	75 e2                	jne    b2 <strcpy+0xd>
+  return os;
+  d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  d3:	c9                   	leave
+  d4:	c3                   	ret
+
+000000d5 <strcmp>:
+{
+  d5:	55                   	push   %ebp
+  d6:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  d8:	eb 08                	jmp    e2 <strcmp+0xd>
+    p++, q++;
+  da:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  de:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  e5:	0f b6 00             	movzbl (%eax),%eax
+  e8:	84 c0                	test   %al,%al
+  ea:	74 10                	je     fc <strcmp+0x27>
+  ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  ef:	0f b6 10             	movzbl (%eax),%edx
+  f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  f5:	0f b6 00             	movzbl (%eax),%eax
+  f8:	38 c2                	cmp    %al,%dl
+  fa:	74 de                	je     da <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  ff:	0f b6 00             	movzbl (%eax),%eax
+ 102:	0f b6 d0             	movzbl %al,%edx
+ 105:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 108:	0f b6 00             	movzbl (%eax),%eax
+ 10b:	0f b6 c0             	movzbl %al,%eax
+ 10e:	29 c2                	sub    %eax,%edx
+ 110:	89 d0                	mov    %edx,%eax
+}
+ 112:	5d                   	pop    %ebp
+ 113:	c3                   	ret
+
+00000114 <strlen>:
+{
+ 114:	55                   	push   %ebp
+ 115:	89 e5                	mov    %esp,%ebp
+ 117:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 11a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 121:	eb 04                	jmp    127 <strlen+0x13>
+ 123:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 127:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 12a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 12d:	01 d0                	add    %edx,%eax
+ 12f:	0f b6 00             	movzbl (%eax),%eax
+ 132:	84 c0                	test   %al,%al
+ 134:	75 ed                	jne    123 <strlen+0xf>
+  return n;
+ 136:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 139:	c9                   	leave
+ 13a:	c3                   	ret
+
+0000013b <memset>:
+{
+ 13b:	55                   	push   %ebp
+ 13c:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 13e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 141:	50                   	push   %eax
+ 142:	ff 75 0c             	push   0xc(%ebp)
+ 145:	ff 75 08             	push   0x8(%ebp)
+ 148:	e8 32 ff ff ff       	call   7f <stosb>
+ 14d:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 150:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 153:	c9                   	leave
+ 154:	c3                   	ret
+
+00000155 <strchr>:
+{
+ 155:	55                   	push   %ebp
+ 156:	89 e5                	mov    %esp,%ebp
+ 158:	83 ec 04             	sub    $0x4,%esp
+ 15b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 15e:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 161:	eb 14                	jmp    177 <strchr+0x22>
+    if(*s == c)
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 00             	movzbl (%eax),%eax
+ 169:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 16c:	75 05                	jne    173 <strchr+0x1e>
+      return (char*)s;
+ 16e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 171:	eb 13                	jmp    186 <strchr+0x31>
+  for(; *s; s++)
+ 173:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 177:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17a:	0f b6 00             	movzbl (%eax),%eax
+ 17d:	84 c0                	test   %al,%al
+ 17f:	75 e2                	jne    163 <strchr+0xe>
+  return 0;
+ 181:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 186:	c9                   	leave
+ 187:	c3                   	ret
+
+00000188 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 188:	55                   	push   %ebp
+ 189:	89 e5                	mov    %esp,%ebp
+ 18b:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 18e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 195:	eb 42                	jmp    1d9 <gets+0x51>
+    cc = read(0, &c, 1);
+ 197:	83 ec 04             	sub    $0x4,%esp
+ 19a:	6a 01                	push   $0x1
+ 19c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 19f:	50                   	push   %eax
+ 1a0:	6a 00                	push   $0x0
+ 1a2:	e8 21 02 00 00       	call   3c8 <read>
+ 1a7:	83 c4 10             	add    $0x10,%esp
+ 1aa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1ad:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1b1:	7e 33                	jle    1e6 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1b6:	8d 50 01             	lea    0x1(%eax),%edx
+ 1b9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1bc:	89 c2                	mov    %eax,%edx
+ 1be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c1:	01 c2                	add    %eax,%edx
+ 1c3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c7:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1c9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1cd:	3c 0a                	cmp    $0xa,%al
+ 1cf:	74 16                	je     1e7 <gets+0x5f>
+ 1d1:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1d5:	3c 0d                	cmp    $0xd,%al
+ 1d7:	74 0e                	je     1e7 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1dc:	83 c0 01             	add    $0x1,%eax
+ 1df:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1e2:	7f b3                	jg     197 <gets+0xf>
+ 1e4:	eb 01                	jmp    1e7 <gets+0x5f>
+      break;
+ 1e6:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1e7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ed:	01 d0                	add    %edx,%eax
+ 1ef:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1f2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1f5:	c9                   	leave
+ 1f6:	c3                   	ret
+
+000001f7 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f7:	55                   	push   %ebp
+ 1f8:	89 e5                	mov    %esp,%ebp
+ 1fa:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1fd:	83 ec 08             	sub    $0x8,%esp
+ 200:	6a 00                	push   $0x0
+ 202:	ff 75 08             	push   0x8(%ebp)
+ 205:	e8 e6 01 00 00       	call   3f0 <open>
+ 20a:	83 c4 10             	add    $0x10,%esp
+ 20d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 210:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 214:	79 07                	jns    21d <stat+0x26>
+    return -1;
+ 216:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 21b:	eb 25                	jmp    242 <stat+0x4b>
+  r = fstat(fd, st);
+ 21d:	83 ec 08             	sub    $0x8,%esp
+ 220:	ff 75 0c             	push   0xc(%ebp)
+ 223:	ff 75 f4             	push   -0xc(%ebp)
+ 226:	e8 dd 01 00 00       	call   408 <fstat>
+ 22b:	83 c4 10             	add    $0x10,%esp
+ 22e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 231:	83 ec 0c             	sub    $0xc,%esp
+ 234:	ff 75 f4             	push   -0xc(%ebp)
+ 237:	e8 9c 01 00 00       	call   3d8 <close>
+ 23c:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 23f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 242:	c9                   	leave
+ 243:	c3                   	ret
+
+00000244 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 244:	55                   	push   %ebp
+ 245:	89 e5                	mov    %esp,%ebp
+ 247:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 24a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 251:	eb 25                	jmp    278 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 253:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 256:	89 d0                	mov    %edx,%eax
+ 258:	c1 e0 02             	shl    $0x2,%eax
+ 25b:	01 d0                	add    %edx,%eax
+ 25d:	01 c0                	add    %eax,%eax
+ 25f:	89 c1                	mov    %eax,%ecx
+ 261:	8b 45 08             	mov    0x8(%ebp),%eax
+ 264:	8d 50 01             	lea    0x1(%eax),%edx
+ 267:	89 55 08             	mov    %edx,0x8(%ebp)
+ 26a:	0f b6 00             	movzbl (%eax),%eax
+ 26d:	0f be c0             	movsbl %al,%eax
+ 270:	01 c8                	add    %ecx,%eax
+ 272:	83 e8 30             	sub    $0x30,%eax
+ 275:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 278:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27b:	0f b6 00             	movzbl (%eax),%eax
+ 27e:	3c 2f                	cmp    $0x2f,%al
+ 280:	7e 0a                	jle    28c <atoi+0x48>
+ 282:	8b 45 08             	mov    0x8(%ebp),%eax
+ 285:	0f b6 00             	movzbl (%eax),%eax
+ 288:	3c 39                	cmp    $0x39,%al
+ 28a:	7e c7                	jle    253 <atoi+0xf>
+  return n;
+ 28c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 28f:	c9                   	leave
+ 290:	c3                   	ret
+
+00000291 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 291:	55                   	push   %ebp
+ 292:	89 e5                	mov    %esp,%ebp
+ 294:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 297:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 29d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2a0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2a3:	eb 17                	jmp    2bc <memmove+0x2b>
+    *dst++ = *src++;
+ 2a5:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2a8:	8d 42 01             	lea    0x1(%edx),%eax
+ 2ab:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2ae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2b1:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2b4:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2b7:	0f b6 12             	movzbl (%edx),%edx
+ 2ba:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2bc:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2bf:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2c2:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2c5:	85 c0                	test   %eax,%eax
+ 2c7:	7f dc                	jg     2a5 <memmove+0x14>
+  return vdst;
+ 2c9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2cc:	c9                   	leave
+ 2cd:	c3                   	ret
+
+000002ce <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 2ce:	55                   	push   %ebp
+ 2cf:	89 e5                	mov    %esp,%ebp
+ 2d1:	57                   	push   %edi
+ 2d2:	56                   	push   %esi
+ 2d3:	83 ec 30             	sub    $0x30,%esp
+ 2d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 2dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2df:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 2e2:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 2e9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 2f0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2f3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 2f6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 2f9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 2fc:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 303:	e9 89 00 00 00       	jmp    391 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 308:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 30b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 30e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 312:	01 c0                	add    %eax,%eax
+ 314:	89 c6                	mov    %eax,%esi
+ 316:	89 d7                	mov    %edx,%edi
+ 318:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 31b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 31e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 321:	0f ad d0             	shrd   %cl,%edx,%eax
+ 324:	d3 ea                	shr    %cl,%edx
+ 326:	f6 c1 20             	test   $0x20,%cl
+ 329:	74 04                	je     32f <udiv64+0x61>
+ 32b:	89 d0                	mov    %edx,%eax
+ 32d:	31 d2                	xor    %edx,%edx
+ 32f:	83 e0 01             	and    $0x1,%eax
+ 332:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 335:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 33c:	89 f0                	mov    %esi,%eax
+ 33e:	89 fa                	mov    %edi,%edx
+ 340:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 343:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 346:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 349:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 34c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 34f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 354:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 357:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 35a:	19 d1                	sbb    %edx,%ecx
+ 35c:	72 2f                	jb     38d <udiv64+0xbf>
+      r -= d;
+ 35e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 361:	ba 00 00 00 00       	mov    $0x0,%edx
+ 366:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 369:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 36c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 36f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 374:	ba 00 00 00 00       	mov    $0x0,%edx
+ 379:	0f a5 c2             	shld   %cl,%eax,%edx
+ 37c:	d3 e0                	shl    %cl,%eax
+ 37e:	f6 c1 20             	test   $0x20,%cl
+ 381:	74 04                	je     387 <udiv64+0xb9>
+ 383:	89 c2                	mov    %eax,%edx
+ 385:	31 c0                	xor    %eax,%eax
+ 387:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 38a:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 38d:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 391:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 395:	0f 89 6d ff ff ff    	jns    308 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 39b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 39e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 3a1:	83 c4 30             	add    $0x30,%esp
+ 3a4:	5e                   	pop    %esi
+ 3a5:	5f                   	pop    %edi
+ 3a6:	5d                   	pop    %ebp
+ 3a7:	c3                   	ret
+
+000003a8 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3a8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <exit>:
+SYSCALL(exit)
+ 3b0:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <wait>:
+SYSCALL(wait)
+ 3b8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <pipe>:
+SYSCALL(pipe)
+ 3c0:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <read>:
+SYSCALL(read)
+ 3c8:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <write>:
+SYSCALL(write)
+ 3d0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <close>:
+SYSCALL(close)
+ 3d8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <kill>:
+SYSCALL(kill)
+ 3e0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <exec>:
+SYSCALL(exec)
+ 3e8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <open>:
+SYSCALL(open)
+ 3f0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <mknod>:
+SYSCALL(mknod)
+ 3f8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <unlink>:
+SYSCALL(unlink)
+ 400:	b8 12 00 00 00       	mov    $0x12,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <fstat>:
+SYSCALL(fstat)
+ 408:	b8 08 00 00 00       	mov    $0x8,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <link>:
+SYSCALL(link)
+ 410:	b8 13 00 00 00       	mov    $0x13,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <mkdir>:
+SYSCALL(mkdir)
+ 418:	b8 14 00 00 00       	mov    $0x14,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <chdir>:
+SYSCALL(chdir)
+ 420:	b8 09 00 00 00       	mov    $0x9,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <dup>:
+SYSCALL(dup)
+ 428:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <getpid>:
+SYSCALL(getpid)
+ 430:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <sbrk>:
+SYSCALL(sbrk)
+ 438:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <sleep>:
+SYSCALL(sleep)
+ 440:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <uptime>:
+SYSCALL(uptime)
+ 448:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 450:	b8 16 00 00 00       	mov    $0x16,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 458:	b8 17 00 00 00       	mov    $0x17,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 460:	b8 18 00 00 00       	mov    $0x18,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <copy_file>:
+SYSCALL(copy_file)
+ 468:	b8 19 00 00 00       	mov    $0x19,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <change_queue>:
+SYSCALL(change_queue)
+ 470:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 478:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 480:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <print_process_info>:
+SYSCALL(print_process_info)
+ 488:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 490:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 498:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 4a0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 4a8:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 4b0:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 4b8:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 4c0:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 4c8:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <set_affinity>:
+SYSCALL(set_affinity)
+ 4d0:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <setsched>:
+SYSCALL(setsched)
+ 4d8:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 4e0:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <set_quantum>:
+SYSCALL(set_quantum)
+ 4e8:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <schedtrace>:
+SYSCALL(schedtrace)
+ 4f0:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <getrusage>:
+SYSCALL(getrusage)
+ 4f8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 500:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 508:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 510:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <futex_wait>:
+SYSCALL(futex_wait)
+ 518:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <futex_wake>:
+SYSCALL(futex_wake)
+ 520:	b8 30 00 00 00       	mov    $0x30,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 528:	b8 31 00 00 00       	mov    $0x31,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <submit_batch>:
+SYSCALL(submit_batch)
+ 530:	b8 32 00 00 00       	mov    $0x32,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 538:	b8 33 00 00 00       	mov    $0x33,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 540:	b8 34 00 00 00       	mov    $0x34,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 548:	55                   	push   %ebp
+ 549:	89 e5                	mov    %esp,%ebp
+ 54b:	83 ec 18             	sub    $0x18,%esp
+ 54e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 551:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 554:	83 ec 04             	sub    $0x4,%esp
+ 557:	6a 01                	push   $0x1
+ 559:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 55c:	50                   	push   %eax
+ 55d:	ff 75 08             	push   0x8(%ebp)
+ 560:	e8 6b fe ff ff       	call   3d0 <write>
+ 565:	83 c4 10             	add    $0x10,%esp
+}
+ 568:	90                   	nop
+ 569:	c9                   	leave
+ 56a:	c3                   	ret
+
+0000056b <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 56b:	55                   	push   %ebp
+ 56c:	89 e5                	mov    %esp,%ebp
+ 56e:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 571:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 578:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 57c:	74 17                	je     595 <printint+0x2a>
+ 57e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 582:	79 11                	jns    595 <printint+0x2a>
+    neg = 1;
+ 584:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 58b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 58e:	f7 d8                	neg    %eax
+ 590:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 593:	eb 06                	jmp    59b <printint+0x30>
+  } else {
+    x = xx;
+ 595:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 598:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 59b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5a2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5a5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5a8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5ad:	f7 f1                	div    %ecx
+ 5af:	89 d1                	mov    %edx,%ecx
+ 5b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5b4:	8d 50 01             	lea    0x1(%eax),%edx
+ 5b7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5ba:	0f b6 91 10 10 00 00 	movzbl 0x1010(%ecx),%edx
+ 5c1:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5c5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5c8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5cb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5d0:	f7 f1                	div    %ecx
+ 5d2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5d5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5d9:	75 c7                	jne    5a2 <printint+0x37>
+  if(neg)
+ 5db:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5df:	74 2d                	je     60e <printint+0xa3>
+    buf[i++] = '-';
+ 5e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5e4:	8d 50 01             	lea    0x1(%eax),%edx
+ 5e7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5ea:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5ef:	eb 1d                	jmp    60e <printint+0xa3>
+    putc(fd, buf[i]);
+ 5f1:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5f7:	01 d0                	add    %edx,%eax
+ 5f9:	0f b6 00             	movzbl (%eax),%eax
+ 5fc:	0f be c0             	movsbl %al,%eax
+ 5ff:	83 ec 08             	sub    $0x8,%esp
+ 602:	50                   	push   %eax
+ 603:	ff 75 08             	push   0x8(%ebp)
+ 606:	e8 3d ff ff ff       	call   548 <putc>
+ 60b:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 60e:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 612:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 616:	79 d9                	jns    5f1 <printint+0x86>
+}
+ 618:	90                   	nop
+ 619:	90                   	nop
+ 61a:	c9                   	leave
+ 61b:	c3                   	ret
+
+0000061c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 61c:	55                   	push   %ebp
+ 61d:	89 e5                	mov    %esp,%ebp
+ 61f:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 622:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 629:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 62c:	83 c0 04             	add    $0x4,%eax
+ 62f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 632:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 639:	e9 59 01 00 00       	jmp    797 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 63e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 641:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 644:	01 d0                	add    %edx,%eax
+ 646:	0f b6 00             	movzbl (%eax),%eax
+ 649:	0f be c0             	movsbl %al,%eax
+ 64c:	25 ff 00 00 00       	and    $0xff,%eax
+ 651:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 654:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 658:	75 2c                	jne    686 <printf+0x6a>
+      if(c == '%'){
+ 65a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 65e:	75 0c                	jne    66c <printf+0x50>
+        state = '%';
+ 660:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 667:	e9 27 01 00 00       	jmp    793 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 66c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 66f:	0f be c0             	movsbl %al,%eax
+ 672:	83 ec 08             	sub    $0x8,%esp
+ 675:	50                   	push   %eax
+ 676:	ff 75 08             	push   0x8(%ebp)
+ 679:	e8 ca fe ff ff       	call   548 <putc>
+ 67e:	83 c4 10             	add    $0x10,%esp
+ 681:	e9 0d 01 00 00       	jmp    793 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 686:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 68a:	0f 85 03 01 00 00    	jne    793 <printf+0x177>
+      if(c == 'd'){
+ 690:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 694:	75 1e                	jne    6b4 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 696:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 699:	8b 00                	mov    (%eax),%eax
+ 69b:	6a 01                	push   $0x1
+ 69d:	6a 0a                	push   $0xa
+ 69f:	50                   	push   %eax
+ 6a0:	ff 75 08             	push   0x8(%ebp)
+ 6a3:	e8 c3 fe ff ff       	call   56b <printint>
+ 6a8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6ab:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6af:	e9 d8 00 00 00       	jmp    78c <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6b4:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6b8:	74 06                	je     6c0 <printf+0xa4>
+ 6ba:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6be:	75 1e                	jne    6de <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6c0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6c3:	8b 00                	mov    (%eax),%eax
+ 6c5:	6a 00                	push   $0x0
+ 6c7:	6a 10                	push   $0x10
+ 6c9:	50                   	push   %eax
+ 6ca:	ff 75 08             	push   0x8(%ebp)
+ 6cd:	e8 99 fe ff ff       	call   56b <printint>
+ 6d2:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6d5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6d9:	e9 ae 00 00 00       	jmp    78c <printf+0x170>
+      } else if(c == 's'){
+ 6de:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6e2:	75 43                	jne    727 <printf+0x10b>
+        s = (char*)*ap;
+ 6e4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6e7:	8b 00                	mov    (%eax),%eax
+ 6e9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6ec:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6f0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6f4:	75 25                	jne    71b <printf+0xff>
+          s = "(null)";
+ 6f6:	c7 45 f4 25 0c 00 00 	movl   $0xc25,-0xc(%ebp)
+        while(*s != 0){
+ 6fd:	eb 1c                	jmp    71b <printf+0xff>
+          putc(fd, *s);
+ 6ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 702:	0f b6 00             	movzbl (%eax),%eax
+ 705:	0f be c0             	movsbl %al,%eax
+ 708:	83 ec 08             	sub    $0x8,%esp
+ 70b:	50                   	push   %eax
+ 70c:	ff 75 08             	push   0x8(%ebp)
+ 70f:	e8 34 fe ff ff       	call   548 <putc>
+ 714:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 717:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 71b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 71e:	0f b6 00             	movzbl (%eax),%eax
+ 721:	84 c0                	test   %al,%al
+ 723:	75 da                	jne    6ff <printf+0xe3>
+ 725:	eb 65                	jmp    78c <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 727:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 72b:	75 1d                	jne    74a <printf+0x12e>
+        putc(fd, *ap);
+ 72d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 730:	8b 00                	mov    (%eax),%eax
+ 732:	0f be c0             	movsbl %al,%eax
+ 735:	83 ec 08             	sub    $0x8,%esp
+ 738:	50                   	push   %eax
+ 739:	ff 75 08             	push   0x8(%ebp)
+ 73c:	e8 07 fe ff ff       	call   548 <putc>
+ 741:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 744:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 748:	eb 42                	jmp    78c <printf+0x170>
+      } else if(c == '%'){
+ 74a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 74e:	75 17                	jne    767 <printf+0x14b>
+        putc(fd, c);
+ 750:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 753:	0f be c0             	movsbl %al,%eax
+ 756:	83 ec 08             	sub    $0x8,%esp
+ 759:	50                   	push   %eax
+ 75a:	ff 75 08             	push   0x8(%ebp)
+ 75d:	e8 e6 fd ff ff       	call   548 <putc>
+ 762:	83 c4 10             	add    $0x10,%esp
+ 765:	eb 25                	jmp    78c <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 767:	83 ec 08             	sub    $0x8,%esp
+ 76a:	6a 25                	push   $0x25
+ 76c:	ff 75 08             	push   0x8(%ebp)
+ 76f:	e8 d4 fd ff ff       	call   548 <putc>
+ 774:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 777:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 77a:	0f be c0             	movsbl %al,%eax
+ 77d:	83 ec 08             	sub    $0x8,%esp
+ 780:	50                   	push   %eax
+ 781:	ff 75 08             	push   0x8(%ebp)
+ 784:	e8 bf fd ff ff       	call   548 <putc>
+ 789:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 78c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 793:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 797:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 79a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 79d:	01 d0                	add    %edx,%eax
+ 79f:	0f b6 00             	movzbl (%eax),%eax
+ 7a2:	84 c0                	test   %al,%al
+ 7a4:	0f 85 94 fe ff ff    	jne    63e <printf+0x22>
+    }
+  }
+}
+ 7aa:	90                   	nop
+ 7ab:	90                   	nop
+ 7ac:	c9                   	leave
+ 7ad:	c3                   	ret
+
+000007ae <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7ae:	55                   	push   %ebp
+ 7af:	89 e5                	mov    %esp,%ebp
+ 7b1:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7b7:	83 e8 08             	sub    $0x8,%eax
+ 7ba:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7bd:	a1 2c 10 00 00       	mov    0x102c,%eax
+ 7c2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7c5:	eb 24                	jmp    7eb <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ca:	8b 00                	mov    (%eax),%eax
+ 7cc:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7cf:	72 12                	jb     7e3 <free+0x35>
+ 7d1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7d4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7d7:	72 24                	jb     7fd <free+0x4f>
+ 7d9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7dc:	8b 00                	mov    (%eax),%eax
+ 7de:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7e1:	72 1a                	jb     7fd <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e6:	8b 00                	mov    (%eax),%eax
+ 7e8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7eb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ee:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7f1:	73 d4                	jae    7c7 <free+0x19>
+ 7f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f6:	8b 00                	mov    (%eax),%eax
+ 7f8:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7fb:	73 ca                	jae    7c7 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7fd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 800:	8b 40 04             	mov    0x4(%eax),%eax
+ 803:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 80a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 80d:	01 c2                	add    %eax,%edx
+ 80f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 812:	8b 00                	mov    (%eax),%eax
+ 814:	39 c2                	cmp    %eax,%edx
+ 816:	75 24                	jne    83c <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 818:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 81b:	8b 50 04             	mov    0x4(%eax),%edx
+ 81e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 821:	8b 00                	mov    (%eax),%eax
+ 823:	8b 40 04             	mov    0x4(%eax),%eax
+ 826:	01 c2                	add    %eax,%edx
+ 828:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 82b:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 82e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 831:	8b 00                	mov    (%eax),%eax
+ 833:	8b 10                	mov    (%eax),%edx
+ 835:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 838:	89 10                	mov    %edx,(%eax)
+ 83a:	eb 0a                	jmp    846 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 83c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83f:	8b 10                	mov    (%eax),%edx
+ 841:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 844:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 846:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 849:	8b 40 04             	mov    0x4(%eax),%eax
+ 84c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 853:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 856:	01 d0                	add    %edx,%eax
+ 858:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 85b:	75 20                	jne    87d <free+0xcf>
+    p->s.size += bp->s.size;
+ 85d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 860:	8b 50 04             	mov    0x4(%eax),%edx
+ 863:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 866:	8b 40 04             	mov    0x4(%eax),%eax
+ 869:	01 c2                	add    %eax,%edx
+ 86b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86e:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 871:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 874:	8b 10                	mov    (%eax),%edx
+ 876:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 879:	89 10                	mov    %edx,(%eax)
+ 87b:	eb 08                	jmp    885 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 87d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 880:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 883:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 885:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 888:	a3 2c 10 00 00       	mov    %eax,0x102c
+}
+ 88d:	90                   	nop
+ 88e:	c9                   	leave
+ 88f:	c3                   	ret
+
+00000890 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 896:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 89d:	77 07                	ja     8a6 <morecore+0x16>
+    nu = 4096;
+ 89f:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 8a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8a9:	c1 e0 03             	shl    $0x3,%eax
+ 8ac:	83 ec 0c             	sub    $0xc,%esp
+ 8af:	50                   	push   %eax
+ 8b0:	e8 83 fb ff ff       	call   438 <sbrk>
+ 8b5:	83 c4 10             	add    $0x10,%esp
+ 8b8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 8bb:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8bf:	75 07                	jne    8c8 <morecore+0x38>
+    return 0;
+ 8c1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8c6:	eb 26                	jmp    8ee <morecore+0x5e>
+  hp = (Header*)p;
+ 8c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8cb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 8ce:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8d1:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8d4:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8d7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8da:	83 c0 08             	add    $0x8,%eax
+ 8dd:	83 ec 0c             	sub    $0xc,%esp
+ 8e0:	50                   	push   %eax
+ 8e1:	e8 c8 fe ff ff       	call   7ae <free>
+ 8e6:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 8e9:	a1 2c 10 00 00       	mov    0x102c,%eax
+}
+ 8ee:	c9                   	leave
+ 8ef:	c3                   	ret
+
+000008f0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8f9:	83 c0 07             	add    $0x7,%eax
+ 8fc:	c1 e8 03             	shr    $0x3,%eax
+ 8ff:	83 c0 01             	add    $0x1,%eax
+ 902:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 905:	a1 2c 10 00 00       	mov    0x102c,%eax
+ 90a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 90d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 911:	75 23                	jne    936 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 913:	c7 45 f0 24 10 00 00 	movl   $0x1024,-0x10(%ebp)
+ 91a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 91d:	a3 2c 10 00 00       	mov    %eax,0x102c
+ 922:	a1 2c 10 00 00       	mov    0x102c,%eax
+ 927:	a3 24 10 00 00       	mov    %eax,0x1024
+    base.s.size = 0;
+ 92c:	c7 05 28 10 00 00 00 	movl   $0x0,0x1028
+ 933:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 936:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 939:	8b 00                	mov    (%eax),%eax
+ 93b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 93e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 941:	8b 40 04             	mov    0x4(%eax),%eax
+ 944:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 947:	72 4d                	jb     996 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 949:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 94c:	8b 40 04             	mov    0x4(%eax),%eax
+ 94f:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 952:	75 0c                	jne    960 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 954:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 957:	8b 10                	mov    (%eax),%edx
+ 959:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 95c:	89 10                	mov    %edx,(%eax)
+ 95e:	eb 26                	jmp    986 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 960:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 963:	8b 40 04             	mov    0x4(%eax),%eax
+ 966:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 969:	89 c2                	mov    %eax,%edx
+ 96b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 96e:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 971:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 974:	8b 40 04             	mov    0x4(%eax),%eax
+ 977:	c1 e0 03             	shl    $0x3,%eax
+ 97a:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 97d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 980:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 983:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 986:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 989:	a3 2c 10 00 00       	mov    %eax,0x102c
+      return (void*)(p + 1);
+ 98e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 991:	83 c0 08             	add    $0x8,%eax
+ 994:	eb 3b                	jmp    9d1 <malloc+0xe1>
+    }
+    if(p == freep)
+ 996:	a1 2c 10 00 00       	mov    0x102c,%eax
+ 99b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 99e:	75 1e                	jne    9be <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 9a0:	83 ec 0c             	sub    $0xc,%esp
+ 9a3:	ff 75 ec             	push   -0x14(%ebp)
+ 9a6:	e8 e5 fe ff ff       	call   890 <morecore>
+ 9ab:	83 c4 10             	add    $0x10,%esp
+ 9ae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9b1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9b5:	75 07                	jne    9be <malloc+0xce>
+        return 0;
+ 9b7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9bc:	eb 13                	jmp    9d1 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c7:	8b 00                	mov    (%eax),%eax
+ 9c9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9cc:	e9 6d ff ff ff       	jmp    93e <malloc+0x4e>
+  }
+}
+ 9d1:	c9                   	leave
+ 9d2:	c3                   	ret
+
+000009d3 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ 9d3:	55                   	push   %ebp
+ 9d4:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 9d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9d9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 9df:	90                   	nop
+ 9e0:	5d                   	pop    %ebp
+ 9e1:	c3                   	ret
+
+000009e2 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 9e2:	55                   	push   %ebp
+ 9e3:	89 e5                	mov    %esp,%ebp
+ 9e5:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 9e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9eb:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9f0:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 9f5:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ 9f9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9fc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a00:	74 3b                	je     a3d <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ a02:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ a06:	74 2d                	je     a35 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a08:	8b 55 08             	mov    0x8(%ebp),%edx
+ a0b:	b8 02 00 00 00       	mov    $0x2,%eax
+ a10:	87 02                	xchg   %eax,(%edx)
+ a12:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a15:	eb 1e                	jmp    a35 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ a17:	8b 45 08             	mov    0x8(%ebp),%eax
+ a1a:	83 ec 08             	sub    $0x8,%esp
+ a1d:	6a 02                	push   $0x2
+ a1f:	50                   	push   %eax
+ a20:	e8 f3 fa ff ff       	call   518 <futex_wait>
+ a25:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a28:	8b 55 08             	mov    0x8(%ebp),%edx
+ a2b:	b8 02 00 00 00       	mov    $0x2,%eax
+ a30:	87 02                	xchg   %eax,(%edx)
+ a32:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a35:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a39:	75 dc                	jne    a17 <mutex_lock+0x35>
+ a3b:	eb 01                	jmp    a3e <mutex_lock+0x5c>
+    return;
+ a3d:	90                   	nop
+  }
+}
+ a3e:	c9                   	leave
+ a3f:	c3                   	ret
+
+00000a40 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ a46:	8b 45 08             	mov    0x8(%ebp),%eax
+ a49:	ba 01 00 00 00       	mov    $0x1,%edx
+ a4e:	f7 da                	neg    %edx
+ a50:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ a54:	83 fa 01             	cmp    $0x1,%edx
+ a57:	74 1a                	je     a73 <mutex_unlock+0x33>
+    m->state = 0;
+ a59:	8b 45 08             	mov    0x8(%ebp),%eax
+ a5c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ a62:	8b 45 08             	mov    0x8(%ebp),%eax
+ a65:	83 ec 08             	sub    $0x8,%esp
+ a68:	6a 01                	push   $0x1
+ a6a:	50                   	push   %eax
+ a6b:	e8 b0 fa ff ff       	call   520 <futex_wake>
+ a70:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ a73:	90                   	nop
+ a74:	c9                   	leave
+ a75:	c3                   	ret
+
+00000a76 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ a76:	55                   	push   %ebp
+ a77:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ a79:	8b 45 08             	mov    0x8(%ebp),%eax
+ a7c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ a82:	8b 45 08             	mov    0x8(%ebp),%eax
+ a85:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ a8c:	90                   	nop
+ a8d:	5d                   	pop    %ebp
+ a8e:	c3                   	ret
+
+00000a8f <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ a8f:	55                   	push   %ebp
+ a90:	89 e5                	mov    %esp,%ebp
+ a92:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ a95:	8b 45 08             	mov    0x8(%ebp),%eax
+ a98:	83 c0 04             	add    $0x4,%eax
+ a9b:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa2:	83 ec 08             	sub    $0x8,%esp
+ aa5:	ff 75 0c             	push   0xc(%ebp)
+ aa8:	50                   	push   %eax
+ aa9:	e8 6a fa ff ff       	call   518 <futex_wait>
+ aae:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ ab1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ab4:	83 c0 04             	add    $0x4,%eax
+ ab7:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ abb:	90                   	nop
+ abc:	c9                   	leave
+ abd:	c3                   	ret
+
+00000abe <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ abe:	55                   	push   %ebp
+ abf:	89 e5                	mov    %esp,%ebp
+ ac1:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac7:	8b 00                	mov    (%eax),%eax
+ ac9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ acc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ad0:	78 17                	js     ae9 <rwlock_rdlock+0x2b>
+ ad2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad5:	83 c0 01             	add    $0x1,%eax
+ ad8:	89 c1                	mov    %eax,%ecx
+ ada:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ add:	8b 55 08             	mov    0x8(%ebp),%edx
+ ae0:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ ae4:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ ae7:	74 19                	je     b02 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ ae9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ aed:	79 d5                	jns    ac4 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ aef:	83 ec 08             	sub    $0x8,%esp
+ af2:	ff 75 f4             	push   -0xc(%ebp)
+ af5:	ff 75 08             	push   0x8(%ebp)
+ af8:	e8 92 ff ff ff       	call   a8f <rwlock_sleep>
+ afd:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ b00:	eb c2                	jmp    ac4 <rwlock_rdlock+0x6>
+      return;
+ b02:	90                   	nop
+  }
+}
+ b03:	c9                   	leave
+ b04:	c3                   	ret
+
+00000b05 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ b05:	55                   	push   %ebp
+ b06:	89 e5                	mov    %esp,%ebp
+ b08:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b0b:	eb 11                	jmp    b1e <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ b0d:	83 ec 08             	sub    $0x8,%esp
+ b10:	ff 75 f4             	push   -0xc(%ebp)
+ b13:	ff 75 08             	push   0x8(%ebp)
+ b16:	e8 74 ff ff ff       	call   a8f <rwlock_sleep>
+ b1b:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b1e:	8b 55 08             	mov    0x8(%ebp),%edx
+ b21:	b8 00 00 00 00       	mov    $0x0,%eax
+ b26:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ b2b:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b2f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b32:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b36:	75 d5                	jne    b0d <rwlock_wrlock+0x8>
+}
+ b38:	90                   	nop
+ b39:	90                   	nop
+ b3a:	c9                   	leave
+ b3b:	c3                   	ret
+
+00000b3c <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ b3c:	55                   	push   %ebp
+ b3d:	89 e5                	mov    %esp,%ebp
+ b3f:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ b42:	8b 45 08             	mov    0x8(%ebp),%eax
+ b45:	8b 00                	mov    (%eax),%eax
+ b47:	85 c0                	test   %eax,%eax
+ b49:	79 0c                	jns    b57 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ b4b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4e:	ba 00 00 00 00       	mov    $0x0,%edx
+ b53:	87 10                	xchg   %edx,(%eax)
+ b55:	eb 18                	jmp    b6f <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ b57:	8b 55 08             	mov    0x8(%ebp),%edx
+ b5a:	b8 01 00 00 00       	mov    $0x1,%eax
+ b5f:	f7 d8                	neg    %eax
+ b61:	89 c1                	mov    %eax,%ecx
+ b63:	89 c8                	mov    %ecx,%eax
+ b65:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ b69:	01 c8                	add    %ecx,%eax
+ b6b:	85 c0                	test   %eax,%eax
+ b6d:	75 20                	jne    b8f <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ b6f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b72:	8b 40 04             	mov    0x4(%eax),%eax
+ b75:	85 c0                	test   %eax,%eax
+ b77:	74 17                	je     b90 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ b79:	8b 45 08             	mov    0x8(%ebp),%eax
+ b7c:	83 ec 08             	sub    $0x8,%esp
+ b7f:	68 ff ff ff 7f       	push   $0x7fffffff
+ b84:	50                   	push   %eax
+ b85:	e8 96 f9 ff ff       	call   520 <futex_wake>
+ b8a:	83 c4 10             	add    $0x10,%esp
+ b8d:	eb 01                	jmp    b90 <rwlock_unlock+0x54>
+    return;
+ b8f:	90                   	nop
+}
+ b90:	c9                   	leave
+ b91:	c3                   	ret
+
+00000b92 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ b92:	55                   	push   %ebp
+ b93:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ b95:	8b 45 08             	mov    0x8(%ebp),%eax
+ b98:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b9e:	90                   	nop
+ b9f:	5d                   	pop    %ebp
+ ba0:	c3                   	ret
+
+00000ba1 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ ba1:	55                   	push   %ebp
+ ba2:	89 e5                	mov    %esp,%ebp
+ ba4:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ ba7:	8b 45 08             	mov    0x8(%ebp),%eax
+ baa:	8b 00                	mov    (%eax),%eax
+ bac:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ baf:	83 ec 0c             	sub    $0xc,%esp
+ bb2:	ff 75 0c             	push   0xc(%ebp)
+ bb5:	e8 86 fe ff ff       	call   a40 <mutex_unlock>
+ bba:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+ bc0:	83 ec 08             	sub    $0x8,%esp
+ bc3:	ff 75 f4             	push   -0xc(%ebp)
+ bc6:	50                   	push   %eax
+ bc7:	e8 4c f9 ff ff       	call   518 <futex_wait>
+ bcc:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ bcf:	83 ec 0c             	sub    $0xc,%esp
+ bd2:	ff 75 0c             	push   0xc(%ebp)
+ bd5:	e8 08 fe ff ff       	call   9e2 <mutex_lock>
+ bda:	83 c4 10             	add    $0x10,%esp
+}
+ bdd:	90                   	nop
+ bde:	c9                   	leave
+ bdf:	c3                   	ret
+
+00000be0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ be6:	8b 45 08             	mov    0x8(%ebp),%eax
+ be9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ bed:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf0:	83 ec 08             	sub    $0x8,%esp
+ bf3:	6a 01                	push   $0x1
+ bf5:	50                   	push   %eax
+ bf6:	e8 25 f9 ff ff       	call   520 <futex_wake>
+ bfb:	83 c4 10             	add    $0x10,%esp
+}
+ bfe:	90                   	nop
+ bff:	c9                   	leave
+ c00:	c3                   	ret
+
+00000c01 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ c01:	55                   	push   %ebp
+ c02:	89 e5                	mov    %esp,%ebp
+ c04:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c07:	8b 45 08             	mov    0x8(%ebp),%eax
+ c0a:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ c0e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c11:	83 ec 08             	sub    $0x8,%esp
+ c14:	68 ff ff ff 7f       	push   $0x7fffffff
+ c19:	50                   	push   %eax
+ c1a:	e8 01 f9 ff ff       	call   520 <futex_wake>
+ c1f:	83 c4 10             	add    $0x10,%esp
+}
+ c22:	90                   	nop
+ c23:	c9                   	leave
+ c24:	c3                   	ret
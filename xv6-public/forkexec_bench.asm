@@ -0,0 +1,1873 @@
+
+_forkexec_bench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rdtsc>:
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+   6:	0f 31                	rdtsc
+   8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+   b:	89 55 fc             	mov    %edx,-0x4(%ebp)
+   e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  11:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  14:	c9                   	leave
+  15:	c3                   	ret
+
+00000016 <run>:
+{
+  16:	55                   	push   %ebp
+  17:	89 e5                	mov    %esp,%ebp
+  19:	83 ec 28             	sub    $0x28,%esp
+    char *argv[] = {"forkexec_bench", "-c", 0};
+  1c:	c7 45 d8 5c 0d 00 00 	movl   $0xd5c,-0x28(%ebp)
+  23:	c7 45 dc 6b 0d 00 00 	movl   $0xd6b,-0x24(%ebp)
+  2a:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+    start = rdtsc();
+  31:	e8 ca ff ff ff       	call   0 <rdtsc>
+  36:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  39:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    for (i = 0; i < NFORKS; i++)
+  3c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  43:	eb 64                	jmp    a9 <run+0x93>
+        pid = fork();
+  45:	e8 93 04 00 00       	call   4dd <fork>
+  4a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if (pid < 0)
+  4d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  51:	79 17                	jns    6a <run+0x54>
+            printf(1, "forkexec_bench: fork failed\n");
+  53:	83 ec 08             	sub    $0x8,%esp
+  56:	68 6e 0d 00 00       	push   $0xd6e
+  5b:	6a 01                	push   $0x1
+  5d:	e8 ef 06 00 00       	call   751 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+            exit();
+  65:	e8 7b 04 00 00       	call   4e5 <exit>
+        if (pid == 0)
+  6a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  6e:	75 30                	jne    a0 <run+0x8a>
+            if (do_exec)
+  70:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  74:	74 25                	je     9b <run+0x85>
+                exec(argv[0], argv);
+  76:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  79:	83 ec 08             	sub    $0x8,%esp
+  7c:	8d 55 d8             	lea    -0x28(%ebp),%edx
+  7f:	52                   	push   %edx
+  80:	50                   	push   %eax
+  81:	e8 97 04 00 00       	call   51d <exec>
+  86:	83 c4 10             	add    $0x10,%esp
+                printf(1, "forkexec_bench: exec failed\n");
+  89:	83 ec 08             	sub    $0x8,%esp
+  8c:	68 8b 0d 00 00       	push   $0xd8b
+  91:	6a 01                	push   $0x1
+  93:	e8 b9 06 00 00       	call   751 <printf>
+  98:	83 c4 10             	add    $0x10,%esp
+            exit();
+  9b:	e8 45 04 00 00       	call   4e5 <exit>
+        wait();
+  a0:	e8 48 04 00 00       	call   4ed <wait>
+    for (i = 0; i < NFORKS; i++)
+  a5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  a9:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+  ad:	7e 96                	jle    45 <run+0x2f>
+    return rdtsc() - start;
+  af:	e8 4c ff ff ff       	call   0 <rdtsc>
+  b4:	2b 45 e8             	sub    -0x18(%ebp),%eax
+  b7:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+}
+  ba:	c9                   	leave
+  bb:	c3                   	ret
+
+000000bc <main>:
+{
+  bc:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  c0:	83 e4 f0             	and    $0xfffffff0,%esp
+  c3:	ff 71 fc             	push   -0x4(%ecx)
+  c6:	55                   	push   %ebp
+  c7:	89 e5                	mov    %esp,%ebp
+  c9:	51                   	push   %ecx
+  ca:	83 ec 14             	sub    $0x14,%esp
+  cd:	89 c8                	mov    %ecx,%eax
+    if (argc > 1 && strcmp(argv[1], "-c") == 0)
+  cf:	83 38 01             	cmpl   $0x1,(%eax)
+  d2:	7e 22                	jle    f6 <main+0x3a>
+  d4:	8b 40 04             	mov    0x4(%eax),%eax
+  d7:	83 c0 04             	add    $0x4,%eax
+  da:	8b 00                	mov    (%eax),%eax
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 6b 0d 00 00       	push   $0xd6b
+  e4:	50                   	push   %eax
+  e5:	e8 20 01 00 00       	call   20a <strcmp>
+  ea:	83 c4 10             	add    $0x10,%esp
+  ed:	85 c0                	test   %eax,%eax
+  ef:	75 05                	jne    f6 <main+0x3a>
+        exit();
+  f1:	e8 ef 03 00 00       	call   4e5 <exit>
+    heap = sbrk(HEAP);
+  f6:	83 ec 0c             	sub    $0xc,%esp
+  f9:	68 00 00 04 00       	push   $0x40000
+  fe:	e8 6a 04 00 00       	call   56d <sbrk>
+ 103:	83 c4 10             	add    $0x10,%esp
+ 106:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if (heap == (char *)-1)
+ 109:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 10d:	75 17                	jne    126 <main+0x6a>
+        printf(1, "forkexec_bench: sbrk failed\n");
+ 10f:	83 ec 08             	sub    $0x8,%esp
+ 112:	68 a8 0d 00 00       	push   $0xda8
+ 117:	6a 01                	push   $0x1
+ 119:	e8 33 06 00 00       	call   751 <printf>
+ 11e:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 121:	e8 bf 03 00 00       	call   4e5 <exit>
+    memset(heap, 'a', HEAP);
+ 126:	83 ec 04             	sub    $0x4,%esp
+ 129:	68 00 00 04 00       	push   $0x40000
+ 12e:	6a 61                	push   $0x61
+ 130:	ff 75 f4             	push   -0xc(%ebp)
+ 133:	e8 38 01 00 00       	call   270 <memset>
+ 138:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d forks with %d KB of heap, cycles per fork:\n", NFORKS, HEAP / 1024);
+ 13b:	68 00 01 00 00       	push   $0x100
+ 140:	6a 40                	push   $0x40
+ 142:	68 c8 0d 00 00       	push   $0xdc8
+ 147:	6a 01                	push   $0x1
+ 149:	e8 03 06 00 00       	call   751 <printf>
+ 14e:	83 c4 10             	add    $0x10,%esp
+    printf(1, "fork, exit: %d\n", (int)udiv64(run(0), NFORKS));
+ 151:	83 ec 0c             	sub    $0xc,%esp
+ 154:	6a 00                	push   $0x0
+ 156:	e8 bb fe ff ff       	call   16 <run>
+ 15b:	83 c4 10             	add    $0x10,%esp
+ 15e:	83 ec 04             	sub    $0x4,%esp
+ 161:	6a 40                	push   $0x40
+ 163:	52                   	push   %edx
+ 164:	50                   	push   %eax
+ 165:	e8 99 02 00 00       	call   403 <udiv64>
+ 16a:	83 c4 10             	add    $0x10,%esp
+ 16d:	83 ec 04             	sub    $0x4,%esp
+ 170:	50                   	push   %eax
+ 171:	68 f7 0d 00 00       	push   $0xdf7
+ 176:	6a 01                	push   $0x1
+ 178:	e8 d4 05 00 00       	call   751 <printf>
+ 17d:	83 c4 10             	add    $0x10,%esp
+    printf(1, "fork, exec: %d\n", (int)udiv64(run(1), NFORKS));
+ 180:	83 ec 0c             	sub    $0xc,%esp
+ 183:	6a 01                	push   $0x1
+ 185:	e8 8c fe ff ff       	call   16 <run>
+ 18a:	83 c4 10             	add    $0x10,%esp
+ 18d:	83 ec 04             	sub    $0x4,%esp
+ 190:	6a 40                	push   $0x40
+ 192:	52                   	push   %edx
+ 193:	50                   	push   %eax
+ 194:	e8 6a 02 00 00       	call   403 <udiv64>
+ 199:	83 c4 10             	add    $0x10,%esp
+ 19c:	83 ec 04             	sub    $0x4,%esp
+ 19f:	50                   	push   %eax
+ 1a0:	68 07 0e 00 00       	push   $0xe07
+ 1a5:	6a 01                	push   $0x1
+ 1a7:	e8 a5 05 00 00       	call   751 <printf>
+ 1ac:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 1af:	e8 31 03 00 00       	call   4e5 <exit>
+
+000001b4 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 1b4:	55                   	push   %ebp
+ 1b5:	89 e5                	mov    %esp,%ebp
+ 1b7:	57                   	push   %edi
+ 1b8:	53                   	push   %ebx
+{
+ 1b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1bc:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c2:	89 cb                	mov    %ecx,%ebx
+ 1c4:	89 df                	mov    %ebx,%edi
+ 1c6:	89 d1                	mov    %edx,%ecx
+ 1c8:	fc                   	cld
+ 1c9:	f3 aa                	rep stos %al,%es:(%edi)
+ 1cb:	89 ca                	mov    %ecx,%edx
+ 1cd:	89 fb                	mov    %edi,%ebx
+ 1cf:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1d2:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 1d5:	90                   	nop
+ 1d6:	5b                   	pop    %ebx
+ 1d7:	5f                   	pop    %edi
+ 1d8:	5d                   	pop    %ebp
+ 1d9:	c3                   	ret
+
+000001da <strcpy>:
+{
+ 1da:	55                   	push   %ebp
+ 1db:	89 e5                	mov    %esp,%ebp
+ 1dd:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1e6:	90                   	nop
+ 1e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1ea:	8d 42 01             	lea    0x1(%edx),%eax
+ 1ed:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1f6:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1f9:	0f b6 12             	movzbl (%edx),%edx
+ 1fc:	88 10                	mov    %dl,(%eax)
+ 1fe:	0f b6 00             	movzbl (%eax),%eax
+ 201:	84 c0                	test   %al,%al
+ 203:	75 e2                	jne    1e7 <strcpy+0xd>
+  return os;
+ 205:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 208:	c9                   	leave
+ 209:	c3                   	ret
+
+0000020a <strcmp>:
+{
+ 20a:	55                   	push   %ebp
+ 20b:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 20d:	eb 08                	jmp    217 <strcmp+0xd>
+    p++, q++;
+ 20f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 213:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 217:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21a:	0f b6 00             	movzbl (%eax),%eax
+ 21d:	84 c0                	test   %al,%al
+ 21f:	74 10                	je     231 <strcmp+0x27>
+ 221:	8b 45 08             	mov    0x8(%ebp),%eax
+ 224:	0f b6 10             	movzbl (%eax),%edx
+ 227:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22a:	0f b6 00             	movzbl (%eax),%eax
+ 22d:	38 c2                	cmp    %al,%dl
+ 22f:	74 de                	je     20f <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 231:	8b 45 08             	mov    0x8(%ebp),%eax
+ 234:	0f b6 00             	movzbl (%eax),%eax
+ 237:	0f b6 d0             	movzbl %al,%edx
+ 23a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 23d:	0f b6 00             	movzbl (%eax),%eax
+ 240:	0f b6 c0             	movzbl %al,%eax
+ 243:	29 c2                	sub    %eax,%edx
+ 245:	89 d0                	mov    %edx,%eax
+}
+ 247:	5d                   	pop    %ebp
+ 248:	c3                   	ret
+
+00000249 <strlen>:
+{
+ 249:	55                   	push   %ebp
+ 24a:	89 e5                	mov    %esp,%ebp
+ 24c:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 24f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 256:	eb 04                	jmp    25c <strlen+0x13>
+ 258:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 25c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 25f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 262:	01 d0                	add    %edx,%eax
+ 264:	0f b6 00             	movzbl (%eax),%eax
+ 267:	84 c0                	test   %al,%al
+ 269:	75 ed                	jne    258 <strlen+0xf>
+  return n;
+ 26b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 26e:	c9                   	leave
+ 26f:	c3                   	ret
+
+00000270 <memset>:
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 273:	8b 45 10             	mov    0x10(%ebp),%eax
+ 276:	50                   	push   %eax
+ 277:	ff 75 0c             	push   0xc(%ebp)
+ 27a:	ff 75 08             	push   0x8(%ebp)
+ 27d:	e8 32 ff ff ff       	call   1b4 <stosb>
+ 282:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 285:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 288:	c9                   	leave
+ 289:	c3                   	ret
+
+0000028a <strchr>:
+{
+ 28a:	55                   	push   %ebp
+ 28b:	89 e5                	mov    %esp,%ebp
+ 28d:	83 ec 04             	sub    $0x4,%esp
+ 290:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 293:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 296:	eb 14                	jmp    2ac <strchr+0x22>
+    if(*s == c)
+ 298:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29b:	0f b6 00             	movzbl (%eax),%eax
+ 29e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2a1:	75 05                	jne    2a8 <strchr+0x1e>
+      return (char*)s;
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	eb 13                	jmp    2bb <strchr+0x31>
+  for(; *s; s++)
+ 2a8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2af:	0f b6 00             	movzbl (%eax),%eax
+ 2b2:	84 c0                	test   %al,%al
+ 2b4:	75 e2                	jne    298 <strchr+0xe>
+  return 0;
+ 2b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2bb:	c9                   	leave
+ 2bc:	c3                   	ret
+
+000002bd <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2bd:	55                   	push   %ebp
+ 2be:	89 e5                	mov    %esp,%ebp
+ 2c0:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2c3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2ca:	eb 42                	jmp    30e <gets+0x51>
+    cc = read(0, &c, 1);
+ 2cc:	83 ec 04             	sub    $0x4,%esp
+ 2cf:	6a 01                	push   $0x1
+ 2d1:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2d4:	50                   	push   %eax
+ 2d5:	6a 00                	push   $0x0
+ 2d7:	e8 21 02 00 00       	call   4fd <read>
+ 2dc:	83 c4 10             	add    $0x10,%esp
+ 2df:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2e2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2e6:	7e 33                	jle    31b <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 2e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2eb:	8d 50 01             	lea    0x1(%eax),%edx
+ 2ee:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2f1:	89 c2                	mov    %eax,%edx
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	01 c2                	add    %eax,%edx
+ 2f8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2fc:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2fe:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 302:	3c 0a                	cmp    $0xa,%al
+ 304:	74 16                	je     31c <gets+0x5f>
+ 306:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 30a:	3c 0d                	cmp    $0xd,%al
+ 30c:	74 0e                	je     31c <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 30e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 311:	83 c0 01             	add    $0x1,%eax
+ 314:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 317:	7f b3                	jg     2cc <gets+0xf>
+ 319:	eb 01                	jmp    31c <gets+0x5f>
+      break;
+ 31b:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 31c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 31f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 322:	01 d0                	add    %edx,%eax
+ 324:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 327:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+
+0000032c <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 32c:	55                   	push   %ebp
+ 32d:	89 e5                	mov    %esp,%ebp
+ 32f:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 332:	83 ec 08             	sub    $0x8,%esp
+ 335:	6a 00                	push   $0x0
+ 337:	ff 75 08             	push   0x8(%ebp)
+ 33a:	e8 e6 01 00 00       	call   525 <open>
+ 33f:	83 c4 10             	add    $0x10,%esp
+ 342:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 345:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 349:	79 07                	jns    352 <stat+0x26>
+    return -1;
+ 34b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 350:	eb 25                	jmp    377 <stat+0x4b>
+  r = fstat(fd, st);
+ 352:	83 ec 08             	sub    $0x8,%esp
+ 355:	ff 75 0c             	push   0xc(%ebp)
+ 358:	ff 75 f4             	push   -0xc(%ebp)
+ 35b:	e8 dd 01 00 00       	call   53d <fstat>
+ 360:	83 c4 10             	add    $0x10,%esp
+ 363:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 366:	83 ec 0c             	sub    $0xc,%esp
+ 369:	ff 75 f4             	push   -0xc(%ebp)
+ 36c:	e8 9c 01 00 00       	call   50d <close>
+ 371:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 374:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 377:	c9                   	leave
+ 378:	c3                   	ret
+
+00000379 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 379:	55                   	push   %ebp
+ 37a:	89 e5                	mov    %esp,%ebp
+ 37c:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 37f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 386:	eb 25                	jmp    3ad <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 388:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 38b:	89 d0                	mov    %edx,%eax
+ 38d:	c1 e0 02             	shl    $0x2,%eax
+ 390:	01 d0                	add    %edx,%eax
+ 392:	01 c0                	add    %eax,%eax
+ 394:	89 c1                	mov    %eax,%ecx
+ 396:	8b 45 08             	mov    0x8(%ebp),%eax
+ 399:	8d 50 01             	lea    0x1(%eax),%edx
+ 39c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 39f:	0f b6 00             	movzbl (%eax),%eax
+ 3a2:	0f be c0             	movsbl %al,%eax
+ 3a5:	01 c8                	add    %ecx,%eax
+ 3a7:	83 e8 30             	sub    $0x30,%eax
+ 3aa:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b0:	0f b6 00             	movzbl (%eax),%eax
+ 3b3:	3c 2f                	cmp    $0x2f,%al
+ 3b5:	7e 0a                	jle    3c1 <atoi+0x48>
+ 3b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ba:	0f b6 00             	movzbl (%eax),%eax
+ 3bd:	3c 39                	cmp    $0x39,%al
+ 3bf:	7e c7                	jle    388 <atoi+0xf>
+  return n;
+ 3c1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3c4:	c9                   	leave
+ 3c5:	c3                   	ret
+
+000003c6 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3c6:	55                   	push   %ebp
+ 3c7:	89 e5                	mov    %esp,%ebp
+ 3c9:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 3cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3d5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3d8:	eb 17                	jmp    3f1 <memmove+0x2b>
+    *dst++ = *src++;
+ 3da:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3dd:	8d 42 01             	lea    0x1(%edx),%eax
+ 3e0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3e6:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3e9:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3ec:	0f b6 12             	movzbl (%edx),%edx
+ 3ef:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3f1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3f4:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3f7:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3fa:	85 c0                	test   %eax,%eax
+ 3fc:	7f dc                	jg     3da <memmove+0x14>
+  return vdst;
+ 3fe:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 401:	c9                   	leave
+ 402:	c3                   	ret
+
+00000403 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 403:	55                   	push   %ebp
+ 404:	89 e5                	mov    %esp,%ebp
+ 406:	57                   	push   %edi
+ 407:	56                   	push   %esi
+ 408:	83 ec 30             	sub    $0x30,%esp
+ 40b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 40e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 411:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 414:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 417:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 41e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 425:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 428:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 42b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 42e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 431:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 438:	e9 89 00 00 00       	jmp    4c6 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 43d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 440:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 443:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 447:	01 c0                	add    %eax,%eax
+ 449:	89 c6                	mov    %eax,%esi
+ 44b:	89 d7                	mov    %edx,%edi
+ 44d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 450:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 453:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 456:	0f ad d0             	shrd   %cl,%edx,%eax
+ 459:	d3 ea                	shr    %cl,%edx
+ 45b:	f6 c1 20             	test   $0x20,%cl
+ 45e:	74 04                	je     464 <udiv64+0x61>
+ 460:	89 d0                	mov    %edx,%eax
+ 462:	31 d2                	xor    %edx,%edx
+ 464:	83 e0 01             	and    $0x1,%eax
+ 467:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 46a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 471:	89 f0                	mov    %esi,%eax
+ 473:	89 fa                	mov    %edi,%edx
+ 475:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 478:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 47b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 47e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 481:	8b 45 10             	mov    0x10(%ebp),%eax
+ 484:	ba 00 00 00 00       	mov    $0x0,%edx
+ 489:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 48c:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 48f:	19 d1                	sbb    %edx,%ecx
+ 491:	72 2f                	jb     4c2 <udiv64+0xbf>
+      r -= d;
+ 493:	8b 45 10             	mov    0x10(%ebp),%eax
+ 496:	ba 00 00 00 00       	mov    $0x0,%edx
+ 49b:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 49e:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 4a1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 4a4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4a9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4ae:	0f a5 c2             	shld   %cl,%eax,%edx
+ 4b1:	d3 e0                	shl    %cl,%eax
+ 4b3:	f6 c1 20             	test   $0x20,%cl
+ 4b6:	74 04                	je     4bc <udiv64+0xb9>
+ 4b8:	89 c2                	mov    %eax,%edx
+ 4ba:	31 c0                	xor    %eax,%eax
+ 4bc:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 4bf:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 4c2:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 4c6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 4ca:	0f 89 6d ff ff ff    	jns    43d <udiv64+0x3a>
+    }
+  }
+  return q;
+ 4d0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 4d3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 4d6:	83 c4 30             	add    $0x30,%esp
+ 4d9:	5e                   	pop    %esi
+ 4da:	5f                   	pop    %edi
+ 4db:	5d                   	pop    %ebp
+ 4dc:	c3                   	ret
+
+000004dd <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4dd:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4e2:	cd 40                	int    $0x40
+ 4e4:	c3                   	ret
+
+000004e5 <exit>:
+SYSCALL(exit)
+ 4e5:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4ea:	cd 40                	int    $0x40
+ 4ec:	c3                   	ret
+
+000004ed <wait>:
+SYSCALL(wait)
+ 4ed:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4f2:	cd 40                	int    $0x40
+ 4f4:	c3                   	ret
+
+000004f5 <pipe>:
+SYSCALL(pipe)
+ 4f5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4fa:	cd 40                	int    $0x40
+ 4fc:	c3                   	ret
+
+000004fd <read>:
+SYSCALL(read)
+ 4fd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 502:	cd 40                	int    $0x40
+ 504:	c3                   	ret
+
+00000505 <write>:
+SYSCALL(write)
+ 505:	b8 10 00 00 00       	mov    $0x10,%eax
+ 50a:	cd 40                	int    $0x40
+ 50c:	c3                   	ret
+
+0000050d <close>:
+SYSCALL(close)
+ 50d:	b8 15 00 00 00       	mov    $0x15,%eax
+ 512:	cd 40                	int    $0x40
+ 514:	c3                   	ret
+
+00000515 <kill>:
+SYSCALL(kill)
+ 515:	b8 06 00 00 00       	mov    $0x6,%eax
+ 51a:	cd 40                	int    $0x40
+ 51c:	c3                   	ret
+
+0000051d <exec>:
+SYSCALL(exec)
+ 51d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 522:	cd 40                	int    $0x40
+ 524:	c3                   	ret
+
+00000525 <open>:
+SYSCALL(open)
+ 525:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 52a:	cd 40                	int    $0x40
+ 52c:	c3                   	ret
+
+0000052d <mknod>:
+SYSCALL(mknod)
+ 52d:	b8 11 00 00 00       	mov    $0x11,%eax
+ 532:	cd 40                	int    $0x40
+ 534:	c3                   	ret
+
+00000535 <unlink>:
+SYSCALL(unlink)
+ 535:	b8 12 00 00 00       	mov    $0x12,%eax
+ 53a:	cd 40                	int    $0x40
+ 53c:	c3                   	ret
+
+0000053d <fstat>:
+SYSCALL(fstat)
+ 53d:	b8 08 00 00 00       	mov    $0x8,%eax
+ 542:	cd 40                	int    $0x40
+ 544:	c3                   	ret
+
+00000545 <link>:
+SYSCALL(link)
+ 545:	b8 13 00 00 00       	mov    $0x13,%eax
+ 54a:	cd 40                	int    $0x40
+ 54c:	c3                   	ret
+
+0000054d <mkdir>:
+SYSCALL(mkdir)
+ 54d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 552:	cd 40                	int    $0x40
+ 554:	c3                   	ret
+
+00000555 <chdir>:
+SYSCALL(chdir)
+ 555:	b8 09 00 00 00       	mov    $0x9,%eax
+ 55a:	cd 40                	int    $0x40
+ 55c:	c3                   	ret
+
+0000055d <dup>:
+SYSCALL(dup)
+ 55d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 562:	cd 40                	int    $0x40
+ 564:	c3                   	ret
+
+00000565 <getpid>:
+SYSCALL(getpid)
+ 565:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 56a:	cd 40                	int    $0x40
+ 56c:	c3                   	ret
+
+0000056d <sbrk>:
+SYSCALL(sbrk)
+ 56d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 572:	cd 40                	int    $0x40
+ 574:	c3                   	ret
+
+00000575 <sleep>:
+SYSCALL(sleep)
+ 575:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 57a:	cd 40                	int    $0x40
+ 57c:	c3                   	ret
+
+0000057d <uptime>:
+SYSCALL(uptime)
+ 57d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 582:	cd 40                	int    $0x40
+ 584:	c3                   	ret
+
+00000585 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 585:	b8 16 00 00 00       	mov    $0x16,%eax
+ 58a:	cd 40                	int    $0x40
+ 58c:	c3                   	ret
+
+0000058d <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 58d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 592:	cd 40                	int    $0x40
+ 594:	c3                   	ret
+
+00000595 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 595:	b8 18 00 00 00       	mov    $0x18,%eax
+ 59a:	cd 40                	int    $0x40
+ 59c:	c3                   	ret
+
+0000059d <copy_file>:
+SYSCALL(copy_file)
+ 59d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5a2:	cd 40                	int    $0x40
+ 5a4:	c3                   	ret
+
+000005a5 <change_queue>:
+SYSCALL(change_queue)
+ 5a5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5aa:	cd 40                	int    $0x40
+ 5ac:	c3                   	ret
+
+000005ad <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 5ad:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5b2:	cd 40                	int    $0x40
+ 5b4:	c3                   	ret
+
+000005b5 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 5b5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5ba:	cd 40                	int    $0x40
+ 5bc:	c3                   	ret
+
+000005bd <print_process_info>:
+SYSCALL(print_process_info)
+ 5bd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5c2:	cd 40                	int    $0x40
+ 5c4:	c3                   	ret
+
+000005c5 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 5c5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5ca:	cd 40                	int    $0x40
+ 5cc:	c3                   	ret
+
+000005cd <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 5cd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5d2:	cd 40                	int    $0x40
+ 5d4:	c3                   	ret
+
+000005d5 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 5d5:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5da:	cd 40                	int    $0x40
+ 5dc:	c3                   	ret
+
+000005dd <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 5dd:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5e2:	cd 40                	int    $0x40
+ 5e4:	c3                   	ret
+
+000005e5 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 5e5:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5ea:	cd 40                	int    $0x40
+ 5ec:	c3                   	ret
+
+000005ed <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 5ed:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5f2:	cd 40                	int    $0x40
+ 5f4:	c3                   	ret
+
+000005f5 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 5f5:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5fa:	cd 40                	int    $0x40
+ 5fc:	c3                   	ret
+
+000005fd <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 5fd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 602:	cd 40                	int    $0x40
+ 604:	c3                   	ret
+
+00000605 <set_affinity>:
+SYSCALL(set_affinity)
+ 605:	b8 26 00 00 00       	mov    $0x26,%eax
+ 60a:	cd 40                	int    $0x40
+ 60c:	c3                   	ret
+
+0000060d <setsched>:
+SYSCALL(setsched)
+ 60d:	b8 27 00 00 00       	mov    $0x27,%eax
+ 612:	cd 40                	int    $0x40
+ 614:	c3                   	ret
+
+00000615 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 615:	b8 28 00 00 00       	mov    $0x28,%eax
+ 61a:	cd 40                	int    $0x40
+ 61c:	c3                   	ret
+
+0000061d <set_quantum>:
+SYSCALL(set_quantum)
+ 61d:	b8 29 00 00 00       	mov    $0x29,%eax
+ 622:	cd 40                	int    $0x40
+ 624:	c3                   	ret
+
+00000625 <schedtrace>:
+SYSCALL(schedtrace)
+ 625:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 62a:	cd 40                	int    $0x40
+ 62c:	c3                   	ret
+
+0000062d <getrusage>:
+SYSCALL(getrusage)
+ 62d:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 632:	cd 40                	int    $0x40
+ 634:	c3                   	ret
+
+00000635 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 635:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 63a:	cd 40                	int    $0x40
+ 63c:	c3                   	ret
+
+0000063d <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 63d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 642:	cd 40                	int    $0x40
+ 644:	c3                   	ret
+
+00000645 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 645:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 64a:	cd 40                	int    $0x40
+ 64c:	c3                   	ret
+
+0000064d <futex_wait>:
+SYSCALL(futex_wait)
+ 64d:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 652:	cd 40                	int    $0x40
+ 654:	c3                   	ret
+
+00000655 <futex_wake>:
+SYSCALL(futex_wake)
+ 655:	b8 30 00 00 00       	mov    $0x30,%eax
+ 65a:	cd 40                	int    $0x40
+ 65c:	c3                   	ret
+
+0000065d <syscall_latency>:
+SYSCALL(syscall_latency)
+ 65d:	b8 31 00 00 00       	mov    $0x31,%eax
+ 662:	cd 40                	int    $0x40
+ 664:	c3                   	ret
+
+00000665 <submit_batch>:
+SYSCALL(submit_batch)
+ 665:	b8 32 00 00 00       	mov    $0x32,%eax
+ 66a:	cd 40                	int    $0x40
+ 66c:	c3                   	ret
+
+0000066d <kmem_stats>:
+SYSCALL(kmem_stats)
+ 66d:	b8 33 00 00 00       	mov    $0x33,%eax
+ 672:	cd 40                	int    $0x40
+ 674:	c3                   	ret
+
+00000675 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 675:	b8 34 00 00 00       	mov    $0x34,%eax
+ 67a:	cd 40                	int    $0x40
+ 67c:	c3                   	ret
+
+0000067d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 67d:	55                   	push   %ebp
+ 67e:	89 e5                	mov    %esp,%ebp
+ 680:	83 ec 18             	sub    $0x18,%esp
+ 683:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 686:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 689:	83 ec 04             	sub    $0x4,%esp
+ 68c:	6a 01                	push   $0x1
+ 68e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 691:	50                   	push   %eax
+ 692:	ff 75 08             	push   0x8(%ebp)
+ 695:	e8 6b fe ff ff       	call   505 <write>
+ 69a:	83 c4 10             	add    $0x10,%esp
+}
+ 69d:	90                   	nop
+ 69e:	c9                   	leave
+ 69f:	c3                   	ret
+
+000006a0 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 6a6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6ad:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6b1:	74 17                	je     6ca <printint+0x2a>
+ 6b3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6b7:	79 11                	jns    6ca <printint+0x2a>
+    neg = 1;
+ 6b9:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 6c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6c3:	f7 d8                	neg    %eax
+ 6c5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6c8:	eb 06                	jmp    6d0 <printint+0x30>
+  } else {
+    x = xx;
+ 6ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6cd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 6d0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6da:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6dd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6e2:	f7 f1                	div    %ecx
+ 6e4:	89 d1                	mov    %edx,%ecx
+ 6e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e9:	8d 50 01             	lea    0x1(%eax),%edx
+ 6ec:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6ef:	0f b6 91 4c 12 00 00 	movzbl 0x124c(%ecx),%edx
+ 6f6:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 6fa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6fd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 700:	ba 00 00 00 00       	mov    $0x0,%edx
+ 705:	f7 f1                	div    %ecx
+ 707:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 70a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 70e:	75 c7                	jne    6d7 <printint+0x37>
+  if(neg)
+ 710:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 714:	74 2d                	je     743 <printint+0xa3>
+    buf[i++] = '-';
+ 716:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 719:	8d 50 01             	lea    0x1(%eax),%edx
+ 71c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 71f:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 724:	eb 1d                	jmp    743 <printint+0xa3>
+    putc(fd, buf[i]);
+ 726:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 729:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72c:	01 d0                	add    %edx,%eax
+ 72e:	0f b6 00             	movzbl (%eax),%eax
+ 731:	0f be c0             	movsbl %al,%eax
+ 734:	83 ec 08             	sub    $0x8,%esp
+ 737:	50                   	push   %eax
+ 738:	ff 75 08             	push   0x8(%ebp)
+ 73b:	e8 3d ff ff ff       	call   67d <putc>
+ 740:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 743:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 747:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 74b:	79 d9                	jns    726 <printint+0x86>
+}
+ 74d:	90                   	nop
+ 74e:	90                   	nop
+ 74f:	c9                   	leave
+ 750:	c3                   	ret
+
+00000751 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 751:	55                   	push   %ebp
+ 752:	89 e5                	mov    %esp,%ebp
+ 754:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 757:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 75e:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 761:	83 c0 04             	add    $0x4,%eax
+ 764:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 767:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 76e:	e9 59 01 00 00       	jmp    8cc <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 773:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 776:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 779:	01 d0                	add    %edx,%eax
+ 77b:	0f b6 00             	movzbl (%eax),%eax
+ 77e:	0f be c0             	movsbl %al,%eax
+ 781:	25 ff 00 00 00       	and    $0xff,%eax
+ 786:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 789:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 78d:	75 2c                	jne    7bb <printf+0x6a>
+      if(c == '%'){
+ 78f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 793:	75 0c                	jne    7a1 <printf+0x50>
+        state = '%';
+ 795:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 79c:	e9 27 01 00 00       	jmp    8c8 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 7a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7a4:	0f be c0             	movsbl %al,%eax
+ 7a7:	83 ec 08             	sub    $0x8,%esp
+ 7aa:	50                   	push   %eax
+ 7ab:	ff 75 08             	push   0x8(%ebp)
+ 7ae:	e8 ca fe ff ff       	call   67d <putc>
+ 7b3:	83 c4 10             	add    $0x10,%esp
+ 7b6:	e9 0d 01 00 00       	jmp    8c8 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 7bb:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 7bf:	0f 85 03 01 00 00    	jne    8c8 <printf+0x177>
+      if(c == 'd'){
+ 7c5:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 7c9:	75 1e                	jne    7e9 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 7cb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7ce:	8b 00                	mov    (%eax),%eax
+ 7d0:	6a 01                	push   $0x1
+ 7d2:	6a 0a                	push   $0xa
+ 7d4:	50                   	push   %eax
+ 7d5:	ff 75 08             	push   0x8(%ebp)
+ 7d8:	e8 c3 fe ff ff       	call   6a0 <printint>
+ 7dd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7e0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7e4:	e9 d8 00 00 00       	jmp    8c1 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 7e9:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 7ed:	74 06                	je     7f5 <printf+0xa4>
+ 7ef:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7f3:	75 1e                	jne    813 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 7f5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7f8:	8b 00                	mov    (%eax),%eax
+ 7fa:	6a 00                	push   $0x0
+ 7fc:	6a 10                	push   $0x10
+ 7fe:	50                   	push   %eax
+ 7ff:	ff 75 08             	push   0x8(%ebp)
+ 802:	e8 99 fe ff ff       	call   6a0 <printint>
+ 807:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 80a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 80e:	e9 ae 00 00 00       	jmp    8c1 <printf+0x170>
+      } else if(c == 's'){
+ 813:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 817:	75 43                	jne    85c <printf+0x10b>
+        s = (char*)*ap;
+ 819:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 81c:	8b 00                	mov    (%eax),%eax
+ 81e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 821:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 825:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 829:	75 25                	jne    850 <printf+0xff>
+          s = "(null)";
+ 82b:	c7 45 f4 17 0e 00 00 	movl   $0xe17,-0xc(%ebp)
+        while(*s != 0){
+ 832:	eb 1c                	jmp    850 <printf+0xff>
+          putc(fd, *s);
+ 834:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 837:	0f b6 00             	movzbl (%eax),%eax
+ 83a:	0f be c0             	movsbl %al,%eax
+ 83d:	83 ec 08             	sub    $0x8,%esp
+ 840:	50                   	push   %eax
+ 841:	ff 75 08             	push   0x8(%ebp)
+ 844:	e8 34 fe ff ff       	call   67d <putc>
+ 849:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 84c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 850:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 853:	0f b6 00             	movzbl (%eax),%eax
+ 856:	84 c0                	test   %al,%al
+ 858:	75 da                	jne    834 <printf+0xe3>
+ 85a:	eb 65                	jmp    8c1 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 85c:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 860:	75 1d                	jne    87f <printf+0x12e>
+        putc(fd, *ap);
+ 862:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 865:	8b 00                	mov    (%eax),%eax
+ 867:	0f be c0             	movsbl %al,%eax
+ 86a:	83 ec 08             	sub    $0x8,%esp
+ 86d:	50                   	push   %eax
+ 86e:	ff 75 08             	push   0x8(%ebp)
+ 871:	e8 07 fe ff ff       	call   67d <putc>
+ 876:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 879:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 87d:	eb 42                	jmp    8c1 <printf+0x170>
+      } else if(c == '%'){
+ 87f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 883:	75 17                	jne    89c <printf+0x14b>
+        putc(fd, c);
+ 885:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 888:	0f be c0             	movsbl %al,%eax
+ 88b:	83 ec 08             	sub    $0x8,%esp
+ 88e:	50                   	push   %eax
+ 88f:	ff 75 08             	push   0x8(%ebp)
+ 892:	e8 e6 fd ff ff       	call   67d <putc>
+ 897:	83 c4 10             	add    $0x10,%esp
+ 89a:	eb 25                	jmp    8c1 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 89c:	83 ec 08             	sub    $0x8,%esp
+ 89f:	6a 25                	push   $0x25
+ 8a1:	ff 75 08             	push   0x8(%ebp)
+ 8a4:	e8 d4 fd ff ff       	call   67d <putc>
+ 8a9:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 8ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8af:	0f be c0             	movsbl %al,%eax
+ 8b2:	83 ec 08             	sub    $0x8,%esp
+ 8b5:	50                   	push   %eax
+ 8b6:	ff 75 08             	push   0x8(%ebp)
+ 8b9:	e8 bf fd ff ff       	call   67d <putc>
+ 8be:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 8c1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8c8:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 8cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8d2:	01 d0                	add    %edx,%eax
+ 8d4:	0f b6 00             	movzbl (%eax),%eax
+ 8d7:	84 c0                	test   %al,%al
+ 8d9:	0f 85 94 fe ff ff    	jne    773 <printf+0x22>
+    }
+  }
+}
+ 8df:	90                   	nop
+ 8e0:	90                   	nop
+ 8e1:	c9                   	leave
+ 8e2:	c3                   	ret
+
+000008e3 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8e3:	55                   	push   %ebp
+ 8e4:	89 e5                	mov    %esp,%ebp
+ 8e6:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 8e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ec:	83 e8 08             	sub    $0x8,%eax
+ 8ef:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8f2:	a1 68 12 00 00       	mov    0x1268,%eax
+ 8f7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8fa:	eb 24                	jmp    920 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ff:	8b 00                	mov    (%eax),%eax
+ 901:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 904:	72 12                	jb     918 <free+0x35>
+ 906:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 909:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 90c:	72 24                	jb     932 <free+0x4f>
+ 90e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 911:	8b 00                	mov    (%eax),%eax
+ 913:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 916:	72 1a                	jb     932 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 918:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 91b:	8b 00                	mov    (%eax),%eax
+ 91d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 920:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 923:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 926:	73 d4                	jae    8fc <free+0x19>
+ 928:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 92b:	8b 00                	mov    (%eax),%eax
+ 92d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 930:	73 ca                	jae    8fc <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 932:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 935:	8b 40 04             	mov    0x4(%eax),%eax
+ 938:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 93f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 942:	01 c2                	add    %eax,%edx
+ 944:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 947:	8b 00                	mov    (%eax),%eax
+ 949:	39 c2                	cmp    %eax,%edx
+ 94b:	75 24                	jne    971 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 94d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 950:	8b 50 04             	mov    0x4(%eax),%edx
+ 953:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 956:	8b 00                	mov    (%eax),%eax
+ 958:	8b 40 04             	mov    0x4(%eax),%eax
+ 95b:	01 c2                	add    %eax,%edx
+ 95d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 960:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 963:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 966:	8b 00                	mov    (%eax),%eax
+ 968:	8b 10                	mov    (%eax),%edx
+ 96a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 96d:	89 10                	mov    %edx,(%eax)
+ 96f:	eb 0a                	jmp    97b <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 971:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 974:	8b 10                	mov    (%eax),%edx
+ 976:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 979:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 97b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 97e:	8b 40 04             	mov    0x4(%eax),%eax
+ 981:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 988:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 98b:	01 d0                	add    %edx,%eax
+ 98d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 990:	75 20                	jne    9b2 <free+0xcf>
+    p->s.size += bp->s.size;
+ 992:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 995:	8b 50 04             	mov    0x4(%eax),%edx
+ 998:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 99b:	8b 40 04             	mov    0x4(%eax),%eax
+ 99e:	01 c2                	add    %eax,%edx
+ 9a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9a3:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 9a6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9a9:	8b 10                	mov    (%eax),%edx
+ 9ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ae:	89 10                	mov    %edx,(%eax)
+ 9b0:	eb 08                	jmp    9ba <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 9b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b5:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 9b8:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 9ba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9bd:	a3 68 12 00 00       	mov    %eax,0x1268
+}
+ 9c2:	90                   	nop
+ 9c3:	c9                   	leave
+ 9c4:	c3                   	ret
+
+000009c5 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 9c5:	55                   	push   %ebp
+ 9c6:	89 e5                	mov    %esp,%ebp
+ 9c8:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 9cb:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 9d2:	77 07                	ja     9db <morecore+0x16>
+    nu = 4096;
+ 9d4:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 9db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9de:	c1 e0 03             	shl    $0x3,%eax
+ 9e1:	83 ec 0c             	sub    $0xc,%esp
+ 9e4:	50                   	push   %eax
+ 9e5:	e8 83 fb ff ff       	call   56d <sbrk>
+ 9ea:	83 c4 10             	add    $0x10,%esp
+ 9ed:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 9f0:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 9f4:	75 07                	jne    9fd <morecore+0x38>
+    return 0;
+ 9f6:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9fb:	eb 26                	jmp    a23 <morecore+0x5e>
+  hp = (Header*)p;
+ 9fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a00:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ a03:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a06:	8b 55 08             	mov    0x8(%ebp),%edx
+ a09:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ a0c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a0f:	83 c0 08             	add    $0x8,%eax
+ a12:	83 ec 0c             	sub    $0xc,%esp
+ a15:	50                   	push   %eax
+ a16:	e8 c8 fe ff ff       	call   8e3 <free>
+ a1b:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ a1e:	a1 68 12 00 00       	mov    0x1268,%eax
+}
+ a23:	c9                   	leave
+ a24:	c3                   	ret
+
+00000a25 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a25:	55                   	push   %ebp
+ a26:	89 e5                	mov    %esp,%ebp
+ a28:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a2b:	8b 45 08             	mov    0x8(%ebp),%eax
+ a2e:	83 c0 07             	add    $0x7,%eax
+ a31:	c1 e8 03             	shr    $0x3,%eax
+ a34:	83 c0 01             	add    $0x1,%eax
+ a37:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ a3a:	a1 68 12 00 00       	mov    0x1268,%eax
+ a3f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a42:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a46:	75 23                	jne    a6b <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ a48:	c7 45 f0 60 12 00 00 	movl   $0x1260,-0x10(%ebp)
+ a4f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a52:	a3 68 12 00 00       	mov    %eax,0x1268
+ a57:	a1 68 12 00 00       	mov    0x1268,%eax
+ a5c:	a3 60 12 00 00       	mov    %eax,0x1260
+    base.s.size = 0;
+ a61:	c7 05 64 12 00 00 00 	movl   $0x0,0x1264
+ a68:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a6b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a6e:	8b 00                	mov    (%eax),%eax
+ a70:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a76:	8b 40 04             	mov    0x4(%eax),%eax
+ a79:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a7c:	72 4d                	jb     acb <malloc+0xa6>
+      if(p->s.size == nunits)
+ a7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a81:	8b 40 04             	mov    0x4(%eax),%eax
+ a84:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a87:	75 0c                	jne    a95 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a8c:	8b 10                	mov    (%eax),%edx
+ a8e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a91:	89 10                	mov    %edx,(%eax)
+ a93:	eb 26                	jmp    abb <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a98:	8b 40 04             	mov    0x4(%eax),%eax
+ a9b:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a9e:	89 c2                	mov    %eax,%edx
+ aa0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aa3:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ aa6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aa9:	8b 40 04             	mov    0x4(%eax),%eax
+ aac:	c1 e0 03             	shl    $0x3,%eax
+ aaf:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ ab2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab5:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ ab8:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ abb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ abe:	a3 68 12 00 00       	mov    %eax,0x1268
+      return (void*)(p + 1);
+ ac3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac6:	83 c0 08             	add    $0x8,%eax
+ ac9:	eb 3b                	jmp    b06 <malloc+0xe1>
+    }
+    if(p == freep)
+ acb:	a1 68 12 00 00       	mov    0x1268,%eax
+ ad0:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ ad3:	75 1e                	jne    af3 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ ad5:	83 ec 0c             	sub    $0xc,%esp
+ ad8:	ff 75 ec             	push   -0x14(%ebp)
+ adb:	e8 e5 fe ff ff       	call   9c5 <morecore>
+ ae0:	83 c4 10             	add    $0x10,%esp
+ ae3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ae6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ aea:	75 07                	jne    af3 <malloc+0xce>
+        return 0;
+ aec:	b8 00 00 00 00       	mov    $0x0,%eax
+ af1:	eb 13                	jmp    b06 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ af3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ af6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ af9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ afc:	8b 00                	mov    (%eax),%eax
+ afe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b01:	e9 6d ff ff ff       	jmp    a73 <malloc+0x4e>
+  }
+}
+ b06:	c9                   	leave
+ b07:	c3                   	ret
+
+00000b08 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ b08:	55                   	push   %ebp
+ b09:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ b0b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b0e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b14:	90                   	nop
+ b15:	5d                   	pop    %ebp
+ b16:	c3                   	ret
+
+00000b17 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ b17:	55                   	push   %ebp
+ b18:	89 e5                	mov    %esp,%ebp
+ b1a:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ b1d:	8b 55 08             	mov    0x8(%ebp),%edx
+ b20:	b8 00 00 00 00       	mov    $0x0,%eax
+ b25:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b2a:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b2e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b31:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b35:	74 3b                	je     b72 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ b37:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ b3b:	74 2d                	je     b6a <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ b3d:	8b 55 08             	mov    0x8(%ebp),%edx
+ b40:	b8 02 00 00 00       	mov    $0x2,%eax
+ b45:	87 02                	xchg   %eax,(%edx)
+ b47:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b4a:	eb 1e                	jmp    b6a <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ b4c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4f:	83 ec 08             	sub    $0x8,%esp
+ b52:	6a 02                	push   $0x2
+ b54:	50                   	push   %eax
+ b55:	e8 f3 fa ff ff       	call   64d <futex_wait>
+ b5a:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ b5d:	8b 55 08             	mov    0x8(%ebp),%edx
+ b60:	b8 02 00 00 00       	mov    $0x2,%eax
+ b65:	87 02                	xchg   %eax,(%edx)
+ b67:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b6a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b6e:	75 dc                	jne    b4c <mutex_lock+0x35>
+ b70:	eb 01                	jmp    b73 <mutex_lock+0x5c>
+    return;
+ b72:	90                   	nop
+  }
+}
+ b73:	c9                   	leave
+ b74:	c3                   	ret
+
+00000b75 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ b75:	55                   	push   %ebp
+ b76:	89 e5                	mov    %esp,%ebp
+ b78:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ b7b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b7e:	ba 01 00 00 00       	mov    $0x1,%edx
+ b83:	f7 da                	neg    %edx
+ b85:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ b89:	83 fa 01             	cmp    $0x1,%edx
+ b8c:	74 1a                	je     ba8 <mutex_unlock+0x33>
+    m->state = 0;
+ b8e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b91:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ b97:	8b 45 08             	mov    0x8(%ebp),%eax
+ b9a:	83 ec 08             	sub    $0x8,%esp
+ b9d:	6a 01                	push   $0x1
+ b9f:	50                   	push   %eax
+ ba0:	e8 b0 fa ff ff       	call   655 <futex_wake>
+ ba5:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ ba8:	90                   	nop
+ ba9:	c9                   	leave
+ baa:	c3                   	ret
+
+00000bab <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ bab:	55                   	push   %ebp
+ bac:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ bae:	8b 45 08             	mov    0x8(%ebp),%eax
+ bb1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ bb7:	8b 45 08             	mov    0x8(%ebp),%eax
+ bba:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ bc1:	90                   	nop
+ bc2:	5d                   	pop    %ebp
+ bc3:	c3                   	ret
+
+00000bc4 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ bc4:	55                   	push   %ebp
+ bc5:	89 e5                	mov    %esp,%ebp
+ bc7:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ bca:	8b 45 08             	mov    0x8(%ebp),%eax
+ bcd:	83 c0 04             	add    $0x4,%eax
+ bd0:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ bd4:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd7:	83 ec 08             	sub    $0x8,%esp
+ bda:	ff 75 0c             	push   0xc(%ebp)
+ bdd:	50                   	push   %eax
+ bde:	e8 6a fa ff ff       	call   64d <futex_wait>
+ be3:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ be6:	8b 45 08             	mov    0x8(%ebp),%eax
+ be9:	83 c0 04             	add    $0x4,%eax
+ bec:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ bf0:	90                   	nop
+ bf1:	c9                   	leave
+ bf2:	c3                   	ret
+
+00000bf3 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ bf3:	55                   	push   %ebp
+ bf4:	89 e5                	mov    %esp,%ebp
+ bf6:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+ bfc:	8b 00                	mov    (%eax),%eax
+ bfe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ c01:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c05:	78 17                	js     c1e <rwlock_rdlock+0x2b>
+ c07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c0a:	83 c0 01             	add    $0x1,%eax
+ c0d:	89 c1                	mov    %eax,%ecx
+ c0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c12:	8b 55 08             	mov    0x8(%ebp),%edx
+ c15:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c19:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c1c:	74 19                	je     c37 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ c1e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c22:	79 d5                	jns    bf9 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ c24:	83 ec 08             	sub    $0x8,%esp
+ c27:	ff 75 f4             	push   -0xc(%ebp)
+ c2a:	ff 75 08             	push   0x8(%ebp)
+ c2d:	e8 92 ff ff ff       	call   bc4 <rwlock_sleep>
+ c32:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ c35:	eb c2                	jmp    bf9 <rwlock_rdlock+0x6>
+      return;
+ c37:	90                   	nop
+  }
+}
+ c38:	c9                   	leave
+ c39:	c3                   	ret
+
+00000c3a <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ c3a:	55                   	push   %ebp
+ c3b:	89 e5                	mov    %esp,%ebp
+ c3d:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ c40:	eb 11                	jmp    c53 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ c42:	83 ec 08             	sub    $0x8,%esp
+ c45:	ff 75 f4             	push   -0xc(%ebp)
+ c48:	ff 75 08             	push   0x8(%ebp)
+ c4b:	e8 74 ff ff ff       	call   bc4 <rwlock_sleep>
+ c50:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ c53:	8b 55 08             	mov    0x8(%ebp),%edx
+ c56:	b8 00 00 00 00       	mov    $0x0,%eax
+ c5b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ c60:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c64:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c67:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c6b:	75 d5                	jne    c42 <rwlock_wrlock+0x8>
+}
+ c6d:	90                   	nop
+ c6e:	90                   	nop
+ c6f:	c9                   	leave
+ c70:	c3                   	ret
+
+00000c71 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ c71:	55                   	push   %ebp
+ c72:	89 e5                	mov    %esp,%ebp
+ c74:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ c77:	8b 45 08             	mov    0x8(%ebp),%eax
+ c7a:	8b 00                	mov    (%eax),%eax
+ c7c:	85 c0                	test   %eax,%eax
+ c7e:	79 0c                	jns    c8c <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ c80:	8b 45 08             	mov    0x8(%ebp),%eax
+ c83:	ba 00 00 00 00       	mov    $0x0,%edx
+ c88:	87 10                	xchg   %edx,(%eax)
+ c8a:	eb 18                	jmp    ca4 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ c8c:	8b 55 08             	mov    0x8(%ebp),%edx
+ c8f:	b8 01 00 00 00       	mov    $0x1,%eax
+ c94:	f7 d8                	neg    %eax
+ c96:	89 c1                	mov    %eax,%ecx
+ c98:	89 c8                	mov    %ecx,%eax
+ c9a:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ c9e:	01 c8                	add    %ecx,%eax
+ ca0:	85 c0                	test   %eax,%eax
+ ca2:	75 20                	jne    cc4 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ ca4:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca7:	8b 40 04             	mov    0x4(%eax),%eax
+ caa:	85 c0                	test   %eax,%eax
+ cac:	74 17                	je     cc5 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ cae:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb1:	83 ec 08             	sub    $0x8,%esp
+ cb4:	68 ff ff ff 7f       	push   $0x7fffffff
+ cb9:	50                   	push   %eax
+ cba:	e8 96 f9 ff ff       	call   655 <futex_wake>
+ cbf:	83 c4 10             	add    $0x10,%esp
+ cc2:	eb 01                	jmp    cc5 <rwlock_unlock+0x54>
+    return;
+ cc4:	90                   	nop
+}
+ cc5:	c9                   	leave
+ cc6:	c3                   	ret
+
+00000cc7 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ cc7:	55                   	push   %ebp
+ cc8:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ cca:	8b 45 08             	mov    0x8(%ebp),%eax
+ ccd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ cd3:	90                   	nop
+ cd4:	5d                   	pop    %ebp
+ cd5:	c3                   	ret
+
+00000cd6 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ cd6:	55                   	push   %ebp
+ cd7:	89 e5                	mov    %esp,%ebp
+ cd9:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ cdc:	8b 45 08             	mov    0x8(%ebp),%eax
+ cdf:	8b 00                	mov    (%eax),%eax
+ ce1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ ce4:	83 ec 0c             	sub    $0xc,%esp
+ ce7:	ff 75 0c             	push   0xc(%ebp)
+ cea:	e8 86 fe ff ff       	call   b75 <mutex_unlock>
+ cef:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+ cf5:	83 ec 08             	sub    $0x8,%esp
+ cf8:	ff 75 f4             	push   -0xc(%ebp)
+ cfb:	50                   	push   %eax
+ cfc:	e8 4c f9 ff ff       	call   64d <futex_wait>
+ d01:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ d04:	83 ec 0c             	sub    $0xc,%esp
+ d07:	ff 75 0c             	push   0xc(%ebp)
+ d0a:	e8 08 fe ff ff       	call   b17 <mutex_lock>
+ d0f:	83 c4 10             	add    $0x10,%esp
+}
+ d12:	90                   	nop
+ d13:	c9                   	leave
+ d14:	c3                   	ret
+
+00000d15 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ d15:	55                   	push   %ebp
+ d16:	89 e5                	mov    %esp,%ebp
+ d18:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ d1b:	8b 45 08             	mov    0x8(%ebp),%eax
+ d1e:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ d22:	8b 45 08             	mov    0x8(%ebp),%eax
+ d25:	83 ec 08             	sub    $0x8,%esp
+ d28:	6a 01                	push   $0x1
+ d2a:	50                   	push   %eax
+ d2b:	e8 25 f9 ff ff       	call   655 <futex_wake>
+ d30:	83 c4 10             	add    $0x10,%esp
+}
+ d33:	90                   	nop
+ d34:	c9                   	leave
+ d35:	c3                   	ret
+
+00000d36 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ d36:	55                   	push   %ebp
+ d37:	89 e5                	mov    %esp,%ebp
+ d39:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ d3c:	8b 45 08             	mov    0x8(%ebp),%eax
+ d3f:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ d43:	8b 45 08             	mov    0x8(%ebp),%eax
+ d46:	83 ec 08             	sub    $0x8,%esp
+ d49:	68 ff ff ff 7f       	push   $0x7fffffff
+ d4e:	50                   	push   %eax
+ d4f:	e8 01 f9 ff ff       	call   655 <futex_wake>
+ d54:	83 c4 10             	add    $0x10,%esp
+}
+ d57:	90                   	nop
+ d58:	c9                   	leave
+ d59:	c3                   	ret
@@ -0,0 +1,62 @@
+#include "types.h"
+#include "x86.h"
+#include "user.h"
+
+// Forks with a few hundred kilobytes of dirty heap, once with a
+// child that exits straight away and once with one that execs a
+// trivial program, reporting TSC cycles per fork/wait round trip.
+// With copy-on-write fork, neither child copies the heap.
+
+#define NFORKS 64
+#define HEAP (256 * 1024)
+
+uint64 run(int do_exec)
+{
+    char *argv[] = {"forkexec_bench", "-c", 0};
+    uint64 start;
+    int i, pid;
+
+    start = rdtsc();
+    for (i = 0; i < NFORKS; i++)
+    {
+        pid = fork();
+        if (pid < 0)
+        {
+            printf(1, "forkexec_bench: fork failed\n");
+            exit();
+        }
+        if (pid == 0)
+        {
+            if (do_exec)
+            {
+                exec(argv[0], argv);
+                printf(1, "forkexec_bench: exec failed\n");
+            }
+            exit();
+        }
+        wait();
+    }
+    return rdtsc() - start;
+}
+
+int main(int argc, char *argv[])
+{
+    char *heap;
+
+    // Started by run() as the exec'd child: nothing to do.
+    if (argc > 1 && strcmp(argv[1], "-c") == 0)
+        exit();
+
+    heap = sbrk(HEAP);
+    if (heap == (char *)-1)
+    {
+        printf(1, "forkexec_bench: sbrk failed\n");
+        exit();
+    }
+    memset(heap, 'a', HEAP);
+
+    printf(1, "%d forks with %d KB of heap, cycles per fork:\n", NFORKS, HEAP / 1024);
+    printf(1, "fork, exit: %d\n", (int)udiv64(run(0), NFORKS));
+    printf(1, "fork, exec: %d\n", (int)udiv64(run(1), NFORKS));
+    exit();
+}
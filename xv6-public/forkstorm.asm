@@ -0,0 +1,1973 @@
+
+_forkstorm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rdtsc>:
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+   6:	0f 31                	rdtsc
+   8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+   b:	89 55 fc             	mov    %edx,-0x4(%ebp)
+   e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  11:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  14:	c9                   	leave
+  15:	c3                   	ret
+
+00000016 <worker>:
+{
+  16:	55                   	push   %ebp
+  17:	89 e5                	mov    %esp,%ebp
+  19:	83 ec 18             	sub    $0x18,%esp
+    for (i = 0; i < NFORKS; i++)
+  1c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  23:	eb 39                	jmp    5e <worker+0x48>
+        pid = fork();
+  25:	e8 b2 05 00 00       	call   5dc <fork>
+  2a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if (pid < 0)
+  2d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  31:	79 17                	jns    4a <worker+0x34>
+            printf(1, "forkstorm: fork failed\n");
+  33:	83 ec 08             	sub    $0x8,%esp
+  36:	68 5c 0e 00 00       	push   $0xe5c
+  3b:	6a 01                	push   $0x1
+  3d:	e8 0e 08 00 00       	call   850 <printf>
+  42:	83 c4 10             	add    $0x10,%esp
+            exit();
+  45:	e8 9a 05 00 00       	call   5e4 <exit>
+        if (pid == 0)
+  4a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  4e:	75 05                	jne    55 <worker+0x3f>
+            exit();
+  50:	e8 8f 05 00 00       	call   5e4 <exit>
+        wait();
+  55:	e8 92 05 00 00       	call   5ec <wait>
+    for (i = 0; i < NFORKS; i++)
+  5a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  5e:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+  62:	7e c1                	jle    25 <worker+0xf>
+    exit();
+  64:	e8 7b 05 00 00       	call   5e4 <exit>
+
+00000069 <main>:
+{
+  69:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  6d:	83 e4 f0             	and    $0xfffffff0,%esp
+  70:	ff 71 fc             	push   -0x4(%ecx)
+  73:	55                   	push   %ebp
+  74:	89 e5                	mov    %esp,%ebp
+  76:	57                   	push   %edi
+  77:	56                   	push   %esi
+  78:	53                   	push   %ebx
+  79:	51                   	push   %ecx
+  7a:	83 ec 38             	sub    $0x38,%esp
+  7d:	89 c8                	mov    %ecx,%eax
+    junk = kmem_junk(!(argc > 1 && strcmp(argv[1], "nojunk") == 0));
+  7f:	83 38 01             	cmpl   $0x1,(%eax)
+  82:	7e 1d                	jle    a1 <main+0x38>
+  84:	8b 40 04             	mov    0x4(%eax),%eax
+  87:	83 c0 04             	add    $0x4,%eax
+  8a:	8b 00                	mov    (%eax),%eax
+  8c:	83 ec 08             	sub    $0x8,%esp
+  8f:	68 74 0e 00 00       	push   $0xe74
+  94:	50                   	push   %eax
+  95:	e8 6f 02 00 00       	call   309 <strcmp>
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	85 c0                	test   %eax,%eax
+  9f:	74 07                	je     a8 <main+0x3f>
+  a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  a6:	eb 05                	jmp    ad <main+0x44>
+  a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  ad:	83 ec 0c             	sub    $0xc,%esp
+  b0:	50                   	push   %eax
+  b1:	e8 be 06 00 00       	call   774 <kmem_junk>
+  b6:	83 c4 10             	add    $0x10,%esp
+  b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    ncpu = kmem_stats(before, NCPU);
+  bc:	83 ec 08             	sub    $0x8,%esp
+  bf:	6a 04                	push   $0x4
+  c1:	68 60 13 00 00       	push   $0x1360
+  c6:	e8 a1 06 00 00       	call   76c <kmem_stats>
+  cb:	83 c4 10             	add    $0x10,%esp
+  ce:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    start = rdtsc();
+  d1:	e8 2a ff ff ff       	call   0 <rdtsc>
+  d6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  d9:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    for (i = 0; i < NWORKERS; i++)
+  dc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  e3:	eb 34                	jmp    119 <main+0xb0>
+        n = fork();
+  e5:	e8 f2 04 00 00       	call   5dc <fork>
+  ea:	89 45 cc             	mov    %eax,-0x34(%ebp)
+        if (n < 0)
+  ed:	83 7d cc 00          	cmpl   $0x0,-0x34(%ebp)
+  f1:	79 17                	jns    10a <main+0xa1>
+            printf(1, "forkstorm: fork failed\n");
+  f3:	83 ec 08             	sub    $0x8,%esp
+  f6:	68 5c 0e 00 00       	push   $0xe5c
+  fb:	6a 01                	push   $0x1
+  fd:	e8 4e 07 00 00       	call   850 <printf>
+ 102:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 105:	e8 da 04 00 00       	call   5e4 <exit>
+        if (n == 0)
+ 10a:	83 7d cc 00          	cmpl   $0x0,-0x34(%ebp)
+ 10e:	75 05                	jne    115 <main+0xac>
+            worker();
+ 110:	e8 01 ff ff ff       	call   16 <worker>
+    for (i = 0; i < NWORKERS; i++)
+ 115:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 119:	83 7d e4 03          	cmpl   $0x3,-0x1c(%ebp)
+ 11d:	7e c6                	jle    e5 <main+0x7c>
+    for (i = 0; i < NWORKERS; i++)
+ 11f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 126:	eb 09                	jmp    131 <main+0xc8>
+        wait();
+ 128:	e8 bf 04 00 00       	call   5ec <wait>
+    for (i = 0; i < NWORKERS; i++)
+ 12d:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 131:	83 7d e4 03          	cmpl   $0x3,-0x1c(%ebp)
+ 135:	7e f1                	jle    128 <main+0xbf>
+    start = rdtsc() - start;
+ 137:	e8 c4 fe ff ff       	call   0 <rdtsc>
+ 13c:	2b 45 d0             	sub    -0x30(%ebp),%eax
+ 13f:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+ 142:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 145:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    kmem_stats(after, NCPU);
+ 148:	83 ec 08             	sub    $0x8,%esp
+ 14b:	6a 04                	push   $0x4
+ 14d:	68 e0 13 00 00       	push   $0x13e0
+ 152:	e8 15 06 00 00       	call   76c <kmem_stats>
+ 157:	83 c4 10             	add    $0x10,%esp
+    kmem_junk(junk);
+ 15a:	83 ec 0c             	sub    $0xc,%esp
+ 15d:	ff 75 e0             	push   -0x20(%ebp)
+ 160:	e8 0f 06 00 00       	call   774 <kmem_junk>
+ 165:	83 c4 10             	add    $0x10,%esp
+           (int)udiv64(start, NWORKERS * NFORKS));
+ 168:	83 ec 04             	sub    $0x4,%esp
+ 16b:	68 90 01 00 00       	push   $0x190
+ 170:	ff 75 d4             	push   -0x2c(%ebp)
+ 173:	ff 75 d0             	push   -0x30(%ebp)
+ 176:	e8 87 03 00 00       	call   502 <udiv64>
+ 17b:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d workers x %d forks: %d cycles per fork\n", NWORKERS, NFORKS,
+ 17e:	83 ec 0c             	sub    $0xc,%esp
+ 181:	50                   	push   %eax
+ 182:	6a 64                	push   $0x64
+ 184:	6a 04                	push   $0x4
+ 186:	68 7c 0e 00 00       	push   $0xe7c
+ 18b:	6a 01                	push   $0x1
+ 18d:	e8 be 06 00 00       	call   850 <printf>
+ 192:	83 c4 20             	add    $0x20,%esp
+    printf(1, "cpu\tallocs\tfrees\tsteals\tstolen\tzhits\tzfills\tfree now\n");
+ 195:	83 ec 08             	sub    $0x8,%esp
+ 198:	68 a8 0e 00 00       	push   $0xea8
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 ac 06 00 00       	call   850 <printf>
+ 1a4:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < ncpu && i < NCPU; i++)
+ 1a7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 1ae:	e9 e9 00 00 00       	jmp    29c <main+0x233>
+        printf(1, "%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", i,
+ 1b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1b6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 1b9:	05 f0 13 00 00       	add    $0x13f0,%eax
+ 1be:	8b 18                	mov    (%eax),%ebx
+               after[i].zfills - before[i].zfills,
+ 1c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1c3:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 1c6:	05 f8 13 00 00       	add    $0x13f8,%eax
+ 1cb:	8b 10                	mov    (%eax),%edx
+ 1cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1d0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 1d3:	05 78 13 00 00       	add    $0x1378,%eax
+ 1d8:	8b 00                	mov    (%eax),%eax
+        printf(1, "%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", i,
+ 1da:	29 c2                	sub    %eax,%edx
+ 1dc:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+               after[i].zhits - before[i].zhits,
+ 1df:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1e2:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 1e5:	05 f4 13 00 00       	add    $0x13f4,%eax
+ 1ea:	8b 10                	mov    (%eax),%edx
+ 1ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1ef:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 1f2:	05 74 13 00 00       	add    $0x1374,%eax
+ 1f7:	8b 00                	mov    (%eax),%eax
+        printf(1, "%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", i,
+ 1f9:	89 d6                	mov    %edx,%esi
+ 1fb:	29 c6                	sub    %eax,%esi
+ 1fd:	89 75 c0             	mov    %esi,-0x40(%ebp)
+               after[i].stolen - before[i].stolen,
+ 200:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 203:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 206:	05 ec 13 00 00       	add    $0x13ec,%eax
+ 20b:	8b 10                	mov    (%eax),%edx
+ 20d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 210:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 213:	05 6c 13 00 00       	add    $0x136c,%eax
+ 218:	8b 00                	mov    (%eax),%eax
+        printf(1, "%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", i,
+ 21a:	89 d7                	mov    %edx,%edi
+ 21c:	29 c7                	sub    %eax,%edi
+               after[i].steals - before[i].steals,
+ 21e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 221:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 224:	05 e8 13 00 00       	add    $0x13e8,%eax
+ 229:	8b 10                	mov    (%eax),%edx
+ 22b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 22e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 231:	05 68 13 00 00       	add    $0x1368,%eax
+ 236:	8b 00                	mov    (%eax),%eax
+        printf(1, "%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", i,
+ 238:	89 d1                	mov    %edx,%ecx
+ 23a:	29 c1                	sub    %eax,%ecx
+ 23c:	89 ce                	mov    %ecx,%esi
+               after[i].frees - before[i].frees,
+ 23e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 241:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 244:	05 e4 13 00 00       	add    $0x13e4,%eax
+ 249:	8b 10                	mov    (%eax),%edx
+ 24b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 24e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 251:	05 64 13 00 00       	add    $0x1364,%eax
+ 256:	8b 00                	mov    (%eax),%eax
+        printf(1, "%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", i,
+ 258:	89 d1                	mov    %edx,%ecx
+ 25a:	29 c1                	sub    %eax,%ecx
+               after[i].allocs - before[i].allocs,
+ 25c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 25f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 262:	05 e0 13 00 00       	add    $0x13e0,%eax
+ 267:	8b 10                	mov    (%eax),%edx
+ 269:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 26c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+ 26f:	05 60 13 00 00       	add    $0x1360,%eax
+ 274:	8b 00                	mov    (%eax),%eax
+        printf(1, "%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", i,
+ 276:	29 c2                	sub    %eax,%edx
+ 278:	83 ec 08             	sub    $0x8,%esp
+ 27b:	53                   	push   %ebx
+ 27c:	ff 75 c4             	push   -0x3c(%ebp)
+ 27f:	ff 75 c0             	push   -0x40(%ebp)
+ 282:	57                   	push   %edi
+ 283:	56                   	push   %esi
+ 284:	51                   	push   %ecx
+ 285:	52                   	push   %edx
+ 286:	ff 75 e4             	push   -0x1c(%ebp)
+ 289:	68 de 0e 00 00       	push   $0xede
+ 28e:	6a 01                	push   $0x1
+ 290:	e8 bb 05 00 00       	call   850 <printf>
+ 295:	83 c4 30             	add    $0x30,%esp
+    for (i = 0; i < ncpu && i < NCPU; i++)
+ 298:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 29c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 29f:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+ 2a2:	7d 0a                	jge    2ae <main+0x245>
+ 2a4:	83 7d e4 03          	cmpl   $0x3,-0x1c(%ebp)
+ 2a8:	0f 8e 05 ff ff ff    	jle    1b3 <main+0x14a>
+    exit();
+ 2ae:	e8 31 03 00 00       	call   5e4 <exit>
+
+000002b3 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 2b3:	55                   	push   %ebp
+ 2b4:	89 e5                	mov    %esp,%ebp
+ 2b6:	57                   	push   %edi
+ 2b7:	53                   	push   %ebx
+{
+ 2b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2bb:	8b 55 10             	mov    0x10(%ebp),%edx
+ 2be:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2c1:	89 cb                	mov    %ecx,%ebx
+ 2c3:	89 df                	mov    %ebx,%edi
+ 2c5:	89 d1                	mov    %edx,%ecx
+ 2c7:	fc                   	cld
+ 2c8:	f3 aa                	rep stos %al,%es:(%edi)
+ 2ca:	89 ca                	mov    %ecx,%edx
+ 2cc:	89 fb                	mov    %edi,%ebx
+ 2ce:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 2d1:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 2d4:	90                   	nop
+ 2d5:	5b                   	pop    %ebx
+ 2d6:	5f                   	pop    %edi
+ 2d7:	5d                   	pop    %ebp
+ 2d8:	c3                   	ret
+
+000002d9 <strcpy>:
+{
+ 2d9:	55                   	push   %ebp
+ 2da:	89 e5                	mov    %esp,%ebp
+ 2dc:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 2df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 2e5:	90                   	nop
+ 2e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2e9:	8d 42 01             	lea    0x1(%edx),%eax
+ 2ec:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 2ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2f5:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 2f8:	0f b6 12             	movzbl (%edx),%edx
+ 2fb:	88 10                	mov    %dl,(%eax)
+ 2fd:	0f b6 00             	movzbl (%eax),%eax
+ 300:	84 c0                	test   %al,%al
+ 302:	75 e2                	jne    2e6 <strcpy+0xd>
+  return os;
+ 304:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 307:	c9                   	leave
+ 308:	c3                   	ret
+
+00000309 <strcmp>:
+{
+ 309:	55                   	push   %ebp
+ 30a:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 30c:	eb 08                	jmp    316 <strcmp+0xd>
+    p++, q++;
+ 30e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 312:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 316:	8b 45 08             	mov    0x8(%ebp),%eax
+ 319:	0f b6 00             	movzbl (%eax),%eax
+ 31c:	84 c0                	test   %al,%al
+ 31e:	74 10                	je     330 <strcmp+0x27>
+ 320:	8b 45 08             	mov    0x8(%ebp),%eax
+ 323:	0f b6 10             	movzbl (%eax),%edx
+ 326:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 329:	0f b6 00             	movzbl (%eax),%eax
+ 32c:	38 c2                	cmp    %al,%dl
+ 32e:	74 de                	je     30e <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 330:	8b 45 08             	mov    0x8(%ebp),%eax
+ 333:	0f b6 00             	movzbl (%eax),%eax
+ 336:	0f b6 d0             	movzbl %al,%edx
+ 339:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 33c:	0f b6 00             	movzbl (%eax),%eax
+ 33f:	0f b6 c0             	movzbl %al,%eax
+ 342:	29 c2                	sub    %eax,%edx
+ 344:	89 d0                	mov    %edx,%eax
+}
+ 346:	5d                   	pop    %ebp
+ 347:	c3                   	ret
+
+00000348 <strlen>:
+{
+ 348:	55                   	push   %ebp
+ 349:	89 e5                	mov    %esp,%ebp
+ 34b:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 34e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 355:	eb 04                	jmp    35b <strlen+0x13>
+ 357:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 35b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 35e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 361:	01 d0                	add    %edx,%eax
+ 363:	0f b6 00             	movzbl (%eax),%eax
+ 366:	84 c0                	test   %al,%al
+ 368:	75 ed                	jne    357 <strlen+0xf>
+  return n;
+ 36a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 36d:	c9                   	leave
+ 36e:	c3                   	ret
+
+0000036f <memset>:
+{
+ 36f:	55                   	push   %ebp
+ 370:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 372:	8b 45 10             	mov    0x10(%ebp),%eax
+ 375:	50                   	push   %eax
+ 376:	ff 75 0c             	push   0xc(%ebp)
+ 379:	ff 75 08             	push   0x8(%ebp)
+ 37c:	e8 32 ff ff ff       	call   2b3 <stosb>
+ 381:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 384:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 387:	c9                   	leave
+ 388:	c3                   	ret
+
+00000389 <strchr>:
+{
+ 389:	55                   	push   %ebp
+ 38a:	89 e5                	mov    %esp,%ebp
+ 38c:	83 ec 04             	sub    $0x4,%esp
+ 38f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 392:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 395:	eb 14                	jmp    3ab <strchr+0x22>
+    if(*s == c)
+ 397:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39a:	0f b6 00             	movzbl (%eax),%eax
+ 39d:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3a0:	75 05                	jne    3a7 <strchr+0x1e>
+      return (char*)s;
+ 3a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a5:	eb 13                	jmp    3ba <strchr+0x31>
+  for(; *s; s++)
+ 3a7:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3ab:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ae:	0f b6 00             	movzbl (%eax),%eax
+ 3b1:	84 c0                	test   %al,%al
+ 3b3:	75 e2                	jne    397 <strchr+0xe>
+  return 0;
+ 3b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3ba:	c9                   	leave
+ 3bb:	c3                   	ret
+
+000003bc <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3bc:	55                   	push   %ebp
+ 3bd:	89 e5                	mov    %esp,%ebp
+ 3bf:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3c2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3c9:	eb 42                	jmp    40d <gets+0x51>
+    cc = read(0, &c, 1);
+ 3cb:	83 ec 04             	sub    $0x4,%esp
+ 3ce:	6a 01                	push   $0x1
+ 3d0:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 3d3:	50                   	push   %eax
+ 3d4:	6a 00                	push   $0x0
+ 3d6:	e8 21 02 00 00       	call   5fc <read>
+ 3db:	83 c4 10             	add    $0x10,%esp
+ 3de:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 3e1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 3e5:	7e 33                	jle    41a <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 3e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3ea:	8d 50 01             	lea    0x1(%eax),%edx
+ 3ed:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3f0:	89 c2                	mov    %eax,%edx
+ 3f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f5:	01 c2                	add    %eax,%edx
+ 3f7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3fb:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 3fd:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 401:	3c 0a                	cmp    $0xa,%al
+ 403:	74 16                	je     41b <gets+0x5f>
+ 405:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 409:	3c 0d                	cmp    $0xd,%al
+ 40b:	74 0e                	je     41b <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 40d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 410:	83 c0 01             	add    $0x1,%eax
+ 413:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 416:	7f b3                	jg     3cb <gets+0xf>
+ 418:	eb 01                	jmp    41b <gets+0x5f>
+      break;
+ 41a:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 41b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 41e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 421:	01 d0                	add    %edx,%eax
+ 423:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 426:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 429:	c9                   	leave
+ 42a:	c3                   	ret
+
+0000042b <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 42b:	55                   	push   %ebp
+ 42c:	89 e5                	mov    %esp,%ebp
+ 42e:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 431:	83 ec 08             	sub    $0x8,%esp
+ 434:	6a 00                	push   $0x0
+ 436:	ff 75 08             	push   0x8(%ebp)
+ 439:	e8 e6 01 00 00       	call   624 <open>
+ 43e:	83 c4 10             	add    $0x10,%esp
+ 441:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 444:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 448:	79 07                	jns    451 <stat+0x26>
+    return -1;
+ 44a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 44f:	eb 25                	jmp    476 <stat+0x4b>
+  r = fstat(fd, st);
+ 451:	83 ec 08             	sub    $0x8,%esp
+ 454:	ff 75 0c             	push   0xc(%ebp)
+ 457:	ff 75 f4             	push   -0xc(%ebp)
+ 45a:	e8 dd 01 00 00       	call   63c <fstat>
+ 45f:	83 c4 10             	add    $0x10,%esp
+ 462:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 465:	83 ec 0c             	sub    $0xc,%esp
+ 468:	ff 75 f4             	push   -0xc(%ebp)
+ 46b:	e8 9c 01 00 00       	call   60c <close>
+ 470:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 473:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 476:	c9                   	leave
+ 477:	c3                   	ret
+
+00000478 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 478:	55                   	push   %ebp
+ 479:	89 e5                	mov    %esp,%ebp
+ 47b:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 47e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 485:	eb 25                	jmp    4ac <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 487:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 48a:	89 d0                	mov    %edx,%eax
+ 48c:	c1 e0 02             	shl    $0x2,%eax
+ 48f:	01 d0                	add    %edx,%eax
+ 491:	01 c0                	add    %eax,%eax
+ 493:	89 c1                	mov    %eax,%ecx
+ 495:	8b 45 08             	mov    0x8(%ebp),%eax
+ 498:	8d 50 01             	lea    0x1(%eax),%edx
+ 49b:	89 55 08             	mov    %edx,0x8(%ebp)
+ 49e:	0f b6 00             	movzbl (%eax),%eax
+ 4a1:	0f be c0             	movsbl %al,%eax
+ 4a4:	01 c8                	add    %ecx,%eax
+ 4a6:	83 e8 30             	sub    $0x30,%eax
+ 4a9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4af:	0f b6 00             	movzbl (%eax),%eax
+ 4b2:	3c 2f                	cmp    $0x2f,%al
+ 4b4:	7e 0a                	jle    4c0 <atoi+0x48>
+ 4b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b9:	0f b6 00             	movzbl (%eax),%eax
+ 4bc:	3c 39                	cmp    $0x39,%al
+ 4be:	7e c7                	jle    487 <atoi+0xf>
+  return n;
+ 4c0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4c3:	c9                   	leave
+ 4c4:	c3                   	ret
+
+000004c5 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4c5:	55                   	push   %ebp
+ 4c6:	89 e5                	mov    %esp,%ebp
+ 4c8:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 4cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ce:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4d4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 4d7:	eb 17                	jmp    4f0 <memmove+0x2b>
+    *dst++ = *src++;
+ 4d9:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4dc:	8d 42 01             	lea    0x1(%edx),%eax
+ 4df:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4e5:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4e8:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4eb:	0f b6 12             	movzbl (%edx),%edx
+ 4ee:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 4f0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4f3:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4f6:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4f9:	85 c0                	test   %eax,%eax
+ 4fb:	7f dc                	jg     4d9 <memmove+0x14>
+  return vdst;
+ 4fd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 500:	c9                   	leave
+ 501:	c3                   	ret
+
+00000502 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 502:	55                   	push   %ebp
+ 503:	89 e5                	mov    %esp,%ebp
+ 505:	57                   	push   %edi
+ 506:	56                   	push   %esi
+ 507:	83 ec 30             	sub    $0x30,%esp
+ 50a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 50d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 510:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 513:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 516:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 51d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 524:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 527:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 52a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 52d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 530:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 537:	e9 89 00 00 00       	jmp    5c5 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 53c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 53f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 542:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 546:	01 c0                	add    %eax,%eax
+ 548:	89 c6                	mov    %eax,%esi
+ 54a:	89 d7                	mov    %edx,%edi
+ 54c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 54f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 552:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 555:	0f ad d0             	shrd   %cl,%edx,%eax
+ 558:	d3 ea                	shr    %cl,%edx
+ 55a:	f6 c1 20             	test   $0x20,%cl
+ 55d:	74 04                	je     563 <udiv64+0x61>
+ 55f:	89 d0                	mov    %edx,%eax
+ 561:	31 d2                	xor    %edx,%edx
+ 563:	83 e0 01             	and    $0x1,%eax
+ 566:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 569:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 570:	89 f0                	mov    %esi,%eax
+ 572:	89 fa                	mov    %edi,%edx
+ 574:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 577:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 57a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 57d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 580:	8b 45 10             	mov    0x10(%ebp),%eax
+ 583:	ba 00 00 00 00       	mov    $0x0,%edx
+ 588:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 58b:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 58e:	19 d1                	sbb    %edx,%ecx
+ 590:	72 2f                	jb     5c1 <udiv64+0xbf>
+      r -= d;
+ 592:	8b 45 10             	mov    0x10(%ebp),%eax
+ 595:	ba 00 00 00 00       	mov    $0x0,%edx
+ 59a:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 59d:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 5a0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 5a3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5a8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5ad:	0f a5 c2             	shld   %cl,%eax,%edx
+ 5b0:	d3 e0                	shl    %cl,%eax
+ 5b2:	f6 c1 20             	test   $0x20,%cl
+ 5b5:	74 04                	je     5bb <udiv64+0xb9>
+ 5b7:	89 c2                	mov    %eax,%edx
+ 5b9:	31 c0                	xor    %eax,%eax
+ 5bb:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 5be:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 5c1:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 5c5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 5c9:	0f 89 6d ff ff ff    	jns    53c <udiv64+0x3a>
+    }
+  }
+  return q;
+ 5cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5d2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 5d5:	83 c4 30             	add    $0x30,%esp
+ 5d8:	5e                   	pop    %esi
+ 5d9:	5f                   	pop    %edi
+ 5da:	5d                   	pop    %ebp
+ 5db:	c3                   	ret
+
+000005dc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5dc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5e1:	cd 40                	int    $0x40
+ 5e3:	c3                   	ret
+
+000005e4 <exit>:
+SYSCALL(exit)
+ 5e4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5e9:	cd 40                	int    $0x40
+ 5eb:	c3                   	ret
+
+000005ec <wait>:
+SYSCALL(wait)
+ 5ec:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5f1:	cd 40                	int    $0x40
+ 5f3:	c3                   	ret
+
+000005f4 <pipe>:
+SYSCALL(pipe)
+ 5f4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5f9:	cd 40                	int    $0x40
+ 5fb:	c3                   	ret
+
+000005fc <read>:
+SYSCALL(read)
+ 5fc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 601:	cd 40                	int    $0x40
+ 603:	c3                   	ret
+
+00000604 <write>:
+SYSCALL(write)
+ 604:	b8 10 00 00 00       	mov    $0x10,%eax
+ 609:	cd 40                	int    $0x40
+ 60b:	c3                   	ret
+
+0000060c <close>:
+SYSCALL(close)
+ 60c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+
+00000614 <kill>:
+SYSCALL(kill)
+ 614:	b8 06 00 00 00       	mov    $0x6,%eax
+ 619:	cd 40                	int    $0x40
+ 61b:	c3                   	ret
+
+0000061c <exec>:
+SYSCALL(exec)
+ 61c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 621:	cd 40                	int    $0x40
+ 623:	c3                   	ret
+
+00000624 <open>:
+SYSCALL(open)
+ 624:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <mknod>:
+SYSCALL(mknod)
+ 62c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 631:	cd 40                	int    $0x40
+ 633:	c3                   	ret
+
+00000634 <unlink>:
+SYSCALL(unlink)
+ 634:	b8 12 00 00 00       	mov    $0x12,%eax
+ 639:	cd 40                	int    $0x40
+ 63b:	c3                   	ret
+
+0000063c <fstat>:
+SYSCALL(fstat)
+ 63c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <link>:
+SYSCALL(link)
+ 644:	b8 13 00 00 00       	mov    $0x13,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <mkdir>:
+SYSCALL(mkdir)
+ 64c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <chdir>:
+SYSCALL(chdir)
+ 654:	b8 09 00 00 00       	mov    $0x9,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <dup>:
+SYSCALL(dup)
+ 65c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <getpid>:
+SYSCALL(getpid)
+ 664:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <sbrk>:
+SYSCALL(sbrk)
+ 66c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <sleep>:
+SYSCALL(sleep)
+ 674:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <uptime>:
+SYSCALL(uptime)
+ 67c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 684:	b8 16 00 00 00       	mov    $0x16,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 68c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 694:	b8 18 00 00 00       	mov    $0x18,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <copy_file>:
+SYSCALL(copy_file)
+ 69c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <change_queue>:
+SYSCALL(change_queue)
+ 6a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 6ac:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 6b4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <print_process_info>:
+SYSCALL(print_process_info)
+ 6bc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 6c4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 6cc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 6d4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 6dc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 6e4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 6ec:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 6f4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 6fc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <set_affinity>:
+SYSCALL(set_affinity)
+ 704:	b8 26 00 00 00       	mov    $0x26,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <setsched>:
+SYSCALL(setsched)
+ 70c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 714:	b8 28 00 00 00       	mov    $0x28,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <set_quantum>:
+SYSCALL(set_quantum)
+ 71c:	b8 29 00 00 00       	mov    $0x29,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <schedtrace>:
+SYSCALL(schedtrace)
+ 724:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <getrusage>:
+SYSCALL(getrusage)
+ 72c:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 734:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 73c:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 744:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <futex_wait>:
+SYSCALL(futex_wait)
+ 74c:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <futex_wake>:
+SYSCALL(futex_wake)
+ 754:	b8 30 00 00 00       	mov    $0x30,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <syscall_latency>:
+SYSCALL(syscall_latency)
+ 75c:	b8 31 00 00 00       	mov    $0x31,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <submit_batch>:
+SYSCALL(submit_batch)
+ 764:	b8 32 00 00 00       	mov    $0x32,%eax
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <kmem_stats>:
+SYSCALL(kmem_stats)
+ 76c:	b8 33 00 00 00       	mov    $0x33,%eax
+ 771:	cd 40                	int    $0x40
+ 773:	c3                   	ret
+
+00000774 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 774:	b8 34 00 00 00       	mov    $0x34,%eax
+ 779:	cd 40                	int    $0x40
+ 77b:	c3                   	ret
+
+0000077c <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 77c:	55                   	push   %ebp
+ 77d:	89 e5                	mov    %esp,%ebp
+ 77f:	83 ec 18             	sub    $0x18,%esp
+ 782:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 785:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 788:	83 ec 04             	sub    $0x4,%esp
+ 78b:	6a 01                	push   $0x1
+ 78d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 790:	50                   	push   %eax
+ 791:	ff 75 08             	push   0x8(%ebp)
+ 794:	e8 6b fe ff ff       	call   604 <write>
+ 799:	83 c4 10             	add    $0x10,%esp
+}
+ 79c:	90                   	nop
+ 79d:	c9                   	leave
+ 79e:	c3                   	ret
+
+0000079f <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 79f:	55                   	push   %ebp
+ 7a0:	89 e5                	mov    %esp,%ebp
+ 7a2:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 7a5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 7ac:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 7b0:	74 17                	je     7c9 <printint+0x2a>
+ 7b2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 7b6:	79 11                	jns    7c9 <printint+0x2a>
+    neg = 1;
+ 7b8:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 7bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7c2:	f7 d8                	neg    %eax
+ 7c4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7c7:	eb 06                	jmp    7cf <printint+0x30>
+  } else {
+    x = xx;
+ 7c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7cc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 7cf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 7d6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7d9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7dc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7e1:	f7 f1                	div    %ecx
+ 7e3:	89 d1                	mov    %edx,%ecx
+ 7e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7e8:	8d 50 01             	lea    0x1(%eax),%edx
+ 7eb:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7ee:	0f b6 91 34 13 00 00 	movzbl 0x1334(%ecx),%edx
+ 7f5:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 7f9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7fc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7ff:	ba 00 00 00 00       	mov    $0x0,%edx
+ 804:	f7 f1                	div    %ecx
+ 806:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 809:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 80d:	75 c7                	jne    7d6 <printint+0x37>
+  if(neg)
+ 80f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 813:	74 2d                	je     842 <printint+0xa3>
+    buf[i++] = '-';
+ 815:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 818:	8d 50 01             	lea    0x1(%eax),%edx
+ 81b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 81e:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 823:	eb 1d                	jmp    842 <printint+0xa3>
+    putc(fd, buf[i]);
+ 825:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 828:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 82b:	01 d0                	add    %edx,%eax
+ 82d:	0f b6 00             	movzbl (%eax),%eax
+ 830:	0f be c0             	movsbl %al,%eax
+ 833:	83 ec 08             	sub    $0x8,%esp
+ 836:	50                   	push   %eax
+ 837:	ff 75 08             	push   0x8(%ebp)
+ 83a:	e8 3d ff ff ff       	call   77c <putc>
+ 83f:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 842:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 846:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 84a:	79 d9                	jns    825 <printint+0x86>
+}
+ 84c:	90                   	nop
+ 84d:	90                   	nop
+ 84e:	c9                   	leave
+ 84f:	c3                   	ret
+
+00000850 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 856:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 85d:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 860:	83 c0 04             	add    $0x4,%eax
+ 863:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 866:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 86d:	e9 59 01 00 00       	jmp    9cb <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 872:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 875:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 878:	01 d0                	add    %edx,%eax
+ 87a:	0f b6 00             	movzbl (%eax),%eax
+ 87d:	0f be c0             	movsbl %al,%eax
+ 880:	25 ff 00 00 00       	and    $0xff,%eax
+ 885:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 888:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 88c:	75 2c                	jne    8ba <printf+0x6a>
+      if(c == '%'){
+ 88e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 892:	75 0c                	jne    8a0 <printf+0x50>
+        state = '%';
+ 894:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 89b:	e9 27 01 00 00       	jmp    9c7 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 8a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8a3:	0f be c0             	movsbl %al,%eax
+ 8a6:	83 ec 08             	sub    $0x8,%esp
+ 8a9:	50                   	push   %eax
+ 8aa:	ff 75 08             	push   0x8(%ebp)
+ 8ad:	e8 ca fe ff ff       	call   77c <putc>
+ 8b2:	83 c4 10             	add    $0x10,%esp
+ 8b5:	e9 0d 01 00 00       	jmp    9c7 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 8ba:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 8be:	0f 85 03 01 00 00    	jne    9c7 <printf+0x177>
+      if(c == 'd'){
+ 8c4:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 8c8:	75 1e                	jne    8e8 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 8ca:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8cd:	8b 00                	mov    (%eax),%eax
+ 8cf:	6a 01                	push   $0x1
+ 8d1:	6a 0a                	push   $0xa
+ 8d3:	50                   	push   %eax
+ 8d4:	ff 75 08             	push   0x8(%ebp)
+ 8d7:	e8 c3 fe ff ff       	call   79f <printint>
+ 8dc:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8df:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8e3:	e9 d8 00 00 00       	jmp    9c0 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 8e8:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 8ec:	74 06                	je     8f4 <printf+0xa4>
+ 8ee:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 8f2:	75 1e                	jne    912 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 8f4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8f7:	8b 00                	mov    (%eax),%eax
+ 8f9:	6a 00                	push   $0x0
+ 8fb:	6a 10                	push   $0x10
+ 8fd:	50                   	push   %eax
+ 8fe:	ff 75 08             	push   0x8(%ebp)
+ 901:	e8 99 fe ff ff       	call   79f <printint>
+ 906:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 909:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 90d:	e9 ae 00 00 00       	jmp    9c0 <printf+0x170>
+      } else if(c == 's'){
+ 912:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 916:	75 43                	jne    95b <printf+0x10b>
+        s = (char*)*ap;
+ 918:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 91b:	8b 00                	mov    (%eax),%eax
+ 91d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 920:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 924:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 928:	75 25                	jne    94f <printf+0xff>
+          s = "(null)";
+ 92a:	c7 45 f4 f7 0e 00 00 	movl   $0xef7,-0xc(%ebp)
+        while(*s != 0){
+ 931:	eb 1c                	jmp    94f <printf+0xff>
+          putc(fd, *s);
+ 933:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 936:	0f b6 00             	movzbl (%eax),%eax
+ 939:	0f be c0             	movsbl %al,%eax
+ 93c:	83 ec 08             	sub    $0x8,%esp
+ 93f:	50                   	push   %eax
+ 940:	ff 75 08             	push   0x8(%ebp)
+ 943:	e8 34 fe ff ff       	call   77c <putc>
+ 948:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 94b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 94f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 952:	0f b6 00             	movzbl (%eax),%eax
+ 955:	84 c0                	test   %al,%al
+ 957:	75 da                	jne    933 <printf+0xe3>
+ 959:	eb 65                	jmp    9c0 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 95b:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 95f:	75 1d                	jne    97e <printf+0x12e>
+        putc(fd, *ap);
+ 961:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 964:	8b 00                	mov    (%eax),%eax
+ 966:	0f be c0             	movsbl %al,%eax
+ 969:	83 ec 08             	sub    $0x8,%esp
+ 96c:	50                   	push   %eax
+ 96d:	ff 75 08             	push   0x8(%ebp)
+ 970:	e8 07 fe ff ff       	call   77c <putc>
+ 975:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 978:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 97c:	eb 42                	jmp    9c0 <printf+0x170>
+      } else if(c == '%'){
+ 97e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 982:	75 17                	jne    99b <printf+0x14b>
+        putc(fd, c);
+ 984:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 987:	0f be c0             	movsbl %al,%eax
+ 98a:	83 ec 08             	sub    $0x8,%esp
+ 98d:	50                   	push   %eax
+ 98e:	ff 75 08             	push   0x8(%ebp)
+ 991:	e8 e6 fd ff ff       	call   77c <putc>
+ 996:	83 c4 10             	add    $0x10,%esp
+ 999:	eb 25                	jmp    9c0 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 99b:	83 ec 08             	sub    $0x8,%esp
+ 99e:	6a 25                	push   $0x25
+ 9a0:	ff 75 08             	push   0x8(%ebp)
+ 9a3:	e8 d4 fd ff ff       	call   77c <putc>
+ 9a8:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 9ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9ae:	0f be c0             	movsbl %al,%eax
+ 9b1:	83 ec 08             	sub    $0x8,%esp
+ 9b4:	50                   	push   %eax
+ 9b5:	ff 75 08             	push   0x8(%ebp)
+ 9b8:	e8 bf fd ff ff       	call   77c <putc>
+ 9bd:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 9c0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9c7:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 9cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9ce:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9d1:	01 d0                	add    %edx,%eax
+ 9d3:	0f b6 00             	movzbl (%eax),%eax
+ 9d6:	84 c0                	test   %al,%al
+ 9d8:	0f 85 94 fe ff ff    	jne    872 <printf+0x22>
+    }
+  }
+}
+ 9de:	90                   	nop
+ 9df:	90                   	nop
+ 9e0:	c9                   	leave
+ 9e1:	c3                   	ret
+
+000009e2 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9e2:	55                   	push   %ebp
+ 9e3:	89 e5                	mov    %esp,%ebp
+ 9e5:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 9e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9eb:	83 e8 08             	sub    $0x8,%eax
+ 9ee:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9f1:	a1 58 14 00 00       	mov    0x1458,%eax
+ 9f6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9f9:	eb 24                	jmp    a1f <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9fe:	8b 00                	mov    (%eax),%eax
+ a00:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a03:	72 12                	jb     a17 <free+0x35>
+ a05:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a08:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a0b:	72 24                	jb     a31 <free+0x4f>
+ a0d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a10:	8b 00                	mov    (%eax),%eax
+ a12:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a15:	72 1a                	jb     a31 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a17:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a1a:	8b 00                	mov    (%eax),%eax
+ a1c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a1f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a22:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a25:	73 d4                	jae    9fb <free+0x19>
+ a27:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a2a:	8b 00                	mov    (%eax),%eax
+ a2c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a2f:	73 ca                	jae    9fb <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a31:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a34:	8b 40 04             	mov    0x4(%eax),%eax
+ a37:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a3e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a41:	01 c2                	add    %eax,%edx
+ a43:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a46:	8b 00                	mov    (%eax),%eax
+ a48:	39 c2                	cmp    %eax,%edx
+ a4a:	75 24                	jne    a70 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ a4c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a4f:	8b 50 04             	mov    0x4(%eax),%edx
+ a52:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a55:	8b 00                	mov    (%eax),%eax
+ a57:	8b 40 04             	mov    0x4(%eax),%eax
+ a5a:	01 c2                	add    %eax,%edx
+ a5c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a5f:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a62:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a65:	8b 00                	mov    (%eax),%eax
+ a67:	8b 10                	mov    (%eax),%edx
+ a69:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a6c:	89 10                	mov    %edx,(%eax)
+ a6e:	eb 0a                	jmp    a7a <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a70:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a73:	8b 10                	mov    (%eax),%edx
+ a75:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a78:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ a7a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a7d:	8b 40 04             	mov    0x4(%eax),%eax
+ a80:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a87:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a8a:	01 d0                	add    %edx,%eax
+ a8c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a8f:	75 20                	jne    ab1 <free+0xcf>
+    p->s.size += bp->s.size;
+ a91:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a94:	8b 50 04             	mov    0x4(%eax),%edx
+ a97:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a9a:	8b 40 04             	mov    0x4(%eax),%eax
+ a9d:	01 c2                	add    %eax,%edx
+ a9f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa2:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ aa5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aa8:	8b 10                	mov    (%eax),%edx
+ aaa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aad:	89 10                	mov    %edx,(%eax)
+ aaf:	eb 08                	jmp    ab9 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ ab1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab4:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ ab7:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ ab9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ abc:	a3 58 14 00 00       	mov    %eax,0x1458
+}
+ ac1:	90                   	nop
+ ac2:	c9                   	leave
+ ac3:	c3                   	ret
+
+00000ac4 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ ac4:	55                   	push   %ebp
+ ac5:	89 e5                	mov    %esp,%ebp
+ ac7:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ aca:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ ad1:	77 07                	ja     ada <morecore+0x16>
+    nu = 4096;
+ ad3:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ ada:	8b 45 08             	mov    0x8(%ebp),%eax
+ add:	c1 e0 03             	shl    $0x3,%eax
+ ae0:	83 ec 0c             	sub    $0xc,%esp
+ ae3:	50                   	push   %eax
+ ae4:	e8 83 fb ff ff       	call   66c <sbrk>
+ ae9:	83 c4 10             	add    $0x10,%esp
+ aec:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ aef:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ af3:	75 07                	jne    afc <morecore+0x38>
+    return 0;
+ af5:	b8 00 00 00 00       	mov    $0x0,%eax
+ afa:	eb 26                	jmp    b22 <morecore+0x5e>
+  hp = (Header*)p;
+ afc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aff:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ b02:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b05:	8b 55 08             	mov    0x8(%ebp),%edx
+ b08:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ b0b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b0e:	83 c0 08             	add    $0x8,%eax
+ b11:	83 ec 0c             	sub    $0xc,%esp
+ b14:	50                   	push   %eax
+ b15:	e8 c8 fe ff ff       	call   9e2 <free>
+ b1a:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ b1d:	a1 58 14 00 00       	mov    0x1458,%eax
+}
+ b22:	c9                   	leave
+ b23:	c3                   	ret
+
+00000b24 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b24:	55                   	push   %ebp
+ b25:	89 e5                	mov    %esp,%ebp
+ b27:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b2a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b2d:	83 c0 07             	add    $0x7,%eax
+ b30:	c1 e8 03             	shr    $0x3,%eax
+ b33:	83 c0 01             	add    $0x1,%eax
+ b36:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ b39:	a1 58 14 00 00       	mov    0x1458,%eax
+ b3e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b41:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b45:	75 23                	jne    b6a <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ b47:	c7 45 f0 50 14 00 00 	movl   $0x1450,-0x10(%ebp)
+ b4e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b51:	a3 58 14 00 00       	mov    %eax,0x1458
+ b56:	a1 58 14 00 00       	mov    0x1458,%eax
+ b5b:	a3 50 14 00 00       	mov    %eax,0x1450
+    base.s.size = 0;
+ b60:	c7 05 54 14 00 00 00 	movl   $0x0,0x1454
+ b67:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b6d:	8b 00                	mov    (%eax),%eax
+ b6f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b75:	8b 40 04             	mov    0x4(%eax),%eax
+ b78:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b7b:	72 4d                	jb     bca <malloc+0xa6>
+      if(p->s.size == nunits)
+ b7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b80:	8b 40 04             	mov    0x4(%eax),%eax
+ b83:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b86:	75 0c                	jne    b94 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ b88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b8b:	8b 10                	mov    (%eax),%edx
+ b8d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b90:	89 10                	mov    %edx,(%eax)
+ b92:	eb 26                	jmp    bba <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ b94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b97:	8b 40 04             	mov    0x4(%eax),%eax
+ b9a:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b9d:	89 c2                	mov    %eax,%edx
+ b9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba2:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ba5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba8:	8b 40 04             	mov    0x4(%eax),%eax
+ bab:	c1 e0 03             	shl    $0x3,%eax
+ bae:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ bb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bb4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ bb7:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ bba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bbd:	a3 58 14 00 00       	mov    %eax,0x1458
+      return (void*)(p + 1);
+ bc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bc5:	83 c0 08             	add    $0x8,%eax
+ bc8:	eb 3b                	jmp    c05 <malloc+0xe1>
+    }
+    if(p == freep)
+ bca:	a1 58 14 00 00       	mov    0x1458,%eax
+ bcf:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ bd2:	75 1e                	jne    bf2 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ bd4:	83 ec 0c             	sub    $0xc,%esp
+ bd7:	ff 75 ec             	push   -0x14(%ebp)
+ bda:	e8 e5 fe ff ff       	call   ac4 <morecore>
+ bdf:	83 c4 10             	add    $0x10,%esp
+ be2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ be5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ be9:	75 07                	jne    bf2 <malloc+0xce>
+        return 0;
+ beb:	b8 00 00 00 00       	mov    $0x0,%eax
+ bf0:	eb 13                	jmp    c05 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bf2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ bf8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bfb:	8b 00                	mov    (%eax),%eax
+ bfd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c00:	e9 6d ff ff ff       	jmp    b72 <malloc+0x4e>
+  }
+}
+ c05:	c9                   	leave
+ c06:	c3                   	ret
+
+00000c07 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ c07:	55                   	push   %ebp
+ c08:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ c0a:	8b 45 08             	mov    0x8(%ebp),%eax
+ c0d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c13:	90                   	nop
+ c14:	5d                   	pop    %ebp
+ c15:	c3                   	ret
+
+00000c16 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ c16:	55                   	push   %ebp
+ c17:	89 e5                	mov    %esp,%ebp
+ c19:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ c1c:	8b 55 08             	mov    0x8(%ebp),%edx
+ c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+ c24:	b9 01 00 00 00       	mov    $0x1,%ecx
+ c29:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c2d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c30:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c34:	74 3b                	je     c71 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ c36:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ c3a:	74 2d                	je     c69 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ c3c:	8b 55 08             	mov    0x8(%ebp),%edx
+ c3f:	b8 02 00 00 00       	mov    $0x2,%eax
+ c44:	87 02                	xchg   %eax,(%edx)
+ c46:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ c49:	eb 1e                	jmp    c69 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ c4b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c4e:	83 ec 08             	sub    $0x8,%esp
+ c51:	6a 02                	push   $0x2
+ c53:	50                   	push   %eax
+ c54:	e8 f3 fa ff ff       	call   74c <futex_wait>
+ c59:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ c5c:	8b 55 08             	mov    0x8(%ebp),%edx
+ c5f:	b8 02 00 00 00       	mov    $0x2,%eax
+ c64:	87 02                	xchg   %eax,(%edx)
+ c66:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ c69:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c6d:	75 dc                	jne    c4b <mutex_lock+0x35>
+ c6f:	eb 01                	jmp    c72 <mutex_lock+0x5c>
+    return;
+ c71:	90                   	nop
+  }
+}
+ c72:	c9                   	leave
+ c73:	c3                   	ret
+
+00000c74 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ c74:	55                   	push   %ebp
+ c75:	89 e5                	mov    %esp,%ebp
+ c77:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ c7a:	8b 45 08             	mov    0x8(%ebp),%eax
+ c7d:	ba 01 00 00 00       	mov    $0x1,%edx
+ c82:	f7 da                	neg    %edx
+ c84:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ c88:	83 fa 01             	cmp    $0x1,%edx
+ c8b:	74 1a                	je     ca7 <mutex_unlock+0x33>
+    m->state = 0;
+ c8d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c90:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ c96:	8b 45 08             	mov    0x8(%ebp),%eax
+ c99:	83 ec 08             	sub    $0x8,%esp
+ c9c:	6a 01                	push   $0x1
+ c9e:	50                   	push   %eax
+ c9f:	e8 b0 fa ff ff       	call   754 <futex_wake>
+ ca4:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ ca7:	90                   	nop
+ ca8:	c9                   	leave
+ ca9:	c3                   	ret
+
+00000caa <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ caa:	55                   	push   %ebp
+ cab:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ cad:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ cb6:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ cc0:	90                   	nop
+ cc1:	5d                   	pop    %ebp
+ cc2:	c3                   	ret
+
+00000cc3 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ cc3:	55                   	push   %ebp
+ cc4:	89 e5                	mov    %esp,%ebp
+ cc6:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ cc9:	8b 45 08             	mov    0x8(%ebp),%eax
+ ccc:	83 c0 04             	add    $0x4,%eax
+ ccf:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ cd3:	8b 45 08             	mov    0x8(%ebp),%eax
+ cd6:	83 ec 08             	sub    $0x8,%esp
+ cd9:	ff 75 0c             	push   0xc(%ebp)
+ cdc:	50                   	push   %eax
+ cdd:	e8 6a fa ff ff       	call   74c <futex_wait>
+ ce2:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ ce5:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce8:	83 c0 04             	add    $0x4,%eax
+ ceb:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ cef:	90                   	nop
+ cf0:	c9                   	leave
+ cf1:	c3                   	ret
+
+00000cf2 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ cf2:	55                   	push   %ebp
+ cf3:	89 e5                	mov    %esp,%ebp
+ cf5:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ cf8:	8b 45 08             	mov    0x8(%ebp),%eax
+ cfb:	8b 00                	mov    (%eax),%eax
+ cfd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ d00:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d04:	78 17                	js     d1d <rwlock_rdlock+0x2b>
+ d06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d09:	83 c0 01             	add    $0x1,%eax
+ d0c:	89 c1                	mov    %eax,%ecx
+ d0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d11:	8b 55 08             	mov    0x8(%ebp),%edx
+ d14:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ d18:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d1b:	74 19                	je     d36 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ d1d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d21:	79 d5                	jns    cf8 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ d23:	83 ec 08             	sub    $0x8,%esp
+ d26:	ff 75 f4             	push   -0xc(%ebp)
+ d29:	ff 75 08             	push   0x8(%ebp)
+ d2c:	e8 92 ff ff ff       	call   cc3 <rwlock_sleep>
+ d31:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ d34:	eb c2                	jmp    cf8 <rwlock_rdlock+0x6>
+      return;
+ d36:	90                   	nop
+  }
+}
+ d37:	c9                   	leave
+ d38:	c3                   	ret
+
+00000d39 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ d39:	55                   	push   %ebp
+ d3a:	89 e5                	mov    %esp,%ebp
+ d3c:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ d3f:	eb 11                	jmp    d52 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ d41:	83 ec 08             	sub    $0x8,%esp
+ d44:	ff 75 f4             	push   -0xc(%ebp)
+ d47:	ff 75 08             	push   0x8(%ebp)
+ d4a:	e8 74 ff ff ff       	call   cc3 <rwlock_sleep>
+ d4f:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ d52:	8b 55 08             	mov    0x8(%ebp),%edx
+ d55:	b8 00 00 00 00       	mov    $0x0,%eax
+ d5a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ d5f:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ d63:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d66:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d6a:	75 d5                	jne    d41 <rwlock_wrlock+0x8>
+}
+ d6c:	90                   	nop
+ d6d:	90                   	nop
+ d6e:	c9                   	leave
+ d6f:	c3                   	ret
+
+00000d70 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ d70:	55                   	push   %ebp
+ d71:	89 e5                	mov    %esp,%ebp
+ d73:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ d76:	8b 45 08             	mov    0x8(%ebp),%eax
+ d79:	8b 00                	mov    (%eax),%eax
+ d7b:	85 c0                	test   %eax,%eax
+ d7d:	79 0c                	jns    d8b <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ d7f:	8b 45 08             	mov    0x8(%ebp),%eax
+ d82:	ba 00 00 00 00       	mov    $0x0,%edx
+ d87:	87 10                	xchg   %edx,(%eax)
+ d89:	eb 18                	jmp    da3 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ d8b:	8b 55 08             	mov    0x8(%ebp),%edx
+ d8e:	b8 01 00 00 00       	mov    $0x1,%eax
+ d93:	f7 d8                	neg    %eax
+ d95:	89 c1                	mov    %eax,%ecx
+ d97:	89 c8                	mov    %ecx,%eax
+ d99:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ d9d:	01 c8                	add    %ecx,%eax
+ d9f:	85 c0                	test   %eax,%eax
+ da1:	75 20                	jne    dc3 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ da3:	8b 45 08             	mov    0x8(%ebp),%eax
+ da6:	8b 40 04             	mov    0x4(%eax),%eax
+ da9:	85 c0                	test   %eax,%eax
+ dab:	74 17                	je     dc4 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ dad:	8b 45 08             	mov    0x8(%ebp),%eax
+ db0:	83 ec 08             	sub    $0x8,%esp
+ db3:	68 ff ff ff 7f       	push   $0x7fffffff
+ db8:	50                   	push   %eax
+ db9:	e8 96 f9 ff ff       	call   754 <futex_wake>
+ dbe:	83 c4 10             	add    $0x10,%esp
+ dc1:	eb 01                	jmp    dc4 <rwlock_unlock+0x54>
+    return;
+ dc3:	90                   	nop
+}
+ dc4:	c9                   	leave
+ dc5:	c3                   	ret
+
+00000dc6 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ dc6:	55                   	push   %ebp
+ dc7:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ dc9:	8b 45 08             	mov    0x8(%ebp),%eax
+ dcc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ dd2:	90                   	nop
+ dd3:	5d                   	pop    %ebp
+ dd4:	c3                   	ret
+
+00000dd5 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ dd5:	55                   	push   %ebp
+ dd6:	89 e5                	mov    %esp,%ebp
+ dd8:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ ddb:	8b 45 08             	mov    0x8(%ebp),%eax
+ dde:	8b 00                	mov    (%eax),%eax
+ de0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ de3:	83 ec 0c             	sub    $0xc,%esp
+ de6:	ff 75 0c             	push   0xc(%ebp)
+ de9:	e8 86 fe ff ff       	call   c74 <mutex_unlock>
+ dee:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ df1:	8b 45 08             	mov    0x8(%ebp),%eax
+ df4:	83 ec 08             	sub    $0x8,%esp
+ df7:	ff 75 f4             	push   -0xc(%ebp)
+ dfa:	50                   	push   %eax
+ dfb:	e8 4c f9 ff ff       	call   74c <futex_wait>
+ e00:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ e03:	83 ec 0c             	sub    $0xc,%esp
+ e06:	ff 75 0c             	push   0xc(%ebp)
+ e09:	e8 08 fe ff ff       	call   c16 <mutex_lock>
+ e0e:	83 c4 10             	add    $0x10,%esp
+}
+ e11:	90                   	nop
+ e12:	c9                   	leave
+ e13:	c3                   	ret
+
+00000e14 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ e14:	55                   	push   %ebp
+ e15:	89 e5                	mov    %esp,%ebp
+ e17:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ e1a:	8b 45 08             	mov    0x8(%ebp),%eax
+ e1d:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ e21:	8b 45 08             	mov    0x8(%ebp),%eax
+ e24:	83 ec 08             	sub    $0x8,%esp
+ e27:	6a 01                	push   $0x1
+ e29:	50                   	push   %eax
+ e2a:	e8 25 f9 ff ff       	call   754 <futex_wake>
+ e2f:	83 c4 10             	add    $0x10,%esp
+}
+ e32:	90                   	nop
+ e33:	c9                   	leave
+ e34:	c3                   	ret
+
+00000e35 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ e35:	55                   	push   %ebp
+ e36:	89 e5                	mov    %esp,%ebp
+ e38:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ e3b:	8b 45 08             	mov    0x8(%ebp),%eax
+ e3e:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ e42:	8b 45 08             	mov    0x8(%ebp),%eax
+ e45:	83 ec 08             	sub    $0x8,%esp
+ e48:	68 ff ff ff 7f       	push   $0x7fffffff
+ e4d:	50                   	push   %eax
+ e4e:	e8 01 f9 ff ff       	call   754 <futex_wake>
+ e53:	83 c4 10             	add    $0x10,%esp
+}
+ e56:	90                   	nop
+ e57:	c9                   	leave
+ e58:	c3                   	ret
@@ -0,0 +1,77 @@
+#include "types.h"
+#include "x86.h"
+#include "user.h"
+#include "param.h"
+#include "kmemstat.h"
+
+// Several workers fork and reap short-lived children at once, so
+// every CPU allocates and frees pages in parallel. Reports the
+// TSC cycles per fork and each CPU's page allocator activity over
+// the run: few steals per allocation mean CPUs rarely touch
+// anyone's free list but their own, and zhits are pages that
+// kzalloc() found zeroed already. "forkstorm nojunk" runs with
+// junk-filling of freed pages turned off.
+
+#define NWORKERS 4
+#define NFORKS 100
+
+static struct kmemstat before[NCPU], after[NCPU];
+
+void worker(void)
+{
+    int i, pid;
+
+    for (i = 0; i < NFORKS; i++)
+    {
+        pid = fork();
+        if (pid < 0)
+        {
+            printf(1, "forkstorm: fork failed\n");
+            exit();
+        }
+        if (pid == 0)
+            exit();
+        wait();
+    }
+    exit();
+}
+
+int main(int argc, char *argv[])
+{
+    uint64 start;
+    int i, n, ncpu, junk;
+
+    junk = kmem_junk(!(argc > 1 && strcmp(argv[1], "nojunk") == 0));
+    ncpu = kmem_stats(before, NCPU);
+    start = rdtsc();
+    for (i = 0; i < NWORKERS; i++)
+    {
+        n = fork();
+        if (n < 0)
+        {
+            printf(1, "forkstorm: fork failed\n");
+            exit();
+        }
+        if (n == 0)
+            worker();
+    }
+    for (i = 0; i < NWORKERS; i++)
+        wait();
+    start = rdtsc() - start;
+    kmem_stats(after, NCPU);
+    kmem_junk(junk);
+
+    printf(1, "%d workers x %d forks: %d cycles per fork\n", NWORKERS, NFORKS,
+           (int)udiv64(start, NWORKERS * NFORKS));
+    printf(1, "cpu\tallocs\tfrees\tsteals\tstolen\tzhits\tzfills\tfree now\n");
+    for (i = 0; i < ncpu && i < NCPU; i++)
+        printf(1, "%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", i,
+               after[i].allocs - before[i].allocs,
+               after[i].frees - before[i].frees,
+               after[i].steals - before[i].steals,
+               after[i].stolen - before[i].stolen,
+               after[i].zhits - before[i].zhits,
+               after[i].zfills - before[i].zfills,
+               after[i].nfree);
+    exit();
+}
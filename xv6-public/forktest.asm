@@ -0,0 +1,906 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printf>:
+
+#define N  1000
+
+void
+printf(int fd, const char *s, ...)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+  write(fd, s, strlen(s));
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	ff 75 0c             	push   0xc(%ebp)
+   c:	e8 8c 01 00 00       	call   19d <strlen>
+  11:	83 c4 10             	add    $0x10,%esp
+  14:	83 ec 04             	sub    $0x4,%esp
+  17:	50                   	push   %eax
+  18:	ff 75 0c             	push   0xc(%ebp)
+  1b:	ff 75 08             	push   0x8(%ebp)
+  1e:	e8 36 04 00 00       	call   459 <write>
+  23:	83 c4 10             	add    $0x10,%esp
+}
+  26:	90                   	nop
+  27:	c9                   	leave
+  28:	c3                   	ret
+
+00000029 <forktest>:
+
+void
+forktest(void)
+{
+  29:	55                   	push   %ebp
+  2a:	89 e5                	mov    %esp,%ebp
+  2c:	83 ec 18             	sub    $0x18,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+  2f:	83 ec 08             	sub    $0x8,%esp
+  32:	68 d4 05 00 00       	push   $0x5d4
+  37:	6a 01                	push   $0x1
+  39:	e8 c2 ff ff ff       	call   0 <printf>
+  3e:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<N; n++){
+  41:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  48:	eb 1d                	jmp    67 <forktest+0x3e>
+    pid = fork();
+  4a:	e8 e2 03 00 00       	call   431 <fork>
+  4f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0)
+  52:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  56:	78 1a                	js     72 <forktest+0x49>
+      break;
+    if(pid == 0)
+  58:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  5c:	75 05                	jne    63 <forktest+0x3a>
+      exit();
+  5e:	e8 d6 03 00 00       	call   439 <exit>
+  for(n=0; n<N; n++){
+  63:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  67:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+  6e:	7e da                	jle    4a <forktest+0x21>
+  70:	eb 01                	jmp    73 <forktest+0x4a>
+      break;
+  72:	90                   	nop
+  }
+
+  if(n == N){
+  73:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+  7a:	75 40                	jne    bc <forktest+0x93>
+    printf(1, "fork claimed to work N times!\n", N);
+  7c:	83 ec 04             	sub    $0x4,%esp
+  7f:	68 e8 03 00 00       	push   $0x3e8
+  84:	68 e0 05 00 00       	push   $0x5e0
+  89:	6a 01                	push   $0x1
+  8b:	e8 70 ff ff ff       	call   0 <printf>
+  90:	83 c4 10             	add    $0x10,%esp
+    exit();
+  93:	e8 a1 03 00 00       	call   439 <exit>
+  }
+
+  for(; n > 0; n--){
+    if(wait() < 0){
+  98:	e8 a4 03 00 00       	call   441 <wait>
+  9d:	85 c0                	test   %eax,%eax
+  9f:	79 17                	jns    b8 <forktest+0x8f>
+      printf(1, "wait stopped early\n");
+  a1:	83 ec 08             	sub    $0x8,%esp
+  a4:	68 ff 05 00 00       	push   $0x5ff
+  a9:	6a 01                	push   $0x1
+  ab:	e8 50 ff ff ff       	call   0 <printf>
+  b0:	83 c4 10             	add    $0x10,%esp
+      exit();
+  b3:	e8 81 03 00 00       	call   439 <exit>
+  for(; n > 0; n--){
+  b8:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  c0:	7f d6                	jg     98 <forktest+0x6f>
+    }
+  }
+
+  if(wait() != -1){
+  c2:	e8 7a 03 00 00       	call   441 <wait>
+  c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  ca:	74 17                	je     e3 <forktest+0xba>
+    printf(1, "wait got too many\n");
+  cc:	83 ec 08             	sub    $0x8,%esp
+  cf:	68 13 06 00 00       	push   $0x613
+  d4:	6a 01                	push   $0x1
+  d6:	e8 25 ff ff ff       	call   0 <printf>
+  db:	83 c4 10             	add    $0x10,%esp
+    exit();
+  de:	e8 56 03 00 00       	call   439 <exit>
+  }
+
+  printf(1, "fork test OK\n");
+  e3:	83 ec 08             	sub    $0x8,%esp
+  e6:	68 26 06 00 00       	push   $0x626
+  eb:	6a 01                	push   $0x1
+  ed:	e8 0e ff ff ff       	call   0 <printf>
+  f2:	83 c4 10             	add    $0x10,%esp
+}
+  f5:	90                   	nop
+  f6:	c9                   	leave
+  f7:	c3                   	ret
+
+000000f8 <main>:
+
+int
+main(void)
+{
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+  fe:	e8 26 ff ff ff       	call   29 <forktest>
+  exit();
+ 103:	e8 31 03 00 00       	call   439 <exit>
+
+00000108 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 108:	55                   	push   %ebp
+ 109:	89 e5                	mov    %esp,%ebp
+ 10b:	57                   	push   %edi
+ 10c:	53                   	push   %ebx
+{
+ 10d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 110:	8b 55 10             	mov    0x10(%ebp),%edx
+ 113:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 116:	89 cb                	mov    %ecx,%ebx
+ 118:	89 df                	mov    %ebx,%edi
+ 11a:	89 d1                	mov    %edx,%ecx
+ 11c:	fc                   	cld
+ 11d:	f3 aa                	rep stos %al,%es:(%edi)
+ 11f:	89 ca                	mov    %ecx,%edx
+ 121:	89 fb                	mov    %edi,%ebx
+ 123:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 126:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 129:	90                   	nop
+ 12a:	5b                   	pop    %ebx
+ 12b:	5f                   	pop    %edi
+ 12c:	5d                   	pop    %ebp
+ 12d:	c3                   	ret
+
+0000012e <strcpy>:
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+ 131:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 134:	8b 45 08             	mov    0x8(%ebp),%eax
+ 137:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 13a:	90                   	nop
+ 13b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 13e:	8d 42 01             	lea    0x1(%edx),%eax
+ 141:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 144:	8b 45 08             	mov    0x8(%ebp),%eax
+ 147:	8d 48 01             	lea    0x1(%eax),%ecx
+ 14a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 14d:	0f b6 12             	movzbl (%edx),%edx
+ 150:	88 10                	mov    %dl,(%eax)
+ 152:	0f b6 00             	movzbl (%eax),%eax
+ 155:	84 c0                	test   %al,%al
+ 157:	75 e2                	jne    13b <strcpy+0xd>
+  return os;
+ 159:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 15c:	c9                   	leave
+ 15d:	c3                   	ret
+
+0000015e <strcmp>:
+{
+ 15e:	55                   	push   %ebp
+ 15f:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 161:	eb 08                	jmp    16b <strcmp+0xd>
+    p++, q++;
+ 163:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 167:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	0f b6 00             	movzbl (%eax),%eax
+ 171:	84 c0                	test   %al,%al
+ 173:	74 10                	je     185 <strcmp+0x27>
+ 175:	8b 45 08             	mov    0x8(%ebp),%eax
+ 178:	0f b6 10             	movzbl (%eax),%edx
+ 17b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 17e:	0f b6 00             	movzbl (%eax),%eax
+ 181:	38 c2                	cmp    %al,%dl
+ 183:	74 de                	je     163 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 185:	8b 45 08             	mov    0x8(%ebp),%eax
+ 188:	0f b6 00             	movzbl (%eax),%eax
+ 18b:	0f b6 d0             	movzbl %al,%edx
+ 18e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 191:	0f b6 00             	movzbl (%eax),%eax
+ 194:	0f b6 c0             	movzbl %al,%eax
+ 197:	29 c2                	sub    %eax,%edx
+ 199:	89 d0                	mov    %edx,%eax
+}
+ 19b:	5d                   	pop    %ebp
+ 19c:	c3                   	ret
+
+0000019d <strlen>:
+{
+ 19d:	55                   	push   %ebp
+ 19e:	89 e5                	mov    %esp,%ebp
+ 1a0:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1aa:	eb 04                	jmp    1b0 <strlen+0x13>
+ 1ac:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1b0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	01 d0                	add    %edx,%eax
+ 1b8:	0f b6 00             	movzbl (%eax),%eax
+ 1bb:	84 c0                	test   %al,%al
+ 1bd:	75 ed                	jne    1ac <strlen+0xf>
+  return n;
+ 1bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1c2:	c9                   	leave
+ 1c3:	c3                   	ret
+
+000001c4 <memset>:
+{
+ 1c4:	55                   	push   %ebp
+ 1c5:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1c7:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1ca:	50                   	push   %eax
+ 1cb:	ff 75 0c             	push   0xc(%ebp)
+ 1ce:	ff 75 08             	push   0x8(%ebp)
+ 1d1:	e8 32 ff ff ff       	call   108 <stosb>
+ 1d6:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1d9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1dc:	c9                   	leave
+ 1dd:	c3                   	ret
+
+000001de <strchr>:
+{
+ 1de:	55                   	push   %ebp
+ 1df:	89 e5                	mov    %esp,%ebp
+ 1e1:	83 ec 04             	sub    $0x4,%esp
+ 1e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e7:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1ea:	eb 14                	jmp    200 <strchr+0x22>
+    if(*s == c)
+ 1ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ef:	0f b6 00             	movzbl (%eax),%eax
+ 1f2:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1f5:	75 05                	jne    1fc <strchr+0x1e>
+      return (char*)s;
+ 1f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fa:	eb 13                	jmp    20f <strchr+0x31>
+  for(; *s; s++)
+ 1fc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 200:	8b 45 08             	mov    0x8(%ebp),%eax
+ 203:	0f b6 00             	movzbl (%eax),%eax
+ 206:	84 c0                	test   %al,%al
+ 208:	75 e2                	jne    1ec <strchr+0xe>
+  return 0;
+ 20a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 20f:	c9                   	leave
+ 210:	c3                   	ret
+
+00000211 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 211:	55                   	push   %ebp
+ 212:	89 e5                	mov    %esp,%ebp
+ 214:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 217:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 21e:	eb 42                	jmp    262 <gets+0x51>
+    cc = read(0, &c, 1);
+ 220:	83 ec 04             	sub    $0x4,%esp
+ 223:	6a 01                	push   $0x1
+ 225:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 228:	50                   	push   %eax
+ 229:	6a 00                	push   $0x0
+ 22b:	e8 21 02 00 00       	call   451 <read>
+ 230:	83 c4 10             	add    $0x10,%esp
+ 233:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 236:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 23a:	7e 33                	jle    26f <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 23c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 23f:	8d 50 01             	lea    0x1(%eax),%edx
+ 242:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 245:	89 c2                	mov    %eax,%edx
+ 247:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24a:	01 c2                	add    %eax,%edx
+ 24c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 250:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 252:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 256:	3c 0a                	cmp    $0xa,%al
+ 258:	74 16                	je     270 <gets+0x5f>
+ 25a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 25e:	3c 0d                	cmp    $0xd,%al
+ 260:	74 0e                	je     270 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 262:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 265:	83 c0 01             	add    $0x1,%eax
+ 268:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 26b:	7f b3                	jg     220 <gets+0xf>
+ 26d:	eb 01                	jmp    270 <gets+0x5f>
+      break;
+ 26f:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 270:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	01 d0                	add    %edx,%eax
+ 278:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 27b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 27e:	c9                   	leave
+ 27f:	c3                   	ret
+
+00000280 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 286:	83 ec 08             	sub    $0x8,%esp
+ 289:	6a 00                	push   $0x0
+ 28b:	ff 75 08             	push   0x8(%ebp)
+ 28e:	e8 e6 01 00 00       	call   479 <open>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 299:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 29d:	79 07                	jns    2a6 <stat+0x26>
+    return -1;
+ 29f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2a4:	eb 25                	jmp    2cb <stat+0x4b>
+  r = fstat(fd, st);
+ 2a6:	83 ec 08             	sub    $0x8,%esp
+ 2a9:	ff 75 0c             	push   0xc(%ebp)
+ 2ac:	ff 75 f4             	push   -0xc(%ebp)
+ 2af:	e8 dd 01 00 00       	call   491 <fstat>
+ 2b4:	83 c4 10             	add    $0x10,%esp
+ 2b7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2ba:	83 ec 0c             	sub    $0xc,%esp
+ 2bd:	ff 75 f4             	push   -0xc(%ebp)
+ 2c0:	e8 9c 01 00 00       	call   461 <close>
+ 2c5:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2c8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2cb:	c9                   	leave
+ 2cc:	c3                   	ret
+
+000002cd <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2cd:	55                   	push   %ebp
+ 2ce:	89 e5                	mov    %esp,%ebp
+ 2d0:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2d3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2da:	eb 25                	jmp    301 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2dc:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2df:	89 d0                	mov    %edx,%eax
+ 2e1:	c1 e0 02             	shl    $0x2,%eax
+ 2e4:	01 d0                	add    %edx,%eax
+ 2e6:	01 c0                	add    %eax,%eax
+ 2e8:	89 c1                	mov    %eax,%ecx
+ 2ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ed:	8d 50 01             	lea    0x1(%eax),%edx
+ 2f0:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2f3:	0f b6 00             	movzbl (%eax),%eax
+ 2f6:	0f be c0             	movsbl %al,%eax
+ 2f9:	01 c8                	add    %ecx,%eax
+ 2fb:	83 e8 30             	sub    $0x30,%eax
+ 2fe:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 301:	8b 45 08             	mov    0x8(%ebp),%eax
+ 304:	0f b6 00             	movzbl (%eax),%eax
+ 307:	3c 2f                	cmp    $0x2f,%al
+ 309:	7e 0a                	jle    315 <atoi+0x48>
+ 30b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30e:	0f b6 00             	movzbl (%eax),%eax
+ 311:	3c 39                	cmp    $0x39,%al
+ 313:	7e c7                	jle    2dc <atoi+0xf>
+  return n;
+ 315:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 318:	c9                   	leave
+ 319:	c3                   	ret
+
+0000031a <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 31a:	55                   	push   %ebp
+ 31b:	89 e5                	mov    %esp,%ebp
+ 31d:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 320:	8b 45 08             	mov    0x8(%ebp),%eax
+ 323:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 326:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 329:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 32c:	eb 17                	jmp    345 <memmove+0x2b>
+    *dst++ = *src++;
+ 32e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 331:	8d 42 01             	lea    0x1(%edx),%eax
+ 334:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 337:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 33a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 33d:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 340:	0f b6 12             	movzbl (%edx),%edx
+ 343:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 345:	8b 45 10             	mov    0x10(%ebp),%eax
+ 348:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 34b:	89 55 10             	mov    %edx,0x10(%ebp)
+ 34e:	85 c0                	test   %eax,%eax
+ 350:	7f dc                	jg     32e <memmove+0x14>
+  return vdst;
+ 352:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 355:	c9                   	leave
+ 356:	c3                   	ret
+
+00000357 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 357:	55                   	push   %ebp
+ 358:	89 e5                	mov    %esp,%ebp
+ 35a:	57                   	push   %edi
+ 35b:	56                   	push   %esi
+ 35c:	83 ec 30             	sub    $0x30,%esp
+ 35f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 362:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 365:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 368:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 36b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 372:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 379:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 37c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 37f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 382:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 385:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 38c:	e9 89 00 00 00       	jmp    41a <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 391:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 394:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 397:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 39b:	01 c0                	add    %eax,%eax
+ 39d:	89 c6                	mov    %eax,%esi
+ 39f:	89 d7                	mov    %edx,%edi
+ 3a1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3a4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 3a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 3aa:	0f ad d0             	shrd   %cl,%edx,%eax
+ 3ad:	d3 ea                	shr    %cl,%edx
+ 3af:	f6 c1 20             	test   $0x20,%cl
+ 3b2:	74 04                	je     3b8 <udiv64+0x61>
+ 3b4:	89 d0                	mov    %edx,%eax
+ 3b6:	31 d2                	xor    %edx,%edx
+ 3b8:	83 e0 01             	and    $0x1,%eax
+ 3bb:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 3be:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 3c5:	89 f0                	mov    %esi,%eax
+ 3c7:	89 fa                	mov    %edi,%edx
+ 3c9:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 3cc:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 3cf:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 3d2:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 3d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3dd:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 3e0:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 3e3:	19 d1                	sbb    %edx,%ecx
+ 3e5:	72 2f                	jb     416 <udiv64+0xbf>
+      r -= d;
+ 3e7:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3ea:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3ef:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 3f2:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 3f5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3f8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3fd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 402:	0f a5 c2             	shld   %cl,%eax,%edx
+ 405:	d3 e0                	shl    %cl,%eax
+ 407:	f6 c1 20             	test   $0x20,%cl
+ 40a:	74 04                	je     410 <udiv64+0xb9>
+ 40c:	89 c2                	mov    %eax,%edx
+ 40e:	31 c0                	xor    %eax,%eax
+ 410:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 413:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 416:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 41a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 41e:	0f 89 6d ff ff ff    	jns    391 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 424:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 427:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 42a:	83 c4 30             	add    $0x30,%esp
+ 42d:	5e                   	pop    %esi
+ 42e:	5f                   	pop    %edi
+ 42f:	5d                   	pop    %ebp
+ 430:	c3                   	ret
+
+00000431 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 431:	b8 01 00 00 00       	mov    $0x1,%eax
+ 436:	cd 40                	int    $0x40
+ 438:	c3                   	ret
+
+00000439 <exit>:
+SYSCALL(exit)
+ 439:	b8 02 00 00 00       	mov    $0x2,%eax
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <wait>:
+SYSCALL(wait)
+ 441:	b8 03 00 00 00       	mov    $0x3,%eax
+ 446:	cd 40                	int    $0x40
+ 448:	c3                   	ret
+
+00000449 <pipe>:
+SYSCALL(pipe)
+ 449:	b8 04 00 00 00       	mov    $0x4,%eax
+ 44e:	cd 40                	int    $0x40
+ 450:	c3                   	ret
+
+00000451 <read>:
+SYSCALL(read)
+ 451:	b8 05 00 00 00       	mov    $0x5,%eax
+ 456:	cd 40                	int    $0x40
+ 458:	c3                   	ret
+
+00000459 <write>:
+SYSCALL(write)
+ 459:	b8 10 00 00 00       	mov    $0x10,%eax
+ 45e:	cd 40                	int    $0x40
+ 460:	c3                   	ret
+
+00000461 <close>:
+SYSCALL(close)
+ 461:	b8 15 00 00 00       	mov    $0x15,%eax
+ 466:	cd 40                	int    $0x40
+ 468:	c3                   	ret
+
+00000469 <kill>:
+SYSCALL(kill)
+ 469:	b8 06 00 00 00       	mov    $0x6,%eax
+ 46e:	cd 40                	int    $0x40
+ 470:	c3                   	ret
+
+00000471 <exec>:
+SYSCALL(exec)
+ 471:	b8 07 00 00 00       	mov    $0x7,%eax
+ 476:	cd 40                	int    $0x40
+ 478:	c3                   	ret
+
+00000479 <open>:
+SYSCALL(open)
+ 479:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 47e:	cd 40                	int    $0x40
+ 480:	c3                   	ret
+
+00000481 <mknod>:
+SYSCALL(mknod)
+ 481:	b8 11 00 00 00       	mov    $0x11,%eax
+ 486:	cd 40                	int    $0x40
+ 488:	c3                   	ret
+
+00000489 <unlink>:
+SYSCALL(unlink)
+ 489:	b8 12 00 00 00       	mov    $0x12,%eax
+ 48e:	cd 40                	int    $0x40
+ 490:	c3                   	ret
+
+00000491 <fstat>:
+SYSCALL(fstat)
+ 491:	b8 08 00 00 00       	mov    $0x8,%eax
+ 496:	cd 40                	int    $0x40
+ 498:	c3                   	ret
+
+00000499 <link>:
+SYSCALL(link)
+ 499:	b8 13 00 00 00       	mov    $0x13,%eax
+ 49e:	cd 40                	int    $0x40
+ 4a0:	c3                   	ret
+
+000004a1 <mkdir>:
+SYSCALL(mkdir)
+ 4a1:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4a6:	cd 40                	int    $0x40
+ 4a8:	c3                   	ret
+
+000004a9 <chdir>:
+SYSCALL(chdir)
+ 4a9:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4ae:	cd 40                	int    $0x40
+ 4b0:	c3                   	ret
+
+000004b1 <dup>:
+SYSCALL(dup)
+ 4b1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4b6:	cd 40                	int    $0x40
+ 4b8:	c3                   	ret
+
+000004b9 <getpid>:
+SYSCALL(getpid)
+ 4b9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4be:	cd 40                	int    $0x40
+ 4c0:	c3                   	ret
+
+000004c1 <sbrk>:
+SYSCALL(sbrk)
+ 4c1:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4c6:	cd 40                	int    $0x40
+ 4c8:	c3                   	ret
+
+000004c9 <sleep>:
+SYSCALL(sleep)
+ 4c9:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4ce:	cd 40                	int    $0x40
+ 4d0:	c3                   	ret
+
+000004d1 <uptime>:
+SYSCALL(uptime)
+ 4d1:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4d6:	cd 40                	int    $0x40
+ 4d8:	c3                   	ret
+
+000004d9 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 4d9:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4de:	cd 40                	int    $0x40
+ 4e0:	c3                   	ret
+
+000004e1 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 4e1:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4e6:	cd 40                	int    $0x40
+ 4e8:	c3                   	ret
+
+000004e9 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 4e9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4ee:	cd 40                	int    $0x40
+ 4f0:	c3                   	ret
+
+000004f1 <copy_file>:
+SYSCALL(copy_file)
+ 4f1:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4f6:	cd 40                	int    $0x40
+ 4f8:	c3                   	ret
+
+000004f9 <change_queue>:
+SYSCALL(change_queue)
+ 4f9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4fe:	cd 40                	int    $0x40
+ 500:	c3                   	ret
+
+00000501 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 501:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 506:	cd 40                	int    $0x40
+ 508:	c3                   	ret
+
+00000509 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 509:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 50e:	cd 40                	int    $0x40
+ 510:	c3                   	ret
+
+00000511 <print_process_info>:
+SYSCALL(print_process_info)
+ 511:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 516:	cd 40                	int    $0x40
+ 518:	c3                   	ret
+
+00000519 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 519:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 51e:	cd 40                	int    $0x40
+ 520:	c3                   	ret
+
+00000521 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 521:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 526:	cd 40                	int    $0x40
+ 528:	c3                   	ret
+
+00000529 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 529:	b8 20 00 00 00       	mov    $0x20,%eax
+ 52e:	cd 40                	int    $0x40
+ 530:	c3                   	ret
+
+00000531 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 531:	b8 21 00 00 00       	mov    $0x21,%eax
+ 536:	cd 40                	int    $0x40
+ 538:	c3                   	ret
+
+00000539 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 539:	b8 22 00 00 00       	mov    $0x22,%eax
+ 53e:	cd 40                	int    $0x40
+ 540:	c3                   	ret
+
+00000541 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 541:	b8 23 00 00 00       	mov    $0x23,%eax
+ 546:	cd 40                	int    $0x40
+ 548:	c3                   	ret
+
+00000549 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 549:	b8 24 00 00 00       	mov    $0x24,%eax
+ 54e:	cd 40                	int    $0x40
+ 550:	c3                   	ret
+
+00000551 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 551:	b8 25 00 00 00       	mov    $0x25,%eax
+ 556:	cd 40                	int    $0x40
+ 558:	c3                   	ret
+
+00000559 <set_affinity>:
+SYSCALL(set_affinity)
+ 559:	b8 26 00 00 00       	mov    $0x26,%eax
+ 55e:	cd 40                	int    $0x40
+ 560:	c3                   	ret
+
+00000561 <setsched>:
+SYSCALL(setsched)
+ 561:	b8 27 00 00 00       	mov    $0x27,%eax
+ 566:	cd 40                	int    $0x40
+ 568:	c3                   	ret
+
+00000569 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 569:	b8 28 00 00 00       	mov    $0x28,%eax
+ 56e:	cd 40                	int    $0x40
+ 570:	c3                   	ret
+
+00000571 <set_quantum>:
+SYSCALL(set_quantum)
+ 571:	b8 29 00 00 00       	mov    $0x29,%eax
+ 576:	cd 40                	int    $0x40
+ 578:	c3                   	ret
+
+00000579 <schedtrace>:
+SYSCALL(schedtrace)
+ 579:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 57e:	cd 40                	int    $0x40
+ 580:	c3                   	ret
+
+00000581 <getrusage>:
+SYSCALL(getrusage)
+ 581:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 586:	cd 40                	int    $0x40
+ 588:	c3                   	ret
+
+00000589 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 589:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 58e:	cd 40                	int    $0x40
+ 590:	c3                   	ret
+
+00000591 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 591:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 596:	cd 40                	int    $0x40
+ 598:	c3                   	ret
+
+00000599 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 599:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 59e:	cd 40                	int    $0x40
+ 5a0:	c3                   	ret
+
+000005a1 <futex_wait>:
+SYSCALL(futex_wait)
+ 5a1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5a6:	cd 40                	int    $0x40
+ 5a8:	c3                   	ret
+
+000005a9 <futex_wake>:
+SYSCALL(futex_wake)
+ 5a9:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5ae:	cd 40                	int    $0x40
+ 5b0:	c3                   	ret
+
+000005b1 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 5b1:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5b6:	cd 40                	int    $0x40
+ 5b8:	c3                   	ret
+
+000005b9 <submit_batch>:
+SYSCALL(submit_batch)
+ 5b9:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5be:	cd 40                	int    $0x40
+ 5c0:	c3                   	ret
+
+000005c1 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 5c1:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5c6:	cd 40                	int    $0x40
+ 5c8:	c3                   	ret
+
+000005c9 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 5c9:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5ce:	cd 40                	int    $0x40
+ 5d0:	c3                   	ret
@@ -0,0 +1,90 @@
+// Futexes: user processes sleep on a word in a shared memory page
+// and are woken by address, so uncontended user locks built on
+// them never enter the kernel.
+//
+// A futex is named by the physical address of the word, so every
+// process that maps the page sees the same one wherever it is
+// mapped. Waiters sleep on the word's kernel virtual address. The
+// value check in futex_wait() and the wakeup in futex_wake() both
+// run under the word's bucket lock, so a wakeup cannot slip in
+// between a waiter's check and its sleep.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+
+#define NFUTEXBUCKET 16
+
+static struct spinlock buckets[NFUTEXBUCKET];
+
+void futexinit(void)
+{
+  for (int i = 0; i < NFUTEXBUCKET; i++)
+    initlock(&buckets[i], "futex");
+}
+
+// Kernel address of the int at user address uaddr, which must be
+// aligned and inside a shared memory region of the current process.
+static int *futex_word(uint uaddr)
+{
+  pte_t *pte;
+  uint pa;
+
+  if (uaddr % sizeof(int) != 0 || uaddr >= KERNBASE)
+    return 0;
+  pte = walkpgdir(myproc()->pgdir, (void *)uaddr, 0);
+  if (pte == 0 || (*pte & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
+    return 0;
+  if (!shm_mapped(myproc(), uaddr, sizeof(int)))
+    return 0;
+  pa = PTE_ADDR(*pte) | (uaddr & (PGSIZE - 1));
+  return (int *)P2V(pa);
+}
+
+static struct spinlock *futex_bucket(int *word)
+{
+  return &buckets[((uint)word >> 2) % NFUTEXBUCKET];
+}
+
+// Sleep until woken by futex_wake(), if the word at uaddr still
+// holds val. Returns -1 at once if it does not.
+int futex_wait(uint uaddr, int val)
+{
+  int *word;
+  struct spinlock *lk;
+
+  if ((word = futex_word(uaddr)) == 0)
+    return -1;
+  lk = futex_bucket(word);
+  acquire(lk);
+  if (*(volatile int *)word != val)
+  {
+    release(lk);
+    return -1;
+  }
+  sleep(word, lk);
+  release(lk);
+  return 0;
+}
+
+// Wake up to n processes waiting on the word at uaddr.
+// Returns how many were woken.
+int futex_wake(uint uaddr, int n)
+{
+  int *word;
+  struct spinlock *lk;
+  int woken;
+
+  if ((word = futex_word(uaddr)) == 0)
+    return -1;
+  lk = futex_bucket(word);
+  acquire(lk);
+  woken = wakeup_n(word, n);
+  release(lk);
+  return woken;
+}
@@ -0,0 +1,1922 @@
+
+_futex_bench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <child>:
+    USE_MUTEX
+};
+
+// s is inherited from the parent across fork().
+void child(int mode, int lock, struct shared *s)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+    for (int i = 0; i < ITERS; i++)
+   6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+   d:	eb 5d                	jmp    6c <child+0x6c>
+    {
+        if (mode == USE_PRIORITYLOCK)
+   f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  13:	75 10                	jne    25 <child+0x25>
+            acquire_prioritylock(lock);
+  15:	83 ec 0c             	sub    $0xc,%esp
+  18:	ff 75 0c             	push   0xc(%ebp)
+  1b:	e8 ed 05 00 00       	call   60d <acquire_prioritylock>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	eb 0f                	jmp    34 <child+0x34>
+        else
+            mutex_lock(&s->m);
+  25:	8b 45 10             	mov    0x10(%ebp),%eax
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	50                   	push   %eax
+  2c:	e8 1e 0b 00 00       	call   b4f <mutex_lock>
+  31:	83 c4 10             	add    $0x10,%esp
+        s->counter++;
+  34:	8b 45 10             	mov    0x10(%ebp),%eax
+  37:	8b 40 04             	mov    0x4(%eax),%eax
+  3a:	8d 50 01             	lea    0x1(%eax),%edx
+  3d:	8b 45 10             	mov    0x10(%ebp),%eax
+  40:	89 50 04             	mov    %edx,0x4(%eax)
+        if (mode == USE_PRIORITYLOCK)
+  43:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  47:	75 10                	jne    59 <child+0x59>
+            release_prioritylock(lock);
+  49:	83 ec 0c             	sub    $0xc,%esp
+  4c:	ff 75 0c             	push   0xc(%ebp)
+  4f:	e8 c1 05 00 00       	call   615 <release_prioritylock>
+  54:	83 c4 10             	add    $0x10,%esp
+  57:	eb 0f                	jmp    68 <child+0x68>
+        else
+            mutex_unlock(&s->m);
+  59:	8b 45 10             	mov    0x10(%ebp),%eax
+  5c:	83 ec 0c             	sub    $0xc,%esp
+  5f:	50                   	push   %eax
+  60:	e8 48 0b 00 00       	call   bad <mutex_unlock>
+  65:	83 c4 10             	add    $0x10,%esp
+    for (int i = 0; i < ITERS; i++)
+  68:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  6c:	81 7d f4 cf 07 00 00 	cmpl   $0x7cf,-0xc(%ebp)
+  73:	7e 9a                	jle    f <child+0xf>
+    }
+    close_sharedmem(SHM_ID);
+  75:	83 ec 0c             	sub    $0xc,%esp
+  78:	6a 0f                	push   $0xf
+  7a:	e8 b6 05 00 00       	call   635 <close_sharedmem>
+  7f:	83 c4 10             	add    $0x10,%esp
+    exit();
+  82:	e8 96 04 00 00       	call   51d <exit>
+
+00000087 <run>:
+}
+
+void run(char *name, int mode, int lock, struct shared *s)
+{
+  87:	55                   	push   %ebp
+  88:	89 e5                	mov    %esp,%ebp
+  8a:	53                   	push   %ebx
+  8b:	83 ec 14             	sub    $0x14,%esp
+    int start;
+
+    s->counter = 0;
+  8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  91:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+    mutex_init(&s->m);
+  98:	8b 45 14             	mov    0x14(%ebp),%eax
+  9b:	83 ec 0c             	sub    $0xc,%esp
+  9e:	50                   	push   %eax
+  9f:	e8 9c 0a 00 00       	call   b40 <mutex_init>
+  a4:	83 c4 10             	add    $0x10,%esp
+    start = uptime();
+  a7:	e8 09 05 00 00       	call   5b5 <uptime>
+  ac:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    for (int i = 0; i < NCHILD; i++)
+  af:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  b6:	eb 43                	jmp    fb <run+0x74>
+    {
+        int pid = fork();
+  b8:	e8 58 04 00 00       	call   515 <fork>
+  bd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        if (pid < 0)
+  c0:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  c4:	79 17                	jns    dd <run+0x56>
+        {
+            printf(1, "fork failed\n");
+  c6:	83 ec 08             	sub    $0x8,%esp
+  c9:	68 94 0d 00 00       	push   $0xd94
+  ce:	6a 01                	push   $0x1
+  d0:	e8 b4 06 00 00       	call   789 <printf>
+  d5:	83 c4 10             	add    $0x10,%esp
+            exit();
+  d8:	e8 40 04 00 00       	call   51d <exit>
+        }
+        if (pid == 0)
+  dd:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  e1:	75 14                	jne    f7 <run+0x70>
+            child(mode, lock, s);
+  e3:	83 ec 04             	sub    $0x4,%esp
+  e6:	ff 75 14             	push   0x14(%ebp)
+  e9:	ff 75 10             	push   0x10(%ebp)
+  ec:	ff 75 0c             	push   0xc(%ebp)
+  ef:	e8 0c ff ff ff       	call   0 <child>
+  f4:	83 c4 10             	add    $0x10,%esp
+    for (int i = 0; i < NCHILD; i++)
+  f7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  fb:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+  ff:	7e b7                	jle    b8 <run+0x31>
+    }
+    for (int i = 0; i < NCHILD; i++)
+ 101:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 108:	eb 09                	jmp    113 <run+0x8c>
+        wait();
+ 10a:	e8 16 04 00 00       	call   525 <wait>
+    for (int i = 0; i < NCHILD; i++)
+ 10f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 113:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+ 117:	7e f1                	jle    10a <run+0x83>
+    printf(1, "%s: %d ticks, counter %d of %d\n", name, uptime() - start, s->counter, NCHILD * ITERS);
+ 119:	8b 45 14             	mov    0x14(%ebp),%eax
+ 11c:	8b 58 04             	mov    0x4(%eax),%ebx
+ 11f:	e8 91 04 00 00       	call   5b5 <uptime>
+ 124:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 127:	83 ec 08             	sub    $0x8,%esp
+ 12a:	68 40 1f 00 00       	push   $0x1f40
+ 12f:	53                   	push   %ebx
+ 130:	50                   	push   %eax
+ 131:	ff 75 08             	push   0x8(%ebp)
+ 134:	68 a4 0d 00 00       	push   $0xda4
+ 139:	6a 01                	push   $0x1
+ 13b:	e8 49 06 00 00       	call   789 <printf>
+ 140:	83 c4 20             	add    $0x20,%esp
+}
+ 143:	90                   	nop
+ 144:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+
+00000149 <main>:
+
+int main(int argc, char *argv[])
+{
+ 149:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 14d:	83 e4 f0             	and    $0xfffffff0,%esp
+ 150:	ff 71 fc             	push   -0x4(%ecx)
+ 153:	55                   	push   %ebp
+ 154:	89 e5                	mov    %esp,%ebp
+ 156:	51                   	push   %ecx
+ 157:	83 ec 14             	sub    $0x14,%esp
+    struct shared *s = (struct shared *)open_sharedmem(SHM_ID, sizeof(struct shared));
+ 15a:	83 ec 08             	sub    $0x8,%esp
+ 15d:	6a 08                	push   $0x8
+ 15f:	6a 0f                	push   $0xf
+ 161:	e8 c7 04 00 00       	call   62d <open_sharedmem>
+ 166:	83 c4 10             	add    $0x10,%esp
+ 169:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int lock = create_prioritylock("futex_bench");
+ 16c:	83 ec 0c             	sub    $0xc,%esp
+ 16f:	68 c4 0d 00 00       	push   $0xdc4
+ 174:	e8 f4 04 00 00       	call   66d <create_prioritylock>
+ 179:	83 c4 10             	add    $0x10,%esp
+ 17c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    if (s == (struct shared *)-1 || lock < 0)
+ 17f:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 183:	74 06                	je     18b <main+0x42>
+ 185:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 189:	79 17                	jns    1a2 <main+0x59>
+    {
+        printf(1, "futex_bench: setup failed\n");
+ 18b:	83 ec 08             	sub    $0x8,%esp
+ 18e:	68 d0 0d 00 00       	push   $0xdd0
+ 193:	6a 01                	push   $0x1
+ 195:	e8 ef 05 00 00       	call   789 <printf>
+ 19a:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 19d:	e8 7b 03 00 00       	call   51d <exit>
+    }
+    run("prioritylock", USE_PRIORITYLOCK, lock, s);
+ 1a2:	ff 75 f4             	push   -0xc(%ebp)
+ 1a5:	ff 75 f0             	push   -0x10(%ebp)
+ 1a8:	6a 00                	push   $0x0
+ 1aa:	68 eb 0d 00 00       	push   $0xdeb
+ 1af:	e8 d3 fe ff ff       	call   87 <run>
+ 1b4:	83 c4 10             	add    $0x10,%esp
+    run("futex mutex", USE_MUTEX, lock, s);
+ 1b7:	ff 75 f4             	push   -0xc(%ebp)
+ 1ba:	ff 75 f0             	push   -0x10(%ebp)
+ 1bd:	6a 01                	push   $0x1
+ 1bf:	68 f8 0d 00 00       	push   $0xdf8
+ 1c4:	e8 be fe ff ff       	call   87 <run>
+ 1c9:	83 c4 10             	add    $0x10,%esp
+
+    destroy_prioritylock(lock);
+ 1cc:	83 ec 0c             	sub    $0xc,%esp
+ 1cf:	ff 75 f0             	push   -0x10(%ebp)
+ 1d2:	e8 9e 04 00 00       	call   675 <destroy_prioritylock>
+ 1d7:	83 c4 10             	add    $0x10,%esp
+    close_sharedmem(SHM_ID);
+ 1da:	83 ec 0c             	sub    $0xc,%esp
+ 1dd:	6a 0f                	push   $0xf
+ 1df:	e8 51 04 00 00       	call   635 <close_sharedmem>
+ 1e4:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 1e7:	e8 31 03 00 00       	call   51d <exit>
+
+000001ec <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 1ec:	55                   	push   %ebp
+ 1ed:	89 e5                	mov    %esp,%ebp
+ 1ef:	57                   	push   %edi
+ 1f0:	53                   	push   %ebx
+{
+ 1f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1f4:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fa:	89 cb                	mov    %ecx,%ebx
+ 1fc:	89 df                	mov    %ebx,%edi
+ 1fe:	89 d1                	mov    %edx,%ecx
+ 200:	fc                   	cld
+ 201:	f3 aa                	rep stos %al,%es:(%edi)
+ 203:	89 ca                	mov    %ecx,%edx
+ 205:	89 fb                	mov    %edi,%ebx
+ 207:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 20a:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 20d:	90                   	nop
+ 20e:	5b                   	pop    %ebx
+ 20f:	5f                   	pop    %edi
+ 210:	5d                   	pop    %ebp
+ 211:	c3                   	ret
+
+00000212 <strcpy>:
+{
+ 212:	55                   	push   %ebp
+ 213:	89 e5                	mov    %esp,%ebp
+ 215:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 218:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 21e:	90                   	nop
+ 21f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 222:	8d 42 01             	lea    0x1(%edx),%eax
+ 225:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 228:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22b:	8d 48 01             	lea    0x1(%eax),%ecx
+ 22e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 231:	0f b6 12             	movzbl (%edx),%edx
+ 234:	88 10                	mov    %dl,(%eax)
+ 236:	0f b6 00             	movzbl (%eax),%eax
+ 239:	84 c0                	test   %al,%al
+ 23b:	75 e2                	jne    21f <strcpy+0xd>
+  return os;
+ 23d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 240:	c9                   	leave
+ 241:	c3                   	ret
+
+00000242 <strcmp>:
+{
+ 242:	55                   	push   %ebp
+ 243:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 245:	eb 08                	jmp    24f <strcmp+0xd>
+    p++, q++;
+ 247:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 24b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 24f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 252:	0f b6 00             	movzbl (%eax),%eax
+ 255:	84 c0                	test   %al,%al
+ 257:	74 10                	je     269 <strcmp+0x27>
+ 259:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25c:	0f b6 10             	movzbl (%eax),%edx
+ 25f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 262:	0f b6 00             	movzbl (%eax),%eax
+ 265:	38 c2                	cmp    %al,%dl
+ 267:	74 de                	je     247 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 269:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26c:	0f b6 00             	movzbl (%eax),%eax
+ 26f:	0f b6 d0             	movzbl %al,%edx
+ 272:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 275:	0f b6 00             	movzbl (%eax),%eax
+ 278:	0f b6 c0             	movzbl %al,%eax
+ 27b:	29 c2                	sub    %eax,%edx
+ 27d:	89 d0                	mov    %edx,%eax
+}
+ 27f:	5d                   	pop    %ebp
+ 280:	c3                   	ret
+
+00000281 <strlen>:
+{
+ 281:	55                   	push   %ebp
+ 282:	89 e5                	mov    %esp,%ebp
+ 284:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 287:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 28e:	eb 04                	jmp    294 <strlen+0x13>
+ 290:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 294:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 297:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29a:	01 d0                	add    %edx,%eax
+ 29c:	0f b6 00             	movzbl (%eax),%eax
+ 29f:	84 c0                	test   %al,%al
+ 2a1:	75 ed                	jne    290 <strlen+0xf>
+  return n;
+ 2a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2a6:	c9                   	leave
+ 2a7:	c3                   	ret
+
+000002a8 <memset>:
+{
+ 2a8:	55                   	push   %ebp
+ 2a9:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 2ab:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2ae:	50                   	push   %eax
+ 2af:	ff 75 0c             	push   0xc(%ebp)
+ 2b2:	ff 75 08             	push   0x8(%ebp)
+ 2b5:	e8 32 ff ff ff       	call   1ec <stosb>
+ 2ba:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c0:	c9                   	leave
+ 2c1:	c3                   	ret
+
+000002c2 <strchr>:
+{
+ 2c2:	55                   	push   %ebp
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	83 ec 04             	sub    $0x4,%esp
+ 2c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2cb:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 2ce:	eb 14                	jmp    2e4 <strchr+0x22>
+    if(*s == c)
+ 2d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d3:	0f b6 00             	movzbl (%eax),%eax
+ 2d6:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2d9:	75 05                	jne    2e0 <strchr+0x1e>
+      return (char*)s;
+ 2db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2de:	eb 13                	jmp    2f3 <strchr+0x31>
+  for(; *s; s++)
+ 2e0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e7:	0f b6 00             	movzbl (%eax),%eax
+ 2ea:	84 c0                	test   %al,%al
+ 2ec:	75 e2                	jne    2d0 <strchr+0xe>
+  return 0;
+ 2ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2f3:	c9                   	leave
+ 2f4:	c3                   	ret
+
+000002f5 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2f5:	55                   	push   %ebp
+ 2f6:	89 e5                	mov    %esp,%ebp
+ 2f8:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2fb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 302:	eb 42                	jmp    346 <gets+0x51>
+    cc = read(0, &c, 1);
+ 304:	83 ec 04             	sub    $0x4,%esp
+ 307:	6a 01                	push   $0x1
+ 309:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 30c:	50                   	push   %eax
+ 30d:	6a 00                	push   $0x0
+ 30f:	e8 21 02 00 00       	call   535 <read>
+ 314:	83 c4 10             	add    $0x10,%esp
+ 317:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 31a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 31e:	7e 33                	jle    353 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 320:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 323:	8d 50 01             	lea    0x1(%eax),%edx
+ 326:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 329:	89 c2                	mov    %eax,%edx
+ 32b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32e:	01 c2                	add    %eax,%edx
+ 330:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 334:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 336:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 33a:	3c 0a                	cmp    $0xa,%al
+ 33c:	74 16                	je     354 <gets+0x5f>
+ 33e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 342:	3c 0d                	cmp    $0xd,%al
+ 344:	74 0e                	je     354 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 346:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 349:	83 c0 01             	add    $0x1,%eax
+ 34c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 34f:	7f b3                	jg     304 <gets+0xf>
+ 351:	eb 01                	jmp    354 <gets+0x5f>
+      break;
+ 353:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 354:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 357:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35a:	01 d0                	add    %edx,%eax
+ 35c:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 35f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 362:	c9                   	leave
+ 363:	c3                   	ret
+
+00000364 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 364:	55                   	push   %ebp
+ 365:	89 e5                	mov    %esp,%ebp
+ 367:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 36a:	83 ec 08             	sub    $0x8,%esp
+ 36d:	6a 00                	push   $0x0
+ 36f:	ff 75 08             	push   0x8(%ebp)
+ 372:	e8 e6 01 00 00       	call   55d <open>
+ 377:	83 c4 10             	add    $0x10,%esp
+ 37a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 37d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 381:	79 07                	jns    38a <stat+0x26>
+    return -1;
+ 383:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 388:	eb 25                	jmp    3af <stat+0x4b>
+  r = fstat(fd, st);
+ 38a:	83 ec 08             	sub    $0x8,%esp
+ 38d:	ff 75 0c             	push   0xc(%ebp)
+ 390:	ff 75 f4             	push   -0xc(%ebp)
+ 393:	e8 dd 01 00 00       	call   575 <fstat>
+ 398:	83 c4 10             	add    $0x10,%esp
+ 39b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 39e:	83 ec 0c             	sub    $0xc,%esp
+ 3a1:	ff 75 f4             	push   -0xc(%ebp)
+ 3a4:	e8 9c 01 00 00       	call   545 <close>
+ 3a9:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 3ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3af:	c9                   	leave
+ 3b0:	c3                   	ret
+
+000003b1 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3b1:	55                   	push   %ebp
+ 3b2:	89 e5                	mov    %esp,%ebp
+ 3b4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 3b7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3be:	eb 25                	jmp    3e5 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 3c0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3c3:	89 d0                	mov    %edx,%eax
+ 3c5:	c1 e0 02             	shl    $0x2,%eax
+ 3c8:	01 d0                	add    %edx,%eax
+ 3ca:	01 c0                	add    %eax,%eax
+ 3cc:	89 c1                	mov    %eax,%ecx
+ 3ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d1:	8d 50 01             	lea    0x1(%eax),%edx
+ 3d4:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3d7:	0f b6 00             	movzbl (%eax),%eax
+ 3da:	0f be c0             	movsbl %al,%eax
+ 3dd:	01 c8                	add    %ecx,%eax
+ 3df:	83 e8 30             	sub    $0x30,%eax
+ 3e2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3e5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e8:	0f b6 00             	movzbl (%eax),%eax
+ 3eb:	3c 2f                	cmp    $0x2f,%al
+ 3ed:	7e 0a                	jle    3f9 <atoi+0x48>
+ 3ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f2:	0f b6 00             	movzbl (%eax),%eax
+ 3f5:	3c 39                	cmp    $0x39,%al
+ 3f7:	7e c7                	jle    3c0 <atoi+0xf>
+  return n;
+ 3f9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3fc:	c9                   	leave
+ 3fd:	c3                   	ret
+
+000003fe <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3fe:	55                   	push   %ebp
+ 3ff:	89 e5                	mov    %esp,%ebp
+ 401:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 404:	8b 45 08             	mov    0x8(%ebp),%eax
+ 407:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 410:	eb 17                	jmp    429 <memmove+0x2b>
+    *dst++ = *src++;
+ 412:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 415:	8d 42 01             	lea    0x1(%edx),%eax
+ 418:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 41b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 41e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 421:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 424:	0f b6 12             	movzbl (%edx),%edx
+ 427:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 429:	8b 45 10             	mov    0x10(%ebp),%eax
+ 42c:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 42f:	89 55 10             	mov    %edx,0x10(%ebp)
+ 432:	85 c0                	test   %eax,%eax
+ 434:	7f dc                	jg     412 <memmove+0x14>
+  return vdst;
+ 436:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 439:	c9                   	leave
+ 43a:	c3                   	ret
+
+0000043b <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 43b:	55                   	push   %ebp
+ 43c:	89 e5                	mov    %esp,%ebp
+ 43e:	57                   	push   %edi
+ 43f:	56                   	push   %esi
+ 440:	83 ec 30             	sub    $0x30,%esp
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 449:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 44c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 44f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 456:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 45d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 460:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 463:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 466:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 469:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 470:	e9 89 00 00 00       	jmp    4fe <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 475:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 478:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 47b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 47f:	01 c0                	add    %eax,%eax
+ 481:	89 c6                	mov    %eax,%esi
+ 483:	89 d7                	mov    %edx,%edi
+ 485:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 488:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 48b:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 48e:	0f ad d0             	shrd   %cl,%edx,%eax
+ 491:	d3 ea                	shr    %cl,%edx
+ 493:	f6 c1 20             	test   $0x20,%cl
+ 496:	74 04                	je     49c <udiv64+0x61>
+ 498:	89 d0                	mov    %edx,%eax
+ 49a:	31 d2                	xor    %edx,%edx
+ 49c:	83 e0 01             	and    $0x1,%eax
+ 49f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 4a2:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 4a9:	89 f0                	mov    %esi,%eax
+ 4ab:	89 fa                	mov    %edi,%edx
+ 4ad:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 4b0:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 4b3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 4b6:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 4b9:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4bc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4c1:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 4c4:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 4c7:	19 d1                	sbb    %edx,%ecx
+ 4c9:	72 2f                	jb     4fa <udiv64+0xbf>
+      r -= d;
+ 4cb:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4ce:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4d3:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 4d6:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 4d9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 4dc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4e1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4e6:	0f a5 c2             	shld   %cl,%eax,%edx
+ 4e9:	d3 e0                	shl    %cl,%eax
+ 4eb:	f6 c1 20             	test   $0x20,%cl
+ 4ee:	74 04                	je     4f4 <udiv64+0xb9>
+ 4f0:	89 c2                	mov    %eax,%edx
+ 4f2:	31 c0                	xor    %eax,%eax
+ 4f4:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 4f7:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 4fa:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 4fe:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 502:	0f 89 6d ff ff ff    	jns    475 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 508:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 50b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 50e:	83 c4 30             	add    $0x30,%esp
+ 511:	5e                   	pop    %esi
+ 512:	5f                   	pop    %edi
+ 513:	5d                   	pop    %ebp
+ 514:	c3                   	ret
+
+00000515 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 515:	b8 01 00 00 00       	mov    $0x1,%eax
+ 51a:	cd 40                	int    $0x40
+ 51c:	c3                   	ret
+
+0000051d <exit>:
+SYSCALL(exit)
+ 51d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 522:	cd 40                	int    $0x40
+ 524:	c3                   	ret
+
+00000525 <wait>:
+SYSCALL(wait)
+ 525:	b8 03 00 00 00       	mov    $0x3,%eax
+ 52a:	cd 40                	int    $0x40
+ 52c:	c3                   	ret
+
+0000052d <pipe>:
+SYSCALL(pipe)
+ 52d:	b8 04 00 00 00       	mov    $0x4,%eax
+ 532:	cd 40                	int    $0x40
+ 534:	c3                   	ret
+
+00000535 <read>:
+SYSCALL(read)
+ 535:	b8 05 00 00 00       	mov    $0x5,%eax
+ 53a:	cd 40                	int    $0x40
+ 53c:	c3                   	ret
+
+0000053d <write>:
+SYSCALL(write)
+ 53d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 542:	cd 40                	int    $0x40
+ 544:	c3                   	ret
+
+00000545 <close>:
+SYSCALL(close)
+ 545:	b8 15 00 00 00       	mov    $0x15,%eax
+ 54a:	cd 40                	int    $0x40
+ 54c:	c3                   	ret
+
+0000054d <kill>:
+SYSCALL(kill)
+ 54d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 552:	cd 40                	int    $0x40
+ 554:	c3                   	ret
+
+00000555 <exec>:
+SYSCALL(exec)
+ 555:	b8 07 00 00 00       	mov    $0x7,%eax
+ 55a:	cd 40                	int    $0x40
+ 55c:	c3                   	ret
+
+0000055d <open>:
+SYSCALL(open)
+ 55d:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 562:	cd 40                	int    $0x40
+ 564:	c3                   	ret
+
+00000565 <mknod>:
+SYSCALL(mknod)
+ 565:	b8 11 00 00 00       	mov    $0x11,%eax
+ 56a:	cd 40                	int    $0x40
+ 56c:	c3                   	ret
+
+0000056d <unlink>:
+SYSCALL(unlink)
+ 56d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 572:	cd 40                	int    $0x40
+ 574:	c3                   	ret
+
+00000575 <fstat>:
+SYSCALL(fstat)
+ 575:	b8 08 00 00 00       	mov    $0x8,%eax
+ 57a:	cd 40                	int    $0x40
+ 57c:	c3                   	ret
+
+0000057d <link>:
+SYSCALL(link)
+ 57d:	b8 13 00 00 00       	mov    $0x13,%eax
+ 582:	cd 40                	int    $0x40
+ 584:	c3                   	ret
+
+00000585 <mkdir>:
+SYSCALL(mkdir)
+ 585:	b8 14 00 00 00       	mov    $0x14,%eax
+ 58a:	cd 40                	int    $0x40
+ 58c:	c3                   	ret
+
+0000058d <chdir>:
+SYSCALL(chdir)
+ 58d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 592:	cd 40                	int    $0x40
+ 594:	c3                   	ret
+
+00000595 <dup>:
+SYSCALL(dup)
+ 595:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 59a:	cd 40                	int    $0x40
+ 59c:	c3                   	ret
+
+0000059d <getpid>:
+SYSCALL(getpid)
+ 59d:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5a2:	cd 40                	int    $0x40
+ 5a4:	c3                   	ret
+
+000005a5 <sbrk>:
+SYSCALL(sbrk)
+ 5a5:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5aa:	cd 40                	int    $0x40
+ 5ac:	c3                   	ret
+
+000005ad <sleep>:
+SYSCALL(sleep)
+ 5ad:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5b2:	cd 40                	int    $0x40
+ 5b4:	c3                   	ret
+
+000005b5 <uptime>:
+SYSCALL(uptime)
+ 5b5:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5ba:	cd 40                	int    $0x40
+ 5bc:	c3                   	ret
+
+000005bd <find_digital_root>:
+SYSCALL(find_digital_root)
+ 5bd:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5c2:	cd 40                	int    $0x40
+ 5c4:	c3                   	ret
+
+000005c5 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 5c5:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5ca:	cd 40                	int    $0x40
+ 5cc:	c3                   	ret
+
+000005cd <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 5cd:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5d2:	cd 40                	int    $0x40
+ 5d4:	c3                   	ret
+
+000005d5 <copy_file>:
+SYSCALL(copy_file)
+ 5d5:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5da:	cd 40                	int    $0x40
+ 5dc:	c3                   	ret
+
+000005dd <change_queue>:
+SYSCALL(change_queue)
+ 5dd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5e2:	cd 40                	int    $0x40
+ 5e4:	c3                   	ret
+
+000005e5 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 5e5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5ea:	cd 40                	int    $0x40
+ 5ec:	c3                   	ret
+
+000005ed <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 5ed:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5f2:	cd 40                	int    $0x40
+ 5f4:	c3                   	ret
+
+000005f5 <print_process_info>:
+SYSCALL(print_process_info)
+ 5f5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5fa:	cd 40                	int    $0x40
+ 5fc:	c3                   	ret
+
+000005fd <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 5fd:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 602:	cd 40                	int    $0x40
+ 604:	c3                   	ret
+
+00000605 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 605:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 60a:	cd 40                	int    $0x40
+ 60c:	c3                   	ret
+
+0000060d <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 60d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 612:	cd 40                	int    $0x40
+ 614:	c3                   	ret
+
+00000615 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 615:	b8 21 00 00 00       	mov    $0x21,%eax
+ 61a:	cd 40                	int    $0x40
+ 61c:	c3                   	ret
+
+0000061d <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 61d:	b8 22 00 00 00       	mov    $0x22,%eax
+ 622:	cd 40                	int    $0x40
+ 624:	c3                   	ret
+
+00000625 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 625:	b8 23 00 00 00       	mov    $0x23,%eax
+ 62a:	cd 40                	int    $0x40
+ 62c:	c3                   	ret
+
+0000062d <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 62d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 632:	cd 40                	int    $0x40
+ 634:	c3                   	ret
+
+00000635 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 635:	b8 25 00 00 00       	mov    $0x25,%eax
+ 63a:	cd 40                	int    $0x40
+ 63c:	c3                   	ret
+
+0000063d <set_affinity>:
+SYSCALL(set_affinity)
+ 63d:	b8 26 00 00 00       	mov    $0x26,%eax
+ 642:	cd 40                	int    $0x40
+ 644:	c3                   	ret
+
+00000645 <setsched>:
+SYSCALL(setsched)
+ 645:	b8 27 00 00 00       	mov    $0x27,%eax
+ 64a:	cd 40                	int    $0x40
+ 64c:	c3                   	ret
+
+0000064d <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 64d:	b8 28 00 00 00       	mov    $0x28,%eax
+ 652:	cd 40                	int    $0x40
+ 654:	c3                   	ret
+
+00000655 <set_quantum>:
+SYSCALL(set_quantum)
+ 655:	b8 29 00 00 00       	mov    $0x29,%eax
+ 65a:	cd 40                	int    $0x40
+ 65c:	c3                   	ret
+
+0000065d <schedtrace>:
+SYSCALL(schedtrace)
+ 65d:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 662:	cd 40                	int    $0x40
+ 664:	c3                   	ret
+
+00000665 <getrusage>:
+SYSCALL(getrusage)
+ 665:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 66a:	cd 40                	int    $0x40
+ 66c:	c3                   	ret
+
+0000066d <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 66d:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 672:	cd 40                	int    $0x40
+ 674:	c3                   	ret
+
+00000675 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 675:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 67a:	cd 40                	int    $0x40
+ 67c:	c3                   	ret
+
+0000067d <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 67d:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 682:	cd 40                	int    $0x40
+ 684:	c3                   	ret
+
+00000685 <futex_wait>:
+SYSCALL(futex_wait)
+ 685:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 68a:	cd 40                	int    $0x40
+ 68c:	c3                   	ret
+
+0000068d <futex_wake>:
+SYSCALL(futex_wake)
+ 68d:	b8 30 00 00 00       	mov    $0x30,%eax
+ 692:	cd 40                	int    $0x40
+ 694:	c3                   	ret
+
+00000695 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 695:	b8 31 00 00 00       	mov    $0x31,%eax
+ 69a:	cd 40                	int    $0x40
+ 69c:	c3                   	ret
+
+0000069d <submit_batch>:
+SYSCALL(submit_batch)
+ 69d:	b8 32 00 00 00       	mov    $0x32,%eax
+ 6a2:	cd 40                	int    $0x40
+ 6a4:	c3                   	ret
+
+000006a5 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 6a5:	b8 33 00 00 00       	mov    $0x33,%eax
+ 6aa:	cd 40                	int    $0x40
+ 6ac:	c3                   	ret
+
+000006ad <kmem_junk>:
+SYSCALL(kmem_junk)
+ 6ad:	b8 34 00 00 00       	mov    $0x34,%eax
+ 6b2:	cd 40                	int    $0x40
+ 6b4:	c3                   	ret
+
+000006b5 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6b5:	55                   	push   %ebp
+ 6b6:	89 e5                	mov    %esp,%ebp
+ 6b8:	83 ec 18             	sub    $0x18,%esp
+ 6bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6be:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 6c1:	83 ec 04             	sub    $0x4,%esp
+ 6c4:	6a 01                	push   $0x1
+ 6c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 6c9:	50                   	push   %eax
+ 6ca:	ff 75 08             	push   0x8(%ebp)
+ 6cd:	e8 6b fe ff ff       	call   53d <write>
+ 6d2:	83 c4 10             	add    $0x10,%esp
+}
+ 6d5:	90                   	nop
+ 6d6:	c9                   	leave
+ 6d7:	c3                   	ret
+
+000006d8 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6d8:	55                   	push   %ebp
+ 6d9:	89 e5                	mov    %esp,%ebp
+ 6db:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 6de:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6e5:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6e9:	74 17                	je     702 <printint+0x2a>
+ 6eb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6ef:	79 11                	jns    702 <printint+0x2a>
+    neg = 1;
+ 6f1:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 6f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6fb:	f7 d8                	neg    %eax
+ 6fd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 700:	eb 06                	jmp    708 <printint+0x30>
+  } else {
+    x = xx;
+ 702:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 705:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 708:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 70f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 712:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 715:	ba 00 00 00 00       	mov    $0x0,%edx
+ 71a:	f7 f1                	div    %ecx
+ 71c:	89 d1                	mov    %edx,%ecx
+ 71e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 721:	8d 50 01             	lea    0x1(%eax),%edx
+ 724:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 727:	0f b6 91 38 12 00 00 	movzbl 0x1238(%ecx),%edx
+ 72e:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 732:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 735:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 738:	ba 00 00 00 00       	mov    $0x0,%edx
+ 73d:	f7 f1                	div    %ecx
+ 73f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 742:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 746:	75 c7                	jne    70f <printint+0x37>
+  if(neg)
+ 748:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 74c:	74 2d                	je     77b <printint+0xa3>
+    buf[i++] = '-';
+ 74e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 751:	8d 50 01             	lea    0x1(%eax),%edx
+ 754:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 757:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 75c:	eb 1d                	jmp    77b <printint+0xa3>
+    putc(fd, buf[i]);
+ 75e:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 761:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 764:	01 d0                	add    %edx,%eax
+ 766:	0f b6 00             	movzbl (%eax),%eax
+ 769:	0f be c0             	movsbl %al,%eax
+ 76c:	83 ec 08             	sub    $0x8,%esp
+ 76f:	50                   	push   %eax
+ 770:	ff 75 08             	push   0x8(%ebp)
+ 773:	e8 3d ff ff ff       	call   6b5 <putc>
+ 778:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 77b:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 77f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 783:	79 d9                	jns    75e <printint+0x86>
+}
+ 785:	90                   	nop
+ 786:	90                   	nop
+ 787:	c9                   	leave
+ 788:	c3                   	ret
+
+00000789 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 789:	55                   	push   %ebp
+ 78a:	89 e5                	mov    %esp,%ebp
+ 78c:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 78f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 796:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 799:	83 c0 04             	add    $0x4,%eax
+ 79c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 79f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7a6:	e9 59 01 00 00       	jmp    904 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 7ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7ae:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b1:	01 d0                	add    %edx,%eax
+ 7b3:	0f b6 00             	movzbl (%eax),%eax
+ 7b6:	0f be c0             	movsbl %al,%eax
+ 7b9:	25 ff 00 00 00       	and    $0xff,%eax
+ 7be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 7c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7c5:	75 2c                	jne    7f3 <printf+0x6a>
+      if(c == '%'){
+ 7c7:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7cb:	75 0c                	jne    7d9 <printf+0x50>
+        state = '%';
+ 7cd:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 7d4:	e9 27 01 00 00       	jmp    900 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 7d9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7dc:	0f be c0             	movsbl %al,%eax
+ 7df:	83 ec 08             	sub    $0x8,%esp
+ 7e2:	50                   	push   %eax
+ 7e3:	ff 75 08             	push   0x8(%ebp)
+ 7e6:	e8 ca fe ff ff       	call   6b5 <putc>
+ 7eb:	83 c4 10             	add    $0x10,%esp
+ 7ee:	e9 0d 01 00 00       	jmp    900 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 7f3:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 7f7:	0f 85 03 01 00 00    	jne    900 <printf+0x177>
+      if(c == 'd'){
+ 7fd:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 801:	75 1e                	jne    821 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 803:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 806:	8b 00                	mov    (%eax),%eax
+ 808:	6a 01                	push   $0x1
+ 80a:	6a 0a                	push   $0xa
+ 80c:	50                   	push   %eax
+ 80d:	ff 75 08             	push   0x8(%ebp)
+ 810:	e8 c3 fe ff ff       	call   6d8 <printint>
+ 815:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 818:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 81c:	e9 d8 00 00 00       	jmp    8f9 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 821:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 825:	74 06                	je     82d <printf+0xa4>
+ 827:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 82b:	75 1e                	jne    84b <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 82d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 830:	8b 00                	mov    (%eax),%eax
+ 832:	6a 00                	push   $0x0
+ 834:	6a 10                	push   $0x10
+ 836:	50                   	push   %eax
+ 837:	ff 75 08             	push   0x8(%ebp)
+ 83a:	e8 99 fe ff ff       	call   6d8 <printint>
+ 83f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 842:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 846:	e9 ae 00 00 00       	jmp    8f9 <printf+0x170>
+      } else if(c == 's'){
+ 84b:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 84f:	75 43                	jne    894 <printf+0x10b>
+        s = (char*)*ap;
+ 851:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 854:	8b 00                	mov    (%eax),%eax
+ 856:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 859:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 85d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 861:	75 25                	jne    888 <printf+0xff>
+          s = "(null)";
+ 863:	c7 45 f4 04 0e 00 00 	movl   $0xe04,-0xc(%ebp)
+        while(*s != 0){
+ 86a:	eb 1c                	jmp    888 <printf+0xff>
+          putc(fd, *s);
+ 86c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 86f:	0f b6 00             	movzbl (%eax),%eax
+ 872:	0f be c0             	movsbl %al,%eax
+ 875:	83 ec 08             	sub    $0x8,%esp
+ 878:	50                   	push   %eax
+ 879:	ff 75 08             	push   0x8(%ebp)
+ 87c:	e8 34 fe ff ff       	call   6b5 <putc>
+ 881:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 884:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 888:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 88b:	0f b6 00             	movzbl (%eax),%eax
+ 88e:	84 c0                	test   %al,%al
+ 890:	75 da                	jne    86c <printf+0xe3>
+ 892:	eb 65                	jmp    8f9 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 894:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 898:	75 1d                	jne    8b7 <printf+0x12e>
+        putc(fd, *ap);
+ 89a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 89d:	8b 00                	mov    (%eax),%eax
+ 89f:	0f be c0             	movsbl %al,%eax
+ 8a2:	83 ec 08             	sub    $0x8,%esp
+ 8a5:	50                   	push   %eax
+ 8a6:	ff 75 08             	push   0x8(%ebp)
+ 8a9:	e8 07 fe ff ff       	call   6b5 <putc>
+ 8ae:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8b1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8b5:	eb 42                	jmp    8f9 <printf+0x170>
+      } else if(c == '%'){
+ 8b7:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8bb:	75 17                	jne    8d4 <printf+0x14b>
+        putc(fd, c);
+ 8bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8c0:	0f be c0             	movsbl %al,%eax
+ 8c3:	83 ec 08             	sub    $0x8,%esp
+ 8c6:	50                   	push   %eax
+ 8c7:	ff 75 08             	push   0x8(%ebp)
+ 8ca:	e8 e6 fd ff ff       	call   6b5 <putc>
+ 8cf:	83 c4 10             	add    $0x10,%esp
+ 8d2:	eb 25                	jmp    8f9 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 8d4:	83 ec 08             	sub    $0x8,%esp
+ 8d7:	6a 25                	push   $0x25
+ 8d9:	ff 75 08             	push   0x8(%ebp)
+ 8dc:	e8 d4 fd ff ff       	call   6b5 <putc>
+ 8e1:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 8e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8e7:	0f be c0             	movsbl %al,%eax
+ 8ea:	83 ec 08             	sub    $0x8,%esp
+ 8ed:	50                   	push   %eax
+ 8ee:	ff 75 08             	push   0x8(%ebp)
+ 8f1:	e8 bf fd ff ff       	call   6b5 <putc>
+ 8f6:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 8f9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 900:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 904:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 907:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 90a:	01 d0                	add    %edx,%eax
+ 90c:	0f b6 00             	movzbl (%eax),%eax
+ 90f:	84 c0                	test   %al,%al
+ 911:	0f 85 94 fe ff ff    	jne    7ab <printf+0x22>
+    }
+  }
+}
+ 917:	90                   	nop
+ 918:	90                   	nop
+ 919:	c9                   	leave
+ 91a:	c3                   	ret
+
+0000091b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 91b:	55                   	push   %ebp
+ 91c:	89 e5                	mov    %esp,%ebp
+ 91e:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 921:	8b 45 08             	mov    0x8(%ebp),%eax
+ 924:	83 e8 08             	sub    $0x8,%eax
+ 927:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 92a:	a1 54 12 00 00       	mov    0x1254,%eax
+ 92f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 932:	eb 24                	jmp    958 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 934:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 937:	8b 00                	mov    (%eax),%eax
+ 939:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 93c:	72 12                	jb     950 <free+0x35>
+ 93e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 941:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 944:	72 24                	jb     96a <free+0x4f>
+ 946:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 949:	8b 00                	mov    (%eax),%eax
+ 94b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 94e:	72 1a                	jb     96a <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 950:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 953:	8b 00                	mov    (%eax),%eax
+ 955:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 958:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 95b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 95e:	73 d4                	jae    934 <free+0x19>
+ 960:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 963:	8b 00                	mov    (%eax),%eax
+ 965:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 968:	73 ca                	jae    934 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 96a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 96d:	8b 40 04             	mov    0x4(%eax),%eax
+ 970:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 977:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 97a:	01 c2                	add    %eax,%edx
+ 97c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 97f:	8b 00                	mov    (%eax),%eax
+ 981:	39 c2                	cmp    %eax,%edx
+ 983:	75 24                	jne    9a9 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 985:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 988:	8b 50 04             	mov    0x4(%eax),%edx
+ 98b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 98e:	8b 00                	mov    (%eax),%eax
+ 990:	8b 40 04             	mov    0x4(%eax),%eax
+ 993:	01 c2                	add    %eax,%edx
+ 995:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 998:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 99b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 99e:	8b 00                	mov    (%eax),%eax
+ 9a0:	8b 10                	mov    (%eax),%edx
+ 9a2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9a5:	89 10                	mov    %edx,(%eax)
+ 9a7:	eb 0a                	jmp    9b3 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 9a9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ac:	8b 10                	mov    (%eax),%edx
+ 9ae:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b1:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 9b3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b6:	8b 40 04             	mov    0x4(%eax),%eax
+ 9b9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9c0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9c3:	01 d0                	add    %edx,%eax
+ 9c5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9c8:	75 20                	jne    9ea <free+0xcf>
+    p->s.size += bp->s.size;
+ 9ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9cd:	8b 50 04             	mov    0x4(%eax),%edx
+ 9d0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d3:	8b 40 04             	mov    0x4(%eax),%eax
+ 9d6:	01 c2                	add    %eax,%edx
+ 9d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9db:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 9de:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9e1:	8b 10                	mov    (%eax),%edx
+ 9e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e6:	89 10                	mov    %edx,(%eax)
+ 9e8:	eb 08                	jmp    9f2 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 9ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ed:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 9f0:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 9f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f5:	a3 54 12 00 00       	mov    %eax,0x1254
+}
+ 9fa:	90                   	nop
+ 9fb:	c9                   	leave
+ 9fc:	c3                   	ret
+
+000009fd <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 9fd:	55                   	push   %ebp
+ 9fe:	89 e5                	mov    %esp,%ebp
+ a00:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ a03:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a0a:	77 07                	ja     a13 <morecore+0x16>
+    nu = 4096;
+ a0c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ a13:	8b 45 08             	mov    0x8(%ebp),%eax
+ a16:	c1 e0 03             	shl    $0x3,%eax
+ a19:	83 ec 0c             	sub    $0xc,%esp
+ a1c:	50                   	push   %eax
+ a1d:	e8 83 fb ff ff       	call   5a5 <sbrk>
+ a22:	83 c4 10             	add    $0x10,%esp
+ a25:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ a28:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a2c:	75 07                	jne    a35 <morecore+0x38>
+    return 0;
+ a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+ a33:	eb 26                	jmp    a5b <morecore+0x5e>
+  hp = (Header*)p;
+ a35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a38:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ a3b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a3e:	8b 55 08             	mov    0x8(%ebp),%edx
+ a41:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ a44:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a47:	83 c0 08             	add    $0x8,%eax
+ a4a:	83 ec 0c             	sub    $0xc,%esp
+ a4d:	50                   	push   %eax
+ a4e:	e8 c8 fe ff ff       	call   91b <free>
+ a53:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ a56:	a1 54 12 00 00       	mov    0x1254,%eax
+}
+ a5b:	c9                   	leave
+ a5c:	c3                   	ret
+
+00000a5d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a5d:	55                   	push   %ebp
+ a5e:	89 e5                	mov    %esp,%ebp
+ a60:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a63:	8b 45 08             	mov    0x8(%ebp),%eax
+ a66:	83 c0 07             	add    $0x7,%eax
+ a69:	c1 e8 03             	shr    $0x3,%eax
+ a6c:	83 c0 01             	add    $0x1,%eax
+ a6f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ a72:	a1 54 12 00 00       	mov    0x1254,%eax
+ a77:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a7a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a7e:	75 23                	jne    aa3 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ a80:	c7 45 f0 4c 12 00 00 	movl   $0x124c,-0x10(%ebp)
+ a87:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a8a:	a3 54 12 00 00       	mov    %eax,0x1254
+ a8f:	a1 54 12 00 00       	mov    0x1254,%eax
+ a94:	a3 4c 12 00 00       	mov    %eax,0x124c
+    base.s.size = 0;
+ a99:	c7 05 50 12 00 00 00 	movl   $0x0,0x1250
+ aa0:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aa6:	8b 00                	mov    (%eax),%eax
+ aa8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ aab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aae:	8b 40 04             	mov    0x4(%eax),%eax
+ ab1:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ ab4:	72 4d                	jb     b03 <malloc+0xa6>
+      if(p->s.size == nunits)
+ ab6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab9:	8b 40 04             	mov    0x4(%eax),%eax
+ abc:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ abf:	75 0c                	jne    acd <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ ac1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac4:	8b 10                	mov    (%eax),%edx
+ ac6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ac9:	89 10                	mov    %edx,(%eax)
+ acb:	eb 26                	jmp    af3 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ acd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad0:	8b 40 04             	mov    0x4(%eax),%eax
+ ad3:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ ad6:	89 c2                	mov    %eax,%edx
+ ad8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ adb:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ade:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae1:	8b 40 04             	mov    0x4(%eax),%eax
+ ae4:	c1 e0 03             	shl    $0x3,%eax
+ ae7:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ aea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aed:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ af0:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ af3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ af6:	a3 54 12 00 00       	mov    %eax,0x1254
+      return (void*)(p + 1);
+ afb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ afe:	83 c0 08             	add    $0x8,%eax
+ b01:	eb 3b                	jmp    b3e <malloc+0xe1>
+    }
+    if(p == freep)
+ b03:	a1 54 12 00 00       	mov    0x1254,%eax
+ b08:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b0b:	75 1e                	jne    b2b <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ b0d:	83 ec 0c             	sub    $0xc,%esp
+ b10:	ff 75 ec             	push   -0x14(%ebp)
+ b13:	e8 e5 fe ff ff       	call   9fd <morecore>
+ b18:	83 c4 10             	add    $0x10,%esp
+ b1b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b1e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b22:	75 07                	jne    b2b <malloc+0xce>
+        return 0;
+ b24:	b8 00 00 00 00       	mov    $0x0,%eax
+ b29:	eb 13                	jmp    b3e <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b2e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b34:	8b 00                	mov    (%eax),%eax
+ b36:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b39:	e9 6d ff ff ff       	jmp    aab <malloc+0x4e>
+  }
+}
+ b3e:	c9                   	leave
+ b3f:	c3                   	ret
+
+00000b40 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ b43:	8b 45 08             	mov    0x8(%ebp),%eax
+ b46:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b4c:	90                   	nop
+ b4d:	5d                   	pop    %ebp
+ b4e:	c3                   	ret
+
+00000b4f <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ b4f:	55                   	push   %ebp
+ b50:	89 e5                	mov    %esp,%ebp
+ b52:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ b55:	8b 55 08             	mov    0x8(%ebp),%edx
+ b58:	b8 00 00 00 00       	mov    $0x0,%eax
+ b5d:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b62:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b66:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b69:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b6d:	74 3b                	je     baa <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ b6f:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ b73:	74 2d                	je     ba2 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ b75:	8b 55 08             	mov    0x8(%ebp),%edx
+ b78:	b8 02 00 00 00       	mov    $0x2,%eax
+ b7d:	87 02                	xchg   %eax,(%edx)
+ b7f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b82:	eb 1e                	jmp    ba2 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ b84:	8b 45 08             	mov    0x8(%ebp),%eax
+ b87:	83 ec 08             	sub    $0x8,%esp
+ b8a:	6a 02                	push   $0x2
+ b8c:	50                   	push   %eax
+ b8d:	e8 f3 fa ff ff       	call   685 <futex_wait>
+ b92:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ b95:	8b 55 08             	mov    0x8(%ebp),%edx
+ b98:	b8 02 00 00 00       	mov    $0x2,%eax
+ b9d:	87 02                	xchg   %eax,(%edx)
+ b9f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ ba2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ba6:	75 dc                	jne    b84 <mutex_lock+0x35>
+ ba8:	eb 01                	jmp    bab <mutex_lock+0x5c>
+    return;
+ baa:	90                   	nop
+  }
+}
+ bab:	c9                   	leave
+ bac:	c3                   	ret
+
+00000bad <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ bad:	55                   	push   %ebp
+ bae:	89 e5                	mov    %esp,%ebp
+ bb0:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+ bb6:	ba 01 00 00 00       	mov    $0x1,%edx
+ bbb:	f7 da                	neg    %edx
+ bbd:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ bc1:	83 fa 01             	cmp    $0x1,%edx
+ bc4:	74 1a                	je     be0 <mutex_unlock+0x33>
+    m->state = 0;
+ bc6:	8b 45 08             	mov    0x8(%ebp),%eax
+ bc9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ bcf:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd2:	83 ec 08             	sub    $0x8,%esp
+ bd5:	6a 01                	push   $0x1
+ bd7:	50                   	push   %eax
+ bd8:	e8 b0 fa ff ff       	call   68d <futex_wake>
+ bdd:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ be0:	90                   	nop
+ be1:	c9                   	leave
+ be2:	c3                   	ret
+
+00000be3 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ be3:	55                   	push   %ebp
+ be4:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ be6:	8b 45 08             	mov    0x8(%ebp),%eax
+ be9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ bef:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf2:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ bf9:	90                   	nop
+ bfa:	5d                   	pop    %ebp
+ bfb:	c3                   	ret
+
+00000bfc <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ bfc:	55                   	push   %ebp
+ bfd:	89 e5                	mov    %esp,%ebp
+ bff:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ c02:	8b 45 08             	mov    0x8(%ebp),%eax
+ c05:	83 c0 04             	add    $0x4,%eax
+ c08:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ c0c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c0f:	83 ec 08             	sub    $0x8,%esp
+ c12:	ff 75 0c             	push   0xc(%ebp)
+ c15:	50                   	push   %eax
+ c16:	e8 6a fa ff ff       	call   685 <futex_wait>
+ c1b:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ c1e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c21:	83 c0 04             	add    $0x4,%eax
+ c24:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ c28:	90                   	nop
+ c29:	c9                   	leave
+ c2a:	c3                   	ret
+
+00000c2b <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ c2b:	55                   	push   %ebp
+ c2c:	89 e5                	mov    %esp,%ebp
+ c2e:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ c31:	8b 45 08             	mov    0x8(%ebp),%eax
+ c34:	8b 00                	mov    (%eax),%eax
+ c36:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ c39:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c3d:	78 17                	js     c56 <rwlock_rdlock+0x2b>
+ c3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c42:	83 c0 01             	add    $0x1,%eax
+ c45:	89 c1                	mov    %eax,%ecx
+ c47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c4a:	8b 55 08             	mov    0x8(%ebp),%edx
+ c4d:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c51:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c54:	74 19                	je     c6f <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ c56:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c5a:	79 d5                	jns    c31 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ c5c:	83 ec 08             	sub    $0x8,%esp
+ c5f:	ff 75 f4             	push   -0xc(%ebp)
+ c62:	ff 75 08             	push   0x8(%ebp)
+ c65:	e8 92 ff ff ff       	call   bfc <rwlock_sleep>
+ c6a:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ c6d:	eb c2                	jmp    c31 <rwlock_rdlock+0x6>
+      return;
+ c6f:	90                   	nop
+  }
+}
+ c70:	c9                   	leave
+ c71:	c3                   	ret
+
+00000c72 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ c72:	55                   	push   %ebp
+ c73:	89 e5                	mov    %esp,%ebp
+ c75:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ c78:	eb 11                	jmp    c8b <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ c7a:	83 ec 08             	sub    $0x8,%esp
+ c7d:	ff 75 f4             	push   -0xc(%ebp)
+ c80:	ff 75 08             	push   0x8(%ebp)
+ c83:	e8 74 ff ff ff       	call   bfc <rwlock_sleep>
+ c88:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ c8b:	8b 55 08             	mov    0x8(%ebp),%edx
+ c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+ c93:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ c98:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c9c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c9f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ca3:	75 d5                	jne    c7a <rwlock_wrlock+0x8>
+}
+ ca5:	90                   	nop
+ ca6:	90                   	nop
+ ca7:	c9                   	leave
+ ca8:	c3                   	ret
+
+00000ca9 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ ca9:	55                   	push   %ebp
+ caa:	89 e5                	mov    %esp,%ebp
+ cac:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ caf:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb2:	8b 00                	mov    (%eax),%eax
+ cb4:	85 c0                	test   %eax,%eax
+ cb6:	79 0c                	jns    cc4 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ cb8:	8b 45 08             	mov    0x8(%ebp),%eax
+ cbb:	ba 00 00 00 00       	mov    $0x0,%edx
+ cc0:	87 10                	xchg   %edx,(%eax)
+ cc2:	eb 18                	jmp    cdc <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ cc4:	8b 55 08             	mov    0x8(%ebp),%edx
+ cc7:	b8 01 00 00 00       	mov    $0x1,%eax
+ ccc:	f7 d8                	neg    %eax
+ cce:	89 c1                	mov    %eax,%ecx
+ cd0:	89 c8                	mov    %ecx,%eax
+ cd2:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ cd6:	01 c8                	add    %ecx,%eax
+ cd8:	85 c0                	test   %eax,%eax
+ cda:	75 20                	jne    cfc <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ cdc:	8b 45 08             	mov    0x8(%ebp),%eax
+ cdf:	8b 40 04             	mov    0x4(%eax),%eax
+ ce2:	85 c0                	test   %eax,%eax
+ ce4:	74 17                	je     cfd <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce9:	83 ec 08             	sub    $0x8,%esp
+ cec:	68 ff ff ff 7f       	push   $0x7fffffff
+ cf1:	50                   	push   %eax
+ cf2:	e8 96 f9 ff ff       	call   68d <futex_wake>
+ cf7:	83 c4 10             	add    $0x10,%esp
+ cfa:	eb 01                	jmp    cfd <rwlock_unlock+0x54>
+    return;
+ cfc:	90                   	nop
+}
+ cfd:	c9                   	leave
+ cfe:	c3                   	ret
+
+00000cff <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ cff:	55                   	push   %ebp
+ d00:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ d02:	8b 45 08             	mov    0x8(%ebp),%eax
+ d05:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ d0b:	90                   	nop
+ d0c:	5d                   	pop    %ebp
+ d0d:	c3                   	ret
+
+00000d0e <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ d0e:	55                   	push   %ebp
+ d0f:	89 e5                	mov    %esp,%ebp
+ d11:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ d14:	8b 45 08             	mov    0x8(%ebp),%eax
+ d17:	8b 00                	mov    (%eax),%eax
+ d19:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ d1c:	83 ec 0c             	sub    $0xc,%esp
+ d1f:	ff 75 0c             	push   0xc(%ebp)
+ d22:	e8 86 fe ff ff       	call   bad <mutex_unlock>
+ d27:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ d2a:	8b 45 08             	mov    0x8(%ebp),%eax
+ d2d:	83 ec 08             	sub    $0x8,%esp
+ d30:	ff 75 f4             	push   -0xc(%ebp)
+ d33:	50                   	push   %eax
+ d34:	e8 4c f9 ff ff       	call   685 <futex_wait>
+ d39:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ d3c:	83 ec 0c             	sub    $0xc,%esp
+ d3f:	ff 75 0c             	push   0xc(%ebp)
+ d42:	e8 08 fe ff ff       	call   b4f <mutex_lock>
+ d47:	83 c4 10             	add    $0x10,%esp
+}
+ d4a:	90                   	nop
+ d4b:	c9                   	leave
+ d4c:	c3                   	ret
+
+00000d4d <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ d4d:	55                   	push   %ebp
+ d4e:	89 e5                	mov    %esp,%ebp
+ d50:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ d53:	8b 45 08             	mov    0x8(%ebp),%eax
+ d56:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ d5a:	8b 45 08             	mov    0x8(%ebp),%eax
+ d5d:	83 ec 08             	sub    $0x8,%esp
+ d60:	6a 01                	push   $0x1
+ d62:	50                   	push   %eax
+ d63:	e8 25 f9 ff ff       	call   68d <futex_wake>
+ d68:	83 c4 10             	add    $0x10,%esp
+}
+ d6b:	90                   	nop
+ d6c:	c9                   	leave
+ d6d:	c3                   	ret
+
+00000d6e <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ d6e:	55                   	push   %ebp
+ d6f:	89 e5                	mov    %esp,%ebp
+ d71:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ d74:	8b 45 08             	mov    0x8(%ebp),%eax
+ d77:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ d7b:	8b 45 08             	mov    0x8(%ebp),%eax
+ d7e:	83 ec 08             	sub    $0x8,%esp
+ d81:	68 ff ff ff 7f       	push   $0x7fffffff
+ d86:	50                   	push   %eax
+ d87:	e8 01 f9 ff ff       	call   68d <futex_wake>
+ d8c:	83 c4 10             	add    $0x10,%esp
+}
+ d8f:	90                   	nop
+ d90:	c9                   	leave
+ d91:	c3                   	ret
@@ -0,0 +1,83 @@
+#include "types.h"
+#include "user.h"
+#include "usync.h"
+
+// Children bump a counter in a shared memory page, once under a
+// kernel prioritylock and once under a futex-based user mutex,
+// and the time each run takes is compared.
+
+#define NCHILD 4
+#define ITERS 2000
+#define SHM_ID 15
+
+struct shared
+{
+    struct mutex m;
+    int counter;
+};
+
+enum
+{
+    USE_PRIORITYLOCK,
+    USE_MUTEX
+};
+
+// s is inherited from the parent across fork().
+void child(int mode, int lock, struct shared *s)
+{
+    for (int i = 0; i < ITERS; i++)
+    {
+        if (mode == USE_PRIORITYLOCK)
+            acquire_prioritylock(lock);
+        else
+            mutex_lock(&s->m);
+        s->counter++;
+        if (mode == USE_PRIORITYLOCK)
+            release_prioritylock(lock);
+        else
+            mutex_unlock(&s->m);
+    }
+    close_sharedmem(SHM_ID);
+    exit();
+}
+
+void run(char *name, int mode, int lock, struct shared *s)
+{
+    int start;
+
+    s->counter = 0;
+    mutex_init(&s->m);
+    start = uptime();
+    for (int i = 0; i < NCHILD; i++)
+    {
+        int pid = fork();
+        if (pid < 0)
+        {
+            printf(1, "fork failed\n");
+            exit();
+        }
+        if (pid == 0)
+            child(mode, lock, s);
+    }
+    for (int i = 0; i < NCHILD; i++)
+        wait();
+    printf(1, "%s: %d ticks, counter %d of %d\n", name, uptime() - start, s->counter, NCHILD * ITERS);
+}
+
+int main(int argc, char *argv[])
+{
+    struct shared *s = (struct shared *)open_sharedmem(SHM_ID, sizeof(struct shared));
+    int lock = create_prioritylock("futex_bench");
+
+    if (s == (struct shared *)-1 || lock < 0)
+    {
+        printf(1, "futex_bench: setup failed\n");
+        exit();
+    }
+    run("prioritylock", USE_PRIORITYLOCK, lock, s);
+    run("futex mutex", USE_MUTEX, lock, s);
+
+    destroy_prioritylock(lock);
+    close_sharedmem(SHM_ID);
+    exit();
+}
@@ -0,0 +1,1831 @@
+
+_get_process_lifetime_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <test>:
+#include "types.h"
+#include "user.h"
+
+void test()
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+    int forkpid = fork();
+   6:	e8 23 04 00 00       	call   42e <fork>
+   b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if (forkpid > 0)
+   e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  12:	7e 07                	jle    1b <test+0x1b>
+    {
+        wait();
+  14:	e8 25 04 00 00       	call   43e <wait>
+    }
+    else
+    {
+        printf(2, "Failed to create process.\n");
+    }
+}
+  19:	eb 66                	jmp    81 <test+0x81>
+    else if (forkpid == 0)
+  1b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  1f:	75 4e                	jne    6f <test+0x6f>
+            if (get_process_lifetime(getpid()) >= 10)
+  21:	e8 90 04 00 00       	call   4b6 <getpid>
+  26:	83 ec 0c             	sub    $0xc,%esp
+  29:	50                   	push   %eax
+  2a:	e8 b7 04 00 00       	call   4e6 <get_process_lifetime>
+  2f:	83 c4 10             	add    $0x10,%esp
+  32:	83 f8 09             	cmp    $0x9,%eax
+  35:	7e ea                	jle    21 <test+0x21>
+                printf(1, "child process lifetime is %d\n", get_process_lifetime(getpid()));
+  37:	e8 7a 04 00 00       	call   4b6 <getpid>
+  3c:	83 ec 0c             	sub    $0xc,%esp
+  3f:	50                   	push   %eax
+  40:	e8 a1 04 00 00       	call   4e6 <get_process_lifetime>
+  45:	83 c4 10             	add    $0x10,%esp
+  48:	83 ec 04             	sub    $0x4,%esp
+  4b:	50                   	push   %eax
+  4c:	68 ac 0c 00 00       	push   $0xcac
+  51:	6a 01                	push   $0x1
+  53:	e8 4a 06 00 00       	call   6a2 <printf>
+  58:	83 c4 10             	add    $0x10,%esp
+                kill(forkpid);
+  5b:	83 ec 0c             	sub    $0xc,%esp
+  5e:	ff 75 f4             	push   -0xc(%ebp)
+  61:	e8 00 04 00 00       	call   466 <kill>
+  66:	83 c4 10             	add    $0x10,%esp
+                break;
+  69:	90                   	nop
+        exit();
+  6a:	e8 c7 03 00 00       	call   436 <exit>
+        printf(2, "Failed to create process.\n");
+  6f:	83 ec 08             	sub    $0x8,%esp
+  72:	68 ca 0c 00 00       	push   $0xcca
+  77:	6a 02                	push   $0x2
+  79:	e8 24 06 00 00       	call   6a2 <printf>
+  7e:	83 c4 10             	add    $0x10,%esp
+}
+  81:	90                   	nop
+  82:	c9                   	leave
+  83:	c3                   	ret
+
+00000084 <main>:
+
+int main(int argc, char *argv[])
+{
+  84:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  88:	83 e4 f0             	and    $0xfffffff0,%esp
+  8b:	ff 71 fc             	push   -0x4(%ecx)
+  8e:	55                   	push   %ebp
+  8f:	89 e5                	mov    %esp,%ebp
+  91:	51                   	push   %ecx
+  92:	83 ec 14             	sub    $0x14,%esp
+    int forkpid = fork();
+  95:	e8 94 03 00 00       	call   42e <fork>
+  9a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if (forkpid > 0)
+  9d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  a1:	7e 07                	jle    aa <main+0x26>
+    {
+        wait();
+  a3:	e8 96 03 00 00       	call   43e <wait>
+  a8:	eb 56                	jmp    100 <main+0x7c>
+    }
+    else if (forkpid == 0)
+  aa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  ae:	75 3e                	jne    ee <main+0x6a>
+    {
+        test();
+  b0:	e8 4b ff ff ff       	call   0 <test>
+        sleep(500);
+  b5:	83 ec 0c             	sub    $0xc,%esp
+  b8:	68 f4 01 00 00       	push   $0x1f4
+  bd:	e8 04 04 00 00       	call   4c6 <sleep>
+  c2:	83 c4 10             	add    $0x10,%esp
+
+        printf(1, "parent process lifetime is %d\n", get_process_lifetime(getpid()));
+  c5:	e8 ec 03 00 00       	call   4b6 <getpid>
+  ca:	83 ec 0c             	sub    $0xc,%esp
+  cd:	50                   	push   %eax
+  ce:	e8 13 04 00 00       	call   4e6 <get_process_lifetime>
+  d3:	83 c4 10             	add    $0x10,%esp
+  d6:	83 ec 04             	sub    $0x4,%esp
+  d9:	50                   	push   %eax
+  da:	68 e8 0c 00 00       	push   $0xce8
+  df:	6a 01                	push   $0x1
+  e1:	e8 bc 05 00 00       	call   6a2 <printf>
+  e6:	83 c4 10             	add    $0x10,%esp
+        exit();
+  e9:	e8 48 03 00 00       	call   436 <exit>
+    }
+    else
+    {
+        printf(2, "Failed to create process.\n");
+  ee:	83 ec 08             	sub    $0x8,%esp
+  f1:	68 ca 0c 00 00       	push   $0xcca
+  f6:	6a 02                	push   $0x2
+  f8:	e8 a5 05 00 00       	call   6a2 <printf>
+  fd:	83 c4 10             	add    $0x10,%esp
+    }
+    exit();
+ 100:	e8 31 03 00 00       	call   436 <exit>
+
+00000105 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 105:	55                   	push   %ebp
+ 106:	89 e5                	mov    %esp,%ebp
+ 108:	57                   	push   %edi
+ 109:	53                   	push   %ebx
+{
+ 10a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 10d:	8b 55 10             	mov    0x10(%ebp),%edx
+ 110:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 113:	89 cb                	mov    %ecx,%ebx
+ 115:	89 df                	mov    %ebx,%edi
+ 117:	89 d1                	mov    %edx,%ecx
+ 119:	fc                   	cld
+ 11a:	f3 aa                	rep stos %al,%es:(%edi)
+ 11c:	89 ca                	mov    %ecx,%edx
+ 11e:	89 fb                	mov    %edi,%ebx
+ 120:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 123:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 126:	90                   	nop
+ 127:	5b                   	pop    %ebx
+ 128:	5f                   	pop    %edi
+ 129:	5d                   	pop    %ebp
+ 12a:	c3                   	ret
+
+0000012b <strcpy>:
+{
+ 12b:	55                   	push   %ebp
+ 12c:	89 e5                	mov    %esp,%ebp
+ 12e:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 131:	8b 45 08             	mov    0x8(%ebp),%eax
+ 134:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 137:	90                   	nop
+ 138:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 13b:	8d 42 01             	lea    0x1(%edx),%eax
+ 13e:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 141:	8b 45 08             	mov    0x8(%ebp),%eax
+ 144:	8d 48 01             	lea    0x1(%eax),%ecx
+ 147:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 14a:	0f b6 12             	movzbl (%edx),%edx
+ 14d:	88 10                	mov    %dl,(%eax)
+ 14f:	0f b6 00             	movzbl (%eax),%eax
+ 152:	84 c0                	test   %al,%al
+ 154:	75 e2                	jne    138 <strcpy+0xd>
+  return os;
+ 156:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 159:	c9                   	leave
+ 15a:	c3                   	ret
+
+0000015b <strcmp>:
+{
+ 15b:	55                   	push   %ebp
+ 15c:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 15e:	eb 08                	jmp    168 <strcmp+0xd>
+    p++, q++;
+ 160:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 164:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 168:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16b:	0f b6 00             	movzbl (%eax),%eax
+ 16e:	84 c0                	test   %al,%al
+ 170:	74 10                	je     182 <strcmp+0x27>
+ 172:	8b 45 08             	mov    0x8(%ebp),%eax
+ 175:	0f b6 10             	movzbl (%eax),%edx
+ 178:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 17b:	0f b6 00             	movzbl (%eax),%eax
+ 17e:	38 c2                	cmp    %al,%dl
+ 180:	74 de                	je     160 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 182:	8b 45 08             	mov    0x8(%ebp),%eax
+ 185:	0f b6 00             	movzbl (%eax),%eax
+ 188:	0f b6 d0             	movzbl %al,%edx
+ 18b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18e:	0f b6 00             	movzbl (%eax),%eax
+ 191:	0f b6 c0             	movzbl %al,%eax
+ 194:	29 c2                	sub    %eax,%edx
+ 196:	89 d0                	mov    %edx,%eax
+}
+ 198:	5d                   	pop    %ebp
+ 199:	c3                   	ret
+
+0000019a <strlen>:
+{
+ 19a:	55                   	push   %ebp
+ 19b:	89 e5                	mov    %esp,%ebp
+ 19d:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1a0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1a7:	eb 04                	jmp    1ad <strlen+0x13>
+ 1a9:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1ad:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b3:	01 d0                	add    %edx,%eax
+ 1b5:	0f b6 00             	movzbl (%eax),%eax
+ 1b8:	84 c0                	test   %al,%al
+ 1ba:	75 ed                	jne    1a9 <strlen+0xf>
+  return n;
+ 1bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1bf:	c9                   	leave
+ 1c0:	c3                   	ret
+
+000001c1 <memset>:
+{
+ 1c1:	55                   	push   %ebp
+ 1c2:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1c4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1c7:	50                   	push   %eax
+ 1c8:	ff 75 0c             	push   0xc(%ebp)
+ 1cb:	ff 75 08             	push   0x8(%ebp)
+ 1ce:	e8 32 ff ff ff       	call   105 <stosb>
+ 1d3:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1d6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1d9:	c9                   	leave
+ 1da:	c3                   	ret
+
+000001db <strchr>:
+{
+ 1db:	55                   	push   %ebp
+ 1dc:	89 e5                	mov    %esp,%ebp
+ 1de:	83 ec 04             	sub    $0x4,%esp
+ 1e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e4:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1e7:	eb 14                	jmp    1fd <strchr+0x22>
+    if(*s == c)
+ 1e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ec:	0f b6 00             	movzbl (%eax),%eax
+ 1ef:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1f2:	75 05                	jne    1f9 <strchr+0x1e>
+      return (char*)s;
+ 1f4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f7:	eb 13                	jmp    20c <strchr+0x31>
+  for(; *s; s++)
+ 1f9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 200:	0f b6 00             	movzbl (%eax),%eax
+ 203:	84 c0                	test   %al,%al
+ 205:	75 e2                	jne    1e9 <strchr+0xe>
+  return 0;
+ 207:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 20c:	c9                   	leave
+ 20d:	c3                   	ret
+
+0000020e <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 20e:	55                   	push   %ebp
+ 20f:	89 e5                	mov    %esp,%ebp
+ 211:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 214:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 21b:	eb 42                	jmp    25f <gets+0x51>
+    cc = read(0, &c, 1);
+ 21d:	83 ec 04             	sub    $0x4,%esp
+ 220:	6a 01                	push   $0x1
+ 222:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 225:	50                   	push   %eax
+ 226:	6a 00                	push   $0x0
+ 228:	e8 21 02 00 00       	call   44e <read>
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 233:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 237:	7e 33                	jle    26c <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 239:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 23c:	8d 50 01             	lea    0x1(%eax),%edx
+ 23f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 242:	89 c2                	mov    %eax,%edx
+ 244:	8b 45 08             	mov    0x8(%ebp),%eax
+ 247:	01 c2                	add    %eax,%edx
+ 249:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 24d:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 24f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 253:	3c 0a                	cmp    $0xa,%al
+ 255:	74 16                	je     26d <gets+0x5f>
+ 257:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 25b:	3c 0d                	cmp    $0xd,%al
+ 25d:	74 0e                	je     26d <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 25f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 262:	83 c0 01             	add    $0x1,%eax
+ 265:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 268:	7f b3                	jg     21d <gets+0xf>
+ 26a:	eb 01                	jmp    26d <gets+0x5f>
+      break;
+ 26c:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 26d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 270:	8b 45 08             	mov    0x8(%ebp),%eax
+ 273:	01 d0                	add    %edx,%eax
+ 275:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 278:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 27b:	c9                   	leave
+ 27c:	c3                   	ret
+
+0000027d <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 27d:	55                   	push   %ebp
+ 27e:	89 e5                	mov    %esp,%ebp
+ 280:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 283:	83 ec 08             	sub    $0x8,%esp
+ 286:	6a 00                	push   $0x0
+ 288:	ff 75 08             	push   0x8(%ebp)
+ 28b:	e8 e6 01 00 00       	call   476 <open>
+ 290:	83 c4 10             	add    $0x10,%esp
+ 293:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 296:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 29a:	79 07                	jns    2a3 <stat+0x26>
+    return -1;
+ 29c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2a1:	eb 25                	jmp    2c8 <stat+0x4b>
+  r = fstat(fd, st);
+ 2a3:	83 ec 08             	sub    $0x8,%esp
+ 2a6:	ff 75 0c             	push   0xc(%ebp)
+ 2a9:	ff 75 f4             	push   -0xc(%ebp)
+ 2ac:	e8 dd 01 00 00       	call   48e <fstat>
+ 2b1:	83 c4 10             	add    $0x10,%esp
+ 2b4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2b7:	83 ec 0c             	sub    $0xc,%esp
+ 2ba:	ff 75 f4             	push   -0xc(%ebp)
+ 2bd:	e8 9c 01 00 00       	call   45e <close>
+ 2c2:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2c8:	c9                   	leave
+ 2c9:	c3                   	ret
+
+000002ca <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2ca:	55                   	push   %ebp
+ 2cb:	89 e5                	mov    %esp,%ebp
+ 2cd:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2d0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2d7:	eb 25                	jmp    2fe <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2d9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2dc:	89 d0                	mov    %edx,%eax
+ 2de:	c1 e0 02             	shl    $0x2,%eax
+ 2e1:	01 d0                	add    %edx,%eax
+ 2e3:	01 c0                	add    %eax,%eax
+ 2e5:	89 c1                	mov    %eax,%ecx
+ 2e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ea:	8d 50 01             	lea    0x1(%eax),%edx
+ 2ed:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2f0:	0f b6 00             	movzbl (%eax),%eax
+ 2f3:	0f be c0             	movsbl %al,%eax
+ 2f6:	01 c8                	add    %ecx,%eax
+ 2f8:	83 e8 30             	sub    $0x30,%eax
+ 2fb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 301:	0f b6 00             	movzbl (%eax),%eax
+ 304:	3c 2f                	cmp    $0x2f,%al
+ 306:	7e 0a                	jle    312 <atoi+0x48>
+ 308:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30b:	0f b6 00             	movzbl (%eax),%eax
+ 30e:	3c 39                	cmp    $0x39,%al
+ 310:	7e c7                	jle    2d9 <atoi+0xf>
+  return n;
+ 312:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 315:	c9                   	leave
+ 316:	c3                   	ret
+
+00000317 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 317:	55                   	push   %ebp
+ 318:	89 e5                	mov    %esp,%ebp
+ 31a:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 31d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 320:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 323:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 326:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 329:	eb 17                	jmp    342 <memmove+0x2b>
+    *dst++ = *src++;
+ 32b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 32e:	8d 42 01             	lea    0x1(%edx),%eax
+ 331:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 334:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 337:	8d 48 01             	lea    0x1(%eax),%ecx
+ 33a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 33d:	0f b6 12             	movzbl (%edx),%edx
+ 340:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 342:	8b 45 10             	mov    0x10(%ebp),%eax
+ 345:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 348:	89 55 10             	mov    %edx,0x10(%ebp)
+ 34b:	85 c0                	test   %eax,%eax
+ 34d:	7f dc                	jg     32b <memmove+0x14>
+  return vdst;
+ 34f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 352:	c9                   	leave
+ 353:	c3                   	ret
+
+00000354 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 354:	55                   	push   %ebp
+ 355:	89 e5                	mov    %esp,%ebp
+ 357:	57                   	push   %edi
+ 358:	56                   	push   %esi
+ 359:	83 ec 30             	sub    $0x30,%esp
+ 35c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 362:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 365:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 368:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 36f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 376:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 379:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 37c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 37f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 382:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 389:	e9 89 00 00 00       	jmp    417 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 38e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 391:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 394:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 398:	01 c0                	add    %eax,%eax
+ 39a:	89 c6                	mov    %eax,%esi
+ 39c:	89 d7                	mov    %edx,%edi
+ 39e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3a1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 3a4:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 3a7:	0f ad d0             	shrd   %cl,%edx,%eax
+ 3aa:	d3 ea                	shr    %cl,%edx
+ 3ac:	f6 c1 20             	test   $0x20,%cl
+ 3af:	74 04                	je     3b5 <udiv64+0x61>
+ 3b1:	89 d0                	mov    %edx,%eax
+ 3b3:	31 d2                	xor    %edx,%edx
+ 3b5:	83 e0 01             	and    $0x1,%eax
+ 3b8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 3bb:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 3c2:	89 f0                	mov    %esi,%eax
+ 3c4:	89 fa                	mov    %edi,%edx
+ 3c6:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 3c9:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 3cc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 3cf:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 3d2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3da:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 3dd:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 3e0:	19 d1                	sbb    %edx,%ecx
+ 3e2:	72 2f                	jb     413 <udiv64+0xbf>
+      r -= d;
+ 3e4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e7:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3ec:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 3ef:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 3f2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3f5:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3fa:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3ff:	0f a5 c2             	shld   %cl,%eax,%edx
+ 402:	d3 e0                	shl    %cl,%eax
+ 404:	f6 c1 20             	test   $0x20,%cl
+ 407:	74 04                	je     40d <udiv64+0xb9>
+ 409:	89 c2                	mov    %eax,%edx
+ 40b:	31 c0                	xor    %eax,%eax
+ 40d:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 410:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 413:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 417:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 41b:	0f 89 6d ff ff ff    	jns    38e <udiv64+0x3a>
+    }
+  }
+  return q;
+ 421:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 424:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 427:	83 c4 30             	add    $0x30,%esp
+ 42a:	5e                   	pop    %esi
+ 42b:	5f                   	pop    %edi
+ 42c:	5d                   	pop    %ebp
+ 42d:	c3                   	ret
+
+0000042e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 42e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 433:	cd 40                	int    $0x40
+ 435:	c3                   	ret
+
+00000436 <exit>:
+SYSCALL(exit)
+ 436:	b8 02 00 00 00       	mov    $0x2,%eax
+ 43b:	cd 40                	int    $0x40
+ 43d:	c3                   	ret
+
+0000043e <wait>:
+SYSCALL(wait)
+ 43e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 443:	cd 40                	int    $0x40
+ 445:	c3                   	ret
+
+00000446 <pipe>:
+SYSCALL(pipe)
+ 446:	b8 04 00 00 00       	mov    $0x4,%eax
+ 44b:	cd 40                	int    $0x40
+ 44d:	c3                   	ret
+
+0000044e <read>:
+SYSCALL(read)
+ 44e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 453:	cd 40                	int    $0x40
+ 455:	c3                   	ret
+
+00000456 <write>:
+SYSCALL(write)
+ 456:	b8 10 00 00 00       	mov    $0x10,%eax
+ 45b:	cd 40                	int    $0x40
+ 45d:	c3                   	ret
+
+0000045e <close>:
+SYSCALL(close)
+ 45e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 463:	cd 40                	int    $0x40
+ 465:	c3                   	ret
+
+00000466 <kill>:
+SYSCALL(kill)
+ 466:	b8 06 00 00 00       	mov    $0x6,%eax
+ 46b:	cd 40                	int    $0x40
+ 46d:	c3                   	ret
+
+0000046e <exec>:
+SYSCALL(exec)
+ 46e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 473:	cd 40                	int    $0x40
+ 475:	c3                   	ret
+
+00000476 <open>:
+SYSCALL(open)
+ 476:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 47b:	cd 40                	int    $0x40
+ 47d:	c3                   	ret
+
+0000047e <mknod>:
+SYSCALL(mknod)
+ 47e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 483:	cd 40                	int    $0x40
+ 485:	c3                   	ret
+
+00000486 <unlink>:
+SYSCALL(unlink)
+ 486:	b8 12 00 00 00       	mov    $0x12,%eax
+ 48b:	cd 40                	int    $0x40
+ 48d:	c3                   	ret
+
+0000048e <fstat>:
+SYSCALL(fstat)
+ 48e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 493:	cd 40                	int    $0x40
+ 495:	c3                   	ret
+
+00000496 <link>:
+SYSCALL(link)
+ 496:	b8 13 00 00 00       	mov    $0x13,%eax
+ 49b:	cd 40                	int    $0x40
+ 49d:	c3                   	ret
+
+0000049e <mkdir>:
+SYSCALL(mkdir)
+ 49e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4a3:	cd 40                	int    $0x40
+ 4a5:	c3                   	ret
+
+000004a6 <chdir>:
+SYSCALL(chdir)
+ 4a6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4ab:	cd 40                	int    $0x40
+ 4ad:	c3                   	ret
+
+000004ae <dup>:
+SYSCALL(dup)
+ 4ae:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4b3:	cd 40                	int    $0x40
+ 4b5:	c3                   	ret
+
+000004b6 <getpid>:
+SYSCALL(getpid)
+ 4b6:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4bb:	cd 40                	int    $0x40
+ 4bd:	c3                   	ret
+
+000004be <sbrk>:
+SYSCALL(sbrk)
+ 4be:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4c3:	cd 40                	int    $0x40
+ 4c5:	c3                   	ret
+
+000004c6 <sleep>:
+SYSCALL(sleep)
+ 4c6:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4cb:	cd 40                	int    $0x40
+ 4cd:	c3                   	ret
+
+000004ce <uptime>:
+SYSCALL(uptime)
+ 4ce:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4d3:	cd 40                	int    $0x40
+ 4d5:	c3                   	ret
+
+000004d6 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 4d6:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4db:	cd 40                	int    $0x40
+ 4dd:	c3                   	ret
+
+000004de <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 4de:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4e3:	cd 40                	int    $0x40
+ 4e5:	c3                   	ret
+
+000004e6 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 4e6:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4eb:	cd 40                	int    $0x40
+ 4ed:	c3                   	ret
+
+000004ee <copy_file>:
+SYSCALL(copy_file)
+ 4ee:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4f3:	cd 40                	int    $0x40
+ 4f5:	c3                   	ret
+
+000004f6 <change_queue>:
+SYSCALL(change_queue)
+ 4f6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4fb:	cd 40                	int    $0x40
+ 4fd:	c3                   	ret
+
+000004fe <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 4fe:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 503:	cd 40                	int    $0x40
+ 505:	c3                   	ret
+
+00000506 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 506:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 50b:	cd 40                	int    $0x40
+ 50d:	c3                   	ret
+
+0000050e <print_process_info>:
+SYSCALL(print_process_info)
+ 50e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 513:	cd 40                	int    $0x40
+ 515:	c3                   	ret
+
+00000516 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 516:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 51b:	cd 40                	int    $0x40
+ 51d:	c3                   	ret
+
+0000051e <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 51e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 523:	cd 40                	int    $0x40
+ 525:	c3                   	ret
+
+00000526 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 526:	b8 20 00 00 00       	mov    $0x20,%eax
+ 52b:	cd 40                	int    $0x40
+ 52d:	c3                   	ret
+
+0000052e <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 52e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 533:	cd 40                	int    $0x40
+ 535:	c3                   	ret
+
+00000536 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 536:	b8 22 00 00 00       	mov    $0x22,%eax
+ 53b:	cd 40                	int    $0x40
+ 53d:	c3                   	ret
+
+0000053e <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 53e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 546:	b8 24 00 00 00       	mov    $0x24,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 54e:	b8 25 00 00 00       	mov    $0x25,%eax
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <set_affinity>:
+SYSCALL(set_affinity)
+ 556:	b8 26 00 00 00       	mov    $0x26,%eax
+ 55b:	cd 40                	int    $0x40
+ 55d:	c3                   	ret
+
+0000055e <setsched>:
+SYSCALL(setsched)
+ 55e:	b8 27 00 00 00       	mov    $0x27,%eax
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 566:	b8 28 00 00 00       	mov    $0x28,%eax
+ 56b:	cd 40                	int    $0x40
+ 56d:	c3                   	ret
+
+0000056e <set_quantum>:
+SYSCALL(set_quantum)
+ 56e:	b8 29 00 00 00       	mov    $0x29,%eax
+ 573:	cd 40                	int    $0x40
+ 575:	c3                   	ret
+
+00000576 <schedtrace>:
+SYSCALL(schedtrace)
+ 576:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 57b:	cd 40                	int    $0x40
+ 57d:	c3                   	ret
+
+0000057e <getrusage>:
+SYSCALL(getrusage)
+ 57e:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 583:	cd 40                	int    $0x40
+ 585:	c3                   	ret
+
+00000586 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 586:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 58b:	cd 40                	int    $0x40
+ 58d:	c3                   	ret
+
+0000058e <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 58e:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 593:	cd 40                	int    $0x40
+ 595:	c3                   	ret
+
+00000596 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 596:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 59b:	cd 40                	int    $0x40
+ 59d:	c3                   	ret
+
+0000059e <futex_wait>:
+SYSCALL(futex_wait)
+ 59e:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5a3:	cd 40                	int    $0x40
+ 5a5:	c3                   	ret
+
+000005a6 <futex_wake>:
+SYSCALL(futex_wake)
+ 5a6:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5ab:	cd 40                	int    $0x40
+ 5ad:	c3                   	ret
+
+000005ae <syscall_latency>:
+SYSCALL(syscall_latency)
+ 5ae:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5b3:	cd 40                	int    $0x40
+ 5b5:	c3                   	ret
+
+000005b6 <submit_batch>:
+SYSCALL(submit_batch)
+ 5b6:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5bb:	cd 40                	int    $0x40
+ 5bd:	c3                   	ret
+
+000005be <kmem_stats>:
+SYSCALL(kmem_stats)
+ 5be:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5c3:	cd 40                	int    $0x40
+ 5c5:	c3                   	ret
+
+000005c6 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 5c6:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5cb:	cd 40                	int    $0x40
+ 5cd:	c3                   	ret
+
+000005ce <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5ce:	55                   	push   %ebp
+ 5cf:	89 e5                	mov    %esp,%ebp
+ 5d1:	83 ec 18             	sub    $0x18,%esp
+ 5d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5d7:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 5da:	83 ec 04             	sub    $0x4,%esp
+ 5dd:	6a 01                	push   $0x1
+ 5df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5e2:	50                   	push   %eax
+ 5e3:	ff 75 08             	push   0x8(%ebp)
+ 5e6:	e8 6b fe ff ff       	call   456 <write>
+ 5eb:	83 c4 10             	add    $0x10,%esp
+}
+ 5ee:	90                   	nop
+ 5ef:	c9                   	leave
+ 5f0:	c3                   	ret
+
+000005f1 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5f1:	55                   	push   %ebp
+ 5f2:	89 e5                	mov    %esp,%ebp
+ 5f4:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 5f7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 5fe:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 602:	74 17                	je     61b <printint+0x2a>
+ 604:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 608:	79 11                	jns    61b <printint+0x2a>
+    neg = 1;
+ 60a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 611:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 614:	f7 d8                	neg    %eax
+ 616:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 619:	eb 06                	jmp    621 <printint+0x30>
+  } else {
+    x = xx;
+ 61b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 61e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 621:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 628:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 62b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 62e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 633:	f7 f1                	div    %ecx
+ 635:	89 d1                	mov    %edx,%ecx
+ 637:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 63a:	8d 50 01             	lea    0x1(%eax),%edx
+ 63d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 640:	0f b6 91 1c 11 00 00 	movzbl 0x111c(%ecx),%edx
+ 647:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 64b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 64e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 651:	ba 00 00 00 00       	mov    $0x0,%edx
+ 656:	f7 f1                	div    %ecx
+ 658:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 65b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 65f:	75 c7                	jne    628 <printint+0x37>
+  if(neg)
+ 661:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 665:	74 2d                	je     694 <printint+0xa3>
+    buf[i++] = '-';
+ 667:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 66a:	8d 50 01             	lea    0x1(%eax),%edx
+ 66d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 670:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 675:	eb 1d                	jmp    694 <printint+0xa3>
+    putc(fd, buf[i]);
+ 677:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 67a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 67d:	01 d0                	add    %edx,%eax
+ 67f:	0f b6 00             	movzbl (%eax),%eax
+ 682:	0f be c0             	movsbl %al,%eax
+ 685:	83 ec 08             	sub    $0x8,%esp
+ 688:	50                   	push   %eax
+ 689:	ff 75 08             	push   0x8(%ebp)
+ 68c:	e8 3d ff ff ff       	call   5ce <putc>
+ 691:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 694:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 698:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 69c:	79 d9                	jns    677 <printint+0x86>
+}
+ 69e:	90                   	nop
+ 69f:	90                   	nop
+ 6a0:	c9                   	leave
+ 6a1:	c3                   	ret
+
+000006a2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6a2:	55                   	push   %ebp
+ 6a3:	89 e5                	mov    %esp,%ebp
+ 6a5:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 6a8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6af:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6b2:	83 c0 04             	add    $0x4,%eax
+ 6b5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6b8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6bf:	e9 59 01 00 00       	jmp    81d <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 6c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6ca:	01 d0                	add    %edx,%eax
+ 6cc:	0f b6 00             	movzbl (%eax),%eax
+ 6cf:	0f be c0             	movsbl %al,%eax
+ 6d2:	25 ff 00 00 00       	and    $0xff,%eax
+ 6d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 6da:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6de:	75 2c                	jne    70c <printf+0x6a>
+      if(c == '%'){
+ 6e0:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6e4:	75 0c                	jne    6f2 <printf+0x50>
+        state = '%';
+ 6e6:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6ed:	e9 27 01 00 00       	jmp    819 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 6f2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6f5:	0f be c0             	movsbl %al,%eax
+ 6f8:	83 ec 08             	sub    $0x8,%esp
+ 6fb:	50                   	push   %eax
+ 6fc:	ff 75 08             	push   0x8(%ebp)
+ 6ff:	e8 ca fe ff ff       	call   5ce <putc>
+ 704:	83 c4 10             	add    $0x10,%esp
+ 707:	e9 0d 01 00 00       	jmp    819 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 70c:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 710:	0f 85 03 01 00 00    	jne    819 <printf+0x177>
+      if(c == 'd'){
+ 716:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 71a:	75 1e                	jne    73a <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 71c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 71f:	8b 00                	mov    (%eax),%eax
+ 721:	6a 01                	push   $0x1
+ 723:	6a 0a                	push   $0xa
+ 725:	50                   	push   %eax
+ 726:	ff 75 08             	push   0x8(%ebp)
+ 729:	e8 c3 fe ff ff       	call   5f1 <printint>
+ 72e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 731:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 735:	e9 d8 00 00 00       	jmp    812 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 73a:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 73e:	74 06                	je     746 <printf+0xa4>
+ 740:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 744:	75 1e                	jne    764 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 746:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 749:	8b 00                	mov    (%eax),%eax
+ 74b:	6a 00                	push   $0x0
+ 74d:	6a 10                	push   $0x10
+ 74f:	50                   	push   %eax
+ 750:	ff 75 08             	push   0x8(%ebp)
+ 753:	e8 99 fe ff ff       	call   5f1 <printint>
+ 758:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 75b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 75f:	e9 ae 00 00 00       	jmp    812 <printf+0x170>
+      } else if(c == 's'){
+ 764:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 768:	75 43                	jne    7ad <printf+0x10b>
+        s = (char*)*ap;
+ 76a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 76d:	8b 00                	mov    (%eax),%eax
+ 76f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 772:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 776:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 77a:	75 25                	jne    7a1 <printf+0xff>
+          s = "(null)";
+ 77c:	c7 45 f4 07 0d 00 00 	movl   $0xd07,-0xc(%ebp)
+        while(*s != 0){
+ 783:	eb 1c                	jmp    7a1 <printf+0xff>
+          putc(fd, *s);
+ 785:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 788:	0f b6 00             	movzbl (%eax),%eax
+ 78b:	0f be c0             	movsbl %al,%eax
+ 78e:	83 ec 08             	sub    $0x8,%esp
+ 791:	50                   	push   %eax
+ 792:	ff 75 08             	push   0x8(%ebp)
+ 795:	e8 34 fe ff ff       	call   5ce <putc>
+ 79a:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 79d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 7a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a4:	0f b6 00             	movzbl (%eax),%eax
+ 7a7:	84 c0                	test   %al,%al
+ 7a9:	75 da                	jne    785 <printf+0xe3>
+ 7ab:	eb 65                	jmp    812 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 7ad:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 7b1:	75 1d                	jne    7d0 <printf+0x12e>
+        putc(fd, *ap);
+ 7b3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7b6:	8b 00                	mov    (%eax),%eax
+ 7b8:	0f be c0             	movsbl %al,%eax
+ 7bb:	83 ec 08             	sub    $0x8,%esp
+ 7be:	50                   	push   %eax
+ 7bf:	ff 75 08             	push   0x8(%ebp)
+ 7c2:	e8 07 fe ff ff       	call   5ce <putc>
+ 7c7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7ca:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7ce:	eb 42                	jmp    812 <printf+0x170>
+      } else if(c == '%'){
+ 7d0:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7d4:	75 17                	jne    7ed <printf+0x14b>
+        putc(fd, c);
+ 7d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7d9:	0f be c0             	movsbl %al,%eax
+ 7dc:	83 ec 08             	sub    $0x8,%esp
+ 7df:	50                   	push   %eax
+ 7e0:	ff 75 08             	push   0x8(%ebp)
+ 7e3:	e8 e6 fd ff ff       	call   5ce <putc>
+ 7e8:	83 c4 10             	add    $0x10,%esp
+ 7eb:	eb 25                	jmp    812 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 7ed:	83 ec 08             	sub    $0x8,%esp
+ 7f0:	6a 25                	push   $0x25
+ 7f2:	ff 75 08             	push   0x8(%ebp)
+ 7f5:	e8 d4 fd ff ff       	call   5ce <putc>
+ 7fa:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 7fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 800:	0f be c0             	movsbl %al,%eax
+ 803:	83 ec 08             	sub    $0x8,%esp
+ 806:	50                   	push   %eax
+ 807:	ff 75 08             	push   0x8(%ebp)
+ 80a:	e8 bf fd ff ff       	call   5ce <putc>
+ 80f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 812:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 819:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 81d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 820:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 823:	01 d0                	add    %edx,%eax
+ 825:	0f b6 00             	movzbl (%eax),%eax
+ 828:	84 c0                	test   %al,%al
+ 82a:	0f 85 94 fe ff ff    	jne    6c4 <printf+0x22>
+    }
+  }
+}
+ 830:	90                   	nop
+ 831:	90                   	nop
+ 832:	c9                   	leave
+ 833:	c3                   	ret
+
+00000834 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 834:	55                   	push   %ebp
+ 835:	89 e5                	mov    %esp,%ebp
+ 837:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 83a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 83d:	83 e8 08             	sub    $0x8,%eax
+ 840:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 843:	a1 38 11 00 00       	mov    0x1138,%eax
+ 848:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 84b:	eb 24                	jmp    871 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 84d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 850:	8b 00                	mov    (%eax),%eax
+ 852:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 855:	72 12                	jb     869 <free+0x35>
+ 857:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 85a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 85d:	72 24                	jb     883 <free+0x4f>
+ 85f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 862:	8b 00                	mov    (%eax),%eax
+ 864:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 867:	72 1a                	jb     883 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 869:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86c:	8b 00                	mov    (%eax),%eax
+ 86e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 871:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 874:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 877:	73 d4                	jae    84d <free+0x19>
+ 879:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 87c:	8b 00                	mov    (%eax),%eax
+ 87e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 881:	73 ca                	jae    84d <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 883:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 886:	8b 40 04             	mov    0x4(%eax),%eax
+ 889:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 890:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 893:	01 c2                	add    %eax,%edx
+ 895:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 898:	8b 00                	mov    (%eax),%eax
+ 89a:	39 c2                	cmp    %eax,%edx
+ 89c:	75 24                	jne    8c2 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 89e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8a1:	8b 50 04             	mov    0x4(%eax),%edx
+ 8a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a7:	8b 00                	mov    (%eax),%eax
+ 8a9:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ac:	01 c2                	add    %eax,%edx
+ 8ae:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8b1:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8b4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b7:	8b 00                	mov    (%eax),%eax
+ 8b9:	8b 10                	mov    (%eax),%edx
+ 8bb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8be:	89 10                	mov    %edx,(%eax)
+ 8c0:	eb 0a                	jmp    8cc <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 8c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c5:	8b 10                	mov    (%eax),%edx
+ 8c7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ca:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 8cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8cf:	8b 40 04             	mov    0x4(%eax),%eax
+ 8d2:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8d9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8dc:	01 d0                	add    %edx,%eax
+ 8de:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8e1:	75 20                	jne    903 <free+0xcf>
+    p->s.size += bp->s.size;
+ 8e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e6:	8b 50 04             	mov    0x4(%eax),%edx
+ 8e9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ec:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ef:	01 c2                	add    %eax,%edx
+ 8f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f4:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 8f7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8fa:	8b 10                	mov    (%eax),%edx
+ 8fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ff:	89 10                	mov    %edx,(%eax)
+ 901:	eb 08                	jmp    90b <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 903:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 906:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 909:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 90b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 90e:	a3 38 11 00 00       	mov    %eax,0x1138
+}
+ 913:	90                   	nop
+ 914:	c9                   	leave
+ 915:	c3                   	ret
+
+00000916 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 916:	55                   	push   %ebp
+ 917:	89 e5                	mov    %esp,%ebp
+ 919:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 91c:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 923:	77 07                	ja     92c <morecore+0x16>
+    nu = 4096;
+ 925:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 92c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 92f:	c1 e0 03             	shl    $0x3,%eax
+ 932:	83 ec 0c             	sub    $0xc,%esp
+ 935:	50                   	push   %eax
+ 936:	e8 83 fb ff ff       	call   4be <sbrk>
+ 93b:	83 c4 10             	add    $0x10,%esp
+ 93e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 941:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 945:	75 07                	jne    94e <morecore+0x38>
+    return 0;
+ 947:	b8 00 00 00 00       	mov    $0x0,%eax
+ 94c:	eb 26                	jmp    974 <morecore+0x5e>
+  hp = (Header*)p;
+ 94e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 951:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 954:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 957:	8b 55 08             	mov    0x8(%ebp),%edx
+ 95a:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 95d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 960:	83 c0 08             	add    $0x8,%eax
+ 963:	83 ec 0c             	sub    $0xc,%esp
+ 966:	50                   	push   %eax
+ 967:	e8 c8 fe ff ff       	call   834 <free>
+ 96c:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 96f:	a1 38 11 00 00       	mov    0x1138,%eax
+}
+ 974:	c9                   	leave
+ 975:	c3                   	ret
+
+00000976 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 976:	55                   	push   %ebp
+ 977:	89 e5                	mov    %esp,%ebp
+ 979:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 97c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 97f:	83 c0 07             	add    $0x7,%eax
+ 982:	c1 e8 03             	shr    $0x3,%eax
+ 985:	83 c0 01             	add    $0x1,%eax
+ 988:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 98b:	a1 38 11 00 00       	mov    0x1138,%eax
+ 990:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 993:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 997:	75 23                	jne    9bc <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 999:	c7 45 f0 30 11 00 00 	movl   $0x1130,-0x10(%ebp)
+ 9a0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9a3:	a3 38 11 00 00       	mov    %eax,0x1138
+ 9a8:	a1 38 11 00 00       	mov    0x1138,%eax
+ 9ad:	a3 30 11 00 00       	mov    %eax,0x1130
+    base.s.size = 0;
+ 9b2:	c7 05 34 11 00 00 00 	movl   $0x0,0x1134
+ 9b9:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9bc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9bf:	8b 00                	mov    (%eax),%eax
+ 9c1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c7:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ca:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 9cd:	72 4d                	jb     a1c <malloc+0xa6>
+      if(p->s.size == nunits)
+ 9cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d2:	8b 40 04             	mov    0x4(%eax),%eax
+ 9d5:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9d8:	75 0c                	jne    9e6 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 9da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9dd:	8b 10                	mov    (%eax),%edx
+ 9df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9e2:	89 10                	mov    %edx,(%eax)
+ 9e4:	eb 26                	jmp    a0c <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 9e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e9:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ec:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9ef:	89 c2                	mov    %eax,%edx
+ 9f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9f4:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 9f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9fa:	8b 40 04             	mov    0x4(%eax),%eax
+ 9fd:	c1 e0 03             	shl    $0x3,%eax
+ a00:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a06:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a09:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a0c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a0f:	a3 38 11 00 00       	mov    %eax,0x1138
+      return (void*)(p + 1);
+ a14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a17:	83 c0 08             	add    $0x8,%eax
+ a1a:	eb 3b                	jmp    a57 <malloc+0xe1>
+    }
+    if(p == freep)
+ a1c:	a1 38 11 00 00       	mov    0x1138,%eax
+ a21:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a24:	75 1e                	jne    a44 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a26:	83 ec 0c             	sub    $0xc,%esp
+ a29:	ff 75 ec             	push   -0x14(%ebp)
+ a2c:	e8 e5 fe ff ff       	call   916 <morecore>
+ a31:	83 c4 10             	add    $0x10,%esp
+ a34:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a37:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a3b:	75 07                	jne    a44 <malloc+0xce>
+        return 0;
+ a3d:	b8 00 00 00 00       	mov    $0x0,%eax
+ a42:	eb 13                	jmp    a57 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a47:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a4d:	8b 00                	mov    (%eax),%eax
+ a4f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a52:	e9 6d ff ff ff       	jmp    9c4 <malloc+0x4e>
+  }
+}
+ a57:	c9                   	leave
+ a58:	c3                   	ret
+
+00000a59 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ a59:	55                   	push   %ebp
+ a5a:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ a5c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a5f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ a65:	90                   	nop
+ a66:	5d                   	pop    %ebp
+ a67:	c3                   	ret
+
+00000a68 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ a68:	55                   	push   %ebp
+ a69:	89 e5                	mov    %esp,%ebp
+ a6b:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ a6e:	8b 55 08             	mov    0x8(%ebp),%edx
+ a71:	b8 00 00 00 00       	mov    $0x0,%eax
+ a76:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a7b:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ a7f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a82:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a86:	74 3b                	je     ac3 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ a88:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ a8c:	74 2d                	je     abb <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a8e:	8b 55 08             	mov    0x8(%ebp),%edx
+ a91:	b8 02 00 00 00       	mov    $0x2,%eax
+ a96:	87 02                	xchg   %eax,(%edx)
+ a98:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a9b:	eb 1e                	jmp    abb <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ a9d:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa0:	83 ec 08             	sub    $0x8,%esp
+ aa3:	6a 02                	push   $0x2
+ aa5:	50                   	push   %eax
+ aa6:	e8 f3 fa ff ff       	call   59e <futex_wait>
+ aab:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ aae:	8b 55 08             	mov    0x8(%ebp),%edx
+ ab1:	b8 02 00 00 00       	mov    $0x2,%eax
+ ab6:	87 02                	xchg   %eax,(%edx)
+ ab8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ abb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ abf:	75 dc                	jne    a9d <mutex_lock+0x35>
+ ac1:	eb 01                	jmp    ac4 <mutex_lock+0x5c>
+    return;
+ ac3:	90                   	nop
+  }
+}
+ ac4:	c9                   	leave
+ ac5:	c3                   	ret
+
+00000ac6 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ ac6:	55                   	push   %ebp
+ ac7:	89 e5                	mov    %esp,%ebp
+ ac9:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ acc:	8b 45 08             	mov    0x8(%ebp),%eax
+ acf:	ba 01 00 00 00       	mov    $0x1,%edx
+ ad4:	f7 da                	neg    %edx
+ ad6:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ ada:	83 fa 01             	cmp    $0x1,%edx
+ add:	74 1a                	je     af9 <mutex_unlock+0x33>
+    m->state = 0;
+ adf:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ ae8:	8b 45 08             	mov    0x8(%ebp),%eax
+ aeb:	83 ec 08             	sub    $0x8,%esp
+ aee:	6a 01                	push   $0x1
+ af0:	50                   	push   %eax
+ af1:	e8 b0 fa ff ff       	call   5a6 <futex_wake>
+ af6:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ af9:	90                   	nop
+ afa:	c9                   	leave
+ afb:	c3                   	ret
+
+00000afc <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ afc:	55                   	push   %ebp
+ afd:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ aff:	8b 45 08             	mov    0x8(%ebp),%eax
+ b02:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ b08:	8b 45 08             	mov    0x8(%ebp),%eax
+ b0b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ b12:	90                   	nop
+ b13:	5d                   	pop    %ebp
+ b14:	c3                   	ret
+
+00000b15 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ b15:	55                   	push   %ebp
+ b16:	89 e5                	mov    %esp,%ebp
+ b18:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ b1b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b1e:	83 c0 04             	add    $0x4,%eax
+ b21:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ b25:	8b 45 08             	mov    0x8(%ebp),%eax
+ b28:	83 ec 08             	sub    $0x8,%esp
+ b2b:	ff 75 0c             	push   0xc(%ebp)
+ b2e:	50                   	push   %eax
+ b2f:	e8 6a fa ff ff       	call   59e <futex_wait>
+ b34:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ b37:	8b 45 08             	mov    0x8(%ebp),%eax
+ b3a:	83 c0 04             	add    $0x4,%eax
+ b3d:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ b41:	90                   	nop
+ b42:	c9                   	leave
+ b43:	c3                   	ret
+
+00000b44 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ b44:	55                   	push   %ebp
+ b45:	89 e5                	mov    %esp,%ebp
+ b47:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ b4a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4d:	8b 00                	mov    (%eax),%eax
+ b4f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ b52:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b56:	78 17                	js     b6f <rwlock_rdlock+0x2b>
+ b58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b5b:	83 c0 01             	add    $0x1,%eax
+ b5e:	89 c1                	mov    %eax,%ecx
+ b60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b63:	8b 55 08             	mov    0x8(%ebp),%edx
+ b66:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b6a:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b6d:	74 19                	je     b88 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ b6f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b73:	79 d5                	jns    b4a <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ b75:	83 ec 08             	sub    $0x8,%esp
+ b78:	ff 75 f4             	push   -0xc(%ebp)
+ b7b:	ff 75 08             	push   0x8(%ebp)
+ b7e:	e8 92 ff ff ff       	call   b15 <rwlock_sleep>
+ b83:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ b86:	eb c2                	jmp    b4a <rwlock_rdlock+0x6>
+      return;
+ b88:	90                   	nop
+  }
+}
+ b89:	c9                   	leave
+ b8a:	c3                   	ret
+
+00000b8b <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ b8b:	55                   	push   %ebp
+ b8c:	89 e5                	mov    %esp,%ebp
+ b8e:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b91:	eb 11                	jmp    ba4 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ b93:	83 ec 08             	sub    $0x8,%esp
+ b96:	ff 75 f4             	push   -0xc(%ebp)
+ b99:	ff 75 08             	push   0x8(%ebp)
+ b9c:	e8 74 ff ff ff       	call   b15 <rwlock_sleep>
+ ba1:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ ba4:	8b 55 08             	mov    0x8(%ebp),%edx
+ ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+ bac:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ bb1:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ bb5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ bb8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bbc:	75 d5                	jne    b93 <rwlock_wrlock+0x8>
+}
+ bbe:	90                   	nop
+ bbf:	90                   	nop
+ bc0:	c9                   	leave
+ bc1:	c3                   	ret
+
+00000bc2 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ bc2:	55                   	push   %ebp
+ bc3:	89 e5                	mov    %esp,%ebp
+ bc5:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ bc8:	8b 45 08             	mov    0x8(%ebp),%eax
+ bcb:	8b 00                	mov    (%eax),%eax
+ bcd:	85 c0                	test   %eax,%eax
+ bcf:	79 0c                	jns    bdd <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ bd1:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd4:	ba 00 00 00 00       	mov    $0x0,%edx
+ bd9:	87 10                	xchg   %edx,(%eax)
+ bdb:	eb 18                	jmp    bf5 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ bdd:	8b 55 08             	mov    0x8(%ebp),%edx
+ be0:	b8 01 00 00 00       	mov    $0x1,%eax
+ be5:	f7 d8                	neg    %eax
+ be7:	89 c1                	mov    %eax,%ecx
+ be9:	89 c8                	mov    %ecx,%eax
+ beb:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ bef:	01 c8                	add    %ecx,%eax
+ bf1:	85 c0                	test   %eax,%eax
+ bf3:	75 20                	jne    c15 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ bf5:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf8:	8b 40 04             	mov    0x4(%eax),%eax
+ bfb:	85 c0                	test   %eax,%eax
+ bfd:	74 17                	je     c16 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ bff:	8b 45 08             	mov    0x8(%ebp),%eax
+ c02:	83 ec 08             	sub    $0x8,%esp
+ c05:	68 ff ff ff 7f       	push   $0x7fffffff
+ c0a:	50                   	push   %eax
+ c0b:	e8 96 f9 ff ff       	call   5a6 <futex_wake>
+ c10:	83 c4 10             	add    $0x10,%esp
+ c13:	eb 01                	jmp    c16 <rwlock_unlock+0x54>
+    return;
+ c15:	90                   	nop
+}
+ c16:	c9                   	leave
+ c17:	c3                   	ret
+
+00000c18 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ c18:	55                   	push   %ebp
+ c19:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ c1b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c24:	90                   	nop
+ c25:	5d                   	pop    %ebp
+ c26:	c3                   	ret
+
+00000c27 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ c27:	55                   	push   %ebp
+ c28:	89 e5                	mov    %esp,%ebp
+ c2a:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ c2d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c30:	8b 00                	mov    (%eax),%eax
+ c32:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ c35:	83 ec 0c             	sub    $0xc,%esp
+ c38:	ff 75 0c             	push   0xc(%ebp)
+ c3b:	e8 86 fe ff ff       	call   ac6 <mutex_unlock>
+ c40:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ c43:	8b 45 08             	mov    0x8(%ebp),%eax
+ c46:	83 ec 08             	sub    $0x8,%esp
+ c49:	ff 75 f4             	push   -0xc(%ebp)
+ c4c:	50                   	push   %eax
+ c4d:	e8 4c f9 ff ff       	call   59e <futex_wait>
+ c52:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ c55:	83 ec 0c             	sub    $0xc,%esp
+ c58:	ff 75 0c             	push   0xc(%ebp)
+ c5b:	e8 08 fe ff ff       	call   a68 <mutex_lock>
+ c60:	83 c4 10             	add    $0x10,%esp
+}
+ c63:	90                   	nop
+ c64:	c9                   	leave
+ c65:	c3                   	ret
+
+00000c66 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ c66:	55                   	push   %ebp
+ c67:	89 e5                	mov    %esp,%ebp
+ c69:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c6c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c6f:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ c73:	8b 45 08             	mov    0x8(%ebp),%eax
+ c76:	83 ec 08             	sub    $0x8,%esp
+ c79:	6a 01                	push   $0x1
+ c7b:	50                   	push   %eax
+ c7c:	e8 25 f9 ff ff       	call   5a6 <futex_wake>
+ c81:	83 c4 10             	add    $0x10,%esp
+}
+ c84:	90                   	nop
+ c85:	c9                   	leave
+ c86:	c3                   	ret
+
+00000c87 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ c87:	55                   	push   %ebp
+ c88:	89 e5                	mov    %esp,%ebp
+ c8a:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c8d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c90:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ c94:	8b 45 08             	mov    0x8(%ebp),%eax
+ c97:	83 ec 08             	sub    $0x8,%esp
+ c9a:	68 ff ff ff 7f       	push   $0x7fffffff
+ c9f:	50                   	push   %eax
+ ca0:	e8 01 f9 ff ff       	call   5a6 <futex_wake>
+ ca5:	83 c4 10             	add    $0x10,%esp
+}
+ ca8:	90                   	nop
+ ca9:	c9                   	leave
+ caa:	c3                   	ret
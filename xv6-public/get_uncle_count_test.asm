@@ -0,0 +1,1863 @@
+
+_get_uncle_count_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <test>:
+#include "types.h"
+#include "user.h"
+
+void test()
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+    int forkpid = fork();
+   6:	e8 45 04 00 00       	call   450 <fork>
+   b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if (forkpid > 0)
+   e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  12:	7e 07                	jle    1b <test+0x1b>
+    {
+        wait();
+  14:	e8 47 04 00 00       	call   460 <wait>
+  19:	eb 3e                	jmp    59 <test+0x59>
+    }
+    else if (forkpid == 0)
+  1b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  1f:	75 26                	jne    47 <test+0x47>
+    {
+        printf(1, "the number of uncles is %d\n", get_uncle_count(getpid()));
+  21:	e8 b2 04 00 00       	call   4d8 <getpid>
+  26:	83 ec 0c             	sub    $0xc,%esp
+  29:	50                   	push   %eax
+  2a:	e8 d1 04 00 00       	call   500 <get_uncle_count>
+  2f:	83 c4 10             	add    $0x10,%esp
+  32:	83 ec 04             	sub    $0x4,%esp
+  35:	50                   	push   %eax
+  36:	68 d0 0c 00 00       	push   $0xcd0
+  3b:	6a 01                	push   $0x1
+  3d:	e8 82 06 00 00       	call   6c4 <printf>
+  42:	83 c4 10             	add    $0x10,%esp
+  45:	eb 12                	jmp    59 <test+0x59>
+    }
+    else
+    {
+        printf(2, "Failed to create 3rd process.\n");
+  47:	83 ec 08             	sub    $0x8,%esp
+  4a:	68 ec 0c 00 00       	push   $0xcec
+  4f:	6a 02                	push   $0x2
+  51:	e8 6e 06 00 00       	call   6c4 <printf>
+  56:	83 c4 10             	add    $0x10,%esp
+    }
+    exit();
+  59:	e8 fa 03 00 00       	call   458 <exit>
+
+0000005e <main>:
+}
+
+int main(int argc, char *argv[])
+{
+  5e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  62:	83 e4 f0             	and    $0xfffffff0,%esp
+  65:	ff 71 fc             	push   -0x4(%ecx)
+  68:	55                   	push   %ebp
+  69:	89 e5                	mov    %esp,%ebp
+  6b:	51                   	push   %ecx
+  6c:	83 ec 14             	sub    $0x14,%esp
+    int pid1 = fork();
+  6f:	e8 dc 03 00 00       	call   450 <fork>
+  74:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    if (pid1 < 0)
+  77:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  7b:	79 17                	jns    94 <main+0x36>
+    {
+        printf(2, "Fork failed\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 0b 0d 00 00       	push   $0xd0b
+  85:	6a 02                	push   $0x2
+  87:	e8 38 06 00 00       	call   6c4 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+        exit();
+  8f:	e8 c4 03 00 00       	call   458 <exit>
+    }
+
+    if (pid1 == 0)
+  94:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  98:	75 0f                	jne    a9 <main+0x4b>
+    {
+        sleep(50);
+  9a:	83 ec 0c             	sub    $0xc,%esp
+  9d:	6a 32                	push   $0x32
+  9f:	e8 44 04 00 00       	call   4e8 <sleep>
+  a4:	83 c4 10             	add    $0x10,%esp
+  a7:	eb 79                	jmp    122 <main+0xc4>
+    }
+    else
+    {
+        int pid2 = fork();
+  a9:	e8 a2 03 00 00       	call   450 <fork>
+  ae:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+        if (pid2 < 0)
+  b1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  b5:	79 17                	jns    ce <main+0x70>
+        {
+            printf(2, "Fork failed\n");
+  b7:	83 ec 08             	sub    $0x8,%esp
+  ba:	68 0b 0d 00 00       	push   $0xd0b
+  bf:	6a 02                	push   $0x2
+  c1:	e8 fe 05 00 00       	call   6c4 <printf>
+  c6:	83 c4 10             	add    $0x10,%esp
+            exit();
+  c9:	e8 8a 03 00 00       	call   458 <exit>
+        }
+
+        if (pid2 == 0)
+  ce:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  d2:	75 0f                	jne    e3 <main+0x85>
+        {
+            sleep(50);
+  d4:	83 ec 0c             	sub    $0xc,%esp
+  d7:	6a 32                	push   $0x32
+  d9:	e8 0a 04 00 00       	call   4e8 <sleep>
+  de:	83 c4 10             	add    $0x10,%esp
+  e1:	eb 30                	jmp    113 <main+0xb5>
+        }
+        else
+        {
+
+            int pid3 = fork();
+  e3:	e8 68 03 00 00       	call   450 <fork>
+  e8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+            if (pid3 < 0)
+  eb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  ef:	79 17                	jns    108 <main+0xaa>
+            {
+                printf(2, "Fork failed\n");
+  f1:	83 ec 08             	sub    $0x8,%esp
+  f4:	68 0b 0d 00 00       	push   $0xd0b
+  f9:	6a 02                	push   $0x2
+  fb:	e8 c4 05 00 00       	call   6c4 <printf>
+ 100:	83 c4 10             	add    $0x10,%esp
+                exit();
+ 103:	e8 50 03 00 00       	call   458 <exit>
+            }
+
+            if (pid3 == 0)
+ 108:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 10c:	75 05                	jne    113 <main+0xb5>
+            {
+                test();
+ 10e:	e8 ed fe ff ff       	call   0 <test>
+            }
+        }
+        wait();
+ 113:	e8 48 03 00 00       	call   460 <wait>
+        wait();
+ 118:	e8 43 03 00 00       	call   460 <wait>
+        wait();
+ 11d:	e8 3e 03 00 00       	call   460 <wait>
+    }
+    exit();
+ 122:	e8 31 03 00 00       	call   458 <exit>
+
+00000127 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 127:	55                   	push   %ebp
+ 128:	89 e5                	mov    %esp,%ebp
+ 12a:	57                   	push   %edi
+ 12b:	53                   	push   %ebx
+{
+ 12c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 12f:	8b 55 10             	mov    0x10(%ebp),%edx
+ 132:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 135:	89 cb                	mov    %ecx,%ebx
+ 137:	89 df                	mov    %ebx,%edi
+ 139:	89 d1                	mov    %edx,%ecx
+ 13b:	fc                   	cld
+ 13c:	f3 aa                	rep stos %al,%es:(%edi)
+ 13e:	89 ca                	mov    %ecx,%edx
+ 140:	89 fb                	mov    %edi,%ebx
+ 142:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 145:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 148:	90                   	nop
+ 149:	5b                   	pop    %ebx
+ 14a:	5f                   	pop    %edi
+ 14b:	5d                   	pop    %ebp
+ 14c:	c3                   	ret
+
+0000014d <strcpy>:
+{
+ 14d:	55                   	push   %ebp
+ 14e:	89 e5                	mov    %esp,%ebp
+ 150:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 159:	90                   	nop
+ 15a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 15d:	8d 42 01             	lea    0x1(%edx),%eax
+ 160:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	8d 48 01             	lea    0x1(%eax),%ecx
+ 169:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 16c:	0f b6 12             	movzbl (%edx),%edx
+ 16f:	88 10                	mov    %dl,(%eax)
+ 171:	0f b6 00             	movzbl (%eax),%eax
+ 174:	84 c0                	test   %al,%al
+ 176:	75 e2                	jne    15a <strcpy+0xd>
+  return os;
+ 178:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 17b:	c9                   	leave
+ 17c:	c3                   	ret
+
+0000017d <strcmp>:
+{
+ 17d:	55                   	push   %ebp
+ 17e:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 180:	eb 08                	jmp    18a <strcmp+0xd>
+    p++, q++;
+ 182:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 186:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 18a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18d:	0f b6 00             	movzbl (%eax),%eax
+ 190:	84 c0                	test   %al,%al
+ 192:	74 10                	je     1a4 <strcmp+0x27>
+ 194:	8b 45 08             	mov    0x8(%ebp),%eax
+ 197:	0f b6 10             	movzbl (%eax),%edx
+ 19a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 19d:	0f b6 00             	movzbl (%eax),%eax
+ 1a0:	38 c2                	cmp    %al,%dl
+ 1a2:	74 de                	je     182 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a7:	0f b6 00             	movzbl (%eax),%eax
+ 1aa:	0f b6 d0             	movzbl %al,%edx
+ 1ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1b0:	0f b6 00             	movzbl (%eax),%eax
+ 1b3:	0f b6 c0             	movzbl %al,%eax
+ 1b6:	29 c2                	sub    %eax,%edx
+ 1b8:	89 d0                	mov    %edx,%eax
+}
+ 1ba:	5d                   	pop    %ebp
+ 1bb:	c3                   	ret
+
+000001bc <strlen>:
+{
+ 1bc:	55                   	push   %ebp
+ 1bd:	89 e5                	mov    %esp,%ebp
+ 1bf:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1c2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1c9:	eb 04                	jmp    1cf <strlen+0x13>
+ 1cb:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1cf:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1d2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d5:	01 d0                	add    %edx,%eax
+ 1d7:	0f b6 00             	movzbl (%eax),%eax
+ 1da:	84 c0                	test   %al,%al
+ 1dc:	75 ed                	jne    1cb <strlen+0xf>
+  return n;
+ 1de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1e1:	c9                   	leave
+ 1e2:	c3                   	ret
+
+000001e3 <memset>:
+{
+ 1e3:	55                   	push   %ebp
+ 1e4:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1e6:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1e9:	50                   	push   %eax
+ 1ea:	ff 75 0c             	push   0xc(%ebp)
+ 1ed:	ff 75 08             	push   0x8(%ebp)
+ 1f0:	e8 32 ff ff ff       	call   127 <stosb>
+ 1f5:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1f8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+
+000001fd <strchr>:
+{
+ 1fd:	55                   	push   %ebp
+ 1fe:	89 e5                	mov    %esp,%ebp
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 206:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 209:	eb 14                	jmp    21f <strchr+0x22>
+    if(*s == c)
+ 20b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20e:	0f b6 00             	movzbl (%eax),%eax
+ 211:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 214:	75 05                	jne    21b <strchr+0x1e>
+      return (char*)s;
+ 216:	8b 45 08             	mov    0x8(%ebp),%eax
+ 219:	eb 13                	jmp    22e <strchr+0x31>
+  for(; *s; s++)
+ 21b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 21f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 222:	0f b6 00             	movzbl (%eax),%eax
+ 225:	84 c0                	test   %al,%al
+ 227:	75 e2                	jne    20b <strchr+0xe>
+  return 0;
+ 229:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 22e:	c9                   	leave
+ 22f:	c3                   	ret
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 236:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 23d:	eb 42                	jmp    281 <gets+0x51>
+    cc = read(0, &c, 1);
+ 23f:	83 ec 04             	sub    $0x4,%esp
+ 242:	6a 01                	push   $0x1
+ 244:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 247:	50                   	push   %eax
+ 248:	6a 00                	push   $0x0
+ 24a:	e8 21 02 00 00       	call   470 <read>
+ 24f:	83 c4 10             	add    $0x10,%esp
+ 252:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 255:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 259:	7e 33                	jle    28e <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 25b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 25e:	8d 50 01             	lea    0x1(%eax),%edx
+ 261:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 264:	89 c2                	mov    %eax,%edx
+ 266:	8b 45 08             	mov    0x8(%ebp),%eax
+ 269:	01 c2                	add    %eax,%edx
+ 26b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 26f:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 271:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 275:	3c 0a                	cmp    $0xa,%al
+ 277:	74 16                	je     28f <gets+0x5f>
+ 279:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 27d:	3c 0d                	cmp    $0xd,%al
+ 27f:	74 0e                	je     28f <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 281:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 284:	83 c0 01             	add    $0x1,%eax
+ 287:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 28a:	7f b3                	jg     23f <gets+0xf>
+ 28c:	eb 01                	jmp    28f <gets+0x5f>
+      break;
+ 28e:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 28f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 292:	8b 45 08             	mov    0x8(%ebp),%eax
+ 295:	01 d0                	add    %edx,%eax
+ 297:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 29a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 29d:	c9                   	leave
+ 29e:	c3                   	ret
+
+0000029f <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 29f:	55                   	push   %ebp
+ 2a0:	89 e5                	mov    %esp,%ebp
+ 2a2:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 e6 01 00 00       	call   498 <open>
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2b8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2bc:	79 07                	jns    2c5 <stat+0x26>
+    return -1;
+ 2be:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2c3:	eb 25                	jmp    2ea <stat+0x4b>
+  r = fstat(fd, st);
+ 2c5:	83 ec 08             	sub    $0x8,%esp
+ 2c8:	ff 75 0c             	push   0xc(%ebp)
+ 2cb:	ff 75 f4             	push   -0xc(%ebp)
+ 2ce:	e8 dd 01 00 00       	call   4b0 <fstat>
+ 2d3:	83 c4 10             	add    $0x10,%esp
+ 2d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2d9:	83 ec 0c             	sub    $0xc,%esp
+ 2dc:	ff 75 f4             	push   -0xc(%ebp)
+ 2df:	e8 9c 01 00 00       	call   480 <close>
+ 2e4:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2e7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2ea:	c9                   	leave
+ 2eb:	c3                   	ret
+
+000002ec <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2ec:	55                   	push   %ebp
+ 2ed:	89 e5                	mov    %esp,%ebp
+ 2ef:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2f2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2f9:	eb 25                	jmp    320 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2fb:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2fe:	89 d0                	mov    %edx,%eax
+ 300:	c1 e0 02             	shl    $0x2,%eax
+ 303:	01 d0                	add    %edx,%eax
+ 305:	01 c0                	add    %eax,%eax
+ 307:	89 c1                	mov    %eax,%ecx
+ 309:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30c:	8d 50 01             	lea    0x1(%eax),%edx
+ 30f:	89 55 08             	mov    %edx,0x8(%ebp)
+ 312:	0f b6 00             	movzbl (%eax),%eax
+ 315:	0f be c0             	movsbl %al,%eax
+ 318:	01 c8                	add    %ecx,%eax
+ 31a:	83 e8 30             	sub    $0x30,%eax
+ 31d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 320:	8b 45 08             	mov    0x8(%ebp),%eax
+ 323:	0f b6 00             	movzbl (%eax),%eax
+ 326:	3c 2f                	cmp    $0x2f,%al
+ 328:	7e 0a                	jle    334 <atoi+0x48>
+ 32a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32d:	0f b6 00             	movzbl (%eax),%eax
+ 330:	3c 39                	cmp    $0x39,%al
+ 332:	7e c7                	jle    2fb <atoi+0xf>
+  return n;
+ 334:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 337:	c9                   	leave
+ 338:	c3                   	ret
+
+00000339 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 339:	55                   	push   %ebp
+ 33a:	89 e5                	mov    %esp,%ebp
+ 33c:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 33f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 342:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 345:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 348:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 34b:	eb 17                	jmp    364 <memmove+0x2b>
+    *dst++ = *src++;
+ 34d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 350:	8d 42 01             	lea    0x1(%edx),%eax
+ 353:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 356:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 359:	8d 48 01             	lea    0x1(%eax),%ecx
+ 35c:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 35f:	0f b6 12             	movzbl (%edx),%edx
+ 362:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 364:	8b 45 10             	mov    0x10(%ebp),%eax
+ 367:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 36a:	89 55 10             	mov    %edx,0x10(%ebp)
+ 36d:	85 c0                	test   %eax,%eax
+ 36f:	7f dc                	jg     34d <memmove+0x14>
+  return vdst;
+ 371:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 374:	c9                   	leave
+ 375:	c3                   	ret
+
+00000376 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 376:	55                   	push   %ebp
+ 377:	89 e5                	mov    %esp,%ebp
+ 379:	57                   	push   %edi
+ 37a:	56                   	push   %esi
+ 37b:	83 ec 30             	sub    $0x30,%esp
+ 37e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 381:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 384:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 387:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 38a:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 391:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 398:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 39b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 39e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 3a1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3a4:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 3ab:	e9 89 00 00 00       	jmp    439 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 3b0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3b3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3b6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 3ba:	01 c0                	add    %eax,%eax
+ 3bc:	89 c6                	mov    %eax,%esi
+ 3be:	89 d7                	mov    %edx,%edi
+ 3c0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3c3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 3c6:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 3c9:	0f ad d0             	shrd   %cl,%edx,%eax
+ 3cc:	d3 ea                	shr    %cl,%edx
+ 3ce:	f6 c1 20             	test   $0x20,%cl
+ 3d1:	74 04                	je     3d7 <udiv64+0x61>
+ 3d3:	89 d0                	mov    %edx,%eax
+ 3d5:	31 d2                	xor    %edx,%edx
+ 3d7:	83 e0 01             	and    $0x1,%eax
+ 3da:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 3dd:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 3e4:	89 f0                	mov    %esi,%eax
+ 3e6:	89 fa                	mov    %edi,%edx
+ 3e8:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 3eb:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 3ee:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 3f1:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 3f4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3f7:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3fc:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 3ff:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 402:	19 d1                	sbb    %edx,%ecx
+ 404:	72 2f                	jb     435 <udiv64+0xbf>
+      r -= d;
+ 406:	8b 45 10             	mov    0x10(%ebp),%eax
+ 409:	ba 00 00 00 00       	mov    $0x0,%edx
+ 40e:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 411:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 414:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 417:	b8 01 00 00 00       	mov    $0x1,%eax
+ 41c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 421:	0f a5 c2             	shld   %cl,%eax,%edx
+ 424:	d3 e0                	shl    %cl,%eax
+ 426:	f6 c1 20             	test   $0x20,%cl
+ 429:	74 04                	je     42f <udiv64+0xb9>
+ 42b:	89 c2                	mov    %eax,%edx
+ 42d:	31 c0                	xor    %eax,%eax
+ 42f:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 432:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 435:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 439:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 43d:	0f 89 6d ff ff ff    	jns    3b0 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 443:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 446:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 449:	83 c4 30             	add    $0x30,%esp
+ 44c:	5e                   	pop    %esi
+ 44d:	5f                   	pop    %edi
+ 44e:	5d                   	pop    %ebp
+ 44f:	c3                   	ret
+
+00000450 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 450:	b8 01 00 00 00       	mov    $0x1,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <exit>:
+SYSCALL(exit)
+ 458:	b8 02 00 00 00       	mov    $0x2,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <wait>:
+SYSCALL(wait)
+ 460:	b8 03 00 00 00       	mov    $0x3,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <pipe>:
+SYSCALL(pipe)
+ 468:	b8 04 00 00 00       	mov    $0x4,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <read>:
+SYSCALL(read)
+ 470:	b8 05 00 00 00       	mov    $0x5,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <write>:
+SYSCALL(write)
+ 478:	b8 10 00 00 00       	mov    $0x10,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <close>:
+SYSCALL(close)
+ 480:	b8 15 00 00 00       	mov    $0x15,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <kill>:
+SYSCALL(kill)
+ 488:	b8 06 00 00 00       	mov    $0x6,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <exec>:
+SYSCALL(exec)
+ 490:	b8 07 00 00 00       	mov    $0x7,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <open>:
+SYSCALL(open)
+ 498:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <mknod>:
+SYSCALL(mknod)
+ 4a0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <unlink>:
+SYSCALL(unlink)
+ 4a8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <fstat>:
+SYSCALL(fstat)
+ 4b0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <link>:
+SYSCALL(link)
+ 4b8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <mkdir>:
+SYSCALL(mkdir)
+ 4c0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <chdir>:
+SYSCALL(chdir)
+ 4c8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <dup>:
+SYSCALL(dup)
+ 4d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <getpid>:
+SYSCALL(getpid)
+ 4d8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <sbrk>:
+SYSCALL(sbrk)
+ 4e0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <sleep>:
+SYSCALL(sleep)
+ 4e8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <uptime>:
+SYSCALL(uptime)
+ 4f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 4f8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 500:	b8 17 00 00 00       	mov    $0x17,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 508:	b8 18 00 00 00       	mov    $0x18,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <copy_file>:
+SYSCALL(copy_file)
+ 510:	b8 19 00 00 00       	mov    $0x19,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <change_queue>:
+SYSCALL(change_queue)
+ 518:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 520:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 528:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <print_process_info>:
+SYSCALL(print_process_info)
+ 530:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 538:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 540:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 548:	b8 20 00 00 00       	mov    $0x20,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 550:	b8 21 00 00 00       	mov    $0x21,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 558:	b8 22 00 00 00       	mov    $0x22,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 560:	b8 23 00 00 00       	mov    $0x23,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 568:	b8 24 00 00 00       	mov    $0x24,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 570:	b8 25 00 00 00       	mov    $0x25,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <set_affinity>:
+SYSCALL(set_affinity)
+ 578:	b8 26 00 00 00       	mov    $0x26,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <setsched>:
+SYSCALL(setsched)
+ 580:	b8 27 00 00 00       	mov    $0x27,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 588:	b8 28 00 00 00       	mov    $0x28,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <set_quantum>:
+SYSCALL(set_quantum)
+ 590:	b8 29 00 00 00       	mov    $0x29,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <schedtrace>:
+SYSCALL(schedtrace)
+ 598:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <getrusage>:
+SYSCALL(getrusage)
+ 5a0:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 5a8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 5b0:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 5b8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <futex_wait>:
+SYSCALL(futex_wait)
+ 5c0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <futex_wake>:
+SYSCALL(futex_wake)
+ 5c8:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 5d0:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <submit_batch>:
+SYSCALL(submit_batch)
+ 5d8:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 5e0:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 5e8:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	83 ec 18             	sub    $0x18,%esp
+ 5f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5f9:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 5fc:	83 ec 04             	sub    $0x4,%esp
+ 5ff:	6a 01                	push   $0x1
+ 601:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 604:	50                   	push   %eax
+ 605:	ff 75 08             	push   0x8(%ebp)
+ 608:	e8 6b fe ff ff       	call   478 <write>
+ 60d:	83 c4 10             	add    $0x10,%esp
+}
+ 610:	90                   	nop
+ 611:	c9                   	leave
+ 612:	c3                   	ret
+
+00000613 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 613:	55                   	push   %ebp
+ 614:	89 e5                	mov    %esp,%ebp
+ 616:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 619:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 620:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 624:	74 17                	je     63d <printint+0x2a>
+ 626:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 62a:	79 11                	jns    63d <printint+0x2a>
+    neg = 1;
+ 62c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 633:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 636:	f7 d8                	neg    %eax
+ 638:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 63b:	eb 06                	jmp    643 <printint+0x30>
+  } else {
+    x = xx;
+ 63d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 640:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 643:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 64a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 64d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 650:	ba 00 00 00 00       	mov    $0x0,%edx
+ 655:	f7 f1                	div    %ecx
+ 657:	89 d1                	mov    %edx,%ecx
+ 659:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 65c:	8d 50 01             	lea    0x1(%eax),%edx
+ 65f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 662:	0f b6 91 28 11 00 00 	movzbl 0x1128(%ecx),%edx
+ 669:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 66d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 670:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 673:	ba 00 00 00 00       	mov    $0x0,%edx
+ 678:	f7 f1                	div    %ecx
+ 67a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 67d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 681:	75 c7                	jne    64a <printint+0x37>
+  if(neg)
+ 683:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 687:	74 2d                	je     6b6 <printint+0xa3>
+    buf[i++] = '-';
+ 689:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 68c:	8d 50 01             	lea    0x1(%eax),%edx
+ 68f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 692:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 697:	eb 1d                	jmp    6b6 <printint+0xa3>
+    putc(fd, buf[i]);
+ 699:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 69c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 69f:	01 d0                	add    %edx,%eax
+ 6a1:	0f b6 00             	movzbl (%eax),%eax
+ 6a4:	0f be c0             	movsbl %al,%eax
+ 6a7:	83 ec 08             	sub    $0x8,%esp
+ 6aa:	50                   	push   %eax
+ 6ab:	ff 75 08             	push   0x8(%ebp)
+ 6ae:	e8 3d ff ff ff       	call   5f0 <putc>
+ 6b3:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 6b6:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 6ba:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6be:	79 d9                	jns    699 <printint+0x86>
+}
+ 6c0:	90                   	nop
+ 6c1:	90                   	nop
+ 6c2:	c9                   	leave
+ 6c3:	c3                   	ret
+
+000006c4 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6c4:	55                   	push   %ebp
+ 6c5:	89 e5                	mov    %esp,%ebp
+ 6c7:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 6ca:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6d1:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6d4:	83 c0 04             	add    $0x4,%eax
+ 6d7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6da:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6e1:	e9 59 01 00 00       	jmp    83f <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 6e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6e9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6ec:	01 d0                	add    %edx,%eax
+ 6ee:	0f b6 00             	movzbl (%eax),%eax
+ 6f1:	0f be c0             	movsbl %al,%eax
+ 6f4:	25 ff 00 00 00       	and    $0xff,%eax
+ 6f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 6fc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 700:	75 2c                	jne    72e <printf+0x6a>
+      if(c == '%'){
+ 702:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 706:	75 0c                	jne    714 <printf+0x50>
+        state = '%';
+ 708:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 70f:	e9 27 01 00 00       	jmp    83b <printf+0x177>
+      } else {
+        putc(fd, c);
+ 714:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 717:	0f be c0             	movsbl %al,%eax
+ 71a:	83 ec 08             	sub    $0x8,%esp
+ 71d:	50                   	push   %eax
+ 71e:	ff 75 08             	push   0x8(%ebp)
+ 721:	e8 ca fe ff ff       	call   5f0 <putc>
+ 726:	83 c4 10             	add    $0x10,%esp
+ 729:	e9 0d 01 00 00       	jmp    83b <printf+0x177>
+      }
+    } else if(state == '%'){
+ 72e:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 732:	0f 85 03 01 00 00    	jne    83b <printf+0x177>
+      if(c == 'd'){
+ 738:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 73c:	75 1e                	jne    75c <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 73e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 741:	8b 00                	mov    (%eax),%eax
+ 743:	6a 01                	push   $0x1
+ 745:	6a 0a                	push   $0xa
+ 747:	50                   	push   %eax
+ 748:	ff 75 08             	push   0x8(%ebp)
+ 74b:	e8 c3 fe ff ff       	call   613 <printint>
+ 750:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 753:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 757:	e9 d8 00 00 00       	jmp    834 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 75c:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 760:	74 06                	je     768 <printf+0xa4>
+ 762:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 766:	75 1e                	jne    786 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 768:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 76b:	8b 00                	mov    (%eax),%eax
+ 76d:	6a 00                	push   $0x0
+ 76f:	6a 10                	push   $0x10
+ 771:	50                   	push   %eax
+ 772:	ff 75 08             	push   0x8(%ebp)
+ 775:	e8 99 fe ff ff       	call   613 <printint>
+ 77a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 77d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 781:	e9 ae 00 00 00       	jmp    834 <printf+0x170>
+      } else if(c == 's'){
+ 786:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 78a:	75 43                	jne    7cf <printf+0x10b>
+        s = (char*)*ap;
+ 78c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 78f:	8b 00                	mov    (%eax),%eax
+ 791:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 794:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 798:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 79c:	75 25                	jne    7c3 <printf+0xff>
+          s = "(null)";
+ 79e:	c7 45 f4 18 0d 00 00 	movl   $0xd18,-0xc(%ebp)
+        while(*s != 0){
+ 7a5:	eb 1c                	jmp    7c3 <printf+0xff>
+          putc(fd, *s);
+ 7a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7aa:	0f b6 00             	movzbl (%eax),%eax
+ 7ad:	0f be c0             	movsbl %al,%eax
+ 7b0:	83 ec 08             	sub    $0x8,%esp
+ 7b3:	50                   	push   %eax
+ 7b4:	ff 75 08             	push   0x8(%ebp)
+ 7b7:	e8 34 fe ff ff       	call   5f0 <putc>
+ 7bc:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 7bf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 7c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c6:	0f b6 00             	movzbl (%eax),%eax
+ 7c9:	84 c0                	test   %al,%al
+ 7cb:	75 da                	jne    7a7 <printf+0xe3>
+ 7cd:	eb 65                	jmp    834 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 7cf:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 7d3:	75 1d                	jne    7f2 <printf+0x12e>
+        putc(fd, *ap);
+ 7d5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7d8:	8b 00                	mov    (%eax),%eax
+ 7da:	0f be c0             	movsbl %al,%eax
+ 7dd:	83 ec 08             	sub    $0x8,%esp
+ 7e0:	50                   	push   %eax
+ 7e1:	ff 75 08             	push   0x8(%ebp)
+ 7e4:	e8 07 fe ff ff       	call   5f0 <putc>
+ 7e9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7ec:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7f0:	eb 42                	jmp    834 <printf+0x170>
+      } else if(c == '%'){
+ 7f2:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7f6:	75 17                	jne    80f <printf+0x14b>
+        putc(fd, c);
+ 7f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7fb:	0f be c0             	movsbl %al,%eax
+ 7fe:	83 ec 08             	sub    $0x8,%esp
+ 801:	50                   	push   %eax
+ 802:	ff 75 08             	push   0x8(%ebp)
+ 805:	e8 e6 fd ff ff       	call   5f0 <putc>
+ 80a:	83 c4 10             	add    $0x10,%esp
+ 80d:	eb 25                	jmp    834 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 80f:	83 ec 08             	sub    $0x8,%esp
+ 812:	6a 25                	push   $0x25
+ 814:	ff 75 08             	push   0x8(%ebp)
+ 817:	e8 d4 fd ff ff       	call   5f0 <putc>
+ 81c:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 81f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 822:	0f be c0             	movsbl %al,%eax
+ 825:	83 ec 08             	sub    $0x8,%esp
+ 828:	50                   	push   %eax
+ 829:	ff 75 08             	push   0x8(%ebp)
+ 82c:	e8 bf fd ff ff       	call   5f0 <putc>
+ 831:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 834:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 83b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 83f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 842:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 845:	01 d0                	add    %edx,%eax
+ 847:	0f b6 00             	movzbl (%eax),%eax
+ 84a:	84 c0                	test   %al,%al
+ 84c:	0f 85 94 fe ff ff    	jne    6e6 <printf+0x22>
+    }
+  }
+}
+ 852:	90                   	nop
+ 853:	90                   	nop
+ 854:	c9                   	leave
+ 855:	c3                   	ret
+
+00000856 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 856:	55                   	push   %ebp
+ 857:	89 e5                	mov    %esp,%ebp
+ 859:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 85c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 85f:	83 e8 08             	sub    $0x8,%eax
+ 862:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 865:	a1 44 11 00 00       	mov    0x1144,%eax
+ 86a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 86d:	eb 24                	jmp    893 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 86f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 872:	8b 00                	mov    (%eax),%eax
+ 874:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 877:	72 12                	jb     88b <free+0x35>
+ 879:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 87c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 87f:	72 24                	jb     8a5 <free+0x4f>
+ 881:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 884:	8b 00                	mov    (%eax),%eax
+ 886:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 889:	72 1a                	jb     8a5 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 88b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88e:	8b 00                	mov    (%eax),%eax
+ 890:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 893:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 896:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 899:	73 d4                	jae    86f <free+0x19>
+ 89b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89e:	8b 00                	mov    (%eax),%eax
+ 8a0:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8a3:	73 ca                	jae    86f <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8a5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8a8:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ab:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8b2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8b5:	01 c2                	add    %eax,%edx
+ 8b7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ba:	8b 00                	mov    (%eax),%eax
+ 8bc:	39 c2                	cmp    %eax,%edx
+ 8be:	75 24                	jne    8e4 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 8c0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c3:	8b 50 04             	mov    0x4(%eax),%edx
+ 8c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c9:	8b 00                	mov    (%eax),%eax
+ 8cb:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ce:	01 c2                	add    %eax,%edx
+ 8d0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d3:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d9:	8b 00                	mov    (%eax),%eax
+ 8db:	8b 10                	mov    (%eax),%edx
+ 8dd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e0:	89 10                	mov    %edx,(%eax)
+ 8e2:	eb 0a                	jmp    8ee <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 8e4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e7:	8b 10                	mov    (%eax),%edx
+ 8e9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ec:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 8ee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f1:	8b 40 04             	mov    0x4(%eax),%eax
+ 8f4:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8fe:	01 d0                	add    %edx,%eax
+ 900:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 903:	75 20                	jne    925 <free+0xcf>
+    p->s.size += bp->s.size;
+ 905:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 908:	8b 50 04             	mov    0x4(%eax),%edx
+ 90b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 90e:	8b 40 04             	mov    0x4(%eax),%eax
+ 911:	01 c2                	add    %eax,%edx
+ 913:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 916:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 919:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 91c:	8b 10                	mov    (%eax),%edx
+ 91e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 921:	89 10                	mov    %edx,(%eax)
+ 923:	eb 08                	jmp    92d <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 925:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 928:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 92b:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 92d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 930:	a3 44 11 00 00       	mov    %eax,0x1144
+}
+ 935:	90                   	nop
+ 936:	c9                   	leave
+ 937:	c3                   	ret
+
+00000938 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 938:	55                   	push   %ebp
+ 939:	89 e5                	mov    %esp,%ebp
+ 93b:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 93e:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 945:	77 07                	ja     94e <morecore+0x16>
+    nu = 4096;
+ 947:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 94e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 951:	c1 e0 03             	shl    $0x3,%eax
+ 954:	83 ec 0c             	sub    $0xc,%esp
+ 957:	50                   	push   %eax
+ 958:	e8 83 fb ff ff       	call   4e0 <sbrk>
+ 95d:	83 c4 10             	add    $0x10,%esp
+ 960:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 963:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 967:	75 07                	jne    970 <morecore+0x38>
+    return 0;
+ 969:	b8 00 00 00 00       	mov    $0x0,%eax
+ 96e:	eb 26                	jmp    996 <morecore+0x5e>
+  hp = (Header*)p;
+ 970:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 973:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 976:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 979:	8b 55 08             	mov    0x8(%ebp),%edx
+ 97c:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 97f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 982:	83 c0 08             	add    $0x8,%eax
+ 985:	83 ec 0c             	sub    $0xc,%esp
+ 988:	50                   	push   %eax
+ 989:	e8 c8 fe ff ff       	call   856 <free>
+ 98e:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 991:	a1 44 11 00 00       	mov    0x1144,%eax
+}
+ 996:	c9                   	leave
+ 997:	c3                   	ret
+
+00000998 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 998:	55                   	push   %ebp
+ 999:	89 e5                	mov    %esp,%ebp
+ 99b:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 99e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9a1:	83 c0 07             	add    $0x7,%eax
+ 9a4:	c1 e8 03             	shr    $0x3,%eax
+ 9a7:	83 c0 01             	add    $0x1,%eax
+ 9aa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 9ad:	a1 44 11 00 00       	mov    0x1144,%eax
+ 9b2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9b5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9b9:	75 23                	jne    9de <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 9bb:	c7 45 f0 3c 11 00 00 	movl   $0x113c,-0x10(%ebp)
+ 9c2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9c5:	a3 44 11 00 00       	mov    %eax,0x1144
+ 9ca:	a1 44 11 00 00       	mov    0x1144,%eax
+ 9cf:	a3 3c 11 00 00       	mov    %eax,0x113c
+    base.s.size = 0;
+ 9d4:	c7 05 40 11 00 00 00 	movl   $0x0,0x1140
+ 9db:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9de:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9e1:	8b 00                	mov    (%eax),%eax
+ 9e3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e9:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ec:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 9ef:	72 4d                	jb     a3e <malloc+0xa6>
+      if(p->s.size == nunits)
+ 9f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9f4:	8b 40 04             	mov    0x4(%eax),%eax
+ 9f7:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9fa:	75 0c                	jne    a08 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 9fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ff:	8b 10                	mov    (%eax),%edx
+ a01:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a04:	89 10                	mov    %edx,(%eax)
+ a06:	eb 26                	jmp    a2e <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a0b:	8b 40 04             	mov    0x4(%eax),%eax
+ a0e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a11:	89 c2                	mov    %eax,%edx
+ a13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a16:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a1c:	8b 40 04             	mov    0x4(%eax),%eax
+ a1f:	c1 e0 03             	shl    $0x3,%eax
+ a22:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a28:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a2b:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a2e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a31:	a3 44 11 00 00       	mov    %eax,0x1144
+      return (void*)(p + 1);
+ a36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a39:	83 c0 08             	add    $0x8,%eax
+ a3c:	eb 3b                	jmp    a79 <malloc+0xe1>
+    }
+    if(p == freep)
+ a3e:	a1 44 11 00 00       	mov    0x1144,%eax
+ a43:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a46:	75 1e                	jne    a66 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a48:	83 ec 0c             	sub    $0xc,%esp
+ a4b:	ff 75 ec             	push   -0x14(%ebp)
+ a4e:	e8 e5 fe ff ff       	call   938 <morecore>
+ a53:	83 c4 10             	add    $0x10,%esp
+ a56:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a59:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a5d:	75 07                	jne    a66 <malloc+0xce>
+        return 0;
+ a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+ a64:	eb 13                	jmp    a79 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a69:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a6f:	8b 00                	mov    (%eax),%eax
+ a71:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a74:	e9 6d ff ff ff       	jmp    9e6 <malloc+0x4e>
+  }
+}
+ a79:	c9                   	leave
+ a7a:	c3                   	ret
+
+00000a7b <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ a7b:	55                   	push   %ebp
+ a7c:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ a7e:	8b 45 08             	mov    0x8(%ebp),%eax
+ a81:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ a87:	90                   	nop
+ a88:	5d                   	pop    %ebp
+ a89:	c3                   	ret
+
+00000a8a <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ a8a:	55                   	push   %ebp
+ a8b:	89 e5                	mov    %esp,%ebp
+ a8d:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ a90:	8b 55 08             	mov    0x8(%ebp),%edx
+ a93:	b8 00 00 00 00       	mov    $0x0,%eax
+ a98:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a9d:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ aa1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ aa4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ aa8:	74 3b                	je     ae5 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ aaa:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ aae:	74 2d                	je     add <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ ab0:	8b 55 08             	mov    0x8(%ebp),%edx
+ ab3:	b8 02 00 00 00       	mov    $0x2,%eax
+ ab8:	87 02                	xchg   %eax,(%edx)
+ aba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ abd:	eb 1e                	jmp    add <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ abf:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac2:	83 ec 08             	sub    $0x8,%esp
+ ac5:	6a 02                	push   $0x2
+ ac7:	50                   	push   %eax
+ ac8:	e8 f3 fa ff ff       	call   5c0 <futex_wait>
+ acd:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ ad0:	8b 55 08             	mov    0x8(%ebp),%edx
+ ad3:	b8 02 00 00 00       	mov    $0x2,%eax
+ ad8:	87 02                	xchg   %eax,(%edx)
+ ada:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ add:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ae1:	75 dc                	jne    abf <mutex_lock+0x35>
+ ae3:	eb 01                	jmp    ae6 <mutex_lock+0x5c>
+    return;
+ ae5:	90                   	nop
+  }
+}
+ ae6:	c9                   	leave
+ ae7:	c3                   	ret
+
+00000ae8 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ ae8:	55                   	push   %ebp
+ ae9:	89 e5                	mov    %esp,%ebp
+ aeb:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ aee:	8b 45 08             	mov    0x8(%ebp),%eax
+ af1:	ba 01 00 00 00       	mov    $0x1,%edx
+ af6:	f7 da                	neg    %edx
+ af8:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ afc:	83 fa 01             	cmp    $0x1,%edx
+ aff:	74 1a                	je     b1b <mutex_unlock+0x33>
+    m->state = 0;
+ b01:	8b 45 08             	mov    0x8(%ebp),%eax
+ b04:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ b0a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b0d:	83 ec 08             	sub    $0x8,%esp
+ b10:	6a 01                	push   $0x1
+ b12:	50                   	push   %eax
+ b13:	e8 b0 fa ff ff       	call   5c8 <futex_wake>
+ b18:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ b1b:	90                   	nop
+ b1c:	c9                   	leave
+ b1d:	c3                   	ret
+
+00000b1e <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ b1e:	55                   	push   %ebp
+ b1f:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ b21:	8b 45 08             	mov    0x8(%ebp),%eax
+ b24:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ b2a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b2d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ b34:	90                   	nop
+ b35:	5d                   	pop    %ebp
+ b36:	c3                   	ret
+
+00000b37 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ b37:	55                   	push   %ebp
+ b38:	89 e5                	mov    %esp,%ebp
+ b3a:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ b3d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b40:	83 c0 04             	add    $0x4,%eax
+ b43:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ b47:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4a:	83 ec 08             	sub    $0x8,%esp
+ b4d:	ff 75 0c             	push   0xc(%ebp)
+ b50:	50                   	push   %eax
+ b51:	e8 6a fa ff ff       	call   5c0 <futex_wait>
+ b56:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ b59:	8b 45 08             	mov    0x8(%ebp),%eax
+ b5c:	83 c0 04             	add    $0x4,%eax
+ b5f:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ b63:	90                   	nop
+ b64:	c9                   	leave
+ b65:	c3                   	ret
+
+00000b66 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ b66:	55                   	push   %ebp
+ b67:	89 e5                	mov    %esp,%ebp
+ b69:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ b6c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6f:	8b 00                	mov    (%eax),%eax
+ b71:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ b74:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b78:	78 17                	js     b91 <rwlock_rdlock+0x2b>
+ b7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b7d:	83 c0 01             	add    $0x1,%eax
+ b80:	89 c1                	mov    %eax,%ecx
+ b82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b85:	8b 55 08             	mov    0x8(%ebp),%edx
+ b88:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b8c:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b8f:	74 19                	je     baa <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ b91:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b95:	79 d5                	jns    b6c <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ b97:	83 ec 08             	sub    $0x8,%esp
+ b9a:	ff 75 f4             	push   -0xc(%ebp)
+ b9d:	ff 75 08             	push   0x8(%ebp)
+ ba0:	e8 92 ff ff ff       	call   b37 <rwlock_sleep>
+ ba5:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ ba8:	eb c2                	jmp    b6c <rwlock_rdlock+0x6>
+      return;
+ baa:	90                   	nop
+  }
+}
+ bab:	c9                   	leave
+ bac:	c3                   	ret
+
+00000bad <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ bad:	55                   	push   %ebp
+ bae:	89 e5                	mov    %esp,%ebp
+ bb0:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ bb3:	eb 11                	jmp    bc6 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ bb5:	83 ec 08             	sub    $0x8,%esp
+ bb8:	ff 75 f4             	push   -0xc(%ebp)
+ bbb:	ff 75 08             	push   0x8(%ebp)
+ bbe:	e8 74 ff ff ff       	call   b37 <rwlock_sleep>
+ bc3:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ bc6:	8b 55 08             	mov    0x8(%ebp),%edx
+ bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+ bce:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ bd3:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ bd7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ bda:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bde:	75 d5                	jne    bb5 <rwlock_wrlock+0x8>
+}
+ be0:	90                   	nop
+ be1:	90                   	nop
+ be2:	c9                   	leave
+ be3:	c3                   	ret
+
+00000be4 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ be4:	55                   	push   %ebp
+ be5:	89 e5                	mov    %esp,%ebp
+ be7:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ bea:	8b 45 08             	mov    0x8(%ebp),%eax
+ bed:	8b 00                	mov    (%eax),%eax
+ bef:	85 c0                	test   %eax,%eax
+ bf1:	79 0c                	jns    bff <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf6:	ba 00 00 00 00       	mov    $0x0,%edx
+ bfb:	87 10                	xchg   %edx,(%eax)
+ bfd:	eb 18                	jmp    c17 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ bff:	8b 55 08             	mov    0x8(%ebp),%edx
+ c02:	b8 01 00 00 00       	mov    $0x1,%eax
+ c07:	f7 d8                	neg    %eax
+ c09:	89 c1                	mov    %eax,%ecx
+ c0b:	89 c8                	mov    %ecx,%eax
+ c0d:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ c11:	01 c8                	add    %ecx,%eax
+ c13:	85 c0                	test   %eax,%eax
+ c15:	75 20                	jne    c37 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ c17:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1a:	8b 40 04             	mov    0x4(%eax),%eax
+ c1d:	85 c0                	test   %eax,%eax
+ c1f:	74 17                	je     c38 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ c21:	8b 45 08             	mov    0x8(%ebp),%eax
+ c24:	83 ec 08             	sub    $0x8,%esp
+ c27:	68 ff ff ff 7f       	push   $0x7fffffff
+ c2c:	50                   	push   %eax
+ c2d:	e8 96 f9 ff ff       	call   5c8 <futex_wake>
+ c32:	83 c4 10             	add    $0x10,%esp
+ c35:	eb 01                	jmp    c38 <rwlock_unlock+0x54>
+    return;
+ c37:	90                   	nop
+}
+ c38:	c9                   	leave
+ c39:	c3                   	ret
+
+00000c3a <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ c3a:	55                   	push   %ebp
+ c3b:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ c3d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c40:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c46:	90                   	nop
+ c47:	5d                   	pop    %ebp
+ c48:	c3                   	ret
+
+00000c49 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ c49:	55                   	push   %ebp
+ c4a:	89 e5                	mov    %esp,%ebp
+ c4c:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ c4f:	8b 45 08             	mov    0x8(%ebp),%eax
+ c52:	8b 00                	mov    (%eax),%eax
+ c54:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ c57:	83 ec 0c             	sub    $0xc,%esp
+ c5a:	ff 75 0c             	push   0xc(%ebp)
+ c5d:	e8 86 fe ff ff       	call   ae8 <mutex_unlock>
+ c62:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ c65:	8b 45 08             	mov    0x8(%ebp),%eax
+ c68:	83 ec 08             	sub    $0x8,%esp
+ c6b:	ff 75 f4             	push   -0xc(%ebp)
+ c6e:	50                   	push   %eax
+ c6f:	e8 4c f9 ff ff       	call   5c0 <futex_wait>
+ c74:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ c77:	83 ec 0c             	sub    $0xc,%esp
+ c7a:	ff 75 0c             	push   0xc(%ebp)
+ c7d:	e8 08 fe ff ff       	call   a8a <mutex_lock>
+ c82:	83 c4 10             	add    $0x10,%esp
+}
+ c85:	90                   	nop
+ c86:	c9                   	leave
+ c87:	c3                   	ret
+
+00000c88 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ c88:	55                   	push   %ebp
+ c89:	89 e5                	mov    %esp,%ebp
+ c8b:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c8e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c91:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ c95:	8b 45 08             	mov    0x8(%ebp),%eax
+ c98:	83 ec 08             	sub    $0x8,%esp
+ c9b:	6a 01                	push   $0x1
+ c9d:	50                   	push   %eax
+ c9e:	e8 25 f9 ff ff       	call   5c8 <futex_wake>
+ ca3:	83 c4 10             	add    $0x10,%esp
+}
+ ca6:	90                   	nop
+ ca7:	c9                   	leave
+ ca8:	c3                   	ret
+
+00000ca9 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ ca9:	55                   	push   %ebp
+ caa:	89 e5                	mov    %esp,%ebp
+ cac:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ caf:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb2:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ cb6:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb9:	83 ec 08             	sub    $0x8,%esp
+ cbc:	68 ff ff ff 7f       	push   $0x7fffffff
+ cc1:	50                   	push   %eax
+ cc2:	e8 01 f9 ff ff       	call   5c8 <futex_wake>
+ cc7:	83 c4 10             	add    $0x10,%esp
+}
+ cca:	90                   	nop
+ ccb:	c9                   	leave
+ ccc:	c3                   	ret
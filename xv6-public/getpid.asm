@@ -0,0 +1,1728 @@
+
+_getpid:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int main(int argc, char const *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+    int pid = getpid();
+  11:	e8 ce 03 00 00       	call   3e4 <getpid>
+  16:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    printf(1, "Current Process id is %d\n", pid);
+  19:	83 ec 04             	sub    $0x4,%esp
+  1c:	ff 75 f4             	push   -0xc(%ebp)
+  1f:	68 d9 0b 00 00       	push   $0xbd9
+  24:	6a 01                	push   $0x1
+  26:	e8 a5 05 00 00       	call   5d0 <printf>
+  2b:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2e:	e8 31 03 00 00       	call   364 <exit>
+
+00000033 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+  33:	55                   	push   %ebp
+  34:	89 e5                	mov    %esp,%ebp
+  36:	57                   	push   %edi
+  37:	53                   	push   %ebx
+{
+  38:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  3b:	8b 55 10             	mov    0x10(%ebp),%edx
+  3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  41:	89 cb                	mov    %ecx,%ebx
+  43:	89 df                	mov    %ebx,%edi
+  45:	89 d1                	mov    %edx,%ecx
+  47:	fc                   	cld
+  48:	f3 aa                	rep stos %al,%es:(%edi)
+  4a:	89 ca                	mov    %ecx,%edx
+  4c:	89 fb                	mov    %edi,%ebx
+  4e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  51:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+  54:	90                   	nop
+  55:	5b                   	pop    %ebx
+  56:	5f                   	pop    %edi
+  57:	5d                   	pop    %ebp
+  58:	c3                   	ret
+
+00000059 <strcpy>:
+{
+  59:	55                   	push   %ebp
+  5a:	89 e5                	mov    %esp,%ebp
+  5c:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  62:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  65:	90                   	nop
+  66:	8b 55 0c             	mov    0xc(%ebp),%edx
+  69:	8d 42 01             	lea    0x1(%edx),%eax
+  6c:	89 45 0c             	mov    %eax,0xc(%ebp)
+  6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  72:	8d 48 01             	lea    0x1(%eax),%ecx
+  75:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  78:	0f b6 12             	movzbl (%edx),%edx
+  7b:	88 10                	mov    %dl,(%eax)
+  7d:	0f b6 00             	movzbl (%eax),%eax
+  80:	84 c0                	test   %al,%al
+  82:	75 e2                	jne    66 <strcpy+0xd>
+  return os;
+  84:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  87:	c9                   	leave
+  88:	c3                   	ret
+
+00000089 <strcmp>:
+{
+  89:	55                   	push   %ebp
+  8a:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  8c:	eb 08                	jmp    96 <strcmp+0xd>
+    p++, q++;
+  8e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  92:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  96:	8b 45 08             	mov    0x8(%ebp),%eax
+  99:	0f b6 00             	movzbl (%eax),%eax
+  9c:	84 c0                	test   %al,%al
+  9e:	74 10                	je     b0 <strcmp+0x27>
+  a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  a3:	0f b6 10             	movzbl (%eax),%edx
+  a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a9:	0f b6 00             	movzbl (%eax),%eax
+  ac:	38 c2                	cmp    %al,%dl
+  ae:	74 de                	je     8e <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  b3:	0f b6 00             	movzbl (%eax),%eax
+  b6:	0f b6 d0             	movzbl %al,%edx
+  b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  bc:	0f b6 00             	movzbl (%eax),%eax
+  bf:	0f b6 c0             	movzbl %al,%eax
+  c2:	29 c2                	sub    %eax,%edx
+  c4:	89 d0                	mov    %edx,%eax
+}
+  c6:	5d                   	pop    %ebp
+  c7:	c3                   	ret
+
+000000c8 <strlen>:
+{
+  c8:	55                   	push   %ebp
+  c9:	89 e5                	mov    %esp,%ebp
+  cb:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+  ce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  d5:	eb 04                	jmp    db <strlen+0x13>
+  d7:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  db:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  de:	8b 45 08             	mov    0x8(%ebp),%eax
+  e1:	01 d0                	add    %edx,%eax
+  e3:	0f b6 00             	movzbl (%eax),%eax
+  e6:	84 c0                	test   %al,%al
+  e8:	75 ed                	jne    d7 <strlen+0xf>
+  return n;
+  ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  ed:	c9                   	leave
+  ee:	c3                   	ret
+
+000000ef <memset>:
+{
+  ef:	55                   	push   %ebp
+  f0:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+  f2:	8b 45 10             	mov    0x10(%ebp),%eax
+  f5:	50                   	push   %eax
+  f6:	ff 75 0c             	push   0xc(%ebp)
+  f9:	ff 75 08             	push   0x8(%ebp)
+  fc:	e8 32 ff ff ff       	call   33 <stosb>
+ 101:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 104:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+
+00000109 <strchr>:
+{
+ 109:	55                   	push   %ebp
+ 10a:	89 e5                	mov    %esp,%ebp
+ 10c:	83 ec 04             	sub    $0x4,%esp
+ 10f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 112:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 115:	eb 14                	jmp    12b <strchr+0x22>
+    if(*s == c)
+ 117:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11a:	0f b6 00             	movzbl (%eax),%eax
+ 11d:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 120:	75 05                	jne    127 <strchr+0x1e>
+      return (char*)s;
+ 122:	8b 45 08             	mov    0x8(%ebp),%eax
+ 125:	eb 13                	jmp    13a <strchr+0x31>
+  for(; *s; s++)
+ 127:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 12b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 12e:	0f b6 00             	movzbl (%eax),%eax
+ 131:	84 c0                	test   %al,%al
+ 133:	75 e2                	jne    117 <strchr+0xe>
+  return 0;
+ 135:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 13a:	c9                   	leave
+ 13b:	c3                   	ret
+
+0000013c <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 13c:	55                   	push   %ebp
+ 13d:	89 e5                	mov    %esp,%ebp
+ 13f:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 142:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 149:	eb 42                	jmp    18d <gets+0x51>
+    cc = read(0, &c, 1);
+ 14b:	83 ec 04             	sub    $0x4,%esp
+ 14e:	6a 01                	push   $0x1
+ 150:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 153:	50                   	push   %eax
+ 154:	6a 00                	push   $0x0
+ 156:	e8 21 02 00 00       	call   37c <read>
+ 15b:	83 c4 10             	add    $0x10,%esp
+ 15e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 161:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 165:	7e 33                	jle    19a <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 167:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 16a:	8d 50 01             	lea    0x1(%eax),%edx
+ 16d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 170:	89 c2                	mov    %eax,%edx
+ 172:	8b 45 08             	mov    0x8(%ebp),%eax
+ 175:	01 c2                	add    %eax,%edx
+ 177:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 17b:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 17d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 181:	3c 0a                	cmp    $0xa,%al
+ 183:	74 16                	je     19b <gets+0x5f>
+ 185:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 189:	3c 0d                	cmp    $0xd,%al
+ 18b:	74 0e                	je     19b <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 18d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 196:	7f b3                	jg     14b <gets+0xf>
+ 198:	eb 01                	jmp    19b <gets+0x5f>
+      break;
+ 19a:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 19b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 19e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a1:	01 d0                	add    %edx,%eax
+ 1a3:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1a6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1a9:	c9                   	leave
+ 1aa:	c3                   	ret
+
+000001ab <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1ab:	55                   	push   %ebp
+ 1ac:	89 e5                	mov    %esp,%ebp
+ 1ae:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	6a 00                	push   $0x0
+ 1b6:	ff 75 08             	push   0x8(%ebp)
+ 1b9:	e8 e6 01 00 00       	call   3a4 <open>
+ 1be:	83 c4 10             	add    $0x10,%esp
+ 1c1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1c4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1c8:	79 07                	jns    1d1 <stat+0x26>
+    return -1;
+ 1ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1cf:	eb 25                	jmp    1f6 <stat+0x4b>
+  r = fstat(fd, st);
+ 1d1:	83 ec 08             	sub    $0x8,%esp
+ 1d4:	ff 75 0c             	push   0xc(%ebp)
+ 1d7:	ff 75 f4             	push   -0xc(%ebp)
+ 1da:	e8 dd 01 00 00       	call   3bc <fstat>
+ 1df:	83 c4 10             	add    $0x10,%esp
+ 1e2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 1e5:	83 ec 0c             	sub    $0xc,%esp
+ 1e8:	ff 75 f4             	push   -0xc(%ebp)
+ 1eb:	e8 9c 01 00 00       	call   38c <close>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 1f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1f6:	c9                   	leave
+ 1f7:	c3                   	ret
+
+000001f8 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1f8:	55                   	push   %ebp
+ 1f9:	89 e5                	mov    %esp,%ebp
+ 1fb:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 1fe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 205:	eb 25                	jmp    22c <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 207:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 20a:	89 d0                	mov    %edx,%eax
+ 20c:	c1 e0 02             	shl    $0x2,%eax
+ 20f:	01 d0                	add    %edx,%eax
+ 211:	01 c0                	add    %eax,%eax
+ 213:	89 c1                	mov    %eax,%ecx
+ 215:	8b 45 08             	mov    0x8(%ebp),%eax
+ 218:	8d 50 01             	lea    0x1(%eax),%edx
+ 21b:	89 55 08             	mov    %edx,0x8(%ebp)
+ 21e:	0f b6 00             	movzbl (%eax),%eax
+ 221:	0f be c0             	movsbl %al,%eax
+ 224:	01 c8                	add    %ecx,%eax
+ 226:	83 e8 30             	sub    $0x30,%eax
+ 229:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 22c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22f:	0f b6 00             	movzbl (%eax),%eax
+ 232:	3c 2f                	cmp    $0x2f,%al
+ 234:	7e 0a                	jle    240 <atoi+0x48>
+ 236:	8b 45 08             	mov    0x8(%ebp),%eax
+ 239:	0f b6 00             	movzbl (%eax),%eax
+ 23c:	3c 39                	cmp    $0x39,%al
+ 23e:	7e c7                	jle    207 <atoi+0xf>
+  return n;
+ 240:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 243:	c9                   	leave
+ 244:	c3                   	ret
+
+00000245 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 245:	55                   	push   %ebp
+ 246:	89 e5                	mov    %esp,%ebp
+ 248:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 24b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 251:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 254:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 257:	eb 17                	jmp    270 <memmove+0x2b>
+    *dst++ = *src++;
+ 259:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 25c:	8d 42 01             	lea    0x1(%edx),%eax
+ 25f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 262:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 265:	8d 48 01             	lea    0x1(%eax),%ecx
+ 268:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 26b:	0f b6 12             	movzbl (%edx),%edx
+ 26e:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 270:	8b 45 10             	mov    0x10(%ebp),%eax
+ 273:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 276:	89 55 10             	mov    %edx,0x10(%ebp)
+ 279:	85 c0                	test   %eax,%eax
+ 27b:	7f dc                	jg     259 <memmove+0x14>
+  return vdst;
+ 27d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 280:	c9                   	leave
+ 281:	c3                   	ret
+
+00000282 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 282:	55                   	push   %ebp
+ 283:	89 e5                	mov    %esp,%ebp
+ 285:	57                   	push   %edi
+ 286:	56                   	push   %esi
+ 287:	83 ec 30             	sub    $0x30,%esp
+ 28a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 290:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 293:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 296:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 29d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 2a4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2a7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 2aa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 2ad:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 2b0:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 2b7:	e9 89 00 00 00       	jmp    345 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 2bc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2bf:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 2c2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 2c6:	01 c0                	add    %eax,%eax
+ 2c8:	89 c6                	mov    %eax,%esi
+ 2ca:	89 d7                	mov    %edx,%edi
+ 2cc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 2cf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 2d2:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 2d5:	0f ad d0             	shrd   %cl,%edx,%eax
+ 2d8:	d3 ea                	shr    %cl,%edx
+ 2da:	f6 c1 20             	test   $0x20,%cl
+ 2dd:	74 04                	je     2e3 <udiv64+0x61>
+ 2df:	89 d0                	mov    %edx,%eax
+ 2e1:	31 d2                	xor    %edx,%edx
+ 2e3:	83 e0 01             	and    $0x1,%eax
+ 2e6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 2e9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 2f0:	89 f0                	mov    %esi,%eax
+ 2f2:	89 fa                	mov    %edi,%edx
+ 2f4:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 2f7:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 2fa:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 2fd:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 300:	8b 45 10             	mov    0x10(%ebp),%eax
+ 303:	ba 00 00 00 00       	mov    $0x0,%edx
+ 308:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 30b:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 30e:	19 d1                	sbb    %edx,%ecx
+ 310:	72 2f                	jb     341 <udiv64+0xbf>
+      r -= d;
+ 312:	8b 45 10             	mov    0x10(%ebp),%eax
+ 315:	ba 00 00 00 00       	mov    $0x0,%edx
+ 31a:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 31d:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 320:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 323:	b8 01 00 00 00       	mov    $0x1,%eax
+ 328:	ba 00 00 00 00       	mov    $0x0,%edx
+ 32d:	0f a5 c2             	shld   %cl,%eax,%edx
+ 330:	d3 e0                	shl    %cl,%eax
+ 332:	f6 c1 20             	test   $0x20,%cl
+ 335:	74 04                	je     33b <udiv64+0xb9>
+ 337:	89 c2                	mov    %eax,%edx
+ 339:	31 c0                	xor    %eax,%eax
+ 33b:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 33e:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 341:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 345:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 349:	0f 89 6d ff ff ff    	jns    2bc <udiv64+0x3a>
+    }
+  }
+  return q;
+ 34f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 352:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 355:	83 c4 30             	add    $0x30,%esp
+ 358:	5e                   	pop    %esi
+ 359:	5f                   	pop    %edi
+ 35a:	5d                   	pop    %ebp
+ 35b:	c3                   	ret
+
+0000035c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 35c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <exit>:
+SYSCALL(exit)
+ 364:	b8 02 00 00 00       	mov    $0x2,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <wait>:
+SYSCALL(wait)
+ 36c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <pipe>:
+SYSCALL(pipe)
+ 374:	b8 04 00 00 00       	mov    $0x4,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <read>:
+SYSCALL(read)
+ 37c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <write>:
+SYSCALL(write)
+ 384:	b8 10 00 00 00       	mov    $0x10,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <close>:
+SYSCALL(close)
+ 38c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <kill>:
+SYSCALL(kill)
+ 394:	b8 06 00 00 00       	mov    $0x6,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <exec>:
+SYSCALL(exec)
+ 39c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <open>:
+SYSCALL(open)
+ 3a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <mknod>:
+SYSCALL(mknod)
+ 3ac:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <unlink>:
+SYSCALL(unlink)
+ 3b4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <fstat>:
+SYSCALL(fstat)
+ 3bc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <link>:
+SYSCALL(link)
+ 3c4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <mkdir>:
+SYSCALL(mkdir)
+ 3cc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <chdir>:
+SYSCALL(chdir)
+ 3d4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <dup>:
+SYSCALL(dup)
+ 3dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <getpid>:
+SYSCALL(getpid)
+ 3e4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <sbrk>:
+SYSCALL(sbrk)
+ 3ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <sleep>:
+SYSCALL(sleep)
+ 3f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <uptime>:
+SYSCALL(uptime)
+ 3fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 404:	b8 16 00 00 00       	mov    $0x16,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 40c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 414:	b8 18 00 00 00       	mov    $0x18,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <copy_file>:
+SYSCALL(copy_file)
+ 41c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <change_queue>:
+SYSCALL(change_queue)
+ 424:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 42c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 434:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <print_process_info>:
+SYSCALL(print_process_info)
+ 43c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 444:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 44c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 454:	b8 20 00 00 00       	mov    $0x20,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 45c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 464:	b8 22 00 00 00       	mov    $0x22,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 46c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 474:	b8 24 00 00 00       	mov    $0x24,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 47c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <set_affinity>:
+SYSCALL(set_affinity)
+ 484:	b8 26 00 00 00       	mov    $0x26,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <setsched>:
+SYSCALL(setsched)
+ 48c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 494:	b8 28 00 00 00       	mov    $0x28,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <set_quantum>:
+SYSCALL(set_quantum)
+ 49c:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <schedtrace>:
+SYSCALL(schedtrace)
+ 4a4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <getrusage>:
+SYSCALL(getrusage)
+ 4ac:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 4b4:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 4bc:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 4c4:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <futex_wait>:
+SYSCALL(futex_wait)
+ 4cc:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <futex_wake>:
+SYSCALL(futex_wake)
+ 4d4:	b8 30 00 00 00       	mov    $0x30,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <syscall_latency>:
+SYSCALL(syscall_latency)
+ 4dc:	b8 31 00 00 00       	mov    $0x31,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <submit_batch>:
+SYSCALL(submit_batch)
+ 4e4:	b8 32 00 00 00       	mov    $0x32,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <kmem_stats>:
+SYSCALL(kmem_stats)
+ 4ec:	b8 33 00 00 00       	mov    $0x33,%eax
+ 4f1:	cd 40                	int    $0x40
+ 4f3:	c3                   	ret
+
+000004f4 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 4f4:	b8 34 00 00 00       	mov    $0x34,%eax
+ 4f9:	cd 40                	int    $0x40
+ 4fb:	c3                   	ret
+
+000004fc <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4fc:	55                   	push   %ebp
+ 4fd:	89 e5                	mov    %esp,%ebp
+ 4ff:	83 ec 18             	sub    $0x18,%esp
+ 502:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 505:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 508:	83 ec 04             	sub    $0x4,%esp
+ 50b:	6a 01                	push   $0x1
+ 50d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 510:	50                   	push   %eax
+ 511:	ff 75 08             	push   0x8(%ebp)
+ 514:	e8 6b fe ff ff       	call   384 <write>
+ 519:	83 c4 10             	add    $0x10,%esp
+}
+ 51c:	90                   	nop
+ 51d:	c9                   	leave
+ 51e:	c3                   	ret
+
+0000051f <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 51f:	55                   	push   %ebp
+ 520:	89 e5                	mov    %esp,%ebp
+ 522:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 525:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 52c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 530:	74 17                	je     549 <printint+0x2a>
+ 532:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 536:	79 11                	jns    549 <printint+0x2a>
+    neg = 1;
+ 538:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 53f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 542:	f7 d8                	neg    %eax
+ 544:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 547:	eb 06                	jmp    54f <printint+0x30>
+  } else {
+    x = xx;
+ 549:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 54c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 54f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 556:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 559:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 55c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 561:	f7 f1                	div    %ecx
+ 563:	89 d1                	mov    %edx,%ecx
+ 565:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 568:	8d 50 01             	lea    0x1(%eax),%edx
+ 56b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 56e:	0f b6 91 e8 0f 00 00 	movzbl 0xfe8(%ecx),%edx
+ 575:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 579:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 57c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 57f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 584:	f7 f1                	div    %ecx
+ 586:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 589:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 58d:	75 c7                	jne    556 <printint+0x37>
+  if(neg)
+ 58f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 593:	74 2d                	je     5c2 <printint+0xa3>
+    buf[i++] = '-';
+ 595:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 598:	8d 50 01             	lea    0x1(%eax),%edx
+ 59b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 59e:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5a3:	eb 1d                	jmp    5c2 <printint+0xa3>
+    putc(fd, buf[i]);
+ 5a5:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5ab:	01 d0                	add    %edx,%eax
+ 5ad:	0f b6 00             	movzbl (%eax),%eax
+ 5b0:	0f be c0             	movsbl %al,%eax
+ 5b3:	83 ec 08             	sub    $0x8,%esp
+ 5b6:	50                   	push   %eax
+ 5b7:	ff 75 08             	push   0x8(%ebp)
+ 5ba:	e8 3d ff ff ff       	call   4fc <putc>
+ 5bf:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 5c2:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 5c6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5ca:	79 d9                	jns    5a5 <printint+0x86>
+}
+ 5cc:	90                   	nop
+ 5cd:	90                   	nop
+ 5ce:	c9                   	leave
+ 5cf:	c3                   	ret
+
+000005d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 5d6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 5dd:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 5e0:	83 c0 04             	add    $0x4,%eax
+ 5e3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5e6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 5ed:	e9 59 01 00 00       	jmp    74b <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 5f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5f5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5f8:	01 d0                	add    %edx,%eax
+ 5fa:	0f b6 00             	movzbl (%eax),%eax
+ 5fd:	0f be c0             	movsbl %al,%eax
+ 600:	25 ff 00 00 00       	and    $0xff,%eax
+ 605:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 608:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 60c:	75 2c                	jne    63a <printf+0x6a>
+      if(c == '%'){
+ 60e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 612:	75 0c                	jne    620 <printf+0x50>
+        state = '%';
+ 614:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 61b:	e9 27 01 00 00       	jmp    747 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 620:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 623:	0f be c0             	movsbl %al,%eax
+ 626:	83 ec 08             	sub    $0x8,%esp
+ 629:	50                   	push   %eax
+ 62a:	ff 75 08             	push   0x8(%ebp)
+ 62d:	e8 ca fe ff ff       	call   4fc <putc>
+ 632:	83 c4 10             	add    $0x10,%esp
+ 635:	e9 0d 01 00 00       	jmp    747 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 63a:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 63e:	0f 85 03 01 00 00    	jne    747 <printf+0x177>
+      if(c == 'd'){
+ 644:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 648:	75 1e                	jne    668 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 64a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 64d:	8b 00                	mov    (%eax),%eax
+ 64f:	6a 01                	push   $0x1
+ 651:	6a 0a                	push   $0xa
+ 653:	50                   	push   %eax
+ 654:	ff 75 08             	push   0x8(%ebp)
+ 657:	e8 c3 fe ff ff       	call   51f <printint>
+ 65c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 65f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 663:	e9 d8 00 00 00       	jmp    740 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 668:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 66c:	74 06                	je     674 <printf+0xa4>
+ 66e:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 672:	75 1e                	jne    692 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 674:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 677:	8b 00                	mov    (%eax),%eax
+ 679:	6a 00                	push   $0x0
+ 67b:	6a 10                	push   $0x10
+ 67d:	50                   	push   %eax
+ 67e:	ff 75 08             	push   0x8(%ebp)
+ 681:	e8 99 fe ff ff       	call   51f <printint>
+ 686:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 689:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 68d:	e9 ae 00 00 00       	jmp    740 <printf+0x170>
+      } else if(c == 's'){
+ 692:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 696:	75 43                	jne    6db <printf+0x10b>
+        s = (char*)*ap;
+ 698:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 69b:	8b 00                	mov    (%eax),%eax
+ 69d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6a0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6a4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6a8:	75 25                	jne    6cf <printf+0xff>
+          s = "(null)";
+ 6aa:	c7 45 f4 f3 0b 00 00 	movl   $0xbf3,-0xc(%ebp)
+        while(*s != 0){
+ 6b1:	eb 1c                	jmp    6cf <printf+0xff>
+          putc(fd, *s);
+ 6b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6b6:	0f b6 00             	movzbl (%eax),%eax
+ 6b9:	0f be c0             	movsbl %al,%eax
+ 6bc:	83 ec 08             	sub    $0x8,%esp
+ 6bf:	50                   	push   %eax
+ 6c0:	ff 75 08             	push   0x8(%ebp)
+ 6c3:	e8 34 fe ff ff       	call   4fc <putc>
+ 6c8:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 6cb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 6cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6d2:	0f b6 00             	movzbl (%eax),%eax
+ 6d5:	84 c0                	test   %al,%al
+ 6d7:	75 da                	jne    6b3 <printf+0xe3>
+ 6d9:	eb 65                	jmp    740 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 6db:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 6df:	75 1d                	jne    6fe <printf+0x12e>
+        putc(fd, *ap);
+ 6e1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6e4:	8b 00                	mov    (%eax),%eax
+ 6e6:	0f be c0             	movsbl %al,%eax
+ 6e9:	83 ec 08             	sub    $0x8,%esp
+ 6ec:	50                   	push   %eax
+ 6ed:	ff 75 08             	push   0x8(%ebp)
+ 6f0:	e8 07 fe ff ff       	call   4fc <putc>
+ 6f5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6f8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6fc:	eb 42                	jmp    740 <printf+0x170>
+      } else if(c == '%'){
+ 6fe:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 702:	75 17                	jne    71b <printf+0x14b>
+        putc(fd, c);
+ 704:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 707:	0f be c0             	movsbl %al,%eax
+ 70a:	83 ec 08             	sub    $0x8,%esp
+ 70d:	50                   	push   %eax
+ 70e:	ff 75 08             	push   0x8(%ebp)
+ 711:	e8 e6 fd ff ff       	call   4fc <putc>
+ 716:	83 c4 10             	add    $0x10,%esp
+ 719:	eb 25                	jmp    740 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 71b:	83 ec 08             	sub    $0x8,%esp
+ 71e:	6a 25                	push   $0x25
+ 720:	ff 75 08             	push   0x8(%ebp)
+ 723:	e8 d4 fd ff ff       	call   4fc <putc>
+ 728:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 72b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 72e:	0f be c0             	movsbl %al,%eax
+ 731:	83 ec 08             	sub    $0x8,%esp
+ 734:	50                   	push   %eax
+ 735:	ff 75 08             	push   0x8(%ebp)
+ 738:	e8 bf fd ff ff       	call   4fc <putc>
+ 73d:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 740:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 747:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 74b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 74e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 751:	01 d0                	add    %edx,%eax
+ 753:	0f b6 00             	movzbl (%eax),%eax
+ 756:	84 c0                	test   %al,%al
+ 758:	0f 85 94 fe ff ff    	jne    5f2 <printf+0x22>
+    }
+  }
+}
+ 75e:	90                   	nop
+ 75f:	90                   	nop
+ 760:	c9                   	leave
+ 761:	c3                   	ret
+
+00000762 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 762:	55                   	push   %ebp
+ 763:	89 e5                	mov    %esp,%ebp
+ 765:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 768:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76b:	83 e8 08             	sub    $0x8,%eax
+ 76e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 771:	a1 04 10 00 00       	mov    0x1004,%eax
+ 776:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 779:	eb 24                	jmp    79f <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 77b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 77e:	8b 00                	mov    (%eax),%eax
+ 780:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 783:	72 12                	jb     797 <free+0x35>
+ 785:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 788:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 78b:	72 24                	jb     7b1 <free+0x4f>
+ 78d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 790:	8b 00                	mov    (%eax),%eax
+ 792:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 795:	72 1a                	jb     7b1 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 797:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 79a:	8b 00                	mov    (%eax),%eax
+ 79c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 79f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7a2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7a5:	73 d4                	jae    77b <free+0x19>
+ 7a7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7aa:	8b 00                	mov    (%eax),%eax
+ 7ac:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7af:	73 ca                	jae    77b <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7b1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7b4:	8b 40 04             	mov    0x4(%eax),%eax
+ 7b7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7be:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7c1:	01 c2                	add    %eax,%edx
+ 7c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7c6:	8b 00                	mov    (%eax),%eax
+ 7c8:	39 c2                	cmp    %eax,%edx
+ 7ca:	75 24                	jne    7f0 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 7cc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7cf:	8b 50 04             	mov    0x4(%eax),%edx
+ 7d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d5:	8b 00                	mov    (%eax),%eax
+ 7d7:	8b 40 04             	mov    0x4(%eax),%eax
+ 7da:	01 c2                	add    %eax,%edx
+ 7dc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7df:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e5:	8b 00                	mov    (%eax),%eax
+ 7e7:	8b 10                	mov    (%eax),%edx
+ 7e9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ec:	89 10                	mov    %edx,(%eax)
+ 7ee:	eb 0a                	jmp    7fa <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 7f0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f3:	8b 10                	mov    (%eax),%edx
+ 7f5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f8:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 7fa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7fd:	8b 40 04             	mov    0x4(%eax),%eax
+ 800:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 807:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 80a:	01 d0                	add    %edx,%eax
+ 80c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 80f:	75 20                	jne    831 <free+0xcf>
+    p->s.size += bp->s.size;
+ 811:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 814:	8b 50 04             	mov    0x4(%eax),%edx
+ 817:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 81a:	8b 40 04             	mov    0x4(%eax),%eax
+ 81d:	01 c2                	add    %eax,%edx
+ 81f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 822:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 825:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 828:	8b 10                	mov    (%eax),%edx
+ 82a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 82d:	89 10                	mov    %edx,(%eax)
+ 82f:	eb 08                	jmp    839 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 831:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 834:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 837:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 839:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83c:	a3 04 10 00 00       	mov    %eax,0x1004
+}
+ 841:	90                   	nop
+ 842:	c9                   	leave
+ 843:	c3                   	ret
+
+00000844 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 844:	55                   	push   %ebp
+ 845:	89 e5                	mov    %esp,%ebp
+ 847:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 84a:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 851:	77 07                	ja     85a <morecore+0x16>
+    nu = 4096;
+ 853:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 85a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 85d:	c1 e0 03             	shl    $0x3,%eax
+ 860:	83 ec 0c             	sub    $0xc,%esp
+ 863:	50                   	push   %eax
+ 864:	e8 83 fb ff ff       	call   3ec <sbrk>
+ 869:	83 c4 10             	add    $0x10,%esp
+ 86c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 86f:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 873:	75 07                	jne    87c <morecore+0x38>
+    return 0;
+ 875:	b8 00 00 00 00       	mov    $0x0,%eax
+ 87a:	eb 26                	jmp    8a2 <morecore+0x5e>
+  hp = (Header*)p;
+ 87c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 87f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 882:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 885:	8b 55 08             	mov    0x8(%ebp),%edx
+ 888:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 88b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 88e:	83 c0 08             	add    $0x8,%eax
+ 891:	83 ec 0c             	sub    $0xc,%esp
+ 894:	50                   	push   %eax
+ 895:	e8 c8 fe ff ff       	call   762 <free>
+ 89a:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 89d:	a1 04 10 00 00       	mov    0x1004,%eax
+}
+ 8a2:	c9                   	leave
+ 8a3:	c3                   	ret
+
+000008a4 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8a4:	55                   	push   %ebp
+ 8a5:	89 e5                	mov    %esp,%ebp
+ 8a7:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ad:	83 c0 07             	add    $0x7,%eax
+ 8b0:	c1 e8 03             	shr    $0x3,%eax
+ 8b3:	83 c0 01             	add    $0x1,%eax
+ 8b6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 8b9:	a1 04 10 00 00       	mov    0x1004,%eax
+ 8be:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8c1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8c5:	75 23                	jne    8ea <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 8c7:	c7 45 f0 fc 0f 00 00 	movl   $0xffc,-0x10(%ebp)
+ 8ce:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8d1:	a3 04 10 00 00       	mov    %eax,0x1004
+ 8d6:	a1 04 10 00 00       	mov    0x1004,%eax
+ 8db:	a3 fc 0f 00 00       	mov    %eax,0xffc
+    base.s.size = 0;
+ 8e0:	c7 05 00 10 00 00 00 	movl   $0x0,0x1000
+ 8e7:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8ea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8ed:	8b 00                	mov    (%eax),%eax
+ 8ef:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f5:	8b 40 04             	mov    0x4(%eax),%eax
+ 8f8:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 8fb:	72 4d                	jb     94a <malloc+0xa6>
+      if(p->s.size == nunits)
+ 8fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 900:	8b 40 04             	mov    0x4(%eax),%eax
+ 903:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 906:	75 0c                	jne    914 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 908:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 90b:	8b 10                	mov    (%eax),%edx
+ 90d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 910:	89 10                	mov    %edx,(%eax)
+ 912:	eb 26                	jmp    93a <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 914:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 917:	8b 40 04             	mov    0x4(%eax),%eax
+ 91a:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 91d:	89 c2                	mov    %eax,%edx
+ 91f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 922:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 925:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 928:	8b 40 04             	mov    0x4(%eax),%eax
+ 92b:	c1 e0 03             	shl    $0x3,%eax
+ 92e:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 931:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 934:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 937:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 93a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 93d:	a3 04 10 00 00       	mov    %eax,0x1004
+      return (void*)(p + 1);
+ 942:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 945:	83 c0 08             	add    $0x8,%eax
+ 948:	eb 3b                	jmp    985 <malloc+0xe1>
+    }
+    if(p == freep)
+ 94a:	a1 04 10 00 00       	mov    0x1004,%eax
+ 94f:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 952:	75 1e                	jne    972 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 954:	83 ec 0c             	sub    $0xc,%esp
+ 957:	ff 75 ec             	push   -0x14(%ebp)
+ 95a:	e8 e5 fe ff ff       	call   844 <morecore>
+ 95f:	83 c4 10             	add    $0x10,%esp
+ 962:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 965:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 969:	75 07                	jne    972 <malloc+0xce>
+        return 0;
+ 96b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 970:	eb 13                	jmp    985 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 972:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 975:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 978:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97b:	8b 00                	mov    (%eax),%eax
+ 97d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 980:	e9 6d ff ff ff       	jmp    8f2 <malloc+0x4e>
+  }
+}
+ 985:	c9                   	leave
+ 986:	c3                   	ret
+
+00000987 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ 987:	55                   	push   %ebp
+ 988:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 98a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 98d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 993:	90                   	nop
+ 994:	5d                   	pop    %ebp
+ 995:	c3                   	ret
+
+00000996 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 996:	55                   	push   %ebp
+ 997:	89 e5                	mov    %esp,%ebp
+ 999:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 99c:	8b 55 08             	mov    0x8(%ebp),%edx
+ 99f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9a4:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 9a9:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ 9ad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9b0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9b4:	74 3b                	je     9f1 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ 9b6:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 9ba:	74 2d                	je     9e9 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ 9bc:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9bf:	b8 02 00 00 00       	mov    $0x2,%eax
+ 9c4:	87 02                	xchg   %eax,(%edx)
+ 9c6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 9c9:	eb 1e                	jmp    9e9 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ 9cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ce:	83 ec 08             	sub    $0x8,%esp
+ 9d1:	6a 02                	push   $0x2
+ 9d3:	50                   	push   %eax
+ 9d4:	e8 f3 fa ff ff       	call   4cc <futex_wait>
+ 9d9:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ 9dc:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9df:	b8 02 00 00 00       	mov    $0x2,%eax
+ 9e4:	87 02                	xchg   %eax,(%edx)
+ 9e6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 9e9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9ed:	75 dc                	jne    9cb <mutex_lock+0x35>
+ 9ef:	eb 01                	jmp    9f2 <mutex_lock+0x5c>
+    return;
+ 9f1:	90                   	nop
+  }
+}
+ 9f2:	c9                   	leave
+ 9f3:	c3                   	ret
+
+000009f4 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 9f4:	55                   	push   %ebp
+ 9f5:	89 e5                	mov    %esp,%ebp
+ 9f7:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ 9fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9fd:	ba 01 00 00 00       	mov    $0x1,%edx
+ a02:	f7 da                	neg    %edx
+ a04:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ a08:	83 fa 01             	cmp    $0x1,%edx
+ a0b:	74 1a                	je     a27 <mutex_unlock+0x33>
+    m->state = 0;
+ a0d:	8b 45 08             	mov    0x8(%ebp),%eax
+ a10:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ a16:	8b 45 08             	mov    0x8(%ebp),%eax
+ a19:	83 ec 08             	sub    $0x8,%esp
+ a1c:	6a 01                	push   $0x1
+ a1e:	50                   	push   %eax
+ a1f:	e8 b0 fa ff ff       	call   4d4 <futex_wake>
+ a24:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ a27:	90                   	nop
+ a28:	c9                   	leave
+ a29:	c3                   	ret
+
+00000a2a <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ a2a:	55                   	push   %ebp
+ a2b:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ a2d:	8b 45 08             	mov    0x8(%ebp),%eax
+ a30:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ a36:	8b 45 08             	mov    0x8(%ebp),%eax
+ a39:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ a40:	90                   	nop
+ a41:	5d                   	pop    %ebp
+ a42:	c3                   	ret
+
+00000a43 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ a43:	55                   	push   %ebp
+ a44:	89 e5                	mov    %esp,%ebp
+ a46:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ a49:	8b 45 08             	mov    0x8(%ebp),%eax
+ a4c:	83 c0 04             	add    $0x4,%eax
+ a4f:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ a53:	8b 45 08             	mov    0x8(%ebp),%eax
+ a56:	83 ec 08             	sub    $0x8,%esp
+ a59:	ff 75 0c             	push   0xc(%ebp)
+ a5c:	50                   	push   %eax
+ a5d:	e8 6a fa ff ff       	call   4cc <futex_wait>
+ a62:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ a65:	8b 45 08             	mov    0x8(%ebp),%eax
+ a68:	83 c0 04             	add    $0x4,%eax
+ a6b:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ a6f:	90                   	nop
+ a70:	c9                   	leave
+ a71:	c3                   	ret
+
+00000a72 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ a72:	55                   	push   %ebp
+ a73:	89 e5                	mov    %esp,%ebp
+ a75:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ a78:	8b 45 08             	mov    0x8(%ebp),%eax
+ a7b:	8b 00                	mov    (%eax),%eax
+ a7d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ a80:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a84:	78 17                	js     a9d <rwlock_rdlock+0x2b>
+ a86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a89:	83 c0 01             	add    $0x1,%eax
+ a8c:	89 c1                	mov    %eax,%ecx
+ a8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a91:	8b 55 08             	mov    0x8(%ebp),%edx
+ a94:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ a98:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a9b:	74 19                	je     ab6 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ a9d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ aa1:	79 d5                	jns    a78 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ aa3:	83 ec 08             	sub    $0x8,%esp
+ aa6:	ff 75 f4             	push   -0xc(%ebp)
+ aa9:	ff 75 08             	push   0x8(%ebp)
+ aac:	e8 92 ff ff ff       	call   a43 <rwlock_sleep>
+ ab1:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ ab4:	eb c2                	jmp    a78 <rwlock_rdlock+0x6>
+      return;
+ ab6:	90                   	nop
+  }
+}
+ ab7:	c9                   	leave
+ ab8:	c3                   	ret
+
+00000ab9 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ ab9:	55                   	push   %ebp
+ aba:	89 e5                	mov    %esp,%ebp
+ abc:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ abf:	eb 11                	jmp    ad2 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ ac1:	83 ec 08             	sub    $0x8,%esp
+ ac4:	ff 75 f4             	push   -0xc(%ebp)
+ ac7:	ff 75 08             	push   0x8(%ebp)
+ aca:	e8 74 ff ff ff       	call   a43 <rwlock_sleep>
+ acf:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ ad2:	8b 55 08             	mov    0x8(%ebp),%edx
+ ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+ ada:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ adf:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ ae3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ae6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ aea:	75 d5                	jne    ac1 <rwlock_wrlock+0x8>
+}
+ aec:	90                   	nop
+ aed:	90                   	nop
+ aee:	c9                   	leave
+ aef:	c3                   	ret
+
+00000af0 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ af6:	8b 45 08             	mov    0x8(%ebp),%eax
+ af9:	8b 00                	mov    (%eax),%eax
+ afb:	85 c0                	test   %eax,%eax
+ afd:	79 0c                	jns    b0b <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ aff:	8b 45 08             	mov    0x8(%ebp),%eax
+ b02:	ba 00 00 00 00       	mov    $0x0,%edx
+ b07:	87 10                	xchg   %edx,(%eax)
+ b09:	eb 18                	jmp    b23 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ b0b:	8b 55 08             	mov    0x8(%ebp),%edx
+ b0e:	b8 01 00 00 00       	mov    $0x1,%eax
+ b13:	f7 d8                	neg    %eax
+ b15:	89 c1                	mov    %eax,%ecx
+ b17:	89 c8                	mov    %ecx,%eax
+ b19:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ b1d:	01 c8                	add    %ecx,%eax
+ b1f:	85 c0                	test   %eax,%eax
+ b21:	75 20                	jne    b43 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ b23:	8b 45 08             	mov    0x8(%ebp),%eax
+ b26:	8b 40 04             	mov    0x4(%eax),%eax
+ b29:	85 c0                	test   %eax,%eax
+ b2b:	74 17                	je     b44 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ b2d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b30:	83 ec 08             	sub    $0x8,%esp
+ b33:	68 ff ff ff 7f       	push   $0x7fffffff
+ b38:	50                   	push   %eax
+ b39:	e8 96 f9 ff ff       	call   4d4 <futex_wake>
+ b3e:	83 c4 10             	add    $0x10,%esp
+ b41:	eb 01                	jmp    b44 <rwlock_unlock+0x54>
+    return;
+ b43:	90                   	nop
+}
+ b44:	c9                   	leave
+ b45:	c3                   	ret
+
+00000b46 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ b46:	55                   	push   %ebp
+ b47:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ b49:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b52:	90                   	nop
+ b53:	5d                   	pop    %ebp
+ b54:	c3                   	ret
+
+00000b55 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ b55:	55                   	push   %ebp
+ b56:	89 e5                	mov    %esp,%ebp
+ b58:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b5e:	8b 00                	mov    (%eax),%eax
+ b60:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ b63:	83 ec 0c             	sub    $0xc,%esp
+ b66:	ff 75 0c             	push   0xc(%ebp)
+ b69:	e8 86 fe ff ff       	call   9f4 <mutex_unlock>
+ b6e:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ b71:	8b 45 08             	mov    0x8(%ebp),%eax
+ b74:	83 ec 08             	sub    $0x8,%esp
+ b77:	ff 75 f4             	push   -0xc(%ebp)
+ b7a:	50                   	push   %eax
+ b7b:	e8 4c f9 ff ff       	call   4cc <futex_wait>
+ b80:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ b83:	83 ec 0c             	sub    $0xc,%esp
+ b86:	ff 75 0c             	push   0xc(%ebp)
+ b89:	e8 08 fe ff ff       	call   996 <mutex_lock>
+ b8e:	83 c4 10             	add    $0x10,%esp
+}
+ b91:	90                   	nop
+ b92:	c9                   	leave
+ b93:	c3                   	ret
+
+00000b94 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ b94:	55                   	push   %ebp
+ b95:	89 e5                	mov    %esp,%ebp
+ b97:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ b9a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b9d:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba4:	83 ec 08             	sub    $0x8,%esp
+ ba7:	6a 01                	push   $0x1
+ ba9:	50                   	push   %eax
+ baa:	e8 25 f9 ff ff       	call   4d4 <futex_wake>
+ baf:	83 c4 10             	add    $0x10,%esp
+}
+ bb2:	90                   	nop
+ bb3:	c9                   	leave
+ bb4:	c3                   	ret
+
+00000bb5 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ bb5:	55                   	push   %ebp
+ bb6:	89 e5                	mov    %esp,%ebp
+ bb8:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ bbb:	8b 45 08             	mov    0x8(%ebp),%eax
+ bbe:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ bc2:	8b 45 08             	mov    0x8(%ebp),%eax
+ bc5:	83 ec 08             	sub    $0x8,%esp
+ bc8:	68 ff ff ff 7f       	push   $0x7fffffff
+ bcd:	50                   	push   %eax
+ bce:	e8 01 f9 ff ff       	call   4d4 <futex_wake>
+ bd3:	83 c4 10             	add    $0x10,%esp
+}
+ bd6:	90                   	nop
+ bd7:	c9                   	leave
+ bd8:	c3                   	ret
@@ -0,0 +1,2083 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <grep>:
+char buf[1024];
+int match(char*, char*);
+
+void
+grep(char *pattern, int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n, m;
+  char *p, *q;
+
+  m = 0;
+   6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+   d:	e9 ae 00 00 00       	jmp    c0 <grep+0xc0>
+    m += n;
+  12:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  15:	01 45 f4             	add    %eax,-0xc(%ebp)
+    buf[m] = '\0';
+  18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1b:	05 a0 13 00 00       	add    $0x13a0,%eax
+  20:	c6 00 00             	movb   $0x0,(%eax)
+    p = buf;
+  23:	c7 45 f0 a0 13 00 00 	movl   $0x13a0,-0x10(%ebp)
+    while((q = strchr(p, '\n')) != 0){
+  2a:	eb 44                	jmp    70 <grep+0x70>
+      *q = 0;
+  2c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  2f:	c6 00 00             	movb   $0x0,(%eax)
+      if(match(pattern, p)){
+  32:	83 ec 08             	sub    $0x8,%esp
+  35:	ff 75 f0             	push   -0x10(%ebp)
+  38:	ff 75 08             	push   0x8(%ebp)
+  3b:	e8 8f 01 00 00       	call   1cf <match>
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	85 c0                	test   %eax,%eax
+  45:	74 20                	je     67 <grep+0x67>
+        *q = '\n';
+  47:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  4a:	c6 00 0a             	movb   $0xa,(%eax)
+        write(1, p, q+1 - p);
+  4d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  50:	83 c0 01             	add    $0x1,%eax
+  53:	2b 45 f0             	sub    -0x10(%ebp),%eax
+  56:	83 ec 04             	sub    $0x4,%esp
+  59:	50                   	push   %eax
+  5a:	ff 75 f0             	push   -0x10(%ebp)
+  5d:	6a 01                	push   $0x1
+  5f:	e8 18 06 00 00       	call   67c <write>
+  64:	83 c4 10             	add    $0x10,%esp
+      }
+      p = q+1;
+  67:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  6a:	83 c0 01             	add    $0x1,%eax
+  6d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    while((q = strchr(p, '\n')) != 0){
+  70:	83 ec 08             	sub    $0x8,%esp
+  73:	6a 0a                	push   $0xa
+  75:	ff 75 f0             	push   -0x10(%ebp)
+  78:	e8 84 03 00 00       	call   401 <strchr>
+  7d:	83 c4 10             	add    $0x10,%esp
+  80:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  83:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  87:	75 a3                	jne    2c <grep+0x2c>
+    }
+    if(p == buf)
+  89:	81 7d f0 a0 13 00 00 	cmpl   $0x13a0,-0x10(%ebp)
+  90:	75 07                	jne    99 <grep+0x99>
+      m = 0;
+  92:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(m > 0){
+  99:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  9d:	7e 21                	jle    c0 <grep+0xc0>
+      m -= p - buf;
+  9f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  a2:	2d a0 13 00 00       	sub    $0x13a0,%eax
+  a7:	29 45 f4             	sub    %eax,-0xc(%ebp)
+      memmove(buf, p, m);
+  aa:	83 ec 04             	sub    $0x4,%esp
+  ad:	ff 75 f4             	push   -0xc(%ebp)
+  b0:	ff 75 f0             	push   -0x10(%ebp)
+  b3:	68 a0 13 00 00       	push   $0x13a0
+  b8:	e8 80 04 00 00       	call   53d <memmove>
+  bd:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+  c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  c3:	ba ff 03 00 00       	mov    $0x3ff,%edx
+  c8:	29 c2                	sub    %eax,%edx
+  ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  cd:	05 a0 13 00 00       	add    $0x13a0,%eax
+  d2:	83 ec 04             	sub    $0x4,%esp
+  d5:	52                   	push   %edx
+  d6:	50                   	push   %eax
+  d7:	ff 75 0c             	push   0xc(%ebp)
+  da:	e8 95 05 00 00       	call   674 <read>
+  df:	83 c4 10             	add    $0x10,%esp
+  e2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  e9:	0f 8f 23 ff ff ff    	jg     12 <grep+0x12>
+    }
+  }
+}
+  ef:	90                   	nop
+  f0:	90                   	nop
+  f1:	c9                   	leave
+  f2:	c3                   	ret
+
+000000f3 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  f3:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f7:	83 e4 f0             	and    $0xfffffff0,%esp
+  fa:	ff 71 fc             	push   -0x4(%ecx)
+  fd:	55                   	push   %ebp
+  fe:	89 e5                	mov    %esp,%ebp
+ 100:	53                   	push   %ebx
+ 101:	51                   	push   %ecx
+ 102:	83 ec 10             	sub    $0x10,%esp
+ 105:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+ 107:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 10a:	7f 17                	jg     123 <main+0x30>
+    printf(2, "usage: grep pattern [file ...]\n");
+ 10c:	83 ec 08             	sub    $0x8,%esp
+ 10f:	68 d4 0e 00 00       	push   $0xed4
+ 114:	6a 02                	push   $0x2
+ 116:	e8 ad 07 00 00       	call   8c8 <printf>
+ 11b:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 11e:	e8 39 05 00 00       	call   65c <exit>
+  }
+  pattern = argv[1];
+ 123:	8b 43 04             	mov    0x4(%ebx),%eax
+ 126:	8b 40 04             	mov    0x4(%eax),%eax
+ 129:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+  if(argc <= 2){
+ 12c:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 12f:	7f 15                	jg     146 <main+0x53>
+    grep(pattern, 0);
+ 131:	83 ec 08             	sub    $0x8,%esp
+ 134:	6a 00                	push   $0x0
+ 136:	ff 75 f0             	push   -0x10(%ebp)
+ 139:	e8 c2 fe ff ff       	call   0 <grep>
+ 13e:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 141:	e8 16 05 00 00       	call   65c <exit>
+  }
+
+  for(i = 2; i < argc; i++){
+ 146:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+ 14d:	eb 74                	jmp    1c3 <main+0xd0>
+    if((fd = open(argv[i], 0)) < 0){
+ 14f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 152:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 159:	8b 43 04             	mov    0x4(%ebx),%eax
+ 15c:	01 d0                	add    %edx,%eax
+ 15e:	8b 00                	mov    (%eax),%eax
+ 160:	83 ec 08             	sub    $0x8,%esp
+ 163:	6a 00                	push   $0x0
+ 165:	50                   	push   %eax
+ 166:	e8 31 05 00 00       	call   69c <open>
+ 16b:	83 c4 10             	add    $0x10,%esp
+ 16e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 171:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 175:	79 29                	jns    1a0 <main+0xad>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+ 177:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 181:	8b 43 04             	mov    0x4(%ebx),%eax
+ 184:	01 d0                	add    %edx,%eax
+ 186:	8b 00                	mov    (%eax),%eax
+ 188:	83 ec 04             	sub    $0x4,%esp
+ 18b:	50                   	push   %eax
+ 18c:	68 f4 0e 00 00       	push   $0xef4
+ 191:	6a 01                	push   $0x1
+ 193:	e8 30 07 00 00       	call   8c8 <printf>
+ 198:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 19b:	e8 bc 04 00 00       	call   65c <exit>
+    }
+    grep(pattern, fd);
+ 1a0:	83 ec 08             	sub    $0x8,%esp
+ 1a3:	ff 75 ec             	push   -0x14(%ebp)
+ 1a6:	ff 75 f0             	push   -0x10(%ebp)
+ 1a9:	e8 52 fe ff ff       	call   0 <grep>
+ 1ae:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 1b1:	83 ec 0c             	sub    $0xc,%esp
+ 1b4:	ff 75 ec             	push   -0x14(%ebp)
+ 1b7:	e8 c8 04 00 00       	call   684 <close>
+ 1bc:	83 c4 10             	add    $0x10,%esp
+  for(i = 2; i < argc; i++){
+ 1bf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c6:	3b 03                	cmp    (%ebx),%eax
+ 1c8:	7c 85                	jl     14f <main+0x5c>
+  }
+  exit();
+ 1ca:	e8 8d 04 00 00       	call   65c <exit>
+
+000001cf <match>:
+int matchhere(char*, char*);
+int matchstar(int, char*, char*);
+
+int
+match(char *re, char *text)
+{
+ 1cf:	55                   	push   %ebp
+ 1d0:	89 e5                	mov    %esp,%ebp
+ 1d2:	83 ec 08             	sub    $0x8,%esp
+  if(re[0] == '^')
+ 1d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d8:	0f b6 00             	movzbl (%eax),%eax
+ 1db:	3c 5e                	cmp    $0x5e,%al
+ 1dd:	75 17                	jne    1f6 <match+0x27>
+    return matchhere(re+1, text);
+ 1df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e2:	83 c0 01             	add    $0x1,%eax
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	ff 75 0c             	push   0xc(%ebp)
+ 1eb:	50                   	push   %eax
+ 1ec:	e8 38 00 00 00       	call   229 <matchhere>
+ 1f1:	83 c4 10             	add    $0x10,%esp
+ 1f4:	eb 31                	jmp    227 <match+0x58>
+  do{  // must look at empty string
+    if(matchhere(re, text))
+ 1f6:	83 ec 08             	sub    $0x8,%esp
+ 1f9:	ff 75 0c             	push   0xc(%ebp)
+ 1fc:	ff 75 08             	push   0x8(%ebp)
+ 1ff:	e8 25 00 00 00       	call   229 <matchhere>
+ 204:	83 c4 10             	add    $0x10,%esp
+ 207:	85 c0                	test   %eax,%eax
+ 209:	74 07                	je     212 <match+0x43>
+      return 1;
+ 20b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 210:	eb 15                	jmp    227 <match+0x58>
+  }while(*text++ != '\0');
+ 212:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 215:	8d 50 01             	lea    0x1(%eax),%edx
+ 218:	89 55 0c             	mov    %edx,0xc(%ebp)
+ 21b:	0f b6 00             	movzbl (%eax),%eax
+ 21e:	84 c0                	test   %al,%al
+ 220:	75 d4                	jne    1f6 <match+0x27>
+  return 0;
+ 222:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 227:	c9                   	leave
+ 228:	c3                   	ret
+
+00000229 <matchhere>:
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+ 229:	55                   	push   %ebp
+ 22a:	89 e5                	mov    %esp,%ebp
+ 22c:	83 ec 08             	sub    $0x8,%esp
+  if(re[0] == '\0')
+ 22f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 232:	0f b6 00             	movzbl (%eax),%eax
+ 235:	84 c0                	test   %al,%al
+ 237:	75 0a                	jne    243 <matchhere+0x1a>
+    return 1;
+ 239:	b8 01 00 00 00       	mov    $0x1,%eax
+ 23e:	e9 99 00 00 00       	jmp    2dc <matchhere+0xb3>
+  if(re[1] == '*')
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	83 c0 01             	add    $0x1,%eax
+ 249:	0f b6 00             	movzbl (%eax),%eax
+ 24c:	3c 2a                	cmp    $0x2a,%al
+ 24e:	75 21                	jne    271 <matchhere+0x48>
+    return matchstar(re[0], re+2, text);
+ 250:	8b 45 08             	mov    0x8(%ebp),%eax
+ 253:	8d 50 02             	lea    0x2(%eax),%edx
+ 256:	8b 45 08             	mov    0x8(%ebp),%eax
+ 259:	0f b6 00             	movzbl (%eax),%eax
+ 25c:	0f be c0             	movsbl %al,%eax
+ 25f:	83 ec 04             	sub    $0x4,%esp
+ 262:	ff 75 0c             	push   0xc(%ebp)
+ 265:	52                   	push   %edx
+ 266:	50                   	push   %eax
+ 267:	e8 72 00 00 00       	call   2de <matchstar>
+ 26c:	83 c4 10             	add    $0x10,%esp
+ 26f:	eb 6b                	jmp    2dc <matchhere+0xb3>
+  if(re[0] == '$' && re[1] == '\0')
+ 271:	8b 45 08             	mov    0x8(%ebp),%eax
+ 274:	0f b6 00             	movzbl (%eax),%eax
+ 277:	3c 24                	cmp    $0x24,%al
+ 279:	75 1d                	jne    298 <matchhere+0x6f>
+ 27b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27e:	83 c0 01             	add    $0x1,%eax
+ 281:	0f b6 00             	movzbl (%eax),%eax
+ 284:	84 c0                	test   %al,%al
+ 286:	75 10                	jne    298 <matchhere+0x6f>
+    return *text == '\0';
+ 288:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28b:	0f b6 00             	movzbl (%eax),%eax
+ 28e:	84 c0                	test   %al,%al
+ 290:	0f 94 c0             	sete   %al
+ 293:	0f b6 c0             	movzbl %al,%eax
+ 296:	eb 44                	jmp    2dc <matchhere+0xb3>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 298:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29b:	0f b6 00             	movzbl (%eax),%eax
+ 29e:	84 c0                	test   %al,%al
+ 2a0:	74 35                	je     2d7 <matchhere+0xae>
+ 2a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a5:	0f b6 00             	movzbl (%eax),%eax
+ 2a8:	3c 2e                	cmp    $0x2e,%al
+ 2aa:	74 10                	je     2bc <matchhere+0x93>
+ 2ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2af:	0f b6 10             	movzbl (%eax),%edx
+ 2b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b5:	0f b6 00             	movzbl (%eax),%eax
+ 2b8:	38 c2                	cmp    %al,%dl
+ 2ba:	75 1b                	jne    2d7 <matchhere+0xae>
+    return matchhere(re+1, text+1);
+ 2bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bf:	8d 50 01             	lea    0x1(%eax),%edx
+ 2c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c5:	83 c0 01             	add    $0x1,%eax
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	52                   	push   %edx
+ 2cc:	50                   	push   %eax
+ 2cd:	e8 57 ff ff ff       	call   229 <matchhere>
+ 2d2:	83 c4 10             	add    $0x10,%esp
+ 2d5:	eb 05                	jmp    2dc <matchhere+0xb3>
+  return 0;
+ 2d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2dc:	c9                   	leave
+ 2dd:	c3                   	ret
+
+000002de <matchstar>:
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+ 2de:	55                   	push   %ebp
+ 2df:	89 e5                	mov    %esp,%ebp
+ 2e1:	83 ec 08             	sub    $0x8,%esp
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 2e4:	83 ec 08             	sub    $0x8,%esp
+ 2e7:	ff 75 10             	push   0x10(%ebp)
+ 2ea:	ff 75 0c             	push   0xc(%ebp)
+ 2ed:	e8 37 ff ff ff       	call   229 <matchhere>
+ 2f2:	83 c4 10             	add    $0x10,%esp
+ 2f5:	85 c0                	test   %eax,%eax
+ 2f7:	74 07                	je     300 <matchstar+0x22>
+      return 1;
+ 2f9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2fe:	eb 29                	jmp    329 <matchstar+0x4b>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 300:	8b 45 10             	mov    0x10(%ebp),%eax
+ 303:	0f b6 00             	movzbl (%eax),%eax
+ 306:	84 c0                	test   %al,%al
+ 308:	74 1a                	je     324 <matchstar+0x46>
+ 30a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 30d:	8d 50 01             	lea    0x1(%eax),%edx
+ 310:	89 55 10             	mov    %edx,0x10(%ebp)
+ 313:	0f b6 00             	movzbl (%eax),%eax
+ 316:	0f be c0             	movsbl %al,%eax
+ 319:	39 45 08             	cmp    %eax,0x8(%ebp)
+ 31c:	74 c6                	je     2e4 <matchstar+0x6>
+ 31e:	83 7d 08 2e          	cmpl   $0x2e,0x8(%ebp)
+ 322:	74 c0                	je     2e4 <matchstar+0x6>
+  return 0;
+ 324:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 329:	c9                   	leave
+ 32a:	c3                   	ret
+
+0000032b <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 32b:	55                   	push   %ebp
+ 32c:	89 e5                	mov    %esp,%ebp
+ 32e:	57                   	push   %edi
+ 32f:	53                   	push   %ebx
+{
+ 330:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 333:	8b 55 10             	mov    0x10(%ebp),%edx
+ 336:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 339:	89 cb                	mov    %ecx,%ebx
+ 33b:	89 df                	mov    %ebx,%edi
+ 33d:	89 d1                	mov    %edx,%ecx
+ 33f:	fc                   	cld
+ 340:	f3 aa                	rep stos %al,%es:(%edi)
+ 342:	89 ca                	mov    %ecx,%edx
+ 344:	89 fb                	mov    %edi,%ebx
+ 346:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 349:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 34c:	90                   	nop
+ 34d:	5b                   	pop    %ebx
+ 34e:	5f                   	pop    %edi
+ 34f:	5d                   	pop    %ebp
+ 350:	c3                   	ret
+
+00000351 <strcpy>:
+{
+ 351:	55                   	push   %ebp
+ 352:	89 e5                	mov    %esp,%ebp
+ 354:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 357:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 35d:	90                   	nop
+ 35e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 361:	8d 42 01             	lea    0x1(%edx),%eax
+ 364:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 367:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 36d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 370:	0f b6 12             	movzbl (%edx),%edx
+ 373:	88 10                	mov    %dl,(%eax)
+ 375:	0f b6 00             	movzbl (%eax),%eax
+ 378:	84 c0                	test   %al,%al
+ 37a:	75 e2                	jne    35e <strcpy+0xd>
+  return os;
+ 37c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 37f:	c9                   	leave
+ 380:	c3                   	ret
+
+00000381 <strcmp>:
+{
+ 381:	55                   	push   %ebp
+ 382:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 384:	eb 08                	jmp    38e <strcmp+0xd>
+    p++, q++;
+ 386:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 38a:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 38e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 391:	0f b6 00             	movzbl (%eax),%eax
+ 394:	84 c0                	test   %al,%al
+ 396:	74 10                	je     3a8 <strcmp+0x27>
+ 398:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39b:	0f b6 10             	movzbl (%eax),%edx
+ 39e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3a1:	0f b6 00             	movzbl (%eax),%eax
+ 3a4:	38 c2                	cmp    %al,%dl
+ 3a6:	74 de                	je     386 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 3a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ab:	0f b6 00             	movzbl (%eax),%eax
+ 3ae:	0f b6 d0             	movzbl %al,%edx
+ 3b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3b4:	0f b6 00             	movzbl (%eax),%eax
+ 3b7:	0f b6 c0             	movzbl %al,%eax
+ 3ba:	29 c2                	sub    %eax,%edx
+ 3bc:	89 d0                	mov    %edx,%eax
+}
+ 3be:	5d                   	pop    %ebp
+ 3bf:	c3                   	ret
+
+000003c0 <strlen>:
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 3c6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3cd:	eb 04                	jmp    3d3 <strlen+0x13>
+ 3cf:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3d3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d9:	01 d0                	add    %edx,%eax
+ 3db:	0f b6 00             	movzbl (%eax),%eax
+ 3de:	84 c0                	test   %al,%al
+ 3e0:	75 ed                	jne    3cf <strlen+0xf>
+  return n;
+ 3e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3e5:	c9                   	leave
+ 3e6:	c3                   	ret
+
+000003e7 <memset>:
+{
+ 3e7:	55                   	push   %ebp
+ 3e8:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 3ea:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3ed:	50                   	push   %eax
+ 3ee:	ff 75 0c             	push   0xc(%ebp)
+ 3f1:	ff 75 08             	push   0x8(%ebp)
+ 3f4:	e8 32 ff ff ff       	call   32b <stosb>
+ 3f9:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 3fc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3ff:	c9                   	leave
+ 400:	c3                   	ret
+
+00000401 <strchr>:
+{
+ 401:	55                   	push   %ebp
+ 402:	89 e5                	mov    %esp,%ebp
+ 404:	83 ec 04             	sub    $0x4,%esp
+ 407:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40a:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 40d:	eb 14                	jmp    423 <strchr+0x22>
+    if(*s == c)
+ 40f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 412:	0f b6 00             	movzbl (%eax),%eax
+ 415:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 418:	75 05                	jne    41f <strchr+0x1e>
+      return (char*)s;
+ 41a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 41d:	eb 13                	jmp    432 <strchr+0x31>
+  for(; *s; s++)
+ 41f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 00             	movzbl (%eax),%eax
+ 429:	84 c0                	test   %al,%al
+ 42b:	75 e2                	jne    40f <strchr+0xe>
+  return 0;
+ 42d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 432:	c9                   	leave
+ 433:	c3                   	ret
+
+00000434 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 434:	55                   	push   %ebp
+ 435:	89 e5                	mov    %esp,%ebp
+ 437:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 43a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 441:	eb 42                	jmp    485 <gets+0x51>
+    cc = read(0, &c, 1);
+ 443:	83 ec 04             	sub    $0x4,%esp
+ 446:	6a 01                	push   $0x1
+ 448:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 44b:	50                   	push   %eax
+ 44c:	6a 00                	push   $0x0
+ 44e:	e8 21 02 00 00       	call   674 <read>
+ 453:	83 c4 10             	add    $0x10,%esp
+ 456:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 459:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 45d:	7e 33                	jle    492 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 45f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 462:	8d 50 01             	lea    0x1(%eax),%edx
+ 465:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 468:	89 c2                	mov    %eax,%edx
+ 46a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46d:	01 c2                	add    %eax,%edx
+ 46f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 473:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 475:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 479:	3c 0a                	cmp    $0xa,%al
+ 47b:	74 16                	je     493 <gets+0x5f>
+ 47d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 481:	3c 0d                	cmp    $0xd,%al
+ 483:	74 0e                	je     493 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 485:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 488:	83 c0 01             	add    $0x1,%eax
+ 48b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 48e:	7f b3                	jg     443 <gets+0xf>
+ 490:	eb 01                	jmp    493 <gets+0x5f>
+      break;
+ 492:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 493:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 496:	8b 45 08             	mov    0x8(%ebp),%eax
+ 499:	01 d0                	add    %edx,%eax
+ 49b:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 49e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4a1:	c9                   	leave
+ 4a2:	c3                   	ret
+
+000004a3 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4a3:	55                   	push   %ebp
+ 4a4:	89 e5                	mov    %esp,%ebp
+ 4a6:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4a9:	83 ec 08             	sub    $0x8,%esp
+ 4ac:	6a 00                	push   $0x0
+ 4ae:	ff 75 08             	push   0x8(%ebp)
+ 4b1:	e8 e6 01 00 00       	call   69c <open>
+ 4b6:	83 c4 10             	add    $0x10,%esp
+ 4b9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 4bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4c0:	79 07                	jns    4c9 <stat+0x26>
+    return -1;
+ 4c2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4c7:	eb 25                	jmp    4ee <stat+0x4b>
+  r = fstat(fd, st);
+ 4c9:	83 ec 08             	sub    $0x8,%esp
+ 4cc:	ff 75 0c             	push   0xc(%ebp)
+ 4cf:	ff 75 f4             	push   -0xc(%ebp)
+ 4d2:	e8 dd 01 00 00       	call   6b4 <fstat>
+ 4d7:	83 c4 10             	add    $0x10,%esp
+ 4da:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 4dd:	83 ec 0c             	sub    $0xc,%esp
+ 4e0:	ff 75 f4             	push   -0xc(%ebp)
+ 4e3:	e8 9c 01 00 00       	call   684 <close>
+ 4e8:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 4eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4ee:	c9                   	leave
+ 4ef:	c3                   	ret
+
+000004f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 4f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4fd:	eb 25                	jmp    524 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 4ff:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 502:	89 d0                	mov    %edx,%eax
+ 504:	c1 e0 02             	shl    $0x2,%eax
+ 507:	01 d0                	add    %edx,%eax
+ 509:	01 c0                	add    %eax,%eax
+ 50b:	89 c1                	mov    %eax,%ecx
+ 50d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 510:	8d 50 01             	lea    0x1(%eax),%edx
+ 513:	89 55 08             	mov    %edx,0x8(%ebp)
+ 516:	0f b6 00             	movzbl (%eax),%eax
+ 519:	0f be c0             	movsbl %al,%eax
+ 51c:	01 c8                	add    %ecx,%eax
+ 51e:	83 e8 30             	sub    $0x30,%eax
+ 521:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 524:	8b 45 08             	mov    0x8(%ebp),%eax
+ 527:	0f b6 00             	movzbl (%eax),%eax
+ 52a:	3c 2f                	cmp    $0x2f,%al
+ 52c:	7e 0a                	jle    538 <atoi+0x48>
+ 52e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 531:	0f b6 00             	movzbl (%eax),%eax
+ 534:	3c 39                	cmp    $0x39,%al
+ 536:	7e c7                	jle    4ff <atoi+0xf>
+  return n;
+ 538:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 53b:	c9                   	leave
+ 53c:	c3                   	ret
+
+0000053d <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 53d:	55                   	push   %ebp
+ 53e:	89 e5                	mov    %esp,%ebp
+ 540:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 543:	8b 45 08             	mov    0x8(%ebp),%eax
+ 546:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 549:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 54c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 54f:	eb 17                	jmp    568 <memmove+0x2b>
+    *dst++ = *src++;
+ 551:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 554:	8d 42 01             	lea    0x1(%edx),%eax
+ 557:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 55a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 55d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 560:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 563:	0f b6 12             	movzbl (%edx),%edx
+ 566:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 568:	8b 45 10             	mov    0x10(%ebp),%eax
+ 56b:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 56e:	89 55 10             	mov    %edx,0x10(%ebp)
+ 571:	85 c0                	test   %eax,%eax
+ 573:	7f dc                	jg     551 <memmove+0x14>
+  return vdst;
+ 575:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 578:	c9                   	leave
+ 579:	c3                   	ret
+
+0000057a <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 57a:	55                   	push   %ebp
+ 57b:	89 e5                	mov    %esp,%ebp
+ 57d:	57                   	push   %edi
+ 57e:	56                   	push   %esi
+ 57f:	83 ec 30             	sub    $0x30,%esp
+ 582:	8b 45 08             	mov    0x8(%ebp),%eax
+ 585:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 588:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 58b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 58e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 595:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 59c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 59f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5a2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 5a5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 5a8:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 5af:	e9 89 00 00 00       	jmp    63d <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 5b4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5b7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5ba:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 5be:	01 c0                	add    %eax,%eax
+ 5c0:	89 c6                	mov    %eax,%esi
+ 5c2:	89 d7                	mov    %edx,%edi
+ 5c4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 5c7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5ca:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5cd:	0f ad d0             	shrd   %cl,%edx,%eax
+ 5d0:	d3 ea                	shr    %cl,%edx
+ 5d2:	f6 c1 20             	test   $0x20,%cl
+ 5d5:	74 04                	je     5db <udiv64+0x61>
+ 5d7:	89 d0                	mov    %edx,%eax
+ 5d9:	31 d2                	xor    %edx,%edx
+ 5db:	83 e0 01             	and    $0x1,%eax
+ 5de:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 5e1:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 5e8:	89 f0                	mov    %esi,%eax
+ 5ea:	89 fa                	mov    %edi,%edx
+ 5ec:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 5ef:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 5f2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 5f5:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 5f8:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5fb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 600:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 603:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 606:	19 d1                	sbb    %edx,%ecx
+ 608:	72 2f                	jb     639 <udiv64+0xbf>
+      r -= d;
+ 60a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 60d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 612:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 615:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 618:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 61b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 620:	ba 00 00 00 00       	mov    $0x0,%edx
+ 625:	0f a5 c2             	shld   %cl,%eax,%edx
+ 628:	d3 e0                	shl    %cl,%eax
+ 62a:	f6 c1 20             	test   $0x20,%cl
+ 62d:	74 04                	je     633 <udiv64+0xb9>
+ 62f:	89 c2                	mov    %eax,%edx
+ 631:	31 c0                	xor    %eax,%eax
+ 633:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 636:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 639:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 63d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 641:	0f 89 6d ff ff ff    	jns    5b4 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 647:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 64a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 64d:	83 c4 30             	add    $0x30,%esp
+ 650:	5e                   	pop    %esi
+ 651:	5f                   	pop    %edi
+ 652:	5d                   	pop    %ebp
+ 653:	c3                   	ret
+
+00000654 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 654:	b8 01 00 00 00       	mov    $0x1,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <exit>:
+SYSCALL(exit)
+ 65c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <wait>:
+SYSCALL(wait)
+ 664:	b8 03 00 00 00       	mov    $0x3,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <pipe>:
+SYSCALL(pipe)
+ 66c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <read>:
+SYSCALL(read)
+ 674:	b8 05 00 00 00       	mov    $0x5,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <write>:
+SYSCALL(write)
+ 67c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <close>:
+SYSCALL(close)
+ 684:	b8 15 00 00 00       	mov    $0x15,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <kill>:
+SYSCALL(kill)
+ 68c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <exec>:
+SYSCALL(exec)
+ 694:	b8 07 00 00 00       	mov    $0x7,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <open>:
+SYSCALL(open)
+ 69c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <mknod>:
+SYSCALL(mknod)
+ 6a4:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <unlink>:
+SYSCALL(unlink)
+ 6ac:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <fstat>:
+SYSCALL(fstat)
+ 6b4:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <link>:
+SYSCALL(link)
+ 6bc:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <mkdir>:
+SYSCALL(mkdir)
+ 6c4:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <chdir>:
+SYSCALL(chdir)
+ 6cc:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <dup>:
+SYSCALL(dup)
+ 6d4:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <getpid>:
+SYSCALL(getpid)
+ 6dc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <sbrk>:
+SYSCALL(sbrk)
+ 6e4:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <sleep>:
+SYSCALL(sleep)
+ 6ec:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <uptime>:
+SYSCALL(uptime)
+ 6f4:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <find_digital_root>:
+SYSCALL(find_digital_root)
+ 6fc:	b8 16 00 00 00       	mov    $0x16,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 704:	b8 17 00 00 00       	mov    $0x17,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 70c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <copy_file>:
+SYSCALL(copy_file)
+ 714:	b8 19 00 00 00       	mov    $0x19,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <change_queue>:
+SYSCALL(change_queue)
+ 71c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 724:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 72c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <print_process_info>:
+SYSCALL(print_process_info)
+ 734:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 73c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 744:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 74c:	b8 20 00 00 00       	mov    $0x20,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 754:	b8 21 00 00 00       	mov    $0x21,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 75c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 764:	b8 23 00 00 00       	mov    $0x23,%eax
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 76c:	b8 24 00 00 00       	mov    $0x24,%eax
+ 771:	cd 40                	int    $0x40
+ 773:	c3                   	ret
+
+00000774 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 774:	b8 25 00 00 00       	mov    $0x25,%eax
+ 779:	cd 40                	int    $0x40
+ 77b:	c3                   	ret
+
+0000077c <set_affinity>:
+SYSCALL(set_affinity)
+ 77c:	b8 26 00 00 00       	mov    $0x26,%eax
+ 781:	cd 40                	int    $0x40
+ 783:	c3                   	ret
+
+00000784 <setsched>:
+SYSCALL(setsched)
+ 784:	b8 27 00 00 00       	mov    $0x27,%eax
+ 789:	cd 40                	int    $0x40
+ 78b:	c3                   	ret
+
+0000078c <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 78c:	b8 28 00 00 00       	mov    $0x28,%eax
+ 791:	cd 40                	int    $0x40
+ 793:	c3                   	ret
+
+00000794 <set_quantum>:
+SYSCALL(set_quantum)
+ 794:	b8 29 00 00 00       	mov    $0x29,%eax
+ 799:	cd 40                	int    $0x40
+ 79b:	c3                   	ret
+
+0000079c <schedtrace>:
+SYSCALL(schedtrace)
+ 79c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7a1:	cd 40                	int    $0x40
+ 7a3:	c3                   	ret
+
+000007a4 <getrusage>:
+SYSCALL(getrusage)
+ 7a4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7a9:	cd 40                	int    $0x40
+ 7ab:	c3                   	ret
+
+000007ac <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 7ac:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7b1:	cd 40                	int    $0x40
+ 7b3:	c3                   	ret
+
+000007b4 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 7b4:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 7b9:	cd 40                	int    $0x40
+ 7bb:	c3                   	ret
+
+000007bc <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 7bc:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 7c1:	cd 40                	int    $0x40
+ 7c3:	c3                   	ret
+
+000007c4 <futex_wait>:
+SYSCALL(futex_wait)
+ 7c4:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 7c9:	cd 40                	int    $0x40
+ 7cb:	c3                   	ret
+
+000007cc <futex_wake>:
+SYSCALL(futex_wake)
+ 7cc:	b8 30 00 00 00       	mov    $0x30,%eax
+ 7d1:	cd 40                	int    $0x40
+ 7d3:	c3                   	ret
+
+000007d4 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 7d4:	b8 31 00 00 00       	mov    $0x31,%eax
+ 7d9:	cd 40                	int    $0x40
+ 7db:	c3                   	ret
+
+000007dc <submit_batch>:
+SYSCALL(submit_batch)
+ 7dc:	b8 32 00 00 00       	mov    $0x32,%eax
+ 7e1:	cd 40                	int    $0x40
+ 7e3:	c3                   	ret
+
+000007e4 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 7e4:	b8 33 00 00 00       	mov    $0x33,%eax
+ 7e9:	cd 40                	int    $0x40
+ 7eb:	c3                   	ret
+
+000007ec <kmem_junk>:
+SYSCALL(kmem_junk)
+ 7ec:	b8 34 00 00 00       	mov    $0x34,%eax
+ 7f1:	cd 40                	int    $0x40
+ 7f3:	c3                   	ret
+
+000007f4 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 7f4:	55                   	push   %ebp
+ 7f5:	89 e5                	mov    %esp,%ebp
+ 7f7:	83 ec 18             	sub    $0x18,%esp
+ 7fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7fd:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	6a 01                	push   $0x1
+ 805:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 808:	50                   	push   %eax
+ 809:	ff 75 08             	push   0x8(%ebp)
+ 80c:	e8 6b fe ff ff       	call   67c <write>
+ 811:	83 c4 10             	add    $0x10,%esp
+}
+ 814:	90                   	nop
+ 815:	c9                   	leave
+ 816:	c3                   	ret
+
+00000817 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 817:	55                   	push   %ebp
+ 818:	89 e5                	mov    %esp,%ebp
+ 81a:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 81d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 824:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 828:	74 17                	je     841 <printint+0x2a>
+ 82a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 82e:	79 11                	jns    841 <printint+0x2a>
+    neg = 1;
+ 830:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 837:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 83a:	f7 d8                	neg    %eax
+ 83c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 83f:	eb 06                	jmp    847 <printint+0x30>
+  } else {
+    x = xx;
+ 841:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 844:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 847:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 84e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 851:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 854:	ba 00 00 00 00       	mov    $0x0,%edx
+ 859:	f7 f1                	div    %ecx
+ 85b:	89 d1                	mov    %edx,%ecx
+ 85d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 860:	8d 50 01             	lea    0x1(%eax),%edx
+ 863:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 866:	0f b6 91 84 13 00 00 	movzbl 0x1384(%ecx),%edx
+ 86d:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 871:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 874:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 877:	ba 00 00 00 00       	mov    $0x0,%edx
+ 87c:	f7 f1                	div    %ecx
+ 87e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 881:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 885:	75 c7                	jne    84e <printint+0x37>
+  if(neg)
+ 887:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 88b:	74 2d                	je     8ba <printint+0xa3>
+    buf[i++] = '-';
+ 88d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 890:	8d 50 01             	lea    0x1(%eax),%edx
+ 893:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 896:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 89b:	eb 1d                	jmp    8ba <printint+0xa3>
+    putc(fd, buf[i]);
+ 89d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 8a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a3:	01 d0                	add    %edx,%eax
+ 8a5:	0f b6 00             	movzbl (%eax),%eax
+ 8a8:	0f be c0             	movsbl %al,%eax
+ 8ab:	83 ec 08             	sub    $0x8,%esp
+ 8ae:	50                   	push   %eax
+ 8af:	ff 75 08             	push   0x8(%ebp)
+ 8b2:	e8 3d ff ff ff       	call   7f4 <putc>
+ 8b7:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 8ba:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 8be:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8c2:	79 d9                	jns    89d <printint+0x86>
+}
+ 8c4:	90                   	nop
+ 8c5:	90                   	nop
+ 8c6:	c9                   	leave
+ 8c7:	c3                   	ret
+
+000008c8 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8c8:	55                   	push   %ebp
+ 8c9:	89 e5                	mov    %esp,%ebp
+ 8cb:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 8ce:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 8d5:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 8d8:	83 c0 04             	add    $0x4,%eax
+ 8db:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8de:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 8e5:	e9 59 01 00 00       	jmp    a43 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 8ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8ed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8f0:	01 d0                	add    %edx,%eax
+ 8f2:	0f b6 00             	movzbl (%eax),%eax
+ 8f5:	0f be c0             	movsbl %al,%eax
+ 8f8:	25 ff 00 00 00       	and    $0xff,%eax
+ 8fd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 900:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 904:	75 2c                	jne    932 <printf+0x6a>
+      if(c == '%'){
+ 906:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 90a:	75 0c                	jne    918 <printf+0x50>
+        state = '%';
+ 90c:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 913:	e9 27 01 00 00       	jmp    a3f <printf+0x177>
+      } else {
+        putc(fd, c);
+ 918:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 91b:	0f be c0             	movsbl %al,%eax
+ 91e:	83 ec 08             	sub    $0x8,%esp
+ 921:	50                   	push   %eax
+ 922:	ff 75 08             	push   0x8(%ebp)
+ 925:	e8 ca fe ff ff       	call   7f4 <putc>
+ 92a:	83 c4 10             	add    $0x10,%esp
+ 92d:	e9 0d 01 00 00       	jmp    a3f <printf+0x177>
+      }
+    } else if(state == '%'){
+ 932:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 936:	0f 85 03 01 00 00    	jne    a3f <printf+0x177>
+      if(c == 'd'){
+ 93c:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 940:	75 1e                	jne    960 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 942:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 945:	8b 00                	mov    (%eax),%eax
+ 947:	6a 01                	push   $0x1
+ 949:	6a 0a                	push   $0xa
+ 94b:	50                   	push   %eax
+ 94c:	ff 75 08             	push   0x8(%ebp)
+ 94f:	e8 c3 fe ff ff       	call   817 <printint>
+ 954:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 957:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 95b:	e9 d8 00 00 00       	jmp    a38 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 960:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 964:	74 06                	je     96c <printf+0xa4>
+ 966:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 96a:	75 1e                	jne    98a <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 96c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 96f:	8b 00                	mov    (%eax),%eax
+ 971:	6a 00                	push   $0x0
+ 973:	6a 10                	push   $0x10
+ 975:	50                   	push   %eax
+ 976:	ff 75 08             	push   0x8(%ebp)
+ 979:	e8 99 fe ff ff       	call   817 <printint>
+ 97e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 981:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 985:	e9 ae 00 00 00       	jmp    a38 <printf+0x170>
+      } else if(c == 's'){
+ 98a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 98e:	75 43                	jne    9d3 <printf+0x10b>
+        s = (char*)*ap;
+ 990:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 993:	8b 00                	mov    (%eax),%eax
+ 995:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 998:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 99c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9a0:	75 25                	jne    9c7 <printf+0xff>
+          s = "(null)";
+ 9a2:	c7 45 f4 0a 0f 00 00 	movl   $0xf0a,-0xc(%ebp)
+        while(*s != 0){
+ 9a9:	eb 1c                	jmp    9c7 <printf+0xff>
+          putc(fd, *s);
+ 9ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ae:	0f b6 00             	movzbl (%eax),%eax
+ 9b1:	0f be c0             	movsbl %al,%eax
+ 9b4:	83 ec 08             	sub    $0x8,%esp
+ 9b7:	50                   	push   %eax
+ 9b8:	ff 75 08             	push   0x8(%ebp)
+ 9bb:	e8 34 fe ff ff       	call   7f4 <putc>
+ 9c0:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 9c3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 9c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ca:	0f b6 00             	movzbl (%eax),%eax
+ 9cd:	84 c0                	test   %al,%al
+ 9cf:	75 da                	jne    9ab <printf+0xe3>
+ 9d1:	eb 65                	jmp    a38 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 9d3:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 9d7:	75 1d                	jne    9f6 <printf+0x12e>
+        putc(fd, *ap);
+ 9d9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9dc:	8b 00                	mov    (%eax),%eax
+ 9de:	0f be c0             	movsbl %al,%eax
+ 9e1:	83 ec 08             	sub    $0x8,%esp
+ 9e4:	50                   	push   %eax
+ 9e5:	ff 75 08             	push   0x8(%ebp)
+ 9e8:	e8 07 fe ff ff       	call   7f4 <putc>
+ 9ed:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9f0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9f4:	eb 42                	jmp    a38 <printf+0x170>
+      } else if(c == '%'){
+ 9f6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9fa:	75 17                	jne    a13 <printf+0x14b>
+        putc(fd, c);
+ 9fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9ff:	0f be c0             	movsbl %al,%eax
+ a02:	83 ec 08             	sub    $0x8,%esp
+ a05:	50                   	push   %eax
+ a06:	ff 75 08             	push   0x8(%ebp)
+ a09:	e8 e6 fd ff ff       	call   7f4 <putc>
+ a0e:	83 c4 10             	add    $0x10,%esp
+ a11:	eb 25                	jmp    a38 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ a13:	83 ec 08             	sub    $0x8,%esp
+ a16:	6a 25                	push   $0x25
+ a18:	ff 75 08             	push   0x8(%ebp)
+ a1b:	e8 d4 fd ff ff       	call   7f4 <putc>
+ a20:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ a23:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a26:	0f be c0             	movsbl %al,%eax
+ a29:	83 ec 08             	sub    $0x8,%esp
+ a2c:	50                   	push   %eax
+ a2d:	ff 75 08             	push   0x8(%ebp)
+ a30:	e8 bf fd ff ff       	call   7f4 <putc>
+ a35:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a38:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a3f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a43:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a46:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a49:	01 d0                	add    %edx,%eax
+ a4b:	0f b6 00             	movzbl (%eax),%eax
+ a4e:	84 c0                	test   %al,%al
+ a50:	0f 85 94 fe ff ff    	jne    8ea <printf+0x22>
+    }
+  }
+}
+ a56:	90                   	nop
+ a57:	90                   	nop
+ a58:	c9                   	leave
+ a59:	c3                   	ret
+
+00000a5a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a5a:	55                   	push   %ebp
+ a5b:	89 e5                	mov    %esp,%ebp
+ a5d:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ a60:	8b 45 08             	mov    0x8(%ebp),%eax
+ a63:	83 e8 08             	sub    $0x8,%eax
+ a66:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a69:	a1 a8 17 00 00       	mov    0x17a8,%eax
+ a6e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a71:	eb 24                	jmp    a97 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a73:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a76:	8b 00                	mov    (%eax),%eax
+ a78:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a7b:	72 12                	jb     a8f <free+0x35>
+ a7d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a80:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a83:	72 24                	jb     aa9 <free+0x4f>
+ a85:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a88:	8b 00                	mov    (%eax),%eax
+ a8a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a8d:	72 1a                	jb     aa9 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a8f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a92:	8b 00                	mov    (%eax),%eax
+ a94:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a97:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a9a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a9d:	73 d4                	jae    a73 <free+0x19>
+ a9f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa2:	8b 00                	mov    (%eax),%eax
+ aa4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ aa7:	73 ca                	jae    a73 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ aa9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aac:	8b 40 04             	mov    0x4(%eax),%eax
+ aaf:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ab6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ab9:	01 c2                	add    %eax,%edx
+ abb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ abe:	8b 00                	mov    (%eax),%eax
+ ac0:	39 c2                	cmp    %eax,%edx
+ ac2:	75 24                	jne    ae8 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ ac4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ac7:	8b 50 04             	mov    0x4(%eax),%edx
+ aca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ acd:	8b 00                	mov    (%eax),%eax
+ acf:	8b 40 04             	mov    0x4(%eax),%eax
+ ad2:	01 c2                	add    %eax,%edx
+ ad4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ad7:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ada:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ add:	8b 00                	mov    (%eax),%eax
+ adf:	8b 10                	mov    (%eax),%edx
+ ae1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ae4:	89 10                	mov    %edx,(%eax)
+ ae6:	eb 0a                	jmp    af2 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ ae8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aeb:	8b 10                	mov    (%eax),%edx
+ aed:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ af0:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ af2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af5:	8b 40 04             	mov    0x4(%eax),%eax
+ af8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ aff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b02:	01 d0                	add    %edx,%eax
+ b04:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b07:	75 20                	jne    b29 <free+0xcf>
+    p->s.size += bp->s.size;
+ b09:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0c:	8b 50 04             	mov    0x4(%eax),%edx
+ b0f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b12:	8b 40 04             	mov    0x4(%eax),%eax
+ b15:	01 c2                	add    %eax,%edx
+ b17:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b1a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ b1d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b20:	8b 10                	mov    (%eax),%edx
+ b22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b25:	89 10                	mov    %edx,(%eax)
+ b27:	eb 08                	jmp    b31 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ b29:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b2c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ b2f:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b31:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b34:	a3 a8 17 00 00       	mov    %eax,0x17a8
+}
+ b39:	90                   	nop
+ b3a:	c9                   	leave
+ b3b:	c3                   	ret
+
+00000b3c <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ b3c:	55                   	push   %ebp
+ b3d:	89 e5                	mov    %esp,%ebp
+ b3f:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ b42:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ b49:	77 07                	ja     b52 <morecore+0x16>
+    nu = 4096;
+ b4b:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ b52:	8b 45 08             	mov    0x8(%ebp),%eax
+ b55:	c1 e0 03             	shl    $0x3,%eax
+ b58:	83 ec 0c             	sub    $0xc,%esp
+ b5b:	50                   	push   %eax
+ b5c:	e8 83 fb ff ff       	call   6e4 <sbrk>
+ b61:	83 c4 10             	add    $0x10,%esp
+ b64:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ b67:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b6b:	75 07                	jne    b74 <morecore+0x38>
+    return 0;
+ b6d:	b8 00 00 00 00       	mov    $0x0,%eax
+ b72:	eb 26                	jmp    b9a <morecore+0x5e>
+  hp = (Header*)p;
+ b74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b77:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ b7a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b7d:	8b 55 08             	mov    0x8(%ebp),%edx
+ b80:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ b83:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b86:	83 c0 08             	add    $0x8,%eax
+ b89:	83 ec 0c             	sub    $0xc,%esp
+ b8c:	50                   	push   %eax
+ b8d:	e8 c8 fe ff ff       	call   a5a <free>
+ b92:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ b95:	a1 a8 17 00 00       	mov    0x17a8,%eax
+}
+ b9a:	c9                   	leave
+ b9b:	c3                   	ret
+
+00000b9c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b9c:	55                   	push   %ebp
+ b9d:	89 e5                	mov    %esp,%ebp
+ b9f:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ba2:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba5:	83 c0 07             	add    $0x7,%eax
+ ba8:	c1 e8 03             	shr    $0x3,%eax
+ bab:	83 c0 01             	add    $0x1,%eax
+ bae:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ bb1:	a1 a8 17 00 00       	mov    0x17a8,%eax
+ bb6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ bb9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ bbd:	75 23                	jne    be2 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ bbf:	c7 45 f0 a0 17 00 00 	movl   $0x17a0,-0x10(%ebp)
+ bc6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bc9:	a3 a8 17 00 00       	mov    %eax,0x17a8
+ bce:	a1 a8 17 00 00       	mov    0x17a8,%eax
+ bd3:	a3 a0 17 00 00       	mov    %eax,0x17a0
+    base.s.size = 0;
+ bd8:	c7 05 a4 17 00 00 00 	movl   $0x0,0x17a4
+ bdf:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ be2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ be5:	8b 00                	mov    (%eax),%eax
+ be7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ bea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bed:	8b 40 04             	mov    0x4(%eax),%eax
+ bf0:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ bf3:	72 4d                	jb     c42 <malloc+0xa6>
+      if(p->s.size == nunits)
+ bf5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf8:	8b 40 04             	mov    0x4(%eax),%eax
+ bfb:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ bfe:	75 0c                	jne    c0c <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ c00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c03:	8b 10                	mov    (%eax),%edx
+ c05:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c08:	89 10                	mov    %edx,(%eax)
+ c0a:	eb 26                	jmp    c32 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ c0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c0f:	8b 40 04             	mov    0x4(%eax),%eax
+ c12:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ c15:	89 c2                	mov    %eax,%edx
+ c17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c1a:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ c1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c20:	8b 40 04             	mov    0x4(%eax),%eax
+ c23:	c1 e0 03             	shl    $0x3,%eax
+ c26:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ c29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c2c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ c2f:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ c32:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c35:	a3 a8 17 00 00       	mov    %eax,0x17a8
+      return (void*)(p + 1);
+ c3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c3d:	83 c0 08             	add    $0x8,%eax
+ c40:	eb 3b                	jmp    c7d <malloc+0xe1>
+    }
+    if(p == freep)
+ c42:	a1 a8 17 00 00       	mov    0x17a8,%eax
+ c47:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c4a:	75 1e                	jne    c6a <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ c4c:	83 ec 0c             	sub    $0xc,%esp
+ c4f:	ff 75 ec             	push   -0x14(%ebp)
+ c52:	e8 e5 fe ff ff       	call   b3c <morecore>
+ c57:	83 c4 10             	add    $0x10,%esp
+ c5a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c5d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c61:	75 07                	jne    c6a <malloc+0xce>
+        return 0;
+ c63:	b8 00 00 00 00       	mov    $0x0,%eax
+ c68:	eb 13                	jmp    c7d <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c6d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c73:	8b 00                	mov    (%eax),%eax
+ c75:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c78:	e9 6d ff ff ff       	jmp    bea <malloc+0x4e>
+  }
+}
+ c7d:	c9                   	leave
+ c7e:	c3                   	ret
+
+00000c7f <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ c7f:	55                   	push   %ebp
+ c80:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ c82:	8b 45 08             	mov    0x8(%ebp),%eax
+ c85:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c8b:	90                   	nop
+ c8c:	5d                   	pop    %ebp
+ c8d:	c3                   	ret
+
+00000c8e <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ c8e:	55                   	push   %ebp
+ c8f:	89 e5                	mov    %esp,%ebp
+ c91:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ c94:	8b 55 08             	mov    0x8(%ebp),%edx
+ c97:	b8 00 00 00 00       	mov    $0x0,%eax
+ c9c:	b9 01 00 00 00       	mov    $0x1,%ecx
+ ca1:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ ca5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ca8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cac:	74 3b                	je     ce9 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ cae:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ cb2:	74 2d                	je     ce1 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ cb4:	8b 55 08             	mov    0x8(%ebp),%edx
+ cb7:	b8 02 00 00 00       	mov    $0x2,%eax
+ cbc:	87 02                	xchg   %eax,(%edx)
+ cbe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ cc1:	eb 1e                	jmp    ce1 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+ cc6:	83 ec 08             	sub    $0x8,%esp
+ cc9:	6a 02                	push   $0x2
+ ccb:	50                   	push   %eax
+ ccc:	e8 f3 fa ff ff       	call   7c4 <futex_wait>
+ cd1:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ cd4:	8b 55 08             	mov    0x8(%ebp),%edx
+ cd7:	b8 02 00 00 00       	mov    $0x2,%eax
+ cdc:	87 02                	xchg   %eax,(%edx)
+ cde:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ ce1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ce5:	75 dc                	jne    cc3 <mutex_lock+0x35>
+ ce7:	eb 01                	jmp    cea <mutex_lock+0x5c>
+    return;
+ ce9:	90                   	nop
+  }
+}
+ cea:	c9                   	leave
+ ceb:	c3                   	ret
+
+00000cec <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ cec:	55                   	push   %ebp
+ ced:	89 e5                	mov    %esp,%ebp
+ cef:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+ cf5:	ba 01 00 00 00       	mov    $0x1,%edx
+ cfa:	f7 da                	neg    %edx
+ cfc:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ d00:	83 fa 01             	cmp    $0x1,%edx
+ d03:	74 1a                	je     d1f <mutex_unlock+0x33>
+    m->state = 0;
+ d05:	8b 45 08             	mov    0x8(%ebp),%eax
+ d08:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ d0e:	8b 45 08             	mov    0x8(%ebp),%eax
+ d11:	83 ec 08             	sub    $0x8,%esp
+ d14:	6a 01                	push   $0x1
+ d16:	50                   	push   %eax
+ d17:	e8 b0 fa ff ff       	call   7cc <futex_wake>
+ d1c:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ d1f:	90                   	nop
+ d20:	c9                   	leave
+ d21:	c3                   	ret
+
+00000d22 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ d22:	55                   	push   %ebp
+ d23:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ d25:	8b 45 08             	mov    0x8(%ebp),%eax
+ d28:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ d2e:	8b 45 08             	mov    0x8(%ebp),%eax
+ d31:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ d38:	90                   	nop
+ d39:	5d                   	pop    %ebp
+ d3a:	c3                   	ret
+
+00000d3b <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ d3b:	55                   	push   %ebp
+ d3c:	89 e5                	mov    %esp,%ebp
+ d3e:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ d41:	8b 45 08             	mov    0x8(%ebp),%eax
+ d44:	83 c0 04             	add    $0x4,%eax
+ d47:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+ d4e:	83 ec 08             	sub    $0x8,%esp
+ d51:	ff 75 0c             	push   0xc(%ebp)
+ d54:	50                   	push   %eax
+ d55:	e8 6a fa ff ff       	call   7c4 <futex_wait>
+ d5a:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ d5d:	8b 45 08             	mov    0x8(%ebp),%eax
+ d60:	83 c0 04             	add    $0x4,%eax
+ d63:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ d67:	90                   	nop
+ d68:	c9                   	leave
+ d69:	c3                   	ret
+
+00000d6a <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ d6a:	55                   	push   %ebp
+ d6b:	89 e5                	mov    %esp,%ebp
+ d6d:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ d70:	8b 45 08             	mov    0x8(%ebp),%eax
+ d73:	8b 00                	mov    (%eax),%eax
+ d75:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ d78:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d7c:	78 17                	js     d95 <rwlock_rdlock+0x2b>
+ d7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d81:	83 c0 01             	add    $0x1,%eax
+ d84:	89 c1                	mov    %eax,%ecx
+ d86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d89:	8b 55 08             	mov    0x8(%ebp),%edx
+ d8c:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ d90:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d93:	74 19                	je     dae <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ d95:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d99:	79 d5                	jns    d70 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ d9b:	83 ec 08             	sub    $0x8,%esp
+ d9e:	ff 75 f4             	push   -0xc(%ebp)
+ da1:	ff 75 08             	push   0x8(%ebp)
+ da4:	e8 92 ff ff ff       	call   d3b <rwlock_sleep>
+ da9:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ dac:	eb c2                	jmp    d70 <rwlock_rdlock+0x6>
+      return;
+ dae:	90                   	nop
+  }
+}
+ daf:	c9                   	leave
+ db0:	c3                   	ret
+
+00000db1 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ db1:	55                   	push   %ebp
+ db2:	89 e5                	mov    %esp,%ebp
+ db4:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ db7:	eb 11                	jmp    dca <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ db9:	83 ec 08             	sub    $0x8,%esp
+ dbc:	ff 75 f4             	push   -0xc(%ebp)
+ dbf:	ff 75 08             	push   0x8(%ebp)
+ dc2:	e8 74 ff ff ff       	call   d3b <rwlock_sleep>
+ dc7:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ dca:	8b 55 08             	mov    0x8(%ebp),%edx
+ dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+ dd2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ dd7:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ ddb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ dde:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ de2:	75 d5                	jne    db9 <rwlock_wrlock+0x8>
+}
+ de4:	90                   	nop
+ de5:	90                   	nop
+ de6:	c9                   	leave
+ de7:	c3                   	ret
+
+00000de8 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ de8:	55                   	push   %ebp
+ de9:	89 e5                	mov    %esp,%ebp
+ deb:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ dee:	8b 45 08             	mov    0x8(%ebp),%eax
+ df1:	8b 00                	mov    (%eax),%eax
+ df3:	85 c0                	test   %eax,%eax
+ df5:	79 0c                	jns    e03 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ df7:	8b 45 08             	mov    0x8(%ebp),%eax
+ dfa:	ba 00 00 00 00       	mov    $0x0,%edx
+ dff:	87 10                	xchg   %edx,(%eax)
+ e01:	eb 18                	jmp    e1b <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ e03:	8b 55 08             	mov    0x8(%ebp),%edx
+ e06:	b8 01 00 00 00       	mov    $0x1,%eax
+ e0b:	f7 d8                	neg    %eax
+ e0d:	89 c1                	mov    %eax,%ecx
+ e0f:	89 c8                	mov    %ecx,%eax
+ e11:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ e15:	01 c8                	add    %ecx,%eax
+ e17:	85 c0                	test   %eax,%eax
+ e19:	75 20                	jne    e3b <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ e1b:	8b 45 08             	mov    0x8(%ebp),%eax
+ e1e:	8b 40 04             	mov    0x4(%eax),%eax
+ e21:	85 c0                	test   %eax,%eax
+ e23:	74 17                	je     e3c <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ e25:	8b 45 08             	mov    0x8(%ebp),%eax
+ e28:	83 ec 08             	sub    $0x8,%esp
+ e2b:	68 ff ff ff 7f       	push   $0x7fffffff
+ e30:	50                   	push   %eax
+ e31:	e8 96 f9 ff ff       	call   7cc <futex_wake>
+ e36:	83 c4 10             	add    $0x10,%esp
+ e39:	eb 01                	jmp    e3c <rwlock_unlock+0x54>
+    return;
+ e3b:	90                   	nop
+}
+ e3c:	c9                   	leave
+ e3d:	c3                   	ret
+
+00000e3e <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ e3e:	55                   	push   %ebp
+ e3f:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ e41:	8b 45 08             	mov    0x8(%ebp),%eax
+ e44:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ e4a:	90                   	nop
+ e4b:	5d                   	pop    %ebp
+ e4c:	c3                   	ret
+
+00000e4d <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ e4d:	55                   	push   %ebp
+ e4e:	89 e5                	mov    %esp,%ebp
+ e50:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ e53:	8b 45 08             	mov    0x8(%ebp),%eax
+ e56:	8b 00                	mov    (%eax),%eax
+ e58:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ e5b:	83 ec 0c             	sub    $0xc,%esp
+ e5e:	ff 75 0c             	push   0xc(%ebp)
+ e61:	e8 86 fe ff ff       	call   cec <mutex_unlock>
+ e66:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ e69:	8b 45 08             	mov    0x8(%ebp),%eax
+ e6c:	83 ec 08             	sub    $0x8,%esp
+ e6f:	ff 75 f4             	push   -0xc(%ebp)
+ e72:	50                   	push   %eax
+ e73:	e8 4c f9 ff ff       	call   7c4 <futex_wait>
+ e78:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ e7b:	83 ec 0c             	sub    $0xc,%esp
+ e7e:	ff 75 0c             	push   0xc(%ebp)
+ e81:	e8 08 fe ff ff       	call   c8e <mutex_lock>
+ e86:	83 c4 10             	add    $0x10,%esp
+}
+ e89:	90                   	nop
+ e8a:	c9                   	leave
+ e8b:	c3                   	ret
+
+00000e8c <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ e8c:	55                   	push   %ebp
+ e8d:	89 e5                	mov    %esp,%ebp
+ e8f:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ e92:	8b 45 08             	mov    0x8(%ebp),%eax
+ e95:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ e99:	8b 45 08             	mov    0x8(%ebp),%eax
+ e9c:	83 ec 08             	sub    $0x8,%esp
+ e9f:	6a 01                	push   $0x1
+ ea1:	50                   	push   %eax
+ ea2:	e8 25 f9 ff ff       	call   7cc <futex_wake>
+ ea7:	83 c4 10             	add    $0x10,%esp
+}
+ eaa:	90                   	nop
+ eab:	c9                   	leave
+ eac:	c3                   	ret
+
+00000ead <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ ead:	55                   	push   %ebp
+ eae:	89 e5                	mov    %esp,%ebp
+ eb0:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ eb3:	8b 45 08             	mov    0x8(%ebp),%eax
+ eb6:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ eba:	8b 45 08             	mov    0x8(%ebp),%eax
+ ebd:	83 ec 08             	sub    $0x8,%esp
+ ec0:	68 ff ff ff 7f       	push   $0x7fffffff
+ ec5:	50                   	push   %eax
+ ec6:	e8 01 f9 ff ff       	call   7cc <futex_wake>
+ ecb:	83 c4 10             	add    $0x10,%esp
+}
+ ece:	90                   	nop
+ ecf:	c9                   	leave
+ ed0:	c3                   	ret
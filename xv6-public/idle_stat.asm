@@ -0,0 +1,1896 @@
+
+_idle_stat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rdtsc>:
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+   6:	0f 31                	rdtsc
+   8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+   b:	89 55 fc             	mov    %edx,-0x4(%ebp)
+   e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  11:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  14:	c9                   	leave
+  15:	c3                   	ret
+
+00000016 <percent>:
+{
+  16:	55                   	push   %ebp
+  17:	89 e5                	mov    %esp,%ebp
+  19:	53                   	push   %ebx
+  1a:	83 ec 14             	sub    $0x14,%esp
+  1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  20:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  26:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  29:	8b 45 10             	mov    0x10(%ebp),%eax
+  2c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  32:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    while (whole > 0xffffffff)
+  35:	eb 24                	jmp    5b <percent+0x45>
+        part >>= 1;
+  37:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  3a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  3d:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+  41:	d1 ea                	shr    %edx
+  43:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  46:	89 55 f4             	mov    %edx,-0xc(%ebp)
+        whole >>= 1;
+  49:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  4c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  4f:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+  53:	d1 ea                	shr    %edx
+  55:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  58:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    while (whole > 0xffffffff)
+  5b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  5f:	77 d6                	ja     37 <percent+0x21>
+    if (whole == 0)
+  61:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  64:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  67:	09 d0                	or     %edx,%eax
+  69:	85 c0                	test   %eax,%eax
+  6b:	75 07                	jne    74 <percent+0x5e>
+        return 0;
+  6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  72:	eb 2c                	jmp    a0 <percent+0x8a>
+    return udiv64(part * 100, whole);
+  74:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  7a:	6b d0 64             	imul   $0x64,%eax,%edx
+  7d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80:	6b c0 00             	imul   $0x0,%eax,%eax
+  83:	8d 1c 02             	lea    (%edx,%eax,1),%ebx
+  86:	b8 64 00 00 00       	mov    $0x64,%eax
+  8b:	f7 65 f0             	mull   -0x10(%ebp)
+  8e:	01 d3                	add    %edx,%ebx
+  90:	89 da                	mov    %ebx,%edx
+  92:	83 ec 04             	sub    $0x4,%esp
+  95:	51                   	push   %ecx
+  96:	52                   	push   %edx
+  97:	50                   	push   %eax
+  98:	e8 90 03 00 00       	call   42d <udiv64>
+  9d:	83 c4 10             	add    $0x10,%esp
+}
+  a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+
+000000a5 <main>:
+{
+  a5:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  a9:	83 e4 f0             	and    $0xfffffff0,%esp
+  ac:	ff 71 fc             	push   -0x4(%ecx)
+  af:	55                   	push   %ebp
+  b0:	89 e5                	mov    %esp,%ebp
+  b2:	53                   	push   %ebx
+  b3:	51                   	push   %ecx
+  b4:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+  ba:	89 c8                	mov    %ecx,%eax
+    int ncpu, i, interval = 100;
+  bc:	c7 45 ec 64 00 00 00 	movl   $0x64,-0x14(%ebp)
+    if (argc > 1)
+  c3:	83 38 01             	cmpl   $0x1,(%eax)
+  c6:	7e 17                	jle    df <main+0x3a>
+        interval = atoi(argv[1]);
+  c8:	8b 40 04             	mov    0x4(%eax),%eax
+  cb:	83 c0 04             	add    $0x4,%eax
+  ce:	8b 00                	mov    (%eax),%eax
+  d0:	83 ec 0c             	sub    $0xc,%esp
+  d3:	50                   	push   %eax
+  d4:	e8 ca 02 00 00       	call   3a3 <atoi>
+  d9:	83 c4 10             	add    $0x10,%esp
+  dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    for (ncpu = 0; ncpu < MAXCPU; ncpu++)
+  df:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  e6:	eb 22                	jmp    10a <main+0x65>
+        if (get_idle_cycles(ncpu, &before[ncpu]) < 0)
+  e8:	8d 45 98             	lea    -0x68(%ebp),%eax
+  eb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  ee:	c1 e2 03             	shl    $0x3,%edx
+  f1:	01 d0                	add    %edx,%eax
+  f3:	83 ec 08             	sub    $0x8,%esp
+  f6:	50                   	push   %eax
+  f7:	ff 75 f4             	push   -0xc(%ebp)
+  fa:	e8 40 05 00 00       	call   63f <get_idle_cycles>
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	85 c0                	test   %eax,%eax
+ 104:	78 0c                	js     112 <main+0x6d>
+    for (ncpu = 0; ncpu < MAXCPU; ncpu++)
+ 106:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 10a:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 10e:	7e d8                	jle    e8 <main+0x43>
+ 110:	eb 01                	jmp    113 <main+0x6e>
+            break;
+ 112:	90                   	nop
+    start = rdtsc();
+ 113:	e8 e8 fe ff ff       	call   0 <rdtsc>
+ 118:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 11b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    sleep(interval);
+ 11e:	83 ec 0c             	sub    $0xc,%esp
+ 121:	ff 75 ec             	push   -0x14(%ebp)
+ 124:	e8 76 04 00 00       	call   59f <sleep>
+ 129:	83 c4 10             	add    $0x10,%esp
+    elapsed = rdtsc() - start;
+ 12c:	e8 cf fe ff ff       	call   0 <rdtsc>
+ 131:	2b 45 e0             	sub    -0x20(%ebp),%eax
+ 134:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+ 137:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 13a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    for (i = 0; i < ncpu; i++)
+ 13d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 144:	eb 21                	jmp    167 <main+0xc2>
+        get_idle_cycles(i, &after[i]);
+ 146:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+ 14c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ 14f:	c1 e2 03             	shl    $0x3,%edx
+ 152:	01 d0                	add    %edx,%eax
+ 154:	83 ec 08             	sub    $0x8,%esp
+ 157:	50                   	push   %eax
+ 158:	ff 75 f0             	push   -0x10(%ebp)
+ 15b:	e8 df 04 00 00       	call   63f <get_idle_cycles>
+ 160:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < ncpu; i++)
+ 163:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 167:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 16a:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+ 16d:	7c d7                	jl     146 <main+0xa1>
+    printf(1, "CPU\tIdle\n");
+ 16f:	83 ec 08             	sub    $0x8,%esp
+ 172:	68 84 0d 00 00       	push   $0xd84
+ 177:	6a 01                	push   $0x1
+ 179:	e8 fd 05 00 00       	call   77b <printf>
+ 17e:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < ncpu; i++)
+ 181:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 188:	eb 47                	jmp    1d1 <main+0x12c>
+        printf(1, "%d\t%d%%\n", i, percent(after[i] - before[i], elapsed));
+ 18a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 18d:	8b 94 c5 5c ff ff ff 	mov    -0xa4(%ebp,%eax,8),%edx
+ 194:	8b 84 c5 58 ff ff ff 	mov    -0xa8(%ebp,%eax,8),%eax
+ 19b:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+ 19e:	8b 5c cd 9c          	mov    -0x64(%ebp,%ecx,8),%ebx
+ 1a2:	8b 4c cd 98          	mov    -0x68(%ebp,%ecx,8),%ecx
+ 1a6:	29 c8                	sub    %ecx,%eax
+ 1a8:	19 da                	sbb    %ebx,%edx
+ 1aa:	ff 75 dc             	push   -0x24(%ebp)
+ 1ad:	ff 75 d8             	push   -0x28(%ebp)
+ 1b0:	52                   	push   %edx
+ 1b1:	50                   	push   %eax
+ 1b2:	e8 5f fe ff ff       	call   16 <percent>
+ 1b7:	83 c4 10             	add    $0x10,%esp
+ 1ba:	50                   	push   %eax
+ 1bb:	ff 75 f0             	push   -0x10(%ebp)
+ 1be:	68 8e 0d 00 00       	push   $0xd8e
+ 1c3:	6a 01                	push   $0x1
+ 1c5:	e8 b1 05 00 00       	call   77b <printf>
+ 1ca:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < ncpu; i++)
+ 1cd:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 1d1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1d4:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+ 1d7:	7c b1                	jl     18a <main+0xe5>
+    exit();
+ 1d9:	e8 31 03 00 00       	call   50f <exit>
+
+000001de <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 1de:	55                   	push   %ebp
+ 1df:	89 e5                	mov    %esp,%ebp
+ 1e1:	57                   	push   %edi
+ 1e2:	53                   	push   %ebx
+{
+ 1e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1e6:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ec:	89 cb                	mov    %ecx,%ebx
+ 1ee:	89 df                	mov    %ebx,%edi
+ 1f0:	89 d1                	mov    %edx,%ecx
+ 1f2:	fc                   	cld
+ 1f3:	f3 aa                	rep stos %al,%es:(%edi)
+ 1f5:	89 ca                	mov    %ecx,%edx
+ 1f7:	89 fb                	mov    %edi,%ebx
+ 1f9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1fc:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 1ff:	90                   	nop
+ 200:	5b                   	pop    %ebx
+ 201:	5f                   	pop    %edi
+ 202:	5d                   	pop    %ebp
+ 203:	c3                   	ret
+
+00000204 <strcpy>:
+{
+ 204:	55                   	push   %ebp
+ 205:	89 e5                	mov    %esp,%ebp
+ 207:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 20a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 210:	90                   	nop
+ 211:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 214:	8d 42 01             	lea    0x1(%edx),%eax
+ 217:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 21a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 220:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 223:	0f b6 12             	movzbl (%edx),%edx
+ 226:	88 10                	mov    %dl,(%eax)
+ 228:	0f b6 00             	movzbl (%eax),%eax
+ 22b:	84 c0                	test   %al,%al
+ 22d:	75 e2                	jne    211 <strcpy+0xd>
+  return os;
+ 22f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 232:	c9                   	leave
+ 233:	c3                   	ret
+
+00000234 <strcmp>:
+{
+ 234:	55                   	push   %ebp
+ 235:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 237:	eb 08                	jmp    241 <strcmp+0xd>
+    p++, q++;
+ 239:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 23d:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 241:	8b 45 08             	mov    0x8(%ebp),%eax
+ 244:	0f b6 00             	movzbl (%eax),%eax
+ 247:	84 c0                	test   %al,%al
+ 249:	74 10                	je     25b <strcmp+0x27>
+ 24b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24e:	0f b6 10             	movzbl (%eax),%edx
+ 251:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 254:	0f b6 00             	movzbl (%eax),%eax
+ 257:	38 c2                	cmp    %al,%dl
+ 259:	74 de                	je     239 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 25b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25e:	0f b6 00             	movzbl (%eax),%eax
+ 261:	0f b6 d0             	movzbl %al,%edx
+ 264:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 267:	0f b6 00             	movzbl (%eax),%eax
+ 26a:	0f b6 c0             	movzbl %al,%eax
+ 26d:	29 c2                	sub    %eax,%edx
+ 26f:	89 d0                	mov    %edx,%eax
+}
+ 271:	5d                   	pop    %ebp
+ 272:	c3                   	ret
+
+00000273 <strlen>:
+{
+ 273:	55                   	push   %ebp
+ 274:	89 e5                	mov    %esp,%ebp
+ 276:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 279:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 280:	eb 04                	jmp    286 <strlen+0x13>
+ 282:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 286:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 289:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28c:	01 d0                	add    %edx,%eax
+ 28e:	0f b6 00             	movzbl (%eax),%eax
+ 291:	84 c0                	test   %al,%al
+ 293:	75 ed                	jne    282 <strlen+0xf>
+  return n;
+ 295:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 298:	c9                   	leave
+ 299:	c3                   	ret
+
+0000029a <memset>:
+{
+ 29a:	55                   	push   %ebp
+ 29b:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 29d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2a0:	50                   	push   %eax
+ 2a1:	ff 75 0c             	push   0xc(%ebp)
+ 2a4:	ff 75 08             	push   0x8(%ebp)
+ 2a7:	e8 32 ff ff ff       	call   1de <stosb>
+ 2ac:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 2af:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2b2:	c9                   	leave
+ 2b3:	c3                   	ret
+
+000002b4 <strchr>:
+{
+ 2b4:	55                   	push   %ebp
+ 2b5:	89 e5                	mov    %esp,%ebp
+ 2b7:	83 ec 04             	sub    $0x4,%esp
+ 2ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bd:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 2c0:	eb 14                	jmp    2d6 <strchr+0x22>
+    if(*s == c)
+ 2c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c5:	0f b6 00             	movzbl (%eax),%eax
+ 2c8:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2cb:	75 05                	jne    2d2 <strchr+0x1e>
+      return (char*)s;
+ 2cd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d0:	eb 13                	jmp    2e5 <strchr+0x31>
+  for(; *s; s++)
+ 2d2:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d9:	0f b6 00             	movzbl (%eax),%eax
+ 2dc:	84 c0                	test   %al,%al
+ 2de:	75 e2                	jne    2c2 <strchr+0xe>
+  return 0;
+ 2e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2e5:	c9                   	leave
+ 2e6:	c3                   	ret
+
+000002e7 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2e7:	55                   	push   %ebp
+ 2e8:	89 e5                	mov    %esp,%ebp
+ 2ea:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2f4:	eb 42                	jmp    338 <gets+0x51>
+    cc = read(0, &c, 1);
+ 2f6:	83 ec 04             	sub    $0x4,%esp
+ 2f9:	6a 01                	push   $0x1
+ 2fb:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2fe:	50                   	push   %eax
+ 2ff:	6a 00                	push   $0x0
+ 301:	e8 21 02 00 00       	call   527 <read>
+ 306:	83 c4 10             	add    $0x10,%esp
+ 309:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 30c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 310:	7e 33                	jle    345 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 312:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 315:	8d 50 01             	lea    0x1(%eax),%edx
+ 318:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 31b:	89 c2                	mov    %eax,%edx
+ 31d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 320:	01 c2                	add    %eax,%edx
+ 322:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 326:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 328:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 32c:	3c 0a                	cmp    $0xa,%al
+ 32e:	74 16                	je     346 <gets+0x5f>
+ 330:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 334:	3c 0d                	cmp    $0xd,%al
+ 336:	74 0e                	je     346 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 33b:	83 c0 01             	add    $0x1,%eax
+ 33e:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 341:	7f b3                	jg     2f6 <gets+0xf>
+ 343:	eb 01                	jmp    346 <gets+0x5f>
+      break;
+ 345:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 346:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 349:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34c:	01 d0                	add    %edx,%eax
+ 34e:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 351:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 354:	c9                   	leave
+ 355:	c3                   	ret
+
+00000356 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 356:	55                   	push   %ebp
+ 357:	89 e5                	mov    %esp,%ebp
+ 359:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 35c:	83 ec 08             	sub    $0x8,%esp
+ 35f:	6a 00                	push   $0x0
+ 361:	ff 75 08             	push   0x8(%ebp)
+ 364:	e8 e6 01 00 00       	call   54f <open>
+ 369:	83 c4 10             	add    $0x10,%esp
+ 36c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 36f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 373:	79 07                	jns    37c <stat+0x26>
+    return -1;
+ 375:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 37a:	eb 25                	jmp    3a1 <stat+0x4b>
+  r = fstat(fd, st);
+ 37c:	83 ec 08             	sub    $0x8,%esp
+ 37f:	ff 75 0c             	push   0xc(%ebp)
+ 382:	ff 75 f4             	push   -0xc(%ebp)
+ 385:	e8 dd 01 00 00       	call   567 <fstat>
+ 38a:	83 c4 10             	add    $0x10,%esp
+ 38d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 390:	83 ec 0c             	sub    $0xc,%esp
+ 393:	ff 75 f4             	push   -0xc(%ebp)
+ 396:	e8 9c 01 00 00       	call   537 <close>
+ 39b:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 39e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3a1:	c9                   	leave
+ 3a2:	c3                   	ret
+
+000003a3 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3a3:	55                   	push   %ebp
+ 3a4:	89 e5                	mov    %esp,%ebp
+ 3a6:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 3a9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3b0:	eb 25                	jmp    3d7 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 3b2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3b5:	89 d0                	mov    %edx,%eax
+ 3b7:	c1 e0 02             	shl    $0x2,%eax
+ 3ba:	01 d0                	add    %edx,%eax
+ 3bc:	01 c0                	add    %eax,%eax
+ 3be:	89 c1                	mov    %eax,%ecx
+ 3c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c3:	8d 50 01             	lea    0x1(%eax),%edx
+ 3c6:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3c9:	0f b6 00             	movzbl (%eax),%eax
+ 3cc:	0f be c0             	movsbl %al,%eax
+ 3cf:	01 c8                	add    %ecx,%eax
+ 3d1:	83 e8 30             	sub    $0x30,%eax
+ 3d4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3da:	0f b6 00             	movzbl (%eax),%eax
+ 3dd:	3c 2f                	cmp    $0x2f,%al
+ 3df:	7e 0a                	jle    3eb <atoi+0x48>
+ 3e1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e4:	0f b6 00             	movzbl (%eax),%eax
+ 3e7:	3c 39                	cmp    $0x39,%al
+ 3e9:	7e c7                	jle    3b2 <atoi+0xf>
+  return n;
+ 3eb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3ee:	c9                   	leave
+ 3ef:	c3                   	ret
+
+000003f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 3f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ff:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 402:	eb 17                	jmp    41b <memmove+0x2b>
+    *dst++ = *src++;
+ 404:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 407:	8d 42 01             	lea    0x1(%edx),%eax
+ 40a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 40d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 410:	8d 48 01             	lea    0x1(%eax),%ecx
+ 413:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 416:	0f b6 12             	movzbl (%edx),%edx
+ 419:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 41b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 41e:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 421:	89 55 10             	mov    %edx,0x10(%ebp)
+ 424:	85 c0                	test   %eax,%eax
+ 426:	7f dc                	jg     404 <memmove+0x14>
+  return vdst;
+ 428:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 42b:	c9                   	leave
+ 42c:	c3                   	ret
+
+0000042d <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 42d:	55                   	push   %ebp
+ 42e:	89 e5                	mov    %esp,%ebp
+ 430:	57                   	push   %edi
+ 431:	56                   	push   %esi
+ 432:	83 ec 30             	sub    $0x30,%esp
+ 435:	8b 45 08             	mov    0x8(%ebp),%eax
+ 438:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 43b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 43e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 441:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 448:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 44f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 452:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 455:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 458:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 45b:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 462:	e9 89 00 00 00       	jmp    4f0 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 467:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 46a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 46d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 471:	01 c0                	add    %eax,%eax
+ 473:	89 c6                	mov    %eax,%esi
+ 475:	89 d7                	mov    %edx,%edi
+ 477:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 47a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 47d:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 480:	0f ad d0             	shrd   %cl,%edx,%eax
+ 483:	d3 ea                	shr    %cl,%edx
+ 485:	f6 c1 20             	test   $0x20,%cl
+ 488:	74 04                	je     48e <udiv64+0x61>
+ 48a:	89 d0                	mov    %edx,%eax
+ 48c:	31 d2                	xor    %edx,%edx
+ 48e:	83 e0 01             	and    $0x1,%eax
+ 491:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 494:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 49b:	89 f0                	mov    %esi,%eax
+ 49d:	89 fa                	mov    %edi,%edx
+ 49f:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 4a2:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 4a5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 4a8:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 4ab:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4ae:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4b3:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 4b6:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 4b9:	19 d1                	sbb    %edx,%ecx
+ 4bb:	72 2f                	jb     4ec <udiv64+0xbf>
+      r -= d;
+ 4bd:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4c0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4c5:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 4c8:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 4cb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 4ce:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4d3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4d8:	0f a5 c2             	shld   %cl,%eax,%edx
+ 4db:	d3 e0                	shl    %cl,%eax
+ 4dd:	f6 c1 20             	test   $0x20,%cl
+ 4e0:	74 04                	je     4e6 <udiv64+0xb9>
+ 4e2:	89 c2                	mov    %eax,%edx
+ 4e4:	31 c0                	xor    %eax,%eax
+ 4e6:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 4e9:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 4ec:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 4f0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 4f4:	0f 89 6d ff ff ff    	jns    467 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 4fa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 4fd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 500:	83 c4 30             	add    $0x30,%esp
+ 503:	5e                   	pop    %esi
+ 504:	5f                   	pop    %edi
+ 505:	5d                   	pop    %ebp
+ 506:	c3                   	ret
+
+00000507 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 507:	b8 01 00 00 00       	mov    $0x1,%eax
+ 50c:	cd 40                	int    $0x40
+ 50e:	c3                   	ret
+
+0000050f <exit>:
+SYSCALL(exit)
+ 50f:	b8 02 00 00 00       	mov    $0x2,%eax
+ 514:	cd 40                	int    $0x40
+ 516:	c3                   	ret
+
+00000517 <wait>:
+SYSCALL(wait)
+ 517:	b8 03 00 00 00       	mov    $0x3,%eax
+ 51c:	cd 40                	int    $0x40
+ 51e:	c3                   	ret
+
+0000051f <pipe>:
+SYSCALL(pipe)
+ 51f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 524:	cd 40                	int    $0x40
+ 526:	c3                   	ret
+
+00000527 <read>:
+SYSCALL(read)
+ 527:	b8 05 00 00 00       	mov    $0x5,%eax
+ 52c:	cd 40                	int    $0x40
+ 52e:	c3                   	ret
+
+0000052f <write>:
+SYSCALL(write)
+ 52f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 534:	cd 40                	int    $0x40
+ 536:	c3                   	ret
+
+00000537 <close>:
+SYSCALL(close)
+ 537:	b8 15 00 00 00       	mov    $0x15,%eax
+ 53c:	cd 40                	int    $0x40
+ 53e:	c3                   	ret
+
+0000053f <kill>:
+SYSCALL(kill)
+ 53f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 544:	cd 40                	int    $0x40
+ 546:	c3                   	ret
+
+00000547 <exec>:
+SYSCALL(exec)
+ 547:	b8 07 00 00 00       	mov    $0x7,%eax
+ 54c:	cd 40                	int    $0x40
+ 54e:	c3                   	ret
+
+0000054f <open>:
+SYSCALL(open)
+ 54f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 554:	cd 40                	int    $0x40
+ 556:	c3                   	ret
+
+00000557 <mknod>:
+SYSCALL(mknod)
+ 557:	b8 11 00 00 00       	mov    $0x11,%eax
+ 55c:	cd 40                	int    $0x40
+ 55e:	c3                   	ret
+
+0000055f <unlink>:
+SYSCALL(unlink)
+ 55f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 564:	cd 40                	int    $0x40
+ 566:	c3                   	ret
+
+00000567 <fstat>:
+SYSCALL(fstat)
+ 567:	b8 08 00 00 00       	mov    $0x8,%eax
+ 56c:	cd 40                	int    $0x40
+ 56e:	c3                   	ret
+
+0000056f <link>:
+SYSCALL(link)
+ 56f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 574:	cd 40                	int    $0x40
+ 576:	c3                   	ret
+
+00000577 <mkdir>:
+SYSCALL(mkdir)
+ 577:	b8 14 00 00 00       	mov    $0x14,%eax
+ 57c:	cd 40                	int    $0x40
+ 57e:	c3                   	ret
+
+0000057f <chdir>:
+SYSCALL(chdir)
+ 57f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 584:	cd 40                	int    $0x40
+ 586:	c3                   	ret
+
+00000587 <dup>:
+SYSCALL(dup)
+ 587:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 58c:	cd 40                	int    $0x40
+ 58e:	c3                   	ret
+
+0000058f <getpid>:
+SYSCALL(getpid)
+ 58f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 594:	cd 40                	int    $0x40
+ 596:	c3                   	ret
+
+00000597 <sbrk>:
+SYSCALL(sbrk)
+ 597:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 59c:	cd 40                	int    $0x40
+ 59e:	c3                   	ret
+
+0000059f <sleep>:
+SYSCALL(sleep)
+ 59f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5a4:	cd 40                	int    $0x40
+ 5a6:	c3                   	ret
+
+000005a7 <uptime>:
+SYSCALL(uptime)
+ 5a7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5ac:	cd 40                	int    $0x40
+ 5ae:	c3                   	ret
+
+000005af <find_digital_root>:
+SYSCALL(find_digital_root)
+ 5af:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5b4:	cd 40                	int    $0x40
+ 5b6:	c3                   	ret
+
+000005b7 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 5b7:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5bc:	cd 40                	int    $0x40
+ 5be:	c3                   	ret
+
+000005bf <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 5bf:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5c4:	cd 40                	int    $0x40
+ 5c6:	c3                   	ret
+
+000005c7 <copy_file>:
+SYSCALL(copy_file)
+ 5c7:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5cc:	cd 40                	int    $0x40
+ 5ce:	c3                   	ret
+
+000005cf <change_queue>:
+SYSCALL(change_queue)
+ 5cf:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5d4:	cd 40                	int    $0x40
+ 5d6:	c3                   	ret
+
+000005d7 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 5d7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5dc:	cd 40                	int    $0x40
+ 5de:	c3                   	ret
+
+000005df <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 5df:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5e4:	cd 40                	int    $0x40
+ 5e6:	c3                   	ret
+
+000005e7 <print_process_info>:
+SYSCALL(print_process_info)
+ 5e7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5ec:	cd 40                	int    $0x40
+ 5ee:	c3                   	ret
+
+000005ef <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 5ef:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5f4:	cd 40                	int    $0x40
+ 5f6:	c3                   	ret
+
+000005f7 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 5f7:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5fc:	cd 40                	int    $0x40
+ 5fe:	c3                   	ret
+
+000005ff <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 5ff:	b8 20 00 00 00       	mov    $0x20,%eax
+ 604:	cd 40                	int    $0x40
+ 606:	c3                   	ret
+
+00000607 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 607:	b8 21 00 00 00       	mov    $0x21,%eax
+ 60c:	cd 40                	int    $0x40
+ 60e:	c3                   	ret
+
+0000060f <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 60f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 614:	cd 40                	int    $0x40
+ 616:	c3                   	ret
+
+00000617 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 617:	b8 23 00 00 00       	mov    $0x23,%eax
+ 61c:	cd 40                	int    $0x40
+ 61e:	c3                   	ret
+
+0000061f <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 61f:	b8 24 00 00 00       	mov    $0x24,%eax
+ 624:	cd 40                	int    $0x40
+ 626:	c3                   	ret
+
+00000627 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 627:	b8 25 00 00 00       	mov    $0x25,%eax
+ 62c:	cd 40                	int    $0x40
+ 62e:	c3                   	ret
+
+0000062f <set_affinity>:
+SYSCALL(set_affinity)
+ 62f:	b8 26 00 00 00       	mov    $0x26,%eax
+ 634:	cd 40                	int    $0x40
+ 636:	c3                   	ret
+
+00000637 <setsched>:
+SYSCALL(setsched)
+ 637:	b8 27 00 00 00       	mov    $0x27,%eax
+ 63c:	cd 40                	int    $0x40
+ 63e:	c3                   	ret
+
+0000063f <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 63f:	b8 28 00 00 00       	mov    $0x28,%eax
+ 644:	cd 40                	int    $0x40
+ 646:	c3                   	ret
+
+00000647 <set_quantum>:
+SYSCALL(set_quantum)
+ 647:	b8 29 00 00 00       	mov    $0x29,%eax
+ 64c:	cd 40                	int    $0x40
+ 64e:	c3                   	ret
+
+0000064f <schedtrace>:
+SYSCALL(schedtrace)
+ 64f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 654:	cd 40                	int    $0x40
+ 656:	c3                   	ret
+
+00000657 <getrusage>:
+SYSCALL(getrusage)
+ 657:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 65c:	cd 40                	int    $0x40
+ 65e:	c3                   	ret
+
+0000065f <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 65f:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 667:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 66c:	cd 40                	int    $0x40
+ 66e:	c3                   	ret
+
+0000066f <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 66f:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 674:	cd 40                	int    $0x40
+ 676:	c3                   	ret
+
+00000677 <futex_wait>:
+SYSCALL(futex_wait)
+ 677:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 67c:	cd 40                	int    $0x40
+ 67e:	c3                   	ret
+
+0000067f <futex_wake>:
+SYSCALL(futex_wake)
+ 67f:	b8 30 00 00 00       	mov    $0x30,%eax
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 687:	b8 31 00 00 00       	mov    $0x31,%eax
+ 68c:	cd 40                	int    $0x40
+ 68e:	c3                   	ret
+
+0000068f <submit_batch>:
+SYSCALL(submit_batch)
+ 68f:	b8 32 00 00 00       	mov    $0x32,%eax
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 697:	b8 33 00 00 00       	mov    $0x33,%eax
+ 69c:	cd 40                	int    $0x40
+ 69e:	c3                   	ret
+
+0000069f <kmem_junk>:
+SYSCALL(kmem_junk)
+ 69f:	b8 34 00 00 00       	mov    $0x34,%eax
+ 6a4:	cd 40                	int    $0x40
+ 6a6:	c3                   	ret
+
+000006a7 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6a7:	55                   	push   %ebp
+ 6a8:	89 e5                	mov    %esp,%ebp
+ 6aa:	83 ec 18             	sub    $0x18,%esp
+ 6ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6b0:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 6b3:	83 ec 04             	sub    $0x4,%esp
+ 6b6:	6a 01                	push   $0x1
+ 6b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 6bb:	50                   	push   %eax
+ 6bc:	ff 75 08             	push   0x8(%ebp)
+ 6bf:	e8 6b fe ff ff       	call   52f <write>
+ 6c4:	83 c4 10             	add    $0x10,%esp
+}
+ 6c7:	90                   	nop
+ 6c8:	c9                   	leave
+ 6c9:	c3                   	ret
+
+000006ca <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6ca:	55                   	push   %ebp
+ 6cb:	89 e5                	mov    %esp,%ebp
+ 6cd:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 6d0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6d7:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6db:	74 17                	je     6f4 <printint+0x2a>
+ 6dd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6e1:	79 11                	jns    6f4 <printint+0x2a>
+    neg = 1;
+ 6e3:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 6ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6ed:	f7 d8                	neg    %eax
+ 6ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6f2:	eb 06                	jmp    6fa <printint+0x30>
+  } else {
+    x = xx;
+ 6f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6f7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 6fa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 701:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 704:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 707:	ba 00 00 00 00       	mov    $0x0,%edx
+ 70c:	f7 f1                	div    %ecx
+ 70e:	89 d1                	mov    %edx,%ecx
+ 710:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 713:	8d 50 01             	lea    0x1(%eax),%edx
+ 716:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 719:	0f b6 91 d4 11 00 00 	movzbl 0x11d4(%ecx),%edx
+ 720:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 724:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 727:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 72a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 72f:	f7 f1                	div    %ecx
+ 731:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 734:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 738:	75 c7                	jne    701 <printint+0x37>
+  if(neg)
+ 73a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 73e:	74 2d                	je     76d <printint+0xa3>
+    buf[i++] = '-';
+ 740:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 743:	8d 50 01             	lea    0x1(%eax),%edx
+ 746:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 749:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 74e:	eb 1d                	jmp    76d <printint+0xa3>
+    putc(fd, buf[i]);
+ 750:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 753:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 756:	01 d0                	add    %edx,%eax
+ 758:	0f b6 00             	movzbl (%eax),%eax
+ 75b:	0f be c0             	movsbl %al,%eax
+ 75e:	83 ec 08             	sub    $0x8,%esp
+ 761:	50                   	push   %eax
+ 762:	ff 75 08             	push   0x8(%ebp)
+ 765:	e8 3d ff ff ff       	call   6a7 <putc>
+ 76a:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 76d:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 771:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 775:	79 d9                	jns    750 <printint+0x86>
+}
+ 777:	90                   	nop
+ 778:	90                   	nop
+ 779:	c9                   	leave
+ 77a:	c3                   	ret
+
+0000077b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 77b:	55                   	push   %ebp
+ 77c:	89 e5                	mov    %esp,%ebp
+ 77e:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 781:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 788:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 78b:	83 c0 04             	add    $0x4,%eax
+ 78e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 791:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 798:	e9 59 01 00 00       	jmp    8f6 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 79d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7a0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7a3:	01 d0                	add    %edx,%eax
+ 7a5:	0f b6 00             	movzbl (%eax),%eax
+ 7a8:	0f be c0             	movsbl %al,%eax
+ 7ab:	25 ff 00 00 00       	and    $0xff,%eax
+ 7b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 7b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7b7:	75 2c                	jne    7e5 <printf+0x6a>
+      if(c == '%'){
+ 7b9:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7bd:	75 0c                	jne    7cb <printf+0x50>
+        state = '%';
+ 7bf:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 7c6:	e9 27 01 00 00       	jmp    8f2 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 7cb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7ce:	0f be c0             	movsbl %al,%eax
+ 7d1:	83 ec 08             	sub    $0x8,%esp
+ 7d4:	50                   	push   %eax
+ 7d5:	ff 75 08             	push   0x8(%ebp)
+ 7d8:	e8 ca fe ff ff       	call   6a7 <putc>
+ 7dd:	83 c4 10             	add    $0x10,%esp
+ 7e0:	e9 0d 01 00 00       	jmp    8f2 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 7e5:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 7e9:	0f 85 03 01 00 00    	jne    8f2 <printf+0x177>
+      if(c == 'd'){
+ 7ef:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 7f3:	75 1e                	jne    813 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 7f5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7f8:	8b 00                	mov    (%eax),%eax
+ 7fa:	6a 01                	push   $0x1
+ 7fc:	6a 0a                	push   $0xa
+ 7fe:	50                   	push   %eax
+ 7ff:	ff 75 08             	push   0x8(%ebp)
+ 802:	e8 c3 fe ff ff       	call   6ca <printint>
+ 807:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 80a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 80e:	e9 d8 00 00 00       	jmp    8eb <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 813:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 817:	74 06                	je     81f <printf+0xa4>
+ 819:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 81d:	75 1e                	jne    83d <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 81f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 822:	8b 00                	mov    (%eax),%eax
+ 824:	6a 00                	push   $0x0
+ 826:	6a 10                	push   $0x10
+ 828:	50                   	push   %eax
+ 829:	ff 75 08             	push   0x8(%ebp)
+ 82c:	e8 99 fe ff ff       	call   6ca <printint>
+ 831:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 834:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 838:	e9 ae 00 00 00       	jmp    8eb <printf+0x170>
+      } else if(c == 's'){
+ 83d:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 841:	75 43                	jne    886 <printf+0x10b>
+        s = (char*)*ap;
+ 843:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 846:	8b 00                	mov    (%eax),%eax
+ 848:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 84b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 84f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 853:	75 25                	jne    87a <printf+0xff>
+          s = "(null)";
+ 855:	c7 45 f4 97 0d 00 00 	movl   $0xd97,-0xc(%ebp)
+        while(*s != 0){
+ 85c:	eb 1c                	jmp    87a <printf+0xff>
+          putc(fd, *s);
+ 85e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 861:	0f b6 00             	movzbl (%eax),%eax
+ 864:	0f be c0             	movsbl %al,%eax
+ 867:	83 ec 08             	sub    $0x8,%esp
+ 86a:	50                   	push   %eax
+ 86b:	ff 75 08             	push   0x8(%ebp)
+ 86e:	e8 34 fe ff ff       	call   6a7 <putc>
+ 873:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 876:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 87a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 87d:	0f b6 00             	movzbl (%eax),%eax
+ 880:	84 c0                	test   %al,%al
+ 882:	75 da                	jne    85e <printf+0xe3>
+ 884:	eb 65                	jmp    8eb <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 886:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 88a:	75 1d                	jne    8a9 <printf+0x12e>
+        putc(fd, *ap);
+ 88c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 88f:	8b 00                	mov    (%eax),%eax
+ 891:	0f be c0             	movsbl %al,%eax
+ 894:	83 ec 08             	sub    $0x8,%esp
+ 897:	50                   	push   %eax
+ 898:	ff 75 08             	push   0x8(%ebp)
+ 89b:	e8 07 fe ff ff       	call   6a7 <putc>
+ 8a0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8a3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8a7:	eb 42                	jmp    8eb <printf+0x170>
+      } else if(c == '%'){
+ 8a9:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8ad:	75 17                	jne    8c6 <printf+0x14b>
+        putc(fd, c);
+ 8af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8b2:	0f be c0             	movsbl %al,%eax
+ 8b5:	83 ec 08             	sub    $0x8,%esp
+ 8b8:	50                   	push   %eax
+ 8b9:	ff 75 08             	push   0x8(%ebp)
+ 8bc:	e8 e6 fd ff ff       	call   6a7 <putc>
+ 8c1:	83 c4 10             	add    $0x10,%esp
+ 8c4:	eb 25                	jmp    8eb <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 8c6:	83 ec 08             	sub    $0x8,%esp
+ 8c9:	6a 25                	push   $0x25
+ 8cb:	ff 75 08             	push   0x8(%ebp)
+ 8ce:	e8 d4 fd ff ff       	call   6a7 <putc>
+ 8d3:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 8d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8d9:	0f be c0             	movsbl %al,%eax
+ 8dc:	83 ec 08             	sub    $0x8,%esp
+ 8df:	50                   	push   %eax
+ 8e0:	ff 75 08             	push   0x8(%ebp)
+ 8e3:	e8 bf fd ff ff       	call   6a7 <putc>
+ 8e8:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 8eb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8f2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 8f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8f9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8fc:	01 d0                	add    %edx,%eax
+ 8fe:	0f b6 00             	movzbl (%eax),%eax
+ 901:	84 c0                	test   %al,%al
+ 903:	0f 85 94 fe ff ff    	jne    79d <printf+0x22>
+    }
+  }
+}
+ 909:	90                   	nop
+ 90a:	90                   	nop
+ 90b:	c9                   	leave
+ 90c:	c3                   	ret
+
+0000090d <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 90d:	55                   	push   %ebp
+ 90e:	89 e5                	mov    %esp,%ebp
+ 910:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 913:	8b 45 08             	mov    0x8(%ebp),%eax
+ 916:	83 e8 08             	sub    $0x8,%eax
+ 919:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 91c:	a1 f0 11 00 00       	mov    0x11f0,%eax
+ 921:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 924:	eb 24                	jmp    94a <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 926:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 929:	8b 00                	mov    (%eax),%eax
+ 92b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 92e:	72 12                	jb     942 <free+0x35>
+ 930:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 933:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 936:	72 24                	jb     95c <free+0x4f>
+ 938:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 93b:	8b 00                	mov    (%eax),%eax
+ 93d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 940:	72 1a                	jb     95c <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 942:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 945:	8b 00                	mov    (%eax),%eax
+ 947:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 94a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 94d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 950:	73 d4                	jae    926 <free+0x19>
+ 952:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 955:	8b 00                	mov    (%eax),%eax
+ 957:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 95a:	73 ca                	jae    926 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 95c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 95f:	8b 40 04             	mov    0x4(%eax),%eax
+ 962:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 969:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 96c:	01 c2                	add    %eax,%edx
+ 96e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 971:	8b 00                	mov    (%eax),%eax
+ 973:	39 c2                	cmp    %eax,%edx
+ 975:	75 24                	jne    99b <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 977:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 97a:	8b 50 04             	mov    0x4(%eax),%edx
+ 97d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 980:	8b 00                	mov    (%eax),%eax
+ 982:	8b 40 04             	mov    0x4(%eax),%eax
+ 985:	01 c2                	add    %eax,%edx
+ 987:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 98a:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 98d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 990:	8b 00                	mov    (%eax),%eax
+ 992:	8b 10                	mov    (%eax),%edx
+ 994:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 997:	89 10                	mov    %edx,(%eax)
+ 999:	eb 0a                	jmp    9a5 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 99b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 99e:	8b 10                	mov    (%eax),%edx
+ 9a0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9a3:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 9a5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9a8:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ab:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b5:	01 d0                	add    %edx,%eax
+ 9b7:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9ba:	75 20                	jne    9dc <free+0xcf>
+    p->s.size += bp->s.size;
+ 9bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9bf:	8b 50 04             	mov    0x4(%eax),%edx
+ 9c2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9c5:	8b 40 04             	mov    0x4(%eax),%eax
+ 9c8:	01 c2                	add    %eax,%edx
+ 9ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9cd:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 9d0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d3:	8b 10                	mov    (%eax),%edx
+ 9d5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9d8:	89 10                	mov    %edx,(%eax)
+ 9da:	eb 08                	jmp    9e4 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 9dc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9df:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 9e2:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 9e4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e7:	a3 f0 11 00 00       	mov    %eax,0x11f0
+}
+ 9ec:	90                   	nop
+ 9ed:	c9                   	leave
+ 9ee:	c3                   	ret
+
+000009ef <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 9ef:	55                   	push   %ebp
+ 9f0:	89 e5                	mov    %esp,%ebp
+ 9f2:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 9f5:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 9fc:	77 07                	ja     a05 <morecore+0x16>
+    nu = 4096;
+ 9fe:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ a05:	8b 45 08             	mov    0x8(%ebp),%eax
+ a08:	c1 e0 03             	shl    $0x3,%eax
+ a0b:	83 ec 0c             	sub    $0xc,%esp
+ a0e:	50                   	push   %eax
+ a0f:	e8 83 fb ff ff       	call   597 <sbrk>
+ a14:	83 c4 10             	add    $0x10,%esp
+ a17:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ a1a:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a1e:	75 07                	jne    a27 <morecore+0x38>
+    return 0;
+ a20:	b8 00 00 00 00       	mov    $0x0,%eax
+ a25:	eb 26                	jmp    a4d <morecore+0x5e>
+  hp = (Header*)p;
+ a27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a2a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ a2d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a30:	8b 55 08             	mov    0x8(%ebp),%edx
+ a33:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ a36:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a39:	83 c0 08             	add    $0x8,%eax
+ a3c:	83 ec 0c             	sub    $0xc,%esp
+ a3f:	50                   	push   %eax
+ a40:	e8 c8 fe ff ff       	call   90d <free>
+ a45:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ a48:	a1 f0 11 00 00       	mov    0x11f0,%eax
+}
+ a4d:	c9                   	leave
+ a4e:	c3                   	ret
+
+00000a4f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a4f:	55                   	push   %ebp
+ a50:	89 e5                	mov    %esp,%ebp
+ a52:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a55:	8b 45 08             	mov    0x8(%ebp),%eax
+ a58:	83 c0 07             	add    $0x7,%eax
+ a5b:	c1 e8 03             	shr    $0x3,%eax
+ a5e:	83 c0 01             	add    $0x1,%eax
+ a61:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ a64:	a1 f0 11 00 00       	mov    0x11f0,%eax
+ a69:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a6c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a70:	75 23                	jne    a95 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ a72:	c7 45 f0 e8 11 00 00 	movl   $0x11e8,-0x10(%ebp)
+ a79:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a7c:	a3 f0 11 00 00       	mov    %eax,0x11f0
+ a81:	a1 f0 11 00 00       	mov    0x11f0,%eax
+ a86:	a3 e8 11 00 00       	mov    %eax,0x11e8
+    base.s.size = 0;
+ a8b:	c7 05 ec 11 00 00 00 	movl   $0x0,0x11ec
+ a92:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a95:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a98:	8b 00                	mov    (%eax),%eax
+ a9a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aa0:	8b 40 04             	mov    0x4(%eax),%eax
+ aa3:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ aa6:	72 4d                	jb     af5 <malloc+0xa6>
+      if(p->s.size == nunits)
+ aa8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aab:	8b 40 04             	mov    0x4(%eax),%eax
+ aae:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ ab1:	75 0c                	jne    abf <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ ab3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab6:	8b 10                	mov    (%eax),%edx
+ ab8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ abb:	89 10                	mov    %edx,(%eax)
+ abd:	eb 26                	jmp    ae5 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ abf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac2:	8b 40 04             	mov    0x4(%eax),%eax
+ ac5:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ ac8:	89 c2                	mov    %eax,%edx
+ aca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ acd:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ad0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad3:	8b 40 04             	mov    0x4(%eax),%eax
+ ad6:	c1 e0 03             	shl    $0x3,%eax
+ ad9:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ adc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ adf:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ ae2:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ ae5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ae8:	a3 f0 11 00 00       	mov    %eax,0x11f0
+      return (void*)(p + 1);
+ aed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ af0:	83 c0 08             	add    $0x8,%eax
+ af3:	eb 3b                	jmp    b30 <malloc+0xe1>
+    }
+    if(p == freep)
+ af5:	a1 f0 11 00 00       	mov    0x11f0,%eax
+ afa:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ afd:	75 1e                	jne    b1d <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ aff:	83 ec 0c             	sub    $0xc,%esp
+ b02:	ff 75 ec             	push   -0x14(%ebp)
+ b05:	e8 e5 fe ff ff       	call   9ef <morecore>
+ b0a:	83 c4 10             	add    $0x10,%esp
+ b0d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b10:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b14:	75 07                	jne    b1d <malloc+0xce>
+        return 0;
+ b16:	b8 00 00 00 00       	mov    $0x0,%eax
+ b1b:	eb 13                	jmp    b30 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b20:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b26:	8b 00                	mov    (%eax),%eax
+ b28:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b2b:	e9 6d ff ff ff       	jmp    a9d <malloc+0x4e>
+  }
+}
+ b30:	c9                   	leave
+ b31:	c3                   	ret
+
+00000b32 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ b32:	55                   	push   %ebp
+ b33:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ b35:	8b 45 08             	mov    0x8(%ebp),%eax
+ b38:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b3e:	90                   	nop
+ b3f:	5d                   	pop    %ebp
+ b40:	c3                   	ret
+
+00000b41 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ b41:	55                   	push   %ebp
+ b42:	89 e5                	mov    %esp,%ebp
+ b44:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ b47:	8b 55 08             	mov    0x8(%ebp),%edx
+ b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+ b4f:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b54:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b58:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b5b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b5f:	74 3b                	je     b9c <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ b61:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ b65:	74 2d                	je     b94 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ b67:	8b 55 08             	mov    0x8(%ebp),%edx
+ b6a:	b8 02 00 00 00       	mov    $0x2,%eax
+ b6f:	87 02                	xchg   %eax,(%edx)
+ b71:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b74:	eb 1e                	jmp    b94 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ b76:	8b 45 08             	mov    0x8(%ebp),%eax
+ b79:	83 ec 08             	sub    $0x8,%esp
+ b7c:	6a 02                	push   $0x2
+ b7e:	50                   	push   %eax
+ b7f:	e8 f3 fa ff ff       	call   677 <futex_wait>
+ b84:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ b87:	8b 55 08             	mov    0x8(%ebp),%edx
+ b8a:	b8 02 00 00 00       	mov    $0x2,%eax
+ b8f:	87 02                	xchg   %eax,(%edx)
+ b91:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b94:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b98:	75 dc                	jne    b76 <mutex_lock+0x35>
+ b9a:	eb 01                	jmp    b9d <mutex_lock+0x5c>
+    return;
+ b9c:	90                   	nop
+  }
+}
+ b9d:	c9                   	leave
+ b9e:	c3                   	ret
+
+00000b9f <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ b9f:	55                   	push   %ebp
+ ba0:	89 e5                	mov    %esp,%ebp
+ ba2:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ ba5:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba8:	ba 01 00 00 00       	mov    $0x1,%edx
+ bad:	f7 da                	neg    %edx
+ baf:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ bb3:	83 fa 01             	cmp    $0x1,%edx
+ bb6:	74 1a                	je     bd2 <mutex_unlock+0x33>
+    m->state = 0;
+ bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+ bbb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ bc1:	8b 45 08             	mov    0x8(%ebp),%eax
+ bc4:	83 ec 08             	sub    $0x8,%esp
+ bc7:	6a 01                	push   $0x1
+ bc9:	50                   	push   %eax
+ bca:	e8 b0 fa ff ff       	call   67f <futex_wake>
+ bcf:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ bd2:	90                   	nop
+ bd3:	c9                   	leave
+ bd4:	c3                   	ret
+
+00000bd5 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ bd5:	55                   	push   %ebp
+ bd6:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ bd8:	8b 45 08             	mov    0x8(%ebp),%eax
+ bdb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ be1:	8b 45 08             	mov    0x8(%ebp),%eax
+ be4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ beb:	90                   	nop
+ bec:	5d                   	pop    %ebp
+ bed:	c3                   	ret
+
+00000bee <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ bee:	55                   	push   %ebp
+ bef:	89 e5                	mov    %esp,%ebp
+ bf1:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf7:	83 c0 04             	add    $0x4,%eax
+ bfa:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ bfe:	8b 45 08             	mov    0x8(%ebp),%eax
+ c01:	83 ec 08             	sub    $0x8,%esp
+ c04:	ff 75 0c             	push   0xc(%ebp)
+ c07:	50                   	push   %eax
+ c08:	e8 6a fa ff ff       	call   677 <futex_wait>
+ c0d:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ c10:	8b 45 08             	mov    0x8(%ebp),%eax
+ c13:	83 c0 04             	add    $0x4,%eax
+ c16:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ c1a:	90                   	nop
+ c1b:	c9                   	leave
+ c1c:	c3                   	ret
+
+00000c1d <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ c1d:	55                   	push   %ebp
+ c1e:	89 e5                	mov    %esp,%ebp
+ c20:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ c23:	8b 45 08             	mov    0x8(%ebp),%eax
+ c26:	8b 00                	mov    (%eax),%eax
+ c28:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ c2b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c2f:	78 17                	js     c48 <rwlock_rdlock+0x2b>
+ c31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c34:	83 c0 01             	add    $0x1,%eax
+ c37:	89 c1                	mov    %eax,%ecx
+ c39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c3c:	8b 55 08             	mov    0x8(%ebp),%edx
+ c3f:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c43:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c46:	74 19                	je     c61 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ c48:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c4c:	79 d5                	jns    c23 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ c4e:	83 ec 08             	sub    $0x8,%esp
+ c51:	ff 75 f4             	push   -0xc(%ebp)
+ c54:	ff 75 08             	push   0x8(%ebp)
+ c57:	e8 92 ff ff ff       	call   bee <rwlock_sleep>
+ c5c:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ c5f:	eb c2                	jmp    c23 <rwlock_rdlock+0x6>
+      return;
+ c61:	90                   	nop
+  }
+}
+ c62:	c9                   	leave
+ c63:	c3                   	ret
+
+00000c64 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ c64:	55                   	push   %ebp
+ c65:	89 e5                	mov    %esp,%ebp
+ c67:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ c6a:	eb 11                	jmp    c7d <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ c6c:	83 ec 08             	sub    $0x8,%esp
+ c6f:	ff 75 f4             	push   -0xc(%ebp)
+ c72:	ff 75 08             	push   0x8(%ebp)
+ c75:	e8 74 ff ff ff       	call   bee <rwlock_sleep>
+ c7a:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ c7d:	8b 55 08             	mov    0x8(%ebp),%edx
+ c80:	b8 00 00 00 00       	mov    $0x0,%eax
+ c85:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ c8a:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c8e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c91:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c95:	75 d5                	jne    c6c <rwlock_wrlock+0x8>
+}
+ c97:	90                   	nop
+ c98:	90                   	nop
+ c99:	c9                   	leave
+ c9a:	c3                   	ret
+
+00000c9b <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ c9b:	55                   	push   %ebp
+ c9c:	89 e5                	mov    %esp,%ebp
+ c9e:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ ca1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca4:	8b 00                	mov    (%eax),%eax
+ ca6:	85 c0                	test   %eax,%eax
+ ca8:	79 0c                	jns    cb6 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ caa:	8b 45 08             	mov    0x8(%ebp),%eax
+ cad:	ba 00 00 00 00       	mov    $0x0,%edx
+ cb2:	87 10                	xchg   %edx,(%eax)
+ cb4:	eb 18                	jmp    cce <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ cb6:	8b 55 08             	mov    0x8(%ebp),%edx
+ cb9:	b8 01 00 00 00       	mov    $0x1,%eax
+ cbe:	f7 d8                	neg    %eax
+ cc0:	89 c1                	mov    %eax,%ecx
+ cc2:	89 c8                	mov    %ecx,%eax
+ cc4:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ cc8:	01 c8                	add    %ecx,%eax
+ cca:	85 c0                	test   %eax,%eax
+ ccc:	75 20                	jne    cee <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ cce:	8b 45 08             	mov    0x8(%ebp),%eax
+ cd1:	8b 40 04             	mov    0x4(%eax),%eax
+ cd4:	85 c0                	test   %eax,%eax
+ cd6:	74 17                	je     cef <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ cd8:	8b 45 08             	mov    0x8(%ebp),%eax
+ cdb:	83 ec 08             	sub    $0x8,%esp
+ cde:	68 ff ff ff 7f       	push   $0x7fffffff
+ ce3:	50                   	push   %eax
+ ce4:	e8 96 f9 ff ff       	call   67f <futex_wake>
+ ce9:	83 c4 10             	add    $0x10,%esp
+ cec:	eb 01                	jmp    cef <rwlock_unlock+0x54>
+    return;
+ cee:	90                   	nop
+}
+ cef:	c9                   	leave
+ cf0:	c3                   	ret
+
+00000cf1 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ cf1:	55                   	push   %ebp
+ cf2:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ cf4:	8b 45 08             	mov    0x8(%ebp),%eax
+ cf7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ cfd:	90                   	nop
+ cfe:	5d                   	pop    %ebp
+ cff:	c3                   	ret
+
+00000d00 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ d00:	55                   	push   %ebp
+ d01:	89 e5                	mov    %esp,%ebp
+ d03:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ d06:	8b 45 08             	mov    0x8(%ebp),%eax
+ d09:	8b 00                	mov    (%eax),%eax
+ d0b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ d0e:	83 ec 0c             	sub    $0xc,%esp
+ d11:	ff 75 0c             	push   0xc(%ebp)
+ d14:	e8 86 fe ff ff       	call   b9f <mutex_unlock>
+ d19:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+ d1f:	83 ec 08             	sub    $0x8,%esp
+ d22:	ff 75 f4             	push   -0xc(%ebp)
+ d25:	50                   	push   %eax
+ d26:	e8 4c f9 ff ff       	call   677 <futex_wait>
+ d2b:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ d2e:	83 ec 0c             	sub    $0xc,%esp
+ d31:	ff 75 0c             	push   0xc(%ebp)
+ d34:	e8 08 fe ff ff       	call   b41 <mutex_lock>
+ d39:	83 c4 10             	add    $0x10,%esp
+}
+ d3c:	90                   	nop
+ d3d:	c9                   	leave
+ d3e:	c3                   	ret
+
+00000d3f <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ d3f:	55                   	push   %ebp
+ d40:	89 e5                	mov    %esp,%ebp
+ d42:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ d45:	8b 45 08             	mov    0x8(%ebp),%eax
+ d48:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ d4c:	8b 45 08             	mov    0x8(%ebp),%eax
+ d4f:	83 ec 08             	sub    $0x8,%esp
+ d52:	6a 01                	push   $0x1
+ d54:	50                   	push   %eax
+ d55:	e8 25 f9 ff ff       	call   67f <futex_wake>
+ d5a:	83 c4 10             	add    $0x10,%esp
+}
+ d5d:	90                   	nop
+ d5e:	c9                   	leave
+ d5f:	c3                   	ret
+
+00000d60 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ d60:	55                   	push   %ebp
+ d61:	89 e5                	mov    %esp,%ebp
+ d63:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ d66:	8b 45 08             	mov    0x8(%ebp),%eax
+ d69:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ d6d:	8b 45 08             	mov    0x8(%ebp),%eax
+ d70:	83 ec 08             	sub    $0x8,%esp
+ d73:	68 ff ff ff 7f       	push   $0x7fffffff
+ d78:	50                   	push   %eax
+ d79:	e8 01 f9 ff ff       	call   67f <futex_wake>
+ d7e:	83 c4 10             	add    $0x10,%esp
+}
+ d81:	90                   	nop
+ d82:	c9                   	leave
+ d83:	c3                   	ret
@@ -0,0 +1,43 @@
+#include "types.h"
+#include "x86.h"
+#include "user.h"
+
+#define MAXCPU 8
+
+// Share of part in whole, in percent. Both are shifted down until
+// whole fits in 32 bits, for udiv64().
+int percent(uint64 part, uint64 whole)
+{
+    while (whole > 0xffffffff)
+    {
+        part >>= 1;
+        whole >>= 1;
+    }
+    if (whole == 0)
+        return 0;
+    return udiv64(part * 100, whole);
+}
+
+int main(int argc, char *argv[])
+{
+    uint64 before[MAXCPU], after[MAXCPU];
+    uint64 start, elapsed;
+    int ncpu, i, interval = 100;
+
+    if (argc > 1)
+        interval = atoi(argv[1]);
+
+    for (ncpu = 0; ncpu < MAXCPU; ncpu++)
+        if (get_idle_cycles(ncpu, &before[ncpu]) < 0)
+            break;
+    start = rdtsc();
+    sleep(interval);
+    elapsed = rdtsc() - start;
+    for (i = 0; i < ncpu; i++)
+        get_idle_cycles(i, &after[i]);
+
+    printf(1, "CPU\tIdle\n");
+    for (i = 0; i < ncpu; i++)
+        printf(1, "%d\t%d%%\n", i, percent(after[i] - before[i], elapsed));
+    exit();
+}
@@ -0,0 +1,1832 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fcntl.h"
+
+char *argv[] = {"sh", 0};
+
+int main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+  int pid, wpid;
+
+  if (open("console", O_RDWR) < 0)
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	6a 02                	push   $0x2
+  16:	68 e1 0c 00 00       	push   $0xce1
+  1b:	e8 89 04 00 00       	call   4a9 <open>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	85 c0                	test   %eax,%eax
+  25:	79 26                	jns    4d <main+0x4d>
+  {
+    mknod("console", 1, 1);
+  27:	83 ec 04             	sub    $0x4,%esp
+  2a:	6a 01                	push   $0x1
+  2c:	6a 01                	push   $0x1
+  2e:	68 e1 0c 00 00       	push   $0xce1
+  33:	e8 79 04 00 00       	call   4b1 <mknod>
+  38:	83 c4 10             	add    $0x10,%esp
+    open("console", O_RDWR);
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	6a 02                	push   $0x2
+  40:	68 e1 0c 00 00       	push   $0xce1
+  45:	e8 5f 04 00 00       	call   4a9 <open>
+  4a:	83 c4 10             	add    $0x10,%esp
+  }
+  dup(0); // stdout
+  4d:	83 ec 0c             	sub    $0xc,%esp
+  50:	6a 00                	push   $0x0
+  52:	e8 8a 04 00 00       	call   4e1 <dup>
+  57:	83 c4 10             	add    $0x10,%esp
+  dup(0); // stderr
+  5a:	83 ec 0c             	sub    $0xc,%esp
+  5d:	6a 00                	push   $0x0
+  5f:	e8 7d 04 00 00       	call   4e1 <dup>
+  64:	83 c4 10             	add    $0x10,%esp
+
+  for (;;)
+  {
+    printf(1, "init: starting sh\n");
+  67:	83 ec 08             	sub    $0x8,%esp
+  6a:	68 e9 0c 00 00       	push   $0xce9
+  6f:	6a 01                	push   $0x1
+  71:	e8 5f 06 00 00       	call   6d5 <printf>
+  76:	83 c4 10             	add    $0x10,%esp
+    printf(1, "Group #31:\n");
+  79:	83 ec 08             	sub    $0x8,%esp
+  7c:	68 fc 0c 00 00       	push   $0xcfc
+  81:	6a 01                	push   $0x1
+  83:	e8 4d 06 00 00       	call   6d5 <printf>
+  88:	83 c4 10             	add    $0x10,%esp
+    printf(1, "1. Mahdi Noori\n");
+  8b:	83 ec 08             	sub    $0x8,%esp
+  8e:	68 08 0d 00 00       	push   $0xd08
+  93:	6a 01                	push   $0x1
+  95:	e8 3b 06 00 00       	call   6d5 <printf>
+  9a:	83 c4 10             	add    $0x10,%esp
+    printf(1, "2. AmirAli Rahimi\n");
+  9d:	83 ec 08             	sub    $0x8,%esp
+  a0:	68 18 0d 00 00       	push   $0xd18
+  a5:	6a 01                	push   $0x1
+  a7:	e8 29 06 00 00       	call   6d5 <printf>
+  ac:	83 c4 10             	add    $0x10,%esp
+    printf(1, "3. Soheil Hajian\n");
+  af:	83 ec 08             	sub    $0x8,%esp
+  b2:	68 2b 0d 00 00       	push   $0xd2b
+  b7:	6a 01                	push   $0x1
+  b9:	e8 17 06 00 00       	call   6d5 <printf>
+  be:	83 c4 10             	add    $0x10,%esp
+
+    pid = fork();
+  c1:	e8 9b 03 00 00       	call   461 <fork>
+  c6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if (pid < 0)
+  c9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  cd:	79 17                	jns    e6 <main+0xe6>
+    {
+      printf(1, "init: fork failed\n");
+  cf:	83 ec 08             	sub    $0x8,%esp
+  d2:	68 3d 0d 00 00       	push   $0xd3d
+  d7:	6a 01                	push   $0x1
+  d9:	e8 f7 05 00 00       	call   6d5 <printf>
+  de:	83 c4 10             	add    $0x10,%esp
+      exit();
+  e1:	e8 83 03 00 00       	call   469 <exit>
+    }
+    if (pid == 0)
+  e6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  ea:	75 2c                	jne    118 <main+0x118>
+    {
+      exec("sh", argv);
+  ec:	83 ec 08             	sub    $0x8,%esp
+  ef:	68 5c 11 00 00       	push   $0x115c
+  f4:	68 de 0c 00 00       	push   $0xcde
+  f9:	e8 a3 03 00 00       	call   4a1 <exec>
+  fe:	83 c4 10             	add    $0x10,%esp
+      printf(1, "init: exec sh failed\n");
+ 101:	83 ec 08             	sub    $0x8,%esp
+ 104:	68 50 0d 00 00       	push   $0xd50
+ 109:	6a 01                	push   $0x1
+ 10b:	e8 c5 05 00 00       	call   6d5 <printf>
+ 110:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 113:	e8 51 03 00 00       	call   469 <exit>
+    }
+    while ((wpid = wait()) >= 0 && wpid != pid)
+ 118:	90                   	nop
+ 119:	e8 53 03 00 00       	call   471 <wait>
+ 11e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 121:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 125:	0f 88 3c ff ff ff    	js     67 <main+0x67>
+ 12b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 12e:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+ 131:	75 e6                	jne    119 <main+0x119>
+    printf(1, "init: starting sh\n");
+ 133:	e9 2f ff ff ff       	jmp    67 <main+0x67>
+
+00000138 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 138:	55                   	push   %ebp
+ 139:	89 e5                	mov    %esp,%ebp
+ 13b:	57                   	push   %edi
+ 13c:	53                   	push   %ebx
+{
+ 13d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 140:	8b 55 10             	mov    0x10(%ebp),%edx
+ 143:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 146:	89 cb                	mov    %ecx,%ebx
+ 148:	89 df                	mov    %ebx,%edi
+ 14a:	89 d1                	mov    %edx,%ecx
+ 14c:	fc                   	cld
+ 14d:	f3 aa                	rep stos %al,%es:(%edi)
+ 14f:	89 ca                	mov    %ecx,%edx
+ 151:	89 fb                	mov    %edi,%ebx
+ 153:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 156:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 159:	90                   	nop
+ 15a:	5b                   	pop    %ebx
+ 15b:	5f                   	pop    %edi
+ 15c:	5d                   	pop    %ebp
+ 15d:	c3                   	ret
+
+0000015e <strcpy>:
+{
+ 15e:	55                   	push   %ebp
+ 15f:	89 e5                	mov    %esp,%ebp
+ 161:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 164:	8b 45 08             	mov    0x8(%ebp),%eax
+ 167:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 16a:	90                   	nop
+ 16b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 16e:	8d 42 01             	lea    0x1(%edx),%eax
+ 171:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 174:	8b 45 08             	mov    0x8(%ebp),%eax
+ 177:	8d 48 01             	lea    0x1(%eax),%ecx
+ 17a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 17d:	0f b6 12             	movzbl (%edx),%edx
+ 180:	88 10                	mov    %dl,(%eax)
+ 182:	0f b6 00             	movzbl (%eax),%eax
+ 185:	84 c0                	test   %al,%al
+ 187:	75 e2                	jne    16b <strcpy+0xd>
+  return os;
+ 189:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 18c:	c9                   	leave
+ 18d:	c3                   	ret
+
+0000018e <strcmp>:
+{
+ 18e:	55                   	push   %ebp
+ 18f:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 191:	eb 08                	jmp    19b <strcmp+0xd>
+    p++, q++;
+ 193:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 197:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 19b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19e:	0f b6 00             	movzbl (%eax),%eax
+ 1a1:	84 c0                	test   %al,%al
+ 1a3:	74 10                	je     1b5 <strcmp+0x27>
+ 1a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a8:	0f b6 10             	movzbl (%eax),%edx
+ 1ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ae:	0f b6 00             	movzbl (%eax),%eax
+ 1b1:	38 c2                	cmp    %al,%dl
+ 1b3:	74 de                	je     193 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b8:	0f b6 00             	movzbl (%eax),%eax
+ 1bb:	0f b6 d0             	movzbl %al,%edx
+ 1be:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c1:	0f b6 00             	movzbl (%eax),%eax
+ 1c4:	0f b6 c0             	movzbl %al,%eax
+ 1c7:	29 c2                	sub    %eax,%edx
+ 1c9:	89 d0                	mov    %edx,%eax
+}
+ 1cb:	5d                   	pop    %ebp
+ 1cc:	c3                   	ret
+
+000001cd <strlen>:
+{
+ 1cd:	55                   	push   %ebp
+ 1ce:	89 e5                	mov    %esp,%ebp
+ 1d0:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1d3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1da:	eb 04                	jmp    1e0 <strlen+0x13>
+ 1dc:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1e0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	01 d0                	add    %edx,%eax
+ 1e8:	0f b6 00             	movzbl (%eax),%eax
+ 1eb:	84 c0                	test   %al,%al
+ 1ed:	75 ed                	jne    1dc <strlen+0xf>
+  return n;
+ 1ef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1f2:	c9                   	leave
+ 1f3:	c3                   	ret
+
+000001f4 <memset>:
+{
+ 1f4:	55                   	push   %ebp
+ 1f5:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1f7:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1fa:	50                   	push   %eax
+ 1fb:	ff 75 0c             	push   0xc(%ebp)
+ 1fe:	ff 75 08             	push   0x8(%ebp)
+ 201:	e8 32 ff ff ff       	call   138 <stosb>
+ 206:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 209:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 20c:	c9                   	leave
+ 20d:	c3                   	ret
+
+0000020e <strchr>:
+{
+ 20e:	55                   	push   %ebp
+ 20f:	89 e5                	mov    %esp,%ebp
+ 211:	83 ec 04             	sub    $0x4,%esp
+ 214:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 217:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 21a:	eb 14                	jmp    230 <strchr+0x22>
+    if(*s == c)
+ 21c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21f:	0f b6 00             	movzbl (%eax),%eax
+ 222:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 225:	75 05                	jne    22c <strchr+0x1e>
+      return (char*)s;
+ 227:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22a:	eb 13                	jmp    23f <strchr+0x31>
+  for(; *s; s++)
+ 22c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 230:	8b 45 08             	mov    0x8(%ebp),%eax
+ 233:	0f b6 00             	movzbl (%eax),%eax
+ 236:	84 c0                	test   %al,%al
+ 238:	75 e2                	jne    21c <strchr+0xe>
+  return 0;
+ 23a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 23f:	c9                   	leave
+ 240:	c3                   	ret
+
+00000241 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 241:	55                   	push   %ebp
+ 242:	89 e5                	mov    %esp,%ebp
+ 244:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 247:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 24e:	eb 42                	jmp    292 <gets+0x51>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 258:	50                   	push   %eax
+ 259:	6a 00                	push   $0x0
+ 25b:	e8 21 02 00 00       	call   481 <read>
+ 260:	83 c4 10             	add    $0x10,%esp
+ 263:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 266:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 26a:	7e 33                	jle    29f <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 26c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 26f:	8d 50 01             	lea    0x1(%eax),%edx
+ 272:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 275:	89 c2                	mov    %eax,%edx
+ 277:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27a:	01 c2                	add    %eax,%edx
+ 27c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 280:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 282:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 286:	3c 0a                	cmp    $0xa,%al
+ 288:	74 16                	je     2a0 <gets+0x5f>
+ 28a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 28e:	3c 0d                	cmp    $0xd,%al
+ 290:	74 0e                	je     2a0 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 292:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 295:	83 c0 01             	add    $0x1,%eax
+ 298:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 29b:	7f b3                	jg     250 <gets+0xf>
+ 29d:	eb 01                	jmp    2a0 <gets+0x5f>
+      break;
+ 29f:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 2a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	01 d0                	add    %edx,%eax
+ 2a8:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2ab:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2ae:	c9                   	leave
+ 2af:	c3                   	ret
+
+000002b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2b6:	83 ec 08             	sub    $0x8,%esp
+ 2b9:	6a 00                	push   $0x0
+ 2bb:	ff 75 08             	push   0x8(%ebp)
+ 2be:	e8 e6 01 00 00       	call   4a9 <open>
+ 2c3:	83 c4 10             	add    $0x10,%esp
+ 2c6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2c9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2cd:	79 07                	jns    2d6 <stat+0x26>
+    return -1;
+ 2cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2d4:	eb 25                	jmp    2fb <stat+0x4b>
+  r = fstat(fd, st);
+ 2d6:	83 ec 08             	sub    $0x8,%esp
+ 2d9:	ff 75 0c             	push   0xc(%ebp)
+ 2dc:	ff 75 f4             	push   -0xc(%ebp)
+ 2df:	e8 dd 01 00 00       	call   4c1 <fstat>
+ 2e4:	83 c4 10             	add    $0x10,%esp
+ 2e7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2ea:	83 ec 0c             	sub    $0xc,%esp
+ 2ed:	ff 75 f4             	push   -0xc(%ebp)
+ 2f0:	e8 9c 01 00 00       	call   491 <close>
+ 2f5:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2f8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2fb:	c9                   	leave
+ 2fc:	c3                   	ret
+
+000002fd <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2fd:	55                   	push   %ebp
+ 2fe:	89 e5                	mov    %esp,%ebp
+ 300:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 303:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 30a:	eb 25                	jmp    331 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 30c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 30f:	89 d0                	mov    %edx,%eax
+ 311:	c1 e0 02             	shl    $0x2,%eax
+ 314:	01 d0                	add    %edx,%eax
+ 316:	01 c0                	add    %eax,%eax
+ 318:	89 c1                	mov    %eax,%ecx
+ 31a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31d:	8d 50 01             	lea    0x1(%eax),%edx
+ 320:	89 55 08             	mov    %edx,0x8(%ebp)
+ 323:	0f b6 00             	movzbl (%eax),%eax
+ 326:	0f be c0             	movsbl %al,%eax
+ 329:	01 c8                	add    %ecx,%eax
+ 32b:	83 e8 30             	sub    $0x30,%eax
+ 32e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 331:	8b 45 08             	mov    0x8(%ebp),%eax
+ 334:	0f b6 00             	movzbl (%eax),%eax
+ 337:	3c 2f                	cmp    $0x2f,%al
+ 339:	7e 0a                	jle    345 <atoi+0x48>
+ 33b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33e:	0f b6 00             	movzbl (%eax),%eax
+ 341:	3c 39                	cmp    $0x39,%al
+ 343:	7e c7                	jle    30c <atoi+0xf>
+  return n;
+ 345:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 348:	c9                   	leave
+ 349:	c3                   	ret
+
+0000034a <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 34a:	55                   	push   %ebp
+ 34b:	89 e5                	mov    %esp,%ebp
+ 34d:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 350:	8b 45 08             	mov    0x8(%ebp),%eax
+ 353:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 356:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 359:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 35c:	eb 17                	jmp    375 <memmove+0x2b>
+    *dst++ = *src++;
+ 35e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 361:	8d 42 01             	lea    0x1(%edx),%eax
+ 364:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 367:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 36a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 36d:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 370:	0f b6 12             	movzbl (%edx),%edx
+ 373:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 375:	8b 45 10             	mov    0x10(%ebp),%eax
+ 378:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 37b:	89 55 10             	mov    %edx,0x10(%ebp)
+ 37e:	85 c0                	test   %eax,%eax
+ 380:	7f dc                	jg     35e <memmove+0x14>
+  return vdst;
+ 382:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 385:	c9                   	leave
+ 386:	c3                   	ret
+
+00000387 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 387:	55                   	push   %ebp
+ 388:	89 e5                	mov    %esp,%ebp
+ 38a:	57                   	push   %edi
+ 38b:	56                   	push   %esi
+ 38c:	83 ec 30             	sub    $0x30,%esp
+ 38f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 392:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 395:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 398:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 39b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 3a2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 3a9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3ac:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3af:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 3b2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3b5:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 3bc:	e9 89 00 00 00       	jmp    44a <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 3c1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3c4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3c7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 3cb:	01 c0                	add    %eax,%eax
+ 3cd:	89 c6                	mov    %eax,%esi
+ 3cf:	89 d7                	mov    %edx,%edi
+ 3d1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3d4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 3d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 3da:	0f ad d0             	shrd   %cl,%edx,%eax
+ 3dd:	d3 ea                	shr    %cl,%edx
+ 3df:	f6 c1 20             	test   $0x20,%cl
+ 3e2:	74 04                	je     3e8 <udiv64+0x61>
+ 3e4:	89 d0                	mov    %edx,%eax
+ 3e6:	31 d2                	xor    %edx,%edx
+ 3e8:	83 e0 01             	and    $0x1,%eax
+ 3eb:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 3ee:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 3f5:	89 f0                	mov    %esi,%eax
+ 3f7:	89 fa                	mov    %edi,%edx
+ 3f9:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 3fc:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 3ff:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 402:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 405:	8b 45 10             	mov    0x10(%ebp),%eax
+ 408:	ba 00 00 00 00       	mov    $0x0,%edx
+ 40d:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 410:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 413:	19 d1                	sbb    %edx,%ecx
+ 415:	72 2f                	jb     446 <udiv64+0xbf>
+      r -= d;
+ 417:	8b 45 10             	mov    0x10(%ebp),%eax
+ 41a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 41f:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 422:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 425:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 428:	b8 01 00 00 00       	mov    $0x1,%eax
+ 42d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 432:	0f a5 c2             	shld   %cl,%eax,%edx
+ 435:	d3 e0                	shl    %cl,%eax
+ 437:	f6 c1 20             	test   $0x20,%cl
+ 43a:	74 04                	je     440 <udiv64+0xb9>
+ 43c:	89 c2                	mov    %eax,%edx
+ 43e:	31 c0                	xor    %eax,%eax
+ 440:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 443:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 446:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 44a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 44e:	0f 89 6d ff ff ff    	jns    3c1 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 454:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 457:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 45a:	83 c4 30             	add    $0x30,%esp
+ 45d:	5e                   	pop    %esi
+ 45e:	5f                   	pop    %edi
+ 45f:	5d                   	pop    %ebp
+ 460:	c3                   	ret
+
+00000461 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 461:	b8 01 00 00 00       	mov    $0x1,%eax
+ 466:	cd 40                	int    $0x40
+ 468:	c3                   	ret
+
+00000469 <exit>:
+SYSCALL(exit)
+ 469:	b8 02 00 00 00       	mov    $0x2,%eax
+ 46e:	cd 40                	int    $0x40
+ 470:	c3                   	ret
+
+00000471 <wait>:
+SYSCALL(wait)
+ 471:	b8 03 00 00 00       	mov    $0x3,%eax
+ 476:	cd 40                	int    $0x40
+ 478:	c3                   	ret
+
+00000479 <pipe>:
+SYSCALL(pipe)
+ 479:	b8 04 00 00 00       	mov    $0x4,%eax
+ 47e:	cd 40                	int    $0x40
+ 480:	c3                   	ret
+
+00000481 <read>:
+SYSCALL(read)
+ 481:	b8 05 00 00 00       	mov    $0x5,%eax
+ 486:	cd 40                	int    $0x40
+ 488:	c3                   	ret
+
+00000489 <write>:
+SYSCALL(write)
+ 489:	b8 10 00 00 00       	mov    $0x10,%eax
+ 48e:	cd 40                	int    $0x40
+ 490:	c3                   	ret
+
+00000491 <close>:
+SYSCALL(close)
+ 491:	b8 15 00 00 00       	mov    $0x15,%eax
+ 496:	cd 40                	int    $0x40
+ 498:	c3                   	ret
+
+00000499 <kill>:
+SYSCALL(kill)
+ 499:	b8 06 00 00 00       	mov    $0x6,%eax
+ 49e:	cd 40                	int    $0x40
+ 4a0:	c3                   	ret
+
+000004a1 <exec>:
+SYSCALL(exec)
+ 4a1:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4a6:	cd 40                	int    $0x40
+ 4a8:	c3                   	ret
+
+000004a9 <open>:
+SYSCALL(open)
+ 4a9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4ae:	cd 40                	int    $0x40
+ 4b0:	c3                   	ret
+
+000004b1 <mknod>:
+SYSCALL(mknod)
+ 4b1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4b6:	cd 40                	int    $0x40
+ 4b8:	c3                   	ret
+
+000004b9 <unlink>:
+SYSCALL(unlink)
+ 4b9:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4be:	cd 40                	int    $0x40
+ 4c0:	c3                   	ret
+
+000004c1 <fstat>:
+SYSCALL(fstat)
+ 4c1:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4c6:	cd 40                	int    $0x40
+ 4c8:	c3                   	ret
+
+000004c9 <link>:
+SYSCALL(link)
+ 4c9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4ce:	cd 40                	int    $0x40
+ 4d0:	c3                   	ret
+
+000004d1 <mkdir>:
+SYSCALL(mkdir)
+ 4d1:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4d6:	cd 40                	int    $0x40
+ 4d8:	c3                   	ret
+
+000004d9 <chdir>:
+SYSCALL(chdir)
+ 4d9:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4de:	cd 40                	int    $0x40
+ 4e0:	c3                   	ret
+
+000004e1 <dup>:
+SYSCALL(dup)
+ 4e1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4e6:	cd 40                	int    $0x40
+ 4e8:	c3                   	ret
+
+000004e9 <getpid>:
+SYSCALL(getpid)
+ 4e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4ee:	cd 40                	int    $0x40
+ 4f0:	c3                   	ret
+
+000004f1 <sbrk>:
+SYSCALL(sbrk)
+ 4f1:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4f6:	cd 40                	int    $0x40
+ 4f8:	c3                   	ret
+
+000004f9 <sleep>:
+SYSCALL(sleep)
+ 4f9:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4fe:	cd 40                	int    $0x40
+ 500:	c3                   	ret
+
+00000501 <uptime>:
+SYSCALL(uptime)
+ 501:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 506:	cd 40                	int    $0x40
+ 508:	c3                   	ret
+
+00000509 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 509:	b8 16 00 00 00       	mov    $0x16,%eax
+ 50e:	cd 40                	int    $0x40
+ 510:	c3                   	ret
+
+00000511 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 511:	b8 17 00 00 00       	mov    $0x17,%eax
+ 516:	cd 40                	int    $0x40
+ 518:	c3                   	ret
+
+00000519 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 519:	b8 18 00 00 00       	mov    $0x18,%eax
+ 51e:	cd 40                	int    $0x40
+ 520:	c3                   	ret
+
+00000521 <copy_file>:
+SYSCALL(copy_file)
+ 521:	b8 19 00 00 00       	mov    $0x19,%eax
+ 526:	cd 40                	int    $0x40
+ 528:	c3                   	ret
+
+00000529 <change_queue>:
+SYSCALL(change_queue)
+ 529:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 52e:	cd 40                	int    $0x40
+ 530:	c3                   	ret
+
+00000531 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 531:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 536:	cd 40                	int    $0x40
+ 538:	c3                   	ret
+
+00000539 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 539:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 53e:	cd 40                	int    $0x40
+ 540:	c3                   	ret
+
+00000541 <print_process_info>:
+SYSCALL(print_process_info)
+ 541:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 546:	cd 40                	int    $0x40
+ 548:	c3                   	ret
+
+00000549 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 549:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 54e:	cd 40                	int    $0x40
+ 550:	c3                   	ret
+
+00000551 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 551:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 556:	cd 40                	int    $0x40
+ 558:	c3                   	ret
+
+00000559 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 559:	b8 20 00 00 00       	mov    $0x20,%eax
+ 55e:	cd 40                	int    $0x40
+ 560:	c3                   	ret
+
+00000561 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 561:	b8 21 00 00 00       	mov    $0x21,%eax
+ 566:	cd 40                	int    $0x40
+ 568:	c3                   	ret
+
+00000569 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 569:	b8 22 00 00 00       	mov    $0x22,%eax
+ 56e:	cd 40                	int    $0x40
+ 570:	c3                   	ret
+
+00000571 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 571:	b8 23 00 00 00       	mov    $0x23,%eax
+ 576:	cd 40                	int    $0x40
+ 578:	c3                   	ret
+
+00000579 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 579:	b8 24 00 00 00       	mov    $0x24,%eax
+ 57e:	cd 40                	int    $0x40
+ 580:	c3                   	ret
+
+00000581 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 581:	b8 25 00 00 00       	mov    $0x25,%eax
+ 586:	cd 40                	int    $0x40
+ 588:	c3                   	ret
+
+00000589 <set_affinity>:
+SYSCALL(set_affinity)
+ 589:	b8 26 00 00 00       	mov    $0x26,%eax
+ 58e:	cd 40                	int    $0x40
+ 590:	c3                   	ret
+
+00000591 <setsched>:
+SYSCALL(setsched)
+ 591:	b8 27 00 00 00       	mov    $0x27,%eax
+ 596:	cd 40                	int    $0x40
+ 598:	c3                   	ret
+
+00000599 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 599:	b8 28 00 00 00       	mov    $0x28,%eax
+ 59e:	cd 40                	int    $0x40
+ 5a0:	c3                   	ret
+
+000005a1 <set_quantum>:
+SYSCALL(set_quantum)
+ 5a1:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5a6:	cd 40                	int    $0x40
+ 5a8:	c3                   	ret
+
+000005a9 <schedtrace>:
+SYSCALL(schedtrace)
+ 5a9:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5ae:	cd 40                	int    $0x40
+ 5b0:	c3                   	ret
+
+000005b1 <getrusage>:
+SYSCALL(getrusage)
+ 5b1:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5b6:	cd 40                	int    $0x40
+ 5b8:	c3                   	ret
+
+000005b9 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 5b9:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5be:	cd 40                	int    $0x40
+ 5c0:	c3                   	ret
+
+000005c1 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 5c1:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5c6:	cd 40                	int    $0x40
+ 5c8:	c3                   	ret
+
+000005c9 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 5c9:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5ce:	cd 40                	int    $0x40
+ 5d0:	c3                   	ret
+
+000005d1 <futex_wait>:
+SYSCALL(futex_wait)
+ 5d1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5d6:	cd 40                	int    $0x40
+ 5d8:	c3                   	ret
+
+000005d9 <futex_wake>:
+SYSCALL(futex_wake)
+ 5d9:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5de:	cd 40                	int    $0x40
+ 5e0:	c3                   	ret
+
+000005e1 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 5e1:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5e6:	cd 40                	int    $0x40
+ 5e8:	c3                   	ret
+
+000005e9 <submit_batch>:
+SYSCALL(submit_batch)
+ 5e9:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5ee:	cd 40                	int    $0x40
+ 5f0:	c3                   	ret
+
+000005f1 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 5f1:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5f6:	cd 40                	int    $0x40
+ 5f8:	c3                   	ret
+
+000005f9 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 5f9:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5fe:	cd 40                	int    $0x40
+ 600:	c3                   	ret
+
+00000601 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 601:	55                   	push   %ebp
+ 602:	89 e5                	mov    %esp,%ebp
+ 604:	83 ec 18             	sub    $0x18,%esp
+ 607:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 60a:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 60d:	83 ec 04             	sub    $0x4,%esp
+ 610:	6a 01                	push   $0x1
+ 612:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 615:	50                   	push   %eax
+ 616:	ff 75 08             	push   0x8(%ebp)
+ 619:	e8 6b fe ff ff       	call   489 <write>
+ 61e:	83 c4 10             	add    $0x10,%esp
+}
+ 621:	90                   	nop
+ 622:	c9                   	leave
+ 623:	c3                   	ret
+
+00000624 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 624:	55                   	push   %ebp
+ 625:	89 e5                	mov    %esp,%ebp
+ 627:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 62a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 631:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 635:	74 17                	je     64e <printint+0x2a>
+ 637:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 63b:	79 11                	jns    64e <printint+0x2a>
+    neg = 1;
+ 63d:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 644:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 647:	f7 d8                	neg    %eax
+ 649:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 64c:	eb 06                	jmp    654 <printint+0x30>
+  } else {
+    x = xx;
+ 64e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 651:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 654:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 65b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 65e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 661:	ba 00 00 00 00       	mov    $0x0,%edx
+ 666:	f7 f1                	div    %ecx
+ 668:	89 d1                	mov    %edx,%ecx
+ 66a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 66d:	8d 50 01             	lea    0x1(%eax),%edx
+ 670:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 673:	0f b6 91 64 11 00 00 	movzbl 0x1164(%ecx),%edx
+ 67a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 67e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 681:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 684:	ba 00 00 00 00       	mov    $0x0,%edx
+ 689:	f7 f1                	div    %ecx
+ 68b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 68e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 692:	75 c7                	jne    65b <printint+0x37>
+  if(neg)
+ 694:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 698:	74 2d                	je     6c7 <printint+0xa3>
+    buf[i++] = '-';
+ 69a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 69d:	8d 50 01             	lea    0x1(%eax),%edx
+ 6a0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6a3:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 6a8:	eb 1d                	jmp    6c7 <printint+0xa3>
+    putc(fd, buf[i]);
+ 6aa:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6b0:	01 d0                	add    %edx,%eax
+ 6b2:	0f b6 00             	movzbl (%eax),%eax
+ 6b5:	0f be c0             	movsbl %al,%eax
+ 6b8:	83 ec 08             	sub    $0x8,%esp
+ 6bb:	50                   	push   %eax
+ 6bc:	ff 75 08             	push   0x8(%ebp)
+ 6bf:	e8 3d ff ff ff       	call   601 <putc>
+ 6c4:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 6c7:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 6cb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6cf:	79 d9                	jns    6aa <printint+0x86>
+}
+ 6d1:	90                   	nop
+ 6d2:	90                   	nop
+ 6d3:	c9                   	leave
+ 6d4:	c3                   	ret
+
+000006d5 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6d5:	55                   	push   %ebp
+ 6d6:	89 e5                	mov    %esp,%ebp
+ 6d8:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 6db:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6e2:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6e5:	83 c0 04             	add    $0x4,%eax
+ 6e8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6eb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6f2:	e9 59 01 00 00       	jmp    850 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 6f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6fa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6fd:	01 d0                	add    %edx,%eax
+ 6ff:	0f b6 00             	movzbl (%eax),%eax
+ 702:	0f be c0             	movsbl %al,%eax
+ 705:	25 ff 00 00 00       	and    $0xff,%eax
+ 70a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 70d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 711:	75 2c                	jne    73f <printf+0x6a>
+      if(c == '%'){
+ 713:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 717:	75 0c                	jne    725 <printf+0x50>
+        state = '%';
+ 719:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 720:	e9 27 01 00 00       	jmp    84c <printf+0x177>
+      } else {
+        putc(fd, c);
+ 725:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 728:	0f be c0             	movsbl %al,%eax
+ 72b:	83 ec 08             	sub    $0x8,%esp
+ 72e:	50                   	push   %eax
+ 72f:	ff 75 08             	push   0x8(%ebp)
+ 732:	e8 ca fe ff ff       	call   601 <putc>
+ 737:	83 c4 10             	add    $0x10,%esp
+ 73a:	e9 0d 01 00 00       	jmp    84c <printf+0x177>
+      }
+    } else if(state == '%'){
+ 73f:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 743:	0f 85 03 01 00 00    	jne    84c <printf+0x177>
+      if(c == 'd'){
+ 749:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 74d:	75 1e                	jne    76d <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 74f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 752:	8b 00                	mov    (%eax),%eax
+ 754:	6a 01                	push   $0x1
+ 756:	6a 0a                	push   $0xa
+ 758:	50                   	push   %eax
+ 759:	ff 75 08             	push   0x8(%ebp)
+ 75c:	e8 c3 fe ff ff       	call   624 <printint>
+ 761:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 764:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 768:	e9 d8 00 00 00       	jmp    845 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 76d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 771:	74 06                	je     779 <printf+0xa4>
+ 773:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 777:	75 1e                	jne    797 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 779:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 77c:	8b 00                	mov    (%eax),%eax
+ 77e:	6a 00                	push   $0x0
+ 780:	6a 10                	push   $0x10
+ 782:	50                   	push   %eax
+ 783:	ff 75 08             	push   0x8(%ebp)
+ 786:	e8 99 fe ff ff       	call   624 <printint>
+ 78b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 78e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 792:	e9 ae 00 00 00       	jmp    845 <printf+0x170>
+      } else if(c == 's'){
+ 797:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 79b:	75 43                	jne    7e0 <printf+0x10b>
+        s = (char*)*ap;
+ 79d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7a0:	8b 00                	mov    (%eax),%eax
+ 7a2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 7a5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 7a9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7ad:	75 25                	jne    7d4 <printf+0xff>
+          s = "(null)";
+ 7af:	c7 45 f4 66 0d 00 00 	movl   $0xd66,-0xc(%ebp)
+        while(*s != 0){
+ 7b6:	eb 1c                	jmp    7d4 <printf+0xff>
+          putc(fd, *s);
+ 7b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7bb:	0f b6 00             	movzbl (%eax),%eax
+ 7be:	0f be c0             	movsbl %al,%eax
+ 7c1:	83 ec 08             	sub    $0x8,%esp
+ 7c4:	50                   	push   %eax
+ 7c5:	ff 75 08             	push   0x8(%ebp)
+ 7c8:	e8 34 fe ff ff       	call   601 <putc>
+ 7cd:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 7d0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 7d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d7:	0f b6 00             	movzbl (%eax),%eax
+ 7da:	84 c0                	test   %al,%al
+ 7dc:	75 da                	jne    7b8 <printf+0xe3>
+ 7de:	eb 65                	jmp    845 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 7e0:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 7e4:	75 1d                	jne    803 <printf+0x12e>
+        putc(fd, *ap);
+ 7e6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7e9:	8b 00                	mov    (%eax),%eax
+ 7eb:	0f be c0             	movsbl %al,%eax
+ 7ee:	83 ec 08             	sub    $0x8,%esp
+ 7f1:	50                   	push   %eax
+ 7f2:	ff 75 08             	push   0x8(%ebp)
+ 7f5:	e8 07 fe ff ff       	call   601 <putc>
+ 7fa:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7fd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 801:	eb 42                	jmp    845 <printf+0x170>
+      } else if(c == '%'){
+ 803:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 807:	75 17                	jne    820 <printf+0x14b>
+        putc(fd, c);
+ 809:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 80c:	0f be c0             	movsbl %al,%eax
+ 80f:	83 ec 08             	sub    $0x8,%esp
+ 812:	50                   	push   %eax
+ 813:	ff 75 08             	push   0x8(%ebp)
+ 816:	e8 e6 fd ff ff       	call   601 <putc>
+ 81b:	83 c4 10             	add    $0x10,%esp
+ 81e:	eb 25                	jmp    845 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 820:	83 ec 08             	sub    $0x8,%esp
+ 823:	6a 25                	push   $0x25
+ 825:	ff 75 08             	push   0x8(%ebp)
+ 828:	e8 d4 fd ff ff       	call   601 <putc>
+ 82d:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 830:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 833:	0f be c0             	movsbl %al,%eax
+ 836:	83 ec 08             	sub    $0x8,%esp
+ 839:	50                   	push   %eax
+ 83a:	ff 75 08             	push   0x8(%ebp)
+ 83d:	e8 bf fd ff ff       	call   601 <putc>
+ 842:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 845:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 84c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 850:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 853:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 856:	01 d0                	add    %edx,%eax
+ 858:	0f b6 00             	movzbl (%eax),%eax
+ 85b:	84 c0                	test   %al,%al
+ 85d:	0f 85 94 fe ff ff    	jne    6f7 <printf+0x22>
+    }
+  }
+}
+ 863:	90                   	nop
+ 864:	90                   	nop
+ 865:	c9                   	leave
+ 866:	c3                   	ret
+
+00000867 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 867:	55                   	push   %ebp
+ 868:	89 e5                	mov    %esp,%ebp
+ 86a:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 86d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 870:	83 e8 08             	sub    $0x8,%eax
+ 873:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 876:	a1 80 11 00 00       	mov    0x1180,%eax
+ 87b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 87e:	eb 24                	jmp    8a4 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 880:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 883:	8b 00                	mov    (%eax),%eax
+ 885:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 888:	72 12                	jb     89c <free+0x35>
+ 88a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 88d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 890:	72 24                	jb     8b6 <free+0x4f>
+ 892:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 895:	8b 00                	mov    (%eax),%eax
+ 897:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 89a:	72 1a                	jb     8b6 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 89c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89f:	8b 00                	mov    (%eax),%eax
+ 8a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8a4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8a7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8aa:	73 d4                	jae    880 <free+0x19>
+ 8ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8af:	8b 00                	mov    (%eax),%eax
+ 8b1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8b4:	73 ca                	jae    880 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8b6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8b9:	8b 40 04             	mov    0x4(%eax),%eax
+ 8bc:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8c3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c6:	01 c2                	add    %eax,%edx
+ 8c8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8cb:	8b 00                	mov    (%eax),%eax
+ 8cd:	39 c2                	cmp    %eax,%edx
+ 8cf:	75 24                	jne    8f5 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 8d1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d4:	8b 50 04             	mov    0x4(%eax),%edx
+ 8d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8da:	8b 00                	mov    (%eax),%eax
+ 8dc:	8b 40 04             	mov    0x4(%eax),%eax
+ 8df:	01 c2                	add    %eax,%edx
+ 8e1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e4:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ea:	8b 00                	mov    (%eax),%eax
+ 8ec:	8b 10                	mov    (%eax),%edx
+ 8ee:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8f1:	89 10                	mov    %edx,(%eax)
+ 8f3:	eb 0a                	jmp    8ff <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 8f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f8:	8b 10                	mov    (%eax),%edx
+ 8fa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8fd:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 8ff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 902:	8b 40 04             	mov    0x4(%eax),%eax
+ 905:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 90c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 90f:	01 d0                	add    %edx,%eax
+ 911:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 914:	75 20                	jne    936 <free+0xcf>
+    p->s.size += bp->s.size;
+ 916:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 919:	8b 50 04             	mov    0x4(%eax),%edx
+ 91c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 91f:	8b 40 04             	mov    0x4(%eax),%eax
+ 922:	01 c2                	add    %eax,%edx
+ 924:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 927:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 92a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 92d:	8b 10                	mov    (%eax),%edx
+ 92f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 932:	89 10                	mov    %edx,(%eax)
+ 934:	eb 08                	jmp    93e <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 936:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 939:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 93c:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 93e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 941:	a3 80 11 00 00       	mov    %eax,0x1180
+}
+ 946:	90                   	nop
+ 947:	c9                   	leave
+ 948:	c3                   	ret
+
+00000949 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 949:	55                   	push   %ebp
+ 94a:	89 e5                	mov    %esp,%ebp
+ 94c:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 94f:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 956:	77 07                	ja     95f <morecore+0x16>
+    nu = 4096;
+ 958:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 95f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 962:	c1 e0 03             	shl    $0x3,%eax
+ 965:	83 ec 0c             	sub    $0xc,%esp
+ 968:	50                   	push   %eax
+ 969:	e8 83 fb ff ff       	call   4f1 <sbrk>
+ 96e:	83 c4 10             	add    $0x10,%esp
+ 971:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 974:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 978:	75 07                	jne    981 <morecore+0x38>
+    return 0;
+ 97a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 97f:	eb 26                	jmp    9a7 <morecore+0x5e>
+  hp = (Header*)p;
+ 981:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 984:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 987:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 98a:	8b 55 08             	mov    0x8(%ebp),%edx
+ 98d:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 990:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 993:	83 c0 08             	add    $0x8,%eax
+ 996:	83 ec 0c             	sub    $0xc,%esp
+ 999:	50                   	push   %eax
+ 99a:	e8 c8 fe ff ff       	call   867 <free>
+ 99f:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 9a2:	a1 80 11 00 00       	mov    0x1180,%eax
+}
+ 9a7:	c9                   	leave
+ 9a8:	c3                   	ret
+
+000009a9 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9a9:	55                   	push   %ebp
+ 9aa:	89 e5                	mov    %esp,%ebp
+ 9ac:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9af:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9b2:	83 c0 07             	add    $0x7,%eax
+ 9b5:	c1 e8 03             	shr    $0x3,%eax
+ 9b8:	83 c0 01             	add    $0x1,%eax
+ 9bb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 9be:	a1 80 11 00 00       	mov    0x1180,%eax
+ 9c3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9c6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9ca:	75 23                	jne    9ef <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 9cc:	c7 45 f0 78 11 00 00 	movl   $0x1178,-0x10(%ebp)
+ 9d3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9d6:	a3 80 11 00 00       	mov    %eax,0x1180
+ 9db:	a1 80 11 00 00       	mov    0x1180,%eax
+ 9e0:	a3 78 11 00 00       	mov    %eax,0x1178
+    base.s.size = 0;
+ 9e5:	c7 05 7c 11 00 00 00 	movl   $0x0,0x117c
+ 9ec:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9ef:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9f2:	8b 00                	mov    (%eax),%eax
+ 9f4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9fa:	8b 40 04             	mov    0x4(%eax),%eax
+ 9fd:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a00:	72 4d                	jb     a4f <malloc+0xa6>
+      if(p->s.size == nunits)
+ a02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a05:	8b 40 04             	mov    0x4(%eax),%eax
+ a08:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a0b:	75 0c                	jne    a19 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a10:	8b 10                	mov    (%eax),%edx
+ a12:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a15:	89 10                	mov    %edx,(%eax)
+ a17:	eb 26                	jmp    a3f <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a1c:	8b 40 04             	mov    0x4(%eax),%eax
+ a1f:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a22:	89 c2                	mov    %eax,%edx
+ a24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a27:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a2d:	8b 40 04             	mov    0x4(%eax),%eax
+ a30:	c1 e0 03             	shl    $0x3,%eax
+ a33:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a39:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a3c:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a3f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a42:	a3 80 11 00 00       	mov    %eax,0x1180
+      return (void*)(p + 1);
+ a47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a4a:	83 c0 08             	add    $0x8,%eax
+ a4d:	eb 3b                	jmp    a8a <malloc+0xe1>
+    }
+    if(p == freep)
+ a4f:	a1 80 11 00 00       	mov    0x1180,%eax
+ a54:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a57:	75 1e                	jne    a77 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a59:	83 ec 0c             	sub    $0xc,%esp
+ a5c:	ff 75 ec             	push   -0x14(%ebp)
+ a5f:	e8 e5 fe ff ff       	call   949 <morecore>
+ a64:	83 c4 10             	add    $0x10,%esp
+ a67:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a6a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a6e:	75 07                	jne    a77 <malloc+0xce>
+        return 0;
+ a70:	b8 00 00 00 00       	mov    $0x0,%eax
+ a75:	eb 13                	jmp    a8a <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a7a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a80:	8b 00                	mov    (%eax),%eax
+ a82:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a85:	e9 6d ff ff ff       	jmp    9f7 <malloc+0x4e>
+  }
+}
+ a8a:	c9                   	leave
+ a8b:	c3                   	ret
+
+00000a8c <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ a8c:	55                   	push   %ebp
+ a8d:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ a8f:	8b 45 08             	mov    0x8(%ebp),%eax
+ a92:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ a98:	90                   	nop
+ a99:	5d                   	pop    %ebp
+ a9a:	c3                   	ret
+
+00000a9b <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ a9b:	55                   	push   %ebp
+ a9c:	89 e5                	mov    %esp,%ebp
+ a9e:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ aa1:	8b 55 08             	mov    0x8(%ebp),%edx
+ aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+ aa9:	b9 01 00 00 00       	mov    $0x1,%ecx
+ aae:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ ab2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ab5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ab9:	74 3b                	je     af6 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ abb:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ abf:	74 2d                	je     aee <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ ac1:	8b 55 08             	mov    0x8(%ebp),%edx
+ ac4:	b8 02 00 00 00       	mov    $0x2,%eax
+ ac9:	87 02                	xchg   %eax,(%edx)
+ acb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ ace:	eb 1e                	jmp    aee <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ ad0:	8b 45 08             	mov    0x8(%ebp),%eax
+ ad3:	83 ec 08             	sub    $0x8,%esp
+ ad6:	6a 02                	push   $0x2
+ ad8:	50                   	push   %eax
+ ad9:	e8 f3 fa ff ff       	call   5d1 <futex_wait>
+ ade:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ ae1:	8b 55 08             	mov    0x8(%ebp),%edx
+ ae4:	b8 02 00 00 00       	mov    $0x2,%eax
+ ae9:	87 02                	xchg   %eax,(%edx)
+ aeb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ aee:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ af2:	75 dc                	jne    ad0 <mutex_lock+0x35>
+ af4:	eb 01                	jmp    af7 <mutex_lock+0x5c>
+    return;
+ af6:	90                   	nop
+  }
+}
+ af7:	c9                   	leave
+ af8:	c3                   	ret
+
+00000af9 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ af9:	55                   	push   %ebp
+ afa:	89 e5                	mov    %esp,%ebp
+ afc:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ aff:	8b 45 08             	mov    0x8(%ebp),%eax
+ b02:	ba 01 00 00 00       	mov    $0x1,%edx
+ b07:	f7 da                	neg    %edx
+ b09:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ b0d:	83 fa 01             	cmp    $0x1,%edx
+ b10:	74 1a                	je     b2c <mutex_unlock+0x33>
+    m->state = 0;
+ b12:	8b 45 08             	mov    0x8(%ebp),%eax
+ b15:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ b1b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b1e:	83 ec 08             	sub    $0x8,%esp
+ b21:	6a 01                	push   $0x1
+ b23:	50                   	push   %eax
+ b24:	e8 b0 fa ff ff       	call   5d9 <futex_wake>
+ b29:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ b2c:	90                   	nop
+ b2d:	c9                   	leave
+ b2e:	c3                   	ret
+
+00000b2f <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ b2f:	55                   	push   %ebp
+ b30:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ b32:	8b 45 08             	mov    0x8(%ebp),%eax
+ b35:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ b3b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b3e:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ b45:	90                   	nop
+ b46:	5d                   	pop    %ebp
+ b47:	c3                   	ret
+
+00000b48 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ b48:	55                   	push   %ebp
+ b49:	89 e5                	mov    %esp,%ebp
+ b4b:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ b4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b51:	83 c0 04             	add    $0x4,%eax
+ b54:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ b58:	8b 45 08             	mov    0x8(%ebp),%eax
+ b5b:	83 ec 08             	sub    $0x8,%esp
+ b5e:	ff 75 0c             	push   0xc(%ebp)
+ b61:	50                   	push   %eax
+ b62:	e8 6a fa ff ff       	call   5d1 <futex_wait>
+ b67:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ b6a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6d:	83 c0 04             	add    $0x4,%eax
+ b70:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ b74:	90                   	nop
+ b75:	c9                   	leave
+ b76:	c3                   	ret
+
+00000b77 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ b77:	55                   	push   %ebp
+ b78:	89 e5                	mov    %esp,%ebp
+ b7a:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ b7d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b80:	8b 00                	mov    (%eax),%eax
+ b82:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ b85:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b89:	78 17                	js     ba2 <rwlock_rdlock+0x2b>
+ b8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b8e:	83 c0 01             	add    $0x1,%eax
+ b91:	89 c1                	mov    %eax,%ecx
+ b93:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b96:	8b 55 08             	mov    0x8(%ebp),%edx
+ b99:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b9d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ ba0:	74 19                	je     bbb <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ ba2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ba6:	79 d5                	jns    b7d <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ ba8:	83 ec 08             	sub    $0x8,%esp
+ bab:	ff 75 f4             	push   -0xc(%ebp)
+ bae:	ff 75 08             	push   0x8(%ebp)
+ bb1:	e8 92 ff ff ff       	call   b48 <rwlock_sleep>
+ bb6:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ bb9:	eb c2                	jmp    b7d <rwlock_rdlock+0x6>
+      return;
+ bbb:	90                   	nop
+  }
+}
+ bbc:	c9                   	leave
+ bbd:	c3                   	ret
+
+00000bbe <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ bbe:	55                   	push   %ebp
+ bbf:	89 e5                	mov    %esp,%ebp
+ bc1:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ bc4:	eb 11                	jmp    bd7 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ bc6:	83 ec 08             	sub    $0x8,%esp
+ bc9:	ff 75 f4             	push   -0xc(%ebp)
+ bcc:	ff 75 08             	push   0x8(%ebp)
+ bcf:	e8 74 ff ff ff       	call   b48 <rwlock_sleep>
+ bd4:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ bd7:	8b 55 08             	mov    0x8(%ebp),%edx
+ bda:	b8 00 00 00 00       	mov    $0x0,%eax
+ bdf:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ be4:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ be8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ beb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bef:	75 d5                	jne    bc6 <rwlock_wrlock+0x8>
+}
+ bf1:	90                   	nop
+ bf2:	90                   	nop
+ bf3:	c9                   	leave
+ bf4:	c3                   	ret
+
+00000bf5 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ bf5:	55                   	push   %ebp
+ bf6:	89 e5                	mov    %esp,%ebp
+ bf8:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ bfb:	8b 45 08             	mov    0x8(%ebp),%eax
+ bfe:	8b 00                	mov    (%eax),%eax
+ c00:	85 c0                	test   %eax,%eax
+ c02:	79 0c                	jns    c10 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ c04:	8b 45 08             	mov    0x8(%ebp),%eax
+ c07:	ba 00 00 00 00       	mov    $0x0,%edx
+ c0c:	87 10                	xchg   %edx,(%eax)
+ c0e:	eb 18                	jmp    c28 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ c10:	8b 55 08             	mov    0x8(%ebp),%edx
+ c13:	b8 01 00 00 00       	mov    $0x1,%eax
+ c18:	f7 d8                	neg    %eax
+ c1a:	89 c1                	mov    %eax,%ecx
+ c1c:	89 c8                	mov    %ecx,%eax
+ c1e:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ c22:	01 c8                	add    %ecx,%eax
+ c24:	85 c0                	test   %eax,%eax
+ c26:	75 20                	jne    c48 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ c28:	8b 45 08             	mov    0x8(%ebp),%eax
+ c2b:	8b 40 04             	mov    0x4(%eax),%eax
+ c2e:	85 c0                	test   %eax,%eax
+ c30:	74 17                	je     c49 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ c32:	8b 45 08             	mov    0x8(%ebp),%eax
+ c35:	83 ec 08             	sub    $0x8,%esp
+ c38:	68 ff ff ff 7f       	push   $0x7fffffff
+ c3d:	50                   	push   %eax
+ c3e:	e8 96 f9 ff ff       	call   5d9 <futex_wake>
+ c43:	83 c4 10             	add    $0x10,%esp
+ c46:	eb 01                	jmp    c49 <rwlock_unlock+0x54>
+    return;
+ c48:	90                   	nop
+}
+ c49:	c9                   	leave
+ c4a:	c3                   	ret
+
+00000c4b <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ c4b:	55                   	push   %ebp
+ c4c:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ c4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c51:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c57:	90                   	nop
+ c58:	5d                   	pop    %ebp
+ c59:	c3                   	ret
+
+00000c5a <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ c5a:	55                   	push   %ebp
+ c5b:	89 e5                	mov    %esp,%ebp
+ c5d:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ c60:	8b 45 08             	mov    0x8(%ebp),%eax
+ c63:	8b 00                	mov    (%eax),%eax
+ c65:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ c68:	83 ec 0c             	sub    $0xc,%esp
+ c6b:	ff 75 0c             	push   0xc(%ebp)
+ c6e:	e8 86 fe ff ff       	call   af9 <mutex_unlock>
+ c73:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ c76:	8b 45 08             	mov    0x8(%ebp),%eax
+ c79:	83 ec 08             	sub    $0x8,%esp
+ c7c:	ff 75 f4             	push   -0xc(%ebp)
+ c7f:	50                   	push   %eax
+ c80:	e8 4c f9 ff ff       	call   5d1 <futex_wait>
+ c85:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ c88:	83 ec 0c             	sub    $0xc,%esp
+ c8b:	ff 75 0c             	push   0xc(%ebp)
+ c8e:	e8 08 fe ff ff       	call   a9b <mutex_lock>
+ c93:	83 c4 10             	add    $0x10,%esp
+}
+ c96:	90                   	nop
+ c97:	c9                   	leave
+ c98:	c3                   	ret
+
+00000c99 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ c99:	55                   	push   %ebp
+ c9a:	89 e5                	mov    %esp,%ebp
+ c9c:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c9f:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca2:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca9:	83 ec 08             	sub    $0x8,%esp
+ cac:	6a 01                	push   $0x1
+ cae:	50                   	push   %eax
+ caf:	e8 25 f9 ff ff       	call   5d9 <futex_wake>
+ cb4:	83 c4 10             	add    $0x10,%esp
+}
+ cb7:	90                   	nop
+ cb8:	c9                   	leave
+ cb9:	c3                   	ret
+
+00000cba <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ cba:	55                   	push   %ebp
+ cbb:	89 e5                	mov    %esp,%ebp
+ cbd:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ cc0:	8b 45 08             	mov    0x8(%ebp),%eax
+ cc3:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ cc7:	8b 45 08             	mov    0x8(%ebp),%eax
+ cca:	83 ec 08             	sub    $0x8,%esp
+ ccd:	68 ff ff ff 7f       	push   $0x7fffffff
+ cd2:	50                   	push   %eax
+ cd3:	e8 01 f9 ff ff       	call   5d9 <futex_wake>
+ cd8:	83 c4 10             	add    $0x10,%esp
+}
+ cdb:	90                   	nop
+ cdc:	c9                   	leave
+ cdd:	c3                   	ret
@@ -8,6 +8,11 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "kmemstat.h"
+
+#define KSTEAL 32  // Pages a CPU takes at once when its free list runs dry
+#define KZPOOL 16  // Pages kept zeroed for kzalloc(), per CPU
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -17,10 +22,28 @@ struct run {
   struct run *next;
 };
 
+// A CPU's own free pages, and its pool of pages zeroed ahead of
+// time for kzalloc(). kalloc(), kfree() and kzalloc() only touch
+// the one of the CPU they run on, so its lock is contended only
+// by another CPU stealing from it or filling its pool.
+struct kcpu {
+  struct spinlock lock;
+  struct run *freelist;
+  struct run *zerolist;
+  int nzero;                   // Length of zerolist
+  struct kmemstat stat;
+} __attribute__((aligned(CACHELINE)));
+
+static char* kztake(struct kcpu*, int);
+
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  int junk;                    // Fill freed pages with junk
+  struct run *freelist;        // Pages no CPU has taken yet
+  int nfree;                   // Length of freelist
+  struct kcpu cpus[NCPU];
+  uchar ref[PHYSTOP / PGSIZE]; // References to each allocated page
 } kmem;
 
 // Initialization happens in two phases.
@@ -28,11 +51,17 @@ struct {
 // the pages mapped by entrypgdir on free list.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// Both fill the global free list, which the CPUs then steal from.
 void
 kinit1(void *vstart, void *vend)
 {
+  int i;
+
   initlock(&kmem.lock, "kmem");
+  for(i = 0; i < NCPU; i++)
+    initlock(&kmem.cpus[i].lock, "kmemcpu");
   kmem.use_lock = 0;
+  kmem.junk = KJUNK;
   freerange(vstart, vend);
 }
 
@@ -48,32 +77,114 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    kmem.ref[V2P(p) / PGSIZE] = 1;
     kfree(p);
+  }
+}
+
+// Take up to n pages off *list, returning them as a chain.
+static struct run*
+take(struct run **list, int n, int *got)
+{
+  struct run *head, *r;
+
+  head = r = *list;
+  *got = 0;
+  if(r == 0)
+    return 0;
+  for(*got = 1; *got < n && r->next; (*got)++)
+    r = r->next;
+  *list = r->next;
+  r->next = 0;
+  return head;
+}
+
+// Refill the empty free list of c: a batch from the global
+// list if it has any left, otherwise half of the longest
+// list of another CPU, up to KSTEAL pages. Only one lock is
+// held at a time, so CPUs stealing from each other cannot
+// deadlock. Called with interrupts off.
+static void
+steal(struct kcpu *c)
+{
+  struct kcpu *v, *victim;
+  struct run *chain, *r;
+  int n;
+
+  acquire(&kmem.lock);
+  chain = take(&kmem.freelist, KSTEAL, &n);
+  kmem.nfree -= n;
+  release(&kmem.lock);
+
+  if(chain == 0){
+    victim = 0;
+    for(v = kmem.cpus; v < &kmem.cpus[ncpu]; v++)
+      if(v != c && (victim == 0 || v->stat.nfree > victim->stat.nfree))
+        victim = v;
+    if(victim == 0)
+      return;
+    acquire(&victim->lock);
+    chain = take(&victim->freelist, (victim->stat.nfree + 1) / 2 < KSTEAL ?
+                 (victim->stat.nfree + 1) / 2 : KSTEAL, &n);
+    victim->stat.nfree -= n;
+    release(&victim->lock);
+    if(chain == 0)
+      return;
+  }
+
+  acquire(&c->lock);
+  for(r = chain; r->next; r = r->next)
+    ;
+  r->next = c->freelist;
+  c->freelist = chain;
+  c->stat.nfree += n;
+  c->stat.steals++;
+  c->stat.stolen += n;
+  release(&c->lock);
 }
+
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
-// call to kalloc().  (The exception is when
-// initializing the allocator; see kinit above.)
+// Drop a reference to the page of physical memory pointed
+// at by v, which normally should have been returned by a
+// call to kalloc(), and free it with the last reference.
+// (The exception is when initializing the allocator;
+// see kinit above.)
 void
 kfree(char *v)
 {
   struct run *r;
+  struct kcpu *c;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  if(kmem.ref[V2P(v) / PGSIZE] == 0)
+    panic("kfree: free page");
+  if(__sync_sub_and_fetch(&kmem.ref[V2P(v) / PGSIZE], 1) > 0)
+    return;
+
   // Fill with junk to catch dangling refs.
-  memset(v, 1, PGSIZE);
+  if(kmem.junk)
+    memset(v, 1, PGSIZE);
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  if(!kmem.use_lock){
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    kmem.nfree++;
+    return;
+  }
+
+  pushcli();
+  c = &kmem.cpus[cpuid()];
+  acquire(&c->lock);
+  r->next = c->freelist;
+  c->freelist = r;
+  c->stat.nfree++;
+  c->stat.frees++;
+  release(&c->lock);
+  popcli();
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -81,16 +192,168 @@ kfree(char *v)
 // Returns 0 if the memory cannot be allocated.
 char*
 kalloc(void)
+{
+  struct run *r;
+  struct kcpu *c;
+
+  if(!kmem.use_lock){
+    r = kmem.freelist;
+    if(r){
+      kmem.freelist = r->next;
+      kmem.nfree--;
+      kmem.ref[V2P(r) / PGSIZE] = 1;
+    }
+    return (char*)r;
+  }
+
+  pushcli();
+  c = &kmem.cpus[cpuid()];
+  if(c->freelist == 0)
+    steal(c);
+  acquire(&c->lock);
+  r = c->freelist;
+  if(r){
+    c->freelist = r->next;
+    c->stat.nfree--;
+    c->stat.allocs++;
+    kmem.ref[V2P(r) / PGSIZE] = 1;
+  }
+  release(&c->lock);
+  popcli();
+  // Out of free pages: use the zeroed ones.
+  for(c = kmem.cpus; r == 0 && c < &kmem.cpus[ncpu]; c++)
+    r = (struct run*)kztake(c, 0);
+  return (char*)r;
+}
+
+// Take a page off c's zeroed pool, if it has any. zeroed says
+// whether the caller is kzalloc() wanting it for that.
+static char*
+kztake(struct kcpu *c, int zeroed)
 {
   struct run *r;
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  if(c->nzero == 0)
+    return 0;
+  acquire(&c->lock);
+  r = c->zerolist;
+  if(r){
+    c->zerolist = r->next;
+    c->nzero--;
+    if(zeroed)
+      c->stat.zhits++;
+  }
+  release(&c->lock);
+  if(r && zeroed)
+    r->next = 0; // The only word the list dirtied
   return (char*)r;
 }
 
+// Allocate one zeroed page, from this CPU's pool that idle
+// CPUs keep filled when it has one, so the caller need not
+// clear it. Returns 0 if the memory cannot be allocated.
+char*
+kzalloc(void)
+{
+  char *v;
+
+  if(kmem.use_lock){
+    pushcli();
+    v = kztake(&kmem.cpus[cpuid()], 1);
+    popcli();
+    if(v)
+      return v;
+  }
+  if((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Zero one page for the emptiest CPU's kzalloc() pool, in time
+// this CPU would otherwise spend halted; CPUs that are busy
+// allocating never idle to fill their own. Returns 0 if every
+// pool is full or memory is short, so the CPU should halt.
+int
+kzfill(void)
+{
+  struct kcpu *c, *emptiest;
+  struct run *r;
+
+  if(!kmem.use_lock)
+    return 0;
+  emptiest = kmem.cpus;
+  for(c = kmem.cpus; c < &kmem.cpus[ncpu]; c++)
+    if(c->nzero < emptiest->nzero)
+      emptiest = c;
+  if(emptiest->nzero >= KZPOOL || (r = (struct run*)kalloc()) == 0)
+    return 0;
+  memset(r, 0, PGSIZE);
+  acquire(&emptiest->lock);
+  if(emptiest->nzero >= KZPOOL){
+    release(&emptiest->lock);
+    kfree((char*)r);
+    return 0;
+  }
+  r->next = emptiest->zerolist;
+  emptiest->zerolist = r;
+  emptiest->nzero++;
+  emptiest->stat.zfills++;
+  release(&emptiest->lock);
+  return 1;
+}
+
+// Number of free pages, zeroed ones included. Read without
+// the locks, so only an estimate while CPUs allocate.
+int
+kfreepages(void)
+{
+  struct kcpu *c;
+  int n;
+
+  n = kmem.nfree;
+  for(c = kmem.cpus; c < &kmem.cpus[ncpu]; c++)
+    n += c->stat.nfree + c->nzero;
+  return n;
+}
+
+// Turn junk-filling of freed pages on or off.
+// Returns whether it was on.
+int
+kmem_junk(int on)
+{
+  int old;
+
+  old = kmem.junk;
+  kmem.junk = on;
+  return old;
+}
+
+// Take another reference to the allocated page at v,
+// for a second mapping of it. kfree() drops it.
+void
+kref(char *v)
+{
+  __sync_fetch_and_add(&kmem.ref[V2P(v) / PGSIZE], 1);
+}
+
+// Number of references to the allocated page at v.
+int
+krefs(char *v)
+{
+  return kmem.ref[V2P(v) / PGSIZE];
+}
+
+// Copy the counters of up to n CPUs to st.
+// Returns the number of CPUs.
+int
+kmem_stats(struct kmemstat *st, int n)
+{
+  int i;
+
+  for(i = 0; i < n && i < ncpu; i++){
+    acquire(&kmem.cpus[i].lock);
+    st[i] = kmem.cpus[i].stat;
+    release(&kmem.cpus[i].lock);
+  }
+  return ncpu;
+}
@@ -0,0 +1,1757 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "usage: kill pid...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 18 0c 00 00       	push   $0xc18
+  21:	6a 02                	push   $0x2
+  23:	e8 e7 05 00 00       	call   60f <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 73 03 00 00       	call   3a3 <exit>
+  }
+  for(i=1; i<argc; i++)
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 2d                	jmp    66 <main+0x66>
+    kill(atoi(argv[i]));
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 e4 01 00 00       	call   237 <atoi>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	50                   	push   %eax
+  5a:	e8 74 03 00 00       	call   3d3 <kill>
+  5f:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+  62:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  69:	3b 03                	cmp    (%ebx),%eax
+  6b:	7c cc                	jl     39 <main+0x39>
+  exit();
+  6d:	e8 31 03 00 00       	call   3a3 <exit>
+
+00000072 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+  72:	55                   	push   %ebp
+  73:	89 e5                	mov    %esp,%ebp
+  75:	57                   	push   %edi
+  76:	53                   	push   %ebx
+{
+  77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7a:	8b 55 10             	mov    0x10(%ebp),%edx
+  7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80:	89 cb                	mov    %ecx,%ebx
+  82:	89 df                	mov    %ebx,%edi
+  84:	89 d1                	mov    %edx,%ecx
+  86:	fc                   	cld
+  87:	f3 aa                	rep stos %al,%es:(%edi)
+  89:	89 ca                	mov    %ecx,%edx
+  8b:	89 fb                	mov    %edi,%ebx
+  8d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  90:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+  93:	90                   	nop
+  94:	5b                   	pop    %ebx
+  95:	5f                   	pop    %edi
+  96:	5d                   	pop    %ebp
+  97:	c3                   	ret
+
+00000098 <strcpy>:
+{
+  98:	55                   	push   %ebp
+  99:	89 e5                	mov    %esp,%ebp
+  9b:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a4:	90                   	nop
+  a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  a8:	8d 42 01             	lea    0x1(%edx),%eax
+  ab:	89 45 0c             	mov    %eax,0xc(%ebp)
+  ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  b1:	8d 48 01             	lea    0x1(%eax),%ecx
+  b4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b7:	0f b6 12             	movzbl (%edx),%edx
+  ba:	88 10                	mov    %dl,(%eax)
+  bc:	0f b6 00             	movzbl (%eax),%eax
+  bf:	84 c0                	test   %al,%al
+  c1:	75 e2                	jne    a5 <strcpy+0xd>
+  return os;
+  c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c6:	c9                   	leave
+  c7:	c3                   	ret
+
+000000c8 <strcmp>:
+{
+  c8:	55                   	push   %ebp
+  c9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  cb:	eb 08                	jmp    d5 <strcmp+0xd>
+    p++, q++;
+  cd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  d1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  d8:	0f b6 00             	movzbl (%eax),%eax
+  db:	84 c0                	test   %al,%al
+  dd:	74 10                	je     ef <strcmp+0x27>
+  df:	8b 45 08             	mov    0x8(%ebp),%eax
+  e2:	0f b6 10             	movzbl (%eax),%edx
+  e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e8:	0f b6 00             	movzbl (%eax),%eax
+  eb:	38 c2                	cmp    %al,%dl
+  ed:	74 de                	je     cd <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  f2:	0f b6 00             	movzbl (%eax),%eax
+  f5:	0f b6 d0             	movzbl %al,%edx
+  f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fb:	0f b6 00             	movzbl (%eax),%eax
+  fe:	0f b6 c0             	movzbl %al,%eax
+ 101:	29 c2                	sub    %eax,%edx
+ 103:	89 d0                	mov    %edx,%eax
+}
+ 105:	5d                   	pop    %ebp
+ 106:	c3                   	ret
+
+00000107 <strlen>:
+{
+ 107:	55                   	push   %ebp
+ 108:	89 e5                	mov    %esp,%ebp
+ 10a:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 10d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 114:	eb 04                	jmp    11a <strlen+0x13>
+ 116:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 11a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 11d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 120:	01 d0                	add    %edx,%eax
+ 122:	0f b6 00             	movzbl (%eax),%eax
+ 125:	84 c0                	test   %al,%al
+ 127:	75 ed                	jne    116 <strlen+0xf>
+  return n;
+ 129:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12c:	c9                   	leave
+ 12d:	c3                   	ret
+
+0000012e <memset>:
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 131:	8b 45 10             	mov    0x10(%ebp),%eax
+ 134:	50                   	push   %eax
+ 135:	ff 75 0c             	push   0xc(%ebp)
+ 138:	ff 75 08             	push   0x8(%ebp)
+ 13b:	e8 32 ff ff ff       	call   72 <stosb>
+ 140:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 146:	c9                   	leave
+ 147:	c3                   	ret
+
+00000148 <strchr>:
+{
+ 148:	55                   	push   %ebp
+ 149:	89 e5                	mov    %esp,%ebp
+ 14b:	83 ec 04             	sub    $0x4,%esp
+ 14e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 151:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 154:	eb 14                	jmp    16a <strchr+0x22>
+    if(*s == c)
+ 156:	8b 45 08             	mov    0x8(%ebp),%eax
+ 159:	0f b6 00             	movzbl (%eax),%eax
+ 15c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 15f:	75 05                	jne    166 <strchr+0x1e>
+      return (char*)s;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+ 164:	eb 13                	jmp    179 <strchr+0x31>
+  for(; *s; s++)
+ 166:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16d:	0f b6 00             	movzbl (%eax),%eax
+ 170:	84 c0                	test   %al,%al
+ 172:	75 e2                	jne    156 <strchr+0xe>
+  return 0;
+ 174:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 179:	c9                   	leave
+ 17a:	c3                   	ret
+
+0000017b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 17b:	55                   	push   %ebp
+ 17c:	89 e5                	mov    %esp,%ebp
+ 17e:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 181:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 188:	eb 42                	jmp    1cc <gets+0x51>
+    cc = read(0, &c, 1);
+ 18a:	83 ec 04             	sub    $0x4,%esp
+ 18d:	6a 01                	push   $0x1
+ 18f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 192:	50                   	push   %eax
+ 193:	6a 00                	push   $0x0
+ 195:	e8 21 02 00 00       	call   3bb <read>
+ 19a:	83 c4 10             	add    $0x10,%esp
+ 19d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a4:	7e 33                	jle    1d9 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1af:	89 c2                	mov    %eax,%edx
+ 1b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b4:	01 c2                	add    %eax,%edx
+ 1b6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ba:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1bc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c0:	3c 0a                	cmp    $0xa,%al
+ 1c2:	74 16                	je     1da <gets+0x5f>
+ 1c4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c8:	3c 0d                	cmp    $0xd,%al
+ 1ca:	74 0e                	je     1da <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1cf:	83 c0 01             	add    $0x1,%eax
+ 1d2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d5:	7f b3                	jg     18a <gets+0xf>
+ 1d7:	eb 01                	jmp    1da <gets+0x5f>
+      break;
+ 1d9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e0:	01 d0                	add    %edx,%eax
+ 1e2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e8:	c9                   	leave
+ 1e9:	c3                   	ret
+
+000001ea <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1ea:	55                   	push   %ebp
+ 1eb:	89 e5                	mov    %esp,%ebp
+ 1ed:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f0:	83 ec 08             	sub    $0x8,%esp
+ 1f3:	6a 00                	push   $0x0
+ 1f5:	ff 75 08             	push   0x8(%ebp)
+ 1f8:	e8 e6 01 00 00       	call   3e3 <open>
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 203:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 207:	79 07                	jns    210 <stat+0x26>
+    return -1;
+ 209:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 20e:	eb 25                	jmp    235 <stat+0x4b>
+  r = fstat(fd, st);
+ 210:	83 ec 08             	sub    $0x8,%esp
+ 213:	ff 75 0c             	push   0xc(%ebp)
+ 216:	ff 75 f4             	push   -0xc(%ebp)
+ 219:	e8 dd 01 00 00       	call   3fb <fstat>
+ 21e:	83 c4 10             	add    $0x10,%esp
+ 221:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 224:	83 ec 0c             	sub    $0xc,%esp
+ 227:	ff 75 f4             	push   -0xc(%ebp)
+ 22a:	e8 9c 01 00 00       	call   3cb <close>
+ 22f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 232:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 235:	c9                   	leave
+ 236:	c3                   	ret
+
+00000237 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 237:	55                   	push   %ebp
+ 238:	89 e5                	mov    %esp,%ebp
+ 23a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 23d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 244:	eb 25                	jmp    26b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 246:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 249:	89 d0                	mov    %edx,%eax
+ 24b:	c1 e0 02             	shl    $0x2,%eax
+ 24e:	01 d0                	add    %edx,%eax
+ 250:	01 c0                	add    %eax,%eax
+ 252:	89 c1                	mov    %eax,%ecx
+ 254:	8b 45 08             	mov    0x8(%ebp),%eax
+ 257:	8d 50 01             	lea    0x1(%eax),%edx
+ 25a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 25d:	0f b6 00             	movzbl (%eax),%eax
+ 260:	0f be c0             	movsbl %al,%eax
+ 263:	01 c8                	add    %ecx,%eax
+ 265:	83 e8 30             	sub    $0x30,%eax
+ 268:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 26b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26e:	0f b6 00             	movzbl (%eax),%eax
+ 271:	3c 2f                	cmp    $0x2f,%al
+ 273:	7e 0a                	jle    27f <atoi+0x48>
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	0f b6 00             	movzbl (%eax),%eax
+ 27b:	3c 39                	cmp    $0x39,%al
+ 27d:	7e c7                	jle    246 <atoi+0xf>
+  return n;
+ 27f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 282:	c9                   	leave
+ 283:	c3                   	ret
+
+00000284 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 284:	55                   	push   %ebp
+ 285:	89 e5                	mov    %esp,%ebp
+ 287:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 28a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 290:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 293:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 296:	eb 17                	jmp    2af <memmove+0x2b>
+    *dst++ = *src++;
+ 298:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 29b:	8d 42 01             	lea    0x1(%edx),%eax
+ 29e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a4:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a7:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2aa:	0f b6 12             	movzbl (%edx),%edx
+ 2ad:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2af:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b2:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b5:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2b8:	85 c0                	test   %eax,%eax
+ 2ba:	7f dc                	jg     298 <memmove+0x14>
+  return vdst;
+ 2bc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2bf:	c9                   	leave
+ 2c0:	c3                   	ret
+
+000002c1 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 2c1:	55                   	push   %ebp
+ 2c2:	89 e5                	mov    %esp,%ebp
+ 2c4:	57                   	push   %edi
+ 2c5:	56                   	push   %esi
+ 2c6:	83 ec 30             	sub    $0x30,%esp
+ 2c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 2cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2d2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 2d5:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 2dc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 2e3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2e6:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 2e9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 2ec:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 2ef:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 2f6:	e9 89 00 00 00       	jmp    384 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 2fb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2fe:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 301:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 305:	01 c0                	add    %eax,%eax
+ 307:	89 c6                	mov    %eax,%esi
+ 309:	89 d7                	mov    %edx,%edi
+ 30b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 30e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 311:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 314:	0f ad d0             	shrd   %cl,%edx,%eax
+ 317:	d3 ea                	shr    %cl,%edx
+ 319:	f6 c1 20             	test   $0x20,%cl
+ 31c:	74 04                	je     322 <udiv64+0x61>
+ 31e:	89 d0                	mov    %edx,%eax
+ 320:	31 d2                	xor    %edx,%edx
+ 322:	83 e0 01             	and    $0x1,%eax
+ 325:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 328:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 32f:	89 f0                	mov    %esi,%eax
+ 331:	89 fa                	mov    %edi,%edx
+ 333:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 336:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 339:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 33c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 33f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 342:	ba 00 00 00 00       	mov    $0x0,%edx
+ 347:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 34a:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 34d:	19 d1                	sbb    %edx,%ecx
+ 34f:	72 2f                	jb     380 <udiv64+0xbf>
+      r -= d;
+ 351:	8b 45 10             	mov    0x10(%ebp),%eax
+ 354:	ba 00 00 00 00       	mov    $0x0,%edx
+ 359:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 35c:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 35f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 362:	b8 01 00 00 00       	mov    $0x1,%eax
+ 367:	ba 00 00 00 00       	mov    $0x0,%edx
+ 36c:	0f a5 c2             	shld   %cl,%eax,%edx
+ 36f:	d3 e0                	shl    %cl,%eax
+ 371:	f6 c1 20             	test   $0x20,%cl
+ 374:	74 04                	je     37a <udiv64+0xb9>
+ 376:	89 c2                	mov    %eax,%edx
+ 378:	31 c0                	xor    %eax,%eax
+ 37a:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 37d:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 380:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 384:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 388:	0f 89 6d ff ff ff    	jns    2fb <udiv64+0x3a>
+    }
+  }
+  return q;
+ 38e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 391:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 394:	83 c4 30             	add    $0x30,%esp
+ 397:	5e                   	pop    %esi
+ 398:	5f                   	pop    %edi
+ 399:	5d                   	pop    %ebp
+ 39a:	c3                   	ret
+
+0000039b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 39b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <exit>:
+SYSCALL(exit)
+ 3a3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <wait>:
+SYSCALL(wait)
+ 3ab:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <pipe>:
+SYSCALL(pipe)
+ 3b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <read>:
+SYSCALL(read)
+ 3bb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <write>:
+SYSCALL(write)
+ 3c3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <close>:
+SYSCALL(close)
+ 3cb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <kill>:
+SYSCALL(kill)
+ 3d3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <exec>:
+SYSCALL(exec)
+ 3db:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <open>:
+SYSCALL(open)
+ 3e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <mknod>:
+SYSCALL(mknod)
+ 3eb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <unlink>:
+SYSCALL(unlink)
+ 3f3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <fstat>:
+SYSCALL(fstat)
+ 3fb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <link>:
+SYSCALL(link)
+ 403:	b8 13 00 00 00       	mov    $0x13,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <mkdir>:
+SYSCALL(mkdir)
+ 40b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <chdir>:
+SYSCALL(chdir)
+ 413:	b8 09 00 00 00       	mov    $0x9,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <dup>:
+SYSCALL(dup)
+ 41b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <getpid>:
+SYSCALL(getpid)
+ 423:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <sbrk>:
+SYSCALL(sbrk)
+ 42b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <sleep>:
+SYSCALL(sleep)
+ 433:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <uptime>:
+SYSCALL(uptime)
+ 43b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 443:	b8 16 00 00 00       	mov    $0x16,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 44b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 453:	b8 18 00 00 00       	mov    $0x18,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <copy_file>:
+SYSCALL(copy_file)
+ 45b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <change_queue>:
+SYSCALL(change_queue)
+ 463:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 46b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 473:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <print_process_info>:
+SYSCALL(print_process_info)
+ 47b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 483:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 48b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 493:	b8 20 00 00 00       	mov    $0x20,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 49b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 4a3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 4ab:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 4b3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 4bb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <set_affinity>:
+SYSCALL(set_affinity)
+ 4c3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <setsched>:
+SYSCALL(setsched)
+ 4cb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 4d3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <set_quantum>:
+SYSCALL(set_quantum)
+ 4db:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <schedtrace>:
+SYSCALL(schedtrace)
+ 4e3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <getrusage>:
+SYSCALL(getrusage)
+ 4eb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 4f3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 4fb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 503:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <futex_wait>:
+SYSCALL(futex_wait)
+ 50b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <futex_wake>:
+SYSCALL(futex_wake)
+ 513:	b8 30 00 00 00       	mov    $0x30,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <syscall_latency>:
+SYSCALL(syscall_latency)
+ 51b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <submit_batch>:
+SYSCALL(submit_batch)
+ 523:	b8 32 00 00 00       	mov    $0x32,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <kmem_stats>:
+SYSCALL(kmem_stats)
+ 52b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 533:	b8 34 00 00 00       	mov    $0x34,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 53b:	55                   	push   %ebp
+ 53c:	89 e5                	mov    %esp,%ebp
+ 53e:	83 ec 18             	sub    $0x18,%esp
+ 541:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 544:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 547:	83 ec 04             	sub    $0x4,%esp
+ 54a:	6a 01                	push   $0x1
+ 54c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 54f:	50                   	push   %eax
+ 550:	ff 75 08             	push   0x8(%ebp)
+ 553:	e8 6b fe ff ff       	call   3c3 <write>
+ 558:	83 c4 10             	add    $0x10,%esp
+}
+ 55b:	90                   	nop
+ 55c:	c9                   	leave
+ 55d:	c3                   	ret
+
+0000055e <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 55e:	55                   	push   %ebp
+ 55f:	89 e5                	mov    %esp,%ebp
+ 561:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 564:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 56b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 56f:	74 17                	je     588 <printint+0x2a>
+ 571:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 575:	79 11                	jns    588 <printint+0x2a>
+    neg = 1;
+ 577:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 57e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 581:	f7 d8                	neg    %eax
+ 583:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 586:	eb 06                	jmp    58e <printint+0x30>
+  } else {
+    x = xx;
+ 588:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 58b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 58e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 595:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 598:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 59b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5a0:	f7 f1                	div    %ecx
+ 5a2:	89 d1                	mov    %edx,%ecx
+ 5a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5a7:	8d 50 01             	lea    0x1(%eax),%edx
+ 5aa:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5ad:	0f b6 91 24 10 00 00 	movzbl 0x1024(%ecx),%edx
+ 5b4:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5b8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5bb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5be:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5c3:	f7 f1                	div    %ecx
+ 5c5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5c8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5cc:	75 c7                	jne    595 <printint+0x37>
+  if(neg)
+ 5ce:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5d2:	74 2d                	je     601 <printint+0xa3>
+    buf[i++] = '-';
+ 5d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5d7:	8d 50 01             	lea    0x1(%eax),%edx
+ 5da:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5dd:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5e2:	eb 1d                	jmp    601 <printint+0xa3>
+    putc(fd, buf[i]);
+ 5e4:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5ea:	01 d0                	add    %edx,%eax
+ 5ec:	0f b6 00             	movzbl (%eax),%eax
+ 5ef:	0f be c0             	movsbl %al,%eax
+ 5f2:	83 ec 08             	sub    $0x8,%esp
+ 5f5:	50                   	push   %eax
+ 5f6:	ff 75 08             	push   0x8(%ebp)
+ 5f9:	e8 3d ff ff ff       	call   53b <putc>
+ 5fe:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 601:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 605:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 609:	79 d9                	jns    5e4 <printint+0x86>
+}
+ 60b:	90                   	nop
+ 60c:	90                   	nop
+ 60d:	c9                   	leave
+ 60e:	c3                   	ret
+
+0000060f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 60f:	55                   	push   %ebp
+ 610:	89 e5                	mov    %esp,%ebp
+ 612:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 615:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 61c:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 61f:	83 c0 04             	add    $0x4,%eax
+ 622:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 625:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 62c:	e9 59 01 00 00       	jmp    78a <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 631:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 634:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 637:	01 d0                	add    %edx,%eax
+ 639:	0f b6 00             	movzbl (%eax),%eax
+ 63c:	0f be c0             	movsbl %al,%eax
+ 63f:	25 ff 00 00 00       	and    $0xff,%eax
+ 644:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 647:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 64b:	75 2c                	jne    679 <printf+0x6a>
+      if(c == '%'){
+ 64d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 651:	75 0c                	jne    65f <printf+0x50>
+        state = '%';
+ 653:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 65a:	e9 27 01 00 00       	jmp    786 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 65f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 662:	0f be c0             	movsbl %al,%eax
+ 665:	83 ec 08             	sub    $0x8,%esp
+ 668:	50                   	push   %eax
+ 669:	ff 75 08             	push   0x8(%ebp)
+ 66c:	e8 ca fe ff ff       	call   53b <putc>
+ 671:	83 c4 10             	add    $0x10,%esp
+ 674:	e9 0d 01 00 00       	jmp    786 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 679:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 67d:	0f 85 03 01 00 00    	jne    786 <printf+0x177>
+      if(c == 'd'){
+ 683:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 687:	75 1e                	jne    6a7 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 689:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 68c:	8b 00                	mov    (%eax),%eax
+ 68e:	6a 01                	push   $0x1
+ 690:	6a 0a                	push   $0xa
+ 692:	50                   	push   %eax
+ 693:	ff 75 08             	push   0x8(%ebp)
+ 696:	e8 c3 fe ff ff       	call   55e <printint>
+ 69b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 69e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6a2:	e9 d8 00 00 00       	jmp    77f <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6a7:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6ab:	74 06                	je     6b3 <printf+0xa4>
+ 6ad:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6b1:	75 1e                	jne    6d1 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6b3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6b6:	8b 00                	mov    (%eax),%eax
+ 6b8:	6a 00                	push   $0x0
+ 6ba:	6a 10                	push   $0x10
+ 6bc:	50                   	push   %eax
+ 6bd:	ff 75 08             	push   0x8(%ebp)
+ 6c0:	e8 99 fe ff ff       	call   55e <printint>
+ 6c5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6c8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6cc:	e9 ae 00 00 00       	jmp    77f <printf+0x170>
+      } else if(c == 's'){
+ 6d1:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6d5:	75 43                	jne    71a <printf+0x10b>
+        s = (char*)*ap;
+ 6d7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6da:	8b 00                	mov    (%eax),%eax
+ 6dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6df:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6e7:	75 25                	jne    70e <printf+0xff>
+          s = "(null)";
+ 6e9:	c7 45 f4 2c 0c 00 00 	movl   $0xc2c,-0xc(%ebp)
+        while(*s != 0){
+ 6f0:	eb 1c                	jmp    70e <printf+0xff>
+          putc(fd, *s);
+ 6f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6f5:	0f b6 00             	movzbl (%eax),%eax
+ 6f8:	0f be c0             	movsbl %al,%eax
+ 6fb:	83 ec 08             	sub    $0x8,%esp
+ 6fe:	50                   	push   %eax
+ 6ff:	ff 75 08             	push   0x8(%ebp)
+ 702:	e8 34 fe ff ff       	call   53b <putc>
+ 707:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 70a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 70e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 711:	0f b6 00             	movzbl (%eax),%eax
+ 714:	84 c0                	test   %al,%al
+ 716:	75 da                	jne    6f2 <printf+0xe3>
+ 718:	eb 65                	jmp    77f <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 71a:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 71e:	75 1d                	jne    73d <printf+0x12e>
+        putc(fd, *ap);
+ 720:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 723:	8b 00                	mov    (%eax),%eax
+ 725:	0f be c0             	movsbl %al,%eax
+ 728:	83 ec 08             	sub    $0x8,%esp
+ 72b:	50                   	push   %eax
+ 72c:	ff 75 08             	push   0x8(%ebp)
+ 72f:	e8 07 fe ff ff       	call   53b <putc>
+ 734:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 737:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 73b:	eb 42                	jmp    77f <printf+0x170>
+      } else if(c == '%'){
+ 73d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 741:	75 17                	jne    75a <printf+0x14b>
+        putc(fd, c);
+ 743:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 746:	0f be c0             	movsbl %al,%eax
+ 749:	83 ec 08             	sub    $0x8,%esp
+ 74c:	50                   	push   %eax
+ 74d:	ff 75 08             	push   0x8(%ebp)
+ 750:	e8 e6 fd ff ff       	call   53b <putc>
+ 755:	83 c4 10             	add    $0x10,%esp
+ 758:	eb 25                	jmp    77f <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 75a:	83 ec 08             	sub    $0x8,%esp
+ 75d:	6a 25                	push   $0x25
+ 75f:	ff 75 08             	push   0x8(%ebp)
+ 762:	e8 d4 fd ff ff       	call   53b <putc>
+ 767:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 76a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 76d:	0f be c0             	movsbl %al,%eax
+ 770:	83 ec 08             	sub    $0x8,%esp
+ 773:	50                   	push   %eax
+ 774:	ff 75 08             	push   0x8(%ebp)
+ 777:	e8 bf fd ff ff       	call   53b <putc>
+ 77c:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 77f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 786:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 78a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 78d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 790:	01 d0                	add    %edx,%eax
+ 792:	0f b6 00             	movzbl (%eax),%eax
+ 795:	84 c0                	test   %al,%al
+ 797:	0f 85 94 fe ff ff    	jne    631 <printf+0x22>
+    }
+  }
+}
+ 79d:	90                   	nop
+ 79e:	90                   	nop
+ 79f:	c9                   	leave
+ 7a0:	c3                   	ret
+
+000007a1 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7a1:	55                   	push   %ebp
+ 7a2:	89 e5                	mov    %esp,%ebp
+ 7a4:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7aa:	83 e8 08             	sub    $0x8,%eax
+ 7ad:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b0:	a1 40 10 00 00       	mov    0x1040,%eax
+ 7b5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7b8:	eb 24                	jmp    7de <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7bd:	8b 00                	mov    (%eax),%eax
+ 7bf:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7c2:	72 12                	jb     7d6 <free+0x35>
+ 7c4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7c7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7ca:	72 24                	jb     7f0 <free+0x4f>
+ 7cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7cf:	8b 00                	mov    (%eax),%eax
+ 7d1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7d4:	72 1a                	jb     7f0 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d9:	8b 00                	mov    (%eax),%eax
+ 7db:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7de:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7e1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7e4:	73 d4                	jae    7ba <free+0x19>
+ 7e6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e9:	8b 00                	mov    (%eax),%eax
+ 7eb:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7ee:	73 ca                	jae    7ba <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7f0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f3:	8b 40 04             	mov    0x4(%eax),%eax
+ 7f6:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7fd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 800:	01 c2                	add    %eax,%edx
+ 802:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 805:	8b 00                	mov    (%eax),%eax
+ 807:	39 c2                	cmp    %eax,%edx
+ 809:	75 24                	jne    82f <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 80b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 80e:	8b 50 04             	mov    0x4(%eax),%edx
+ 811:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 814:	8b 00                	mov    (%eax),%eax
+ 816:	8b 40 04             	mov    0x4(%eax),%eax
+ 819:	01 c2                	add    %eax,%edx
+ 81b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 81e:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 821:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 824:	8b 00                	mov    (%eax),%eax
+ 826:	8b 10                	mov    (%eax),%edx
+ 828:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 82b:	89 10                	mov    %edx,(%eax)
+ 82d:	eb 0a                	jmp    839 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 82f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 832:	8b 10                	mov    (%eax),%edx
+ 834:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 837:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 839:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83c:	8b 40 04             	mov    0x4(%eax),%eax
+ 83f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 846:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 849:	01 d0                	add    %edx,%eax
+ 84b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 84e:	75 20                	jne    870 <free+0xcf>
+    p->s.size += bp->s.size;
+ 850:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 853:	8b 50 04             	mov    0x4(%eax),%edx
+ 856:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 859:	8b 40 04             	mov    0x4(%eax),%eax
+ 85c:	01 c2                	add    %eax,%edx
+ 85e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 861:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 864:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 867:	8b 10                	mov    (%eax),%edx
+ 869:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86c:	89 10                	mov    %edx,(%eax)
+ 86e:	eb 08                	jmp    878 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 870:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 873:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 876:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 878:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 87b:	a3 40 10 00 00       	mov    %eax,0x1040
+}
+ 880:	90                   	nop
+ 881:	c9                   	leave
+ 882:	c3                   	ret
+
+00000883 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 883:	55                   	push   %ebp
+ 884:	89 e5                	mov    %esp,%ebp
+ 886:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 889:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 890:	77 07                	ja     899 <morecore+0x16>
+    nu = 4096;
+ 892:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 899:	8b 45 08             	mov    0x8(%ebp),%eax
+ 89c:	c1 e0 03             	shl    $0x3,%eax
+ 89f:	83 ec 0c             	sub    $0xc,%esp
+ 8a2:	50                   	push   %eax
+ 8a3:	e8 83 fb ff ff       	call   42b <sbrk>
+ 8a8:	83 c4 10             	add    $0x10,%esp
+ 8ab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 8ae:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8b2:	75 07                	jne    8bb <morecore+0x38>
+    return 0;
+ 8b4:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8b9:	eb 26                	jmp    8e1 <morecore+0x5e>
+  hp = (Header*)p;
+ 8bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8be:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 8c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8c4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8c7:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8ca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8cd:	83 c0 08             	add    $0x8,%eax
+ 8d0:	83 ec 0c             	sub    $0xc,%esp
+ 8d3:	50                   	push   %eax
+ 8d4:	e8 c8 fe ff ff       	call   7a1 <free>
+ 8d9:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 8dc:	a1 40 10 00 00       	mov    0x1040,%eax
+}
+ 8e1:	c9                   	leave
+ 8e2:	c3                   	ret
+
+000008e3 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8e3:	55                   	push   %ebp
+ 8e4:	89 e5                	mov    %esp,%ebp
+ 8e6:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ec:	83 c0 07             	add    $0x7,%eax
+ 8ef:	c1 e8 03             	shr    $0x3,%eax
+ 8f2:	83 c0 01             	add    $0x1,%eax
+ 8f5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 8f8:	a1 40 10 00 00       	mov    0x1040,%eax
+ 8fd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 900:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 904:	75 23                	jne    929 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 906:	c7 45 f0 38 10 00 00 	movl   $0x1038,-0x10(%ebp)
+ 90d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 910:	a3 40 10 00 00       	mov    %eax,0x1040
+ 915:	a1 40 10 00 00       	mov    0x1040,%eax
+ 91a:	a3 38 10 00 00       	mov    %eax,0x1038
+    base.s.size = 0;
+ 91f:	c7 05 3c 10 00 00 00 	movl   $0x0,0x103c
+ 926:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 929:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 92c:	8b 00                	mov    (%eax),%eax
+ 92e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 931:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 934:	8b 40 04             	mov    0x4(%eax),%eax
+ 937:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 93a:	72 4d                	jb     989 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 93c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 93f:	8b 40 04             	mov    0x4(%eax),%eax
+ 942:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 945:	75 0c                	jne    953 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 947:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 94a:	8b 10                	mov    (%eax),%edx
+ 94c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 94f:	89 10                	mov    %edx,(%eax)
+ 951:	eb 26                	jmp    979 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 953:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 956:	8b 40 04             	mov    0x4(%eax),%eax
+ 959:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 95c:	89 c2                	mov    %eax,%edx
+ 95e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 961:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 964:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 967:	8b 40 04             	mov    0x4(%eax),%eax
+ 96a:	c1 e0 03             	shl    $0x3,%eax
+ 96d:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 970:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 973:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 976:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 979:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 97c:	a3 40 10 00 00       	mov    %eax,0x1040
+      return (void*)(p + 1);
+ 981:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 984:	83 c0 08             	add    $0x8,%eax
+ 987:	eb 3b                	jmp    9c4 <malloc+0xe1>
+    }
+    if(p == freep)
+ 989:	a1 40 10 00 00       	mov    0x1040,%eax
+ 98e:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 991:	75 1e                	jne    9b1 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	ff 75 ec             	push   -0x14(%ebp)
+ 999:	e8 e5 fe ff ff       	call   883 <morecore>
+ 99e:	83 c4 10             	add    $0x10,%esp
+ 9a1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9a4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9a8:	75 07                	jne    9b1 <malloc+0xce>
+        return 0;
+ 9aa:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9af:	eb 13                	jmp    9c4 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ba:	8b 00                	mov    (%eax),%eax
+ 9bc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9bf:	e9 6d ff ff ff       	jmp    931 <malloc+0x4e>
+  }
+}
+ 9c4:	c9                   	leave
+ 9c5:	c3                   	ret
+
+000009c6 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ 9c6:	55                   	push   %ebp
+ 9c7:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 9c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9cc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 9d2:	90                   	nop
+ 9d3:	5d                   	pop    %ebp
+ 9d4:	c3                   	ret
+
+000009d5 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 9d5:	55                   	push   %ebp
+ 9d6:	89 e5                	mov    %esp,%ebp
+ 9d8:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 9db:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9de:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9e3:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 9e8:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ 9ec:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9ef:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9f3:	74 3b                	je     a30 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ 9f5:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 9f9:	74 2d                	je     a28 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ 9fb:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9fe:	b8 02 00 00 00       	mov    $0x2,%eax
+ a03:	87 02                	xchg   %eax,(%edx)
+ a05:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a08:	eb 1e                	jmp    a28 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ a0a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a0d:	83 ec 08             	sub    $0x8,%esp
+ a10:	6a 02                	push   $0x2
+ a12:	50                   	push   %eax
+ a13:	e8 f3 fa ff ff       	call   50b <futex_wait>
+ a18:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a1b:	8b 55 08             	mov    0x8(%ebp),%edx
+ a1e:	b8 02 00 00 00       	mov    $0x2,%eax
+ a23:	87 02                	xchg   %eax,(%edx)
+ a25:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a28:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a2c:	75 dc                	jne    a0a <mutex_lock+0x35>
+ a2e:	eb 01                	jmp    a31 <mutex_lock+0x5c>
+    return;
+ a30:	90                   	nop
+  }
+}
+ a31:	c9                   	leave
+ a32:	c3                   	ret
+
+00000a33 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ a33:	55                   	push   %ebp
+ a34:	89 e5                	mov    %esp,%ebp
+ a36:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ a39:	8b 45 08             	mov    0x8(%ebp),%eax
+ a3c:	ba 01 00 00 00       	mov    $0x1,%edx
+ a41:	f7 da                	neg    %edx
+ a43:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ a47:	83 fa 01             	cmp    $0x1,%edx
+ a4a:	74 1a                	je     a66 <mutex_unlock+0x33>
+    m->state = 0;
+ a4c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a4f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ a55:	8b 45 08             	mov    0x8(%ebp),%eax
+ a58:	83 ec 08             	sub    $0x8,%esp
+ a5b:	6a 01                	push   $0x1
+ a5d:	50                   	push   %eax
+ a5e:	e8 b0 fa ff ff       	call   513 <futex_wake>
+ a63:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ a66:	90                   	nop
+ a67:	c9                   	leave
+ a68:	c3                   	ret
+
+00000a69 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ a69:	55                   	push   %ebp
+ a6a:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ a6c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a6f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ a75:	8b 45 08             	mov    0x8(%ebp),%eax
+ a78:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ a7f:	90                   	nop
+ a80:	5d                   	pop    %ebp
+ a81:	c3                   	ret
+
+00000a82 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ a82:	55                   	push   %ebp
+ a83:	89 e5                	mov    %esp,%ebp
+ a85:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ a88:	8b 45 08             	mov    0x8(%ebp),%eax
+ a8b:	83 c0 04             	add    $0x4,%eax
+ a8e:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ a92:	8b 45 08             	mov    0x8(%ebp),%eax
+ a95:	83 ec 08             	sub    $0x8,%esp
+ a98:	ff 75 0c             	push   0xc(%ebp)
+ a9b:	50                   	push   %eax
+ a9c:	e8 6a fa ff ff       	call   50b <futex_wait>
+ aa1:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ aa4:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa7:	83 c0 04             	add    $0x4,%eax
+ aaa:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ aae:	90                   	nop
+ aaf:	c9                   	leave
+ ab0:	c3                   	ret
+
+00000ab1 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ ab1:	55                   	push   %ebp
+ ab2:	89 e5                	mov    %esp,%ebp
+ ab4:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+ aba:	8b 00                	mov    (%eax),%eax
+ abc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ abf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ac3:	78 17                	js     adc <rwlock_rdlock+0x2b>
+ ac5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac8:	83 c0 01             	add    $0x1,%eax
+ acb:	89 c1                	mov    %eax,%ecx
+ acd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad0:	8b 55 08             	mov    0x8(%ebp),%edx
+ ad3:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ ad7:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ ada:	74 19                	je     af5 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ adc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ae0:	79 d5                	jns    ab7 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ ae2:	83 ec 08             	sub    $0x8,%esp
+ ae5:	ff 75 f4             	push   -0xc(%ebp)
+ ae8:	ff 75 08             	push   0x8(%ebp)
+ aeb:	e8 92 ff ff ff       	call   a82 <rwlock_sleep>
+ af0:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ af3:	eb c2                	jmp    ab7 <rwlock_rdlock+0x6>
+      return;
+ af5:	90                   	nop
+  }
+}
+ af6:	c9                   	leave
+ af7:	c3                   	ret
+
+00000af8 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ af8:	55                   	push   %ebp
+ af9:	89 e5                	mov    %esp,%ebp
+ afb:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ afe:	eb 11                	jmp    b11 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ b00:	83 ec 08             	sub    $0x8,%esp
+ b03:	ff 75 f4             	push   -0xc(%ebp)
+ b06:	ff 75 08             	push   0x8(%ebp)
+ b09:	e8 74 ff ff ff       	call   a82 <rwlock_sleep>
+ b0e:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b11:	8b 55 08             	mov    0x8(%ebp),%edx
+ b14:	b8 00 00 00 00       	mov    $0x0,%eax
+ b19:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ b1e:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b22:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b25:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b29:	75 d5                	jne    b00 <rwlock_wrlock+0x8>
+}
+ b2b:	90                   	nop
+ b2c:	90                   	nop
+ b2d:	c9                   	leave
+ b2e:	c3                   	ret
+
+00000b2f <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ b2f:	55                   	push   %ebp
+ b30:	89 e5                	mov    %esp,%ebp
+ b32:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ b35:	8b 45 08             	mov    0x8(%ebp),%eax
+ b38:	8b 00                	mov    (%eax),%eax
+ b3a:	85 c0                	test   %eax,%eax
+ b3c:	79 0c                	jns    b4a <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ b3e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b41:	ba 00 00 00 00       	mov    $0x0,%edx
+ b46:	87 10                	xchg   %edx,(%eax)
+ b48:	eb 18                	jmp    b62 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ b4a:	8b 55 08             	mov    0x8(%ebp),%edx
+ b4d:	b8 01 00 00 00       	mov    $0x1,%eax
+ b52:	f7 d8                	neg    %eax
+ b54:	89 c1                	mov    %eax,%ecx
+ b56:	89 c8                	mov    %ecx,%eax
+ b58:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ b5c:	01 c8                	add    %ecx,%eax
+ b5e:	85 c0                	test   %eax,%eax
+ b60:	75 20                	jne    b82 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ b62:	8b 45 08             	mov    0x8(%ebp),%eax
+ b65:	8b 40 04             	mov    0x4(%eax),%eax
+ b68:	85 c0                	test   %eax,%eax
+ b6a:	74 17                	je     b83 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ b6c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6f:	83 ec 08             	sub    $0x8,%esp
+ b72:	68 ff ff ff 7f       	push   $0x7fffffff
+ b77:	50                   	push   %eax
+ b78:	e8 96 f9 ff ff       	call   513 <futex_wake>
+ b7d:	83 c4 10             	add    $0x10,%esp
+ b80:	eb 01                	jmp    b83 <rwlock_unlock+0x54>
+    return;
+ b82:	90                   	nop
+}
+ b83:	c9                   	leave
+ b84:	c3                   	ret
+
+00000b85 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ b85:	55                   	push   %ebp
+ b86:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ b88:	8b 45 08             	mov    0x8(%ebp),%eax
+ b8b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b91:	90                   	nop
+ b92:	5d                   	pop    %ebp
+ b93:	c3                   	ret
+
+00000b94 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ b94:	55                   	push   %ebp
+ b95:	89 e5                	mov    %esp,%ebp
+ b97:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ b9a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b9d:	8b 00                	mov    (%eax),%eax
+ b9f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ ba2:	83 ec 0c             	sub    $0xc,%esp
+ ba5:	ff 75 0c             	push   0xc(%ebp)
+ ba8:	e8 86 fe ff ff       	call   a33 <mutex_unlock>
+ bad:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ bb0:	8b 45 08             	mov    0x8(%ebp),%eax
+ bb3:	83 ec 08             	sub    $0x8,%esp
+ bb6:	ff 75 f4             	push   -0xc(%ebp)
+ bb9:	50                   	push   %eax
+ bba:	e8 4c f9 ff ff       	call   50b <futex_wait>
+ bbf:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ bc2:	83 ec 0c             	sub    $0xc,%esp
+ bc5:	ff 75 0c             	push   0xc(%ebp)
+ bc8:	e8 08 fe ff ff       	call   9d5 <mutex_lock>
+ bcd:	83 c4 10             	add    $0x10,%esp
+}
+ bd0:	90                   	nop
+ bd1:	c9                   	leave
+ bd2:	c3                   	ret
+
+00000bd3 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ bd3:	55                   	push   %ebp
+ bd4:	89 e5                	mov    %esp,%ebp
+ bd6:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ bd9:	8b 45 08             	mov    0x8(%ebp),%eax
+ bdc:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ be0:	8b 45 08             	mov    0x8(%ebp),%eax
+ be3:	83 ec 08             	sub    $0x8,%esp
+ be6:	6a 01                	push   $0x1
+ be8:	50                   	push   %eax
+ be9:	e8 25 f9 ff ff       	call   513 <futex_wake>
+ bee:	83 c4 10             	add    $0x10,%esp
+}
+ bf1:	90                   	nop
+ bf2:	c9                   	leave
+ bf3:	c3                   	ret
+
+00000bf4 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ bf4:	55                   	push   %ebp
+ bf5:	89 e5                	mov    %esp,%ebp
+ bf7:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ bfa:	8b 45 08             	mov    0x8(%ebp),%eax
+ bfd:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ c01:	8b 45 08             	mov    0x8(%ebp),%eax
+ c04:	83 ec 08             	sub    $0x8,%esp
+ c07:	68 ff ff ff 7f       	push   $0x7fffffff
+ c0c:	50                   	push   %eax
+ c0d:	e8 01 f9 ff ff       	call   513 <futex_wake>
+ c12:	83 c4 10             	add    $0x10,%esp
+}
+ c15:	90                   	nop
+ c16:	c9                   	leave
+ c17:	c3                   	ret
@@ -0,0 +1,12 @@
+// Page allocator activity of one CPU, as returned by kmem_stats().
+
+struct kmemstat
+{
+  uint allocs; // Pages handed out by kalloc()
+  uint frees;  // Pages put back by kfree()
+  uint steals; // Refills of an empty free list
+  uint stolen; // Pages those refills brought in
+  uint nfree;  // Pages on the free list now
+  uint zhits;  // kzalloc() calls served from the zeroed pool
+  uint zfills; // Pages idle CPUs zeroed into this CPU's pool
+};
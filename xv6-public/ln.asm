@@ -0,0 +1,1759 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	89 cb                	mov    %ecx,%ebx
+  if(argc != 3){
+  11:	83 3b 03             	cmpl   $0x3,(%ebx)
+  14:	74 17                	je     2d <main+0x2d>
+    printf(2, "Usage: ln old new\n");
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	68 1a 0c 00 00       	push   $0xc1a
+  1e:	6a 02                	push   $0x2
+  20:	e8 ec 05 00 00       	call   611 <printf>
+  25:	83 c4 10             	add    $0x10,%esp
+    exit();
+  28:	e8 78 03 00 00       	call   3a5 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  30:	83 c0 08             	add    $0x8,%eax
+  33:	8b 10                	mov    (%eax),%edx
+  35:	8b 43 04             	mov    0x4(%ebx),%eax
+  38:	83 c0 04             	add    $0x4,%eax
+  3b:	8b 00                	mov    (%eax),%eax
+  3d:	83 ec 08             	sub    $0x8,%esp
+  40:	52                   	push   %edx
+  41:	50                   	push   %eax
+  42:	e8 be 03 00 00       	call   405 <link>
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	85 c0                	test   %eax,%eax
+  4c:	79 21                	jns    6f <main+0x6f>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  4e:	8b 43 04             	mov    0x4(%ebx),%eax
+  51:	83 c0 08             	add    $0x8,%eax
+  54:	8b 10                	mov    (%eax),%edx
+  56:	8b 43 04             	mov    0x4(%ebx),%eax
+  59:	83 c0 04             	add    $0x4,%eax
+  5c:	8b 00                	mov    (%eax),%eax
+  5e:	52                   	push   %edx
+  5f:	50                   	push   %eax
+  60:	68 2d 0c 00 00       	push   $0xc2d
+  65:	6a 02                	push   $0x2
+  67:	e8 a5 05 00 00       	call   611 <printf>
+  6c:	83 c4 10             	add    $0x10,%esp
+  exit();
+  6f:	e8 31 03 00 00       	call   3a5 <exit>
+
+00000074 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+  74:	55                   	push   %ebp
+  75:	89 e5                	mov    %esp,%ebp
+  77:	57                   	push   %edi
+  78:	53                   	push   %ebx
+{
+  79:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7c:	8b 55 10             	mov    0x10(%ebp),%edx
+  7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  82:	89 cb                	mov    %ecx,%ebx
+  84:	89 df                	mov    %ebx,%edi
+  86:	89 d1                	mov    %edx,%ecx
+  88:	fc                   	cld
+  89:	f3 aa                	rep stos %al,%es:(%edi)
+  8b:	89 ca                	mov    %ecx,%edx
+  8d:	89 fb                	mov    %edi,%ebx
+  8f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  92:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+  95:	90                   	nop
+  96:	5b                   	pop    %ebx
+  97:	5f                   	pop    %edi
+  98:	5d                   	pop    %ebp
+  99:	c3                   	ret
+
+0000009a <strcpy>:
+{
+  9a:	55                   	push   %ebp
+  9b:	89 e5                	mov    %esp,%ebp
+  9d:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  a3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a6:	90                   	nop
+  a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  aa:	8d 42 01             	lea    0x1(%edx),%eax
+  ad:	89 45 0c             	mov    %eax,0xc(%ebp)
+  b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  b3:	8d 48 01             	lea    0x1(%eax),%ecx
+  b6:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b9:	0f b6 12             	movzbl (%edx),%edx
+  bc:	88 10                	mov    %dl,(%eax)
+  be:	0f b6 00             	movzbl (%eax),%eax
+  c1:	84 c0                	test   %al,%al
+  c3:	75 e2                	jne    a7 <strcpy+0xd>
+  return os;
+  c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c8:	c9                   	leave
+  c9:	c3                   	ret
+
+000000ca <strcmp>:
+{
+  ca:	55                   	push   %ebp
+  cb:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  cd:	eb 08                	jmp    d7 <strcmp+0xd>
+    p++, q++;
+  cf:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  d3:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  da:	0f b6 00             	movzbl (%eax),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	74 10                	je     f1 <strcmp+0x27>
+  e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  e4:	0f b6 10             	movzbl (%eax),%edx
+  e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ea:	0f b6 00             	movzbl (%eax),%eax
+  ed:	38 c2                	cmp    %al,%dl
+  ef:	74 de                	je     cf <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  f4:	0f b6 00             	movzbl (%eax),%eax
+  f7:	0f b6 d0             	movzbl %al,%edx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	0f b6 00             	movzbl (%eax),%eax
+ 100:	0f b6 c0             	movzbl %al,%eax
+ 103:	29 c2                	sub    %eax,%edx
+ 105:	89 d0                	mov    %edx,%eax
+}
+ 107:	5d                   	pop    %ebp
+ 108:	c3                   	ret
+
+00000109 <strlen>:
+{
+ 109:	55                   	push   %ebp
+ 10a:	89 e5                	mov    %esp,%ebp
+ 10c:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 10f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 116:	eb 04                	jmp    11c <strlen+0x13>
+ 118:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 11c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 11f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 122:	01 d0                	add    %edx,%eax
+ 124:	0f b6 00             	movzbl (%eax),%eax
+ 127:	84 c0                	test   %al,%al
+ 129:	75 ed                	jne    118 <strlen+0xf>
+  return n;
+ 12b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12e:	c9                   	leave
+ 12f:	c3                   	ret
+
+00000130 <memset>:
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 133:	8b 45 10             	mov    0x10(%ebp),%eax
+ 136:	50                   	push   %eax
+ 137:	ff 75 0c             	push   0xc(%ebp)
+ 13a:	ff 75 08             	push   0x8(%ebp)
+ 13d:	e8 32 ff ff ff       	call   74 <stosb>
+ 142:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 145:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 148:	c9                   	leave
+ 149:	c3                   	ret
+
+0000014a <strchr>:
+{
+ 14a:	55                   	push   %ebp
+ 14b:	89 e5                	mov    %esp,%ebp
+ 14d:	83 ec 04             	sub    $0x4,%esp
+ 150:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 153:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 156:	eb 14                	jmp    16c <strchr+0x22>
+    if(*s == c)
+ 158:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15b:	0f b6 00             	movzbl (%eax),%eax
+ 15e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 161:	75 05                	jne    168 <strchr+0x1e>
+      return (char*)s;
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	eb 13                	jmp    17b <strchr+0x31>
+  for(; *s; s++)
+ 168:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16f:	0f b6 00             	movzbl (%eax),%eax
+ 172:	84 c0                	test   %al,%al
+ 174:	75 e2                	jne    158 <strchr+0xe>
+  return 0;
+ 176:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 17b:	c9                   	leave
+ 17c:	c3                   	ret
+
+0000017d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 17d:	55                   	push   %ebp
+ 17e:	89 e5                	mov    %esp,%ebp
+ 180:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 183:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 18a:	eb 42                	jmp    1ce <gets+0x51>
+    cc = read(0, &c, 1);
+ 18c:	83 ec 04             	sub    $0x4,%esp
+ 18f:	6a 01                	push   $0x1
+ 191:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 194:	50                   	push   %eax
+ 195:	6a 00                	push   $0x0
+ 197:	e8 21 02 00 00       	call   3bd <read>
+ 19c:	83 c4 10             	add    $0x10,%esp
+ 19f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1a2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a6:	7e 33                	jle    1db <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ab:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ae:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1b1:	89 c2                	mov    %eax,%edx
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	01 c2                	add    %eax,%edx
+ 1b8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bc:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1be:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c2:	3c 0a                	cmp    $0xa,%al
+ 1c4:	74 16                	je     1dc <gets+0x5f>
+ 1c6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ca:	3c 0d                	cmp    $0xd,%al
+ 1cc:	74 0e                	je     1dc <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1d1:	83 c0 01             	add    $0x1,%eax
+ 1d4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d7:	7f b3                	jg     18c <gets+0xf>
+ 1d9:	eb 01                	jmp    1dc <gets+0x5f>
+      break;
+ 1db:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e2:	01 d0                	add    %edx,%eax
+ 1e4:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1e7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1ea:	c9                   	leave
+ 1eb:	c3                   	ret
+
+000001ec <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1ec:	55                   	push   %ebp
+ 1ed:	89 e5                	mov    %esp,%ebp
+ 1ef:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f2:	83 ec 08             	sub    $0x8,%esp
+ 1f5:	6a 00                	push   $0x0
+ 1f7:	ff 75 08             	push   0x8(%ebp)
+ 1fa:	e8 e6 01 00 00       	call   3e5 <open>
+ 1ff:	83 c4 10             	add    $0x10,%esp
+ 202:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 205:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 209:	79 07                	jns    212 <stat+0x26>
+    return -1;
+ 20b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 210:	eb 25                	jmp    237 <stat+0x4b>
+  r = fstat(fd, st);
+ 212:	83 ec 08             	sub    $0x8,%esp
+ 215:	ff 75 0c             	push   0xc(%ebp)
+ 218:	ff 75 f4             	push   -0xc(%ebp)
+ 21b:	e8 dd 01 00 00       	call   3fd <fstat>
+ 220:	83 c4 10             	add    $0x10,%esp
+ 223:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 226:	83 ec 0c             	sub    $0xc,%esp
+ 229:	ff 75 f4             	push   -0xc(%ebp)
+ 22c:	e8 9c 01 00 00       	call   3cd <close>
+ 231:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 234:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 237:	c9                   	leave
+ 238:	c3                   	ret
+
+00000239 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 239:	55                   	push   %ebp
+ 23a:	89 e5                	mov    %esp,%ebp
+ 23c:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 23f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 246:	eb 25                	jmp    26d <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 248:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 24b:	89 d0                	mov    %edx,%eax
+ 24d:	c1 e0 02             	shl    $0x2,%eax
+ 250:	01 d0                	add    %edx,%eax
+ 252:	01 c0                	add    %eax,%eax
+ 254:	89 c1                	mov    %eax,%ecx
+ 256:	8b 45 08             	mov    0x8(%ebp),%eax
+ 259:	8d 50 01             	lea    0x1(%eax),%edx
+ 25c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 25f:	0f b6 00             	movzbl (%eax),%eax
+ 262:	0f be c0             	movsbl %al,%eax
+ 265:	01 c8                	add    %ecx,%eax
+ 267:	83 e8 30             	sub    $0x30,%eax
+ 26a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 26d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 270:	0f b6 00             	movzbl (%eax),%eax
+ 273:	3c 2f                	cmp    $0x2f,%al
+ 275:	7e 0a                	jle    281 <atoi+0x48>
+ 277:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27a:	0f b6 00             	movzbl (%eax),%eax
+ 27d:	3c 39                	cmp    $0x39,%al
+ 27f:	7e c7                	jle    248 <atoi+0xf>
+  return n;
+ 281:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 284:	c9                   	leave
+ 285:	c3                   	ret
+
+00000286 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 286:	55                   	push   %ebp
+ 287:	89 e5                	mov    %esp,%ebp
+ 289:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 28c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 292:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 295:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 298:	eb 17                	jmp    2b1 <memmove+0x2b>
+    *dst++ = *src++;
+ 29a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 29d:	8d 42 01             	lea    0x1(%edx),%eax
+ 2a0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a6:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a9:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2ac:	0f b6 12             	movzbl (%edx),%edx
+ 2af:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2b1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b4:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b7:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2ba:	85 c0                	test   %eax,%eax
+ 2bc:	7f dc                	jg     29a <memmove+0x14>
+  return vdst;
+ 2be:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c1:	c9                   	leave
+ 2c2:	c3                   	ret
+
+000002c3 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 2c3:	55                   	push   %ebp
+ 2c4:	89 e5                	mov    %esp,%ebp
+ 2c6:	57                   	push   %edi
+ 2c7:	56                   	push   %esi
+ 2c8:	83 ec 30             	sub    $0x30,%esp
+ 2cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ce:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 2d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2d4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 2d7:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 2de:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 2e5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2e8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 2eb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 2ee:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 2f1:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 2f8:	e9 89 00 00 00       	jmp    386 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 2fd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 300:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 303:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 307:	01 c0                	add    %eax,%eax
+ 309:	89 c6                	mov    %eax,%esi
+ 30b:	89 d7                	mov    %edx,%edi
+ 30d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 310:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 313:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 316:	0f ad d0             	shrd   %cl,%edx,%eax
+ 319:	d3 ea                	shr    %cl,%edx
+ 31b:	f6 c1 20             	test   $0x20,%cl
+ 31e:	74 04                	je     324 <udiv64+0x61>
+ 320:	89 d0                	mov    %edx,%eax
+ 322:	31 d2                	xor    %edx,%edx
+ 324:	83 e0 01             	and    $0x1,%eax
+ 327:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 32a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 331:	89 f0                	mov    %esi,%eax
+ 333:	89 fa                	mov    %edi,%edx
+ 335:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 338:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 33b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 33e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 341:	8b 45 10             	mov    0x10(%ebp),%eax
+ 344:	ba 00 00 00 00       	mov    $0x0,%edx
+ 349:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 34c:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 34f:	19 d1                	sbb    %edx,%ecx
+ 351:	72 2f                	jb     382 <udiv64+0xbf>
+      r -= d;
+ 353:	8b 45 10             	mov    0x10(%ebp),%eax
+ 356:	ba 00 00 00 00       	mov    $0x0,%edx
+ 35b:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 35e:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 361:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 364:	b8 01 00 00 00       	mov    $0x1,%eax
+ 369:	ba 00 00 00 00       	mov    $0x0,%edx
+ 36e:	0f a5 c2             	shld   %cl,%eax,%edx
+ 371:	d3 e0                	shl    %cl,%eax
+ 373:	f6 c1 20             	test   $0x20,%cl
+ 376:	74 04                	je     37c <udiv64+0xb9>
+ 378:	89 c2                	mov    %eax,%edx
+ 37a:	31 c0                	xor    %eax,%eax
+ 37c:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 37f:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 382:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 386:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 38a:	0f 89 6d ff ff ff    	jns    2fd <udiv64+0x3a>
+    }
+  }
+  return q;
+ 390:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 393:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 396:	83 c4 30             	add    $0x30,%esp
+ 399:	5e                   	pop    %esi
+ 39a:	5f                   	pop    %edi
+ 39b:	5d                   	pop    %ebp
+ 39c:	c3                   	ret
+
+0000039d <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 39d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a2:	cd 40                	int    $0x40
+ 3a4:	c3                   	ret
+
+000003a5 <exit>:
+SYSCALL(exit)
+ 3a5:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3aa:	cd 40                	int    $0x40
+ 3ac:	c3                   	ret
+
+000003ad <wait>:
+SYSCALL(wait)
+ 3ad:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b2:	cd 40                	int    $0x40
+ 3b4:	c3                   	ret
+
+000003b5 <pipe>:
+SYSCALL(pipe)
+ 3b5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3ba:	cd 40                	int    $0x40
+ 3bc:	c3                   	ret
+
+000003bd <read>:
+SYSCALL(read)
+ 3bd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c2:	cd 40                	int    $0x40
+ 3c4:	c3                   	ret
+
+000003c5 <write>:
+SYSCALL(write)
+ 3c5:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3ca:	cd 40                	int    $0x40
+ 3cc:	c3                   	ret
+
+000003cd <close>:
+SYSCALL(close)
+ 3cd:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d2:	cd 40                	int    $0x40
+ 3d4:	c3                   	ret
+
+000003d5 <kill>:
+SYSCALL(kill)
+ 3d5:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3da:	cd 40                	int    $0x40
+ 3dc:	c3                   	ret
+
+000003dd <exec>:
+SYSCALL(exec)
+ 3dd:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e2:	cd 40                	int    $0x40
+ 3e4:	c3                   	ret
+
+000003e5 <open>:
+SYSCALL(open)
+ 3e5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ea:	cd 40                	int    $0x40
+ 3ec:	c3                   	ret
+
+000003ed <mknod>:
+SYSCALL(mknod)
+ 3ed:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f2:	cd 40                	int    $0x40
+ 3f4:	c3                   	ret
+
+000003f5 <unlink>:
+SYSCALL(unlink)
+ 3f5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3fa:	cd 40                	int    $0x40
+ 3fc:	c3                   	ret
+
+000003fd <fstat>:
+SYSCALL(fstat)
+ 3fd:	b8 08 00 00 00       	mov    $0x8,%eax
+ 402:	cd 40                	int    $0x40
+ 404:	c3                   	ret
+
+00000405 <link>:
+SYSCALL(link)
+ 405:	b8 13 00 00 00       	mov    $0x13,%eax
+ 40a:	cd 40                	int    $0x40
+ 40c:	c3                   	ret
+
+0000040d <mkdir>:
+SYSCALL(mkdir)
+ 40d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 412:	cd 40                	int    $0x40
+ 414:	c3                   	ret
+
+00000415 <chdir>:
+SYSCALL(chdir)
+ 415:	b8 09 00 00 00       	mov    $0x9,%eax
+ 41a:	cd 40                	int    $0x40
+ 41c:	c3                   	ret
+
+0000041d <dup>:
+SYSCALL(dup)
+ 41d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 422:	cd 40                	int    $0x40
+ 424:	c3                   	ret
+
+00000425 <getpid>:
+SYSCALL(getpid)
+ 425:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 42a:	cd 40                	int    $0x40
+ 42c:	c3                   	ret
+
+0000042d <sbrk>:
+SYSCALL(sbrk)
+ 42d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 432:	cd 40                	int    $0x40
+ 434:	c3                   	ret
+
+00000435 <sleep>:
+SYSCALL(sleep)
+ 435:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 43a:	cd 40                	int    $0x40
+ 43c:	c3                   	ret
+
+0000043d <uptime>:
+SYSCALL(uptime)
+ 43d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 442:	cd 40                	int    $0x40
+ 444:	c3                   	ret
+
+00000445 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 445:	b8 16 00 00 00       	mov    $0x16,%eax
+ 44a:	cd 40                	int    $0x40
+ 44c:	c3                   	ret
+
+0000044d <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 44d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 452:	cd 40                	int    $0x40
+ 454:	c3                   	ret
+
+00000455 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 455:	b8 18 00 00 00       	mov    $0x18,%eax
+ 45a:	cd 40                	int    $0x40
+ 45c:	c3                   	ret
+
+0000045d <copy_file>:
+SYSCALL(copy_file)
+ 45d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 462:	cd 40                	int    $0x40
+ 464:	c3                   	ret
+
+00000465 <change_queue>:
+SYSCALL(change_queue)
+ 465:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 46a:	cd 40                	int    $0x40
+ 46c:	c3                   	ret
+
+0000046d <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 46d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 472:	cd 40                	int    $0x40
+ 474:	c3                   	ret
+
+00000475 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 475:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 47a:	cd 40                	int    $0x40
+ 47c:	c3                   	ret
+
+0000047d <print_process_info>:
+SYSCALL(print_process_info)
+ 47d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 482:	cd 40                	int    $0x40
+ 484:	c3                   	ret
+
+00000485 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 485:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 48a:	cd 40                	int    $0x40
+ 48c:	c3                   	ret
+
+0000048d <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 48d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 492:	cd 40                	int    $0x40
+ 494:	c3                   	ret
+
+00000495 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 495:	b8 20 00 00 00       	mov    $0x20,%eax
+ 49a:	cd 40                	int    $0x40
+ 49c:	c3                   	ret
+
+0000049d <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 49d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4a2:	cd 40                	int    $0x40
+ 4a4:	c3                   	ret
+
+000004a5 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 4a5:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4aa:	cd 40                	int    $0x40
+ 4ac:	c3                   	ret
+
+000004ad <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 4ad:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4b2:	cd 40                	int    $0x40
+ 4b4:	c3                   	ret
+
+000004b5 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 4b5:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4ba:	cd 40                	int    $0x40
+ 4bc:	c3                   	ret
+
+000004bd <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 4bd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4c2:	cd 40                	int    $0x40
+ 4c4:	c3                   	ret
+
+000004c5 <set_affinity>:
+SYSCALL(set_affinity)
+ 4c5:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4ca:	cd 40                	int    $0x40
+ 4cc:	c3                   	ret
+
+000004cd <setsched>:
+SYSCALL(setsched)
+ 4cd:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4d2:	cd 40                	int    $0x40
+ 4d4:	c3                   	ret
+
+000004d5 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 4d5:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4da:	cd 40                	int    $0x40
+ 4dc:	c3                   	ret
+
+000004dd <set_quantum>:
+SYSCALL(set_quantum)
+ 4dd:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4e2:	cd 40                	int    $0x40
+ 4e4:	c3                   	ret
+
+000004e5 <schedtrace>:
+SYSCALL(schedtrace)
+ 4e5:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4ea:	cd 40                	int    $0x40
+ 4ec:	c3                   	ret
+
+000004ed <getrusage>:
+SYSCALL(getrusage)
+ 4ed:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4f2:	cd 40                	int    $0x40
+ 4f4:	c3                   	ret
+
+000004f5 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 4f5:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4fa:	cd 40                	int    $0x40
+ 4fc:	c3                   	ret
+
+000004fd <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 4fd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 502:	cd 40                	int    $0x40
+ 504:	c3                   	ret
+
+00000505 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 505:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 50a:	cd 40                	int    $0x40
+ 50c:	c3                   	ret
+
+0000050d <futex_wait>:
+SYSCALL(futex_wait)
+ 50d:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 512:	cd 40                	int    $0x40
+ 514:	c3                   	ret
+
+00000515 <futex_wake>:
+SYSCALL(futex_wake)
+ 515:	b8 30 00 00 00       	mov    $0x30,%eax
+ 51a:	cd 40                	int    $0x40
+ 51c:	c3                   	ret
+
+0000051d <syscall_latency>:
+SYSCALL(syscall_latency)
+ 51d:	b8 31 00 00 00       	mov    $0x31,%eax
+ 522:	cd 40                	int    $0x40
+ 524:	c3                   	ret
+
+00000525 <submit_batch>:
+SYSCALL(submit_batch)
+ 525:	b8 32 00 00 00       	mov    $0x32,%eax
+ 52a:	cd 40                	int    $0x40
+ 52c:	c3                   	ret
+
+0000052d <kmem_stats>:
+SYSCALL(kmem_stats)
+ 52d:	b8 33 00 00 00       	mov    $0x33,%eax
+ 532:	cd 40                	int    $0x40
+ 534:	c3                   	ret
+
+00000535 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 535:	b8 34 00 00 00       	mov    $0x34,%eax
+ 53a:	cd 40                	int    $0x40
+ 53c:	c3                   	ret
+
+0000053d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 53d:	55                   	push   %ebp
+ 53e:	89 e5                	mov    %esp,%ebp
+ 540:	83 ec 18             	sub    $0x18,%esp
+ 543:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 546:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 549:	83 ec 04             	sub    $0x4,%esp
+ 54c:	6a 01                	push   $0x1
+ 54e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 551:	50                   	push   %eax
+ 552:	ff 75 08             	push   0x8(%ebp)
+ 555:	e8 6b fe ff ff       	call   3c5 <write>
+ 55a:	83 c4 10             	add    $0x10,%esp
+}
+ 55d:	90                   	nop
+ 55e:	c9                   	leave
+ 55f:	c3                   	ret
+
+00000560 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 566:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 56d:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 571:	74 17                	je     58a <printint+0x2a>
+ 573:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 577:	79 11                	jns    58a <printint+0x2a>
+    neg = 1;
+ 579:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 580:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 583:	f7 d8                	neg    %eax
+ 585:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 588:	eb 06                	jmp    590 <printint+0x30>
+  } else {
+    x = xx;
+ 58a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 58d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 590:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 597:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 59a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 59d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5a2:	f7 f1                	div    %ecx
+ 5a4:	89 d1                	mov    %edx,%ecx
+ 5a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 5ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5af:	0f b6 91 38 10 00 00 	movzbl 0x1038(%ecx),%edx
+ 5b6:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5ba:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5bd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5c0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5c5:	f7 f1                	div    %ecx
+ 5c7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5ce:	75 c7                	jne    597 <printint+0x37>
+  if(neg)
+ 5d0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5d4:	74 2d                	je     603 <printint+0xa3>
+    buf[i++] = '-';
+ 5d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5d9:	8d 50 01             	lea    0x1(%eax),%edx
+ 5dc:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5df:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5e4:	eb 1d                	jmp    603 <printint+0xa3>
+    putc(fd, buf[i]);
+ 5e6:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5ec:	01 d0                	add    %edx,%eax
+ 5ee:	0f b6 00             	movzbl (%eax),%eax
+ 5f1:	0f be c0             	movsbl %al,%eax
+ 5f4:	83 ec 08             	sub    $0x8,%esp
+ 5f7:	50                   	push   %eax
+ 5f8:	ff 75 08             	push   0x8(%ebp)
+ 5fb:	e8 3d ff ff ff       	call   53d <putc>
+ 600:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 603:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 607:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 60b:	79 d9                	jns    5e6 <printint+0x86>
+}
+ 60d:	90                   	nop
+ 60e:	90                   	nop
+ 60f:	c9                   	leave
+ 610:	c3                   	ret
+
+00000611 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 611:	55                   	push   %ebp
+ 612:	89 e5                	mov    %esp,%ebp
+ 614:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 617:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 61e:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 621:	83 c0 04             	add    $0x4,%eax
+ 624:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 627:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 62e:	e9 59 01 00 00       	jmp    78c <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 633:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 636:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 639:	01 d0                	add    %edx,%eax
+ 63b:	0f b6 00             	movzbl (%eax),%eax
+ 63e:	0f be c0             	movsbl %al,%eax
+ 641:	25 ff 00 00 00       	and    $0xff,%eax
+ 646:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 649:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 64d:	75 2c                	jne    67b <printf+0x6a>
+      if(c == '%'){
+ 64f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 653:	75 0c                	jne    661 <printf+0x50>
+        state = '%';
+ 655:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 65c:	e9 27 01 00 00       	jmp    788 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 661:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 664:	0f be c0             	movsbl %al,%eax
+ 667:	83 ec 08             	sub    $0x8,%esp
+ 66a:	50                   	push   %eax
+ 66b:	ff 75 08             	push   0x8(%ebp)
+ 66e:	e8 ca fe ff ff       	call   53d <putc>
+ 673:	83 c4 10             	add    $0x10,%esp
+ 676:	e9 0d 01 00 00       	jmp    788 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 67b:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 67f:	0f 85 03 01 00 00    	jne    788 <printf+0x177>
+      if(c == 'd'){
+ 685:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 689:	75 1e                	jne    6a9 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 68b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 68e:	8b 00                	mov    (%eax),%eax
+ 690:	6a 01                	push   $0x1
+ 692:	6a 0a                	push   $0xa
+ 694:	50                   	push   %eax
+ 695:	ff 75 08             	push   0x8(%ebp)
+ 698:	e8 c3 fe ff ff       	call   560 <printint>
+ 69d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6a0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6a4:	e9 d8 00 00 00       	jmp    781 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6a9:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6ad:	74 06                	je     6b5 <printf+0xa4>
+ 6af:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6b3:	75 1e                	jne    6d3 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6b5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6b8:	8b 00                	mov    (%eax),%eax
+ 6ba:	6a 00                	push   $0x0
+ 6bc:	6a 10                	push   $0x10
+ 6be:	50                   	push   %eax
+ 6bf:	ff 75 08             	push   0x8(%ebp)
+ 6c2:	e8 99 fe ff ff       	call   560 <printint>
+ 6c7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6ca:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6ce:	e9 ae 00 00 00       	jmp    781 <printf+0x170>
+      } else if(c == 's'){
+ 6d3:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6d7:	75 43                	jne    71c <printf+0x10b>
+        s = (char*)*ap;
+ 6d9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6dc:	8b 00                	mov    (%eax),%eax
+ 6de:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6e1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6e5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6e9:	75 25                	jne    710 <printf+0xff>
+          s = "(null)";
+ 6eb:	c7 45 f4 41 0c 00 00 	movl   $0xc41,-0xc(%ebp)
+        while(*s != 0){
+ 6f2:	eb 1c                	jmp    710 <printf+0xff>
+          putc(fd, *s);
+ 6f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6f7:	0f b6 00             	movzbl (%eax),%eax
+ 6fa:	0f be c0             	movsbl %al,%eax
+ 6fd:	83 ec 08             	sub    $0x8,%esp
+ 700:	50                   	push   %eax
+ 701:	ff 75 08             	push   0x8(%ebp)
+ 704:	e8 34 fe ff ff       	call   53d <putc>
+ 709:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 70c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 710:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 713:	0f b6 00             	movzbl (%eax),%eax
+ 716:	84 c0                	test   %al,%al
+ 718:	75 da                	jne    6f4 <printf+0xe3>
+ 71a:	eb 65                	jmp    781 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 71c:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 720:	75 1d                	jne    73f <printf+0x12e>
+        putc(fd, *ap);
+ 722:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 725:	8b 00                	mov    (%eax),%eax
+ 727:	0f be c0             	movsbl %al,%eax
+ 72a:	83 ec 08             	sub    $0x8,%esp
+ 72d:	50                   	push   %eax
+ 72e:	ff 75 08             	push   0x8(%ebp)
+ 731:	e8 07 fe ff ff       	call   53d <putc>
+ 736:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 739:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 73d:	eb 42                	jmp    781 <printf+0x170>
+      } else if(c == '%'){
+ 73f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 743:	75 17                	jne    75c <printf+0x14b>
+        putc(fd, c);
+ 745:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 748:	0f be c0             	movsbl %al,%eax
+ 74b:	83 ec 08             	sub    $0x8,%esp
+ 74e:	50                   	push   %eax
+ 74f:	ff 75 08             	push   0x8(%ebp)
+ 752:	e8 e6 fd ff ff       	call   53d <putc>
+ 757:	83 c4 10             	add    $0x10,%esp
+ 75a:	eb 25                	jmp    781 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 75c:	83 ec 08             	sub    $0x8,%esp
+ 75f:	6a 25                	push   $0x25
+ 761:	ff 75 08             	push   0x8(%ebp)
+ 764:	e8 d4 fd ff ff       	call   53d <putc>
+ 769:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 76c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 76f:	0f be c0             	movsbl %al,%eax
+ 772:	83 ec 08             	sub    $0x8,%esp
+ 775:	50                   	push   %eax
+ 776:	ff 75 08             	push   0x8(%ebp)
+ 779:	e8 bf fd ff ff       	call   53d <putc>
+ 77e:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 781:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 788:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 78c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 78f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 792:	01 d0                	add    %edx,%eax
+ 794:	0f b6 00             	movzbl (%eax),%eax
+ 797:	84 c0                	test   %al,%al
+ 799:	0f 85 94 fe ff ff    	jne    633 <printf+0x22>
+    }
+  }
+}
+ 79f:	90                   	nop
+ 7a0:	90                   	nop
+ 7a1:	c9                   	leave
+ 7a2:	c3                   	ret
+
+000007a3 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7a3:	55                   	push   %ebp
+ 7a4:	89 e5                	mov    %esp,%ebp
+ 7a6:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ac:	83 e8 08             	sub    $0x8,%eax
+ 7af:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b2:	a1 54 10 00 00       	mov    0x1054,%eax
+ 7b7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7ba:	eb 24                	jmp    7e0 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7bf:	8b 00                	mov    (%eax),%eax
+ 7c1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7c4:	72 12                	jb     7d8 <free+0x35>
+ 7c6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7c9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7cc:	72 24                	jb     7f2 <free+0x4f>
+ 7ce:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d1:	8b 00                	mov    (%eax),%eax
+ 7d3:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7d6:	72 1a                	jb     7f2 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7db:	8b 00                	mov    (%eax),%eax
+ 7dd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7e0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7e3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7e6:	73 d4                	jae    7bc <free+0x19>
+ 7e8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7eb:	8b 00                	mov    (%eax),%eax
+ 7ed:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7f0:	73 ca                	jae    7bc <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7f2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f5:	8b 40 04             	mov    0x4(%eax),%eax
+ 7f8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7ff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 802:	01 c2                	add    %eax,%edx
+ 804:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 807:	8b 00                	mov    (%eax),%eax
+ 809:	39 c2                	cmp    %eax,%edx
+ 80b:	75 24                	jne    831 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 80d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 810:	8b 50 04             	mov    0x4(%eax),%edx
+ 813:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 816:	8b 00                	mov    (%eax),%eax
+ 818:	8b 40 04             	mov    0x4(%eax),%eax
+ 81b:	01 c2                	add    %eax,%edx
+ 81d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 820:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 823:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 826:	8b 00                	mov    (%eax),%eax
+ 828:	8b 10                	mov    (%eax),%edx
+ 82a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 82d:	89 10                	mov    %edx,(%eax)
+ 82f:	eb 0a                	jmp    83b <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 831:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 834:	8b 10                	mov    (%eax),%edx
+ 836:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 839:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 83b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83e:	8b 40 04             	mov    0x4(%eax),%eax
+ 841:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 848:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 84b:	01 d0                	add    %edx,%eax
+ 84d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 850:	75 20                	jne    872 <free+0xcf>
+    p->s.size += bp->s.size;
+ 852:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 855:	8b 50 04             	mov    0x4(%eax),%edx
+ 858:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 85b:	8b 40 04             	mov    0x4(%eax),%eax
+ 85e:	01 c2                	add    %eax,%edx
+ 860:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 863:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 866:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 869:	8b 10                	mov    (%eax),%edx
+ 86b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86e:	89 10                	mov    %edx,(%eax)
+ 870:	eb 08                	jmp    87a <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 872:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 875:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 878:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 87a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 87d:	a3 54 10 00 00       	mov    %eax,0x1054
+}
+ 882:	90                   	nop
+ 883:	c9                   	leave
+ 884:	c3                   	ret
+
+00000885 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 885:	55                   	push   %ebp
+ 886:	89 e5                	mov    %esp,%ebp
+ 888:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 88b:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 892:	77 07                	ja     89b <morecore+0x16>
+    nu = 4096;
+ 894:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 89b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 89e:	c1 e0 03             	shl    $0x3,%eax
+ 8a1:	83 ec 0c             	sub    $0xc,%esp
+ 8a4:	50                   	push   %eax
+ 8a5:	e8 83 fb ff ff       	call   42d <sbrk>
+ 8aa:	83 c4 10             	add    $0x10,%esp
+ 8ad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 8b0:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8b4:	75 07                	jne    8bd <morecore+0x38>
+    return 0;
+ 8b6:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8bb:	eb 26                	jmp    8e3 <morecore+0x5e>
+  hp = (Header*)p;
+ 8bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 8c3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8c6:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8c9:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8cc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8cf:	83 c0 08             	add    $0x8,%eax
+ 8d2:	83 ec 0c             	sub    $0xc,%esp
+ 8d5:	50                   	push   %eax
+ 8d6:	e8 c8 fe ff ff       	call   7a3 <free>
+ 8db:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 8de:	a1 54 10 00 00       	mov    0x1054,%eax
+}
+ 8e3:	c9                   	leave
+ 8e4:	c3                   	ret
+
+000008e5 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8e5:	55                   	push   %ebp
+ 8e6:	89 e5                	mov    %esp,%ebp
+ 8e8:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8eb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ee:	83 c0 07             	add    $0x7,%eax
+ 8f1:	c1 e8 03             	shr    $0x3,%eax
+ 8f4:	83 c0 01             	add    $0x1,%eax
+ 8f7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 8fa:	a1 54 10 00 00       	mov    0x1054,%eax
+ 8ff:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 902:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 906:	75 23                	jne    92b <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 908:	c7 45 f0 4c 10 00 00 	movl   $0x104c,-0x10(%ebp)
+ 90f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 912:	a3 54 10 00 00       	mov    %eax,0x1054
+ 917:	a1 54 10 00 00       	mov    0x1054,%eax
+ 91c:	a3 4c 10 00 00       	mov    %eax,0x104c
+    base.s.size = 0;
+ 921:	c7 05 50 10 00 00 00 	movl   $0x0,0x1050
+ 928:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 92b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 92e:	8b 00                	mov    (%eax),%eax
+ 930:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 933:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 936:	8b 40 04             	mov    0x4(%eax),%eax
+ 939:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 93c:	72 4d                	jb     98b <malloc+0xa6>
+      if(p->s.size == nunits)
+ 93e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 941:	8b 40 04             	mov    0x4(%eax),%eax
+ 944:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 947:	75 0c                	jne    955 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 949:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 94c:	8b 10                	mov    (%eax),%edx
+ 94e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 951:	89 10                	mov    %edx,(%eax)
+ 953:	eb 26                	jmp    97b <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 955:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 958:	8b 40 04             	mov    0x4(%eax),%eax
+ 95b:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 95e:	89 c2                	mov    %eax,%edx
+ 960:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 963:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 966:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 969:	8b 40 04             	mov    0x4(%eax),%eax
+ 96c:	c1 e0 03             	shl    $0x3,%eax
+ 96f:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 972:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 975:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 978:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 97b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 97e:	a3 54 10 00 00       	mov    %eax,0x1054
+      return (void*)(p + 1);
+ 983:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 986:	83 c0 08             	add    $0x8,%eax
+ 989:	eb 3b                	jmp    9c6 <malloc+0xe1>
+    }
+    if(p == freep)
+ 98b:	a1 54 10 00 00       	mov    0x1054,%eax
+ 990:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 993:	75 1e                	jne    9b3 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 995:	83 ec 0c             	sub    $0xc,%esp
+ 998:	ff 75 ec             	push   -0x14(%ebp)
+ 99b:	e8 e5 fe ff ff       	call   885 <morecore>
+ 9a0:	83 c4 10             	add    $0x10,%esp
+ 9a3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9a6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9aa:	75 07                	jne    9b3 <malloc+0xce>
+        return 0;
+ 9ac:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9b1:	eb 13                	jmp    9c6 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9bc:	8b 00                	mov    (%eax),%eax
+ 9be:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9c1:	e9 6d ff ff ff       	jmp    933 <malloc+0x4e>
+  }
+}
+ 9c6:	c9                   	leave
+ 9c7:	c3                   	ret
+
+000009c8 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ 9c8:	55                   	push   %ebp
+ 9c9:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 9cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ce:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 9d4:	90                   	nop
+ 9d5:	5d                   	pop    %ebp
+ 9d6:	c3                   	ret
+
+000009d7 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 9d7:	55                   	push   %ebp
+ 9d8:	89 e5                	mov    %esp,%ebp
+ 9da:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 9dd:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9e0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9e5:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 9ea:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ 9ee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9f1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9f5:	74 3b                	je     a32 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ 9f7:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 9fb:	74 2d                	je     a2a <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ 9fd:	8b 55 08             	mov    0x8(%ebp),%edx
+ a00:	b8 02 00 00 00       	mov    $0x2,%eax
+ a05:	87 02                	xchg   %eax,(%edx)
+ a07:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a0a:	eb 1e                	jmp    a2a <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ a0c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a0f:	83 ec 08             	sub    $0x8,%esp
+ a12:	6a 02                	push   $0x2
+ a14:	50                   	push   %eax
+ a15:	e8 f3 fa ff ff       	call   50d <futex_wait>
+ a1a:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a1d:	8b 55 08             	mov    0x8(%ebp),%edx
+ a20:	b8 02 00 00 00       	mov    $0x2,%eax
+ a25:	87 02                	xchg   %eax,(%edx)
+ a27:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a2a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a2e:	75 dc                	jne    a0c <mutex_lock+0x35>
+ a30:	eb 01                	jmp    a33 <mutex_lock+0x5c>
+    return;
+ a32:	90                   	nop
+  }
+}
+ a33:	c9                   	leave
+ a34:	c3                   	ret
+
+00000a35 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ a35:	55                   	push   %ebp
+ a36:	89 e5                	mov    %esp,%ebp
+ a38:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ a3b:	8b 45 08             	mov    0x8(%ebp),%eax
+ a3e:	ba 01 00 00 00       	mov    $0x1,%edx
+ a43:	f7 da                	neg    %edx
+ a45:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ a49:	83 fa 01             	cmp    $0x1,%edx
+ a4c:	74 1a                	je     a68 <mutex_unlock+0x33>
+    m->state = 0;
+ a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ a51:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ a57:	8b 45 08             	mov    0x8(%ebp),%eax
+ a5a:	83 ec 08             	sub    $0x8,%esp
+ a5d:	6a 01                	push   $0x1
+ a5f:	50                   	push   %eax
+ a60:	e8 b0 fa ff ff       	call   515 <futex_wake>
+ a65:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ a68:	90                   	nop
+ a69:	c9                   	leave
+ a6a:	c3                   	ret
+
+00000a6b <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ a6b:	55                   	push   %ebp
+ a6c:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ a6e:	8b 45 08             	mov    0x8(%ebp),%eax
+ a71:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ a77:	8b 45 08             	mov    0x8(%ebp),%eax
+ a7a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ a81:	90                   	nop
+ a82:	5d                   	pop    %ebp
+ a83:	c3                   	ret
+
+00000a84 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ a84:	55                   	push   %ebp
+ a85:	89 e5                	mov    %esp,%ebp
+ a87:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ a8a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a8d:	83 c0 04             	add    $0x4,%eax
+ a90:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ a94:	8b 45 08             	mov    0x8(%ebp),%eax
+ a97:	83 ec 08             	sub    $0x8,%esp
+ a9a:	ff 75 0c             	push   0xc(%ebp)
+ a9d:	50                   	push   %eax
+ a9e:	e8 6a fa ff ff       	call   50d <futex_wait>
+ aa3:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ aa6:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa9:	83 c0 04             	add    $0x4,%eax
+ aac:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ ab0:	90                   	nop
+ ab1:	c9                   	leave
+ ab2:	c3                   	ret
+
+00000ab3 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ ab3:	55                   	push   %ebp
+ ab4:	89 e5                	mov    %esp,%ebp
+ ab6:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+ abc:	8b 00                	mov    (%eax),%eax
+ abe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ ac1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ac5:	78 17                	js     ade <rwlock_rdlock+0x2b>
+ ac7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aca:	83 c0 01             	add    $0x1,%eax
+ acd:	89 c1                	mov    %eax,%ecx
+ acf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad2:	8b 55 08             	mov    0x8(%ebp),%edx
+ ad5:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ ad9:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ adc:	74 19                	je     af7 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ ade:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ae2:	79 d5                	jns    ab9 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ ae4:	83 ec 08             	sub    $0x8,%esp
+ ae7:	ff 75 f4             	push   -0xc(%ebp)
+ aea:	ff 75 08             	push   0x8(%ebp)
+ aed:	e8 92 ff ff ff       	call   a84 <rwlock_sleep>
+ af2:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ af5:	eb c2                	jmp    ab9 <rwlock_rdlock+0x6>
+      return;
+ af7:	90                   	nop
+  }
+}
+ af8:	c9                   	leave
+ af9:	c3                   	ret
+
+00000afa <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ afa:	55                   	push   %ebp
+ afb:	89 e5                	mov    %esp,%ebp
+ afd:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b00:	eb 11                	jmp    b13 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ b02:	83 ec 08             	sub    $0x8,%esp
+ b05:	ff 75 f4             	push   -0xc(%ebp)
+ b08:	ff 75 08             	push   0x8(%ebp)
+ b0b:	e8 74 ff ff ff       	call   a84 <rwlock_sleep>
+ b10:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b13:	8b 55 08             	mov    0x8(%ebp),%edx
+ b16:	b8 00 00 00 00       	mov    $0x0,%eax
+ b1b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ b20:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b24:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b27:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b2b:	75 d5                	jne    b02 <rwlock_wrlock+0x8>
+}
+ b2d:	90                   	nop
+ b2e:	90                   	nop
+ b2f:	c9                   	leave
+ b30:	c3                   	ret
+
+00000b31 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ b31:	55                   	push   %ebp
+ b32:	89 e5                	mov    %esp,%ebp
+ b34:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ b37:	8b 45 08             	mov    0x8(%ebp),%eax
+ b3a:	8b 00                	mov    (%eax),%eax
+ b3c:	85 c0                	test   %eax,%eax
+ b3e:	79 0c                	jns    b4c <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ b40:	8b 45 08             	mov    0x8(%ebp),%eax
+ b43:	ba 00 00 00 00       	mov    $0x0,%edx
+ b48:	87 10                	xchg   %edx,(%eax)
+ b4a:	eb 18                	jmp    b64 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ b4c:	8b 55 08             	mov    0x8(%ebp),%edx
+ b4f:	b8 01 00 00 00       	mov    $0x1,%eax
+ b54:	f7 d8                	neg    %eax
+ b56:	89 c1                	mov    %eax,%ecx
+ b58:	89 c8                	mov    %ecx,%eax
+ b5a:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ b5e:	01 c8                	add    %ecx,%eax
+ b60:	85 c0                	test   %eax,%eax
+ b62:	75 20                	jne    b84 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ b64:	8b 45 08             	mov    0x8(%ebp),%eax
+ b67:	8b 40 04             	mov    0x4(%eax),%eax
+ b6a:	85 c0                	test   %eax,%eax
+ b6c:	74 17                	je     b85 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b71:	83 ec 08             	sub    $0x8,%esp
+ b74:	68 ff ff ff 7f       	push   $0x7fffffff
+ b79:	50                   	push   %eax
+ b7a:	e8 96 f9 ff ff       	call   515 <futex_wake>
+ b7f:	83 c4 10             	add    $0x10,%esp
+ b82:	eb 01                	jmp    b85 <rwlock_unlock+0x54>
+    return;
+ b84:	90                   	nop
+}
+ b85:	c9                   	leave
+ b86:	c3                   	ret
+
+00000b87 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ b87:	55                   	push   %ebp
+ b88:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b8d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b93:	90                   	nop
+ b94:	5d                   	pop    %ebp
+ b95:	c3                   	ret
+
+00000b96 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ b96:	55                   	push   %ebp
+ b97:	89 e5                	mov    %esp,%ebp
+ b99:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ b9c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b9f:	8b 00                	mov    (%eax),%eax
+ ba1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ ba4:	83 ec 0c             	sub    $0xc,%esp
+ ba7:	ff 75 0c             	push   0xc(%ebp)
+ baa:	e8 86 fe ff ff       	call   a35 <mutex_unlock>
+ baf:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ bb2:	8b 45 08             	mov    0x8(%ebp),%eax
+ bb5:	83 ec 08             	sub    $0x8,%esp
+ bb8:	ff 75 f4             	push   -0xc(%ebp)
+ bbb:	50                   	push   %eax
+ bbc:	e8 4c f9 ff ff       	call   50d <futex_wait>
+ bc1:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ bc4:	83 ec 0c             	sub    $0xc,%esp
+ bc7:	ff 75 0c             	push   0xc(%ebp)
+ bca:	e8 08 fe ff ff       	call   9d7 <mutex_lock>
+ bcf:	83 c4 10             	add    $0x10,%esp
+}
+ bd2:	90                   	nop
+ bd3:	c9                   	leave
+ bd4:	c3                   	ret
+
+00000bd5 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ bd5:	55                   	push   %ebp
+ bd6:	89 e5                	mov    %esp,%ebp
+ bd8:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ bdb:	8b 45 08             	mov    0x8(%ebp),%eax
+ bde:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ be2:	8b 45 08             	mov    0x8(%ebp),%eax
+ be5:	83 ec 08             	sub    $0x8,%esp
+ be8:	6a 01                	push   $0x1
+ bea:	50                   	push   %eax
+ beb:	e8 25 f9 ff ff       	call   515 <futex_wake>
+ bf0:	83 c4 10             	add    $0x10,%esp
+}
+ bf3:	90                   	nop
+ bf4:	c9                   	leave
+ bf5:	c3                   	ret
+
+00000bf6 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ bf6:	55                   	push   %ebp
+ bf7:	89 e5                	mov    %esp,%ebp
+ bf9:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ bfc:	8b 45 08             	mov    0x8(%ebp),%eax
+ bff:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ c03:	8b 45 08             	mov    0x8(%ebp),%eax
+ c06:	83 ec 08             	sub    $0x8,%esp
+ c09:	68 ff ff ff 7f       	push   $0x7fffffff
+ c0e:	50                   	push   %eax
+ c0f:	e8 01 f9 ff ff       	call   515 <futex_wake>
+ c14:	83 c4 10             	add    $0x10,%esp
+}
+ c17:	90                   	nop
+ c18:	c9                   	leave
+ c19:	c3                   	ret
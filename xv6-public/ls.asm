@@ -0,0 +1,2053 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "user.h"
+#include "fs.h"
+
+char*
+fmtname(char *path)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 14             	sub    $0x14,%esp
+  static char buf[DIRSIZ+1];
+  char *p;
+
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+   7:	83 ec 0c             	sub    $0xc,%esp
+   a:	ff 75 08             	push   0x8(%ebp)
+   d:	e8 c7 03 00 00       	call   3d9 <strlen>
+  12:	83 c4 10             	add    $0x10,%esp
+  15:	8b 55 08             	mov    0x8(%ebp),%edx
+  18:	01 d0                	add    %edx,%eax
+  1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1d:	eb 04                	jmp    23 <fmtname+0x23>
+  1f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  26:	3b 45 08             	cmp    0x8(%ebp),%eax
+  29:	72 0a                	jb     35 <fmtname+0x35>
+  2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  2e:	0f b6 00             	movzbl (%eax),%eax
+  31:	3c 2f                	cmp    $0x2f,%al
+  33:	75 ea                	jne    1f <fmtname+0x1f>
+    ;
+  p++;
+  35:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	ff 75 f4             	push   -0xc(%ebp)
+  3f:	e8 95 03 00 00       	call   3d9 <strlen>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	83 f8 0d             	cmp    $0xd,%eax
+  4a:	76 05                	jbe    51 <fmtname+0x51>
+    return p;
+  4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  4f:	eb 60                	jmp    b1 <fmtname+0xb1>
+  memmove(buf, p, strlen(p));
+  51:	83 ec 0c             	sub    $0xc,%esp
+  54:	ff 75 f4             	push   -0xc(%ebp)
+  57:	e8 7d 03 00 00       	call   3d9 <strlen>
+  5c:	83 c4 10             	add    $0x10,%esp
+  5f:	83 ec 04             	sub    $0x4,%esp
+  62:	50                   	push   %eax
+  63:	ff 75 f4             	push   -0xc(%ebp)
+  66:	68 94 13 00 00       	push   $0x1394
+  6b:	e8 e6 04 00 00       	call   556 <memmove>
+  70:	83 c4 10             	add    $0x10,%esp
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  73:	83 ec 0c             	sub    $0xc,%esp
+  76:	ff 75 f4             	push   -0xc(%ebp)
+  79:	e8 5b 03 00 00       	call   3d9 <strlen>
+  7e:	83 c4 10             	add    $0x10,%esp
+  81:	ba 0e 00 00 00       	mov    $0xe,%edx
+  86:	89 d3                	mov    %edx,%ebx
+  88:	29 c3                	sub    %eax,%ebx
+  8a:	83 ec 0c             	sub    $0xc,%esp
+  8d:	ff 75 f4             	push   -0xc(%ebp)
+  90:	e8 44 03 00 00       	call   3d9 <strlen>
+  95:	83 c4 10             	add    $0x10,%esp
+  98:	05 94 13 00 00       	add    $0x1394,%eax
+  9d:	83 ec 04             	sub    $0x4,%esp
+  a0:	53                   	push   %ebx
+  a1:	6a 20                	push   $0x20
+  a3:	50                   	push   %eax
+  a4:	e8 57 03 00 00       	call   400 <memset>
+  a9:	83 c4 10             	add    $0x10,%esp
+  return buf;
+  ac:	b8 94 13 00 00       	mov    $0x1394,%eax
+}
+  b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  b4:	c9                   	leave
+  b5:	c3                   	ret
+
+000000b6 <ls>:
+
+void
+ls(char *path)
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	57                   	push   %edi
+  ba:	56                   	push   %esi
+  bb:	53                   	push   %ebx
+  bc:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  char buf[512], *p;
+  int fd;
+  struct dirent de;
+  struct stat st;
+
+  if((fd = open(path, 0)) < 0){
+  c2:	83 ec 08             	sub    $0x8,%esp
+  c5:	6a 00                	push   $0x0
+  c7:	ff 75 08             	push   0x8(%ebp)
+  ca:	e8 e6 05 00 00       	call   6b5 <open>
+  cf:	83 c4 10             	add    $0x10,%esp
+  d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  d5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  d9:	79 1a                	jns    f5 <ls+0x3f>
+    printf(2, "ls: cannot open %s\n", path);
+  db:	83 ec 04             	sub    $0x4,%esp
+  de:	ff 75 08             	push   0x8(%ebp)
+  e1:	68 ea 0e 00 00       	push   $0xeea
+  e6:	6a 02                	push   $0x2
+  e8:	e8 f4 07 00 00       	call   8e1 <printf>
+  ed:	83 c4 10             	add    $0x10,%esp
+    return;
+  f0:	e9 e3 01 00 00       	jmp    2d8 <ls+0x222>
+  }
+
+  if(fstat(fd, &st) < 0){
+  f5:	83 ec 08             	sub    $0x8,%esp
+  f8:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+  fe:	50                   	push   %eax
+  ff:	ff 75 e4             	push   -0x1c(%ebp)
+ 102:	e8 c6 05 00 00       	call   6cd <fstat>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	85 c0                	test   %eax,%eax
+ 10c:	79 28                	jns    136 <ls+0x80>
+    printf(2, "ls: cannot stat %s\n", path);
+ 10e:	83 ec 04             	sub    $0x4,%esp
+ 111:	ff 75 08             	push   0x8(%ebp)
+ 114:	68 fe 0e 00 00       	push   $0xefe
+ 119:	6a 02                	push   $0x2
+ 11b:	e8 c1 07 00 00       	call   8e1 <printf>
+ 120:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 123:	83 ec 0c             	sub    $0xc,%esp
+ 126:	ff 75 e4             	push   -0x1c(%ebp)
+ 129:	e8 6f 05 00 00       	call   69d <close>
+ 12e:	83 c4 10             	add    $0x10,%esp
+    return;
+ 131:	e9 a2 01 00 00       	jmp    2d8 <ls+0x222>
+  }
+
+  switch(st.type){
+ 136:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 13d:	98                   	cwtl
+ 13e:	83 f8 01             	cmp    $0x1,%eax
+ 141:	74 48                	je     18b <ls+0xd5>
+ 143:	83 f8 02             	cmp    $0x2,%eax
+ 146:	0f 85 7e 01 00 00    	jne    2ca <ls+0x214>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 14c:	8b bd cc fd ff ff    	mov    -0x234(%ebp),%edi
+ 152:	8b b5 c4 fd ff ff    	mov    -0x23c(%ebp),%esi
+ 158:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 15f:	0f bf d8             	movswl %ax,%ebx
+ 162:	83 ec 0c             	sub    $0xc,%esp
+ 165:	ff 75 08             	push   0x8(%ebp)
+ 168:	e8 93 fe ff ff       	call   0 <fmtname>
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	83 ec 08             	sub    $0x8,%esp
+ 173:	57                   	push   %edi
+ 174:	56                   	push   %esi
+ 175:	53                   	push   %ebx
+ 176:	50                   	push   %eax
+ 177:	68 12 0f 00 00       	push   $0xf12
+ 17c:	6a 01                	push   $0x1
+ 17e:	e8 5e 07 00 00       	call   8e1 <printf>
+ 183:	83 c4 20             	add    $0x20,%esp
+    break;
+ 186:	e9 3f 01 00 00       	jmp    2ca <ls+0x214>
+
+  case T_DIR:
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 18b:	83 ec 0c             	sub    $0xc,%esp
+ 18e:	ff 75 08             	push   0x8(%ebp)
+ 191:	e8 43 02 00 00       	call   3d9 <strlen>
+ 196:	83 c4 10             	add    $0x10,%esp
+ 199:	83 c0 10             	add    $0x10,%eax
+ 19c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1a1:	76 17                	jbe    1ba <ls+0x104>
+      printf(1, "ls: path too long\n");
+ 1a3:	83 ec 08             	sub    $0x8,%esp
+ 1a6:	68 1f 0f 00 00       	push   $0xf1f
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	e8 2f 07 00 00       	call   8e1 <printf>
+ 1b2:	83 c4 10             	add    $0x10,%esp
+      break;
+ 1b5:	e9 10 01 00 00       	jmp    2ca <ls+0x214>
+    }
+    strcpy(buf, path);
+ 1ba:	83 ec 08             	sub    $0x8,%esp
+ 1bd:	ff 75 08             	push   0x8(%ebp)
+ 1c0:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 1c6:	50                   	push   %eax
+ 1c7:	e8 9e 01 00 00       	call   36a <strcpy>
+ 1cc:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1cf:	83 ec 0c             	sub    $0xc,%esp
+ 1d2:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 1d8:	50                   	push   %eax
+ 1d9:	e8 fb 01 00 00       	call   3d9 <strlen>
+ 1de:	83 c4 10             	add    $0x10,%esp
+ 1e1:	8d 95 e0 fd ff ff    	lea    -0x220(%ebp),%edx
+ 1e7:	01 d0                	add    %edx,%eax
+ 1e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    *p++ = '/';
+ 1ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1ef:	8d 50 01             	lea    0x1(%eax),%edx
+ 1f2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 1f5:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f8:	e9 ac 00 00 00       	jmp    2a9 <ls+0x1f3>
+      if(de.inum == 0)
+ 1fd:	0f b7 85 d0 fd ff ff 	movzwl -0x230(%ebp),%eax
+ 204:	66 85 c0             	test   %ax,%ax
+ 207:	0f 84 9b 00 00 00    	je     2a8 <ls+0x1f2>
+        continue;
+      memmove(p, de.name, DIRSIZ);
+ 20d:	83 ec 04             	sub    $0x4,%esp
+ 210:	6a 0e                	push   $0xe
+ 212:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+ 218:	83 c0 02             	add    $0x2,%eax
+ 21b:	50                   	push   %eax
+ 21c:	ff 75 e0             	push   -0x20(%ebp)
+ 21f:	e8 32 03 00 00       	call   556 <memmove>
+ 224:	83 c4 10             	add    $0x10,%esp
+      p[DIRSIZ] = 0;
+ 227:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 22a:	83 c0 0e             	add    $0xe,%eax
+ 22d:	c6 00 00             	movb   $0x0,(%eax)
+      if(stat(buf, &st) < 0){
+ 230:	83 ec 08             	sub    $0x8,%esp
+ 233:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+ 239:	50                   	push   %eax
+ 23a:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 240:	50                   	push   %eax
+ 241:	e8 76 02 00 00       	call   4bc <stat>
+ 246:	83 c4 10             	add    $0x10,%esp
+ 249:	85 c0                	test   %eax,%eax
+ 24b:	79 1b                	jns    268 <ls+0x1b2>
+        printf(1, "ls: cannot stat %s\n", buf);
+ 24d:	83 ec 04             	sub    $0x4,%esp
+ 250:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 256:	50                   	push   %eax
+ 257:	68 fe 0e 00 00       	push   $0xefe
+ 25c:	6a 01                	push   $0x1
+ 25e:	e8 7e 06 00 00       	call   8e1 <printf>
+ 263:	83 c4 10             	add    $0x10,%esp
+        continue;
+ 266:	eb 41                	jmp    2a9 <ls+0x1f3>
+      }
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 268:	8b bd cc fd ff ff    	mov    -0x234(%ebp),%edi
+ 26e:	8b b5 c4 fd ff ff    	mov    -0x23c(%ebp),%esi
+ 274:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 27b:	0f bf d8             	movswl %ax,%ebx
+ 27e:	83 ec 0c             	sub    $0xc,%esp
+ 281:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 287:	50                   	push   %eax
+ 288:	e8 73 fd ff ff       	call   0 <fmtname>
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	83 ec 08             	sub    $0x8,%esp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	53                   	push   %ebx
+ 296:	50                   	push   %eax
+ 297:	68 12 0f 00 00       	push   $0xf12
+ 29c:	6a 01                	push   $0x1
+ 29e:	e8 3e 06 00 00       	call   8e1 <printf>
+ 2a3:	83 c4 20             	add    $0x20,%esp
+ 2a6:	eb 01                	jmp    2a9 <ls+0x1f3>
+        continue;
+ 2a8:	90                   	nop
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 2a9:	83 ec 04             	sub    $0x4,%esp
+ 2ac:	6a 10                	push   $0x10
+ 2ae:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+ 2b4:	50                   	push   %eax
+ 2b5:	ff 75 e4             	push   -0x1c(%ebp)
+ 2b8:	e8 d0 03 00 00       	call   68d <read>
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	83 f8 10             	cmp    $0x10,%eax
+ 2c3:	0f 84 34 ff ff ff    	je     1fd <ls+0x147>
+    }
+    break;
+ 2c9:	90                   	nop
+  }
+  close(fd);
+ 2ca:	83 ec 0c             	sub    $0xc,%esp
+ 2cd:	ff 75 e4             	push   -0x1c(%ebp)
+ 2d0:	e8 c8 03 00 00       	call   69d <close>
+ 2d5:	83 c4 10             	add    $0x10,%esp
+}
+ 2d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2db:	5b                   	pop    %ebx
+ 2dc:	5e                   	pop    %esi
+ 2dd:	5f                   	pop    %edi
+ 2de:	5d                   	pop    %ebp
+ 2df:	c3                   	ret
+
+000002e0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 2e0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 2e4:	83 e4 f0             	and    $0xfffffff0,%esp
+ 2e7:	ff 71 fc             	push   -0x4(%ecx)
+ 2ea:	55                   	push   %ebp
+ 2eb:	89 e5                	mov    %esp,%ebp
+ 2ed:	53                   	push   %ebx
+ 2ee:	51                   	push   %ecx
+ 2ef:	83 ec 10             	sub    $0x10,%esp
+ 2f2:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+ 2f4:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 2f7:	7f 15                	jg     30e <main+0x2e>
+    ls(".");
+ 2f9:	83 ec 0c             	sub    $0xc,%esp
+ 2fc:	68 32 0f 00 00       	push   $0xf32
+ 301:	e8 b0 fd ff ff       	call   b6 <ls>
+ 306:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 309:	e8 67 03 00 00       	call   675 <exit>
+  }
+  for(i=1; i<argc; i++)
+ 30e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 315:	eb 21                	jmp    338 <main+0x58>
+    ls(argv[i]);
+ 317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 31a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 321:	8b 43 04             	mov    0x4(%ebx),%eax
+ 324:	01 d0                	add    %edx,%eax
+ 326:	8b 00                	mov    (%eax),%eax
+ 328:	83 ec 0c             	sub    $0xc,%esp
+ 32b:	50                   	push   %eax
+ 32c:	e8 85 fd ff ff       	call   b6 <ls>
+ 331:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+ 334:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 33b:	3b 03                	cmp    (%ebx),%eax
+ 33d:	7c d8                	jl     317 <main+0x37>
+  exit();
+ 33f:	e8 31 03 00 00       	call   675 <exit>
+
+00000344 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 344:	55                   	push   %ebp
+ 345:	89 e5                	mov    %esp,%ebp
+ 347:	57                   	push   %edi
+ 348:	53                   	push   %ebx
+{
+ 349:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 34c:	8b 55 10             	mov    0x10(%ebp),%edx
+ 34f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 352:	89 cb                	mov    %ecx,%ebx
+ 354:	89 df                	mov    %ebx,%edi
+ 356:	89 d1                	mov    %edx,%ecx
+ 358:	fc                   	cld
+ 359:	f3 aa                	rep stos %al,%es:(%edi)
+ 35b:	89 ca                	mov    %ecx,%edx
+ 35d:	89 fb                	mov    %edi,%ebx
+ 35f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 362:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 365:	90                   	nop
+ 366:	5b                   	pop    %ebx
+ 367:	5f                   	pop    %edi
+ 368:	5d                   	pop    %ebp
+ 369:	c3                   	ret
+
+0000036a <strcpy>:
+{
+ 36a:	55                   	push   %ebp
+ 36b:	89 e5                	mov    %esp,%ebp
+ 36d:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 370:	8b 45 08             	mov    0x8(%ebp),%eax
+ 373:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 376:	90                   	nop
+ 377:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 37a:	8d 42 01             	lea    0x1(%edx),%eax
+ 37d:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 380:	8b 45 08             	mov    0x8(%ebp),%eax
+ 383:	8d 48 01             	lea    0x1(%eax),%ecx
+ 386:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 389:	0f b6 12             	movzbl (%edx),%edx
+ 38c:	88 10                	mov    %dl,(%eax)
+ 38e:	0f b6 00             	movzbl (%eax),%eax
+ 391:	84 c0                	test   %al,%al
+ 393:	75 e2                	jne    377 <strcpy+0xd>
+  return os;
+ 395:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 398:	c9                   	leave
+ 399:	c3                   	ret
+
+0000039a <strcmp>:
+{
+ 39a:	55                   	push   %ebp
+ 39b:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 39d:	eb 08                	jmp    3a7 <strcmp+0xd>
+    p++, q++;
+ 39f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3a3:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 3a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3aa:	0f b6 00             	movzbl (%eax),%eax
+ 3ad:	84 c0                	test   %al,%al
+ 3af:	74 10                	je     3c1 <strcmp+0x27>
+ 3b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b4:	0f b6 10             	movzbl (%eax),%edx
+ 3b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ba:	0f b6 00             	movzbl (%eax),%eax
+ 3bd:	38 c2                	cmp    %al,%dl
+ 3bf:	74 de                	je     39f <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 3c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c4:	0f b6 00             	movzbl (%eax),%eax
+ 3c7:	0f b6 d0             	movzbl %al,%edx
+ 3ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3cd:	0f b6 00             	movzbl (%eax),%eax
+ 3d0:	0f b6 c0             	movzbl %al,%eax
+ 3d3:	29 c2                	sub    %eax,%edx
+ 3d5:	89 d0                	mov    %edx,%eax
+}
+ 3d7:	5d                   	pop    %ebp
+ 3d8:	c3                   	ret
+
+000003d9 <strlen>:
+{
+ 3d9:	55                   	push   %ebp
+ 3da:	89 e5                	mov    %esp,%ebp
+ 3dc:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 3df:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3e6:	eb 04                	jmp    3ec <strlen+0x13>
+ 3e8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3ec:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f2:	01 d0                	add    %edx,%eax
+ 3f4:	0f b6 00             	movzbl (%eax),%eax
+ 3f7:	84 c0                	test   %al,%al
+ 3f9:	75 ed                	jne    3e8 <strlen+0xf>
+  return n;
+ 3fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3fe:	c9                   	leave
+ 3ff:	c3                   	ret
+
+00000400 <memset>:
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 403:	8b 45 10             	mov    0x10(%ebp),%eax
+ 406:	50                   	push   %eax
+ 407:	ff 75 0c             	push   0xc(%ebp)
+ 40a:	ff 75 08             	push   0x8(%ebp)
+ 40d:	e8 32 ff ff ff       	call   344 <stosb>
+ 412:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 415:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 418:	c9                   	leave
+ 419:	c3                   	ret
+
+0000041a <strchr>:
+{
+ 41a:	55                   	push   %ebp
+ 41b:	89 e5                	mov    %esp,%ebp
+ 41d:	83 ec 04             	sub    $0x4,%esp
+ 420:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 423:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 426:	eb 14                	jmp    43c <strchr+0x22>
+    if(*s == c)
+ 428:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42b:	0f b6 00             	movzbl (%eax),%eax
+ 42e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 431:	75 05                	jne    438 <strchr+0x1e>
+      return (char*)s;
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	eb 13                	jmp    44b <strchr+0x31>
+  for(; *s; s++)
+ 438:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 43c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43f:	0f b6 00             	movzbl (%eax),%eax
+ 442:	84 c0                	test   %al,%al
+ 444:	75 e2                	jne    428 <strchr+0xe>
+  return 0;
+ 446:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+
+0000044d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 44d:	55                   	push   %ebp
+ 44e:	89 e5                	mov    %esp,%ebp
+ 450:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 453:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 45a:	eb 42                	jmp    49e <gets+0x51>
+    cc = read(0, &c, 1);
+ 45c:	83 ec 04             	sub    $0x4,%esp
+ 45f:	6a 01                	push   $0x1
+ 461:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 464:	50                   	push   %eax
+ 465:	6a 00                	push   $0x0
+ 467:	e8 21 02 00 00       	call   68d <read>
+ 46c:	83 c4 10             	add    $0x10,%esp
+ 46f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 472:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 476:	7e 33                	jle    4ab <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 478:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 47b:	8d 50 01             	lea    0x1(%eax),%edx
+ 47e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 481:	89 c2                	mov    %eax,%edx
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	01 c2                	add    %eax,%edx
+ 488:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 48c:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 48e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 492:	3c 0a                	cmp    $0xa,%al
+ 494:	74 16                	je     4ac <gets+0x5f>
+ 496:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 49a:	3c 0d                	cmp    $0xd,%al
+ 49c:	74 0e                	je     4ac <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 49e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4a1:	83 c0 01             	add    $0x1,%eax
+ 4a4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 4a7:	7f b3                	jg     45c <gets+0xf>
+ 4a9:	eb 01                	jmp    4ac <gets+0x5f>
+      break;
+ 4ab:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 4ac:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4af:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b2:	01 d0                	add    %edx,%eax
+ 4b4:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 4b7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4ba:	c9                   	leave
+ 4bb:	c3                   	ret
+
+000004bc <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4bc:	55                   	push   %ebp
+ 4bd:	89 e5                	mov    %esp,%ebp
+ 4bf:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c2:	83 ec 08             	sub    $0x8,%esp
+ 4c5:	6a 00                	push   $0x0
+ 4c7:	ff 75 08             	push   0x8(%ebp)
+ 4ca:	e8 e6 01 00 00       	call   6b5 <open>
+ 4cf:	83 c4 10             	add    $0x10,%esp
+ 4d2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 4d5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4d9:	79 07                	jns    4e2 <stat+0x26>
+    return -1;
+ 4db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4e0:	eb 25                	jmp    507 <stat+0x4b>
+  r = fstat(fd, st);
+ 4e2:	83 ec 08             	sub    $0x8,%esp
+ 4e5:	ff 75 0c             	push   0xc(%ebp)
+ 4e8:	ff 75 f4             	push   -0xc(%ebp)
+ 4eb:	e8 dd 01 00 00       	call   6cd <fstat>
+ 4f0:	83 c4 10             	add    $0x10,%esp
+ 4f3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 4f6:	83 ec 0c             	sub    $0xc,%esp
+ 4f9:	ff 75 f4             	push   -0xc(%ebp)
+ 4fc:	e8 9c 01 00 00       	call   69d <close>
+ 501:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 504:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 507:	c9                   	leave
+ 508:	c3                   	ret
+
+00000509 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 509:	55                   	push   %ebp
+ 50a:	89 e5                	mov    %esp,%ebp
+ 50c:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 50f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 516:	eb 25                	jmp    53d <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 518:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 51b:	89 d0                	mov    %edx,%eax
+ 51d:	c1 e0 02             	shl    $0x2,%eax
+ 520:	01 d0                	add    %edx,%eax
+ 522:	01 c0                	add    %eax,%eax
+ 524:	89 c1                	mov    %eax,%ecx
+ 526:	8b 45 08             	mov    0x8(%ebp),%eax
+ 529:	8d 50 01             	lea    0x1(%eax),%edx
+ 52c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 52f:	0f b6 00             	movzbl (%eax),%eax
+ 532:	0f be c0             	movsbl %al,%eax
+ 535:	01 c8                	add    %ecx,%eax
+ 537:	83 e8 30             	sub    $0x30,%eax
+ 53a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 53d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 540:	0f b6 00             	movzbl (%eax),%eax
+ 543:	3c 2f                	cmp    $0x2f,%al
+ 545:	7e 0a                	jle    551 <atoi+0x48>
+ 547:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54a:	0f b6 00             	movzbl (%eax),%eax
+ 54d:	3c 39                	cmp    $0x39,%al
+ 54f:	7e c7                	jle    518 <atoi+0xf>
+  return n;
+ 551:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 554:	c9                   	leave
+ 555:	c3                   	ret
+
+00000556 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 556:	55                   	push   %ebp
+ 557:	89 e5                	mov    %esp,%ebp
+ 559:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 55c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 55f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 562:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 565:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 568:	eb 17                	jmp    581 <memmove+0x2b>
+    *dst++ = *src++;
+ 56a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 56d:	8d 42 01             	lea    0x1(%edx),%eax
+ 570:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 573:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 576:	8d 48 01             	lea    0x1(%eax),%ecx
+ 579:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 57c:	0f b6 12             	movzbl (%edx),%edx
+ 57f:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 581:	8b 45 10             	mov    0x10(%ebp),%eax
+ 584:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 587:	89 55 10             	mov    %edx,0x10(%ebp)
+ 58a:	85 c0                	test   %eax,%eax
+ 58c:	7f dc                	jg     56a <memmove+0x14>
+  return vdst;
+ 58e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 591:	c9                   	leave
+ 592:	c3                   	ret
+
+00000593 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 593:	55                   	push   %ebp
+ 594:	89 e5                	mov    %esp,%ebp
+ 596:	57                   	push   %edi
+ 597:	56                   	push   %esi
+ 598:	83 ec 30             	sub    $0x30,%esp
+ 59b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 5a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 5a7:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 5ae:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 5b5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5b8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 5be:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 5c1:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 5c8:	e9 89 00 00 00       	jmp    656 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 5cd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5d0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5d3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 5d7:	01 c0                	add    %eax,%eax
+ 5d9:	89 c6                	mov    %eax,%esi
+ 5db:	89 d7                	mov    %edx,%edi
+ 5dd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 5e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5e3:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5e6:	0f ad d0             	shrd   %cl,%edx,%eax
+ 5e9:	d3 ea                	shr    %cl,%edx
+ 5eb:	f6 c1 20             	test   $0x20,%cl
+ 5ee:	74 04                	je     5f4 <udiv64+0x61>
+ 5f0:	89 d0                	mov    %edx,%eax
+ 5f2:	31 d2                	xor    %edx,%edx
+ 5f4:	83 e0 01             	and    $0x1,%eax
+ 5f7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 5fa:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 601:	89 f0                	mov    %esi,%eax
+ 603:	89 fa                	mov    %edi,%edx
+ 605:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 608:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 60b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 60e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 611:	8b 45 10             	mov    0x10(%ebp),%eax
+ 614:	ba 00 00 00 00       	mov    $0x0,%edx
+ 619:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 61c:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 61f:	19 d1                	sbb    %edx,%ecx
+ 621:	72 2f                	jb     652 <udiv64+0xbf>
+      r -= d;
+ 623:	8b 45 10             	mov    0x10(%ebp),%eax
+ 626:	ba 00 00 00 00       	mov    $0x0,%edx
+ 62b:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 62e:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 631:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 634:	b8 01 00 00 00       	mov    $0x1,%eax
+ 639:	ba 00 00 00 00       	mov    $0x0,%edx
+ 63e:	0f a5 c2             	shld   %cl,%eax,%edx
+ 641:	d3 e0                	shl    %cl,%eax
+ 643:	f6 c1 20             	test   $0x20,%cl
+ 646:	74 04                	je     64c <udiv64+0xb9>
+ 648:	89 c2                	mov    %eax,%edx
+ 64a:	31 c0                	xor    %eax,%eax
+ 64c:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 64f:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 652:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 656:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 65a:	0f 89 6d ff ff ff    	jns    5cd <udiv64+0x3a>
+    }
+  }
+  return q;
+ 660:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 663:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 666:	83 c4 30             	add    $0x30,%esp
+ 669:	5e                   	pop    %esi
+ 66a:	5f                   	pop    %edi
+ 66b:	5d                   	pop    %ebp
+ 66c:	c3                   	ret
+
+0000066d <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 66d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 672:	cd 40                	int    $0x40
+ 674:	c3                   	ret
+
+00000675 <exit>:
+SYSCALL(exit)
+ 675:	b8 02 00 00 00       	mov    $0x2,%eax
+ 67a:	cd 40                	int    $0x40
+ 67c:	c3                   	ret
+
+0000067d <wait>:
+SYSCALL(wait)
+ 67d:	b8 03 00 00 00       	mov    $0x3,%eax
+ 682:	cd 40                	int    $0x40
+ 684:	c3                   	ret
+
+00000685 <pipe>:
+SYSCALL(pipe)
+ 685:	b8 04 00 00 00       	mov    $0x4,%eax
+ 68a:	cd 40                	int    $0x40
+ 68c:	c3                   	ret
+
+0000068d <read>:
+SYSCALL(read)
+ 68d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 692:	cd 40                	int    $0x40
+ 694:	c3                   	ret
+
+00000695 <write>:
+SYSCALL(write)
+ 695:	b8 10 00 00 00       	mov    $0x10,%eax
+ 69a:	cd 40                	int    $0x40
+ 69c:	c3                   	ret
+
+0000069d <close>:
+SYSCALL(close)
+ 69d:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6a2:	cd 40                	int    $0x40
+ 6a4:	c3                   	ret
+
+000006a5 <kill>:
+SYSCALL(kill)
+ 6a5:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6aa:	cd 40                	int    $0x40
+ 6ac:	c3                   	ret
+
+000006ad <exec>:
+SYSCALL(exec)
+ 6ad:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6b2:	cd 40                	int    $0x40
+ 6b4:	c3                   	ret
+
+000006b5 <open>:
+SYSCALL(open)
+ 6b5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6ba:	cd 40                	int    $0x40
+ 6bc:	c3                   	ret
+
+000006bd <mknod>:
+SYSCALL(mknod)
+ 6bd:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6c2:	cd 40                	int    $0x40
+ 6c4:	c3                   	ret
+
+000006c5 <unlink>:
+SYSCALL(unlink)
+ 6c5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6ca:	cd 40                	int    $0x40
+ 6cc:	c3                   	ret
+
+000006cd <fstat>:
+SYSCALL(fstat)
+ 6cd:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6d2:	cd 40                	int    $0x40
+ 6d4:	c3                   	ret
+
+000006d5 <link>:
+SYSCALL(link)
+ 6d5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6da:	cd 40                	int    $0x40
+ 6dc:	c3                   	ret
+
+000006dd <mkdir>:
+SYSCALL(mkdir)
+ 6dd:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6e2:	cd 40                	int    $0x40
+ 6e4:	c3                   	ret
+
+000006e5 <chdir>:
+SYSCALL(chdir)
+ 6e5:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6ea:	cd 40                	int    $0x40
+ 6ec:	c3                   	ret
+
+000006ed <dup>:
+SYSCALL(dup)
+ 6ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6f2:	cd 40                	int    $0x40
+ 6f4:	c3                   	ret
+
+000006f5 <getpid>:
+SYSCALL(getpid)
+ 6f5:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6fa:	cd 40                	int    $0x40
+ 6fc:	c3                   	ret
+
+000006fd <sbrk>:
+SYSCALL(sbrk)
+ 6fd:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 702:	cd 40                	int    $0x40
+ 704:	c3                   	ret
+
+00000705 <sleep>:
+SYSCALL(sleep)
+ 705:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 70a:	cd 40                	int    $0x40
+ 70c:	c3                   	ret
+
+0000070d <uptime>:
+SYSCALL(uptime)
+ 70d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 712:	cd 40                	int    $0x40
+ 714:	c3                   	ret
+
+00000715 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 715:	b8 16 00 00 00       	mov    $0x16,%eax
+ 71a:	cd 40                	int    $0x40
+ 71c:	c3                   	ret
+
+0000071d <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 71d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 722:	cd 40                	int    $0x40
+ 724:	c3                   	ret
+
+00000725 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 725:	b8 18 00 00 00       	mov    $0x18,%eax
+ 72a:	cd 40                	int    $0x40
+ 72c:	c3                   	ret
+
+0000072d <copy_file>:
+SYSCALL(copy_file)
+ 72d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 732:	cd 40                	int    $0x40
+ 734:	c3                   	ret
+
+00000735 <change_queue>:
+SYSCALL(change_queue)
+ 735:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 73a:	cd 40                	int    $0x40
+ 73c:	c3                   	ret
+
+0000073d <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 73d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 742:	cd 40                	int    $0x40
+ 744:	c3                   	ret
+
+00000745 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 745:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 74a:	cd 40                	int    $0x40
+ 74c:	c3                   	ret
+
+0000074d <print_process_info>:
+SYSCALL(print_process_info)
+ 74d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 752:	cd 40                	int    $0x40
+ 754:	c3                   	ret
+
+00000755 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 755:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 75a:	cd 40                	int    $0x40
+ 75c:	c3                   	ret
+
+0000075d <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 75d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 762:	cd 40                	int    $0x40
+ 764:	c3                   	ret
+
+00000765 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 765:	b8 20 00 00 00       	mov    $0x20,%eax
+ 76a:	cd 40                	int    $0x40
+ 76c:	c3                   	ret
+
+0000076d <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 76d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 772:	cd 40                	int    $0x40
+ 774:	c3                   	ret
+
+00000775 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 775:	b8 22 00 00 00       	mov    $0x22,%eax
+ 77a:	cd 40                	int    $0x40
+ 77c:	c3                   	ret
+
+0000077d <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 77d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 782:	cd 40                	int    $0x40
+ 784:	c3                   	ret
+
+00000785 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 785:	b8 24 00 00 00       	mov    $0x24,%eax
+ 78a:	cd 40                	int    $0x40
+ 78c:	c3                   	ret
+
+0000078d <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 78d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 792:	cd 40                	int    $0x40
+ 794:	c3                   	ret
+
+00000795 <set_affinity>:
+SYSCALL(set_affinity)
+ 795:	b8 26 00 00 00       	mov    $0x26,%eax
+ 79a:	cd 40                	int    $0x40
+ 79c:	c3                   	ret
+
+0000079d <setsched>:
+SYSCALL(setsched)
+ 79d:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7a2:	cd 40                	int    $0x40
+ 7a4:	c3                   	ret
+
+000007a5 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 7a5:	b8 28 00 00 00       	mov    $0x28,%eax
+ 7aa:	cd 40                	int    $0x40
+ 7ac:	c3                   	ret
+
+000007ad <set_quantum>:
+SYSCALL(set_quantum)
+ 7ad:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7b2:	cd 40                	int    $0x40
+ 7b4:	c3                   	ret
+
+000007b5 <schedtrace>:
+SYSCALL(schedtrace)
+ 7b5:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7ba:	cd 40                	int    $0x40
+ 7bc:	c3                   	ret
+
+000007bd <getrusage>:
+SYSCALL(getrusage)
+ 7bd:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7c2:	cd 40                	int    $0x40
+ 7c4:	c3                   	ret
+
+000007c5 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 7c5:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7ca:	cd 40                	int    $0x40
+ 7cc:	c3                   	ret
+
+000007cd <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 7cd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 7d2:	cd 40                	int    $0x40
+ 7d4:	c3                   	ret
+
+000007d5 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 7d5:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 7da:	cd 40                	int    $0x40
+ 7dc:	c3                   	ret
+
+000007dd <futex_wait>:
+SYSCALL(futex_wait)
+ 7dd:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 7e2:	cd 40                	int    $0x40
+ 7e4:	c3                   	ret
+
+000007e5 <futex_wake>:
+SYSCALL(futex_wake)
+ 7e5:	b8 30 00 00 00       	mov    $0x30,%eax
+ 7ea:	cd 40                	int    $0x40
+ 7ec:	c3                   	ret
+
+000007ed <syscall_latency>:
+SYSCALL(syscall_latency)
+ 7ed:	b8 31 00 00 00       	mov    $0x31,%eax
+ 7f2:	cd 40                	int    $0x40
+ 7f4:	c3                   	ret
+
+000007f5 <submit_batch>:
+SYSCALL(submit_batch)
+ 7f5:	b8 32 00 00 00       	mov    $0x32,%eax
+ 7fa:	cd 40                	int    $0x40
+ 7fc:	c3                   	ret
+
+000007fd <kmem_stats>:
+SYSCALL(kmem_stats)
+ 7fd:	b8 33 00 00 00       	mov    $0x33,%eax
+ 802:	cd 40                	int    $0x40
+ 804:	c3                   	ret
+
+00000805 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 805:	b8 34 00 00 00       	mov    $0x34,%eax
+ 80a:	cd 40                	int    $0x40
+ 80c:	c3                   	ret
+
+0000080d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 80d:	55                   	push   %ebp
+ 80e:	89 e5                	mov    %esp,%ebp
+ 810:	83 ec 18             	sub    $0x18,%esp
+ 813:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 816:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 819:	83 ec 04             	sub    $0x4,%esp
+ 81c:	6a 01                	push   $0x1
+ 81e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 821:	50                   	push   %eax
+ 822:	ff 75 08             	push   0x8(%ebp)
+ 825:	e8 6b fe ff ff       	call   695 <write>
+ 82a:	83 c4 10             	add    $0x10,%esp
+}
+ 82d:	90                   	nop
+ 82e:	c9                   	leave
+ 82f:	c3                   	ret
+
+00000830 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 836:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 83d:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 841:	74 17                	je     85a <printint+0x2a>
+ 843:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 847:	79 11                	jns    85a <printint+0x2a>
+    neg = 1;
+ 849:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 850:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 853:	f7 d8                	neg    %eax
+ 855:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 858:	eb 06                	jmp    860 <printint+0x30>
+  } else {
+    x = xx;
+ 85a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 85d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 860:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 867:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 86a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 86d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 872:	f7 f1                	div    %ecx
+ 874:	89 d1                	mov    %edx,%ecx
+ 876:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 879:	8d 50 01             	lea    0x1(%eax),%edx
+ 87c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 87f:	0f b6 91 80 13 00 00 	movzbl 0x1380(%ecx),%edx
+ 886:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 88a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 88d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 890:	ba 00 00 00 00       	mov    $0x0,%edx
+ 895:	f7 f1                	div    %ecx
+ 897:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 89a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 89e:	75 c7                	jne    867 <printint+0x37>
+  if(neg)
+ 8a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8a4:	74 2d                	je     8d3 <printint+0xa3>
+    buf[i++] = '-';
+ 8a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 8ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8af:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 8b4:	eb 1d                	jmp    8d3 <printint+0xa3>
+    putc(fd, buf[i]);
+ 8b6:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 8b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8bc:	01 d0                	add    %edx,%eax
+ 8be:	0f b6 00             	movzbl (%eax),%eax
+ 8c1:	0f be c0             	movsbl %al,%eax
+ 8c4:	83 ec 08             	sub    $0x8,%esp
+ 8c7:	50                   	push   %eax
+ 8c8:	ff 75 08             	push   0x8(%ebp)
+ 8cb:	e8 3d ff ff ff       	call   80d <putc>
+ 8d0:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 8d3:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 8d7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8db:	79 d9                	jns    8b6 <printint+0x86>
+}
+ 8dd:	90                   	nop
+ 8de:	90                   	nop
+ 8df:	c9                   	leave
+ 8e0:	c3                   	ret
+
+000008e1 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8e1:	55                   	push   %ebp
+ 8e2:	89 e5                	mov    %esp,%ebp
+ 8e4:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 8e7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 8ee:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 8f1:	83 c0 04             	add    $0x4,%eax
+ 8f4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8f7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 8fe:	e9 59 01 00 00       	jmp    a5c <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 903:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 906:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 909:	01 d0                	add    %edx,%eax
+ 90b:	0f b6 00             	movzbl (%eax),%eax
+ 90e:	0f be c0             	movsbl %al,%eax
+ 911:	25 ff 00 00 00       	and    $0xff,%eax
+ 916:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 919:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 91d:	75 2c                	jne    94b <printf+0x6a>
+      if(c == '%'){
+ 91f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 923:	75 0c                	jne    931 <printf+0x50>
+        state = '%';
+ 925:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 92c:	e9 27 01 00 00       	jmp    a58 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 931:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 934:	0f be c0             	movsbl %al,%eax
+ 937:	83 ec 08             	sub    $0x8,%esp
+ 93a:	50                   	push   %eax
+ 93b:	ff 75 08             	push   0x8(%ebp)
+ 93e:	e8 ca fe ff ff       	call   80d <putc>
+ 943:	83 c4 10             	add    $0x10,%esp
+ 946:	e9 0d 01 00 00       	jmp    a58 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 94b:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 94f:	0f 85 03 01 00 00    	jne    a58 <printf+0x177>
+      if(c == 'd'){
+ 955:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 959:	75 1e                	jne    979 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 95b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 95e:	8b 00                	mov    (%eax),%eax
+ 960:	6a 01                	push   $0x1
+ 962:	6a 0a                	push   $0xa
+ 964:	50                   	push   %eax
+ 965:	ff 75 08             	push   0x8(%ebp)
+ 968:	e8 c3 fe ff ff       	call   830 <printint>
+ 96d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 970:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 974:	e9 d8 00 00 00       	jmp    a51 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 979:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 97d:	74 06                	je     985 <printf+0xa4>
+ 97f:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 983:	75 1e                	jne    9a3 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 985:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 988:	8b 00                	mov    (%eax),%eax
+ 98a:	6a 00                	push   $0x0
+ 98c:	6a 10                	push   $0x10
+ 98e:	50                   	push   %eax
+ 98f:	ff 75 08             	push   0x8(%ebp)
+ 992:	e8 99 fe ff ff       	call   830 <printint>
+ 997:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 99a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 99e:	e9 ae 00 00 00       	jmp    a51 <printf+0x170>
+      } else if(c == 's'){
+ 9a3:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 9a7:	75 43                	jne    9ec <printf+0x10b>
+        s = (char*)*ap;
+ 9a9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9ac:	8b 00                	mov    (%eax),%eax
+ 9ae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 9b1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 9b5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9b9:	75 25                	jne    9e0 <printf+0xff>
+          s = "(null)";
+ 9bb:	c7 45 f4 34 0f 00 00 	movl   $0xf34,-0xc(%ebp)
+        while(*s != 0){
+ 9c2:	eb 1c                	jmp    9e0 <printf+0xff>
+          putc(fd, *s);
+ 9c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c7:	0f b6 00             	movzbl (%eax),%eax
+ 9ca:	0f be c0             	movsbl %al,%eax
+ 9cd:	83 ec 08             	sub    $0x8,%esp
+ 9d0:	50                   	push   %eax
+ 9d1:	ff 75 08             	push   0x8(%ebp)
+ 9d4:	e8 34 fe ff ff       	call   80d <putc>
+ 9d9:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 9dc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 9e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e3:	0f b6 00             	movzbl (%eax),%eax
+ 9e6:	84 c0                	test   %al,%al
+ 9e8:	75 da                	jne    9c4 <printf+0xe3>
+ 9ea:	eb 65                	jmp    a51 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 9ec:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 9f0:	75 1d                	jne    a0f <printf+0x12e>
+        putc(fd, *ap);
+ 9f2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9f5:	8b 00                	mov    (%eax),%eax
+ 9f7:	0f be c0             	movsbl %al,%eax
+ 9fa:	83 ec 08             	sub    $0x8,%esp
+ 9fd:	50                   	push   %eax
+ 9fe:	ff 75 08             	push   0x8(%ebp)
+ a01:	e8 07 fe ff ff       	call   80d <putc>
+ a06:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a09:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a0d:	eb 42                	jmp    a51 <printf+0x170>
+      } else if(c == '%'){
+ a0f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a13:	75 17                	jne    a2c <printf+0x14b>
+        putc(fd, c);
+ a15:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a18:	0f be c0             	movsbl %al,%eax
+ a1b:	83 ec 08             	sub    $0x8,%esp
+ a1e:	50                   	push   %eax
+ a1f:	ff 75 08             	push   0x8(%ebp)
+ a22:	e8 e6 fd ff ff       	call   80d <putc>
+ a27:	83 c4 10             	add    $0x10,%esp
+ a2a:	eb 25                	jmp    a51 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ a2c:	83 ec 08             	sub    $0x8,%esp
+ a2f:	6a 25                	push   $0x25
+ a31:	ff 75 08             	push   0x8(%ebp)
+ a34:	e8 d4 fd ff ff       	call   80d <putc>
+ a39:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ a3c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a3f:	0f be c0             	movsbl %al,%eax
+ a42:	83 ec 08             	sub    $0x8,%esp
+ a45:	50                   	push   %eax
+ a46:	ff 75 08             	push   0x8(%ebp)
+ a49:	e8 bf fd ff ff       	call   80d <putc>
+ a4e:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a51:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a58:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a5f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a62:	01 d0                	add    %edx,%eax
+ a64:	0f b6 00             	movzbl (%eax),%eax
+ a67:	84 c0                	test   %al,%al
+ a69:	0f 85 94 fe ff ff    	jne    903 <printf+0x22>
+    }
+  }
+}
+ a6f:	90                   	nop
+ a70:	90                   	nop
+ a71:	c9                   	leave
+ a72:	c3                   	ret
+
+00000a73 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a73:	55                   	push   %ebp
+ a74:	89 e5                	mov    %esp,%ebp
+ a76:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ a79:	8b 45 08             	mov    0x8(%ebp),%eax
+ a7c:	83 e8 08             	sub    $0x8,%eax
+ a7f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a82:	a1 ac 13 00 00       	mov    0x13ac,%eax
+ a87:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a8a:	eb 24                	jmp    ab0 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a8c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a8f:	8b 00                	mov    (%eax),%eax
+ a91:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a94:	72 12                	jb     aa8 <free+0x35>
+ a96:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a99:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a9c:	72 24                	jb     ac2 <free+0x4f>
+ a9e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa1:	8b 00                	mov    (%eax),%eax
+ aa3:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ aa6:	72 1a                	jb     ac2 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aa8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aab:	8b 00                	mov    (%eax),%eax
+ aad:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ ab0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ab3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ab6:	73 d4                	jae    a8c <free+0x19>
+ ab8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ abb:	8b 00                	mov    (%eax),%eax
+ abd:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ ac0:	73 ca                	jae    a8c <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ac2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ac5:	8b 40 04             	mov    0x4(%eax),%eax
+ ac8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ acf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ad2:	01 c2                	add    %eax,%edx
+ ad4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ad7:	8b 00                	mov    (%eax),%eax
+ ad9:	39 c2                	cmp    %eax,%edx
+ adb:	75 24                	jne    b01 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ add:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ae0:	8b 50 04             	mov    0x4(%eax),%edx
+ ae3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae6:	8b 00                	mov    (%eax),%eax
+ ae8:	8b 40 04             	mov    0x4(%eax),%eax
+ aeb:	01 c2                	add    %eax,%edx
+ aed:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ af0:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ af3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af6:	8b 00                	mov    (%eax),%eax
+ af8:	8b 10                	mov    (%eax),%edx
+ afa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ afd:	89 10                	mov    %edx,(%eax)
+ aff:	eb 0a                	jmp    b0b <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ b01:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b04:	8b 10                	mov    (%eax),%edx
+ b06:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b09:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ b0b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0e:	8b 40 04             	mov    0x4(%eax),%eax
+ b11:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b18:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b1b:	01 d0                	add    %edx,%eax
+ b1d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b20:	75 20                	jne    b42 <free+0xcf>
+    p->s.size += bp->s.size;
+ b22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b25:	8b 50 04             	mov    0x4(%eax),%edx
+ b28:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b2b:	8b 40 04             	mov    0x4(%eax),%eax
+ b2e:	01 c2                	add    %eax,%edx
+ b30:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b33:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ b36:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b39:	8b 10                	mov    (%eax),%edx
+ b3b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b3e:	89 10                	mov    %edx,(%eax)
+ b40:	eb 08                	jmp    b4a <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ b42:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b45:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ b48:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b4a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b4d:	a3 ac 13 00 00       	mov    %eax,0x13ac
+}
+ b52:	90                   	nop
+ b53:	c9                   	leave
+ b54:	c3                   	ret
+
+00000b55 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ b55:	55                   	push   %ebp
+ b56:	89 e5                	mov    %esp,%ebp
+ b58:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ b5b:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ b62:	77 07                	ja     b6b <morecore+0x16>
+    nu = 4096;
+ b64:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ b6b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6e:	c1 e0 03             	shl    $0x3,%eax
+ b71:	83 ec 0c             	sub    $0xc,%esp
+ b74:	50                   	push   %eax
+ b75:	e8 83 fb ff ff       	call   6fd <sbrk>
+ b7a:	83 c4 10             	add    $0x10,%esp
+ b7d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ b80:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b84:	75 07                	jne    b8d <morecore+0x38>
+    return 0;
+ b86:	b8 00 00 00 00       	mov    $0x0,%eax
+ b8b:	eb 26                	jmp    bb3 <morecore+0x5e>
+  hp = (Header*)p;
+ b8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b90:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ b93:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b96:	8b 55 08             	mov    0x8(%ebp),%edx
+ b99:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ b9c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b9f:	83 c0 08             	add    $0x8,%eax
+ ba2:	83 ec 0c             	sub    $0xc,%esp
+ ba5:	50                   	push   %eax
+ ba6:	e8 c8 fe ff ff       	call   a73 <free>
+ bab:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ bae:	a1 ac 13 00 00       	mov    0x13ac,%eax
+}
+ bb3:	c9                   	leave
+ bb4:	c3                   	ret
+
+00000bb5 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ bb5:	55                   	push   %ebp
+ bb6:	89 e5                	mov    %esp,%ebp
+ bb8:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bbb:	8b 45 08             	mov    0x8(%ebp),%eax
+ bbe:	83 c0 07             	add    $0x7,%eax
+ bc1:	c1 e8 03             	shr    $0x3,%eax
+ bc4:	83 c0 01             	add    $0x1,%eax
+ bc7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ bca:	a1 ac 13 00 00       	mov    0x13ac,%eax
+ bcf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ bd2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ bd6:	75 23                	jne    bfb <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ bd8:	c7 45 f0 a4 13 00 00 	movl   $0x13a4,-0x10(%ebp)
+ bdf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ be2:	a3 ac 13 00 00       	mov    %eax,0x13ac
+ be7:	a1 ac 13 00 00       	mov    0x13ac,%eax
+ bec:	a3 a4 13 00 00       	mov    %eax,0x13a4
+    base.s.size = 0;
+ bf1:	c7 05 a8 13 00 00 00 	movl   $0x0,0x13a8
+ bf8:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bfb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bfe:	8b 00                	mov    (%eax),%eax
+ c00:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c06:	8b 40 04             	mov    0x4(%eax),%eax
+ c09:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ c0c:	72 4d                	jb     c5b <malloc+0xa6>
+      if(p->s.size == nunits)
+ c0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c11:	8b 40 04             	mov    0x4(%eax),%eax
+ c14:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ c17:	75 0c                	jne    c25 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ c19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c1c:	8b 10                	mov    (%eax),%edx
+ c1e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c21:	89 10                	mov    %edx,(%eax)
+ c23:	eb 26                	jmp    c4b <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ c25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c28:	8b 40 04             	mov    0x4(%eax),%eax
+ c2b:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ c2e:	89 c2                	mov    %eax,%edx
+ c30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c33:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ c36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c39:	8b 40 04             	mov    0x4(%eax),%eax
+ c3c:	c1 e0 03             	shl    $0x3,%eax
+ c3f:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ c42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c45:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ c48:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ c4b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c4e:	a3 ac 13 00 00       	mov    %eax,0x13ac
+      return (void*)(p + 1);
+ c53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c56:	83 c0 08             	add    $0x8,%eax
+ c59:	eb 3b                	jmp    c96 <malloc+0xe1>
+    }
+    if(p == freep)
+ c5b:	a1 ac 13 00 00       	mov    0x13ac,%eax
+ c60:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c63:	75 1e                	jne    c83 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ c65:	83 ec 0c             	sub    $0xc,%esp
+ c68:	ff 75 ec             	push   -0x14(%ebp)
+ c6b:	e8 e5 fe ff ff       	call   b55 <morecore>
+ c70:	83 c4 10             	add    $0x10,%esp
+ c73:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c76:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c7a:	75 07                	jne    c83 <malloc+0xce>
+        return 0;
+ c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+ c81:	eb 13                	jmp    c96 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c86:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c8c:	8b 00                	mov    (%eax),%eax
+ c8e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c91:	e9 6d ff ff ff       	jmp    c03 <malloc+0x4e>
+  }
+}
+ c96:	c9                   	leave
+ c97:	c3                   	ret
+
+00000c98 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ c98:	55                   	push   %ebp
+ c99:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ c9b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c9e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ ca4:	90                   	nop
+ ca5:	5d                   	pop    %ebp
+ ca6:	c3                   	ret
+
+00000ca7 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ ca7:	55                   	push   %ebp
+ ca8:	89 e5                	mov    %esp,%ebp
+ caa:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ cad:	8b 55 08             	mov    0x8(%ebp),%edx
+ cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+ cb5:	b9 01 00 00 00       	mov    $0x1,%ecx
+ cba:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ cbe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ cc1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cc5:	74 3b                	je     d02 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ cc7:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ ccb:	74 2d                	je     cfa <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ ccd:	8b 55 08             	mov    0x8(%ebp),%edx
+ cd0:	b8 02 00 00 00       	mov    $0x2,%eax
+ cd5:	87 02                	xchg   %eax,(%edx)
+ cd7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ cda:	eb 1e                	jmp    cfa <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ cdc:	8b 45 08             	mov    0x8(%ebp),%eax
+ cdf:	83 ec 08             	sub    $0x8,%esp
+ ce2:	6a 02                	push   $0x2
+ ce4:	50                   	push   %eax
+ ce5:	e8 f3 fa ff ff       	call   7dd <futex_wait>
+ cea:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ ced:	8b 55 08             	mov    0x8(%ebp),%edx
+ cf0:	b8 02 00 00 00       	mov    $0x2,%eax
+ cf5:	87 02                	xchg   %eax,(%edx)
+ cf7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ cfa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cfe:	75 dc                	jne    cdc <mutex_lock+0x35>
+ d00:	eb 01                	jmp    d03 <mutex_lock+0x5c>
+    return;
+ d02:	90                   	nop
+  }
+}
+ d03:	c9                   	leave
+ d04:	c3                   	ret
+
+00000d05 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ d05:	55                   	push   %ebp
+ d06:	89 e5                	mov    %esp,%ebp
+ d08:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ d0b:	8b 45 08             	mov    0x8(%ebp),%eax
+ d0e:	ba 01 00 00 00       	mov    $0x1,%edx
+ d13:	f7 da                	neg    %edx
+ d15:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ d19:	83 fa 01             	cmp    $0x1,%edx
+ d1c:	74 1a                	je     d38 <mutex_unlock+0x33>
+    m->state = 0;
+ d1e:	8b 45 08             	mov    0x8(%ebp),%eax
+ d21:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ d27:	8b 45 08             	mov    0x8(%ebp),%eax
+ d2a:	83 ec 08             	sub    $0x8,%esp
+ d2d:	6a 01                	push   $0x1
+ d2f:	50                   	push   %eax
+ d30:	e8 b0 fa ff ff       	call   7e5 <futex_wake>
+ d35:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ d38:	90                   	nop
+ d39:	c9                   	leave
+ d3a:	c3                   	ret
+
+00000d3b <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ d3b:	55                   	push   %ebp
+ d3c:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ d3e:	8b 45 08             	mov    0x8(%ebp),%eax
+ d41:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ d47:	8b 45 08             	mov    0x8(%ebp),%eax
+ d4a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ d51:	90                   	nop
+ d52:	5d                   	pop    %ebp
+ d53:	c3                   	ret
+
+00000d54 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ d54:	55                   	push   %ebp
+ d55:	89 e5                	mov    %esp,%ebp
+ d57:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ d5a:	8b 45 08             	mov    0x8(%ebp),%eax
+ d5d:	83 c0 04             	add    $0x4,%eax
+ d60:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ d64:	8b 45 08             	mov    0x8(%ebp),%eax
+ d67:	83 ec 08             	sub    $0x8,%esp
+ d6a:	ff 75 0c             	push   0xc(%ebp)
+ d6d:	50                   	push   %eax
+ d6e:	e8 6a fa ff ff       	call   7dd <futex_wait>
+ d73:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ d76:	8b 45 08             	mov    0x8(%ebp),%eax
+ d79:	83 c0 04             	add    $0x4,%eax
+ d7c:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ d80:	90                   	nop
+ d81:	c9                   	leave
+ d82:	c3                   	ret
+
+00000d83 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ d83:	55                   	push   %ebp
+ d84:	89 e5                	mov    %esp,%ebp
+ d86:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ d89:	8b 45 08             	mov    0x8(%ebp),%eax
+ d8c:	8b 00                	mov    (%eax),%eax
+ d8e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ d91:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d95:	78 17                	js     dae <rwlock_rdlock+0x2b>
+ d97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d9a:	83 c0 01             	add    $0x1,%eax
+ d9d:	89 c1                	mov    %eax,%ecx
+ d9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ da2:	8b 55 08             	mov    0x8(%ebp),%edx
+ da5:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ da9:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ dac:	74 19                	je     dc7 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ dae:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ db2:	79 d5                	jns    d89 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ db4:	83 ec 08             	sub    $0x8,%esp
+ db7:	ff 75 f4             	push   -0xc(%ebp)
+ dba:	ff 75 08             	push   0x8(%ebp)
+ dbd:	e8 92 ff ff ff       	call   d54 <rwlock_sleep>
+ dc2:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ dc5:	eb c2                	jmp    d89 <rwlock_rdlock+0x6>
+      return;
+ dc7:	90                   	nop
+  }
+}
+ dc8:	c9                   	leave
+ dc9:	c3                   	ret
+
+00000dca <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ dca:	55                   	push   %ebp
+ dcb:	89 e5                	mov    %esp,%ebp
+ dcd:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ dd0:	eb 11                	jmp    de3 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ dd2:	83 ec 08             	sub    $0x8,%esp
+ dd5:	ff 75 f4             	push   -0xc(%ebp)
+ dd8:	ff 75 08             	push   0x8(%ebp)
+ ddb:	e8 74 ff ff ff       	call   d54 <rwlock_sleep>
+ de0:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ de3:	8b 55 08             	mov    0x8(%ebp),%edx
+ de6:	b8 00 00 00 00       	mov    $0x0,%eax
+ deb:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ df0:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ df4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ df7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ dfb:	75 d5                	jne    dd2 <rwlock_wrlock+0x8>
+}
+ dfd:	90                   	nop
+ dfe:	90                   	nop
+ dff:	c9                   	leave
+ e00:	c3                   	ret
+
+00000e01 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ e01:	55                   	push   %ebp
+ e02:	89 e5                	mov    %esp,%ebp
+ e04:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ e07:	8b 45 08             	mov    0x8(%ebp),%eax
+ e0a:	8b 00                	mov    (%eax),%eax
+ e0c:	85 c0                	test   %eax,%eax
+ e0e:	79 0c                	jns    e1c <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ e10:	8b 45 08             	mov    0x8(%ebp),%eax
+ e13:	ba 00 00 00 00       	mov    $0x0,%edx
+ e18:	87 10                	xchg   %edx,(%eax)
+ e1a:	eb 18                	jmp    e34 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ e1c:	8b 55 08             	mov    0x8(%ebp),%edx
+ e1f:	b8 01 00 00 00       	mov    $0x1,%eax
+ e24:	f7 d8                	neg    %eax
+ e26:	89 c1                	mov    %eax,%ecx
+ e28:	89 c8                	mov    %ecx,%eax
+ e2a:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ e2e:	01 c8                	add    %ecx,%eax
+ e30:	85 c0                	test   %eax,%eax
+ e32:	75 20                	jne    e54 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ e34:	8b 45 08             	mov    0x8(%ebp),%eax
+ e37:	8b 40 04             	mov    0x4(%eax),%eax
+ e3a:	85 c0                	test   %eax,%eax
+ e3c:	74 17                	je     e55 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ e3e:	8b 45 08             	mov    0x8(%ebp),%eax
+ e41:	83 ec 08             	sub    $0x8,%esp
+ e44:	68 ff ff ff 7f       	push   $0x7fffffff
+ e49:	50                   	push   %eax
+ e4a:	e8 96 f9 ff ff       	call   7e5 <futex_wake>
+ e4f:	83 c4 10             	add    $0x10,%esp
+ e52:	eb 01                	jmp    e55 <rwlock_unlock+0x54>
+    return;
+ e54:	90                   	nop
+}
+ e55:	c9                   	leave
+ e56:	c3                   	ret
+
+00000e57 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ e57:	55                   	push   %ebp
+ e58:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ e5a:	8b 45 08             	mov    0x8(%ebp),%eax
+ e5d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ e63:	90                   	nop
+ e64:	5d                   	pop    %ebp
+ e65:	c3                   	ret
+
+00000e66 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ e66:	55                   	push   %ebp
+ e67:	89 e5                	mov    %esp,%ebp
+ e69:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ e6c:	8b 45 08             	mov    0x8(%ebp),%eax
+ e6f:	8b 00                	mov    (%eax),%eax
+ e71:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ e74:	83 ec 0c             	sub    $0xc,%esp
+ e77:	ff 75 0c             	push   0xc(%ebp)
+ e7a:	e8 86 fe ff ff       	call   d05 <mutex_unlock>
+ e7f:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ e82:	8b 45 08             	mov    0x8(%ebp),%eax
+ e85:	83 ec 08             	sub    $0x8,%esp
+ e88:	ff 75 f4             	push   -0xc(%ebp)
+ e8b:	50                   	push   %eax
+ e8c:	e8 4c f9 ff ff       	call   7dd <futex_wait>
+ e91:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ e94:	83 ec 0c             	sub    $0xc,%esp
+ e97:	ff 75 0c             	push   0xc(%ebp)
+ e9a:	e8 08 fe ff ff       	call   ca7 <mutex_lock>
+ e9f:	83 c4 10             	add    $0x10,%esp
+}
+ ea2:	90                   	nop
+ ea3:	c9                   	leave
+ ea4:	c3                   	ret
+
+00000ea5 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ ea5:	55                   	push   %ebp
+ ea6:	89 e5                	mov    %esp,%ebp
+ ea8:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ eab:	8b 45 08             	mov    0x8(%ebp),%eax
+ eae:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ eb2:	8b 45 08             	mov    0x8(%ebp),%eax
+ eb5:	83 ec 08             	sub    $0x8,%esp
+ eb8:	6a 01                	push   $0x1
+ eba:	50                   	push   %eax
+ ebb:	e8 25 f9 ff ff       	call   7e5 <futex_wake>
+ ec0:	83 c4 10             	add    $0x10,%esp
+}
+ ec3:	90                   	nop
+ ec4:	c9                   	leave
+ ec5:	c3                   	ret
+
+00000ec6 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ ec6:	55                   	push   %ebp
+ ec7:	89 e5                	mov    %esp,%ebp
+ ec9:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ ecc:	8b 45 08             	mov    0x8(%ebp),%eax
+ ecf:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ ed3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ed6:	83 ec 08             	sub    $0x8,%esp
+ ed9:	68 ff ff ff 7f       	push   $0x7fffffff
+ ede:	50                   	push   %eax
+ edf:	e8 01 f9 ff ff       	call   7e5 <futex_wake>
+ ee4:	83 c4 10             	add    $0x10,%esp
+}
+ ee7:	90                   	nop
+ ee8:	c9                   	leave
+ ee9:	c3                   	ret
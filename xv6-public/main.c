@@ -26,11 +26,15 @@ int main(void)
   consoleinit();                     // console hardware
   uartinit();                        // serial port
   pinit();                           // process table
+  initschedtrace();                  // scheduler event rings
   tvinit();                          // trap vectors
   binit();                           // buffer cache
   fileinit();                        // file table
+  pipeinit();                        // pipe cache
   ideinit();                         // disk
   shm_init();
+  plinit();                          // priority lock table
+  futexinit();                       // futex wait buckets
   startothers();                              // start other processors
   kinit2(P2V(4 * 1024 * 1024), P2V(PHYSTOP)); // must come after startothers()
   userinit();                                 // first user process
@@ -102,6 +102,11 @@ struct segdesc
 #define PTE_W 0x002  // Writeable
 #define PTE_U 0x004  // User
 #define PTE_PS 0x080 // Page Size
+#define PTE_COW 0x200 // Copy-on-write, one of the bits left to software
+
+// Page fault error code bits
+#define FEC_PR 0x1 // Protection violation, not a missing page
+#define FEC_WR 0x2 // Caused by a write
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte) ((uint)(pte) & ~0xFFF)
@@ -15,8 +15,6 @@ struct cpu cpus[NCPU];
 int ncpu;
 uchar ioapicid;
 
-uint syscall_count_total;
-
 static uchar
 sum(uchar *addr, int len)
 {
@@ -2,7 +2,6 @@
 #define KSTACKSIZE 4096           // size of per-process kernel stack
 #define NCPU 4                    // maximum number of CPUs
 #define NOFILE 16                 // open files per process
-#define NFILE 100                 // open files per system
 #define NINODE 50                 // maximum number of active i-nodes
 #define NDEV 10                   // maximum major device number
 #define ROOTDEV 1                 // device number of file system root disk
@@ -10,4 +9,7 @@
 #define MAXOPBLOCKS 10            // max # of blocks any FS op writes
 #define LOGSIZE (MAXOPBLOCKS * 3) // max data blocks in on-disk log
 #define NBUF (MAXOPBLOCKS * 3)    // size of disk block cache
-#define FSSIZE 1000               // size of file system in blocks
+#define FSSIZE 2000               // size of file system in blocks
+#define NPRIOLOCK 16              // maximum number of priority locks
+#define KJUNK 1                   // junk-fill freed pages unless kmem_junk(0)
+#define CACHELINE 64              // bytes per cache line, to pad per-CPU data
@@ -0,0 +1,8 @@
+// How a priority lock's acquisitions went, from prioritylock_stats().
+
+struct plstat
+{
+  uint free;  // The lock was free on arrival
+  uint spun;  // Got it by spinning while the holder ran
+  uint slept; // Slept until the lock was handed over
+};
@@ -12,60 +12,150 @@ void initprioritylock(struct prioritylock *lk, char *name)
   lk->name = name;
   lk->locked = 0;
   lk->pid = 0;
-  lk->queue = 0;
+  lk->owner = 0;
+  lk->nwaiters = 0;
+  memset(&lk->stat, 0, sizeof(lk->stat));
   initlock(&lk->slk, "spin lock");
 }
 
+// A waiter's priority: higher pids are served first.
+static int waiter_priority(struct proc *p)
+{
+  return p->pid;
+}
+
 static void print_prioritylock_queue(struct prioritylock *lk)
 {
-  struct node *q = lk->queue;
-  if (q != 0)
+  if (lk->nwaiters > 0)
   {
     cprintf("the queue is : ");
-
-    while (q != 0)
-    {
-      cprintf("%d ", q->priority);
-      q = q->next;
-    }
+    for (int i = 0; i < lk->nwaiters; i++)
+      cprintf("%d ", waiter_priority(lk->waiters[i]));
     cprintf("\n");
   }
 }
 
-void acquirepriority(struct prioritylock *lk)
+// Add p to the waiter heap. Caller holds lk->slk.
+static void push_waiter(struct prioritylock *lk, struct proc *p)
+{
+  int i = lk->nwaiters++;
+
+  while (i > 0 && waiter_priority(lk->waiters[(i - 1) / 2]) < waiter_priority(p))
+  {
+    lk->waiters[i] = lk->waiters[(i - 1) / 2];
+    i = (i - 1) / 2;
+  }
+  lk->waiters[i] = p;
+}
+
+// Remove and return the waiter at heap slot i.
+// Caller holds lk->slk and i < lk->nwaiters.
+static struct proc *remove_waiter(struct prioritylock *lk, int i)
+{
+  struct proc *removed = lk->waiters[i];
+  struct proc *last = lk->waiters[--lk->nwaiters];
+  int child;
+
+  if (i == lk->nwaiters)
+    return removed;
+  while (i > 0 && waiter_priority(lk->waiters[(i - 1) / 2]) < waiter_priority(last))
+  {
+    lk->waiters[i] = lk->waiters[(i - 1) / 2];
+    i = (i - 1) / 2;
+  }
+  while ((child = 2 * i + 1) < lk->nwaiters)
+  {
+    if (child + 1 < lk->nwaiters &&
+        waiter_priority(lk->waiters[child + 1]) > waiter_priority(lk->waiters[child]))
+      child++;
+    if (waiter_priority(lk->waiters[child]) <= waiter_priority(last))
+      break;
+    lk->waiters[i] = lk->waiters[child];
+    i = child;
+  }
+  lk->waiters[i] = last;
+  return removed;
+}
+
+// Remove and return the highest priority waiter.
+// Caller holds lk->slk and there is at least one waiter.
+static struct proc *pop_waiter(struct prioritylock *lk)
 {
+  return remove_waiter(lk, 0);
+}
+
+// Give up waiting for lk, as p was killed: leave the heap and
+// take back the priority p lent the holder, which keeps what
+// the remaining waiters lend it. Caller holds lk->slk.
+static void cancel_wait(struct prioritylock *lk, struct proc *p)
+{
+  int i;
+
+  for (i = 0; lk->waiters[i] != p; i++)
+    ;
+  remove_waiter(lk, i);
+  restore_priority(lk->owner);
+  for (i = 0; i < lk->nwaiters; i++)
+    inherit_priority(lk->owner, lk->waiters[i]);
+}
+
+// Spin for up to PL_SPIN_CYCLES while the holder is running on
+// another CPU, as it is likely to release soon. Stop once anyone
+// sleeps on the lock: releasepriority() hands it to them, not us.
+// Returns with lk->slk held.
+static int spin_on_owner(struct prioritylock *lk)
+{
+  uint64 start = rdtsc();
+
+  while (lk->locked && lk->nwaiters == 0 &&
+         lk->owner->state == RUNNING &&
+         rdtsc() - start < PL_SPIN_CYCLES)
+  {
+    release(&lk->slk);
+    pause();
+    acquire(&lk->slk);
+  }
+  return !lk->locked;
+}
+
+// Returns 0 once the caller holds lk, or -1 if it was killed
+// while waiting for it.
+int acquirepriority(struct prioritylock *lk)
+{
+  struct proc *cur_proc = myproc();
+
   acquire(&lk->slk);
-  if (lk->locked)
+  if (!lk->locked)
+    lk->stat.free++;
+  else if (spin_on_owner(lk))
+    lk->stat.spun++;
+  else
   {
-    struct proc *cur_proc = myproc();
-    struct node *p = (struct node *)kalloc();
-    p->next = 0;
-    p->priority = cur_proc->pid;
-    p->process = cur_proc;
-
-    struct node *q = lk->queue;
-    if (q == 0 || p->priority > q->priority)
+    // releasepriority() hands the lock straight to us. Until
+    // then the holder runs with our scheduling position. Other
+    // wakeups on our channel, from a child's exit() or from
+    // kill(), must not be taken for the handover.
+    lk->stat.slept++;
+    inherit_priority(lk->owner, cur_proc);
+    push_waiter(lk, cur_proc);
+    while (lk->owner != cur_proc)
     {
-      lk->queue = p;
-      p->next = q;
-    }
-    else
-    {
-      while (q->next != 0 && p->priority <= q->next->priority)
+      if (cur_proc->killed)
       {
-        q = q->next;
+        cancel_wait(lk, cur_proc);
+        release(&lk->slk);
+        return -1;
       }
-      p->next = q->next;
-      q->next = p;
+      sleep(cur_proc, &lk->slk);
     }
-    sleep(cur_proc, &lk->slk);
-  }
-  else
-  {
-    lk->locked = 1;
-    lk->pid = myproc()->pid;
+    release(&lk->slk);
+    return 0;
   }
+  lk->locked = 1;
+  lk->pid = cur_proc->pid;
+  lk->owner = cur_proc;
   release(&lk->slk);
+  return 0;
 }
 
 void releasepriority(struct prioritylock *lk)
@@ -78,21 +168,23 @@ void releasepriority(struct prioritylock *lk)
 
   acquire(&lk->slk);
 
-  if (lk->queue != 0)
+  if (lk->nwaiters > 0)
   {
-    struct node *p = lk->queue;
+    struct proc *p = pop_waiter(lk);
     // print_prioritylock_queue(lk);
-    lk->queue = p->next;
-    p->process->state = RUNNABLE;
-    lk->pid = p->process->pid;
-    wakeup(p->process);
-    kfree((char *)p);
+    lk->pid = p->pid;
+    lk->owner = p;
+    if (lk->nwaiters > 0)
+      inherit_priority(p, lk->waiters[0]);
+    wakeproc(p, p);
   }
   else
   {
     lk->locked = 0;
     lk->pid = 0;
+    lk->owner = 0;
   }
 
   release(&lk->slk);
+  restore_priority(myproc());
 }
@@ -1,17 +1,16 @@
 #include "spinlock.h"
+#include "plstat.h"
 
-struct node
-{
-  uint priority;
-  struct node *next;
-  struct proc *process;
-};
+#define PL_SPIN_CYCLES 20000 // TSC cycles to spin on a running holder
 
 struct prioritylock
 {
-  uint locked;         // Is the lock held?
-  struct spinlock slk; // spinlock protecting this priority lock
-  char *name;          // Name of lock.
-  int pid;             // Process holding lock
-  struct node *queue;  // queue
+  uint locked;                // Is the lock held?
+  struct spinlock slk;        // spinlock protecting this priority lock
+  char *name;                 // Name of lock.
+  int pid;                    // Process holding lock
+  struct proc *owner;         // Process holding lock
+  struct proc *waiters[NPROC]; // Max-heap of sleeping waiters by priority
+  int nwaiters;
+  struct plstat stat;
 };
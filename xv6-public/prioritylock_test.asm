@@ -0,0 +1,1861 @@
+
+_prioritylock_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <process_function>:
+// Even and odd children contend on two separate locks,
+// so the two groups make progress in parallel.
+int locks[2];
+
+void process_function(int i)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int lk = locks[i % 2];
+   6:	8b 55 08             	mov    0x8(%ebp),%edx
+   9:	89 d0                	mov    %edx,%eax
+   b:	c1 f8 1f             	sar    $0x1f,%eax
+   e:	c1 e8 1f             	shr    $0x1f,%eax
+  11:	01 c2                	add    %eax,%edx
+  13:	83 e2 01             	and    $0x1,%edx
+  16:	29 c2                	sub    %eax,%edx
+  18:	89 d0                	mov    %edx,%eax
+  1a:	8b 04 85 ac 11 00 00 	mov    0x11ac(,%eax,4),%eax
+  21:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  acquire_prioritylock(lk);
+  24:	83 ec 0c             	sub    $0xc,%esp
+  27:	ff 75 f4             	push   -0xc(%ebp)
+  2a:	e8 66 05 00 00       	call   595 <acquire_prioritylock>
+  2f:	83 c4 10             	add    $0x10,%esp
+  printf(1, "Process %d acquired lock %d.\n", getpid(), lk);
+  32:	e8 ee 04 00 00       	call   525 <getpid>
+  37:	ff 75 f4             	push   -0xc(%ebp)
+  3a:	50                   	push   %eax
+  3b:	68 1a 0d 00 00       	push   $0xd1a
+  40:	6a 01                	push   $0x1
+  42:	e8 ca 06 00 00       	call   711 <printf>
+  47:	83 c4 10             	add    $0x10,%esp
+  sleep(500);
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	68 f4 01 00 00       	push   $0x1f4
+  52:	e8 de 04 00 00       	call   535 <sleep>
+  57:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "Process %d released lock %d.\n", getpid(), lk);
+  5a:	e8 c6 04 00 00       	call   525 <getpid>
+  5f:	ff 75 f4             	push   -0xc(%ebp)
+  62:	50                   	push   %eax
+  63:	68 38 0d 00 00       	push   $0xd38
+  68:	6a 01                	push   $0x1
+  6a:	e8 a2 06 00 00       	call   711 <printf>
+  6f:	83 c4 10             	add    $0x10,%esp
+  release_prioritylock(lk);
+  72:	83 ec 0c             	sub    $0xc,%esp
+  75:	ff 75 f4             	push   -0xc(%ebp)
+  78:	e8 20 05 00 00       	call   59d <release_prioritylock>
+  7d:	83 c4 10             	add    $0x10,%esp
+  exit();
+  80:	e8 20 04 00 00       	call   4a5 <exit>
+
+00000085 <main>:
+}
+
+int main()
+{
+  85:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  89:	83 e4 f0             	and    $0xfffffff0,%esp
+  8c:	ff 71 fc             	push   -0x4(%ecx)
+  8f:	55                   	push   %ebp
+  90:	89 e5                	mov    %esp,%ebp
+  92:	51                   	push   %ecx
+  93:	83 ec 14             	sub    $0x14,%esp
+  locks[0] = create_prioritylock("even");
+  96:	83 ec 0c             	sub    $0xc,%esp
+  99:	68 56 0d 00 00       	push   $0xd56
+  9e:	e8 52 05 00 00       	call   5f5 <create_prioritylock>
+  a3:	83 c4 10             	add    $0x10,%esp
+  a6:	a3 ac 11 00 00       	mov    %eax,0x11ac
+  locks[1] = create_prioritylock("odd");
+  ab:	83 ec 0c             	sub    $0xc,%esp
+  ae:	68 5b 0d 00 00       	push   $0xd5b
+  b3:	e8 3d 05 00 00       	call   5f5 <create_prioritylock>
+  b8:	83 c4 10             	add    $0x10,%esp
+  bb:	a3 b0 11 00 00       	mov    %eax,0x11b0
+  if (locks[0] < 0 || locks[1] < 0)
+  c0:	a1 ac 11 00 00       	mov    0x11ac,%eax
+  c5:	85 c0                	test   %eax,%eax
+  c7:	78 09                	js     d2 <main+0x4d>
+  c9:	a1 b0 11 00 00       	mov    0x11b0,%eax
+  ce:	85 c0                	test   %eax,%eax
+  d0:	79 17                	jns    e9 <main+0x64>
+  {
+    printf(1, "Creating the locks failed.\n");
+  d2:	83 ec 08             	sub    $0x8,%esp
+  d5:	68 5f 0d 00 00       	push   $0xd5f
+  da:	6a 01                	push   $0x1
+  dc:	e8 30 06 00 00       	call   711 <printf>
+  e1:	83 c4 10             	add    $0x10,%esp
+    exit();
+  e4:	e8 bc 03 00 00       	call   4a5 <exit>
+  }
+  for (int i = 0; i < NCHILD; i++)
+  e9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  f0:	eb 3d                	jmp    12f <main+0xaa>
+  {
+    int pid = fork();
+  f2:	e8 a6 03 00 00       	call   49d <fork>
+  f7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if (pid < 0)
+  fa:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  fe:	79 17                	jns    117 <main+0x92>
+    {
+      printf(1, "Fork failed.\n");
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	68 7b 0d 00 00       	push   $0xd7b
+ 108:	6a 01                	push   $0x1
+ 10a:	e8 02 06 00 00       	call   711 <printf>
+ 10f:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 112:	e8 8e 03 00 00       	call   4a5 <exit>
+    }
+    else if (pid == 0)
+ 117:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 11b:	75 0e                	jne    12b <main+0xa6>
+    {
+      process_function(i);
+ 11d:	83 ec 0c             	sub    $0xc,%esp
+ 120:	ff 75 f4             	push   -0xc(%ebp)
+ 123:	e8 d8 fe ff ff       	call   0 <process_function>
+ 128:	83 c4 10             	add    $0x10,%esp
+  for (int i = 0; i < NCHILD; i++)
+ 12b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 12f:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+ 133:	7e bd                	jle    f2 <main+0x6d>
+    }
+  }
+  for (int i = 0; i < 10; i++)
+ 135:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 13c:	eb 09                	jmp    147 <main+0xc2>
+  {
+    wait();
+ 13e:	e8 6a 03 00 00       	call   4ad <wait>
+  for (int i = 0; i < 10; i++)
+ 143:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 147:	83 7d f0 09          	cmpl   $0x9,-0x10(%ebp)
+ 14b:	7e f1                	jle    13e <main+0xb9>
+  }
+  destroy_prioritylock(locks[0]);
+ 14d:	a1 ac 11 00 00       	mov    0x11ac,%eax
+ 152:	83 ec 0c             	sub    $0xc,%esp
+ 155:	50                   	push   %eax
+ 156:	e8 a2 04 00 00       	call   5fd <destroy_prioritylock>
+ 15b:	83 c4 10             	add    $0x10,%esp
+  destroy_prioritylock(locks[1]);
+ 15e:	a1 b0 11 00 00       	mov    0x11b0,%eax
+ 163:	83 ec 0c             	sub    $0xc,%esp
+ 166:	50                   	push   %eax
+ 167:	e8 91 04 00 00       	call   5fd <destroy_prioritylock>
+ 16c:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 16f:	e8 31 03 00 00       	call   4a5 <exit>
+
+00000174 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 174:	55                   	push   %ebp
+ 175:	89 e5                	mov    %esp,%ebp
+ 177:	57                   	push   %edi
+ 178:	53                   	push   %ebx
+{
+ 179:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 17c:	8b 55 10             	mov    0x10(%ebp),%edx
+ 17f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 182:	89 cb                	mov    %ecx,%ebx
+ 184:	89 df                	mov    %ebx,%edi
+ 186:	89 d1                	mov    %edx,%ecx
+ 188:	fc                   	cld
+ 189:	f3 aa                	rep stos %al,%es:(%edi)
+ 18b:	89 ca                	mov    %ecx,%edx
+ 18d:	89 fb                	mov    %edi,%ebx
+ 18f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 192:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 195:	90                   	nop
+ 196:	5b                   	pop    %ebx
+ 197:	5f                   	pop    %edi
+ 198:	5d                   	pop    %ebp
+ 199:	c3                   	ret
+
+0000019a <strcpy>:
+{
+ 19a:	55                   	push   %ebp
+ 19b:	89 e5                	mov    %esp,%ebp
+ 19d:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1a6:	90                   	nop
+ 1a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1aa:	8d 42 01             	lea    0x1(%edx),%eax
+ 1ad:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1b6:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1b9:	0f b6 12             	movzbl (%edx),%edx
+ 1bc:	88 10                	mov    %dl,(%eax)
+ 1be:	0f b6 00             	movzbl (%eax),%eax
+ 1c1:	84 c0                	test   %al,%al
+ 1c3:	75 e2                	jne    1a7 <strcpy+0xd>
+  return os;
+ 1c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1c8:	c9                   	leave
+ 1c9:	c3                   	ret
+
+000001ca <strcmp>:
+{
+ 1ca:	55                   	push   %ebp
+ 1cb:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1cd:	eb 08                	jmp    1d7 <strcmp+0xd>
+    p++, q++;
+ 1cf:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1d3:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1da:	0f b6 00             	movzbl (%eax),%eax
+ 1dd:	84 c0                	test   %al,%al
+ 1df:	74 10                	je     1f1 <strcmp+0x27>
+ 1e1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e4:	0f b6 10             	movzbl (%eax),%edx
+ 1e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ea:	0f b6 00             	movzbl (%eax),%eax
+ 1ed:	38 c2                	cmp    %al,%dl
+ 1ef:	74 de                	je     1cf <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f4:	0f b6 00             	movzbl (%eax),%eax
+ 1f7:	0f b6 d0             	movzbl %al,%edx
+ 1fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fd:	0f b6 00             	movzbl (%eax),%eax
+ 200:	0f b6 c0             	movzbl %al,%eax
+ 203:	29 c2                	sub    %eax,%edx
+ 205:	89 d0                	mov    %edx,%eax
+}
+ 207:	5d                   	pop    %ebp
+ 208:	c3                   	ret
+
+00000209 <strlen>:
+{
+ 209:	55                   	push   %ebp
+ 20a:	89 e5                	mov    %esp,%ebp
+ 20c:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 20f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 216:	eb 04                	jmp    21c <strlen+0x13>
+ 218:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 21c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 21f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 222:	01 d0                	add    %edx,%eax
+ 224:	0f b6 00             	movzbl (%eax),%eax
+ 227:	84 c0                	test   %al,%al
+ 229:	75 ed                	jne    218 <strlen+0xf>
+  return n;
+ 22b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 22e:	c9                   	leave
+ 22f:	c3                   	ret
+
+00000230 <memset>:
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 233:	8b 45 10             	mov    0x10(%ebp),%eax
+ 236:	50                   	push   %eax
+ 237:	ff 75 0c             	push   0xc(%ebp)
+ 23a:	ff 75 08             	push   0x8(%ebp)
+ 23d:	e8 32 ff ff ff       	call   174 <stosb>
+ 242:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 245:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 248:	c9                   	leave
+ 249:	c3                   	ret
+
+0000024a <strchr>:
+{
+ 24a:	55                   	push   %ebp
+ 24b:	89 e5                	mov    %esp,%ebp
+ 24d:	83 ec 04             	sub    $0x4,%esp
+ 250:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 253:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 256:	eb 14                	jmp    26c <strchr+0x22>
+    if(*s == c)
+ 258:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25b:	0f b6 00             	movzbl (%eax),%eax
+ 25e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 261:	75 05                	jne    268 <strchr+0x1e>
+      return (char*)s;
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	eb 13                	jmp    27b <strchr+0x31>
+  for(; *s; s++)
+ 268:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 26c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26f:	0f b6 00             	movzbl (%eax),%eax
+ 272:	84 c0                	test   %al,%al
+ 274:	75 e2                	jne    258 <strchr+0xe>
+  return 0;
+ 276:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 27b:	c9                   	leave
+ 27c:	c3                   	ret
+
+0000027d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 27d:	55                   	push   %ebp
+ 27e:	89 e5                	mov    %esp,%ebp
+ 280:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 283:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 28a:	eb 42                	jmp    2ce <gets+0x51>
+    cc = read(0, &c, 1);
+ 28c:	83 ec 04             	sub    $0x4,%esp
+ 28f:	6a 01                	push   $0x1
+ 291:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 294:	50                   	push   %eax
+ 295:	6a 00                	push   $0x0
+ 297:	e8 21 02 00 00       	call   4bd <read>
+ 29c:	83 c4 10             	add    $0x10,%esp
+ 29f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2a2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2a6:	7e 33                	jle    2db <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 2a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2ab:	8d 50 01             	lea    0x1(%eax),%edx
+ 2ae:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2b1:	89 c2                	mov    %eax,%edx
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	01 c2                	add    %eax,%edx
+ 2b8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2bc:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2be:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2c2:	3c 0a                	cmp    $0xa,%al
+ 2c4:	74 16                	je     2dc <gets+0x5f>
+ 2c6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2ca:	3c 0d                	cmp    $0xd,%al
+ 2cc:	74 0e                	je     2dc <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2d1:	83 c0 01             	add    $0x1,%eax
+ 2d4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2d7:	7f b3                	jg     28c <gets+0xf>
+ 2d9:	eb 01                	jmp    2dc <gets+0x5f>
+      break;
+ 2db:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 2dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e2:	01 d0                	add    %edx,%eax
+ 2e4:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2e7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2ea:	c9                   	leave
+ 2eb:	c3                   	ret
+
+000002ec <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2ec:	55                   	push   %ebp
+ 2ed:	89 e5                	mov    %esp,%ebp
+ 2ef:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2f2:	83 ec 08             	sub    $0x8,%esp
+ 2f5:	6a 00                	push   $0x0
+ 2f7:	ff 75 08             	push   0x8(%ebp)
+ 2fa:	e8 e6 01 00 00       	call   4e5 <open>
+ 2ff:	83 c4 10             	add    $0x10,%esp
+ 302:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 305:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 309:	79 07                	jns    312 <stat+0x26>
+    return -1;
+ 30b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 310:	eb 25                	jmp    337 <stat+0x4b>
+  r = fstat(fd, st);
+ 312:	83 ec 08             	sub    $0x8,%esp
+ 315:	ff 75 0c             	push   0xc(%ebp)
+ 318:	ff 75 f4             	push   -0xc(%ebp)
+ 31b:	e8 dd 01 00 00       	call   4fd <fstat>
+ 320:	83 c4 10             	add    $0x10,%esp
+ 323:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 326:	83 ec 0c             	sub    $0xc,%esp
+ 329:	ff 75 f4             	push   -0xc(%ebp)
+ 32c:	e8 9c 01 00 00       	call   4cd <close>
+ 331:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 334:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 337:	c9                   	leave
+ 338:	c3                   	ret
+
+00000339 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 339:	55                   	push   %ebp
+ 33a:	89 e5                	mov    %esp,%ebp
+ 33c:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 33f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 346:	eb 25                	jmp    36d <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 348:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 34b:	89 d0                	mov    %edx,%eax
+ 34d:	c1 e0 02             	shl    $0x2,%eax
+ 350:	01 d0                	add    %edx,%eax
+ 352:	01 c0                	add    %eax,%eax
+ 354:	89 c1                	mov    %eax,%ecx
+ 356:	8b 45 08             	mov    0x8(%ebp),%eax
+ 359:	8d 50 01             	lea    0x1(%eax),%edx
+ 35c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 35f:	0f b6 00             	movzbl (%eax),%eax
+ 362:	0f be c0             	movsbl %al,%eax
+ 365:	01 c8                	add    %ecx,%eax
+ 367:	83 e8 30             	sub    $0x30,%eax
+ 36a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 36d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 370:	0f b6 00             	movzbl (%eax),%eax
+ 373:	3c 2f                	cmp    $0x2f,%al
+ 375:	7e 0a                	jle    381 <atoi+0x48>
+ 377:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37a:	0f b6 00             	movzbl (%eax),%eax
+ 37d:	3c 39                	cmp    $0x39,%al
+ 37f:	7e c7                	jle    348 <atoi+0xf>
+  return n;
+ 381:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 384:	c9                   	leave
+ 385:	c3                   	ret
+
+00000386 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 386:	55                   	push   %ebp
+ 387:	89 e5                	mov    %esp,%ebp
+ 389:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 38c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 392:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 395:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 398:	eb 17                	jmp    3b1 <memmove+0x2b>
+    *dst++ = *src++;
+ 39a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 39d:	8d 42 01             	lea    0x1(%edx),%eax
+ 3a0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3a6:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3a9:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3ac:	0f b6 12             	movzbl (%edx),%edx
+ 3af:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3b1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3b4:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3b7:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3ba:	85 c0                	test   %eax,%eax
+ 3bc:	7f dc                	jg     39a <memmove+0x14>
+  return vdst;
+ 3be:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3c1:	c9                   	leave
+ 3c2:	c3                   	ret
+
+000003c3 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 3c3:	55                   	push   %ebp
+ 3c4:	89 e5                	mov    %esp,%ebp
+ 3c6:	57                   	push   %edi
+ 3c7:	56                   	push   %esi
+ 3c8:	83 ec 30             	sub    $0x30,%esp
+ 3cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ce:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3d4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 3d7:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 3de:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 3e5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3e8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3eb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 3ee:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3f1:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 3f8:	e9 89 00 00 00       	jmp    486 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 3fd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 400:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 403:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 407:	01 c0                	add    %eax,%eax
+ 409:	89 c6                	mov    %eax,%esi
+ 40b:	89 d7                	mov    %edx,%edi
+ 40d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 410:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 413:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 416:	0f ad d0             	shrd   %cl,%edx,%eax
+ 419:	d3 ea                	shr    %cl,%edx
+ 41b:	f6 c1 20             	test   $0x20,%cl
+ 41e:	74 04                	je     424 <udiv64+0x61>
+ 420:	89 d0                	mov    %edx,%eax
+ 422:	31 d2                	xor    %edx,%edx
+ 424:	83 e0 01             	and    $0x1,%eax
+ 427:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 42a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 431:	89 f0                	mov    %esi,%eax
+ 433:	89 fa                	mov    %edi,%edx
+ 435:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 438:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 43b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 43e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 441:	8b 45 10             	mov    0x10(%ebp),%eax
+ 444:	ba 00 00 00 00       	mov    $0x0,%edx
+ 449:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 44c:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 44f:	19 d1                	sbb    %edx,%ecx
+ 451:	72 2f                	jb     482 <udiv64+0xbf>
+      r -= d;
+ 453:	8b 45 10             	mov    0x10(%ebp),%eax
+ 456:	ba 00 00 00 00       	mov    $0x0,%edx
+ 45b:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 45e:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 461:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 464:	b8 01 00 00 00       	mov    $0x1,%eax
+ 469:	ba 00 00 00 00       	mov    $0x0,%edx
+ 46e:	0f a5 c2             	shld   %cl,%eax,%edx
+ 471:	d3 e0                	shl    %cl,%eax
+ 473:	f6 c1 20             	test   $0x20,%cl
+ 476:	74 04                	je     47c <udiv64+0xb9>
+ 478:	89 c2                	mov    %eax,%edx
+ 47a:	31 c0                	xor    %eax,%eax
+ 47c:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 47f:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 482:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 486:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 48a:	0f 89 6d ff ff ff    	jns    3fd <udiv64+0x3a>
+    }
+  }
+  return q;
+ 490:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 493:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 496:	83 c4 30             	add    $0x30,%esp
+ 499:	5e                   	pop    %esi
+ 49a:	5f                   	pop    %edi
+ 49b:	5d                   	pop    %ebp
+ 49c:	c3                   	ret
+
+0000049d <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 49d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4a2:	cd 40                	int    $0x40
+ 4a4:	c3                   	ret
+
+000004a5 <exit>:
+SYSCALL(exit)
+ 4a5:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4aa:	cd 40                	int    $0x40
+ 4ac:	c3                   	ret
+
+000004ad <wait>:
+SYSCALL(wait)
+ 4ad:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4b2:	cd 40                	int    $0x40
+ 4b4:	c3                   	ret
+
+000004b5 <pipe>:
+SYSCALL(pipe)
+ 4b5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4ba:	cd 40                	int    $0x40
+ 4bc:	c3                   	ret
+
+000004bd <read>:
+SYSCALL(read)
+ 4bd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4c2:	cd 40                	int    $0x40
+ 4c4:	c3                   	ret
+
+000004c5 <write>:
+SYSCALL(write)
+ 4c5:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4ca:	cd 40                	int    $0x40
+ 4cc:	c3                   	ret
+
+000004cd <close>:
+SYSCALL(close)
+ 4cd:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4d2:	cd 40                	int    $0x40
+ 4d4:	c3                   	ret
+
+000004d5 <kill>:
+SYSCALL(kill)
+ 4d5:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4da:	cd 40                	int    $0x40
+ 4dc:	c3                   	ret
+
+000004dd <exec>:
+SYSCALL(exec)
+ 4dd:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4e2:	cd 40                	int    $0x40
+ 4e4:	c3                   	ret
+
+000004e5 <open>:
+SYSCALL(open)
+ 4e5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4ea:	cd 40                	int    $0x40
+ 4ec:	c3                   	ret
+
+000004ed <mknod>:
+SYSCALL(mknod)
+ 4ed:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4f2:	cd 40                	int    $0x40
+ 4f4:	c3                   	ret
+
+000004f5 <unlink>:
+SYSCALL(unlink)
+ 4f5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4fa:	cd 40                	int    $0x40
+ 4fc:	c3                   	ret
+
+000004fd <fstat>:
+SYSCALL(fstat)
+ 4fd:	b8 08 00 00 00       	mov    $0x8,%eax
+ 502:	cd 40                	int    $0x40
+ 504:	c3                   	ret
+
+00000505 <link>:
+SYSCALL(link)
+ 505:	b8 13 00 00 00       	mov    $0x13,%eax
+ 50a:	cd 40                	int    $0x40
+ 50c:	c3                   	ret
+
+0000050d <mkdir>:
+SYSCALL(mkdir)
+ 50d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 512:	cd 40                	int    $0x40
+ 514:	c3                   	ret
+
+00000515 <chdir>:
+SYSCALL(chdir)
+ 515:	b8 09 00 00 00       	mov    $0x9,%eax
+ 51a:	cd 40                	int    $0x40
+ 51c:	c3                   	ret
+
+0000051d <dup>:
+SYSCALL(dup)
+ 51d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 522:	cd 40                	int    $0x40
+ 524:	c3                   	ret
+
+00000525 <getpid>:
+SYSCALL(getpid)
+ 525:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 52a:	cd 40                	int    $0x40
+ 52c:	c3                   	ret
+
+0000052d <sbrk>:
+SYSCALL(sbrk)
+ 52d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 532:	cd 40                	int    $0x40
+ 534:	c3                   	ret
+
+00000535 <sleep>:
+SYSCALL(sleep)
+ 535:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 53a:	cd 40                	int    $0x40
+ 53c:	c3                   	ret
+
+0000053d <uptime>:
+SYSCALL(uptime)
+ 53d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 542:	cd 40                	int    $0x40
+ 544:	c3                   	ret
+
+00000545 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 545:	b8 16 00 00 00       	mov    $0x16,%eax
+ 54a:	cd 40                	int    $0x40
+ 54c:	c3                   	ret
+
+0000054d <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 54d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 552:	cd 40                	int    $0x40
+ 554:	c3                   	ret
+
+00000555 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 555:	b8 18 00 00 00       	mov    $0x18,%eax
+ 55a:	cd 40                	int    $0x40
+ 55c:	c3                   	ret
+
+0000055d <copy_file>:
+SYSCALL(copy_file)
+ 55d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 562:	cd 40                	int    $0x40
+ 564:	c3                   	ret
+
+00000565 <change_queue>:
+SYSCALL(change_queue)
+ 565:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 56a:	cd 40                	int    $0x40
+ 56c:	c3                   	ret
+
+0000056d <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 56d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 572:	cd 40                	int    $0x40
+ 574:	c3                   	ret
+
+00000575 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 575:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 57a:	cd 40                	int    $0x40
+ 57c:	c3                   	ret
+
+0000057d <print_process_info>:
+SYSCALL(print_process_info)
+ 57d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 582:	cd 40                	int    $0x40
+ 584:	c3                   	ret
+
+00000585 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 585:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 58a:	cd 40                	int    $0x40
+ 58c:	c3                   	ret
+
+0000058d <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 58d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 592:	cd 40                	int    $0x40
+ 594:	c3                   	ret
+
+00000595 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 595:	b8 20 00 00 00       	mov    $0x20,%eax
+ 59a:	cd 40                	int    $0x40
+ 59c:	c3                   	ret
+
+0000059d <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 59d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5a2:	cd 40                	int    $0x40
+ 5a4:	c3                   	ret
+
+000005a5 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 5a5:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5aa:	cd 40                	int    $0x40
+ 5ac:	c3                   	ret
+
+000005ad <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 5ad:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5b2:	cd 40                	int    $0x40
+ 5b4:	c3                   	ret
+
+000005b5 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 5b5:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5ba:	cd 40                	int    $0x40
+ 5bc:	c3                   	ret
+
+000005bd <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 5bd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5c2:	cd 40                	int    $0x40
+ 5c4:	c3                   	ret
+
+000005c5 <set_affinity>:
+SYSCALL(set_affinity)
+ 5c5:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5ca:	cd 40                	int    $0x40
+ 5cc:	c3                   	ret
+
+000005cd <setsched>:
+SYSCALL(setsched)
+ 5cd:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5d2:	cd 40                	int    $0x40
+ 5d4:	c3                   	ret
+
+000005d5 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 5d5:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5da:	cd 40                	int    $0x40
+ 5dc:	c3                   	ret
+
+000005dd <set_quantum>:
+SYSCALL(set_quantum)
+ 5dd:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5e2:	cd 40                	int    $0x40
+ 5e4:	c3                   	ret
+
+000005e5 <schedtrace>:
+SYSCALL(schedtrace)
+ 5e5:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5ea:	cd 40                	int    $0x40
+ 5ec:	c3                   	ret
+
+000005ed <getrusage>:
+SYSCALL(getrusage)
+ 5ed:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5f2:	cd 40                	int    $0x40
+ 5f4:	c3                   	ret
+
+000005f5 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 5f5:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5fa:	cd 40                	int    $0x40
+ 5fc:	c3                   	ret
+
+000005fd <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 5fd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 602:	cd 40                	int    $0x40
+ 604:	c3                   	ret
+
+00000605 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 605:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 60a:	cd 40                	int    $0x40
+ 60c:	c3                   	ret
+
+0000060d <futex_wait>:
+SYSCALL(futex_wait)
+ 60d:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 612:	cd 40                	int    $0x40
+ 614:	c3                   	ret
+
+00000615 <futex_wake>:
+SYSCALL(futex_wake)
+ 615:	b8 30 00 00 00       	mov    $0x30,%eax
+ 61a:	cd 40                	int    $0x40
+ 61c:	c3                   	ret
+
+0000061d <syscall_latency>:
+SYSCALL(syscall_latency)
+ 61d:	b8 31 00 00 00       	mov    $0x31,%eax
+ 622:	cd 40                	int    $0x40
+ 624:	c3                   	ret
+
+00000625 <submit_batch>:
+SYSCALL(submit_batch)
+ 625:	b8 32 00 00 00       	mov    $0x32,%eax
+ 62a:	cd 40                	int    $0x40
+ 62c:	c3                   	ret
+
+0000062d <kmem_stats>:
+SYSCALL(kmem_stats)
+ 62d:	b8 33 00 00 00       	mov    $0x33,%eax
+ 632:	cd 40                	int    $0x40
+ 634:	c3                   	ret
+
+00000635 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 635:	b8 34 00 00 00       	mov    $0x34,%eax
+ 63a:	cd 40                	int    $0x40
+ 63c:	c3                   	ret
+
+0000063d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 63d:	55                   	push   %ebp
+ 63e:	89 e5                	mov    %esp,%ebp
+ 640:	83 ec 18             	sub    $0x18,%esp
+ 643:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 646:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 649:	83 ec 04             	sub    $0x4,%esp
+ 64c:	6a 01                	push   $0x1
+ 64e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 651:	50                   	push   %eax
+ 652:	ff 75 08             	push   0x8(%ebp)
+ 655:	e8 6b fe ff ff       	call   4c5 <write>
+ 65a:	83 c4 10             	add    $0x10,%esp
+}
+ 65d:	90                   	nop
+ 65e:	c9                   	leave
+ 65f:	c3                   	ret
+
+00000660 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 666:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 66d:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 671:	74 17                	je     68a <printint+0x2a>
+ 673:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 677:	79 11                	jns    68a <printint+0x2a>
+    neg = 1;
+ 679:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 680:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 683:	f7 d8                	neg    %eax
+ 685:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 688:	eb 06                	jmp    690 <printint+0x30>
+  } else {
+    x = xx;
+ 68a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 68d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 690:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 697:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 69a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 69d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6a2:	f7 f1                	div    %ecx
+ 6a4:	89 d1                	mov    %edx,%ecx
+ 6a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 6ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6af:	0f b6 91 98 11 00 00 	movzbl 0x1198(%ecx),%edx
+ 6b6:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 6ba:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6bd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6c0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6c5:	f7 f1                	div    %ecx
+ 6c7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6ce:	75 c7                	jne    697 <printint+0x37>
+  if(neg)
+ 6d0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6d4:	74 2d                	je     703 <printint+0xa3>
+    buf[i++] = '-';
+ 6d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6d9:	8d 50 01             	lea    0x1(%eax),%edx
+ 6dc:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6df:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 6e4:	eb 1d                	jmp    703 <printint+0xa3>
+    putc(fd, buf[i]);
+ 6e6:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6ec:	01 d0                	add    %edx,%eax
+ 6ee:	0f b6 00             	movzbl (%eax),%eax
+ 6f1:	0f be c0             	movsbl %al,%eax
+ 6f4:	83 ec 08             	sub    $0x8,%esp
+ 6f7:	50                   	push   %eax
+ 6f8:	ff 75 08             	push   0x8(%ebp)
+ 6fb:	e8 3d ff ff ff       	call   63d <putc>
+ 700:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 703:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 707:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 70b:	79 d9                	jns    6e6 <printint+0x86>
+}
+ 70d:	90                   	nop
+ 70e:	90                   	nop
+ 70f:	c9                   	leave
+ 710:	c3                   	ret
+
+00000711 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 711:	55                   	push   %ebp
+ 712:	89 e5                	mov    %esp,%ebp
+ 714:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 717:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 71e:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 721:	83 c0 04             	add    $0x4,%eax
+ 724:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 727:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 72e:	e9 59 01 00 00       	jmp    88c <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 733:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 736:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 739:	01 d0                	add    %edx,%eax
+ 73b:	0f b6 00             	movzbl (%eax),%eax
+ 73e:	0f be c0             	movsbl %al,%eax
+ 741:	25 ff 00 00 00       	and    $0xff,%eax
+ 746:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 749:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 74d:	75 2c                	jne    77b <printf+0x6a>
+      if(c == '%'){
+ 74f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 753:	75 0c                	jne    761 <printf+0x50>
+        state = '%';
+ 755:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 75c:	e9 27 01 00 00       	jmp    888 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 761:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 764:	0f be c0             	movsbl %al,%eax
+ 767:	83 ec 08             	sub    $0x8,%esp
+ 76a:	50                   	push   %eax
+ 76b:	ff 75 08             	push   0x8(%ebp)
+ 76e:	e8 ca fe ff ff       	call   63d <putc>
+ 773:	83 c4 10             	add    $0x10,%esp
+ 776:	e9 0d 01 00 00       	jmp    888 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 77b:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 77f:	0f 85 03 01 00 00    	jne    888 <printf+0x177>
+      if(c == 'd'){
+ 785:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 789:	75 1e                	jne    7a9 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 78b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 78e:	8b 00                	mov    (%eax),%eax
+ 790:	6a 01                	push   $0x1
+ 792:	6a 0a                	push   $0xa
+ 794:	50                   	push   %eax
+ 795:	ff 75 08             	push   0x8(%ebp)
+ 798:	e8 c3 fe ff ff       	call   660 <printint>
+ 79d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7a0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7a4:	e9 d8 00 00 00       	jmp    881 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 7a9:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 7ad:	74 06                	je     7b5 <printf+0xa4>
+ 7af:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7b3:	75 1e                	jne    7d3 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 7b5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7b8:	8b 00                	mov    (%eax),%eax
+ 7ba:	6a 00                	push   $0x0
+ 7bc:	6a 10                	push   $0x10
+ 7be:	50                   	push   %eax
+ 7bf:	ff 75 08             	push   0x8(%ebp)
+ 7c2:	e8 99 fe ff ff       	call   660 <printint>
+ 7c7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7ca:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7ce:	e9 ae 00 00 00       	jmp    881 <printf+0x170>
+      } else if(c == 's'){
+ 7d3:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7d7:	75 43                	jne    81c <printf+0x10b>
+        s = (char*)*ap;
+ 7d9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7dc:	8b 00                	mov    (%eax),%eax
+ 7de:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 7e1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 7e5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7e9:	75 25                	jne    810 <printf+0xff>
+          s = "(null)";
+ 7eb:	c7 45 f4 89 0d 00 00 	movl   $0xd89,-0xc(%ebp)
+        while(*s != 0){
+ 7f2:	eb 1c                	jmp    810 <printf+0xff>
+          putc(fd, *s);
+ 7f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7f7:	0f b6 00             	movzbl (%eax),%eax
+ 7fa:	0f be c0             	movsbl %al,%eax
+ 7fd:	83 ec 08             	sub    $0x8,%esp
+ 800:	50                   	push   %eax
+ 801:	ff 75 08             	push   0x8(%ebp)
+ 804:	e8 34 fe ff ff       	call   63d <putc>
+ 809:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 80c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 810:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 813:	0f b6 00             	movzbl (%eax),%eax
+ 816:	84 c0                	test   %al,%al
+ 818:	75 da                	jne    7f4 <printf+0xe3>
+ 81a:	eb 65                	jmp    881 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 81c:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 820:	75 1d                	jne    83f <printf+0x12e>
+        putc(fd, *ap);
+ 822:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 825:	8b 00                	mov    (%eax),%eax
+ 827:	0f be c0             	movsbl %al,%eax
+ 82a:	83 ec 08             	sub    $0x8,%esp
+ 82d:	50                   	push   %eax
+ 82e:	ff 75 08             	push   0x8(%ebp)
+ 831:	e8 07 fe ff ff       	call   63d <putc>
+ 836:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 839:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 83d:	eb 42                	jmp    881 <printf+0x170>
+      } else if(c == '%'){
+ 83f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 843:	75 17                	jne    85c <printf+0x14b>
+        putc(fd, c);
+ 845:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 848:	0f be c0             	movsbl %al,%eax
+ 84b:	83 ec 08             	sub    $0x8,%esp
+ 84e:	50                   	push   %eax
+ 84f:	ff 75 08             	push   0x8(%ebp)
+ 852:	e8 e6 fd ff ff       	call   63d <putc>
+ 857:	83 c4 10             	add    $0x10,%esp
+ 85a:	eb 25                	jmp    881 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 85c:	83 ec 08             	sub    $0x8,%esp
+ 85f:	6a 25                	push   $0x25
+ 861:	ff 75 08             	push   0x8(%ebp)
+ 864:	e8 d4 fd ff ff       	call   63d <putc>
+ 869:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 86c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 86f:	0f be c0             	movsbl %al,%eax
+ 872:	83 ec 08             	sub    $0x8,%esp
+ 875:	50                   	push   %eax
+ 876:	ff 75 08             	push   0x8(%ebp)
+ 879:	e8 bf fd ff ff       	call   63d <putc>
+ 87e:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 881:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 888:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 88c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 88f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 892:	01 d0                	add    %edx,%eax
+ 894:	0f b6 00             	movzbl (%eax),%eax
+ 897:	84 c0                	test   %al,%al
+ 899:	0f 85 94 fe ff ff    	jne    733 <printf+0x22>
+    }
+  }
+}
+ 89f:	90                   	nop
+ 8a0:	90                   	nop
+ 8a1:	c9                   	leave
+ 8a2:	c3                   	ret
+
+000008a3 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8a3:	55                   	push   %ebp
+ 8a4:	89 e5                	mov    %esp,%ebp
+ 8a6:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 8a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ac:	83 e8 08             	sub    $0x8,%eax
+ 8af:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8b2:	a1 bc 11 00 00       	mov    0x11bc,%eax
+ 8b7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8ba:	eb 24                	jmp    8e0 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8bf:	8b 00                	mov    (%eax),%eax
+ 8c1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8c4:	72 12                	jb     8d8 <free+0x35>
+ 8c6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8cc:	72 24                	jb     8f2 <free+0x4f>
+ 8ce:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d1:	8b 00                	mov    (%eax),%eax
+ 8d3:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8d6:	72 1a                	jb     8f2 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8db:	8b 00                	mov    (%eax),%eax
+ 8dd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8e0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8e6:	73 d4                	jae    8bc <free+0x19>
+ 8e8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8eb:	8b 00                	mov    (%eax),%eax
+ 8ed:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8f0:	73 ca                	jae    8bc <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8f2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8f5:	8b 40 04             	mov    0x4(%eax),%eax
+ 8f8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8ff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 902:	01 c2                	add    %eax,%edx
+ 904:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 907:	8b 00                	mov    (%eax),%eax
+ 909:	39 c2                	cmp    %eax,%edx
+ 90b:	75 24                	jne    931 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 90d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 910:	8b 50 04             	mov    0x4(%eax),%edx
+ 913:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 916:	8b 00                	mov    (%eax),%eax
+ 918:	8b 40 04             	mov    0x4(%eax),%eax
+ 91b:	01 c2                	add    %eax,%edx
+ 91d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 920:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 923:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 926:	8b 00                	mov    (%eax),%eax
+ 928:	8b 10                	mov    (%eax),%edx
+ 92a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 92d:	89 10                	mov    %edx,(%eax)
+ 92f:	eb 0a                	jmp    93b <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 931:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 934:	8b 10                	mov    (%eax),%edx
+ 936:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 939:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 93b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 93e:	8b 40 04             	mov    0x4(%eax),%eax
+ 941:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 948:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 94b:	01 d0                	add    %edx,%eax
+ 94d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 950:	75 20                	jne    972 <free+0xcf>
+    p->s.size += bp->s.size;
+ 952:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 955:	8b 50 04             	mov    0x4(%eax),%edx
+ 958:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 95b:	8b 40 04             	mov    0x4(%eax),%eax
+ 95e:	01 c2                	add    %eax,%edx
+ 960:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 963:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 966:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 969:	8b 10                	mov    (%eax),%edx
+ 96b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 96e:	89 10                	mov    %edx,(%eax)
+ 970:	eb 08                	jmp    97a <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 972:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 975:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 978:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 97a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 97d:	a3 bc 11 00 00       	mov    %eax,0x11bc
+}
+ 982:	90                   	nop
+ 983:	c9                   	leave
+ 984:	c3                   	ret
+
+00000985 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 985:	55                   	push   %ebp
+ 986:	89 e5                	mov    %esp,%ebp
+ 988:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 98b:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 992:	77 07                	ja     99b <morecore+0x16>
+    nu = 4096;
+ 994:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 99b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 99e:	c1 e0 03             	shl    $0x3,%eax
+ 9a1:	83 ec 0c             	sub    $0xc,%esp
+ 9a4:	50                   	push   %eax
+ 9a5:	e8 83 fb ff ff       	call   52d <sbrk>
+ 9aa:	83 c4 10             	add    $0x10,%esp
+ 9ad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 9b0:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 9b4:	75 07                	jne    9bd <morecore+0x38>
+    return 0;
+ 9b6:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9bb:	eb 26                	jmp    9e3 <morecore+0x5e>
+  hp = (Header*)p;
+ 9bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 9c3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9c6:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9c9:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9cc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9cf:	83 c0 08             	add    $0x8,%eax
+ 9d2:	83 ec 0c             	sub    $0xc,%esp
+ 9d5:	50                   	push   %eax
+ 9d6:	e8 c8 fe ff ff       	call   8a3 <free>
+ 9db:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 9de:	a1 bc 11 00 00       	mov    0x11bc,%eax
+}
+ 9e3:	c9                   	leave
+ 9e4:	c3                   	ret
+
+000009e5 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9e5:	55                   	push   %ebp
+ 9e6:	89 e5                	mov    %esp,%ebp
+ 9e8:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9eb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ee:	83 c0 07             	add    $0x7,%eax
+ 9f1:	c1 e8 03             	shr    $0x3,%eax
+ 9f4:	83 c0 01             	add    $0x1,%eax
+ 9f7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 9fa:	a1 bc 11 00 00       	mov    0x11bc,%eax
+ 9ff:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a02:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a06:	75 23                	jne    a2b <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ a08:	c7 45 f0 b4 11 00 00 	movl   $0x11b4,-0x10(%ebp)
+ a0f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a12:	a3 bc 11 00 00       	mov    %eax,0x11bc
+ a17:	a1 bc 11 00 00       	mov    0x11bc,%eax
+ a1c:	a3 b4 11 00 00       	mov    %eax,0x11b4
+    base.s.size = 0;
+ a21:	c7 05 b8 11 00 00 00 	movl   $0x0,0x11b8
+ a28:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a2b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a2e:	8b 00                	mov    (%eax),%eax
+ a30:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a36:	8b 40 04             	mov    0x4(%eax),%eax
+ a39:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a3c:	72 4d                	jb     a8b <malloc+0xa6>
+      if(p->s.size == nunits)
+ a3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a41:	8b 40 04             	mov    0x4(%eax),%eax
+ a44:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a47:	75 0c                	jne    a55 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a4c:	8b 10                	mov    (%eax),%edx
+ a4e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a51:	89 10                	mov    %edx,(%eax)
+ a53:	eb 26                	jmp    a7b <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a58:	8b 40 04             	mov    0x4(%eax),%eax
+ a5b:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a5e:	89 c2                	mov    %eax,%edx
+ a60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a63:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a69:	8b 40 04             	mov    0x4(%eax),%eax
+ a6c:	c1 e0 03             	shl    $0x3,%eax
+ a6f:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a75:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a78:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a7b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a7e:	a3 bc 11 00 00       	mov    %eax,0x11bc
+      return (void*)(p + 1);
+ a83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a86:	83 c0 08             	add    $0x8,%eax
+ a89:	eb 3b                	jmp    ac6 <malloc+0xe1>
+    }
+    if(p == freep)
+ a8b:	a1 bc 11 00 00       	mov    0x11bc,%eax
+ a90:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a93:	75 1e                	jne    ab3 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a95:	83 ec 0c             	sub    $0xc,%esp
+ a98:	ff 75 ec             	push   -0x14(%ebp)
+ a9b:	e8 e5 fe ff ff       	call   985 <morecore>
+ aa0:	83 c4 10             	add    $0x10,%esp
+ aa3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ aa6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ aaa:	75 07                	jne    ab3 <malloc+0xce>
+        return 0;
+ aac:	b8 00 00 00 00       	mov    $0x0,%eax
+ ab1:	eb 13                	jmp    ac6 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ab3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ab9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ abc:	8b 00                	mov    (%eax),%eax
+ abe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ac1:	e9 6d ff ff ff       	jmp    a33 <malloc+0x4e>
+  }
+}
+ ac6:	c9                   	leave
+ ac7:	c3                   	ret
+
+00000ac8 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ ac8:	55                   	push   %ebp
+ ac9:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ acb:	8b 45 08             	mov    0x8(%ebp),%eax
+ ace:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ ad4:	90                   	nop
+ ad5:	5d                   	pop    %ebp
+ ad6:	c3                   	ret
+
+00000ad7 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ ad7:	55                   	push   %ebp
+ ad8:	89 e5                	mov    %esp,%ebp
+ ada:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ add:	8b 55 08             	mov    0x8(%ebp),%edx
+ ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+ ae5:	b9 01 00 00 00       	mov    $0x1,%ecx
+ aea:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ aee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ af1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ af5:	74 3b                	je     b32 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ af7:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ afb:	74 2d                	je     b2a <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ afd:	8b 55 08             	mov    0x8(%ebp),%edx
+ b00:	b8 02 00 00 00       	mov    $0x2,%eax
+ b05:	87 02                	xchg   %eax,(%edx)
+ b07:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b0a:	eb 1e                	jmp    b2a <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ b0c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b0f:	83 ec 08             	sub    $0x8,%esp
+ b12:	6a 02                	push   $0x2
+ b14:	50                   	push   %eax
+ b15:	e8 f3 fa ff ff       	call   60d <futex_wait>
+ b1a:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ b1d:	8b 55 08             	mov    0x8(%ebp),%edx
+ b20:	b8 02 00 00 00       	mov    $0x2,%eax
+ b25:	87 02                	xchg   %eax,(%edx)
+ b27:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b2a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b2e:	75 dc                	jne    b0c <mutex_lock+0x35>
+ b30:	eb 01                	jmp    b33 <mutex_lock+0x5c>
+    return;
+ b32:	90                   	nop
+  }
+}
+ b33:	c9                   	leave
+ b34:	c3                   	ret
+
+00000b35 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ b35:	55                   	push   %ebp
+ b36:	89 e5                	mov    %esp,%ebp
+ b38:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ b3b:	8b 45 08             	mov    0x8(%ebp),%eax
+ b3e:	ba 01 00 00 00       	mov    $0x1,%edx
+ b43:	f7 da                	neg    %edx
+ b45:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ b49:	83 fa 01             	cmp    $0x1,%edx
+ b4c:	74 1a                	je     b68 <mutex_unlock+0x33>
+    m->state = 0;
+ b4e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b51:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ b57:	8b 45 08             	mov    0x8(%ebp),%eax
+ b5a:	83 ec 08             	sub    $0x8,%esp
+ b5d:	6a 01                	push   $0x1
+ b5f:	50                   	push   %eax
+ b60:	e8 b0 fa ff ff       	call   615 <futex_wake>
+ b65:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ b68:	90                   	nop
+ b69:	c9                   	leave
+ b6a:	c3                   	ret
+
+00000b6b <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ b6b:	55                   	push   %ebp
+ b6c:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b71:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ b77:	8b 45 08             	mov    0x8(%ebp),%eax
+ b7a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ b81:	90                   	nop
+ b82:	5d                   	pop    %ebp
+ b83:	c3                   	ret
+
+00000b84 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ b84:	55                   	push   %ebp
+ b85:	89 e5                	mov    %esp,%ebp
+ b87:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b8d:	83 c0 04             	add    $0x4,%eax
+ b90:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ b94:	8b 45 08             	mov    0x8(%ebp),%eax
+ b97:	83 ec 08             	sub    $0x8,%esp
+ b9a:	ff 75 0c             	push   0xc(%ebp)
+ b9d:	50                   	push   %eax
+ b9e:	e8 6a fa ff ff       	call   60d <futex_wait>
+ ba3:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ ba6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba9:	83 c0 04             	add    $0x4,%eax
+ bac:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ bb0:	90                   	nop
+ bb1:	c9                   	leave
+ bb2:	c3                   	ret
+
+00000bb3 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ bb3:	55                   	push   %ebp
+ bb4:	89 e5                	mov    %esp,%ebp
+ bb6:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+ bbc:	8b 00                	mov    (%eax),%eax
+ bbe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ bc1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bc5:	78 17                	js     bde <rwlock_rdlock+0x2b>
+ bc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bca:	83 c0 01             	add    $0x1,%eax
+ bcd:	89 c1                	mov    %eax,%ecx
+ bcf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bd2:	8b 55 08             	mov    0x8(%ebp),%edx
+ bd5:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ bd9:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ bdc:	74 19                	je     bf7 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ bde:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ be2:	79 d5                	jns    bb9 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ be4:	83 ec 08             	sub    $0x8,%esp
+ be7:	ff 75 f4             	push   -0xc(%ebp)
+ bea:	ff 75 08             	push   0x8(%ebp)
+ bed:	e8 92 ff ff ff       	call   b84 <rwlock_sleep>
+ bf2:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ bf5:	eb c2                	jmp    bb9 <rwlock_rdlock+0x6>
+      return;
+ bf7:	90                   	nop
+  }
+}
+ bf8:	c9                   	leave
+ bf9:	c3                   	ret
+
+00000bfa <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ bfa:	55                   	push   %ebp
+ bfb:	89 e5                	mov    %esp,%ebp
+ bfd:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ c00:	eb 11                	jmp    c13 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ c02:	83 ec 08             	sub    $0x8,%esp
+ c05:	ff 75 f4             	push   -0xc(%ebp)
+ c08:	ff 75 08             	push   0x8(%ebp)
+ c0b:	e8 74 ff ff ff       	call   b84 <rwlock_sleep>
+ c10:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ c13:	8b 55 08             	mov    0x8(%ebp),%edx
+ c16:	b8 00 00 00 00       	mov    $0x0,%eax
+ c1b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ c20:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c24:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c27:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c2b:	75 d5                	jne    c02 <rwlock_wrlock+0x8>
+}
+ c2d:	90                   	nop
+ c2e:	90                   	nop
+ c2f:	c9                   	leave
+ c30:	c3                   	ret
+
+00000c31 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ c31:	55                   	push   %ebp
+ c32:	89 e5                	mov    %esp,%ebp
+ c34:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ c37:	8b 45 08             	mov    0x8(%ebp),%eax
+ c3a:	8b 00                	mov    (%eax),%eax
+ c3c:	85 c0                	test   %eax,%eax
+ c3e:	79 0c                	jns    c4c <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ c40:	8b 45 08             	mov    0x8(%ebp),%eax
+ c43:	ba 00 00 00 00       	mov    $0x0,%edx
+ c48:	87 10                	xchg   %edx,(%eax)
+ c4a:	eb 18                	jmp    c64 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ c4c:	8b 55 08             	mov    0x8(%ebp),%edx
+ c4f:	b8 01 00 00 00       	mov    $0x1,%eax
+ c54:	f7 d8                	neg    %eax
+ c56:	89 c1                	mov    %eax,%ecx
+ c58:	89 c8                	mov    %ecx,%eax
+ c5a:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ c5e:	01 c8                	add    %ecx,%eax
+ c60:	85 c0                	test   %eax,%eax
+ c62:	75 20                	jne    c84 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ c64:	8b 45 08             	mov    0x8(%ebp),%eax
+ c67:	8b 40 04             	mov    0x4(%eax),%eax
+ c6a:	85 c0                	test   %eax,%eax
+ c6c:	74 17                	je     c85 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ c6e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c71:	83 ec 08             	sub    $0x8,%esp
+ c74:	68 ff ff ff 7f       	push   $0x7fffffff
+ c79:	50                   	push   %eax
+ c7a:	e8 96 f9 ff ff       	call   615 <futex_wake>
+ c7f:	83 c4 10             	add    $0x10,%esp
+ c82:	eb 01                	jmp    c85 <rwlock_unlock+0x54>
+    return;
+ c84:	90                   	nop
+}
+ c85:	c9                   	leave
+ c86:	c3                   	ret
+
+00000c87 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ c87:	55                   	push   %ebp
+ c88:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ c8a:	8b 45 08             	mov    0x8(%ebp),%eax
+ c8d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c93:	90                   	nop
+ c94:	5d                   	pop    %ebp
+ c95:	c3                   	ret
+
+00000c96 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ c96:	55                   	push   %ebp
+ c97:	89 e5                	mov    %esp,%ebp
+ c99:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ c9c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c9f:	8b 00                	mov    (%eax),%eax
+ ca1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ ca4:	83 ec 0c             	sub    $0xc,%esp
+ ca7:	ff 75 0c             	push   0xc(%ebp)
+ caa:	e8 86 fe ff ff       	call   b35 <mutex_unlock>
+ caf:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ cb2:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb5:	83 ec 08             	sub    $0x8,%esp
+ cb8:	ff 75 f4             	push   -0xc(%ebp)
+ cbb:	50                   	push   %eax
+ cbc:	e8 4c f9 ff ff       	call   60d <futex_wait>
+ cc1:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ cc4:	83 ec 0c             	sub    $0xc,%esp
+ cc7:	ff 75 0c             	push   0xc(%ebp)
+ cca:	e8 08 fe ff ff       	call   ad7 <mutex_lock>
+ ccf:	83 c4 10             	add    $0x10,%esp
+}
+ cd2:	90                   	nop
+ cd3:	c9                   	leave
+ cd4:	c3                   	ret
+
+00000cd5 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ cd5:	55                   	push   %ebp
+ cd6:	89 e5                	mov    %esp,%ebp
+ cd8:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+ cde:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ ce2:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce5:	83 ec 08             	sub    $0x8,%esp
+ ce8:	6a 01                	push   $0x1
+ cea:	50                   	push   %eax
+ ceb:	e8 25 f9 ff ff       	call   615 <futex_wake>
+ cf0:	83 c4 10             	add    $0x10,%esp
+}
+ cf3:	90                   	nop
+ cf4:	c9                   	leave
+ cf5:	c3                   	ret
+
+00000cf6 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ cf6:	55                   	push   %ebp
+ cf7:	89 e5                	mov    %esp,%ebp
+ cf9:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ cfc:	8b 45 08             	mov    0x8(%ebp),%eax
+ cff:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ d03:	8b 45 08             	mov    0x8(%ebp),%eax
+ d06:	83 ec 08             	sub    $0x8,%esp
+ d09:	68 ff ff ff 7f       	push   $0x7fffffff
+ d0e:	50                   	push   %eax
+ d0f:	e8 01 f9 ff ff       	call   615 <futex_wake>
+ d14:	83 c4 10             	add    $0x10,%esp
+}
+ d17:	90                   	nop
+ d18:	c9                   	leave
+ d19:	c3                   	ret
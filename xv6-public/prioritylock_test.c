@@ -3,20 +3,32 @@
 
 #define NCHILD 10
 
+// Even and odd children contend on two separate locks,
+// so the two groups make progress in parallel.
+int locks[2];
+
 void process_function(int i)
 {
-  acquire_prioritylock();
-  printf(1, "Process %d acquired the lock.\n", getpid());
+  int lk = locks[i % 2];
+
+  acquire_prioritylock(lk);
+  printf(1, "Process %d acquired lock %d.\n", getpid(), lk);
   sleep(500);
 
-  printf(1, "Process %d released the lock.\n", getpid());
-  release_prioritylock();
+  printf(1, "Process %d released lock %d.\n", getpid(), lk);
+  release_prioritylock(lk);
   exit();
 }
 
 int main()
 {
-  init_prioritylock();
+  locks[0] = create_prioritylock("even");
+  locks[1] = create_prioritylock("odd");
+  if (locks[0] < 0 || locks[1] < 0)
+  {
+    printf(1, "Creating the locks failed.\n");
+    exit();
+  }
   for (int i = 0; i < NCHILD; i++)
   {
     int pid = fork();
@@ -34,5 +46,7 @@ int main()
   {
     wait();
   }
+  destroy_prioritylock(locks[0]);
+  destroy_prioritylock(locks[1]);
   exit();
 }
\ No newline at end of file
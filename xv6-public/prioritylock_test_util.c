@@ -6,23 +6,230 @@
 #include "mmu.h"
 #include "proc.h"
 #include "prioritylock.h"
+#include "slab.h"
 
-struct prioritylock pl;
+// Priority locks user programs reach by handle, an index into
+// pltable. Handle 0 is the default lock the old calls used;
+// the others are created by name and freed once every process
+// that created or opened them has destroyed them or exited; each
+// process counts the references it holds in its plrefs. The locks
+// themselves come from a slab cache. A call working on one holds a
+// reference too, and an acquire keeps its reference until the
+// matching release, so a lock that is held or waited on is never
+// freed.
+struct
+{
+    struct spinlock lock;
+    struct kmem_cache cache;
+    struct prioritylock *pl[NPRIOLOCK];
+    char name[NPRIOLOCK][16];
+    int ref[NPRIOLOCK];
+} pltable;
+
+void plinit(void)
+{
+    initlock(&pltable.lock, "pltable");
+    kmem_cache_init(&pltable.cache, "prioritylock", sizeof(struct prioritylock));
+    safestrcpy(pltable.name[0], "priority_lock", sizeof(pltable.name[0]));
+    if ((pltable.pl[0] = kmem_cache_alloc(&pltable.cache)) == 0)
+        panic("plinit");
+    initprioritylock(pltable.pl[0], pltable.name[0]);
+    pltable.ref[0] = 1;
+}
+
+// The lock behind handle h, or 0 if h is not in use. The
+// caller drops the reference taken with putprioritylock().
+static struct prioritylock *getprioritylock(int h)
+{
+    struct prioritylock *lk = 0;
+
+    if (h < 0 || h >= NPRIOLOCK)
+        return 0;
+    acquire(&pltable.lock);
+    if (pltable.ref[h] > 0)
+    {
+        pltable.ref[h]++;
+        lk = pltable.pl[h];
+    }
+    release(&pltable.lock);
+    return lk;
+}
+
+// Drop a reference to handle h; the last one frees its lock.
+// Caller holds pltable.lock.
+static void putlocked(int h)
+{
+    if (--pltable.ref[h] == 0)
+    {
+        if (pltable.pl[h]->locked || pltable.pl[h]->nwaiters)
+            panic("putlocked: lock in use");
+        kmem_cache_free(&pltable.cache, pltable.pl[h]);
+        pltable.pl[h] = 0;
+    }
+}
+
+static void putprioritylock(int h)
+{
+    acquire(&pltable.lock);
+    putlocked(h);
+    release(&pltable.lock);
+}
 
 int sys_init_prioritylock(void)
 {
-    initprioritylock(&pl, "priority_lock");
+    initprioritylock(pltable.pl[0], pltable.name[0]);
+    return 0;
+}
+
+// Return a handle to the lock called name, creating it if needed.
+int sys_create_prioritylock(void)
+{
+    char *name;
+    int h, free = -1;
+
+    if (argstr(0, &name) < 0 || *name == 0)
+        return -1;
+
+    acquire(&pltable.lock);
+    for (h = 0; h < NPRIOLOCK; h++)
+    {
+        if (pltable.ref[h] > 0 && strncmp(pltable.name[h], name, sizeof(pltable.name[h])) == 0)
+        {
+            pltable.ref[h]++;
+            myproc()->plrefs[h]++;
+            release(&pltable.lock);
+            return h;
+        }
+        if (pltable.ref[h] == 0 && free < 0)
+            free = h;
+    }
+    if (free >= 0)
+    {
+        if ((pltable.pl[free] = kmem_cache_alloc(&pltable.cache)) == 0)
+        {
+            release(&pltable.lock);
+            return -1;
+        }
+        safestrcpy(pltable.name[free], name, sizeof(pltable.name[free]));
+        initprioritylock(pltable.pl[free], pltable.name[free]);
+        pltable.ref[free] = 1;
+        myproc()->plrefs[free]++;
+    }
+    release(&pltable.lock);
+    return free;
+}
+
+// Drop one of the caller's references to handle h. The last one
+// frees the lock, which must not be held or waited on by then.
+int sys_destroy_prioritylock(void)
+{
+    int h;
+
+    if (argint(0, &h) < 0 || h <= 0 || h >= NPRIOLOCK)
+        return -1;
+
+    acquire(&pltable.lock);
+    if (myproc()->plrefs[h] == 0 ||
+        (pltable.ref[h] == 1 && (pltable.pl[h]->locked || pltable.pl[h]->nwaiters)))
+    {
+        release(&pltable.lock);
+        return -1;
+    }
+    myproc()->plrefs[h]--;
+    putlocked(h);
+    release(&pltable.lock);
     return 0;
 }
 
 int sys_acquire_prioritylock(void)
 {
-    acquirepriority(&pl);
+    int h;
+    struct prioritylock *lk;
+
+    // The reference is kept while the lock is held, and dropped
+    // by the release.
+    if (argint(0, &h) < 0 || (lk = getprioritylock(h)) == 0)
+        return -1;
+    if (acquirepriority(lk) < 0)
+    {
+        putprioritylock(h);
+        return -1;
+    }
+    return 0;
+}
+
+int sys_prioritylock_stats(void)
+{
+    int h;
+    struct prioritylock *lk;
+    struct plstat *st;
+
+    if (argint(0, &h) < 0 || argptr(1, (char **)&st, sizeof(*st)) < 0 ||
+        (lk = getprioritylock(h)) == 0)
+        return -1;
+    acquire(&lk->slk);
+    *st = lk->stat;
+    release(&lk->slk);
+    putprioritylock(h);
     return 0;
 }
 
 int sys_release_prioritylock(void)
 {
-    releasepriority(&pl);
+    int h;
+    struct prioritylock *lk;
+
+    if (argint(0, &h) < 0 || (lk = getprioritylock(h)) == 0)
+        return -1;
+    if (lk->owner != myproc())
+    {
+        putprioritylock(h);
+        return -1;
+    }
+    releasepriority(lk);
+    // Ours, and the one our acquire took.
+    putprioritylock(h);
+    putprioritylock(h);
     return 0;
 }
+
+// A child of fork() holds the same handles as its parent.
+void pl_fork(struct proc *parent, struct proc *child)
+{
+    acquire(&pltable.lock);
+    for (int h = 0; h < NPRIOLOCK; h++)
+    {
+        child->plrefs[h] = parent->plrefs[h];
+        pltable.ref[h] += parent->plrefs[h];
+    }
+    release(&pltable.lock);
+}
+
+// Release the priority locks p holds and drop every handle
+// reference it has, as it exits.
+void pl_detach(struct proc *p)
+{
+    struct prioritylock *lk;
+
+    for (int h = 0; h < NPRIOLOCK; h++)
+    {
+        // Only p can hand over a lock p holds, and holding it p
+        // also holds a reference, so lk stays valid past the check.
+        acquire(&pltable.lock);
+        lk = pltable.ref[h] > 0 ? pltable.pl[h] : 0;
+        if (lk && !(lk->locked && lk->owner == p))
+            lk = 0;
+        release(&pltable.lock);
+        if (lk)
+        {
+            releasepriority(lk);
+            putprioritylock(h);
+        }
+    }
+
+    acquire(&pltable.lock);
+    for (int h = 0; h < NPRIOLOCK; h++)
+        for (; p->plrefs[h] > 0; p->plrefs[h]--)
+            putlocked(h);
+    release(&pltable.lock);
+}
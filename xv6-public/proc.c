@@ -4,11 +4,11 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
+#include "traps.h"
 #include "proc.h"
 #include "spinlock.h"
 #include "shm.h"
-
-#define MIN_RANK 1000000000
+#include "schedtrace.h"
 
 struct
 {
@@ -16,6 +16,42 @@ struct
   struct proc proc[NPROC];
 } ptable;
 
+// A binary min-heap of processes ordered by before(). Members
+// record their slot in p->heap_index[id].
+struct procheap
+{
+  int id;
+  int (*before)(struct proc *, struct proc *);
+  int n;
+  struct proc *slot[NPROC];
+};
+
+// Per-CPU run queues. Every RUNNABLE process that is not on its
+// way to a CPU sits on exactly one of them, on the level named by
+// p->queue. rq->lock protects the levels and the p->rq_* fields.
+// Lock order is ptable.lock, then a single rq->lock.
+struct runqueue
+{
+  struct spinlock lock;
+  struct proc *rr_head; // RR ring, served from the head
+  struct proc *rr_tail;
+  struct proc *lcfs_top; // LCFS stack, latest arrival on top
+  struct procheap bjf;   // BJF level, by bjf_info.rank
+  struct procheap aging; // LCFS and BJF processes, by last_run
+  int aging_deadline;    // Tick after which the aging root is due
+  int nrunnable;         // Processes on all three levels
+};
+
+#define NO_DEADLINE 0x7fffffff
+
+static struct runqueue runqueues[NCPU];
+
+// Timer ticks a process may run before it is preempted, per level.
+static int quantum[NQUEUES + 1] = {
+    [RR] 1,
+    [LCFS] 4,
+    [BJF] 8};
+
 static struct proc *initproc;
 
 int nextpid = 1;
@@ -23,12 +59,464 @@ extern void forkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
+static int64 bjfrank(struct proc *p);
+static int bjf_before(struct proc *a, struct proc *b);
+static int aging_before(struct proc *a, struct proc *b);
 
 void pinit(void)
 {
   initlock(&ptable.lock, "ptable");
+  for (int i = 0; i < NPROC; i++)
+    ptable.proc[i].rq_cpu = -1;
+  for (int i = 0; i < NCPU; i++)
+  {
+    initlock(&runqueues[i].lock, "runqueue");
+    runqueues[i].bjf.id = BJF_HEAP;
+    runqueues[i].bjf.before = bjf_before;
+    runqueues[i].aging.id = AGING_HEAP;
+    runqueues[i].aging.before = aging_before;
+    runqueues[i].aging_deadline = NO_DEADLINE;
+    cpus[i].rq = &runqueues[i];
+  }
+}
+
+static struct proc **
+rq_level(struct runqueue *rq, int queue)
+{
+  if (queue == LCFS)
+    return &rq->lcfs_top;
+  return &rq->rr_head;
+}
+
+static void
+heap_place(struct procheap *h, struct proc *p, int i)
+{
+  h->slot[i] = p;
+  p->heap_index[h->id] = i;
+}
+
+// Move the process in slot i up or down until the heap is
+// ordered again. Caller holds the lock protecting h.
+static void
+heap_fix(struct procheap *h, int i)
+{
+  struct proc *p = h->slot[i];
+  int child;
+
+  while (i > 0 && h->before(p, h->slot[(i - 1) / 2]))
+  {
+    heap_place(h, h->slot[(i - 1) / 2], i);
+    i = (i - 1) / 2;
+  }
+  for (;;)
+  {
+    child = 2 * i + 1;
+    if (child >= h->n)
+      break;
+    if (child + 1 < h->n && h->before(h->slot[child + 1], h->slot[child]))
+      child++;
+    if (!h->before(h->slot[child], p))
+      break;
+    heap_place(h, h->slot[child], i);
+    i = child;
+  }
+  heap_place(h, p, i);
+}
+
+static void
+heap_push(struct procheap *h, struct proc *p)
+{
+  heap_place(h, p, h->n++);
+  heap_fix(h, h->n - 1);
+}
+
+static void
+heap_remove(struct procheap *h, struct proc *p)
+{
+  int i = p->heap_index[h->id];
+  struct proc *last = h->slot[--h->n];
+
+  if (i < h->n)
+  {
+    heap_place(h, last, i);
+    heap_fix(h, i);
+  }
+}
+
+// BJF heap order: lower rank first, ties broken by pid.
+static int
+bjf_before(struct proc *a, struct proc *b)
+{
+  if (a->bjf_info.rank != b->bjf_info.rank)
+    return a->bjf_info.rank < b->bjf_info.rank;
+  return a->pid < b->pid;
+}
+
+// Aging heap order: longest since last run first. last_run only
+// changes at dispatch, while a process is off every run queue.
+static int
+aging_before(struct proc *a, struct proc *b)
+{
+  return a->last_run < b->last_run;
+}
+
+static int
+ages(struct proc *p)
+{
+  return p->queue == LCFS || p->queue == BJF;
+}
+
+// Publish the earliest aging deadline of rq for age_proc().
+// Caller holds rq->lock.
+static void
+aging_sync(struct runqueue *rq)
+{
+  if (rq->aging.n == 0)
+    rq->aging_deadline = NO_DEADLINE;
+  else
+    rq->aging_deadline = rq->aging.slot[0]->last_run + CHANGE_QUEUE_THRESHOLD;
+}
+
+// Link p into the level of rq named by p->queue.
+// Caller holds rq->lock.
+static void
+rq_insert(struct runqueue *rq, struct proc *p)
+{
+  p->rq_prev = 0;
+  p->rq_next = 0;
+  switch (p->queue)
+  {
+  case LCFS:
+    p->rq_next = rq->lcfs_top;
+    if (rq->lcfs_top)
+      rq->lcfs_top->rq_prev = p;
+    rq->lcfs_top = p;
+    break;
+  case BJF:
+    heap_push(&rq->bjf, p);
+    break;
+  default:
+    p->rq_prev = rq->rr_tail;
+    if (rq->rr_tail)
+      rq->rr_tail->rq_next = p;
+    else
+      rq->rr_head = p;
+    rq->rr_tail = p;
+    break;
+  }
+  if (ages(p))
+  {
+    heap_push(&rq->aging, p);
+    aging_sync(rq);
+  }
+  p->rq_cpu = rq - runqueues;
+  rq->nrunnable++;
 }
 
+// Unlink p from its level of rq. Caller holds rq->lock.
+static void
+rq_remove(struct runqueue *rq, struct proc *p)
+{
+  if (ages(p))
+  {
+    heap_remove(&rq->aging, p);
+    aging_sync(rq);
+  }
+  if (p->queue == BJF)
+    heap_remove(&rq->bjf, p);
+  else
+  {
+    if (p->rq_prev)
+      p->rq_prev->rq_next = p->rq_next;
+    else
+      *rq_level(rq, p->queue) = p->rq_next;
+    if (p->rq_next)
+      p->rq_next->rq_prev = p->rq_prev;
+    else if (rq->rr_tail == p)
+      rq->rr_tail = p->rq_prev;
+  }
+  p->rq_next = 0;
+  p->rq_prev = 0;
+  p->rq_cpu = -1;
+  rq->nrunnable--;
+}
+
+// Take the next process to run off rq: the head of the RR ring,
+// else the top of the LCFS stack, else the root of the BJF heap.
+// Caller holds rq->lock.
+static struct proc *
+rq_pop(struct runqueue *rq)
+{
+  struct proc *p;
+
+  if ((p = rq->rr_head) == 0 && (p = rq->lcfs_top) == 0)
+  {
+    if (rq->bjf.n == 0)
+      return 0;
+    p = rq->bjf.slot[0];
+  }
+  rq_remove(rq, p);
+  return p;
+}
+
+// Like rq_pop, but only take a process allowed to run on cpu.
+// Used when moving work off another CPU's run queue.
+static struct proc *
+rq_take(struct runqueue *rq, int cpu)
+{
+  static int levels[] = {RR, LCFS};
+  struct proc *p, *best = 0;
+
+  for (int i = 0; i < NELEM(levels); i++)
+  {
+    for (p = *rq_level(rq, levels[i]); p; p = p->rq_next)
+    {
+      if (p->affinity & (1 << cpu))
+      {
+        rq_remove(rq, p);
+        return p;
+      }
+    }
+  }
+  for (int i = 0; i < rq->bjf.n; i++)
+  {
+    p = rq->bjf.slot[i];
+    if ((p->affinity & (1 << cpu)) && (best == 0 || bjf_before(p, best)))
+      best = p;
+  }
+  if (best)
+    rq_remove(rq, best);
+  return best;
+}
+
+// Lock the run queue p is on and return it, or return 0 if p is
+// not queued. p may move between run queues while we look.
+static struct runqueue *
+rq_lock(struct proc *p)
+{
+  struct runqueue *rq;
+  int cpu;
+
+  for (;;)
+  {
+    cpu = p->rq_cpu;
+    if (cpu < 0)
+      return 0;
+    rq = &runqueues[cpu];
+    acquire(&rq->lock);
+    if (p->rq_cpu == cpu)
+      return rq;
+    release(&rq->lock);
+  }
+}
+
+// Pick the run queue for p: the CPU it last ran on, to keep its
+// cache and TLB warm, else this CPU, else the least loaded CPU its
+// affinity mask allows.
+static struct runqueue *
+select_rq(struct proc *p)
+{
+  int cpu, best = -1;
+
+  if (p->last_cpu >= 0 && (p->affinity & (1 << p->last_cpu)))
+    return &runqueues[p->last_cpu];
+  cpu = cpuid();
+  if (p->affinity & (1 << cpu))
+    return &runqueues[cpu];
+  for (int i = 0; i < ncpu; i++)
+    if ((p->affinity & (1 << i)) &&
+        (best < 0 || runqueues[i].nrunnable < runqueues[best].nrunnable))
+      best = i;
+  return &runqueues[best < 0 ? cpu : best];
+}
+
+// Wake a halted CPU that can run p, which was just queued on rq:
+// rq's own CPU if it is idle, else any idle CPU that may steal p.
+// Interrupts are off, as a lock is held.
+static void
+kick_idle(struct runqueue *rq, struct proc *p)
+{
+  struct cpu *c = &cpus[rq - runqueues];
+
+  if (!c->idle)
+  {
+    for (c = cpus; c < &cpus[ncpu]; c++)
+      if (c->idle && (p->affinity & (1 << (c - cpus))))
+        break;
+    if (c == &cpus[ncpu])
+      return;
+  }
+  if (c != mycpu())
+    lapicipi(c->apicid, T_WAKEUP);
+}
+
+// Queue a process that has just become RUNNABLE.
+// Caller holds ptable.lock.
+static void
+enqueue(struct proc *p)
+{
+  struct runqueue *rq = select_rq(p);
+
+  acquire(&rq->lock);
+  rq_insert(rq, p);
+  // Record the wakeup while p can't be popped yet, so its
+  // timestamp is before that of the SWITCH_IN that follows.
+  trace_sched(TRACE_WAKEUP, p, 0);
+  release(&rq->lock);
+  kick_idle(rq, p);
+}
+
+// Unless kzfill() has a page to zero, halt this CPU until an
+// interrupt arrives: a wakeup IPI from kick_idle(), or the next
+// timer tick. The run queue is checked again after c->idle is
+// set, so a process queued meanwhile is either seen here or
+// brings an IPI.
+static void
+idle(struct cpu *c)
+{
+  uint64 start;
+
+  // Zero a page for kzalloc() first, if it wants one; the
+  // scheduler looks at the run queue again before the next.
+  if (kzfill())
+    return;
+
+  cli();
+  c->idle = 1;
+  __sync_synchronize();
+  if (c->rq->nrunnable == 0)
+  {
+    start = rdtsc();
+    stihlt();
+    c->idle_cycles += rdtsc() - start;
+  }
+  c->idle = 0;
+  sti();
+}
+
+// Re-link a queued process after its level or rank changed.
+// Caller holds ptable.lock.
+static void
+requeue(struct proc *p, int new_queue)
+{
+  struct runqueue *rq;
+
+  if ((rq = rq_lock(p)) == 0)
+  {
+    p->queue = new_queue;
+    return;
+  }
+  rq_remove(rq, p);
+  p->queue = new_queue;
+  rq_insert(rq, p);
+  release(&rq->lock);
+}
+
+// Recompute p's BJF rank after one of its inputs changed, and
+// restore the heap order if p is waiting in a BJF heap.
+// Caller holds ptable.lock.
+static void
+bjf_rerank(struct proc *p)
+{
+  struct runqueue *rq;
+  int64 rank = bjfrank(p);
+
+  if ((rq = rq_lock(p)) == 0)
+  {
+    p->bjf_info.rank = rank;
+    return;
+  }
+  p->bjf_info.rank = rank;
+  if (p->queue == BJF)
+    heap_fix(&rq->bjf, p->heap_index[BJF_HEAP]);
+  release(&rq->lock);
+}
+
+void update_bjf_rank(struct proc *p)
+{
+  acquire(&ptable.lock);
+  bjf_rerank(p);
+  release(&ptable.lock);
+}
+
+// Take a process from the busiest other CPU, for a CPU whose own
+// run queue is empty. The counts are read without locks; they are
+// only a hint about where to look.
+static struct proc *
+steal(struct runqueue *self)
+{
+  struct runqueue *rq, *busiest = 0;
+  struct proc *p;
+
+  for (rq = runqueues; rq < &runqueues[ncpu]; rq++)
+    if (rq != self && rq->nrunnable > (busiest ? busiest->nrunnable : 0))
+      busiest = rq;
+  if (busiest == 0)
+    return 0;
+
+  acquire(&busiest->lock);
+  p = rq_take(busiest, self - runqueues);
+  release(&busiest->lock);
+  return p;
+}
+
+// Periodic load balancing, run from the timer interrupt on CPU 0.
+// Moves queued processes from the busiest CPU to the idlest one
+// until their loads differ by at most one. Only one run queue lock
+// is held at a time, but ptable.lock is held throughout, so no
+// requeue(), bjf_rerank() or set_affinity() sees a process in
+// transit between the two queues.
+void balance_load(void)
+{
+  struct runqueue *rq, *busiest, *idlest;
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  for (int moves = 0; moves < ncpu; moves++)
+  {
+    busiest = idlest = &runqueues[0];
+    for (rq = runqueues; rq < &runqueues[ncpu]; rq++)
+    {
+      if (rq->nrunnable > busiest->nrunnable)
+        busiest = rq;
+      if (rq->nrunnable < idlest->nrunnable)
+        idlest = rq;
+    }
+    if (busiest->nrunnable - idlest->nrunnable < 2)
+      break;
+
+    acquire(&busiest->lock);
+    p = rq_take(busiest, idlest - runqueues);
+    release(&busiest->lock);
+    if (p == 0)
+      break;
+
+    acquire(&idlest->lock);
+    rq_insert(idlest, p);
+    release(&idlest->lock);
+    kick_idle(idlest, p);
+  }
+  release(&ptable.lock);
+}
+
+static int
+initial_queue(struct proc *p)
+{
+  if (p->sched_class == SCHED_INTERACTIVE || p->pid == 1 || p->pid == 2)
+    return RR;
+  return LCFS;
+}
+
+// Scheduling classes given to programs by name at exec() time.
+static struct
+{
+  char *name;
+  enum schedclass sched_class;
+} sched_policy[] = {
+    {"sh", SCHED_INTERACTIVE},
+    {"proc_info", SCHED_INTERACTIVE},
+};
+
 // Must be called with interrupts disabled
 int cpuid()
 {
@@ -120,15 +608,27 @@ found:
   memset(&p->bjf_info, 0, sizeof(p->bjf_info));
 
   p->bjf_info.priority = BJF_PRIORITY_DEFAULT;
-  p->bjf_info.priority_ratio = 1;
-  p->bjf_info.arrival_time_ratio = 1;
-  p->bjf_info.executed_cycle_ratio = 1;
-  p->bjf_info.process_size_ratio = 1;
-
-  for (int i = 0; i < MAX_SHARED_PAGES; i++)
-  {
-    p->shared_addresses[i] = -1;
-  }
+  p->bjf_info.priority_ratio = BJF_FIX_ONE;
+  p->bjf_info.arrival_time_ratio = BJF_FIX_ONE;
+  p->bjf_info.executed_cycle_ratio = BJF_FIX_ONE;
+  p->bjf_info.process_size_ratio = BJF_FIX_ONE;
+  p->queue = UNSET;
+  p->sched_class = SCHED_NORMAL;
+  p->rq_next = 0;
+  p->rq_prev = 0;
+  p->rq_cpu = -1;
+  p->last_cpu = -1;
+  p->affinity = ~0;
+  p->utime = p->stime = 0;
+  p->cutime = p->cstime = 0;
+  p->boosted = 0;
+  p->syscall_count = 0;
+  p->migrations = 0;
+  memset(p->faults, 0, sizeof(p->faults));
+  memset(p->cfaults, 0, sizeof(p->cfaults));
+  memset(p->plrefs, 0, sizeof(p->plrefs));
+
+  memset(p->shm, 0, sizeof(p->shm));
 
   return p;
 }
@@ -165,9 +665,11 @@ void userinit(void)
   // because the assignment might not be atomic.
   acquire(&ptable.lock);
 
+  p->queue = initial_queue(p);
+  p->bjf_info.rank = bjfrank(p);
   p->state = RUNNABLE;
+  enqueue(p);
   release(&ptable.lock);
-  change_queue(p->pid, UNSET);
 }
 
 // Grow current process's memory by n bytes.
@@ -180,8 +682,14 @@ int growproc(int n)
   sz = curproc->sz;
   if (n > 0)
   {
-    if ((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Only the size moves; pagefault() backs each page of the
+    // new heap with a zeroed frame when it is first touched.
+    // Refuse more pages than are free, so that running out of
+    // memory fails sbrk() rather than killing the process later.
+    if (sz + n < sz || sz + n > SHMBASE ||
+        (PGROUNDUP(sz + n) - PGROUNDUP(sz)) / PGSIZE > kfreepages())
       return -1;
+    sz += n;
   }
   else if (n < 0)
   {
@@ -189,6 +697,7 @@ int growproc(int n)
       return -1;
   }
   curproc->sz = sz;
+  update_bjf_rank(curproc);
   switchuvm(curproc);
   return 0;
 }
@@ -227,14 +736,18 @@ int fork(void)
     if (curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  shm_fork(curproc, np);
+  pl_fork(curproc, np);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  np->affinity = curproc->affinity;
+  np->sched_class = curproc->sched_class;
 
   pid = np->pid;
 
-  acquire(&ptable.lock);
+  cmostime(&np->init_time);
 
-  np->state = RUNNABLE;
+  acquire(&ptable.lock);
 
   acquire(&tickslock);
   np->bjf_info.arrival_time = ticks;
@@ -242,9 +755,12 @@ int fork(void)
   np->last_in_lcfs = ticks;
   release(&tickslock);
 
+  np->queue = initial_queue(np);
+  np->bjf_info.rank = bjfrank(np);
+  np->state = RUNNABLE;
+  enqueue(np);
+
   release(&ptable.lock);
-  cmostime(&np->init_time);
-  change_queue(pid, UNSET);
   return pid;
 }
 
@@ -275,6 +791,9 @@ void exit(void)
   end_op();
   curproc->cwd = 0;
 
+  shm_detach(curproc);
+  pl_detach(curproc);
+
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
@@ -319,6 +838,10 @@ int wait(void)
       {
         // Found one.
         pid = p->pid;
+        curproc->cutime += p->utime + p->cutime;
+        curproc->cstime += p->stime + p->cstime;
+        for (int i = 0; i < NFAULT; i++)
+          curproc->cfaults[i] += p->faults[i] + p->cfaults[i];
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
@@ -352,97 +875,104 @@ int wait(void)
 //   - swtch to start running that process
 //   - eventually that process transfers control
 //       via swtch back to the scheduler.
-int str_cmp(char *s1, char *s2)
-{
-  if (strlen(s1) != strlen(s2))
-  {
-    return 0;
-  }
-  else
-  {
-    for (int i = 0; i < strlen(s1); i++)
-    {
-      if (s1[i] != s2[i])
-      {
-        return 0;
-      }
-    }
-    return 1;
-  }
-}
-
 void scheduler(void)
 {
   struct proc *p;
-  struct proc *last_scheduled_rr = &ptable.proc[NPROC - 1];
-  struct proc *last_scheduled_lcfs = 0;
   struct cpu *c = mycpu();
+  struct runqueue *rq = c->rq;
   c->proc = 0;
   for (;;)
   {
-    for (int i = 0; i < NPROC; i++)
-    {
-      if (str_cmp(ptable.proc[i].name, "proc_info") || str_cmp(ptable.proc[i].name, "sh"))
-      {
-        if (ptable.proc[i].state == RUNNABLE)
-          change_queue(ptable.proc[i].pid, RR);
-      }
-    }
     // Enable interrupts on this processor.
     sti();
-    acquire(&ptable.lock);
-    int found = 0;
 
-    for (int i = 0; i < NQUEUES; i++)
-    {
-      switch (i)
-      {
-      case 0:
-        p = roundrobin(last_scheduled_rr);
-        last_scheduled_rr = p ? p : last_scheduled_rr;
-        break;
-      case 1:
-        p = lcfs(last_scheduled_lcfs);
-        last_scheduled_lcfs = p ? p : last_scheduled_lcfs;
-        break;
-      case 2:
-        p = bjf();
-        break;
-      default:
-        break;
-      }
-      if (p)
-      {
-        found = 1;
-        break;
-      }
-    }
-    if (!found)
+    acquire(&rq->lock);
+    p = rq_pop(rq);
+    release(&rq->lock);
+    if (p == 0 && (p = steal(rq)) == 0)
     {
-      release(&ptable.lock);
+      idle(c);
       continue;
     }
 
     // Switch to chosen process.  It is the process's job
     // to release ptable.lock and then reacquire it
     // before jumping back to us.
+    acquire(&ptable.lock);
     c->proc = p;
     switchuvm(p);
     p->state = RUNNING;
 
+    if (p->last_cpu >= 0 && p->last_cpu != c - cpus)
+      p->migrations++;
+    p->last_cpu = c - cpus;
+
     p->last_run = ticks;
-    p->bjf_info.executed_cycle += 0.1f;
+    p->slice = quantum[p->queue];
 
+    trace_sched(TRACE_SWITCH_IN, p, 0);
+    p->acct_tsc = rdtsc();
     swtch(&(c->scheduler), p->context);
     switchkvm();
+    trace_sched(TRACE_SWITCH_OUT, p, p->state == RUNNABLE);
+
+    // sched() charged the cycles up to the switch; BJF sees the
+    // total in fixed point.
+    p->bjf_info.executed_cycle =
+        (p->utime + p->stime) >> (BJF_CYCLE_SHIFT - BJF_FIX_SHIFT);
+    p->bjf_info.rank = bjfrank(p);
 
     // Process is done running for now.
     // It should have changed its p->state before coming back.
+    // A process that only yielded goes back on a run queue; its
+    // context is saved now, so another CPU may take it. No IPI:
+    // this CPU is about to choose again.
+    if (p->state == RUNNABLE)
+    {
+      rq = select_rq(p);
+      acquire(&rq->lock);
+      rq_insert(rq, p);
+      release(&rq->lock);
+      rq = c->rq;
+    }
     c->proc = 0;
     release(&ptable.lock);
   }
 }
 
+// Called from trap() on each timer tick taken while a process
+// runs. Returns nonzero once its quantum is used up, or early if
+// it is below the RR level and RR work is waiting on this CPU.
+int slice_expired(void)
+{
+  struct proc *p = myproc();
+
+  if (--p->slice <= 0)
+    return 1;
+  return p->queue != RR && mycpu()->rq->rr_head != 0;
+}
+
+// Charge the TSC cycles since the last accounting point to the
+// current process: to utime if it was running in user mode, else
+// to stime. Called at each kernel entry and exit and from sched().
+void charge_cycles(int user)
+{
+  struct proc *p;
+  uint64 now;
+
+  pushcli();
+  if ((p = mycpu()->proc) != 0)
+  {
+    now = rdtsc();
+    if (user)
+      p->utime += now - p->acct_tsc;
+    else
+      p->stime += now - p->acct_tsc;
+    p->acct_tsc = now;
+  }
+  popcli();
+}
+
 // Enter scheduler.  Must hold only ptable.lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
@@ -464,6 +994,7 @@ void sched(void)
   if (readeflags() & FL_IF)
     panic("sched interruptible");
   intena = mycpu()->intena;
+  charge_cycles(0);
   swtch(&p->context, mycpu()->scheduler);
   mycpu()->intena = intena;
 }
@@ -548,7 +1079,10 @@ wakeup1(void *chan)
 
   for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
     if (p->state == SLEEPING && p->chan == chan)
+    {
       p->state = RUNNABLE;
+      enqueue(p);
+    }
 }
 
 // Wake up all processes sleeping on chan.
@@ -559,6 +1093,73 @@ void wakeup(void *chan)
   release(&ptable.lock);
 }
 
+// Lend holder, which has a prioritylock that waiter is about to
+// sleep on, the waiter's scheduling position: its level if that is
+// higher, and its BJF rank if that is better. restore_priority()
+// takes back every loan at once, so a process holding several
+// prioritylocks loses its boost at the first release.
+void inherit_priority(struct proc *holder, struct proc *waiter)
+{
+  acquire(&ptable.lock);
+  if (!holder->boosted)
+  {
+    holder->boosted = 1;
+    holder->base_queue = holder->queue;
+    holder->boost_rank = waiter->bjf_info.rank;
+  }
+  else if (waiter->bjf_info.rank < holder->boost_rank)
+    holder->boost_rank = waiter->bjf_info.rank;
+  if (waiter->queue != UNSET && waiter->queue < holder->queue)
+    requeue(holder, waiter->queue);
+  bjf_rerank(holder);
+  release(&ptable.lock);
+}
+
+void restore_priority(struct proc *p)
+{
+  acquire(&ptable.lock);
+  if (p->boosted)
+  {
+    p->boosted = 0;
+    if (p->queue != p->base_queue)
+      requeue(p, p->base_queue);
+    bjf_rerank(p);
+  }
+  release(&ptable.lock);
+}
+
+// Wake up at most n processes sleeping on chan.
+// Returns how many were woken.
+int wakeup_n(void *chan, int n)
+{
+  struct proc *p;
+  int woken = 0;
+
+  acquire(&ptable.lock);
+  for (p = ptable.proc; p < &ptable.proc[NPROC] && woken < n; p++)
+    if (p->state == SLEEPING && p->chan == chan)
+    {
+      p->state = RUNNABLE;
+      enqueue(p);
+      woken++;
+    }
+  release(&ptable.lock);
+  return woken;
+}
+
+// Wake p if it is sleeping on chan, without scanning
+// the process table for other sleepers.
+void wakeproc(struct proc *p, void *chan)
+{
+  acquire(&ptable.lock);
+  if (p->state == SLEEPING && p->chan == chan)
+  {
+    p->state = RUNNABLE;
+    enqueue(p);
+  }
+  release(&ptable.lock);
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
@@ -574,7 +1175,10 @@ int kill(int pid)
       p->killed = 1;
       // Wake process from sleep if necessary.
       if (p->state == SLEEPING)
+      {
         p->state = RUNNABLE;
+        enqueue(p);
+      }
       release(&ptable.lock);
       return 0;
     }
@@ -689,62 +1293,70 @@ int calc_process_lifetime(int pid)
   return count;
 }
 
+// Promote to RR the queued LCFS and BJF processes that have not
+// run for CHANGE_QUEUE_THRESHOLD ticks. Each run queue keeps them in
+// a heap on last_run and publishes its earliest deadline, so only
+// due processes are touched and a tick with none due takes no lock.
 void age_proc(int uptime_ticks)
 {
-  acquire(&ptable.lock);
+  struct runqueue *rq;
+  struct proc *p;
 
-  for (int i = 0; i < NPROC; i++)
+  for (rq = runqueues; rq < &runqueues[ncpu]; rq++)
   {
-    if (ptable.proc[i].state == RUNNABLE && ptable.proc[i].queue != RR)
+    if (uptime_ticks <= rq->aging_deadline)
+      continue;
+
+    acquire(&rq->lock);
+    while (rq->aging.n > 0)
     {
-      if (uptime_ticks - ptable.proc[i].last_run > CHANGE_QUEUE_THRESHOLD)
-      {
-        release(&ptable.lock);
-        change_queue(ptable.proc[i].pid, RR);
-        acquire(&ptable.lock);
-      }
+      p = rq->aging.slot[0];
+      if (uptime_ticks - p->last_run <= CHANGE_QUEUE_THRESHOLD)
+        break;
+      rq_remove(rq, p);
+      trace_sched(TRACE_AGING, p, p->queue);
+      p->queue = RR;
+      if (p->boosted)
+        p->base_queue = RR;
+      rq_insert(rq, p);
     }
+    release(&rq->lock);
   }
-  release(&ptable.lock);
 }
 
 int change_queue(int pid, int new_queue)
 {
   int old_queue = -1;
 
-  if (new_queue == UNSET)
-  {
-    if (pid == 1 || pid == 2)
-    {
-      new_queue = RR;
-    }
-    else if (pid > 1)
-    {
-      new_queue = LCFS;
-    }
-    else
-    {
-      return old_queue;
-    }
-  }
+  if (pid < 1)
+    return old_queue;
 
   acquire(&ptable.lock);
   for (int i = 0; i < NPROC; i++)
   {
     if (ptable.proc[i].pid == pid)
     {
+      if (new_queue == UNSET)
+        new_queue = initial_queue(&ptable.proc[i]);
       old_queue = ptable.proc[i].queue;
-      if (old_queue == new_queue)
+      // A boosted process is only at old_queue on loan; the move
+      // still counts if its own level is another one.
+      if ((old_queue == new_queue &&
+           (!ptable.proc[i].boosted || ptable.proc[i].base_queue == new_queue)) ||
+          (ptable.proc[i].sched_class == SCHED_INTERACTIVE && new_queue != RR))
       {
         release(&ptable.lock);
         return -1;
       }
-      ptable.proc[i].queue = new_queue;
 
       if (new_queue == LCFS)
       {
         ptable.proc[i].last_in_lcfs = ticks;
       }
+      if (ptable.proc[i].boosted)
+        ptable.proc[i].base_queue = new_queue;
+      requeue(&ptable.proc[i], new_queue);
+      trace_sched(TRACE_QUEUE_CHANGE, &ptable.proc[i], old_queue);
       release(&ptable.lock);
       return old_queue;
     }
@@ -754,85 +1366,97 @@ int change_queue(int pid, int new_queue)
   return old_queue;
 }
 
-struct proc *roundrobin(struct proc *last_scheduled_rr)
+// BJF rank in fixed point. Integer arithmetic only: the kernel
+// does not save user FPU state, so it must not use the FPU.
+static int64 bjfrank(struct proc *p)
 {
-  struct proc *p = last_scheduled_rr;
+  struct bjf_info *b = &p->bjf_info;
+  int64 rank;
+
+  rank = (int64)b->priority * b->priority_ratio + (int64)b->arrival_time * b->arrival_time_ratio +
+         (((int64)b->executed_cycle * b->executed_cycle_ratio) >> BJF_FIX_SHIFT) +
+         (int64)p->sz * b->process_size_ratio;
+  if (p->boosted && p->boost_rank < rank)
+    return p->boost_rank;
+  return rank;
+}
 
-  for (;;)
+int set_bjf_params_for_process(int pid, int priority_ratio, int arrival_time_ratio, int executed_cycles_ratio, int process_size_ratio)
+{
+  acquire(&ptable.lock);
+  for (int i = 0; i < NPROC; i++)
   {
-    p++;
-    if (p >= &ptable.proc[NPROC])
-      p = ptable.proc;
-
-    if (p->state == RUNNABLE && p->queue == RR)
-      return p;
-
-    if (p == last_scheduled_rr)
+    if (ptable.proc[i].pid == pid)
+    {
+      ptable.proc[i].bjf_info.priority_ratio = priority_ratio;
+      ptable.proc[i].bjf_info.arrival_time_ratio = arrival_time_ratio;
+      ptable.proc[i].bjf_info.executed_cycle_ratio = executed_cycles_ratio;
+      ptable.proc[i].bjf_info.process_size_ratio = process_size_ratio;
+      bjf_rerank(&ptable.proc[i]);
+      release(&ptable.lock);
       return 0;
+    }
   }
+  release(&ptable.lock);
+  return -1;
 }
 
-struct proc *lcfs(struct proc *last_scheduled_lcfs)
+void set_bjf_params_for_system(int priority_ratio, int arrival_time_ratio, int executed_cycles_ratio, int process_size_ratio)
 {
-  struct proc *result = 0;
-  int max_arrival_time = -1;
+  acquire(&ptable.lock);
 
-  if (last_scheduled_lcfs != 0 && last_scheduled_lcfs->state == RUNNABLE)
+  for (int i = 0; i < NPROC; i++)
   {
-    return last_scheduled_lcfs;
+    ptable.proc[i].bjf_info.priority_ratio = priority_ratio;
+    ptable.proc[i].bjf_info.arrival_time_ratio = arrival_time_ratio;
+    ptable.proc[i].bjf_info.executed_cycle_ratio = executed_cycles_ratio;
+    ptable.proc[i].bjf_info.process_size_ratio = process_size_ratio;
+    bjf_rerank(&ptable.proc[i]);
   }
+  release(&ptable.lock);
+}
+
+int set_bjf_priority(int pid, int priority)
+{
+  acquire(&ptable.lock);
 
   for (int i = 0; i < NPROC; i++)
   {
-    if (ptable.proc[i].state == RUNNABLE && ptable.proc[i].queue == LCFS)
+    if (ptable.proc[i].pid == pid)
     {
-      if (ptable.proc[i].last_in_lcfs >= max_arrival_time)
-      {
-        max_arrival_time = ptable.proc[i].last_in_lcfs;
-        result = &ptable.proc[i];
-      }
+      ptable.proc[i].bjf_info.priority = priority;
+      bjf_rerank(&ptable.proc[i]);
+      release(&ptable.lock);
+      return 0;
     }
   }
-  return result;
+  release(&ptable.lock);
+  return -1;
 }
 
-static float bjfrank(struct proc *p)
+// Put p in its scheduling class and, for an interactive class,
+// in the RR queue. Caller holds ptable.lock.
+static void
+set_sched_class(struct proc *p, enum schedclass sched_class)
 {
-  return p->bjf_info.priority * p->bjf_info.priority_ratio + p->bjf_info.arrival_time * p->bjf_info.arrival_time_ratio +
-         p->bjf_info.executed_cycle * p->bjf_info.executed_cycle_ratio + p->sz * p->bjf_info.process_size_ratio;
+  p->sched_class = sched_class;
+  if (sched_class == SCHED_INTERACTIVE && p->queue != RR)
+    requeue(p, RR);
 }
 
-struct proc *bjf()
+int setsched(int pid, int sched_class)
 {
-  struct proc *result = 0;
-  float min_rank = MIN_RANK;
+  struct proc *p;
 
-  for (int i = 0; i < NPROC; i++)
-  {
-    if (ptable.proc[i].state == RUNNABLE && ptable.proc[i].queue == BJF)
-    {
-      float rank = bjfrank(&ptable.proc[i]);
-      if (result == 0 || rank < min_rank)
-      {
-        result = &ptable.proc[i];
-        min_rank = rank;
-      }
-    }
-  }
-  return result;
-}
+  if (sched_class < 0 || sched_class >= NSCHEDCLASSES)
+    return -1;
 
-int set_bjf_params_for_process(int pid, float priority_ratio, float arrival_time_ratio, float executed_cycles_ratio, float process_size_ratio)
-{
   acquire(&ptable.lock);
-  for (int i = 0; i < NPROC; i++)
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
   {
-    if (ptable.proc[i].pid == pid)
+    if (p->pid == pid && p->state != UNUSED)
     {
-      ptable.proc[i].bjf_info.priority_ratio = priority_ratio;
-      ptable.proc[i].bjf_info.arrival_time_ratio = arrival_time_ratio;
-      ptable.proc[i].bjf_info.executed_cycle_ratio = executed_cycles_ratio;
-      ptable.proc[i].bjf_info.process_size_ratio = process_size_ratio;
+      set_sched_class(p, sched_class);
       release(&ptable.lock);
       return 0;
     }
@@ -841,29 +1465,119 @@ int set_bjf_params_for_process(int pid, float priority_ratio, float arrival_time
   return -1;
 }
 
-void set_bjf_params_for_system(float priority_ratio, float arrival_time_ratio, float executed_cycles_ratio, float process_size_ratio)
+// Called by exec() once p has its new name: look the program up in
+// sched_policy. Programs not in the table keep their queue but drop
+// back to the normal class.
+void apply_sched_policy(struct proc *p)
 {
+  enum schedclass sched_class = SCHED_NORMAL;
+
+  for (int i = 0; i < NELEM(sched_policy); i++)
+    if (strncmp(p->name, sched_policy[i].name, sizeof(p->name)) == 0)
+      sched_class = sched_policy[i].sched_class;
+
   acquire(&ptable.lock);
+  set_sched_class(p, sched_class);
+  release(&ptable.lock);
+}
 
-  for (int i = 0; i < NPROC; i++)
+int get_idle_cycles(int cpu, uint64 *cycles)
+{
+  uint64 v;
+
+  if (cpu < 0 || cpu >= ncpu)
+    return -1;
+  // The owner updates the counter without a lock; reread until
+  // both halves come from the same update.
+  do
+    v = cpus[cpu].idle_cycles;
+  while (v != cpus[cpu].idle_cycles);
+  *cycles = v;
+  return 0;
+}
+
+// Restrict pid to the CPUs whose bits are set in mask. A queued
+// process that may no longer run where it waits is moved at once;
+// a running one moves the next time it is queued.
+int set_affinity(int pid, uint mask)
+{
+  struct runqueue *rq;
+  struct proc *p;
+
+  mask &= (1 << ncpu) - 1;
+  if (mask == 0)
+    return -1;
+
+  acquire(&ptable.lock);
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
   {
-    ptable.proc[i].bjf_info.priority_ratio = priority_ratio;
-    ptable.proc[i].bjf_info.arrival_time_ratio = arrival_time_ratio;
-    ptable.proc[i].bjf_info.executed_cycle_ratio = executed_cycles_ratio;
-    ptable.proc[i].bjf_info.process_size_ratio = process_size_ratio;
+    if (p->pid != pid || p->state == UNUSED)
+      continue;
+    p->affinity = mask;
+    if ((rq = rq_lock(p)) != 0)
+    {
+      if (!(mask & (1 << (rq - runqueues))))
+      {
+        rq_remove(rq, p);
+        release(&rq->lock);
+        enqueue(p);
+      }
+      else
+        release(&rq->lock);
+    }
+    release(&ptable.lock);
+    return 0;
   }
   release(&ptable.lock);
+  return -1;
 }
 
-int set_bjf_priority(int pid, int priority)
+// Set the number of timer ticks a process of the given
+// level runs before it is preempted.
+int set_quantum(int queue, int nticks)
 {
-  acquire(&ptable.lock);
+  if (queue < RR || queue > BJF || nticks < 1)
+    return -1;
+  quantum[queue] = nticks;
+  return 0;
+}
 
-  for (int i = 0; i < NPROC; i++)
+// CPU time and page faults of the caller (RUSAGE_SELF), of its
+// reaped children (RUSAGE_CHILDREN), or of the process with pid who.
+int getrusage(int who, struct rusage *ru)
+{
+  struct proc *p;
+
+  if (who == RUSAGE_SELF || who == RUSAGE_CHILDREN)
   {
-    if (ptable.proc[i].pid == pid)
+    // Bring our own counters up to date first.
+    charge_cycles(0);
+    p = myproc();
+    pushcli();
+    if (who == RUSAGE_SELF)
     {
-      ptable.proc[i].bjf_info.priority = priority;
+      ru->utime = p->utime;
+      ru->stime = p->stime;
+      memmove(ru->faults, p->faults, sizeof(ru->faults));
+    }
+    else
+    {
+      ru->utime = p->cutime;
+      ru->stime = p->cstime;
+      memmove(ru->faults, p->cfaults, sizeof(ru->faults));
+    }
+    popcli();
+    return 0;
+  }
+
+  acquire(&ptable.lock);
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  {
+    if (p->pid == who && p->state != UNUSED)
+    {
+      ru->utime = p->utime;
+      ru->stime = p->stime;
+      memmove(ru->faults, p->faults, sizeof(ru->faults));
       release(&ptable.lock);
       return 0;
     }
@@ -901,9 +1615,10 @@ void print_process_info()
       [RUNNING] "running",
       [ZOMBIE] "zombie"};
 
-  static int columns[] = {16, 8, 9, 8, 8, 8, 8, 9, 8, 8, 8, 8};
-  cprintf("Process_Name    PID     State    Queue   Cycle   Arrival Priority R_Prty  R_Arvl  R_Exec  R_Size  Rank\n"
-          "------------------------------------------------------------------------------------------------------\n");
+  static int columns[] = {16, 8, 9, 8, 8, 8, 8, 9, 8, 8, 8, 8, 8};
+  cprintf("Quantum (ticks): RR %d, LCFS %d, BJF %d\n\n", quantum[RR], quantum[LCFS], quantum[BJF]);
+  cprintf("Process_Name    PID     State    Queue   Cycle   Arrival Priority R_Prty  R_Arvl  R_Exec  R_Size  Rank    Migr\n"
+          "--------------------------------------------------------------------------------------------------------------\n");
   acquire(&ptable.lock);
   for (int i = 0; i < NPROC; i++)
   {
@@ -928,8 +1643,8 @@ void print_process_info()
     cprintf("%d", (ptable.proc[i].queue));
     spacer(columns[3] - count_digits(ptable.proc[i].queue));
 
-    cprintf("%d", (int)ptable.proc[i].bjf_info.executed_cycle);
-    spacer(columns[4] - count_digits((int)ptable.proc[i].bjf_info.executed_cycle));
+    cprintf("%d", ptable.proc[i].bjf_info.executed_cycle >> BJF_FIX_SHIFT);
+    spacer(columns[4] - count_digits(ptable.proc[i].bjf_info.executed_cycle >> BJF_FIX_SHIFT));
 
     cprintf("%d", ptable.proc[i].bjf_info.arrival_time);
     spacer(columns[5] - count_digits(ptable.proc[i].bjf_info.arrival_time));
@@ -937,33 +1652,72 @@ void print_process_info()
     cprintf("%d", ptable.proc[i].bjf_info.priority);
     spacer(columns[6] - count_digits(ptable.proc[i].bjf_info.priority));
 
-    cprintf("%d", (int)ptable.proc[i].bjf_info.priority_ratio);
-    spacer(columns[7] - count_digits((int)ptable.proc[i].bjf_info.priority_ratio));
+    cprintf("%d", ptable.proc[i].bjf_info.priority_ratio >> BJF_FIX_SHIFT);
+    spacer(columns[7] - count_digits(ptable.proc[i].bjf_info.priority_ratio >> BJF_FIX_SHIFT));
+
+    cprintf("%d", ptable.proc[i].bjf_info.arrival_time_ratio >> BJF_FIX_SHIFT);
+    spacer(columns[8] - count_digits(ptable.proc[i].bjf_info.arrival_time_ratio >> BJF_FIX_SHIFT));
 
-    cprintf("%d", (int)ptable.proc[i].bjf_info.arrival_time_ratio);
-    spacer(columns[8] - count_digits((int)ptable.proc[i].bjf_info.arrival_time_ratio));
+    cprintf("%d", ptable.proc[i].bjf_info.executed_cycle_ratio >> BJF_FIX_SHIFT);
+    spacer(columns[9] - count_digits(ptable.proc[i].bjf_info.executed_cycle_ratio >> BJF_FIX_SHIFT));
 
-    cprintf("%d", (int)ptable.proc[i].bjf_info.executed_cycle_ratio);
-    spacer(columns[9] - count_digits((int)ptable.proc[i].bjf_info.executed_cycle_ratio));
+    cprintf("%d", ptable.proc[i].bjf_info.process_size_ratio >> BJF_FIX_SHIFT);
+    spacer(columns[10] - count_digits(ptable.proc[i].bjf_info.process_size_ratio >> BJF_FIX_SHIFT));
 
-    cprintf("%d", (int)ptable.proc[i].bjf_info.process_size_ratio);
-    spacer(columns[10] - count_digits((int)ptable.proc[i].bjf_info.process_size_ratio));
+    cprintf("%d", (int)(ptable.proc[i].bjf_info.rank >> BJF_FIX_SHIFT));
+    spacer(columns[11] - count_digits((int)(ptable.proc[i].bjf_info.rank >> BJF_FIX_SHIFT)));
 
-    cprintf("%d", (int)bjfrank(&ptable.proc[i]));
+    cprintf("%d", ptable.proc[i].migrations);
     if (i != NPROC - 1)
       cprintf("\n");
   }
   release(&ptable.lock);
 }
 
-void reset_syscall_count(void)
+void print_syscall_count(void)
 {
-  cli();
+  uint total = 0, cpu_total, num_total;
+  struct proc *p;
+
   for (int i = 0; i < ncpu; i++)
-    cpus[i].syscall_count = 0;
-  sti();
-  syscall_count_total = 0;
-  __sync_synchronize();
+  {
+    cpu_total = 0;
+    for (int num = 0; num < NSYSCALL; num++)
+      cpu_total += syscallstats[i].count[num];
+    cprintf("cpu number %d has run %d systemcalls\n", cpus[i].apicid, cpu_total);
+    total += cpu_total;
+  }
+  cprintf("total number of system calls are %d\n", total);
+
+  cprintf("by system call number:\n");
+  for (int num = 0; num < NSYSCALL; num++)
+  {
+    num_total = 0;
+    for (int i = 0; i < ncpu; i++)
+      num_total += syscallstats[i].count[num];
+    if (num_total)
+      cprintf("    %d: %d\n", num, num_total);
+  }
+
+  cprintf("by process:\n");
+  acquire(&ptable.lock);
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if (p->state != UNUSED && p->syscall_count)
+      cprintf("    %d %s: %d\n", p->pid, p->name, p->syscall_count);
+  release(&ptable.lock);
+}
+
+// The counters are not stopped while they are cleared, so calls
+// made meanwhile on other CPUs may or may not survive the reset.
+void reset_syscall_count(void)
+{
+  struct proc *p;
+
+  memset(syscallstats, 0, sizeof(syscallstats));
+  acquire(&ptable.lock);
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    p->syscall_count = 0;
+  release(&ptable.lock);
 }
 
 // shared memory definition
@@ -972,121 +1726,240 @@ struct shared_memory shm;
 // shared memory initialize function
 void shm_init()
 {
-  for (int i = 0; i < MAX_SHARED_PAGES; i++)
+  for (int i = 0; i < NSHMREGION; i++)
   {
-    shm.shared_pages[i].id = -1;
-    shm.shared_pages[i].frame = (char *)0;
+    shm.regions[i].next = shm.free;
+    shm.free = &shm.regions[i];
   }
 
   initlock(&shm.slk, "spin lock");
 }
 
-// open the shared memory region
-void *shm_open(int id)
+// Find the hash chain link pointing at region id, or at the
+// end of its chain if there is none. Caller holds shm.slk.
+static struct shared_region **shm_lookup(int id)
 {
-  struct proc *proc = myproc();
-  pde_t *pgdir = proc->pgdir;
-  int page_index = -1;
+  struct shared_region **rp = &shm.buckets[(uint)id % NSHMBUCKET];
 
-  acquire(&shm.slk);
+  while (*rp != 0 && (*rp)->id != id)
+    rp = &(*rp)->next;
+  return rp;
+}
 
-  for (int i = 0; i < MAX_SHARED_PAGES; i++)
+// The mapping of proc that covers va, or 0.
+static struct shm_mapping *shm_mapping_at(struct proc *proc, uint va)
+{
+  for (int i = 0; i < NSHMMAP; i++)
   {
-    if (shm.shared_pages[i].id == id)
-    {
-      page_index = i;
-      break;
-    }
+    struct shm_mapping *m = &proc->shm[i];
+    if (m->region != 0 && va >= m->va && va < m->va + m->npages * PGSIZE)
+      return m;
   }
+  return 0;
+}
+
+// Choose where to map npages of shared memory: the lowest
+// address in the SHMBASE..KERNBASE window that overlaps none
+// of the regions proc already maps. Returns 0 if none fits.
+static uint shm_place(struct proc *proc, uint npages)
+{
+  uint va = SHMBASE, len = npages * PGSIZE;
+  int moved;
 
-  if (page_index == -1)
+  do
   {
-    int free_index = -1;
-    for (int i = 0; i < MAX_SHARED_PAGES; i++)
+    moved = 0;
+    for (int i = 0; i < NSHMMAP; i++)
     {
-      if (shm.shared_pages[i].id == -1)
+      struct shm_mapping *m = &proc->shm[i];
+      if (m->region != 0 && va < m->va + m->npages * PGSIZE && m->va < va + len)
       {
-        free_index = i;
-        break;
+        va = m->va + m->npages * PGSIZE;
+        moved = 1;
       }
     }
+  } while (moved);
+  if (va + len > KERNBASE)
+    return 0;
+  return va;
+}
 
-    if (free_index == -1)
+// open the shared memory region id, creating it with size
+// bytes if it does not exist yet, and map size bytes of it.
+// Frames are allocated when a page is first touched; see
+// shm_fault().
+void *shm_open(int id, int size)
+{
+  struct proc *proc = myproc();
+  struct shared_region **rp, *r;
+  struct shm_mapping *m = 0;
+  uint npages = PGROUNDUP(size) / PGSIZE;
+  uint va;
+
+  if (size <= 0 || npages > SHM_MAXPAGES)
+    return (void *)-1;
+
+  acquire(&shm.slk);
+
+  for (int i = 0; i < NSHMMAP; i++)
+  {
+    if (proc->shm[i].region != 0 && proc->shm[i].region->id == id)
     {
       release(&shm.slk);
-      return (char *)-1;
+      return (void *)-1;
     }
-
-    char *page;
-    page = kalloc();
-    memset(page, 0, PGSIZE);
-    mappages(pgdir, (void *)PGROUNDUP(proc->sz), PGSIZE, V2P(page), PTE_W | PTE_U);
-    proc->shared_addresses[free_index] = PGROUNDUP(proc->sz);
-    shm.shared_pages[free_index].frame = page;
-    shm.shared_pages[free_index].ref_count++;
-    shm.shared_pages[free_index].id = id;
+    if (proc->shm[i].region == 0 && m == 0)
+      m = &proc->shm[i];
+  }
+  if (m == 0 || (va = shm_place(proc, npages)) == 0)
+  {
     release(&shm.slk);
-    return (void *)proc->shared_addresses[free_index];
+    return (void *)-1;
   }
-  else
+
+  rp = shm_lookup(id);
+  if ((r = *rp) == 0)
   {
-    if (proc->shared_addresses[page_index] != -1)
+    char *frames;
+    if (shm.free == 0 || (frames = kzalloc()) == 0)
     {
       release(&shm.slk);
       return (void *)-1;
     }
-
-    mappages(pgdir, (void *)PGROUNDUP(proc->sz), PGSIZE, V2P(shm.shared_pages[page_index].frame), PTE_W | PTE_U);
-    proc->shared_addresses[page_index] = PGROUNDUP(proc->sz);
-    shm.shared_pages[page_index].ref_count++;
+    r = shm.free;
+    shm.free = r->next;
+    r->id = id;
+    r->npages = npages;
+    r->ref_count = 0;
+    r->frames = (char **)frames;
+    r->next = 0;
+    *rp = r;
+  }
+  else if (npages > r->npages)
+  {
     release(&shm.slk);
-    return (void *)proc->shared_addresses[page_index];
+    return (void *)-1;
   }
+
+  m->region = r;
+  m->va = va;
+  m->npages = npages;
+  r->ref_count++;
+  release(&shm.slk);
+  return (void *)va;
 }
 
-// close the shared memory region
-int shm_close(int id)
+// Back the shared memory page holding va on first touch.
+// Returns 0 if va is an unmapped page of a region proc maps,
+// else -1.
+int shm_fault(struct proc *proc, uint va)
 {
-  struct proc *proc = myproc();
+  struct shm_mapping *m;
+  char **frame;
+  pte_t *pte;
+  int ret = -1;
 
-  int page_index = -1;
   acquire(&shm.slk);
-
-  for (int i = 0; i < MAX_SHARED_PAGES; i++)
+  pte = walkpgdir(proc->pgdir, (void *)va, 0);
+  if ((pte == 0 || (*pte & PTE_P) == 0) && (m = shm_mapping_at(proc, va)) != 0)
   {
-    if (shm.shared_pages[i].id == id)
-    {
-      page_index = i;
-      break;
-    }
+    frame = &m->region->frames[(va - m->va) / PGSIZE];
+    if (*frame == 0)
+      *frame = kzalloc();
+    if (*frame != 0 &&
+        mappages(proc->pgdir, (void *)PGROUNDDOWN(va), PGSIZE, V2P(*frame), PTE_W | PTE_U) == 0)
+      ret = 0;
   }
+  release(&shm.slk);
+  return ret;
+}
+
+// Does one shared memory region of proc cover va..va+len?
+int shm_mapped(struct proc *proc, uint va, uint len)
+{
+  struct shm_mapping *m;
+  int found;
 
-  if (page_index == -1 || proc->shared_addresses[page_index] == -1)
+  if (len == 0 || va + len < va)
+    return 0;
+  acquire(&shm.slk);
+  found = (m = shm_mapping_at(proc, va)) != 0 &&
+          va + len <= m->va + m->npages * PGSIZE;
+  release(&shm.slk);
+  return found;
+}
+
+// A child made by fork() shares every region its parent maps, at
+// the same addresses. Its page table is filled in by shm_fault().
+void shm_fork(struct proc *parent, struct proc *child)
+{
+  acquire(&shm.slk);
+  for (int i = 0; i < NSHMMAP; i++)
   {
-    release(&shm.slk);
-    return -1;
+    child->shm[i] = parent->shm[i];
+    if (child->shm[i].region != 0)
+      child->shm[i].region->ref_count++;
   }
+  release(&shm.slk);
+}
 
-  uint a = PGROUNDUP(proc->shared_addresses[page_index]);
-  pte_t *pte = walkpgdir(proc->pgdir, (char *)a, 0);
+// Unmap m from proc and drop its reference to the region,
+// freeing the region with the last one. Caller holds shm.slk.
+static void shm_unmap(struct proc *proc, struct shm_mapping *m)
+{
+  struct shared_region *r = m->region, **rp;
 
-  if (!pte)
-    a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
-  else if ((*pte & PTE_P) != 0)
+  for (uint a = m->va; a < m->va + m->npages * PGSIZE; a += PGSIZE)
   {
-    *pte = 0;
+    pte_t *pte = walkpgdir(proc->pgdir, (char *)a, 0);
+    if (pte && (*pte & PTE_P) != 0)
+      *pte = 0;
   }
+  m->region = 0;
 
-  proc->shared_addresses[page_index] = -1;
-
-  shm.shared_pages[page_index].ref_count--;
-  if (shm.shared_pages[page_index].ref_count == 0)
+  r->ref_count--;
+  if (r->ref_count == 0)
   {
-    kfree(shm.shared_pages[page_index].frame);
-    shm.shared_pages[page_index].id = -1;
-    shm.shared_pages[page_index].frame = (void *)0;
+    for (uint i = 0; i < r->npages; i++)
+      if (r->frames[i] != 0)
+        kfree(r->frames[i]);
+    kfree((char *)r->frames);
+    for (rp = shm_lookup(r->id); *rp != r; rp = &(*rp)->next)
+      ;
+    *rp = r->next;
+    r->next = shm.free;
+    shm.free = r;
   }
+}
 
+// Unmap every region proc maps, so that freevm() does not free
+// shared frames. Called by exit() and exec().
+void shm_detach(struct proc *proc)
+{
+  acquire(&shm.slk);
+  for (int i = 0; i < NSHMMAP; i++)
+    if (proc->shm[i].region != 0)
+      shm_unmap(proc, &proc->shm[i]);
   release(&shm.slk);
-  return 0;
-}
\ No newline at end of file
+  lcr3(V2P(proc->pgdir));
+}
+
+// close the shared memory region
+int shm_close(int id)
+{
+  struct proc *proc = myproc();
+
+  acquire(&shm.slk);
+  for (int i = 0; i < NSHMMAP; i++)
+  {
+    if (proc->shm[i].region != 0 && proc->shm[i].region->id == id)
+    {
+      shm_unmap(proc, &proc->shm[i]);
+      release(&shm.slk);
+      lcr3(V2P(proc->pgdir));
+      return 0;
+    }
+  }
+  release(&shm.slk);
+  return -1;
+}
@@ -1,11 +1,17 @@
 #include "date.h"
+#include "syslat.h"
+#include "rusage.h"
 
 #define CHANGE_QUEUE_THRESHOLD 8000
 #define NQUEUES 3
 #define BJF_PRIORITY_MIN 1
 #define BJF_PRIORITY_MAX 5
 #define BJF_PRIORITY_DEFAULT 3
-#define MAX_SHARED_PAGES 16
+#define BJF_FIX_SHIFT 10 // BJF ratios and cycles are fixed point,
+#define BJF_FIX_ONE (1 << BJF_FIX_SHIFT) // BJF_FIX_ONE means 1.0
+#define NSHMMAP 8 // shared memory regions one process can map
+#define BALANCE_INTERVAL 10 // ticks between load balancing passes
+#define BJF_CYCLE_SHIFT 26 // executed_cycle counts units of 2^26 TSC cycles
 
 // Per-CPU state
 struct cpu
@@ -18,12 +24,24 @@ struct cpu
   int ncli;                  // Depth of pushcli nesting.
   int intena;                // Were interrupts enabled before pushcli?
   struct proc *proc;         // The process running on this cpu or null
-  uint syscall_count;
+  struct runqueue *rq;       // Run queues owned by this cpu (see proc.c)
+  volatile int idle;         // Halted in scheduler() waiting for work
+  uint64 idle_cycles;        // TSC cycles spent halted
 };
 
 extern struct cpu cpus[NCPU];
 extern int ncpu;
-extern uint syscall_count_total;
+
+// System calls made on one CPU, by number, and how long they
+// took. Each CPU's counts fill cache lines of their own, and
+// readers add them up.
+struct syscallstat
+{
+  uint count[NSYSCALL];
+  struct syslat lat;
+} __attribute__((aligned(CACHELINE)));
+
+extern struct syscallstat syscallstats[NCPU];
 
 // PAGEBREAK: 17
 //  Saved registers for kernel context switches.
@@ -63,15 +81,39 @@ enum MLFQ
   BJF
 };
 
+enum schedclass
+{
+  SCHED_NORMAL,      // Queue chosen by fork, aging and change_queue
+  SCHED_INTERACTIVE, // Always in the RR queue
+  NSCHEDCLASSES
+};
+
+// Heaps a queued process can be in; see struct procheap in proc.c.
+enum procheaps
+{
+  BJF_HEAP,
+  AGING_HEAP,
+  NPROCHEAPS
+};
+
 struct bjf_info
 {
   int priority;
   int arrival_time;
-  float priority_ratio;
-  float arrival_time_ratio;
-  float executed_cycle;
-  float executed_cycle_ratio;
-  float process_size_ratio;
+  int priority_ratio; // fixed point, like the fields below
+  int arrival_time_ratio;
+  int executed_cycle;
+  int executed_cycle_ratio;
+  int process_size_ratio;
+  int64 rank; // bjfrank() as of the last change to its inputs
+};
+
+// A shared memory region mapped into a process (see shm.h).
+struct shm_mapping
+{
+  struct shared_region *region; // 0 if the slot is free
+  uint va;
+  uint npages;
 };
 
 // Per-process state
@@ -93,9 +135,30 @@ struct proc
   struct rtcdate init_time;
   struct bjf_info bjf_info;
   enum MLFQ queue;
+  enum schedclass sched_class;
   int last_run;
   int last_in_lcfs;
-  int shared_addresses[MAX_SHARED_PAGES];
+  struct shm_mapping shm[NSHMMAP]; // Shared memory this process maps
+  struct proc *rq_next;       // Neighbours on the run queue level
+  struct proc *rq_prev;
+  int rq_cpu;                 // CPU whose run queue holds us, or -1
+  int heap_index[NPROCHEAPS]; // Slots in the run queue's heaps
+  int last_cpu;               // CPU we last ran on, or -1
+  uint affinity;              // Bit i set: may run on cpus[i]
+  int migrations;             // Dispatches on a CPU other than last_cpu
+  int slice;                  // Timer ticks left in the current quantum
+  uint64 utime;               // TSC cycles run in user mode
+  uint64 stime;               // TSC cycles run in the kernel
+  uint64 cutime;              // utime and stime of reaped children
+  uint64 cstime;
+  uint64 acct_tsc;            // TSC at the last charge to utime or stime
+  int boosted;                // Lent a waiter's position by inherit_priority()
+  enum MLFQ base_queue;       // Level to go back to when the boost ends
+  int64 boost_rank;           // Best BJF rank lent by a waiter
+  uint syscall_count;         // System calls made
+  uint faults[NFAULT];        // Page faults served, by kind
+  uint cfaults[NFAULT];       // faults of reaped children
+  int plrefs[NPRIOLOCK];      // References held to each priority lock handle
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -108,13 +171,28 @@ int count_uncles(int pid);
 int calc_process_lifetime(int pid);
 void age_proc(int uptime_ticks);
 int change_queue(int pid, int new_queue);
-struct proc *roundrobin(struct proc *last_scheduled_rr);
-struct proc *lcfs(struct proc *last_scheduled_lcfs);
-struct proc *bjf();
 void print_process_info();
-void set_bjf_params_for_system(float priority_ratio, float arrival_time_ratio, float executed_cycles_ratio, float process_size_ratio);
-int set_bjf_params_for_process(int pid, float priority_ratio, float arrival_time_ratio, float executed_cycles_ratio, float process_size_ratio);
+void set_bjf_params_for_system(int priority_ratio, int arrival_time_ratio, int executed_cycles_ratio, int process_size_ratio);
+int set_bjf_params_for_process(int pid, int priority_ratio, int arrival_time_ratio, int executed_cycles_ratio, int process_size_ratio);
 int set_bjf_priority(int pid, int priority);
+int set_affinity(int pid, uint mask);
+void balance_load(void);
+void update_bjf_rank(struct proc *p);
+int setsched(int pid, int sched_class);
+void apply_sched_policy(struct proc *p);
+int get_idle_cycles(int cpu, uint64 *cycles);
+int slice_expired(void);
+int set_quantum(int queue, int nticks);
+void charge_cycles(int user);
+void wakeproc(struct proc *p, void *chan);
+int wakeup_n(void *chan, int n);
+void inherit_priority(struct proc *holder, struct proc *waiter);
+void restore_priority(struct proc *p);
+void print_syscall_count(void);
 void reset_syscall_count(void);
-void *shm_open(int id);
-int shm_close(int id);
\ No newline at end of file
+void *shm_open(int id, int size);
+int shm_fault(struct proc *proc, uint va);
+int shm_close(int id);
+int shm_mapped(struct proc *proc, uint va, uint len);
+void shm_fork(struct proc *parent, struct proc *child);
+void shm_detach(struct proc *proc);
\ No newline at end of file
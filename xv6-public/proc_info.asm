@@ -0,0 +1,2451 @@
+
+_proc_info:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <help>:
+#include "types.h"
+#include "user.h"
+
+void help()
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+    printf(1, "usage: command <inputs>\n");
+       6:	83 ec 08             	sub    $0x8,%esp
+       9:	68 9c 12 00 00       	push   $0x129c
+       e:	6a 01                	push   $0x1
+      10:	e8 7e 0c 00 00       	call   c93 <printf>
+      15:	83 c4 10             	add    $0x10,%esp
+    printf(1, "list of commands:\n");
+      18:	83 ec 08             	sub    $0x8,%esp
+      1b:	68 b5 12 00 00       	push   $0x12b5
+      20:	6a 01                	push   $0x1
+      22:	e8 6c 0c 00 00       	call   c93 <printf>
+      27:	83 c4 10             	add    $0x10,%esp
+    printf(1, "    info\n");
+      2a:	83 ec 08             	sub    $0x8,%esp
+      2d:	68 c8 12 00 00       	push   $0x12c8
+      32:	6a 01                	push   $0x1
+      34:	e8 5a 0c 00 00       	call   c93 <printf>
+      39:	83 c4 10             	add    $0x10,%esp
+    printf(1, "    change_queue <pid> <new_queue>\n");
+      3c:	83 ec 08             	sub    $0x8,%esp
+      3f:	68 d4 12 00 00       	push   $0x12d4
+      44:	6a 01                	push   $0x1
+      46:	e8 48 0c 00 00       	call   c93 <printf>
+      4b:	83 c4 10             	add    $0x10,%esp
+    printf(1, "    set_bjf_process <pid> <priority_ratio> <arrival_time_ratio> <executed_cycles_ratio> <process_size_ratio>\n");
+      4e:	83 ec 08             	sub    $0x8,%esp
+      51:	68 f8 12 00 00       	push   $0x12f8
+      56:	6a 01                	push   $0x1
+      58:	e8 36 0c 00 00       	call   c93 <printf>
+      5d:	83 c4 10             	add    $0x10,%esp
+    printf(1, "    set_bjf_system <priority_ratio> <arrival_time_ratio> <executed_cycles_ratio> <process_size_ratio>\n");
+      60:	83 ec 08             	sub    $0x8,%esp
+      63:	68 68 13 00 00       	push   $0x1368
+      68:	6a 01                	push   $0x1
+      6a:	e8 24 0c 00 00       	call   c93 <printf>
+      6f:	83 c4 10             	add    $0x10,%esp
+    printf(1, "    set_affinity <pid> <cpu_mask>\n");
+      72:	83 ec 08             	sub    $0x8,%esp
+      75:	68 d0 13 00 00       	push   $0x13d0
+      7a:	6a 01                	push   $0x1
+      7c:	e8 12 0c 00 00       	call   c93 <printf>
+      81:	83 c4 10             	add    $0x10,%esp
+    printf(1, "    setsched <pid> <class>    (0: normal, 1: interactive)\n");
+      84:	83 ec 08             	sub    $0x8,%esp
+      87:	68 f4 13 00 00       	push   $0x13f4
+      8c:	6a 01                	push   $0x1
+      8e:	e8 00 0c 00 00       	call   c93 <printf>
+      93:	83 c4 10             	add    $0x10,%esp
+    printf(1, "    set_quantum <queue> <ticks>\n");
+      96:	83 ec 08             	sub    $0x8,%esp
+      99:	68 30 14 00 00       	push   $0x1430
+      9e:	6a 01                	push   $0x1
+      a0:	e8 ee 0b 00 00       	call   c93 <printf>
+      a5:	83 c4 10             	add    $0x10,%esp
+}
+      a8:	90                   	nop
+      a9:	c9                   	leave
+      aa:	c3                   	ret
+
+000000ab <set_queue>:
+
+void set_queue(int pid, int new_queue)
+{
+      ab:	55                   	push   %ebp
+      ac:	89 e5                	mov    %esp,%ebp
+      ae:	83 ec 18             	sub    $0x18,%esp
+    if (pid < 1)
+      b1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+      b5:	7f 12                	jg     c9 <set_queue+0x1e>
+        printf(1, "pid cannot be less than 1\n");
+      b7:	83 ec 08             	sub    $0x8,%esp
+      ba:	68 51 14 00 00       	push   $0x1451
+      bf:	6a 01                	push   $0x1
+      c1:	e8 cd 0b 00 00       	call   c93 <printf>
+      c6:	83 c4 10             	add    $0x10,%esp
+    if (new_queue < 1 || new_queue > 3)
+      c9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+      cd:	7e 06                	jle    d5 <set_queue+0x2a>
+      cf:	83 7d 0c 03          	cmpl   $0x3,0xc(%ebp)
+      d3:	7e 12                	jle    e7 <set_queue+0x3c>
+        printf(1, "new queue number should be in range [1, 3]\n");
+      d5:	83 ec 08             	sub    $0x8,%esp
+      d8:	68 6c 14 00 00       	push   $0x146c
+      dd:	6a 01                	push   $0x1
+      df:	e8 af 0b 00 00       	call   c93 <printf>
+      e4:	83 c4 10             	add    $0x10,%esp
+    int result = change_queue(pid, new_queue);
+      e7:	83 ec 08             	sub    $0x8,%esp
+      ea:	ff 75 0c             	push   0xc(%ebp)
+      ed:	ff 75 08             	push   0x8(%ebp)
+      f0:	e8 f2 09 00 00       	call   ae7 <change_queue>
+      f5:	83 c4 10             	add    $0x10,%esp
+      f8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if (result < 1)
+      fb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      ff:	7f 14                	jg     115 <set_queue+0x6a>
+        printf(1, "error in changing queue\n");
+     101:	83 ec 08             	sub    $0x8,%esp
+     104:	68 98 14 00 00       	push   $0x1498
+     109:	6a 01                	push   $0x1
+     10b:	e8 83 0b 00 00       	call   c93 <printf>
+     110:	83 c4 10             	add    $0x10,%esp
+    else
+        printf(1, "your process with id %d has changed queue from: %d -> %d\n", pid, result, new_queue);
+}
+     113:	eb 1b                	jmp    130 <set_queue+0x85>
+        printf(1, "your process with id %d has changed queue from: %d -> %d\n", pid, result, new_queue);
+     115:	83 ec 0c             	sub    $0xc,%esp
+     118:	ff 75 0c             	push   0xc(%ebp)
+     11b:	ff 75 f4             	push   -0xc(%ebp)
+     11e:	ff 75 08             	push   0x8(%ebp)
+     121:	68 b4 14 00 00       	push   $0x14b4
+     126:	6a 01                	push   $0x1
+     128:	e8 66 0b 00 00       	call   c93 <printf>
+     12d:	83 c4 20             	add    $0x20,%esp
+}
+     130:	90                   	nop
+     131:	c9                   	leave
+     132:	c3                   	ret
+
+00000133 <set_cpu_affinity>:
+
+void set_cpu_affinity(int pid, int mask)
+{
+     133:	55                   	push   %ebp
+     134:	89 e5                	mov    %esp,%ebp
+     136:	83 ec 08             	sub    $0x8,%esp
+    if (pid < 1)
+     139:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     13d:	7f 12                	jg     151 <set_cpu_affinity+0x1e>
+        printf(1, "pid cannot be less than 1\n");
+     13f:	83 ec 08             	sub    $0x8,%esp
+     142:	68 51 14 00 00       	push   $0x1451
+     147:	6a 01                	push   $0x1
+     149:	e8 45 0b 00 00       	call   c93 <printf>
+     14e:	83 c4 10             	add    $0x10,%esp
+    if (set_affinity(pid, mask) < 0)
+     151:	83 ec 08             	sub    $0x8,%esp
+     154:	ff 75 0c             	push   0xc(%ebp)
+     157:	ff 75 08             	push   0x8(%ebp)
+     15a:	e8 e8 09 00 00       	call   b47 <set_affinity>
+     15f:	83 c4 10             	add    $0x10,%esp
+     162:	85 c0                	test   %eax,%eax
+     164:	79 14                	jns    17a <set_cpu_affinity+0x47>
+        printf(1, "error in setting cpu affinity\n");
+     166:	83 ec 08             	sub    $0x8,%esp
+     169:	68 f0 14 00 00       	push   $0x14f0
+     16e:	6a 01                	push   $0x1
+     170:	e8 1e 0b 00 00       	call   c93 <printf>
+     175:	83 c4 10             	add    $0x10,%esp
+    else
+        printf(1, "the process with id %d may now run on cpu mask %d\n", pid, mask);
+}
+     178:	eb 15                	jmp    18f <set_cpu_affinity+0x5c>
+        printf(1, "the process with id %d may now run on cpu mask %d\n", pid, mask);
+     17a:	ff 75 0c             	push   0xc(%ebp)
+     17d:	ff 75 08             	push   0x8(%ebp)
+     180:	68 10 15 00 00       	push   $0x1510
+     185:	6a 01                	push   $0x1
+     187:	e8 07 0b 00 00       	call   c93 <printf>
+     18c:	83 c4 10             	add    $0x10,%esp
+}
+     18f:	90                   	nop
+     190:	c9                   	leave
+     191:	c3                   	ret
+
+00000192 <set_sched_class>:
+
+void set_sched_class(int pid, int sched_class)
+{
+     192:	55                   	push   %ebp
+     193:	89 e5                	mov    %esp,%ebp
+     195:	83 ec 08             	sub    $0x8,%esp
+    if (pid < 1)
+     198:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     19c:	7f 12                	jg     1b0 <set_sched_class+0x1e>
+        printf(1, "pid cannot be less than 1\n");
+     19e:	83 ec 08             	sub    $0x8,%esp
+     1a1:	68 51 14 00 00       	push   $0x1451
+     1a6:	6a 01                	push   $0x1
+     1a8:	e8 e6 0a 00 00       	call   c93 <printf>
+     1ad:	83 c4 10             	add    $0x10,%esp
+    if (setsched(pid, sched_class) < 0)
+     1b0:	83 ec 08             	sub    $0x8,%esp
+     1b3:	ff 75 0c             	push   0xc(%ebp)
+     1b6:	ff 75 08             	push   0x8(%ebp)
+     1b9:	e8 91 09 00 00       	call   b4f <setsched>
+     1be:	83 c4 10             	add    $0x10,%esp
+     1c1:	85 c0                	test   %eax,%eax
+     1c3:	79 14                	jns    1d9 <set_sched_class+0x47>
+        printf(1, "error in setting scheduling class\n");
+     1c5:	83 ec 08             	sub    $0x8,%esp
+     1c8:	68 44 15 00 00       	push   $0x1544
+     1cd:	6a 01                	push   $0x1
+     1cf:	e8 bf 0a 00 00       	call   c93 <printf>
+     1d4:	83 c4 10             	add    $0x10,%esp
+    else
+        printf(1, "the process with id %d is now in scheduling class %d\n", pid, sched_class);
+}
+     1d7:	eb 15                	jmp    1ee <set_sched_class+0x5c>
+        printf(1, "the process with id %d is now in scheduling class %d\n", pid, sched_class);
+     1d9:	ff 75 0c             	push   0xc(%ebp)
+     1dc:	ff 75 08             	push   0x8(%ebp)
+     1df:	68 68 15 00 00       	push   $0x1568
+     1e4:	6a 01                	push   $0x1
+     1e6:	e8 a8 0a 00 00       	call   c93 <printf>
+     1eb:	83 c4 10             	add    $0x10,%esp
+}
+     1ee:	90                   	nop
+     1ef:	c9                   	leave
+     1f0:	c3                   	ret
+
+000001f1 <set_queue_quantum>:
+
+void set_queue_quantum(int queue, int nticks)
+{
+     1f1:	55                   	push   %ebp
+     1f2:	89 e5                	mov    %esp,%ebp
+     1f4:	83 ec 08             	sub    $0x8,%esp
+    if (queue < 1 || queue > 3)
+     1f7:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     1fb:	7e 06                	jle    203 <set_queue_quantum+0x12>
+     1fd:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+     201:	7e 12                	jle    215 <set_queue_quantum+0x24>
+        printf(1, "queue number should be in range [1, 3]\n");
+     203:	83 ec 08             	sub    $0x8,%esp
+     206:	68 a0 15 00 00       	push   $0x15a0
+     20b:	6a 01                	push   $0x1
+     20d:	e8 81 0a 00 00       	call   c93 <printf>
+     212:	83 c4 10             	add    $0x10,%esp
+    if (nticks < 1)
+     215:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     219:	7f 12                	jg     22d <set_queue_quantum+0x3c>
+        printf(1, "quantum cannot be less than 1 tick\n");
+     21b:	83 ec 08             	sub    $0x8,%esp
+     21e:	68 c8 15 00 00       	push   $0x15c8
+     223:	6a 01                	push   $0x1
+     225:	e8 69 0a 00 00       	call   c93 <printf>
+     22a:	83 c4 10             	add    $0x10,%esp
+    if (set_quantum(queue, nticks) < 0)
+     22d:	83 ec 08             	sub    $0x8,%esp
+     230:	ff 75 0c             	push   0xc(%ebp)
+     233:	ff 75 08             	push   0x8(%ebp)
+     236:	e8 24 09 00 00       	call   b5f <set_quantum>
+     23b:	83 c4 10             	add    $0x10,%esp
+     23e:	85 c0                	test   %eax,%eax
+     240:	79 14                	jns    256 <set_queue_quantum+0x65>
+        printf(1, "error in setting quantum\n");
+     242:	83 ec 08             	sub    $0x8,%esp
+     245:	68 ec 15 00 00       	push   $0x15ec
+     24a:	6a 01                	push   $0x1
+     24c:	e8 42 0a 00 00       	call   c93 <printf>
+     251:	83 c4 10             	add    $0x10,%esp
+    else
+        printf(1, "queue %d now runs for %d ticks before preemption\n", queue, nticks);
+}
+     254:	eb 15                	jmp    26b <set_queue_quantum+0x7a>
+        printf(1, "queue %d now runs for %d ticks before preemption\n", queue, nticks);
+     256:	ff 75 0c             	push   0xc(%ebp)
+     259:	ff 75 08             	push   0x8(%ebp)
+     25c:	68 08 16 00 00       	push   $0x1608
+     261:	6a 01                	push   $0x1
+     263:	e8 2b 0a 00 00       	call   c93 <printf>
+     268:	83 c4 10             	add    $0x10,%esp
+}
+     26b:	90                   	nop
+     26c:	c9                   	leave
+     26d:	c3                   	ret
+
+0000026e <set_bjf_process_params>:
+
+void set_bjf_process_params(int pid, float priority_ratio, float arrival_time_ratio, float executed_cycles_ratio, float process_size_ratio)
+{
+     26e:	55                   	push   %ebp
+     26f:	89 e5                	mov    %esp,%ebp
+     271:	83 ec 18             	sub    $0x18,%esp
+    if (pid < 1)
+     274:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     278:	7f 12                	jg     28c <set_bjf_process_params+0x1e>
+        printf(1, "pid cannot be less than 1\n");
+     27a:	83 ec 08             	sub    $0x8,%esp
+     27d:	68 51 14 00 00       	push   $0x1451
+     282:	6a 01                	push   $0x1
+     284:	e8 0a 0a 00 00       	call   c93 <printf>
+     289:	83 c4 10             	add    $0x10,%esp
+    if (priority_ratio < 0 || arrival_time_ratio < 0 || executed_cycles_ratio < 0 || process_size_ratio < 0)
+     28c:	d9 45 0c             	flds   0xc(%ebp)
+     28f:	d9 ee                	fldz
+     291:	df f1                	fcomip %st(1),%st
+     293:	dd d8                	fstp   %st(0)
+     295:	77 21                	ja     2b8 <set_bjf_process_params+0x4a>
+     297:	d9 45 10             	flds   0x10(%ebp)
+     29a:	d9 ee                	fldz
+     29c:	df f1                	fcomip %st(1),%st
+     29e:	dd d8                	fstp   %st(0)
+     2a0:	77 16                	ja     2b8 <set_bjf_process_params+0x4a>
+     2a2:	d9 45 14             	flds   0x14(%ebp)
+     2a5:	d9 ee                	fldz
+     2a7:	df f1                	fcomip %st(1),%st
+     2a9:	dd d8                	fstp   %st(0)
+     2ab:	77 0b                	ja     2b8 <set_bjf_process_params+0x4a>
+     2ad:	d9 45 18             	flds   0x18(%ebp)
+     2b0:	d9 ee                	fldz
+     2b2:	df f1                	fcomip %st(1),%st
+     2b4:	dd d8                	fstp   %st(0)
+     2b6:	76 12                	jbe    2ca <set_bjf_process_params+0x5c>
+        printf(1, "ratios can not be less than 0\n");
+     2b8:	83 ec 08             	sub    $0x8,%esp
+     2bb:	68 3c 16 00 00       	push   $0x163c
+     2c0:	6a 01                	push   $0x1
+     2c2:	e8 cc 09 00 00       	call   c93 <printf>
+     2c7:	83 c4 10             	add    $0x10,%esp
+    int result = set_bjf_params_for_process(pid, priority_ratio, arrival_time_ratio, executed_cycles_ratio, process_size_ratio);
+     2ca:	83 ec 0c             	sub    $0xc,%esp
+     2cd:	ff 75 18             	push   0x18(%ebp)
+     2d0:	ff 75 14             	push   0x14(%ebp)
+     2d3:	ff 75 10             	push   0x10(%ebp)
+     2d6:	ff 75 0c             	push   0xc(%ebp)
+     2d9:	ff 75 08             	push   0x8(%ebp)
+     2dc:	e8 0e 08 00 00       	call   aef <set_bjf_params_for_process>
+     2e1:	83 c4 20             	add    $0x20,%esp
+     2e4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if (result < 0)
+     2e7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     2eb:	79 14                	jns    301 <set_bjf_process_params+0x93>
+        printf(1, "error in setting bjf process parameters\n");
+     2ed:	83 ec 08             	sub    $0x8,%esp
+     2f0:	68 5c 16 00 00       	push   $0x165c
+     2f5:	6a 01                	push   $0x1
+     2f7:	e8 97 09 00 00       	call   c93 <printf>
+     2fc:	83 c4 10             	add    $0x10,%esp
+    else
+        printf(1, "the process with id %d has changed bjf parameters successfully\n", pid);
+}
+     2ff:	eb 15                	jmp    316 <set_bjf_process_params+0xa8>
+        printf(1, "the process with id %d has changed bjf parameters successfully\n", pid);
+     301:	83 ec 04             	sub    $0x4,%esp
+     304:	ff 75 08             	push   0x8(%ebp)
+     307:	68 88 16 00 00       	push   $0x1688
+     30c:	6a 01                	push   $0x1
+     30e:	e8 80 09 00 00       	call   c93 <printf>
+     313:	83 c4 10             	add    $0x10,%esp
+}
+     316:	90                   	nop
+     317:	c9                   	leave
+     318:	c3                   	ret
+
+00000319 <set_bjf_system_params>:
+
+void set_bjf_system_params(float priority_ratio, float arrival_time_ratio, float executed_cycles_ratio, float process_size_ratio)
+{
+     319:	55                   	push   %ebp
+     31a:	89 e5                	mov    %esp,%ebp
+     31c:	83 ec 08             	sub    $0x8,%esp
+    if (priority_ratio < 0 || arrival_time_ratio < 0 || executed_cycles_ratio < 0 || process_size_ratio < 0)
+     31f:	d9 45 08             	flds   0x8(%ebp)
+     322:	d9 ee                	fldz
+     324:	df f1                	fcomip %st(1),%st
+     326:	dd d8                	fstp   %st(0)
+     328:	77 21                	ja     34b <set_bjf_system_params+0x32>
+     32a:	d9 45 0c             	flds   0xc(%ebp)
+     32d:	d9 ee                	fldz
+     32f:	df f1                	fcomip %st(1),%st
+     331:	dd d8                	fstp   %st(0)
+     333:	77 16                	ja     34b <set_bjf_system_params+0x32>
+     335:	d9 45 10             	flds   0x10(%ebp)
+     338:	d9 ee                	fldz
+     33a:	df f1                	fcomip %st(1),%st
+     33c:	dd d8                	fstp   %st(0)
+     33e:	77 0b                	ja     34b <set_bjf_system_params+0x32>
+     340:	d9 45 14             	flds   0x14(%ebp)
+     343:	d9 ee                	fldz
+     345:	df f1                	fcomip %st(1),%st
+     347:	dd d8                	fstp   %st(0)
+     349:	76 12                	jbe    35d <set_bjf_system_params+0x44>
+        printf(1, "ratios can not be less than 0\n");
+     34b:	83 ec 08             	sub    $0x8,%esp
+     34e:	68 3c 16 00 00       	push   $0x163c
+     353:	6a 01                	push   $0x1
+     355:	e8 39 09 00 00       	call   c93 <printf>
+     35a:	83 c4 10             	add    $0x10,%esp
+    set_bjf_params_for_system(priority_ratio, arrival_time_ratio, executed_cycles_ratio, process_size_ratio);
+     35d:	ff 75 14             	push   0x14(%ebp)
+     360:	ff 75 10             	push   0x10(%ebp)
+     363:	ff 75 0c             	push   0xc(%ebp)
+     366:	ff 75 08             	push   0x8(%ebp)
+     369:	e8 89 07 00 00       	call   af7 <set_bjf_params_for_system>
+     36e:	83 c4 10             	add    $0x10,%esp
+
+    printf(1, "bjf parameters for system has changed successfully\n");
+     371:	83 ec 08             	sub    $0x8,%esp
+     374:	68 c8 16 00 00       	push   $0x16c8
+     379:	6a 01                	push   $0x1
+     37b:	e8 13 09 00 00       	call   c93 <printf>
+     380:	83 c4 10             	add    $0x10,%esp
+}
+     383:	90                   	nop
+     384:	c9                   	leave
+     385:	c3                   	ret
+
+00000386 <main>:
+
+int main(int argc, char *argv[])
+{
+     386:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     38a:	83 e4 f0             	and    $0xfffffff0,%esp
+     38d:	ff 71 fc             	push   -0x4(%ecx)
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	56                   	push   %esi
+     394:	53                   	push   %ebx
+     395:	51                   	push   %ecx
+     396:	83 ec 1c             	sub    $0x1c,%esp
+     399:	89 cb                	mov    %ecx,%ebx
+    if (argc < 2)
+     39b:	83 3b 01             	cmpl   $0x1,(%ebx)
+     39e:	7f 0a                	jg     3aa <main+0x24>
+    {
+        help();
+     3a0:	e8 5b fc ff ff       	call   0 <help>
+     3a5:	e9 47 03 00 00       	jmp    6f1 <main+0x36b>
+    }
+    else if (argc == 2)
+     3aa:	83 3b 02             	cmpl   $0x2,(%ebx)
+     3ad:	75 31                	jne    3e0 <main+0x5a>
+    {
+        if (!strcmp(argv[1], "info"))
+     3af:	8b 43 04             	mov    0x4(%ebx),%eax
+     3b2:	83 c0 04             	add    $0x4,%eax
+     3b5:	8b 00                	mov    (%eax),%eax
+     3b7:	83 ec 08             	sub    $0x8,%esp
+     3ba:	68 fc 16 00 00       	push   $0x16fc
+     3bf:	50                   	push   %eax
+     3c0:	e8 87 03 00 00       	call   74c <strcmp>
+     3c5:	83 c4 10             	add    $0x10,%esp
+     3c8:	85 c0                	test   %eax,%eax
+     3ca:	75 0a                	jne    3d6 <main+0x50>
+            print_process_info();
+     3cc:	e8 2e 07 00 00       	call   aff <print_process_info>
+     3d1:	e9 1b 03 00 00       	jmp    6f1 <main+0x36b>
+        else
+            help();
+     3d6:	e8 25 fc ff ff       	call   0 <help>
+     3db:	e9 11 03 00 00       	jmp    6f1 <main+0x36b>
+    }
+    else if (argc == 4)
+     3e0:	83 3b 04             	cmpl   $0x4,(%ebx)
+     3e3:	0f 85 6e 01 00 00    	jne    557 <main+0x1d1>
+    {
+        if (!strcmp(argv[1], "change_queue"))
+     3e9:	8b 43 04             	mov    0x4(%ebx),%eax
+     3ec:	83 c0 04             	add    $0x4,%eax
+     3ef:	8b 00                	mov    (%eax),%eax
+     3f1:	83 ec 08             	sub    $0x8,%esp
+     3f4:	68 01 17 00 00       	push   $0x1701
+     3f9:	50                   	push   %eax
+     3fa:	e8 4d 03 00 00       	call   74c <strcmp>
+     3ff:	83 c4 10             	add    $0x10,%esp
+     402:	85 c0                	test   %eax,%eax
+     404:	75 3c                	jne    442 <main+0xbc>
+            set_queue(atoi(argv[2]), atoi(argv[3]));
+     406:	8b 43 04             	mov    0x4(%ebx),%eax
+     409:	83 c0 0c             	add    $0xc,%eax
+     40c:	8b 00                	mov    (%eax),%eax
+     40e:	83 ec 0c             	sub    $0xc,%esp
+     411:	50                   	push   %eax
+     412:	e8 a4 04 00 00       	call   8bb <atoi>
+     417:	83 c4 10             	add    $0x10,%esp
+     41a:	89 c6                	mov    %eax,%esi
+     41c:	8b 43 04             	mov    0x4(%ebx),%eax
+     41f:	83 c0 08             	add    $0x8,%eax
+     422:	8b 00                	mov    (%eax),%eax
+     424:	83 ec 0c             	sub    $0xc,%esp
+     427:	50                   	push   %eax
+     428:	e8 8e 04 00 00       	call   8bb <atoi>
+     42d:	83 c4 10             	add    $0x10,%esp
+     430:	83 ec 08             	sub    $0x8,%esp
+     433:	56                   	push   %esi
+     434:	50                   	push   %eax
+     435:	e8 71 fc ff ff       	call   ab <set_queue>
+     43a:	83 c4 10             	add    $0x10,%esp
+     43d:	e9 af 02 00 00       	jmp    6f1 <main+0x36b>
+        else if (!strcmp(argv[1], "set_affinity"))
+     442:	8b 43 04             	mov    0x4(%ebx),%eax
+     445:	83 c0 04             	add    $0x4,%eax
+     448:	8b 00                	mov    (%eax),%eax
+     44a:	83 ec 08             	sub    $0x8,%esp
+     44d:	68 0e 17 00 00       	push   $0x170e
+     452:	50                   	push   %eax
+     453:	e8 f4 02 00 00       	call   74c <strcmp>
+     458:	83 c4 10             	add    $0x10,%esp
+     45b:	85 c0                	test   %eax,%eax
+     45d:	75 3c                	jne    49b <main+0x115>
+            set_cpu_affinity(atoi(argv[2]), atoi(argv[3]));
+     45f:	8b 43 04             	mov    0x4(%ebx),%eax
+     462:	83 c0 0c             	add    $0xc,%eax
+     465:	8b 00                	mov    (%eax),%eax
+     467:	83 ec 0c             	sub    $0xc,%esp
+     46a:	50                   	push   %eax
+     46b:	e8 4b 04 00 00       	call   8bb <atoi>
+     470:	83 c4 10             	add    $0x10,%esp
+     473:	89 c6                	mov    %eax,%esi
+     475:	8b 43 04             	mov    0x4(%ebx),%eax
+     478:	83 c0 08             	add    $0x8,%eax
+     47b:	8b 00                	mov    (%eax),%eax
+     47d:	83 ec 0c             	sub    $0xc,%esp
+     480:	50                   	push   %eax
+     481:	e8 35 04 00 00       	call   8bb <atoi>
+     486:	83 c4 10             	add    $0x10,%esp
+     489:	83 ec 08             	sub    $0x8,%esp
+     48c:	56                   	push   %esi
+     48d:	50                   	push   %eax
+     48e:	e8 a0 fc ff ff       	call   133 <set_cpu_affinity>
+     493:	83 c4 10             	add    $0x10,%esp
+     496:	e9 56 02 00 00       	jmp    6f1 <main+0x36b>
+        else if (!strcmp(argv[1], "setsched"))
+     49b:	8b 43 04             	mov    0x4(%ebx),%eax
+     49e:	83 c0 04             	add    $0x4,%eax
+     4a1:	8b 00                	mov    (%eax),%eax
+     4a3:	83 ec 08             	sub    $0x8,%esp
+     4a6:	68 1b 17 00 00       	push   $0x171b
+     4ab:	50                   	push   %eax
+     4ac:	e8 9b 02 00 00       	call   74c <strcmp>
+     4b1:	83 c4 10             	add    $0x10,%esp
+     4b4:	85 c0                	test   %eax,%eax
+     4b6:	75 3c                	jne    4f4 <main+0x16e>
+            set_sched_class(atoi(argv[2]), atoi(argv[3]));
+     4b8:	8b 43 04             	mov    0x4(%ebx),%eax
+     4bb:	83 c0 0c             	add    $0xc,%eax
+     4be:	8b 00                	mov    (%eax),%eax
+     4c0:	83 ec 0c             	sub    $0xc,%esp
+     4c3:	50                   	push   %eax
+     4c4:	e8 f2 03 00 00       	call   8bb <atoi>
+     4c9:	83 c4 10             	add    $0x10,%esp
+     4cc:	89 c6                	mov    %eax,%esi
+     4ce:	8b 43 04             	mov    0x4(%ebx),%eax
+     4d1:	83 c0 08             	add    $0x8,%eax
+     4d4:	8b 00                	mov    (%eax),%eax
+     4d6:	83 ec 0c             	sub    $0xc,%esp
+     4d9:	50                   	push   %eax
+     4da:	e8 dc 03 00 00       	call   8bb <atoi>
+     4df:	83 c4 10             	add    $0x10,%esp
+     4e2:	83 ec 08             	sub    $0x8,%esp
+     4e5:	56                   	push   %esi
+     4e6:	50                   	push   %eax
+     4e7:	e8 a6 fc ff ff       	call   192 <set_sched_class>
+     4ec:	83 c4 10             	add    $0x10,%esp
+     4ef:	e9 fd 01 00 00       	jmp    6f1 <main+0x36b>
+        else if (!strcmp(argv[1], "set_quantum"))
+     4f4:	8b 43 04             	mov    0x4(%ebx),%eax
+     4f7:	83 c0 04             	add    $0x4,%eax
+     4fa:	8b 00                	mov    (%eax),%eax
+     4fc:	83 ec 08             	sub    $0x8,%esp
+     4ff:	68 24 17 00 00       	push   $0x1724
+     504:	50                   	push   %eax
+     505:	e8 42 02 00 00       	call   74c <strcmp>
+     50a:	83 c4 10             	add    $0x10,%esp
+     50d:	85 c0                	test   %eax,%eax
+     50f:	75 3c                	jne    54d <main+0x1c7>
+            set_queue_quantum(atoi(argv[2]), atoi(argv[3]));
+     511:	8b 43 04             	mov    0x4(%ebx),%eax
+     514:	83 c0 0c             	add    $0xc,%eax
+     517:	8b 00                	mov    (%eax),%eax
+     519:	83 ec 0c             	sub    $0xc,%esp
+     51c:	50                   	push   %eax
+     51d:	e8 99 03 00 00       	call   8bb <atoi>
+     522:	83 c4 10             	add    $0x10,%esp
+     525:	89 c6                	mov    %eax,%esi
+     527:	8b 43 04             	mov    0x4(%ebx),%eax
+     52a:	83 c0 08             	add    $0x8,%eax
+     52d:	8b 00                	mov    (%eax),%eax
+     52f:	83 ec 0c             	sub    $0xc,%esp
+     532:	50                   	push   %eax
+     533:	e8 83 03 00 00       	call   8bb <atoi>
+     538:	83 c4 10             	add    $0x10,%esp
+     53b:	83 ec 08             	sub    $0x8,%esp
+     53e:	56                   	push   %esi
+     53f:	50                   	push   %eax
+     540:	e8 ac fc ff ff       	call   1f1 <set_queue_quantum>
+     545:	83 c4 10             	add    $0x10,%esp
+     548:	e9 a4 01 00 00       	jmp    6f1 <main+0x36b>
+        else
+            help();
+     54d:	e8 ae fa ff ff       	call   0 <help>
+     552:	e9 9a 01 00 00       	jmp    6f1 <main+0x36b>
+    }
+    else if (argc == 6)
+     557:	83 3b 06             	cmpl   $0x6,(%ebx)
+     55a:	0f 85 b9 00 00 00    	jne    619 <main+0x293>
+    {
+        if (!strcmp(argv[1], "set_bjf_system"))
+     560:	8b 43 04             	mov    0x4(%ebx),%eax
+     563:	83 c0 04             	add    $0x4,%eax
+     566:	8b 00                	mov    (%eax),%eax
+     568:	83 ec 08             	sub    $0x8,%esp
+     56b:	68 30 17 00 00       	push   $0x1730
+     570:	50                   	push   %eax
+     571:	e8 d6 01 00 00       	call   74c <strcmp>
+     576:	83 c4 10             	add    $0x10,%esp
+     579:	85 c0                	test   %eax,%eax
+     57b:	0f 85 8e 00 00 00    	jne    60f <main+0x289>
+
+            set_bjf_system_params(atoi(argv[2]), atoi(argv[3]), atoi(argv[4]), atoi(argv[5]));
+     581:	8b 43 04             	mov    0x4(%ebx),%eax
+     584:	83 c0 14             	add    $0x14,%eax
+     587:	8b 00                	mov    (%eax),%eax
+     589:	83 ec 0c             	sub    $0xc,%esp
+     58c:	50                   	push   %eax
+     58d:	e8 29 03 00 00       	call   8bb <atoi>
+     592:	83 c4 10             	add    $0x10,%esp
+     595:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     598:	db 45 e4             	fildl  -0x1c(%ebp)
+     59b:	d9 5d e4             	fstps  -0x1c(%ebp)
+     59e:	8b 43 04             	mov    0x4(%ebx),%eax
+     5a1:	83 c0 10             	add    $0x10,%eax
+     5a4:	8b 00                	mov    (%eax),%eax
+     5a6:	83 ec 0c             	sub    $0xc,%esp
+     5a9:	50                   	push   %eax
+     5aa:	e8 0c 03 00 00       	call   8bb <atoi>
+     5af:	83 c4 10             	add    $0x10,%esp
+     5b2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     5b5:	db 45 e0             	fildl  -0x20(%ebp)
+     5b8:	d9 5d e0             	fstps  -0x20(%ebp)
+     5bb:	8b 43 04             	mov    0x4(%ebx),%eax
+     5be:	83 c0 0c             	add    $0xc,%eax
+     5c1:	8b 00                	mov    (%eax),%eax
+     5c3:	83 ec 0c             	sub    $0xc,%esp
+     5c6:	50                   	push   %eax
+     5c7:	e8 ef 02 00 00       	call   8bb <atoi>
+     5cc:	83 c4 10             	add    $0x10,%esp
+     5cf:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     5d2:	db 45 dc             	fildl  -0x24(%ebp)
+     5d5:	d9 5d dc             	fstps  -0x24(%ebp)
+     5d8:	8b 43 04             	mov    0x4(%ebx),%eax
+     5db:	83 c0 08             	add    $0x8,%eax
+     5de:	8b 00                	mov    (%eax),%eax
+     5e0:	83 ec 0c             	sub    $0xc,%esp
+     5e3:	50                   	push   %eax
+     5e4:	e8 d2 02 00 00       	call   8bb <atoi>
+     5e9:	83 c4 10             	add    $0x10,%esp
+     5ec:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     5ef:	db 45 d8             	fildl  -0x28(%ebp)
+     5f2:	ff 75 e4             	push   -0x1c(%ebp)
+     5f5:	ff 75 e0             	push   -0x20(%ebp)
+     5f8:	ff 75 dc             	push   -0x24(%ebp)
+     5fb:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+     5ff:	d9 1c 24             	fstps  (%esp)
+     602:	e8 12 fd ff ff       	call   319 <set_bjf_system_params>
+     607:	83 c4 10             	add    $0x10,%esp
+     60a:	e9 e2 00 00 00       	jmp    6f1 <main+0x36b>
+        else
+            help();
+     60f:	e8 ec f9 ff ff       	call   0 <help>
+     614:	e9 d8 00 00 00       	jmp    6f1 <main+0x36b>
+    }
+    else if (argc == 7)
+     619:	83 3b 07             	cmpl   $0x7,(%ebx)
+     61c:	0f 85 ca 00 00 00    	jne    6ec <main+0x366>
+    {
+        if (!strcmp(argv[1], "set_bjf_process"))
+     622:	8b 43 04             	mov    0x4(%ebx),%eax
+     625:	83 c0 04             	add    $0x4,%eax
+     628:	8b 00                	mov    (%eax),%eax
+     62a:	83 ec 08             	sub    $0x8,%esp
+     62d:	68 3f 17 00 00       	push   $0x173f
+     632:	50                   	push   %eax
+     633:	e8 14 01 00 00       	call   74c <strcmp>
+     638:	83 c4 10             	add    $0x10,%esp
+     63b:	85 c0                	test   %eax,%eax
+     63d:	0f 85 a2 00 00 00    	jne    6e5 <main+0x35f>
+            set_bjf_process_params(atoi(argv[2]), atoi(argv[3]), atoi(argv[4]), atoi(argv[5]), atoi(argv[6]));
+     643:	8b 43 04             	mov    0x4(%ebx),%eax
+     646:	83 c0 18             	add    $0x18,%eax
+     649:	8b 00                	mov    (%eax),%eax
+     64b:	83 ec 0c             	sub    $0xc,%esp
+     64e:	50                   	push   %eax
+     64f:	e8 67 02 00 00       	call   8bb <atoi>
+     654:	83 c4 10             	add    $0x10,%esp
+     657:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     65a:	db 45 e4             	fildl  -0x1c(%ebp)
+     65d:	d9 5d e4             	fstps  -0x1c(%ebp)
+     660:	8b 43 04             	mov    0x4(%ebx),%eax
+     663:	83 c0 14             	add    $0x14,%eax
+     666:	8b 00                	mov    (%eax),%eax
+     668:	83 ec 0c             	sub    $0xc,%esp
+     66b:	50                   	push   %eax
+     66c:	e8 4a 02 00 00       	call   8bb <atoi>
+     671:	83 c4 10             	add    $0x10,%esp
+     674:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     677:	db 45 e0             	fildl  -0x20(%ebp)
+     67a:	d9 5d e0             	fstps  -0x20(%ebp)
+     67d:	8b 43 04             	mov    0x4(%ebx),%eax
+     680:	83 c0 10             	add    $0x10,%eax
+     683:	8b 00                	mov    (%eax),%eax
+     685:	83 ec 0c             	sub    $0xc,%esp
+     688:	50                   	push   %eax
+     689:	e8 2d 02 00 00       	call   8bb <atoi>
+     68e:	83 c4 10             	add    $0x10,%esp
+     691:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     694:	db 45 dc             	fildl  -0x24(%ebp)
+     697:	d9 5d dc             	fstps  -0x24(%ebp)
+     69a:	8b 43 04             	mov    0x4(%ebx),%eax
+     69d:	83 c0 0c             	add    $0xc,%eax
+     6a0:	8b 00                	mov    (%eax),%eax
+     6a2:	83 ec 0c             	sub    $0xc,%esp
+     6a5:	50                   	push   %eax
+     6a6:	e8 10 02 00 00       	call   8bb <atoi>
+     6ab:	83 c4 10             	add    $0x10,%esp
+     6ae:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     6b1:	db 45 d8             	fildl  -0x28(%ebp)
+     6b4:	d9 5d d8             	fstps  -0x28(%ebp)
+     6b7:	8b 43 04             	mov    0x4(%ebx),%eax
+     6ba:	83 c0 08             	add    $0x8,%eax
+     6bd:	8b 00                	mov    (%eax),%eax
+     6bf:	83 ec 0c             	sub    $0xc,%esp
+     6c2:	50                   	push   %eax
+     6c3:	e8 f3 01 00 00       	call   8bb <atoi>
+     6c8:	83 c4 10             	add    $0x10,%esp
+     6cb:	83 ec 0c             	sub    $0xc,%esp
+     6ce:	ff 75 e4             	push   -0x1c(%ebp)
+     6d1:	ff 75 e0             	push   -0x20(%ebp)
+     6d4:	ff 75 dc             	push   -0x24(%ebp)
+     6d7:	ff 75 d8             	push   -0x28(%ebp)
+     6da:	50                   	push   %eax
+     6db:	e8 8e fb ff ff       	call   26e <set_bjf_process_params>
+     6e0:	83 c4 20             	add    $0x20,%esp
+     6e3:	eb 0c                	jmp    6f1 <main+0x36b>
+        else
+            help();
+     6e5:	e8 16 f9 ff ff       	call   0 <help>
+     6ea:	eb 05                	jmp    6f1 <main+0x36b>
+    }
+    else
+    {
+        help();
+     6ec:	e8 0f f9 ff ff       	call   0 <help>
+    }
+    exit();
+     6f1:	e8 31 03 00 00       	call   a27 <exit>
+
+000006f6 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+     6f6:	55                   	push   %ebp
+     6f7:	89 e5                	mov    %esp,%ebp
+     6f9:	57                   	push   %edi
+     6fa:	53                   	push   %ebx
+{
+     6fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     6fe:	8b 55 10             	mov    0x10(%ebp),%edx
+     701:	8b 45 0c             	mov    0xc(%ebp),%eax
+     704:	89 cb                	mov    %ecx,%ebx
+     706:	89 df                	mov    %ebx,%edi
+     708:	89 d1                	mov    %edx,%ecx
+     70a:	fc                   	cld
+     70b:	f3 aa                	rep stos %al,%es:(%edi)
+     70d:	89 ca                	mov    %ecx,%edx
+     70f:	89 fb                	mov    %edi,%ebx
+     711:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     714:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+     717:	90                   	nop
+     718:	5b                   	pop    %ebx
+     719:	5f                   	pop    %edi
+     71a:	5d                   	pop    %ebp
+     71b:	c3                   	ret
+
+0000071c <strcpy>:
+{
+     71c:	55                   	push   %ebp
+     71d:	89 e5                	mov    %esp,%ebp
+     71f:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     722:	8b 45 08             	mov    0x8(%ebp),%eax
+     725:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     728:	90                   	nop
+     729:	8b 55 0c             	mov    0xc(%ebp),%edx
+     72c:	8d 42 01             	lea    0x1(%edx),%eax
+     72f:	89 45 0c             	mov    %eax,0xc(%ebp)
+     732:	8b 45 08             	mov    0x8(%ebp),%eax
+     735:	8d 48 01             	lea    0x1(%eax),%ecx
+     738:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     73b:	0f b6 12             	movzbl (%edx),%edx
+     73e:	88 10                	mov    %dl,(%eax)
+     740:	0f b6 00             	movzbl (%eax),%eax
+     743:	84 c0                	test   %al,%al
+     745:	75 e2                	jne    729 <strcpy+0xd>
+  return os;
+     747:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     74a:	c9                   	leave
+     74b:	c3                   	ret
+
+0000074c <strcmp>:
+{
+     74c:	55                   	push   %ebp
+     74d:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     74f:	eb 08                	jmp    759 <strcmp+0xd>
+    p++, q++;
+     751:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     755:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     759:	8b 45 08             	mov    0x8(%ebp),%eax
+     75c:	0f b6 00             	movzbl (%eax),%eax
+     75f:	84 c0                	test   %al,%al
+     761:	74 10                	je     773 <strcmp+0x27>
+     763:	8b 45 08             	mov    0x8(%ebp),%eax
+     766:	0f b6 10             	movzbl (%eax),%edx
+     769:	8b 45 0c             	mov    0xc(%ebp),%eax
+     76c:	0f b6 00             	movzbl (%eax),%eax
+     76f:	38 c2                	cmp    %al,%dl
+     771:	74 de                	je     751 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     773:	8b 45 08             	mov    0x8(%ebp),%eax
+     776:	0f b6 00             	movzbl (%eax),%eax
+     779:	0f b6 d0             	movzbl %al,%edx
+     77c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     77f:	0f b6 00             	movzbl (%eax),%eax
+     782:	0f b6 c0             	movzbl %al,%eax
+     785:	29 c2                	sub    %eax,%edx
+     787:	89 d0                	mov    %edx,%eax
+}
+     789:	5d                   	pop    %ebp
+     78a:	c3                   	ret
+
+0000078b <strlen>:
+{
+     78b:	55                   	push   %ebp
+     78c:	89 e5                	mov    %esp,%ebp
+     78e:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     791:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     798:	eb 04                	jmp    79e <strlen+0x13>
+     79a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     79e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     7a1:	8b 45 08             	mov    0x8(%ebp),%eax
+     7a4:	01 d0                	add    %edx,%eax
+     7a6:	0f b6 00             	movzbl (%eax),%eax
+     7a9:	84 c0                	test   %al,%al
+     7ab:	75 ed                	jne    79a <strlen+0xf>
+  return n;
+     7ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     7b0:	c9                   	leave
+     7b1:	c3                   	ret
+
+000007b2 <memset>:
+{
+     7b2:	55                   	push   %ebp
+     7b3:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     7b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     7b8:	50                   	push   %eax
+     7b9:	ff 75 0c             	push   0xc(%ebp)
+     7bc:	ff 75 08             	push   0x8(%ebp)
+     7bf:	e8 32 ff ff ff       	call   6f6 <stosb>
+     7c4:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     7c7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     7ca:	c9                   	leave
+     7cb:	c3                   	ret
+
+000007cc <strchr>:
+{
+     7cc:	55                   	push   %ebp
+     7cd:	89 e5                	mov    %esp,%ebp
+     7cf:	83 ec 04             	sub    $0x4,%esp
+     7d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7d5:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     7d8:	eb 14                	jmp    7ee <strchr+0x22>
+    if(*s == c)
+     7da:	8b 45 08             	mov    0x8(%ebp),%eax
+     7dd:	0f b6 00             	movzbl (%eax),%eax
+     7e0:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     7e3:	75 05                	jne    7ea <strchr+0x1e>
+      return (char*)s;
+     7e5:	8b 45 08             	mov    0x8(%ebp),%eax
+     7e8:	eb 13                	jmp    7fd <strchr+0x31>
+  for(; *s; s++)
+     7ea:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     7ee:	8b 45 08             	mov    0x8(%ebp),%eax
+     7f1:	0f b6 00             	movzbl (%eax),%eax
+     7f4:	84 c0                	test   %al,%al
+     7f6:	75 e2                	jne    7da <strchr+0xe>
+  return 0;
+     7f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     7fd:	c9                   	leave
+     7fe:	c3                   	ret
+
+000007ff <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     7ff:	55                   	push   %ebp
+     800:	89 e5                	mov    %esp,%ebp
+     802:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     805:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     80c:	eb 42                	jmp    850 <gets+0x51>
+    cc = read(0, &c, 1);
+     80e:	83 ec 04             	sub    $0x4,%esp
+     811:	6a 01                	push   $0x1
+     813:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     816:	50                   	push   %eax
+     817:	6a 00                	push   $0x0
+     819:	e8 21 02 00 00       	call   a3f <read>
+     81e:	83 c4 10             	add    $0x10,%esp
+     821:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     824:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     828:	7e 33                	jle    85d <gets+0x5e>
+      break;
+    buf[i++] = c;
+     82a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     82d:	8d 50 01             	lea    0x1(%eax),%edx
+     830:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     833:	89 c2                	mov    %eax,%edx
+     835:	8b 45 08             	mov    0x8(%ebp),%eax
+     838:	01 c2                	add    %eax,%edx
+     83a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     83e:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     840:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     844:	3c 0a                	cmp    $0xa,%al
+     846:	74 16                	je     85e <gets+0x5f>
+     848:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     84c:	3c 0d                	cmp    $0xd,%al
+     84e:	74 0e                	je     85e <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     850:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     853:	83 c0 01             	add    $0x1,%eax
+     856:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     859:	7f b3                	jg     80e <gets+0xf>
+     85b:	eb 01                	jmp    85e <gets+0x5f>
+      break;
+     85d:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     85e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     861:	8b 45 08             	mov    0x8(%ebp),%eax
+     864:	01 d0                	add    %edx,%eax
+     866:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     869:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     86c:	c9                   	leave
+     86d:	c3                   	ret
+
+0000086e <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     86e:	55                   	push   %ebp
+     86f:	89 e5                	mov    %esp,%ebp
+     871:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     874:	83 ec 08             	sub    $0x8,%esp
+     877:	6a 00                	push   $0x0
+     879:	ff 75 08             	push   0x8(%ebp)
+     87c:	e8 e6 01 00 00       	call   a67 <open>
+     881:	83 c4 10             	add    $0x10,%esp
+     884:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     887:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     88b:	79 07                	jns    894 <stat+0x26>
+    return -1;
+     88d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     892:	eb 25                	jmp    8b9 <stat+0x4b>
+  r = fstat(fd, st);
+     894:	83 ec 08             	sub    $0x8,%esp
+     897:	ff 75 0c             	push   0xc(%ebp)
+     89a:	ff 75 f4             	push   -0xc(%ebp)
+     89d:	e8 dd 01 00 00       	call   a7f <fstat>
+     8a2:	83 c4 10             	add    $0x10,%esp
+     8a5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     8a8:	83 ec 0c             	sub    $0xc,%esp
+     8ab:	ff 75 f4             	push   -0xc(%ebp)
+     8ae:	e8 9c 01 00 00       	call   a4f <close>
+     8b3:	83 c4 10             	add    $0x10,%esp
+  return r;
+     8b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     8b9:	c9                   	leave
+     8ba:	c3                   	ret
+
+000008bb <atoi>:
+
+int
+atoi(const char *s)
+{
+     8bb:	55                   	push   %ebp
+     8bc:	89 e5                	mov    %esp,%ebp
+     8be:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     8c1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     8c8:	eb 25                	jmp    8ef <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     8ca:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     8cd:	89 d0                	mov    %edx,%eax
+     8cf:	c1 e0 02             	shl    $0x2,%eax
+     8d2:	01 d0                	add    %edx,%eax
+     8d4:	01 c0                	add    %eax,%eax
+     8d6:	89 c1                	mov    %eax,%ecx
+     8d8:	8b 45 08             	mov    0x8(%ebp),%eax
+     8db:	8d 50 01             	lea    0x1(%eax),%edx
+     8de:	89 55 08             	mov    %edx,0x8(%ebp)
+     8e1:	0f b6 00             	movzbl (%eax),%eax
+     8e4:	0f be c0             	movsbl %al,%eax
+     8e7:	01 c8                	add    %ecx,%eax
+     8e9:	83 e8 30             	sub    $0x30,%eax
+     8ec:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     8ef:	8b 45 08             	mov    0x8(%ebp),%eax
+     8f2:	0f b6 00             	movzbl (%eax),%eax
+     8f5:	3c 2f                	cmp    $0x2f,%al
+     8f7:	7e 0a                	jle    903 <atoi+0x48>
+     8f9:	8b 45 08             	mov    0x8(%ebp),%eax
+     8fc:	0f b6 00             	movzbl (%eax),%eax
+     8ff:	3c 39                	cmp    $0x39,%al
+     901:	7e c7                	jle    8ca <atoi+0xf>
+  return n;
+     903:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     906:	c9                   	leave
+     907:	c3                   	ret
+
+00000908 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     908:	55                   	push   %ebp
+     909:	89 e5                	mov    %esp,%ebp
+     90b:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+     90e:	8b 45 08             	mov    0x8(%ebp),%eax
+     911:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     914:	8b 45 0c             	mov    0xc(%ebp),%eax
+     917:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     91a:	eb 17                	jmp    933 <memmove+0x2b>
+    *dst++ = *src++;
+     91c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     91f:	8d 42 01             	lea    0x1(%edx),%eax
+     922:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     925:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     928:	8d 48 01             	lea    0x1(%eax),%ecx
+     92b:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     92e:	0f b6 12             	movzbl (%edx),%edx
+     931:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     933:	8b 45 10             	mov    0x10(%ebp),%eax
+     936:	8d 50 ff             	lea    -0x1(%eax),%edx
+     939:	89 55 10             	mov    %edx,0x10(%ebp)
+     93c:	85 c0                	test   %eax,%eax
+     93e:	7f dc                	jg     91c <memmove+0x14>
+  return vdst;
+     940:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     943:	c9                   	leave
+     944:	c3                   	ret
+
+00000945 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+     945:	55                   	push   %ebp
+     946:	89 e5                	mov    %esp,%ebp
+     948:	57                   	push   %edi
+     949:	56                   	push   %esi
+     94a:	83 ec 30             	sub    $0x30,%esp
+     94d:	8b 45 08             	mov    0x8(%ebp),%eax
+     950:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     953:	8b 45 0c             	mov    0xc(%ebp),%eax
+     956:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+     959:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+     960:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     967:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     96a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     96d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     970:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+     973:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+     97a:	e9 89 00 00 00       	jmp    a08 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+     97f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     982:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     985:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+     989:	01 c0                	add    %eax,%eax
+     98b:	89 c6                	mov    %eax,%esi
+     98d:	89 d7                	mov    %edx,%edi
+     98f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     992:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     995:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     998:	0f ad d0             	shrd   %cl,%edx,%eax
+     99b:	d3 ea                	shr    %cl,%edx
+     99d:	f6 c1 20             	test   $0x20,%cl
+     9a0:	74 04                	je     9a6 <udiv64+0x61>
+     9a2:	89 d0                	mov    %edx,%eax
+     9a4:	31 d2                	xor    %edx,%edx
+     9a6:	83 e0 01             	and    $0x1,%eax
+     9a9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+     9ac:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+     9b3:	89 f0                	mov    %esi,%eax
+     9b5:	89 fa                	mov    %edi,%edx
+     9b7:	0b 45 c8             	or     -0x38(%ebp),%eax
+     9ba:	0b 55 cc             	or     -0x34(%ebp),%edx
+     9bd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     9c0:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+     9c3:	8b 45 10             	mov    0x10(%ebp),%eax
+     9c6:	ba 00 00 00 00       	mov    $0x0,%edx
+     9cb:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     9ce:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+     9d1:	19 d1                	sbb    %edx,%ecx
+     9d3:	72 2f                	jb     a04 <udiv64+0xbf>
+      r -= d;
+     9d5:	8b 45 10             	mov    0x10(%ebp),%eax
+     9d8:	ba 00 00 00 00       	mov    $0x0,%edx
+     9dd:	29 45 e8             	sub    %eax,-0x18(%ebp)
+     9e0:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+     9e3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     9e6:	b8 01 00 00 00       	mov    $0x1,%eax
+     9eb:	ba 00 00 00 00       	mov    $0x0,%edx
+     9f0:	0f a5 c2             	shld   %cl,%eax,%edx
+     9f3:	d3 e0                	shl    %cl,%eax
+     9f5:	f6 c1 20             	test   $0x20,%cl
+     9f8:	74 04                	je     9fe <udiv64+0xb9>
+     9fa:	89 c2                	mov    %eax,%edx
+     9fc:	31 c0                	xor    %eax,%eax
+     9fe:	09 45 f0             	or     %eax,-0x10(%ebp)
+     a01:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+     a04:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+     a08:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     a0c:	0f 89 6d ff ff ff    	jns    97f <udiv64+0x3a>
+    }
+  }
+  return q;
+     a12:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a15:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+     a18:	83 c4 30             	add    $0x30,%esp
+     a1b:	5e                   	pop    %esi
+     a1c:	5f                   	pop    %edi
+     a1d:	5d                   	pop    %ebp
+     a1e:	c3                   	ret
+
+00000a1f <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     a1f:	b8 01 00 00 00       	mov    $0x1,%eax
+     a24:	cd 40                	int    $0x40
+     a26:	c3                   	ret
+
+00000a27 <exit>:
+SYSCALL(exit)
+     a27:	b8 02 00 00 00       	mov    $0x2,%eax
+     a2c:	cd 40                	int    $0x40
+     a2e:	c3                   	ret
+
+00000a2f <wait>:
+SYSCALL(wait)
+     a2f:	b8 03 00 00 00       	mov    $0x3,%eax
+     a34:	cd 40                	int    $0x40
+     a36:	c3                   	ret
+
+00000a37 <pipe>:
+SYSCALL(pipe)
+     a37:	b8 04 00 00 00       	mov    $0x4,%eax
+     a3c:	cd 40                	int    $0x40
+     a3e:	c3                   	ret
+
+00000a3f <read>:
+SYSCALL(read)
+     a3f:	b8 05 00 00 00       	mov    $0x5,%eax
+     a44:	cd 40                	int    $0x40
+     a46:	c3                   	ret
+
+00000a47 <write>:
+SYSCALL(write)
+     a47:	b8 10 00 00 00       	mov    $0x10,%eax
+     a4c:	cd 40                	int    $0x40
+     a4e:	c3                   	ret
+
+00000a4f <close>:
+SYSCALL(close)
+     a4f:	b8 15 00 00 00       	mov    $0x15,%eax
+     a54:	cd 40                	int    $0x40
+     a56:	c3                   	ret
+
+00000a57 <kill>:
+SYSCALL(kill)
+     a57:	b8 06 00 00 00       	mov    $0x6,%eax
+     a5c:	cd 40                	int    $0x40
+     a5e:	c3                   	ret
+
+00000a5f <exec>:
+SYSCALL(exec)
+     a5f:	b8 07 00 00 00       	mov    $0x7,%eax
+     a64:	cd 40                	int    $0x40
+     a66:	c3                   	ret
+
+00000a67 <open>:
+SYSCALL(open)
+     a67:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a6c:	cd 40                	int    $0x40
+     a6e:	c3                   	ret
+
+00000a6f <mknod>:
+SYSCALL(mknod)
+     a6f:	b8 11 00 00 00       	mov    $0x11,%eax
+     a74:	cd 40                	int    $0x40
+     a76:	c3                   	ret
+
+00000a77 <unlink>:
+SYSCALL(unlink)
+     a77:	b8 12 00 00 00       	mov    $0x12,%eax
+     a7c:	cd 40                	int    $0x40
+     a7e:	c3                   	ret
+
+00000a7f <fstat>:
+SYSCALL(fstat)
+     a7f:	b8 08 00 00 00       	mov    $0x8,%eax
+     a84:	cd 40                	int    $0x40
+     a86:	c3                   	ret
+
+00000a87 <link>:
+SYSCALL(link)
+     a87:	b8 13 00 00 00       	mov    $0x13,%eax
+     a8c:	cd 40                	int    $0x40
+     a8e:	c3                   	ret
+
+00000a8f <mkdir>:
+SYSCALL(mkdir)
+     a8f:	b8 14 00 00 00       	mov    $0x14,%eax
+     a94:	cd 40                	int    $0x40
+     a96:	c3                   	ret
+
+00000a97 <chdir>:
+SYSCALL(chdir)
+     a97:	b8 09 00 00 00       	mov    $0x9,%eax
+     a9c:	cd 40                	int    $0x40
+     a9e:	c3                   	ret
+
+00000a9f <dup>:
+SYSCALL(dup)
+     a9f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     aa4:	cd 40                	int    $0x40
+     aa6:	c3                   	ret
+
+00000aa7 <getpid>:
+SYSCALL(getpid)
+     aa7:	b8 0b 00 00 00       	mov    $0xb,%eax
+     aac:	cd 40                	int    $0x40
+     aae:	c3                   	ret
+
+00000aaf <sbrk>:
+SYSCALL(sbrk)
+     aaf:	b8 0c 00 00 00       	mov    $0xc,%eax
+     ab4:	cd 40                	int    $0x40
+     ab6:	c3                   	ret
+
+00000ab7 <sleep>:
+SYSCALL(sleep)
+     ab7:	b8 0d 00 00 00       	mov    $0xd,%eax
+     abc:	cd 40                	int    $0x40
+     abe:	c3                   	ret
+
+00000abf <uptime>:
+SYSCALL(uptime)
+     abf:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ac4:	cd 40                	int    $0x40
+     ac6:	c3                   	ret
+
+00000ac7 <find_digital_root>:
+SYSCALL(find_digital_root)
+     ac7:	b8 16 00 00 00       	mov    $0x16,%eax
+     acc:	cd 40                	int    $0x40
+     ace:	c3                   	ret
+
+00000acf <get_uncle_count>:
+SYSCALL(get_uncle_count)
+     acf:	b8 17 00 00 00       	mov    $0x17,%eax
+     ad4:	cd 40                	int    $0x40
+     ad6:	c3                   	ret
+
+00000ad7 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+     ad7:	b8 18 00 00 00       	mov    $0x18,%eax
+     adc:	cd 40                	int    $0x40
+     ade:	c3                   	ret
+
+00000adf <copy_file>:
+SYSCALL(copy_file)
+     adf:	b8 19 00 00 00       	mov    $0x19,%eax
+     ae4:	cd 40                	int    $0x40
+     ae6:	c3                   	ret
+
+00000ae7 <change_queue>:
+SYSCALL(change_queue)
+     ae7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     aec:	cd 40                	int    $0x40
+     aee:	c3                   	ret
+
+00000aef <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+     aef:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     af4:	cd 40                	int    $0x40
+     af6:	c3                   	ret
+
+00000af7 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+     af7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     afc:	cd 40                	int    $0x40
+     afe:	c3                   	ret
+
+00000aff <print_process_info>:
+SYSCALL(print_process_info)
+     aff:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b04:	cd 40                	int    $0x40
+     b06:	c3                   	ret
+
+00000b07 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+     b07:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     b0c:	cd 40                	int    $0x40
+     b0e:	c3                   	ret
+
+00000b0f <init_prioritylock>:
+SYSCALL(init_prioritylock)
+     b0f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     b14:	cd 40                	int    $0x40
+     b16:	c3                   	ret
+
+00000b17 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+     b17:	b8 20 00 00 00       	mov    $0x20,%eax
+     b1c:	cd 40                	int    $0x40
+     b1e:	c3                   	ret
+
+00000b1f <release_prioritylock>:
+SYSCALL(release_prioritylock)
+     b1f:	b8 21 00 00 00       	mov    $0x21,%eax
+     b24:	cd 40                	int    $0x40
+     b26:	c3                   	ret
+
+00000b27 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+     b27:	b8 22 00 00 00       	mov    $0x22,%eax
+     b2c:	cd 40                	int    $0x40
+     b2e:	c3                   	ret
+
+00000b2f <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+     b2f:	b8 23 00 00 00       	mov    $0x23,%eax
+     b34:	cd 40                	int    $0x40
+     b36:	c3                   	ret
+
+00000b37 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+     b37:	b8 24 00 00 00       	mov    $0x24,%eax
+     b3c:	cd 40                	int    $0x40
+     b3e:	c3                   	ret
+
+00000b3f <close_sharedmem>:
+SYSCALL(close_sharedmem)
+     b3f:	b8 25 00 00 00       	mov    $0x25,%eax
+     b44:	cd 40                	int    $0x40
+     b46:	c3                   	ret
+
+00000b47 <set_affinity>:
+SYSCALL(set_affinity)
+     b47:	b8 26 00 00 00       	mov    $0x26,%eax
+     b4c:	cd 40                	int    $0x40
+     b4e:	c3                   	ret
+
+00000b4f <setsched>:
+SYSCALL(setsched)
+     b4f:	b8 27 00 00 00       	mov    $0x27,%eax
+     b54:	cd 40                	int    $0x40
+     b56:	c3                   	ret
+
+00000b57 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+     b57:	b8 28 00 00 00       	mov    $0x28,%eax
+     b5c:	cd 40                	int    $0x40
+     b5e:	c3                   	ret
+
+00000b5f <set_quantum>:
+SYSCALL(set_quantum)
+     b5f:	b8 29 00 00 00       	mov    $0x29,%eax
+     b64:	cd 40                	int    $0x40
+     b66:	c3                   	ret
+
+00000b67 <schedtrace>:
+SYSCALL(schedtrace)
+     b67:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b6c:	cd 40                	int    $0x40
+     b6e:	c3                   	ret
+
+00000b6f <getrusage>:
+SYSCALL(getrusage)
+     b6f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     b74:	cd 40                	int    $0x40
+     b76:	c3                   	ret
+
+00000b77 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+     b77:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     b7c:	cd 40                	int    $0x40
+     b7e:	c3                   	ret
+
+00000b7f <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+     b7f:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     b84:	cd 40                	int    $0x40
+     b86:	c3                   	ret
+
+00000b87 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+     b87:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     b8c:	cd 40                	int    $0x40
+     b8e:	c3                   	ret
+
+00000b8f <futex_wait>:
+SYSCALL(futex_wait)
+     b8f:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     b94:	cd 40                	int    $0x40
+     b96:	c3                   	ret
+
+00000b97 <futex_wake>:
+SYSCALL(futex_wake)
+     b97:	b8 30 00 00 00       	mov    $0x30,%eax
+     b9c:	cd 40                	int    $0x40
+     b9e:	c3                   	ret
+
+00000b9f <syscall_latency>:
+SYSCALL(syscall_latency)
+     b9f:	b8 31 00 00 00       	mov    $0x31,%eax
+     ba4:	cd 40                	int    $0x40
+     ba6:	c3                   	ret
+
+00000ba7 <submit_batch>:
+SYSCALL(submit_batch)
+     ba7:	b8 32 00 00 00       	mov    $0x32,%eax
+     bac:	cd 40                	int    $0x40
+     bae:	c3                   	ret
+
+00000baf <kmem_stats>:
+SYSCALL(kmem_stats)
+     baf:	b8 33 00 00 00       	mov    $0x33,%eax
+     bb4:	cd 40                	int    $0x40
+     bb6:	c3                   	ret
+
+00000bb7 <kmem_junk>:
+SYSCALL(kmem_junk)
+     bb7:	b8 34 00 00 00       	mov    $0x34,%eax
+     bbc:	cd 40                	int    $0x40
+     bbe:	c3                   	ret
+
+00000bbf <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     bbf:	55                   	push   %ebp
+     bc0:	89 e5                	mov    %esp,%ebp
+     bc2:	83 ec 18             	sub    $0x18,%esp
+     bc5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bc8:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+     bcb:	83 ec 04             	sub    $0x4,%esp
+     bce:	6a 01                	push   $0x1
+     bd0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     bd3:	50                   	push   %eax
+     bd4:	ff 75 08             	push   0x8(%ebp)
+     bd7:	e8 6b fe ff ff       	call   a47 <write>
+     bdc:	83 c4 10             	add    $0x10,%esp
+}
+     bdf:	90                   	nop
+     be0:	c9                   	leave
+     be1:	c3                   	ret
+
+00000be2 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     be2:	55                   	push   %ebp
+     be3:	89 e5                	mov    %esp,%ebp
+     be5:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     be8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     bef:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     bf3:	74 17                	je     c0c <printint+0x2a>
+     bf5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     bf9:	79 11                	jns    c0c <printint+0x2a>
+    neg = 1;
+     bfb:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     c02:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c05:	f7 d8                	neg    %eax
+     c07:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     c0a:	eb 06                	jmp    c12 <printint+0x30>
+  } else {
+    x = xx;
+     c0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c0f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     c12:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     c19:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     c1c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c1f:	ba 00 00 00 00       	mov    $0x0,%edx
+     c24:	f7 f1                	div    %ecx
+     c26:	89 d1                	mov    %edx,%ecx
+     c28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c2b:	8d 50 01             	lea    0x1(%eax),%edx
+     c2e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     c31:	0f b6 91 2c 1c 00 00 	movzbl 0x1c2c(%ecx),%edx
+     c38:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     c3c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     c3f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c42:	ba 00 00 00 00       	mov    $0x0,%edx
+     c47:	f7 f1                	div    %ecx
+     c49:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     c4c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     c50:	75 c7                	jne    c19 <printint+0x37>
+  if(neg)
+     c52:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     c56:	74 2d                	je     c85 <printint+0xa3>
+    buf[i++] = '-';
+     c58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c5b:	8d 50 01             	lea    0x1(%eax),%edx
+     c5e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     c61:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     c66:	eb 1d                	jmp    c85 <printint+0xa3>
+    putc(fd, buf[i]);
+     c68:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     c6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c6e:	01 d0                	add    %edx,%eax
+     c70:	0f b6 00             	movzbl (%eax),%eax
+     c73:	0f be c0             	movsbl %al,%eax
+     c76:	83 ec 08             	sub    $0x8,%esp
+     c79:	50                   	push   %eax
+     c7a:	ff 75 08             	push   0x8(%ebp)
+     c7d:	e8 3d ff ff ff       	call   bbf <putc>
+     c82:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     c85:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     c89:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     c8d:	79 d9                	jns    c68 <printint+0x86>
+}
+     c8f:	90                   	nop
+     c90:	90                   	nop
+     c91:	c9                   	leave
+     c92:	c3                   	ret
+
+00000c93 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c93:	55                   	push   %ebp
+     c94:	89 e5                	mov    %esp,%ebp
+     c96:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     c99:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     ca0:	8d 45 0c             	lea    0xc(%ebp),%eax
+     ca3:	83 c0 04             	add    $0x4,%eax
+     ca6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     ca9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     cb0:	e9 59 01 00 00       	jmp    e0e <printf+0x17b>
+    c = fmt[i] & 0xff;
+     cb5:	8b 55 0c             	mov    0xc(%ebp),%edx
+     cb8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     cbb:	01 d0                	add    %edx,%eax
+     cbd:	0f b6 00             	movzbl (%eax),%eax
+     cc0:	0f be c0             	movsbl %al,%eax
+     cc3:	25 ff 00 00 00       	and    $0xff,%eax
+     cc8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     ccb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     ccf:	75 2c                	jne    cfd <printf+0x6a>
+      if(c == '%'){
+     cd1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     cd5:	75 0c                	jne    ce3 <printf+0x50>
+        state = '%';
+     cd7:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     cde:	e9 27 01 00 00       	jmp    e0a <printf+0x177>
+      } else {
+        putc(fd, c);
+     ce3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ce6:	0f be c0             	movsbl %al,%eax
+     ce9:	83 ec 08             	sub    $0x8,%esp
+     cec:	50                   	push   %eax
+     ced:	ff 75 08             	push   0x8(%ebp)
+     cf0:	e8 ca fe ff ff       	call   bbf <putc>
+     cf5:	83 c4 10             	add    $0x10,%esp
+     cf8:	e9 0d 01 00 00       	jmp    e0a <printf+0x177>
+      }
+    } else if(state == '%'){
+     cfd:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     d01:	0f 85 03 01 00 00    	jne    e0a <printf+0x177>
+      if(c == 'd'){
+     d07:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     d0b:	75 1e                	jne    d2b <printf+0x98>
+        printint(fd, *ap, 10, 1);
+     d0d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d10:	8b 00                	mov    (%eax),%eax
+     d12:	6a 01                	push   $0x1
+     d14:	6a 0a                	push   $0xa
+     d16:	50                   	push   %eax
+     d17:	ff 75 08             	push   0x8(%ebp)
+     d1a:	e8 c3 fe ff ff       	call   be2 <printint>
+     d1f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     d22:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     d26:	e9 d8 00 00 00       	jmp    e03 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+     d2b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     d2f:	74 06                	je     d37 <printf+0xa4>
+     d31:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     d35:	75 1e                	jne    d55 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+     d37:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d3a:	8b 00                	mov    (%eax),%eax
+     d3c:	6a 00                	push   $0x0
+     d3e:	6a 10                	push   $0x10
+     d40:	50                   	push   %eax
+     d41:	ff 75 08             	push   0x8(%ebp)
+     d44:	e8 99 fe ff ff       	call   be2 <printint>
+     d49:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     d4c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     d50:	e9 ae 00 00 00       	jmp    e03 <printf+0x170>
+      } else if(c == 's'){
+     d55:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     d59:	75 43                	jne    d9e <printf+0x10b>
+        s = (char*)*ap;
+     d5b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d5e:	8b 00                	mov    (%eax),%eax
+     d60:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     d63:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     d67:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     d6b:	75 25                	jne    d92 <printf+0xff>
+          s = "(null)";
+     d6d:	c7 45 f4 4f 17 00 00 	movl   $0x174f,-0xc(%ebp)
+        while(*s != 0){
+     d74:	eb 1c                	jmp    d92 <printf+0xff>
+          putc(fd, *s);
+     d76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d79:	0f b6 00             	movzbl (%eax),%eax
+     d7c:	0f be c0             	movsbl %al,%eax
+     d7f:	83 ec 08             	sub    $0x8,%esp
+     d82:	50                   	push   %eax
+     d83:	ff 75 08             	push   0x8(%ebp)
+     d86:	e8 34 fe ff ff       	call   bbf <putc>
+     d8b:	83 c4 10             	add    $0x10,%esp
+          s++;
+     d8e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     d92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d95:	0f b6 00             	movzbl (%eax),%eax
+     d98:	84 c0                	test   %al,%al
+     d9a:	75 da                	jne    d76 <printf+0xe3>
+     d9c:	eb 65                	jmp    e03 <printf+0x170>
+        }
+      } else if(c == 'c'){
+     d9e:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     da2:	75 1d                	jne    dc1 <printf+0x12e>
+        putc(fd, *ap);
+     da4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     da7:	8b 00                	mov    (%eax),%eax
+     da9:	0f be c0             	movsbl %al,%eax
+     dac:	83 ec 08             	sub    $0x8,%esp
+     daf:	50                   	push   %eax
+     db0:	ff 75 08             	push   0x8(%ebp)
+     db3:	e8 07 fe ff ff       	call   bbf <putc>
+     db8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     dbb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     dbf:	eb 42                	jmp    e03 <printf+0x170>
+      } else if(c == '%'){
+     dc1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     dc5:	75 17                	jne    dde <printf+0x14b>
+        putc(fd, c);
+     dc7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     dca:	0f be c0             	movsbl %al,%eax
+     dcd:	83 ec 08             	sub    $0x8,%esp
+     dd0:	50                   	push   %eax
+     dd1:	ff 75 08             	push   0x8(%ebp)
+     dd4:	e8 e6 fd ff ff       	call   bbf <putc>
+     dd9:	83 c4 10             	add    $0x10,%esp
+     ddc:	eb 25                	jmp    e03 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     dde:	83 ec 08             	sub    $0x8,%esp
+     de1:	6a 25                	push   $0x25
+     de3:	ff 75 08             	push   0x8(%ebp)
+     de6:	e8 d4 fd ff ff       	call   bbf <putc>
+     deb:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+     dee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     df1:	0f be c0             	movsbl %al,%eax
+     df4:	83 ec 08             	sub    $0x8,%esp
+     df7:	50                   	push   %eax
+     df8:	ff 75 08             	push   0x8(%ebp)
+     dfb:	e8 bf fd ff ff       	call   bbf <putc>
+     e00:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     e03:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     e0a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     e0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+     e11:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e14:	01 d0                	add    %edx,%eax
+     e16:	0f b6 00             	movzbl (%eax),%eax
+     e19:	84 c0                	test   %al,%al
+     e1b:	0f 85 94 fe ff ff    	jne    cb5 <printf+0x22>
+    }
+  }
+}
+     e21:	90                   	nop
+     e22:	90                   	nop
+     e23:	c9                   	leave
+     e24:	c3                   	ret
+
+00000e25 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     e25:	55                   	push   %ebp
+     e26:	89 e5                	mov    %esp,%ebp
+     e28:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     e2b:	8b 45 08             	mov    0x8(%ebp),%eax
+     e2e:	83 e8 08             	sub    $0x8,%eax
+     e31:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e34:	a1 48 1c 00 00       	mov    0x1c48,%eax
+     e39:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     e3c:	eb 24                	jmp    e62 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e3e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e41:	8b 00                	mov    (%eax),%eax
+     e43:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e46:	72 12                	jb     e5a <free+0x35>
+     e48:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e4b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e4e:	72 24                	jb     e74 <free+0x4f>
+     e50:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e53:	8b 00                	mov    (%eax),%eax
+     e55:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     e58:	72 1a                	jb     e74 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e5a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e5d:	8b 00                	mov    (%eax),%eax
+     e5f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     e62:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e65:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e68:	73 d4                	jae    e3e <free+0x19>
+     e6a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e6d:	8b 00                	mov    (%eax),%eax
+     e6f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     e72:	73 ca                	jae    e3e <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e74:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e77:	8b 40 04             	mov    0x4(%eax),%eax
+     e7a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     e81:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e84:	01 c2                	add    %eax,%edx
+     e86:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e89:	8b 00                	mov    (%eax),%eax
+     e8b:	39 c2                	cmp    %eax,%edx
+     e8d:	75 24                	jne    eb3 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+     e8f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e92:	8b 50 04             	mov    0x4(%eax),%edx
+     e95:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e98:	8b 00                	mov    (%eax),%eax
+     e9a:	8b 40 04             	mov    0x4(%eax),%eax
+     e9d:	01 c2                	add    %eax,%edx
+     e9f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     ea2:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ea5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ea8:	8b 00                	mov    (%eax),%eax
+     eaa:	8b 10                	mov    (%eax),%edx
+     eac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     eaf:	89 10                	mov    %edx,(%eax)
+     eb1:	eb 0a                	jmp    ebd <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+     eb3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     eb6:	8b 10                	mov    (%eax),%edx
+     eb8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     ebb:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     ebd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ec0:	8b 40 04             	mov    0x4(%eax),%eax
+     ec3:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     eca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ecd:	01 d0                	add    %edx,%eax
+     ecf:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     ed2:	75 20                	jne    ef4 <free+0xcf>
+    p->s.size += bp->s.size;
+     ed4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ed7:	8b 50 04             	mov    0x4(%eax),%edx
+     eda:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     edd:	8b 40 04             	mov    0x4(%eax),%eax
+     ee0:	01 c2                	add    %eax,%edx
+     ee2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ee5:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     ee8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     eeb:	8b 10                	mov    (%eax),%edx
+     eed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ef0:	89 10                	mov    %edx,(%eax)
+     ef2:	eb 08                	jmp    efc <free+0xd7>
+  } else
+    p->s.ptr = bp;
+     ef4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ef7:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     efa:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     efc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     eff:	a3 48 1c 00 00       	mov    %eax,0x1c48
+}
+     f04:	90                   	nop
+     f05:	c9                   	leave
+     f06:	c3                   	ret
+
+00000f07 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     f07:	55                   	push   %ebp
+     f08:	89 e5                	mov    %esp,%ebp
+     f0a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     f0d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     f14:	77 07                	ja     f1d <morecore+0x16>
+    nu = 4096;
+     f16:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+     f20:	c1 e0 03             	shl    $0x3,%eax
+     f23:	83 ec 0c             	sub    $0xc,%esp
+     f26:	50                   	push   %eax
+     f27:	e8 83 fb ff ff       	call   aaf <sbrk>
+     f2c:	83 c4 10             	add    $0x10,%esp
+     f2f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     f32:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     f36:	75 07                	jne    f3f <morecore+0x38>
+    return 0;
+     f38:	b8 00 00 00 00       	mov    $0x0,%eax
+     f3d:	eb 26                	jmp    f65 <morecore+0x5e>
+  hp = (Header*)p;
+     f3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f42:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     f45:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f48:	8b 55 08             	mov    0x8(%ebp),%edx
+     f4b:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+     f4e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f51:	83 c0 08             	add    $0x8,%eax
+     f54:	83 ec 0c             	sub    $0xc,%esp
+     f57:	50                   	push   %eax
+     f58:	e8 c8 fe ff ff       	call   e25 <free>
+     f5d:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     f60:	a1 48 1c 00 00       	mov    0x1c48,%eax
+}
+     f65:	c9                   	leave
+     f66:	c3                   	ret
+
+00000f67 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     f67:	55                   	push   %ebp
+     f68:	89 e5                	mov    %esp,%ebp
+     f6a:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f6d:	8b 45 08             	mov    0x8(%ebp),%eax
+     f70:	83 c0 07             	add    $0x7,%eax
+     f73:	c1 e8 03             	shr    $0x3,%eax
+     f76:	83 c0 01             	add    $0x1,%eax
+     f79:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+     f7c:	a1 48 1c 00 00       	mov    0x1c48,%eax
+     f81:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f84:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f88:	75 23                	jne    fad <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+     f8a:	c7 45 f0 40 1c 00 00 	movl   $0x1c40,-0x10(%ebp)
+     f91:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f94:	a3 48 1c 00 00       	mov    %eax,0x1c48
+     f99:	a1 48 1c 00 00       	mov    0x1c48,%eax
+     f9e:	a3 40 1c 00 00       	mov    %eax,0x1c40
+    base.s.size = 0;
+     fa3:	c7 05 44 1c 00 00 00 	movl   $0x0,0x1c44
+     faa:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fb0:	8b 00                	mov    (%eax),%eax
+     fb2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     fb5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fb8:	8b 40 04             	mov    0x4(%eax),%eax
+     fbb:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     fbe:	72 4d                	jb     100d <malloc+0xa6>
+      if(p->s.size == nunits)
+     fc0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fc3:	8b 40 04             	mov    0x4(%eax),%eax
+     fc6:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     fc9:	75 0c                	jne    fd7 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+     fcb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fce:	8b 10                	mov    (%eax),%edx
+     fd0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fd3:	89 10                	mov    %edx,(%eax)
+     fd5:	eb 26                	jmp    ffd <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+     fd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fda:	8b 40 04             	mov    0x4(%eax),%eax
+     fdd:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     fe0:	89 c2                	mov    %eax,%edx
+     fe2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fe5:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+     fe8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     feb:	8b 40 04             	mov    0x4(%eax),%eax
+     fee:	c1 e0 03             	shl    $0x3,%eax
+     ff1:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+     ff4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ff7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     ffa:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+     ffd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1000:	a3 48 1c 00 00       	mov    %eax,0x1c48
+      return (void*)(p + 1);
+    1005:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1008:	83 c0 08             	add    $0x8,%eax
+    100b:	eb 3b                	jmp    1048 <malloc+0xe1>
+    }
+    if(p == freep)
+    100d:	a1 48 1c 00 00       	mov    0x1c48,%eax
+    1012:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1015:	75 1e                	jne    1035 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    1017:	83 ec 0c             	sub    $0xc,%esp
+    101a:	ff 75 ec             	push   -0x14(%ebp)
+    101d:	e8 e5 fe ff ff       	call   f07 <morecore>
+    1022:	83 c4 10             	add    $0x10,%esp
+    1025:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1028:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    102c:	75 07                	jne    1035 <malloc+0xce>
+        return 0;
+    102e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1033:	eb 13                	jmp    1048 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1035:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1038:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    103b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    103e:	8b 00                	mov    (%eax),%eax
+    1040:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1043:	e9 6d ff ff ff       	jmp    fb5 <malloc+0x4e>
+  }
+}
+    1048:	c9                   	leave
+    1049:	c3                   	ret
+
+0000104a <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+    104a:	55                   	push   %ebp
+    104b:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    104d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1050:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1056:	90                   	nop
+    1057:	5d                   	pop    %ebp
+    1058:	c3                   	ret
+
+00001059 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+    1059:	55                   	push   %ebp
+    105a:	89 e5                	mov    %esp,%ebp
+    105c:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    105f:	8b 55 08             	mov    0x8(%ebp),%edx
+    1062:	b8 00 00 00 00       	mov    $0x0,%eax
+    1067:	b9 01 00 00 00       	mov    $0x1,%ecx
+    106c:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+    1070:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1073:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1077:	74 3b                	je     10b4 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+    1079:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+    107d:	74 2d                	je     10ac <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+    107f:	8b 55 08             	mov    0x8(%ebp),%edx
+    1082:	b8 02 00 00 00       	mov    $0x2,%eax
+    1087:	87 02                	xchg   %eax,(%edx)
+    1089:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+    108c:	eb 1e                	jmp    10ac <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+    108e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1091:	83 ec 08             	sub    $0x8,%esp
+    1094:	6a 02                	push   $0x2
+    1096:	50                   	push   %eax
+    1097:	e8 f3 fa ff ff       	call   b8f <futex_wait>
+    109c:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+    109f:	8b 55 08             	mov    0x8(%ebp),%edx
+    10a2:	b8 02 00 00 00       	mov    $0x2,%eax
+    10a7:	87 02                	xchg   %eax,(%edx)
+    10a9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+    10ac:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    10b0:	75 dc                	jne    108e <mutex_lock+0x35>
+    10b2:	eb 01                	jmp    10b5 <mutex_lock+0x5c>
+    return;
+    10b4:	90                   	nop
+  }
+}
+    10b5:	c9                   	leave
+    10b6:	c3                   	ret
+
+000010b7 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+    10b7:	55                   	push   %ebp
+    10b8:	89 e5                	mov    %esp,%ebp
+    10ba:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    10bd:	8b 45 08             	mov    0x8(%ebp),%eax
+    10c0:	ba 01 00 00 00       	mov    $0x1,%edx
+    10c5:	f7 da                	neg    %edx
+    10c7:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    10cb:	83 fa 01             	cmp    $0x1,%edx
+    10ce:	74 1a                	je     10ea <mutex_unlock+0x33>
+    m->state = 0;
+    10d0:	8b 45 08             	mov    0x8(%ebp),%eax
+    10d3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    10d9:	8b 45 08             	mov    0x8(%ebp),%eax
+    10dc:	83 ec 08             	sub    $0x8,%esp
+    10df:	6a 01                	push   $0x1
+    10e1:	50                   	push   %eax
+    10e2:	e8 b0 fa ff ff       	call   b97 <futex_wake>
+    10e7:	83 c4 10             	add    $0x10,%esp
+  }
+}
+    10ea:	90                   	nop
+    10eb:	c9                   	leave
+    10ec:	c3                   	ret
+
+000010ed <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+    10ed:	55                   	push   %ebp
+    10ee:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+    10f0:	8b 45 08             	mov    0x8(%ebp),%eax
+    10f3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+    10f9:	8b 45 08             	mov    0x8(%ebp),%eax
+    10fc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+    1103:	90                   	nop
+    1104:	5d                   	pop    %ebp
+    1105:	c3                   	ret
+
+00001106 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+    1106:	55                   	push   %ebp
+    1107:	89 e5                	mov    %esp,%ebp
+    1109:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+    110c:	8b 45 08             	mov    0x8(%ebp),%eax
+    110f:	83 c0 04             	add    $0x4,%eax
+    1112:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+    1116:	8b 45 08             	mov    0x8(%ebp),%eax
+    1119:	83 ec 08             	sub    $0x8,%esp
+    111c:	ff 75 0c             	push   0xc(%ebp)
+    111f:	50                   	push   %eax
+    1120:	e8 6a fa ff ff       	call   b8f <futex_wait>
+    1125:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+    1128:	8b 45 08             	mov    0x8(%ebp),%eax
+    112b:	83 c0 04             	add    $0x4,%eax
+    112e:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+    1132:	90                   	nop
+    1133:	c9                   	leave
+    1134:	c3                   	ret
+
+00001135 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+    1135:	55                   	push   %ebp
+    1136:	89 e5                	mov    %esp,%ebp
+    1138:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+    113b:	8b 45 08             	mov    0x8(%ebp),%eax
+    113e:	8b 00                	mov    (%eax),%eax
+    1140:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+    1143:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1147:	78 17                	js     1160 <rwlock_rdlock+0x2b>
+    1149:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    114c:	83 c0 01             	add    $0x1,%eax
+    114f:	89 c1                	mov    %eax,%ecx
+    1151:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1154:	8b 55 08             	mov    0x8(%ebp),%edx
+    1157:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+    115b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    115e:	74 19                	je     1179 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+    1160:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1164:	79 d5                	jns    113b <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+    1166:	83 ec 08             	sub    $0x8,%esp
+    1169:	ff 75 f4             	push   -0xc(%ebp)
+    116c:	ff 75 08             	push   0x8(%ebp)
+    116f:	e8 92 ff ff ff       	call   1106 <rwlock_sleep>
+    1174:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+    1177:	eb c2                	jmp    113b <rwlock_rdlock+0x6>
+      return;
+    1179:	90                   	nop
+  }
+}
+    117a:	c9                   	leave
+    117b:	c3                   	ret
+
+0000117c <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+    117c:	55                   	push   %ebp
+    117d:	89 e5                	mov    %esp,%ebp
+    117f:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+    1182:	eb 11                	jmp    1195 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+    1184:	83 ec 08             	sub    $0x8,%esp
+    1187:	ff 75 f4             	push   -0xc(%ebp)
+    118a:	ff 75 08             	push   0x8(%ebp)
+    118d:	e8 74 ff ff ff       	call   1106 <rwlock_sleep>
+    1192:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+    1195:	8b 55 08             	mov    0x8(%ebp),%edx
+    1198:	b8 00 00 00 00       	mov    $0x0,%eax
+    119d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+    11a2:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+    11a6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    11a9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    11ad:	75 d5                	jne    1184 <rwlock_wrlock+0x8>
+}
+    11af:	90                   	nop
+    11b0:	90                   	nop
+    11b1:	c9                   	leave
+    11b2:	c3                   	ret
+
+000011b3 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+    11b3:	55                   	push   %ebp
+    11b4:	89 e5                	mov    %esp,%ebp
+    11b6:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+    11b9:	8b 45 08             	mov    0x8(%ebp),%eax
+    11bc:	8b 00                	mov    (%eax),%eax
+    11be:	85 c0                	test   %eax,%eax
+    11c0:	79 0c                	jns    11ce <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+    11c2:	8b 45 08             	mov    0x8(%ebp),%eax
+    11c5:	ba 00 00 00 00       	mov    $0x0,%edx
+    11ca:	87 10                	xchg   %edx,(%eax)
+    11cc:	eb 18                	jmp    11e6 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+    11ce:	8b 55 08             	mov    0x8(%ebp),%edx
+    11d1:	b8 01 00 00 00       	mov    $0x1,%eax
+    11d6:	f7 d8                	neg    %eax
+    11d8:	89 c1                	mov    %eax,%ecx
+    11da:	89 c8                	mov    %ecx,%eax
+    11dc:	f0 0f c1 02          	lock xadd %eax,(%edx)
+    11e0:	01 c8                	add    %ecx,%eax
+    11e2:	85 c0                	test   %eax,%eax
+    11e4:	75 20                	jne    1206 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+    11e6:	8b 45 08             	mov    0x8(%ebp),%eax
+    11e9:	8b 40 04             	mov    0x4(%eax),%eax
+    11ec:	85 c0                	test   %eax,%eax
+    11ee:	74 17                	je     1207 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+    11f0:	8b 45 08             	mov    0x8(%ebp),%eax
+    11f3:	83 ec 08             	sub    $0x8,%esp
+    11f6:	68 ff ff ff 7f       	push   $0x7fffffff
+    11fb:	50                   	push   %eax
+    11fc:	e8 96 f9 ff ff       	call   b97 <futex_wake>
+    1201:	83 c4 10             	add    $0x10,%esp
+    1204:	eb 01                	jmp    1207 <rwlock_unlock+0x54>
+    return;
+    1206:	90                   	nop
+}
+    1207:	c9                   	leave
+    1208:	c3                   	ret
+
+00001209 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+    1209:	55                   	push   %ebp
+    120a:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    120c:	8b 45 08             	mov    0x8(%ebp),%eax
+    120f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1215:	90                   	nop
+    1216:	5d                   	pop    %ebp
+    1217:	c3                   	ret
+
+00001218 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+    1218:	55                   	push   %ebp
+    1219:	89 e5                	mov    %esp,%ebp
+    121b:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+    121e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1221:	8b 00                	mov    (%eax),%eax
+    1223:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+    1226:	83 ec 0c             	sub    $0xc,%esp
+    1229:	ff 75 0c             	push   0xc(%ebp)
+    122c:	e8 86 fe ff ff       	call   10b7 <mutex_unlock>
+    1231:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+    1234:	8b 45 08             	mov    0x8(%ebp),%eax
+    1237:	83 ec 08             	sub    $0x8,%esp
+    123a:	ff 75 f4             	push   -0xc(%ebp)
+    123d:	50                   	push   %eax
+    123e:	e8 4c f9 ff ff       	call   b8f <futex_wait>
+    1243:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+    1246:	83 ec 0c             	sub    $0xc,%esp
+    1249:	ff 75 0c             	push   0xc(%ebp)
+    124c:	e8 08 fe ff ff       	call   1059 <mutex_lock>
+    1251:	83 c4 10             	add    $0x10,%esp
+}
+    1254:	90                   	nop
+    1255:	c9                   	leave
+    1256:	c3                   	ret
+
+00001257 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+    1257:	55                   	push   %ebp
+    1258:	89 e5                	mov    %esp,%ebp
+    125a:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+    125d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1260:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    1264:	8b 45 08             	mov    0x8(%ebp),%eax
+    1267:	83 ec 08             	sub    $0x8,%esp
+    126a:	6a 01                	push   $0x1
+    126c:	50                   	push   %eax
+    126d:	e8 25 f9 ff ff       	call   b97 <futex_wake>
+    1272:	83 c4 10             	add    $0x10,%esp
+}
+    1275:	90                   	nop
+    1276:	c9                   	leave
+    1277:	c3                   	ret
+
+00001278 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+    1278:	55                   	push   %ebp
+    1279:	89 e5                	mov    %esp,%ebp
+    127b:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+    127e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1281:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+    1285:	8b 45 08             	mov    0x8(%ebp),%eax
+    1288:	83 ec 08             	sub    $0x8,%esp
+    128b:	68 ff ff ff 7f       	push   $0x7fffffff
+    1290:	50                   	push   %eax
+    1291:	e8 01 f9 ff ff       	call   b97 <futex_wake>
+    1296:	83 c4 10             	add    $0x10,%esp
+}
+    1299:	90                   	nop
+    129a:	c9                   	leave
+    129b:	c3                   	ret
@@ -9,6 +9,9 @@ void help()
     printf(1, "    change_queue <pid> <new_queue>\n");
     printf(1, "    set_bjf_process <pid> <priority_ratio> <arrival_time_ratio> <executed_cycles_ratio> <process_size_ratio>\n");
     printf(1, "    set_bjf_system <priority_ratio> <arrival_time_ratio> <executed_cycles_ratio> <process_size_ratio>\n");
+    printf(1, "    set_affinity <pid> <cpu_mask>\n");
+    printf(1, "    setsched <pid> <class>    (0: normal, 1: interactive)\n");
+    printf(1, "    set_quantum <queue> <ticks>\n");
 }
 
 void set_queue(int pid, int new_queue)
@@ -24,6 +27,38 @@ void set_queue(int pid, int new_queue)
         printf(1, "your process with id %d has changed queue from: %d -> %d\n", pid, result, new_queue);
 }
 
+void set_cpu_affinity(int pid, int mask)
+{
+    if (pid < 1)
+        printf(1, "pid cannot be less than 1\n");
+    if (set_affinity(pid, mask) < 0)
+        printf(1, "error in setting cpu affinity\n");
+    else
+        printf(1, "the process with id %d may now run on cpu mask %d\n", pid, mask);
+}
+
+void set_sched_class(int pid, int sched_class)
+{
+    if (pid < 1)
+        printf(1, "pid cannot be less than 1\n");
+    if (setsched(pid, sched_class) < 0)
+        printf(1, "error in setting scheduling class\n");
+    else
+        printf(1, "the process with id %d is now in scheduling class %d\n", pid, sched_class);
+}
+
+void set_queue_quantum(int queue, int nticks)
+{
+    if (queue < 1 || queue > 3)
+        printf(1, "queue number should be in range [1, 3]\n");
+    if (nticks < 1)
+        printf(1, "quantum cannot be less than 1 tick\n");
+    if (set_quantum(queue, nticks) < 0)
+        printf(1, "error in setting quantum\n");
+    else
+        printf(1, "queue %d now runs for %d ticks before preemption\n", queue, nticks);
+}
+
 void set_bjf_process_params(int pid, float priority_ratio, float arrival_time_ratio, float executed_cycles_ratio, float process_size_ratio)
 {
     if (pid < 1)
@@ -63,6 +98,12 @@ int main(int argc, char *argv[])
     {
         if (!strcmp(argv[1], "change_queue"))
             set_queue(atoi(argv[2]), atoi(argv[3]));
+        else if (!strcmp(argv[1], "set_affinity"))
+            set_cpu_affinity(atoi(argv[2]), atoi(argv[3]));
+        else if (!strcmp(argv[1], "setsched"))
+            set_sched_class(atoi(argv[2]), atoi(argv[3]));
+        else if (!strcmp(argv[1], "set_quantum"))
+            set_queue_quantum(atoi(argv[2]), atoi(argv[3]));
         else
             help();
     }
@@ -0,0 +1,1773 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "Usage: rm files...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 36 0c 00 00       	push   $0xc36
+  21:	6a 02                	push   $0x2
+  23:	e8 05 06 00 00       	call   62d <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 91 03 00 00       	call   3c1 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 4b                	jmp    84 <main+0x84>
+    if(unlink(argv[i]) < 0){
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 be 03 00 00       	call   411 <unlink>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 26                	jns    80 <main+0x80>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  64:	8b 43 04             	mov    0x4(%ebx),%eax
+  67:	01 d0                	add    %edx,%eax
+  69:	8b 00                	mov    (%eax),%eax
+  6b:	83 ec 04             	sub    $0x4,%esp
+  6e:	50                   	push   %eax
+  6f:	68 4a 0c 00 00       	push   $0xc4a
+  74:	6a 02                	push   $0x2
+  76:	e8 b2 05 00 00       	call   62d <printf>
+  7b:	83 c4 10             	add    $0x10,%esp
+      break;
+  7e:	eb 0b                	jmp    8b <main+0x8b>
+  for(i = 1; i < argc; i++){
+  80:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  87:	3b 03                	cmp    (%ebx),%eax
+  89:	7c ae                	jl     39 <main+0x39>
+    }
+  }
+
+  exit();
+  8b:	e8 31 03 00 00       	call   3c1 <exit>
+
+00000090 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	53                   	push   %ebx
+{
+  95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  98:	8b 55 10             	mov    0x10(%ebp),%edx
+  9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9e:	89 cb                	mov    %ecx,%ebx
+  a0:	89 df                	mov    %ebx,%edi
+  a2:	89 d1                	mov    %edx,%ecx
+  a4:	fc                   	cld
+  a5:	f3 aa                	rep stos %al,%es:(%edi)
+  a7:	89 ca                	mov    %ecx,%edx
+  a9:	89 fb                	mov    %edi,%ebx
+  ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  ae:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+  b1:	90                   	nop
+  b2:	5b                   	pop    %ebx
+  b3:	5f                   	pop    %edi
+  b4:	5d                   	pop    %ebp
+  b5:	c3                   	ret
+
+000000b6 <strcpy>:
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  c2:	90                   	nop
+  c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  c6:	8d 42 01             	lea    0x1(%edx),%eax
+  c9:	89 45 0c             	mov    %eax,0xc(%ebp)
+  cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  cf:	8d 48 01             	lea    0x1(%eax),%ecx
+  d2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  d5:	0f b6 12             	movzbl (%edx),%edx
+  d8:	88 10                	mov    %dl,(%eax)
+  da:	0f b6 00             	movzbl (%eax),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	75 e2                	jne    c3 <strcpy+0xd>
+  return os;
+  e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+
+000000e6 <strcmp>:
+{
+  e6:	55                   	push   %ebp
+  e7:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  e9:	eb 08                	jmp    f3 <strcmp+0xd>
+    p++, q++;
+  eb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  ef:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 00             	movzbl (%eax),%eax
+  f9:	84 c0                	test   %al,%al
+  fb:	74 10                	je     10d <strcmp+0x27>
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 100:	0f b6 10             	movzbl (%eax),%edx
+ 103:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 106:	0f b6 00             	movzbl (%eax),%eax
+ 109:	38 c2                	cmp    %al,%dl
+ 10b:	74 de                	je     eb <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 10d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 110:	0f b6 00             	movzbl (%eax),%eax
+ 113:	0f b6 d0             	movzbl %al,%edx
+ 116:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 119:	0f b6 00             	movzbl (%eax),%eax
+ 11c:	0f b6 c0             	movzbl %al,%eax
+ 11f:	29 c2                	sub    %eax,%edx
+ 121:	89 d0                	mov    %edx,%eax
+}
+ 123:	5d                   	pop    %ebp
+ 124:	c3                   	ret
+
+00000125 <strlen>:
+{
+ 125:	55                   	push   %ebp
+ 126:	89 e5                	mov    %esp,%ebp
+ 128:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 12b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 132:	eb 04                	jmp    138 <strlen+0x13>
+ 134:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 138:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 13b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 13e:	01 d0                	add    %edx,%eax
+ 140:	0f b6 00             	movzbl (%eax),%eax
+ 143:	84 c0                	test   %al,%al
+ 145:	75 ed                	jne    134 <strlen+0xf>
+  return n;
+ 147:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 14a:	c9                   	leave
+ 14b:	c3                   	ret
+
+0000014c <memset>:
+{
+ 14c:	55                   	push   %ebp
+ 14d:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 14f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 152:	50                   	push   %eax
+ 153:	ff 75 0c             	push   0xc(%ebp)
+ 156:	ff 75 08             	push   0x8(%ebp)
+ 159:	e8 32 ff ff ff       	call   90 <stosb>
+ 15e:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 164:	c9                   	leave
+ 165:	c3                   	ret
+
+00000166 <strchr>:
+{
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	83 ec 04             	sub    $0x4,%esp
+ 16c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16f:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 172:	eb 14                	jmp    188 <strchr+0x22>
+    if(*s == c)
+ 174:	8b 45 08             	mov    0x8(%ebp),%eax
+ 177:	0f b6 00             	movzbl (%eax),%eax
+ 17a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 17d:	75 05                	jne    184 <strchr+0x1e>
+      return (char*)s;
+ 17f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 182:	eb 13                	jmp    197 <strchr+0x31>
+  for(; *s; s++)
+ 184:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 188:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18b:	0f b6 00             	movzbl (%eax),%eax
+ 18e:	84 c0                	test   %al,%al
+ 190:	75 e2                	jne    174 <strchr+0xe>
+  return 0;
+ 192:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+
+00000199 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 199:	55                   	push   %ebp
+ 19a:	89 e5                	mov    %esp,%ebp
+ 19c:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 19f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1a6:	eb 42                	jmp    1ea <gets+0x51>
+    cc = read(0, &c, 1);
+ 1a8:	83 ec 04             	sub    $0x4,%esp
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1b0:	50                   	push   %eax
+ 1b1:	6a 00                	push   $0x0
+ 1b3:	e8 21 02 00 00       	call   3d9 <read>
+ 1b8:	83 c4 10             	add    $0x10,%esp
+ 1bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1be:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1c2:	7e 33                	jle    1f7 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c7:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ca:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1cd:	89 c2                	mov    %eax,%edx
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	01 c2                	add    %eax,%edx
+ 1d4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1d8:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1da:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1de:	3c 0a                	cmp    $0xa,%al
+ 1e0:	74 16                	je     1f8 <gets+0x5f>
+ 1e2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1e6:	3c 0d                	cmp    $0xd,%al
+ 1e8:	74 0e                	je     1f8 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ed:	83 c0 01             	add    $0x1,%eax
+ 1f0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1f3:	7f b3                	jg     1a8 <gets+0xf>
+ 1f5:	eb 01                	jmp    1f8 <gets+0x5f>
+      break;
+ 1f7:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fe:	01 d0                	add    %edx,%eax
+ 200:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 206:	c9                   	leave
+ 207:	c3                   	ret
+
+00000208 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 208:	55                   	push   %ebp
+ 209:	89 e5                	mov    %esp,%ebp
+ 20b:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 20e:	83 ec 08             	sub    $0x8,%esp
+ 211:	6a 00                	push   $0x0
+ 213:	ff 75 08             	push   0x8(%ebp)
+ 216:	e8 e6 01 00 00       	call   401 <open>
+ 21b:	83 c4 10             	add    $0x10,%esp
+ 21e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 221:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 225:	79 07                	jns    22e <stat+0x26>
+    return -1;
+ 227:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 22c:	eb 25                	jmp    253 <stat+0x4b>
+  r = fstat(fd, st);
+ 22e:	83 ec 08             	sub    $0x8,%esp
+ 231:	ff 75 0c             	push   0xc(%ebp)
+ 234:	ff 75 f4             	push   -0xc(%ebp)
+ 237:	e8 dd 01 00 00       	call   419 <fstat>
+ 23c:	83 c4 10             	add    $0x10,%esp
+ 23f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 242:	83 ec 0c             	sub    $0xc,%esp
+ 245:	ff 75 f4             	push   -0xc(%ebp)
+ 248:	e8 9c 01 00 00       	call   3e9 <close>
+ 24d:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 250:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+
+00000255 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 255:	55                   	push   %ebp
+ 256:	89 e5                	mov    %esp,%ebp
+ 258:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 25b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 262:	eb 25                	jmp    289 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 264:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 267:	89 d0                	mov    %edx,%eax
+ 269:	c1 e0 02             	shl    $0x2,%eax
+ 26c:	01 d0                	add    %edx,%eax
+ 26e:	01 c0                	add    %eax,%eax
+ 270:	89 c1                	mov    %eax,%ecx
+ 272:	8b 45 08             	mov    0x8(%ebp),%eax
+ 275:	8d 50 01             	lea    0x1(%eax),%edx
+ 278:	89 55 08             	mov    %edx,0x8(%ebp)
+ 27b:	0f b6 00             	movzbl (%eax),%eax
+ 27e:	0f be c0             	movsbl %al,%eax
+ 281:	01 c8                	add    %ecx,%eax
+ 283:	83 e8 30             	sub    $0x30,%eax
+ 286:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 289:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28c:	0f b6 00             	movzbl (%eax),%eax
+ 28f:	3c 2f                	cmp    $0x2f,%al
+ 291:	7e 0a                	jle    29d <atoi+0x48>
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	0f b6 00             	movzbl (%eax),%eax
+ 299:	3c 39                	cmp    $0x39,%al
+ 29b:	7e c7                	jle    264 <atoi+0xf>
+  return n;
+ 29d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2a0:	c9                   	leave
+ 2a1:	c3                   	ret
+
+000002a2 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2a2:	55                   	push   %ebp
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 2a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2b4:	eb 17                	jmp    2cd <memmove+0x2b>
+    *dst++ = *src++;
+ 2b6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2b9:	8d 42 01             	lea    0x1(%edx),%eax
+ 2bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2c2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2c5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2c8:	0f b6 12             	movzbl (%edx),%edx
+ 2cb:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2cd:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2d0:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2d3:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2d6:	85 c0                	test   %eax,%eax
+ 2d8:	7f dc                	jg     2b6 <memmove+0x14>
+  return vdst;
+ 2da:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2dd:	c9                   	leave
+ 2de:	c3                   	ret
+
+000002df <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 2df:	55                   	push   %ebp
+ 2e0:	89 e5                	mov    %esp,%ebp
+ 2e2:	57                   	push   %edi
+ 2e3:	56                   	push   %esi
+ 2e4:	83 ec 30             	sub    $0x30,%esp
+ 2e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ea:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 2ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2f0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 2f3:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 2fa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 301:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 304:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 307:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 30a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 30d:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 314:	e9 89 00 00 00       	jmp    3a2 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 319:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 31c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 31f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 323:	01 c0                	add    %eax,%eax
+ 325:	89 c6                	mov    %eax,%esi
+ 327:	89 d7                	mov    %edx,%edi
+ 329:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 32c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 32f:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 332:	0f ad d0             	shrd   %cl,%edx,%eax
+ 335:	d3 ea                	shr    %cl,%edx
+ 337:	f6 c1 20             	test   $0x20,%cl
+ 33a:	74 04                	je     340 <udiv64+0x61>
+ 33c:	89 d0                	mov    %edx,%eax
+ 33e:	31 d2                	xor    %edx,%edx
+ 340:	83 e0 01             	and    $0x1,%eax
+ 343:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 346:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 34d:	89 f0                	mov    %esi,%eax
+ 34f:	89 fa                	mov    %edi,%edx
+ 351:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 354:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 357:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 35a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 35d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 360:	ba 00 00 00 00       	mov    $0x0,%edx
+ 365:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 368:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 36b:	19 d1                	sbb    %edx,%ecx
+ 36d:	72 2f                	jb     39e <udiv64+0xbf>
+      r -= d;
+ 36f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 372:	ba 00 00 00 00       	mov    $0x0,%edx
+ 377:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 37a:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 37d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 380:	b8 01 00 00 00       	mov    $0x1,%eax
+ 385:	ba 00 00 00 00       	mov    $0x0,%edx
+ 38a:	0f a5 c2             	shld   %cl,%eax,%edx
+ 38d:	d3 e0                	shl    %cl,%eax
+ 38f:	f6 c1 20             	test   $0x20,%cl
+ 392:	74 04                	je     398 <udiv64+0xb9>
+ 394:	89 c2                	mov    %eax,%edx
+ 396:	31 c0                	xor    %eax,%eax
+ 398:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 39b:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 39e:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 3a2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 3a6:	0f 89 6d ff ff ff    	jns    319 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 3ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 3af:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 3b2:	83 c4 30             	add    $0x30,%esp
+ 3b5:	5e                   	pop    %esi
+ 3b6:	5f                   	pop    %edi
+ 3b7:	5d                   	pop    %ebp
+ 3b8:	c3                   	ret
+
+000003b9 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3b9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <exit>:
+SYSCALL(exit)
+ 3c1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c6:	cd 40                	int    $0x40
+ 3c8:	c3                   	ret
+
+000003c9 <wait>:
+SYSCALL(wait)
+ 3c9:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+000003d1 <pipe>:
+SYSCALL(pipe)
+ 3d1:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3d6:	cd 40                	int    $0x40
+ 3d8:	c3                   	ret
+
+000003d9 <read>:
+SYSCALL(read)
+ 3d9:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3de:	cd 40                	int    $0x40
+ 3e0:	c3                   	ret
+
+000003e1 <write>:
+SYSCALL(write)
+ 3e1:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3e6:	cd 40                	int    $0x40
+ 3e8:	c3                   	ret
+
+000003e9 <close>:
+SYSCALL(close)
+ 3e9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3ee:	cd 40                	int    $0x40
+ 3f0:	c3                   	ret
+
+000003f1 <kill>:
+SYSCALL(kill)
+ 3f1:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3f6:	cd 40                	int    $0x40
+ 3f8:	c3                   	ret
+
+000003f9 <exec>:
+SYSCALL(exec)
+ 3f9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3fe:	cd 40                	int    $0x40
+ 400:	c3                   	ret
+
+00000401 <open>:
+SYSCALL(open)
+ 401:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 406:	cd 40                	int    $0x40
+ 408:	c3                   	ret
+
+00000409 <mknod>:
+SYSCALL(mknod)
+ 409:	b8 11 00 00 00       	mov    $0x11,%eax
+ 40e:	cd 40                	int    $0x40
+ 410:	c3                   	ret
+
+00000411 <unlink>:
+SYSCALL(unlink)
+ 411:	b8 12 00 00 00       	mov    $0x12,%eax
+ 416:	cd 40                	int    $0x40
+ 418:	c3                   	ret
+
+00000419 <fstat>:
+SYSCALL(fstat)
+ 419:	b8 08 00 00 00       	mov    $0x8,%eax
+ 41e:	cd 40                	int    $0x40
+ 420:	c3                   	ret
+
+00000421 <link>:
+SYSCALL(link)
+ 421:	b8 13 00 00 00       	mov    $0x13,%eax
+ 426:	cd 40                	int    $0x40
+ 428:	c3                   	ret
+
+00000429 <mkdir>:
+SYSCALL(mkdir)
+ 429:	b8 14 00 00 00       	mov    $0x14,%eax
+ 42e:	cd 40                	int    $0x40
+ 430:	c3                   	ret
+
+00000431 <chdir>:
+SYSCALL(chdir)
+ 431:	b8 09 00 00 00       	mov    $0x9,%eax
+ 436:	cd 40                	int    $0x40
+ 438:	c3                   	ret
+
+00000439 <dup>:
+SYSCALL(dup)
+ 439:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <getpid>:
+SYSCALL(getpid)
+ 441:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 446:	cd 40                	int    $0x40
+ 448:	c3                   	ret
+
+00000449 <sbrk>:
+SYSCALL(sbrk)
+ 449:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 44e:	cd 40                	int    $0x40
+ 450:	c3                   	ret
+
+00000451 <sleep>:
+SYSCALL(sleep)
+ 451:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 456:	cd 40                	int    $0x40
+ 458:	c3                   	ret
+
+00000459 <uptime>:
+SYSCALL(uptime)
+ 459:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 45e:	cd 40                	int    $0x40
+ 460:	c3                   	ret
+
+00000461 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 461:	b8 16 00 00 00       	mov    $0x16,%eax
+ 466:	cd 40                	int    $0x40
+ 468:	c3                   	ret
+
+00000469 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 469:	b8 17 00 00 00       	mov    $0x17,%eax
+ 46e:	cd 40                	int    $0x40
+ 470:	c3                   	ret
+
+00000471 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 471:	b8 18 00 00 00       	mov    $0x18,%eax
+ 476:	cd 40                	int    $0x40
+ 478:	c3                   	ret
+
+00000479 <copy_file>:
+SYSCALL(copy_file)
+ 479:	b8 19 00 00 00       	mov    $0x19,%eax
+ 47e:	cd 40                	int    $0x40
+ 480:	c3                   	ret
+
+00000481 <change_queue>:
+SYSCALL(change_queue)
+ 481:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 486:	cd 40                	int    $0x40
+ 488:	c3                   	ret
+
+00000489 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 489:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 48e:	cd 40                	int    $0x40
+ 490:	c3                   	ret
+
+00000491 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 491:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 496:	cd 40                	int    $0x40
+ 498:	c3                   	ret
+
+00000499 <print_process_info>:
+SYSCALL(print_process_info)
+ 499:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 49e:	cd 40                	int    $0x40
+ 4a0:	c3                   	ret
+
+000004a1 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 4a1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4a6:	cd 40                	int    $0x40
+ 4a8:	c3                   	ret
+
+000004a9 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 4a9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4ae:	cd 40                	int    $0x40
+ 4b0:	c3                   	ret
+
+000004b1 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 4b1:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4b6:	cd 40                	int    $0x40
+ 4b8:	c3                   	ret
+
+000004b9 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 4b9:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4be:	cd 40                	int    $0x40
+ 4c0:	c3                   	ret
+
+000004c1 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 4c1:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4c6:	cd 40                	int    $0x40
+ 4c8:	c3                   	ret
+
+000004c9 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 4c9:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4ce:	cd 40                	int    $0x40
+ 4d0:	c3                   	ret
+
+000004d1 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 4d1:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4d6:	cd 40                	int    $0x40
+ 4d8:	c3                   	ret
+
+000004d9 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 4d9:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4de:	cd 40                	int    $0x40
+ 4e0:	c3                   	ret
+
+000004e1 <set_affinity>:
+SYSCALL(set_affinity)
+ 4e1:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4e6:	cd 40                	int    $0x40
+ 4e8:	c3                   	ret
+
+000004e9 <setsched>:
+SYSCALL(setsched)
+ 4e9:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4ee:	cd 40                	int    $0x40
+ 4f0:	c3                   	ret
+
+000004f1 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 4f1:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4f6:	cd 40                	int    $0x40
+ 4f8:	c3                   	ret
+
+000004f9 <set_quantum>:
+SYSCALL(set_quantum)
+ 4f9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4fe:	cd 40                	int    $0x40
+ 500:	c3                   	ret
+
+00000501 <schedtrace>:
+SYSCALL(schedtrace)
+ 501:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 506:	cd 40                	int    $0x40
+ 508:	c3                   	ret
+
+00000509 <getrusage>:
+SYSCALL(getrusage)
+ 509:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 50e:	cd 40                	int    $0x40
+ 510:	c3                   	ret
+
+00000511 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 511:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 516:	cd 40                	int    $0x40
+ 518:	c3                   	ret
+
+00000519 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 519:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 51e:	cd 40                	int    $0x40
+ 520:	c3                   	ret
+
+00000521 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 521:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 526:	cd 40                	int    $0x40
+ 528:	c3                   	ret
+
+00000529 <futex_wait>:
+SYSCALL(futex_wait)
+ 529:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 52e:	cd 40                	int    $0x40
+ 530:	c3                   	ret
+
+00000531 <futex_wake>:
+SYSCALL(futex_wake)
+ 531:	b8 30 00 00 00       	mov    $0x30,%eax
+ 536:	cd 40                	int    $0x40
+ 538:	c3                   	ret
+
+00000539 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 539:	b8 31 00 00 00       	mov    $0x31,%eax
+ 53e:	cd 40                	int    $0x40
+ 540:	c3                   	ret
+
+00000541 <submit_batch>:
+SYSCALL(submit_batch)
+ 541:	b8 32 00 00 00       	mov    $0x32,%eax
+ 546:	cd 40                	int    $0x40
+ 548:	c3                   	ret
+
+00000549 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 549:	b8 33 00 00 00       	mov    $0x33,%eax
+ 54e:	cd 40                	int    $0x40
+ 550:	c3                   	ret
+
+00000551 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 551:	b8 34 00 00 00       	mov    $0x34,%eax
+ 556:	cd 40                	int    $0x40
+ 558:	c3                   	ret
+
+00000559 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 559:	55                   	push   %ebp
+ 55a:	89 e5                	mov    %esp,%ebp
+ 55c:	83 ec 18             	sub    $0x18,%esp
+ 55f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 562:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 565:	83 ec 04             	sub    $0x4,%esp
+ 568:	6a 01                	push   $0x1
+ 56a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 56d:	50                   	push   %eax
+ 56e:	ff 75 08             	push   0x8(%ebp)
+ 571:	e8 6b fe ff ff       	call   3e1 <write>
+ 576:	83 c4 10             	add    $0x10,%esp
+}
+ 579:	90                   	nop
+ 57a:	c9                   	leave
+ 57b:	c3                   	ret
+
+0000057c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 57c:	55                   	push   %ebp
+ 57d:	89 e5                	mov    %esp,%ebp
+ 57f:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 582:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 589:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 58d:	74 17                	je     5a6 <printint+0x2a>
+ 58f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 593:	79 11                	jns    5a6 <printint+0x2a>
+    neg = 1;
+ 595:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 59c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59f:	f7 d8                	neg    %eax
+ 5a1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5a4:	eb 06                	jmp    5ac <printint+0x30>
+  } else {
+    x = xx;
+ 5a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5b3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5b6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5b9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5be:	f7 f1                	div    %ecx
+ 5c0:	89 d1                	mov    %edx,%ecx
+ 5c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5c5:	8d 50 01             	lea    0x1(%eax),%edx
+ 5c8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5cb:	0f b6 91 5c 10 00 00 	movzbl 0x105c(%ecx),%edx
+ 5d2:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5d6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5d9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5dc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5e1:	f7 f1                	div    %ecx
+ 5e3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5ea:	75 c7                	jne    5b3 <printint+0x37>
+  if(neg)
+ 5ec:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5f0:	74 2d                	je     61f <printint+0xa3>
+    buf[i++] = '-';
+ 5f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5f5:	8d 50 01             	lea    0x1(%eax),%edx
+ 5f8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5fb:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 600:	eb 1d                	jmp    61f <printint+0xa3>
+    putc(fd, buf[i]);
+ 602:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 605:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 608:	01 d0                	add    %edx,%eax
+ 60a:	0f b6 00             	movzbl (%eax),%eax
+ 60d:	0f be c0             	movsbl %al,%eax
+ 610:	83 ec 08             	sub    $0x8,%esp
+ 613:	50                   	push   %eax
+ 614:	ff 75 08             	push   0x8(%ebp)
+ 617:	e8 3d ff ff ff       	call   559 <putc>
+ 61c:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 61f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 623:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 627:	79 d9                	jns    602 <printint+0x86>
+}
+ 629:	90                   	nop
+ 62a:	90                   	nop
+ 62b:	c9                   	leave
+ 62c:	c3                   	ret
+
+0000062d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 62d:	55                   	push   %ebp
+ 62e:	89 e5                	mov    %esp,%ebp
+ 630:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 633:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 63a:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 63d:	83 c0 04             	add    $0x4,%eax
+ 640:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 643:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 64a:	e9 59 01 00 00       	jmp    7a8 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 64f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 652:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 655:	01 d0                	add    %edx,%eax
+ 657:	0f b6 00             	movzbl (%eax),%eax
+ 65a:	0f be c0             	movsbl %al,%eax
+ 65d:	25 ff 00 00 00       	and    $0xff,%eax
+ 662:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 665:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 669:	75 2c                	jne    697 <printf+0x6a>
+      if(c == '%'){
+ 66b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 66f:	75 0c                	jne    67d <printf+0x50>
+        state = '%';
+ 671:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 678:	e9 27 01 00 00       	jmp    7a4 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 67d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 680:	0f be c0             	movsbl %al,%eax
+ 683:	83 ec 08             	sub    $0x8,%esp
+ 686:	50                   	push   %eax
+ 687:	ff 75 08             	push   0x8(%ebp)
+ 68a:	e8 ca fe ff ff       	call   559 <putc>
+ 68f:	83 c4 10             	add    $0x10,%esp
+ 692:	e9 0d 01 00 00       	jmp    7a4 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 697:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 69b:	0f 85 03 01 00 00    	jne    7a4 <printf+0x177>
+      if(c == 'd'){
+ 6a1:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6a5:	75 1e                	jne    6c5 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 6a7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6aa:	8b 00                	mov    (%eax),%eax
+ 6ac:	6a 01                	push   $0x1
+ 6ae:	6a 0a                	push   $0xa
+ 6b0:	50                   	push   %eax
+ 6b1:	ff 75 08             	push   0x8(%ebp)
+ 6b4:	e8 c3 fe ff ff       	call   57c <printint>
+ 6b9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6bc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6c0:	e9 d8 00 00 00       	jmp    79d <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6c5:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6c9:	74 06                	je     6d1 <printf+0xa4>
+ 6cb:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6cf:	75 1e                	jne    6ef <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6d1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6d4:	8b 00                	mov    (%eax),%eax
+ 6d6:	6a 00                	push   $0x0
+ 6d8:	6a 10                	push   $0x10
+ 6da:	50                   	push   %eax
+ 6db:	ff 75 08             	push   0x8(%ebp)
+ 6de:	e8 99 fe ff ff       	call   57c <printint>
+ 6e3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6e6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6ea:	e9 ae 00 00 00       	jmp    79d <printf+0x170>
+      } else if(c == 's'){
+ 6ef:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6f3:	75 43                	jne    738 <printf+0x10b>
+        s = (char*)*ap;
+ 6f5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f8:	8b 00                	mov    (%eax),%eax
+ 6fa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6fd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 701:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 705:	75 25                	jne    72c <printf+0xff>
+          s = "(null)";
+ 707:	c7 45 f4 63 0c 00 00 	movl   $0xc63,-0xc(%ebp)
+        while(*s != 0){
+ 70e:	eb 1c                	jmp    72c <printf+0xff>
+          putc(fd, *s);
+ 710:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 713:	0f b6 00             	movzbl (%eax),%eax
+ 716:	0f be c0             	movsbl %al,%eax
+ 719:	83 ec 08             	sub    $0x8,%esp
+ 71c:	50                   	push   %eax
+ 71d:	ff 75 08             	push   0x8(%ebp)
+ 720:	e8 34 fe ff ff       	call   559 <putc>
+ 725:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 728:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 72c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72f:	0f b6 00             	movzbl (%eax),%eax
+ 732:	84 c0                	test   %al,%al
+ 734:	75 da                	jne    710 <printf+0xe3>
+ 736:	eb 65                	jmp    79d <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 738:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 73c:	75 1d                	jne    75b <printf+0x12e>
+        putc(fd, *ap);
+ 73e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 741:	8b 00                	mov    (%eax),%eax
+ 743:	0f be c0             	movsbl %al,%eax
+ 746:	83 ec 08             	sub    $0x8,%esp
+ 749:	50                   	push   %eax
+ 74a:	ff 75 08             	push   0x8(%ebp)
+ 74d:	e8 07 fe ff ff       	call   559 <putc>
+ 752:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 755:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 759:	eb 42                	jmp    79d <printf+0x170>
+      } else if(c == '%'){
+ 75b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 75f:	75 17                	jne    778 <printf+0x14b>
+        putc(fd, c);
+ 761:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 764:	0f be c0             	movsbl %al,%eax
+ 767:	83 ec 08             	sub    $0x8,%esp
+ 76a:	50                   	push   %eax
+ 76b:	ff 75 08             	push   0x8(%ebp)
+ 76e:	e8 e6 fd ff ff       	call   559 <putc>
+ 773:	83 c4 10             	add    $0x10,%esp
+ 776:	eb 25                	jmp    79d <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 778:	83 ec 08             	sub    $0x8,%esp
+ 77b:	6a 25                	push   $0x25
+ 77d:	ff 75 08             	push   0x8(%ebp)
+ 780:	e8 d4 fd ff ff       	call   559 <putc>
+ 785:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 788:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 78b:	0f be c0             	movsbl %al,%eax
+ 78e:	83 ec 08             	sub    $0x8,%esp
+ 791:	50                   	push   %eax
+ 792:	ff 75 08             	push   0x8(%ebp)
+ 795:	e8 bf fd ff ff       	call   559 <putc>
+ 79a:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 79d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7a4:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7ab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7ae:	01 d0                	add    %edx,%eax
+ 7b0:	0f b6 00             	movzbl (%eax),%eax
+ 7b3:	84 c0                	test   %al,%al
+ 7b5:	0f 85 94 fe ff ff    	jne    64f <printf+0x22>
+    }
+  }
+}
+ 7bb:	90                   	nop
+ 7bc:	90                   	nop
+ 7bd:	c9                   	leave
+ 7be:	c3                   	ret
+
+000007bf <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7bf:	55                   	push   %ebp
+ 7c0:	89 e5                	mov    %esp,%ebp
+ 7c2:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c8:	83 e8 08             	sub    $0x8,%eax
+ 7cb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7ce:	a1 78 10 00 00       	mov    0x1078,%eax
+ 7d3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7d6:	eb 24                	jmp    7fc <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7db:	8b 00                	mov    (%eax),%eax
+ 7dd:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7e0:	72 12                	jb     7f4 <free+0x35>
+ 7e2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7e5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7e8:	72 24                	jb     80e <free+0x4f>
+ 7ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ed:	8b 00                	mov    (%eax),%eax
+ 7ef:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7f2:	72 1a                	jb     80e <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f7:	8b 00                	mov    (%eax),%eax
+ 7f9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7fc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ff:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 802:	73 d4                	jae    7d8 <free+0x19>
+ 804:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 807:	8b 00                	mov    (%eax),%eax
+ 809:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 80c:	73 ca                	jae    7d8 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 80e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 811:	8b 40 04             	mov    0x4(%eax),%eax
+ 814:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 81b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 81e:	01 c2                	add    %eax,%edx
+ 820:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 823:	8b 00                	mov    (%eax),%eax
+ 825:	39 c2                	cmp    %eax,%edx
+ 827:	75 24                	jne    84d <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 829:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 82c:	8b 50 04             	mov    0x4(%eax),%edx
+ 82f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 832:	8b 00                	mov    (%eax),%eax
+ 834:	8b 40 04             	mov    0x4(%eax),%eax
+ 837:	01 c2                	add    %eax,%edx
+ 839:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 83c:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 83f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 842:	8b 00                	mov    (%eax),%eax
+ 844:	8b 10                	mov    (%eax),%edx
+ 846:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 849:	89 10                	mov    %edx,(%eax)
+ 84b:	eb 0a                	jmp    857 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 84d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 850:	8b 10                	mov    (%eax),%edx
+ 852:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 855:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 857:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 85a:	8b 40 04             	mov    0x4(%eax),%eax
+ 85d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 864:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 867:	01 d0                	add    %edx,%eax
+ 869:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 86c:	75 20                	jne    88e <free+0xcf>
+    p->s.size += bp->s.size;
+ 86e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 871:	8b 50 04             	mov    0x4(%eax),%edx
+ 874:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 877:	8b 40 04             	mov    0x4(%eax),%eax
+ 87a:	01 c2                	add    %eax,%edx
+ 87c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 87f:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 882:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 885:	8b 10                	mov    (%eax),%edx
+ 887:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88a:	89 10                	mov    %edx,(%eax)
+ 88c:	eb 08                	jmp    896 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 88e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 891:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 894:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 896:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 899:	a3 78 10 00 00       	mov    %eax,0x1078
+}
+ 89e:	90                   	nop
+ 89f:	c9                   	leave
+ 8a0:	c3                   	ret
+
+000008a1 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8a1:	55                   	push   %ebp
+ 8a2:	89 e5                	mov    %esp,%ebp
+ 8a4:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 8a7:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8ae:	77 07                	ja     8b7 <morecore+0x16>
+    nu = 4096;
+ 8b0:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 8b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ba:	c1 e0 03             	shl    $0x3,%eax
+ 8bd:	83 ec 0c             	sub    $0xc,%esp
+ 8c0:	50                   	push   %eax
+ 8c1:	e8 83 fb ff ff       	call   449 <sbrk>
+ 8c6:	83 c4 10             	add    $0x10,%esp
+ 8c9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 8cc:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8d0:	75 07                	jne    8d9 <morecore+0x38>
+    return 0;
+ 8d2:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8d7:	eb 26                	jmp    8ff <morecore+0x5e>
+  hp = (Header*)p;
+ 8d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8dc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 8df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8e2:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8e5:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8e8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8eb:	83 c0 08             	add    $0x8,%eax
+ 8ee:	83 ec 0c             	sub    $0xc,%esp
+ 8f1:	50                   	push   %eax
+ 8f2:	e8 c8 fe ff ff       	call   7bf <free>
+ 8f7:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 8fa:	a1 78 10 00 00       	mov    0x1078,%eax
+}
+ 8ff:	c9                   	leave
+ 900:	c3                   	ret
+
+00000901 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 901:	55                   	push   %ebp
+ 902:	89 e5                	mov    %esp,%ebp
+ 904:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 907:	8b 45 08             	mov    0x8(%ebp),%eax
+ 90a:	83 c0 07             	add    $0x7,%eax
+ 90d:	c1 e8 03             	shr    $0x3,%eax
+ 910:	83 c0 01             	add    $0x1,%eax
+ 913:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 916:	a1 78 10 00 00       	mov    0x1078,%eax
+ 91b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 91e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 922:	75 23                	jne    947 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 924:	c7 45 f0 70 10 00 00 	movl   $0x1070,-0x10(%ebp)
+ 92b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 92e:	a3 78 10 00 00       	mov    %eax,0x1078
+ 933:	a1 78 10 00 00       	mov    0x1078,%eax
+ 938:	a3 70 10 00 00       	mov    %eax,0x1070
+    base.s.size = 0;
+ 93d:	c7 05 74 10 00 00 00 	movl   $0x0,0x1074
+ 944:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 947:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 94a:	8b 00                	mov    (%eax),%eax
+ 94c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 94f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 952:	8b 40 04             	mov    0x4(%eax),%eax
+ 955:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 958:	72 4d                	jb     9a7 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 95a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 95d:	8b 40 04             	mov    0x4(%eax),%eax
+ 960:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 963:	75 0c                	jne    971 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 965:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 968:	8b 10                	mov    (%eax),%edx
+ 96a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 96d:	89 10                	mov    %edx,(%eax)
+ 96f:	eb 26                	jmp    997 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 971:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 974:	8b 40 04             	mov    0x4(%eax),%eax
+ 977:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 97a:	89 c2                	mov    %eax,%edx
+ 97c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97f:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 982:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 985:	8b 40 04             	mov    0x4(%eax),%eax
+ 988:	c1 e0 03             	shl    $0x3,%eax
+ 98b:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 98e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 991:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 994:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 997:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 99a:	a3 78 10 00 00       	mov    %eax,0x1078
+      return (void*)(p + 1);
+ 99f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a2:	83 c0 08             	add    $0x8,%eax
+ 9a5:	eb 3b                	jmp    9e2 <malloc+0xe1>
+    }
+    if(p == freep)
+ 9a7:	a1 78 10 00 00       	mov    0x1078,%eax
+ 9ac:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9af:	75 1e                	jne    9cf <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 9b1:	83 ec 0c             	sub    $0xc,%esp
+ 9b4:	ff 75 ec             	push   -0x14(%ebp)
+ 9b7:	e8 e5 fe ff ff       	call   8a1 <morecore>
+ 9bc:	83 c4 10             	add    $0x10,%esp
+ 9bf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9c2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9c6:	75 07                	jne    9cf <malloc+0xce>
+        return 0;
+ 9c8:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9cd:	eb 13                	jmp    9e2 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d8:	8b 00                	mov    (%eax),%eax
+ 9da:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9dd:	e9 6d ff ff ff       	jmp    94f <malloc+0x4e>
+  }
+}
+ 9e2:	c9                   	leave
+ 9e3:	c3                   	ret
+
+000009e4 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ 9e4:	55                   	push   %ebp
+ 9e5:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 9e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ea:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 9f0:	90                   	nop
+ 9f1:	5d                   	pop    %ebp
+ 9f2:	c3                   	ret
+
+000009f3 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 9f3:	55                   	push   %ebp
+ 9f4:	89 e5                	mov    %esp,%ebp
+ 9f6:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 9f9:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9fc:	b8 00 00 00 00       	mov    $0x0,%eax
+ a01:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a06:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ a0a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a0d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a11:	74 3b                	je     a4e <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ a13:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ a17:	74 2d                	je     a46 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a19:	8b 55 08             	mov    0x8(%ebp),%edx
+ a1c:	b8 02 00 00 00       	mov    $0x2,%eax
+ a21:	87 02                	xchg   %eax,(%edx)
+ a23:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a26:	eb 1e                	jmp    a46 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ a28:	8b 45 08             	mov    0x8(%ebp),%eax
+ a2b:	83 ec 08             	sub    $0x8,%esp
+ a2e:	6a 02                	push   $0x2
+ a30:	50                   	push   %eax
+ a31:	e8 f3 fa ff ff       	call   529 <futex_wait>
+ a36:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a39:	8b 55 08             	mov    0x8(%ebp),%edx
+ a3c:	b8 02 00 00 00       	mov    $0x2,%eax
+ a41:	87 02                	xchg   %eax,(%edx)
+ a43:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ a46:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a4a:	75 dc                	jne    a28 <mutex_lock+0x35>
+ a4c:	eb 01                	jmp    a4f <mutex_lock+0x5c>
+    return;
+ a4e:	90                   	nop
+  }
+}
+ a4f:	c9                   	leave
+ a50:	c3                   	ret
+
+00000a51 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ a51:	55                   	push   %ebp
+ a52:	89 e5                	mov    %esp,%ebp
+ a54:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ a57:	8b 45 08             	mov    0x8(%ebp),%eax
+ a5a:	ba 01 00 00 00       	mov    $0x1,%edx
+ a5f:	f7 da                	neg    %edx
+ a61:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ a65:	83 fa 01             	cmp    $0x1,%edx
+ a68:	74 1a                	je     a84 <mutex_unlock+0x33>
+    m->state = 0;
+ a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a6d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ a73:	8b 45 08             	mov    0x8(%ebp),%eax
+ a76:	83 ec 08             	sub    $0x8,%esp
+ a79:	6a 01                	push   $0x1
+ a7b:	50                   	push   %eax
+ a7c:	e8 b0 fa ff ff       	call   531 <futex_wake>
+ a81:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ a84:	90                   	nop
+ a85:	c9                   	leave
+ a86:	c3                   	ret
+
+00000a87 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ a87:	55                   	push   %ebp
+ a88:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ a8a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a8d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ a93:	8b 45 08             	mov    0x8(%ebp),%eax
+ a96:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ a9d:	90                   	nop
+ a9e:	5d                   	pop    %ebp
+ a9f:	c3                   	ret
+
+00000aa0 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ aa6:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa9:	83 c0 04             	add    $0x4,%eax
+ aac:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ ab0:	8b 45 08             	mov    0x8(%ebp),%eax
+ ab3:	83 ec 08             	sub    $0x8,%esp
+ ab6:	ff 75 0c             	push   0xc(%ebp)
+ ab9:	50                   	push   %eax
+ aba:	e8 6a fa ff ff       	call   529 <futex_wait>
+ abf:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ ac2:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac5:	83 c0 04             	add    $0x4,%eax
+ ac8:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ acc:	90                   	nop
+ acd:	c9                   	leave
+ ace:	c3                   	ret
+
+00000acf <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ acf:	55                   	push   %ebp
+ ad0:	89 e5                	mov    %esp,%ebp
+ ad2:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+ ad8:	8b 00                	mov    (%eax),%eax
+ ada:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ add:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ae1:	78 17                	js     afa <rwlock_rdlock+0x2b>
+ ae3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae6:	83 c0 01             	add    $0x1,%eax
+ ae9:	89 c1                	mov    %eax,%ecx
+ aeb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aee:	8b 55 08             	mov    0x8(%ebp),%edx
+ af1:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ af5:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ af8:	74 19                	je     b13 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ afa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ afe:	79 d5                	jns    ad5 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ b00:	83 ec 08             	sub    $0x8,%esp
+ b03:	ff 75 f4             	push   -0xc(%ebp)
+ b06:	ff 75 08             	push   0x8(%ebp)
+ b09:	e8 92 ff ff ff       	call   aa0 <rwlock_sleep>
+ b0e:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ b11:	eb c2                	jmp    ad5 <rwlock_rdlock+0x6>
+      return;
+ b13:	90                   	nop
+  }
+}
+ b14:	c9                   	leave
+ b15:	c3                   	ret
+
+00000b16 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ b16:	55                   	push   %ebp
+ b17:	89 e5                	mov    %esp,%ebp
+ b19:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b1c:	eb 11                	jmp    b2f <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ b1e:	83 ec 08             	sub    $0x8,%esp
+ b21:	ff 75 f4             	push   -0xc(%ebp)
+ b24:	ff 75 08             	push   0x8(%ebp)
+ b27:	e8 74 ff ff ff       	call   aa0 <rwlock_sleep>
+ b2c:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b2f:	8b 55 08             	mov    0x8(%ebp),%edx
+ b32:	b8 00 00 00 00       	mov    $0x0,%eax
+ b37:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ b3c:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b40:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b43:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b47:	75 d5                	jne    b1e <rwlock_wrlock+0x8>
+}
+ b49:	90                   	nop
+ b4a:	90                   	nop
+ b4b:	c9                   	leave
+ b4c:	c3                   	ret
+
+00000b4d <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ b4d:	55                   	push   %ebp
+ b4e:	89 e5                	mov    %esp,%ebp
+ b50:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ b53:	8b 45 08             	mov    0x8(%ebp),%eax
+ b56:	8b 00                	mov    (%eax),%eax
+ b58:	85 c0                	test   %eax,%eax
+ b5a:	79 0c                	jns    b68 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ b5c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b5f:	ba 00 00 00 00       	mov    $0x0,%edx
+ b64:	87 10                	xchg   %edx,(%eax)
+ b66:	eb 18                	jmp    b80 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ b68:	8b 55 08             	mov    0x8(%ebp),%edx
+ b6b:	b8 01 00 00 00       	mov    $0x1,%eax
+ b70:	f7 d8                	neg    %eax
+ b72:	89 c1                	mov    %eax,%ecx
+ b74:	89 c8                	mov    %ecx,%eax
+ b76:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ b7a:	01 c8                	add    %ecx,%eax
+ b7c:	85 c0                	test   %eax,%eax
+ b7e:	75 20                	jne    ba0 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ b80:	8b 45 08             	mov    0x8(%ebp),%eax
+ b83:	8b 40 04             	mov    0x4(%eax),%eax
+ b86:	85 c0                	test   %eax,%eax
+ b88:	74 17                	je     ba1 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b8d:	83 ec 08             	sub    $0x8,%esp
+ b90:	68 ff ff ff 7f       	push   $0x7fffffff
+ b95:	50                   	push   %eax
+ b96:	e8 96 f9 ff ff       	call   531 <futex_wake>
+ b9b:	83 c4 10             	add    $0x10,%esp
+ b9e:	eb 01                	jmp    ba1 <rwlock_unlock+0x54>
+    return;
+ ba0:	90                   	nop
+}
+ ba1:	c9                   	leave
+ ba2:	c3                   	ret
+
+00000ba3 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ ba3:	55                   	push   %ebp
+ ba4:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ ba6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ baf:	90                   	nop
+ bb0:	5d                   	pop    %ebp
+ bb1:	c3                   	ret
+
+00000bb2 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ bb2:	55                   	push   %ebp
+ bb3:	89 e5                	mov    %esp,%ebp
+ bb5:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+ bbb:	8b 00                	mov    (%eax),%eax
+ bbd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ bc0:	83 ec 0c             	sub    $0xc,%esp
+ bc3:	ff 75 0c             	push   0xc(%ebp)
+ bc6:	e8 86 fe ff ff       	call   a51 <mutex_unlock>
+ bcb:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ bce:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd1:	83 ec 08             	sub    $0x8,%esp
+ bd4:	ff 75 f4             	push   -0xc(%ebp)
+ bd7:	50                   	push   %eax
+ bd8:	e8 4c f9 ff ff       	call   529 <futex_wait>
+ bdd:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ be0:	83 ec 0c             	sub    $0xc,%esp
+ be3:	ff 75 0c             	push   0xc(%ebp)
+ be6:	e8 08 fe ff ff       	call   9f3 <mutex_lock>
+ beb:	83 c4 10             	add    $0x10,%esp
+}
+ bee:	90                   	nop
+ bef:	c9                   	leave
+ bf0:	c3                   	ret
+
+00000bf1 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ bf1:	55                   	push   %ebp
+ bf2:	89 e5                	mov    %esp,%ebp
+ bf4:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+ bfa:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ bfe:	8b 45 08             	mov    0x8(%ebp),%eax
+ c01:	83 ec 08             	sub    $0x8,%esp
+ c04:	6a 01                	push   $0x1
+ c06:	50                   	push   %eax
+ c07:	e8 25 f9 ff ff       	call   531 <futex_wake>
+ c0c:	83 c4 10             	add    $0x10,%esp
+}
+ c0f:	90                   	nop
+ c10:	c9                   	leave
+ c11:	c3                   	ret
+
+00000c12 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ c12:	55                   	push   %ebp
+ c13:	89 e5                	mov    %esp,%ebp
+ c15:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c18:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1b:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ c1f:	8b 45 08             	mov    0x8(%ebp),%eax
+ c22:	83 ec 08             	sub    $0x8,%esp
+ c25:	68 ff ff ff 7f       	push   $0x7fffffff
+ c2a:	50                   	push   %eax
+ c2b:	e8 01 f9 ff ff       	call   531 <futex_wake>
+ c30:	83 c4 10             	add    $0x10,%esp
+}
+ c33:	90                   	nop
+ c34:	c9                   	leave
+ c35:	c3                   	ret
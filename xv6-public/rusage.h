@@ -0,0 +1,17 @@
+// CPU time and page faults of a process, as returned by getrusage().
+
+#define RUSAGE_SELF 0      // The calling process
+#define RUSAGE_CHILDREN -1 // Its children that wait() has reaped
+
+// Kinds of page fault the kernel serves
+#define FAULT_ZERO 0 // First touch of heap that sbrk() left unbacked
+#define FAULT_COW 1  // Write to a page shared copy-on-write since fork()
+#define FAULT_SHM 2  // First touch of a shared memory page
+#define NFAULT 3
+
+struct rusage
+{
+  uint64 utime;       // TSC cycles spent in user mode
+  uint64 stime;       // TSC cycles spent in the kernel
+  uint faults[NFAULT]; // Page faults served, by kind
+};
@@ -0,0 +1,2169 @@
+
+_schedtrace:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <ilog2>:
+static uint dispatches[NLEVELS];
+static uint queue_changes, promotions;
+static char *levels[NLEVELS] = {"UNSET", "RR", "LCFS", "BJF"};
+
+int ilog2(uint64 v)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+   6:	8b 45 08             	mov    0x8(%ebp),%eax
+   9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+   c:	8b 45 0c             	mov    0xc(%ebp),%eax
+   f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    int k = 0;
+  12:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    while (v >>= 1)
+  19:	eb 04                	jmp    1f <ilog2+0x1f>
+        k++;
+  1b:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    while (v >>= 1)
+  1f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  22:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  25:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+  29:	d1 ea                	shr    %edx
+  2b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  2e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  31:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  34:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  37:	09 d0                	or     %edx,%eax
+  39:	85 c0                	test   %eax,%eax
+  3b:	75 de                	jne    1b <ilog2+0x1b>
+    return k;
+  3d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  40:	c9                   	leave
+  41:	c3                   	ret
+
+00000042 <sort_events>:
+
+// The rings are drained one CPU after another; put the events
+// back into time order. Each CPU's run is already sorted.
+void sort_events(int n)
+{
+  42:	55                   	push   %ebp
+  43:	89 e5                	mov    %esp,%ebp
+  45:	53                   	push   %ebx
+  46:	83 ec 24             	sub    $0x24,%esp
+    struct trace_event e;
+    int i, j;
+
+    for (i = 1; i < n; i++)
+  49:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  50:	e9 a9 00 00 00       	jmp    fe <sort_events+0xbc>
+    {
+        e = events[i];
+  55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  58:	c1 e0 04             	shl    $0x4,%eax
+  5b:	05 20 15 00 00       	add    $0x1520,%eax
+  60:	8b 10                	mov    (%eax),%edx
+  62:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  65:	8b 50 04             	mov    0x4(%eax),%edx
+  68:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  6b:	8b 50 08             	mov    0x8(%eax),%edx
+  6e:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  71:	8b 40 0c             	mov    0xc(%eax),%eax
+  74:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        for (j = i; j > 0 && events[j - 1].tsc > e.tsc; j--)
+  77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  7a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  7d:	eb 34                	jmp    b3 <sort_events+0x71>
+            events[j] = events[j - 1];
+  7f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  82:	8d 50 ff             	lea    -0x1(%eax),%edx
+  85:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  88:	c1 e0 04             	shl    $0x4,%eax
+  8b:	05 20 15 00 00       	add    $0x1520,%eax
+  90:	c1 e2 04             	shl    $0x4,%edx
+  93:	81 c2 20 15 00 00    	add    $0x1520,%edx
+  99:	8b 0a                	mov    (%edx),%ecx
+  9b:	89 08                	mov    %ecx,(%eax)
+  9d:	8b 4a 04             	mov    0x4(%edx),%ecx
+  a0:	89 48 04             	mov    %ecx,0x4(%eax)
+  a3:	8b 4a 08             	mov    0x8(%edx),%ecx
+  a6:	89 48 08             	mov    %ecx,0x8(%eax)
+  a9:	8b 52 0c             	mov    0xc(%edx),%edx
+  ac:	89 50 0c             	mov    %edx,0xc(%eax)
+        for (j = i; j > 0 && events[j - 1].tsc > e.tsc; j--)
+  af:	83 6d f0 01          	subl   $0x1,-0x10(%ebp)
+  b3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  b7:	7e 1f                	jle    d8 <sort_events+0x96>
+  b9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  bc:	83 e8 01             	sub    $0x1,%eax
+  bf:	c1 e0 04             	shl    $0x4,%eax
+  c2:	05 20 15 00 00       	add    $0x1520,%eax
+  c7:	8b 50 04             	mov    0x4(%eax),%edx
+  ca:	8b 00                	mov    (%eax),%eax
+  cc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cf:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  d2:	39 c1                	cmp    %eax,%ecx
+  d4:	19 d3                	sbb    %edx,%ebx
+  d6:	72 a7                	jb     7f <sort_events+0x3d>
+        events[j] = e;
+  d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  db:	c1 e0 04             	shl    $0x4,%eax
+  de:	05 20 15 00 00       	add    $0x1520,%eax
+  e3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  e6:	89 10                	mov    %edx,(%eax)
+  e8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  eb:	89 50 04             	mov    %edx,0x4(%eax)
+  ee:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  f1:	89 50 08             	mov    %edx,0x8(%eax)
+  f4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  f7:	89 50 0c             	mov    %edx,0xc(%eax)
+    for (i = 1; i < n; i++)
+  fa:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 101:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 104:	0f 8c 4b ff ff ff    	jl     55 <sort_events+0x13>
+    }
+}
+ 10a:	90                   	nop
+ 10b:	90                   	nop
+ 10c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 10f:	c9                   	leave
+ 110:	c3                   	ret
+
+00000111 <lookup>:
+
+struct waiting *lookup(int pid)
+{
+ 111:	55                   	push   %ebp
+ 112:	89 e5                	mov    %esp,%ebp
+ 114:	83 ec 10             	sub    $0x10,%esp
+    struct waiting *w = &waiting[pid % NWAITING];
+ 117:	8b 55 08             	mov    0x8(%ebp),%edx
+ 11a:	89 d0                	mov    %edx,%eax
+ 11c:	c1 f8 1f             	sar    $0x1f,%eax
+ 11f:	c1 e8 1a             	shr    $0x1a,%eax
+ 122:	01 c2                	add    %eax,%edx
+ 124:	83 e2 3f             	and    $0x3f,%edx
+ 127:	29 c2                	sub    %eax,%edx
+ 129:	89 d0                	mov    %edx,%eax
+ 12b:	01 c0                	add    %eax,%eax
+ 12d:	01 d0                	add    %edx,%eax
+ 12f:	c1 e0 02             	shl    $0x2,%eax
+ 132:	05 20 95 00 00       	add    $0x9520,%eax
+ 137:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    if (w->pid != pid)
+ 13a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 13d:	8b 00                	mov    (%eax),%eax
+ 13f:	39 45 08             	cmp    %eax,0x8(%ebp)
+ 142:	74 19                	je     15d <lookup+0x4c>
+    {
+        w->pid = pid;
+ 144:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 147:	8b 55 08             	mov    0x8(%ebp),%edx
+ 14a:	89 10                	mov    %edx,(%eax)
+        w->since = 0;
+ 14c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 14f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+ 156:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    }
+    return w;
+ 15d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 160:	c9                   	leave
+ 161:	c3                   	ret
+
+00000162 <account>:
+
+void account(struct trace_event *e)
+{
+ 162:	55                   	push   %ebp
+ 163:	89 e5                	mov    %esp,%ebp
+ 165:	53                   	push   %ebx
+ 166:	83 ec 14             	sub    $0x14,%esp
+    struct waiting *w = lookup(e->pid);
+ 169:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16c:	8b 40 08             	mov    0x8(%eax),%eax
+ 16f:	50                   	push   %eax
+ 170:	e8 9c ff ff ff       	call   111 <lookup>
+ 175:	83 c4 04             	add    $0x4,%esp
+ 178:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int level = e->queue < NLEVELS ? e->queue : 0;
+ 17b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17e:	0f b6 40 0d          	movzbl 0xd(%eax),%eax
+ 182:	3c 03                	cmp    $0x3,%al
+ 184:	77 0c                	ja     192 <account+0x30>
+ 186:	8b 45 08             	mov    0x8(%ebp),%eax
+ 189:	0f b6 40 0d          	movzbl 0xd(%eax),%eax
+ 18d:	0f b6 c0             	movzbl %al,%eax
+ 190:	eb 05                	jmp    197 <account+0x35>
+ 192:	b8 00 00 00 00       	mov    $0x0,%eax
+ 197:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    switch (e->type)
+ 19a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19d:	0f b6 40 0c          	movzbl 0xc(%eax),%eax
+ 1a1:	0f b6 c0             	movzbl %al,%eax
+ 1a4:	83 f8 04             	cmp    $0x4,%eax
+ 1a7:	0f 87 f9 00 00 00    	ja     2a6 <account+0x144>
+ 1ad:	8b 04 85 ec 0f 00 00 	mov    0xfec(,%eax,4),%eax
+ 1b4:	ff e0                	jmp    *%eax
+    {
+    case TRACE_WAKEUP:
+        w->since = e->tsc;
+ 1b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b9:	8b 50 04             	mov    0x4(%eax),%edx
+ 1bc:	8b 00                	mov    (%eax),%eax
+ 1be:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+ 1c1:	89 41 04             	mov    %eax,0x4(%ecx)
+ 1c4:	89 51 08             	mov    %edx,0x8(%ecx)
+        break;
+ 1c7:	e9 da 00 00 00       	jmp    2a6 <account+0x144>
+    case TRACE_SWITCH_OUT:
+        // Preempted or yielded: it waits on a run queue again.
+        w->since = e->arg ? e->tsc : 0;
+ 1cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1cf:	0f b6 40 0f          	movzbl 0xf(%eax),%eax
+ 1d3:	84 c0                	test   %al,%al
+ 1d5:	74 0a                	je     1e1 <account+0x7f>
+ 1d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1da:	8b 50 04             	mov    0x4(%eax),%edx
+ 1dd:	8b 00                	mov    (%eax),%eax
+ 1df:	eb 0a                	jmp    1eb <account+0x89>
+ 1e1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1e6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1eb:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+ 1ee:	89 41 04             	mov    %eax,0x4(%ecx)
+ 1f1:	89 51 08             	mov    %edx,0x8(%ecx)
+        break;
+ 1f4:	e9 ad 00 00 00       	jmp    2a6 <account+0x144>
+    case TRACE_SWITCH_IN:
+        if (w->since != 0 && e->tsc >= w->since)
+ 1f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1fc:	8b 50 08             	mov    0x8(%eax),%edx
+ 1ff:	8b 40 04             	mov    0x4(%eax),%eax
+ 202:	09 d0                	or     %edx,%eax
+ 204:	85 c0                	test   %eax,%eax
+ 206:	74 6e                	je     276 <account+0x114>
+ 208:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20b:	8b 08                	mov    (%eax),%ecx
+ 20d:	8b 58 04             	mov    0x4(%eax),%ebx
+ 210:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 213:	8b 50 08             	mov    0x8(%eax),%edx
+ 216:	8b 40 04             	mov    0x4(%eax),%eax
+ 219:	39 c1                	cmp    %eax,%ecx
+ 21b:	19 d3                	sbb    %edx,%ebx
+ 21d:	72 57                	jb     276 <account+0x114>
+        {
+            hist[level][ilog2(e->tsc - w->since)]++;
+ 21f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 222:	8b 50 04             	mov    0x4(%eax),%edx
+ 225:	8b 00                	mov    (%eax),%eax
+ 227:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+ 22a:	8b 59 08             	mov    0x8(%ecx),%ebx
+ 22d:	8b 49 04             	mov    0x4(%ecx),%ecx
+ 230:	29 c8                	sub    %ecx,%eax
+ 232:	19 da                	sbb    %ebx,%edx
+ 234:	52                   	push   %edx
+ 235:	50                   	push   %eax
+ 236:	e8 c5 fd ff ff       	call   0 <ilog2>
+ 23b:	83 c4 08             	add    $0x8,%esp
+ 23e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ 241:	c1 e2 06             	shl    $0x6,%edx
+ 244:	01 c2                	add    %eax,%edx
+ 246:	8b 14 95 20 98 00 00 	mov    0x9820(,%edx,4),%edx
+ 24d:	83 c2 01             	add    $0x1,%edx
+ 250:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+ 253:	c1 e1 06             	shl    $0x6,%ecx
+ 256:	01 c8                	add    %ecx,%eax
+ 258:	89 14 85 20 98 00 00 	mov    %edx,0x9820(,%eax,4)
+            dispatches[level]++;
+ 25f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 262:	8b 04 85 20 9c 00 00 	mov    0x9c20(,%eax,4),%eax
+ 269:	8d 50 01             	lea    0x1(%eax),%edx
+ 26c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 26f:	89 14 85 20 9c 00 00 	mov    %edx,0x9c20(,%eax,4)
+        }
+        w->since = 0;
+ 276:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 279:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+ 280:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+        break;
+ 287:	eb 1d                	jmp    2a6 <account+0x144>
+    case TRACE_QUEUE_CHANGE:
+        queue_changes++;
+ 289:	a1 30 9c 00 00       	mov    0x9c30,%eax
+ 28e:	83 c0 01             	add    $0x1,%eax
+ 291:	a3 30 9c 00 00       	mov    %eax,0x9c30
+        break;
+ 296:	eb 0e                	jmp    2a6 <account+0x144>
+    case TRACE_AGING:
+        promotions++;
+ 298:	a1 34 9c 00 00       	mov    0x9c34,%eax
+ 29d:	83 c0 01             	add    $0x1,%eax
+ 2a0:	a3 34 9c 00 00       	mov    %eax,0x9c34
+        break;
+ 2a5:	90                   	nop
+    }
+}
+ 2a6:	90                   	nop
+ 2a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2aa:	c9                   	leave
+ 2ab:	c3                   	ret
+
+000002ac <report>:
+
+void report(void)
+{
+ 2ac:	55                   	push   %ebp
+ 2ad:	89 e5                	mov    %esp,%ebp
+ 2af:	83 ec 18             	sub    $0x18,%esp
+    int level, k;
+
+    for (level = 1; level < NLEVELS; level++)
+ 2b2:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 2b9:	eb 7b                	jmp    336 <report+0x8a>
+    {
+        printf(1, "%s: %d dispatches\n", levels[level], dispatches[level]);
+ 2bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2be:	8b 14 85 20 9c 00 00 	mov    0x9c20(,%eax,4),%edx
+ 2c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2c8:	8b 04 85 ec 14 00 00 	mov    0x14ec(,%eax,4),%eax
+ 2cf:	52                   	push   %edx
+ 2d0:	50                   	push   %eax
+ 2d1:	68 00 10 00 00       	push   $0x1000
+ 2d6:	6a 01                	push   $0x1
+ 2d8:	e8 f0 06 00 00       	call   9cd <printf>
+ 2dd:	83 c4 10             	add    $0x10,%esp
+        for (k = 0; k < NBUCKETS; k++)
+ 2e0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 2e7:	eb 43                	jmp    32c <report+0x80>
+            if (hist[level][k])
+ 2e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2ec:	c1 e0 06             	shl    $0x6,%eax
+ 2ef:	89 c2                	mov    %eax,%edx
+ 2f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 2f4:	01 d0                	add    %edx,%eax
+ 2f6:	8b 04 85 20 98 00 00 	mov    0x9820(,%eax,4),%eax
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	74 27                	je     328 <report+0x7c>
+                printf(1, "    2^%d cycles\t%d\n", k, hist[level][k]);
+ 301:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 304:	c1 e0 06             	shl    $0x6,%eax
+ 307:	89 c2                	mov    %eax,%edx
+ 309:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 30c:	01 d0                	add    %edx,%eax
+ 30e:	8b 04 85 20 98 00 00 	mov    0x9820(,%eax,4),%eax
+ 315:	50                   	push   %eax
+ 316:	ff 75 f0             	push   -0x10(%ebp)
+ 319:	68 13 10 00 00       	push   $0x1013
+ 31e:	6a 01                	push   $0x1
+ 320:	e8 a8 06 00 00       	call   9cd <printf>
+ 325:	83 c4 10             	add    $0x10,%esp
+        for (k = 0; k < NBUCKETS; k++)
+ 328:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 32c:	83 7d f0 3f          	cmpl   $0x3f,-0x10(%ebp)
+ 330:	7e b7                	jle    2e9 <report+0x3d>
+    for (level = 1; level < NLEVELS; level++)
+ 332:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 336:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+ 33a:	0f 8e 7b ff ff ff    	jle    2bb <report+0xf>
+    }
+    printf(1, "queue changes: %d, aging promotions: %d\n", queue_changes, promotions);
+ 340:	8b 15 34 9c 00 00    	mov    0x9c34,%edx
+ 346:	a1 30 9c 00 00       	mov    0x9c30,%eax
+ 34b:	52                   	push   %edx
+ 34c:	50                   	push   %eax
+ 34d:	68 28 10 00 00       	push   $0x1028
+ 352:	6a 01                	push   $0x1
+ 354:	e8 74 06 00 00       	call   9cd <printf>
+ 359:	83 c4 10             	add    $0x10,%esp
+}
+ 35c:	90                   	nop
+ 35d:	c9                   	leave
+ 35e:	c3                   	ret
+
+0000035f <main>:
+
+int main(int argc, char *argv[])
+{
+ 35f:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 363:	83 e4 f0             	and    $0xfffffff0,%esp
+ 366:	ff 71 fc             	push   -0x4(%ecx)
+ 369:	55                   	push   %ebp
+ 36a:	89 e5                	mov    %esp,%ebp
+ 36c:	51                   	push   %ecx
+ 36d:	83 ec 14             	sub    $0x14,%esp
+ 370:	89 c8                	mov    %ecx,%eax
+    int duration = 100, n, i, t;
+ 372:	c7 45 f4 64 00 00 00 	movl   $0x64,-0xc(%ebp)
+
+    if (argc > 1)
+ 379:	83 38 01             	cmpl   $0x1,(%eax)
+ 37c:	7e 17                	jle    395 <main+0x36>
+        duration = atoi(argv[1]);
+ 37e:	8b 40 04             	mov    0x4(%eax),%eax
+ 381:	83 c0 04             	add    $0x4,%eax
+ 384:	8b 00                	mov    (%eax),%eax
+ 386:	83 ec 0c             	sub    $0xc,%esp
+ 389:	50                   	push   %eax
+ 38a:	e8 66 02 00 00       	call   5f5 <atoi>
+ 38f:	83 c4 10             	add    $0x10,%esp
+ 392:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    // Discard whatever was recorded before we started.
+    while (schedtrace(events, MAXEVENTS) == MAXEVENTS)
+ 395:	90                   	nop
+ 396:	83 ec 08             	sub    $0x8,%esp
+ 399:	68 00 08 00 00       	push   $0x800
+ 39e:	68 20 15 00 00       	push   $0x1520
+ 3a3:	e8 f9 04 00 00       	call   8a1 <schedtrace>
+ 3a8:	83 c4 10             	add    $0x10,%esp
+ 3ab:	3d 00 08 00 00       	cmp    $0x800,%eax
+ 3b0:	74 e4                	je     396 <main+0x37>
+        ;
+
+    for (t = 0; t < duration; t++)
+ 3b2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 3b9:	eb 63                	jmp    41e <main+0xbf>
+    {
+        sleep(1);
+ 3bb:	83 ec 0c             	sub    $0xc,%esp
+ 3be:	6a 01                	push   $0x1
+ 3c0:	e8 2c 04 00 00       	call   7f1 <sleep>
+ 3c5:	83 c4 10             	add    $0x10,%esp
+        n = schedtrace(events, MAXEVENTS);
+ 3c8:	83 ec 08             	sub    $0x8,%esp
+ 3cb:	68 00 08 00 00       	push   $0x800
+ 3d0:	68 20 15 00 00       	push   $0x1520
+ 3d5:	e8 c7 04 00 00       	call   8a1 <schedtrace>
+ 3da:	83 c4 10             	add    $0x10,%esp
+ 3dd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        sort_events(n);
+ 3e0:	83 ec 0c             	sub    $0xc,%esp
+ 3e3:	ff 75 e8             	push   -0x18(%ebp)
+ 3e6:	e8 57 fc ff ff       	call   42 <sort_events>
+ 3eb:	83 c4 10             	add    $0x10,%esp
+        for (i = 0; i < n; i++)
+ 3ee:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 3f5:	eb 1b                	jmp    412 <main+0xb3>
+            account(&events[i]);
+ 3f7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 3fa:	c1 e0 04             	shl    $0x4,%eax
+ 3fd:	05 20 15 00 00       	add    $0x1520,%eax
+ 402:	83 ec 0c             	sub    $0xc,%esp
+ 405:	50                   	push   %eax
+ 406:	e8 57 fd ff ff       	call   162 <account>
+ 40b:	83 c4 10             	add    $0x10,%esp
+        for (i = 0; i < n; i++)
+ 40e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 412:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 415:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+ 418:	7c dd                	jl     3f7 <main+0x98>
+    for (t = 0; t < duration; t++)
+ 41a:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+ 41e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 421:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+ 424:	7c 95                	jl     3bb <main+0x5c>
+    }
+    report();
+ 426:	e8 81 fe ff ff       	call   2ac <report>
+    exit();
+ 42b:	e8 31 03 00 00       	call   761 <exit>
+
+00000430 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	53                   	push   %ebx
+{
+ 435:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 438:	8b 55 10             	mov    0x10(%ebp),%edx
+ 43b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 43e:	89 cb                	mov    %ecx,%ebx
+ 440:	89 df                	mov    %ebx,%edi
+ 442:	89 d1                	mov    %edx,%ecx
+ 444:	fc                   	cld
+ 445:	f3 aa                	rep stos %al,%es:(%edi)
+ 447:	89 ca                	mov    %ecx,%edx
+ 449:	89 fb                	mov    %edi,%ebx
+ 44b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 44e:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 451:	90                   	nop
+ 452:	5b                   	pop    %ebx
+ 453:	5f                   	pop    %edi
+ 454:	5d                   	pop    %ebp
+ 455:	c3                   	ret
+
+00000456 <strcpy>:
+{
+ 456:	55                   	push   %ebp
+ 457:	89 e5                	mov    %esp,%ebp
+ 459:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 45c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 462:	90                   	nop
+ 463:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 466:	8d 42 01             	lea    0x1(%edx),%eax
+ 469:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 46c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46f:	8d 48 01             	lea    0x1(%eax),%ecx
+ 472:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 475:	0f b6 12             	movzbl (%edx),%edx
+ 478:	88 10                	mov    %dl,(%eax)
+ 47a:	0f b6 00             	movzbl (%eax),%eax
+ 47d:	84 c0                	test   %al,%al
+ 47f:	75 e2                	jne    463 <strcpy+0xd>
+  return os;
+ 481:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 484:	c9                   	leave
+ 485:	c3                   	ret
+
+00000486 <strcmp>:
+{
+ 486:	55                   	push   %ebp
+ 487:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 489:	eb 08                	jmp    493 <strcmp+0xd>
+    p++, q++;
+ 48b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 48f:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 493:	8b 45 08             	mov    0x8(%ebp),%eax
+ 496:	0f b6 00             	movzbl (%eax),%eax
+ 499:	84 c0                	test   %al,%al
+ 49b:	74 10                	je     4ad <strcmp+0x27>
+ 49d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a0:	0f b6 10             	movzbl (%eax),%edx
+ 4a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4a6:	0f b6 00             	movzbl (%eax),%eax
+ 4a9:	38 c2                	cmp    %al,%dl
+ 4ab:	74 de                	je     48b <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 4ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b0:	0f b6 00             	movzbl (%eax),%eax
+ 4b3:	0f b6 d0             	movzbl %al,%edx
+ 4b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4b9:	0f b6 00             	movzbl (%eax),%eax
+ 4bc:	0f b6 c0             	movzbl %al,%eax
+ 4bf:	29 c2                	sub    %eax,%edx
+ 4c1:	89 d0                	mov    %edx,%eax
+}
+ 4c3:	5d                   	pop    %ebp
+ 4c4:	c3                   	ret
+
+000004c5 <strlen>:
+{
+ 4c5:	55                   	push   %ebp
+ 4c6:	89 e5                	mov    %esp,%ebp
+ 4c8:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 4cb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 4d2:	eb 04                	jmp    4d8 <strlen+0x13>
+ 4d4:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 4d8:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 4db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4de:	01 d0                	add    %edx,%eax
+ 4e0:	0f b6 00             	movzbl (%eax),%eax
+ 4e3:	84 c0                	test   %al,%al
+ 4e5:	75 ed                	jne    4d4 <strlen+0xf>
+  return n;
+ 4e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4ea:	c9                   	leave
+ 4eb:	c3                   	ret
+
+000004ec <memset>:
+{
+ 4ec:	55                   	push   %ebp
+ 4ed:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 4ef:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4f2:	50                   	push   %eax
+ 4f3:	ff 75 0c             	push   0xc(%ebp)
+ 4f6:	ff 75 08             	push   0x8(%ebp)
+ 4f9:	e8 32 ff ff ff       	call   430 <stosb>
+ 4fe:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 501:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 504:	c9                   	leave
+ 505:	c3                   	ret
+
+00000506 <strchr>:
+{
+ 506:	55                   	push   %ebp
+ 507:	89 e5                	mov    %esp,%ebp
+ 509:	83 ec 04             	sub    $0x4,%esp
+ 50c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 50f:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 512:	eb 14                	jmp    528 <strchr+0x22>
+    if(*s == c)
+ 514:	8b 45 08             	mov    0x8(%ebp),%eax
+ 517:	0f b6 00             	movzbl (%eax),%eax
+ 51a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 51d:	75 05                	jne    524 <strchr+0x1e>
+      return (char*)s;
+ 51f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 522:	eb 13                	jmp    537 <strchr+0x31>
+  for(; *s; s++)
+ 524:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 528:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52b:	0f b6 00             	movzbl (%eax),%eax
+ 52e:	84 c0                	test   %al,%al
+ 530:	75 e2                	jne    514 <strchr+0xe>
+  return 0;
+ 532:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 537:	c9                   	leave
+ 538:	c3                   	ret
+
+00000539 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 539:	55                   	push   %ebp
+ 53a:	89 e5                	mov    %esp,%ebp
+ 53c:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 53f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 546:	eb 42                	jmp    58a <gets+0x51>
+    cc = read(0, &c, 1);
+ 548:	83 ec 04             	sub    $0x4,%esp
+ 54b:	6a 01                	push   $0x1
+ 54d:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 550:	50                   	push   %eax
+ 551:	6a 00                	push   $0x0
+ 553:	e8 21 02 00 00       	call   779 <read>
+ 558:	83 c4 10             	add    $0x10,%esp
+ 55b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 55e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 562:	7e 33                	jle    597 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 564:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 567:	8d 50 01             	lea    0x1(%eax),%edx
+ 56a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 56d:	89 c2                	mov    %eax,%edx
+ 56f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 572:	01 c2                	add    %eax,%edx
+ 574:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 578:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 57a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 57e:	3c 0a                	cmp    $0xa,%al
+ 580:	74 16                	je     598 <gets+0x5f>
+ 582:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 586:	3c 0d                	cmp    $0xd,%al
+ 588:	74 0e                	je     598 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 58a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 58d:	83 c0 01             	add    $0x1,%eax
+ 590:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 593:	7f b3                	jg     548 <gets+0xf>
+ 595:	eb 01                	jmp    598 <gets+0x5f>
+      break;
+ 597:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 598:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 59b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59e:	01 d0                	add    %edx,%eax
+ 5a0:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 5a3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 5a6:	c9                   	leave
+ 5a7:	c3                   	ret
+
+000005a8 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 5a8:	55                   	push   %ebp
+ 5a9:	89 e5                	mov    %esp,%ebp
+ 5ab:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 5ae:	83 ec 08             	sub    $0x8,%esp
+ 5b1:	6a 00                	push   $0x0
+ 5b3:	ff 75 08             	push   0x8(%ebp)
+ 5b6:	e8 e6 01 00 00       	call   7a1 <open>
+ 5bb:	83 c4 10             	add    $0x10,%esp
+ 5be:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 5c1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5c5:	79 07                	jns    5ce <stat+0x26>
+    return -1;
+ 5c7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 5cc:	eb 25                	jmp    5f3 <stat+0x4b>
+  r = fstat(fd, st);
+ 5ce:	83 ec 08             	sub    $0x8,%esp
+ 5d1:	ff 75 0c             	push   0xc(%ebp)
+ 5d4:	ff 75 f4             	push   -0xc(%ebp)
+ 5d7:	e8 dd 01 00 00       	call   7b9 <fstat>
+ 5dc:	83 c4 10             	add    $0x10,%esp
+ 5df:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 5e2:	83 ec 0c             	sub    $0xc,%esp
+ 5e5:	ff 75 f4             	push   -0xc(%ebp)
+ 5e8:	e8 9c 01 00 00       	call   789 <close>
+ 5ed:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 5f0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 5f3:	c9                   	leave
+ 5f4:	c3                   	ret
+
+000005f5 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5f5:	55                   	push   %ebp
+ 5f6:	89 e5                	mov    %esp,%ebp
+ 5f8:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 5fb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 602:	eb 25                	jmp    629 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 604:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 607:	89 d0                	mov    %edx,%eax
+ 609:	c1 e0 02             	shl    $0x2,%eax
+ 60c:	01 d0                	add    %edx,%eax
+ 60e:	01 c0                	add    %eax,%eax
+ 610:	89 c1                	mov    %eax,%ecx
+ 612:	8b 45 08             	mov    0x8(%ebp),%eax
+ 615:	8d 50 01             	lea    0x1(%eax),%edx
+ 618:	89 55 08             	mov    %edx,0x8(%ebp)
+ 61b:	0f b6 00             	movzbl (%eax),%eax
+ 61e:	0f be c0             	movsbl %al,%eax
+ 621:	01 c8                	add    %ecx,%eax
+ 623:	83 e8 30             	sub    $0x30,%eax
+ 626:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 629:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62c:	0f b6 00             	movzbl (%eax),%eax
+ 62f:	3c 2f                	cmp    $0x2f,%al
+ 631:	7e 0a                	jle    63d <atoi+0x48>
+ 633:	8b 45 08             	mov    0x8(%ebp),%eax
+ 636:	0f b6 00             	movzbl (%eax),%eax
+ 639:	3c 39                	cmp    $0x39,%al
+ 63b:	7e c7                	jle    604 <atoi+0xf>
+  return n;
+ 63d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 640:	c9                   	leave
+ 641:	c3                   	ret
+
+00000642 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 642:	55                   	push   %ebp
+ 643:	89 e5                	mov    %esp,%ebp
+ 645:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 648:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 64e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 651:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 654:	eb 17                	jmp    66d <memmove+0x2b>
+    *dst++ = *src++;
+ 656:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 659:	8d 42 01             	lea    0x1(%edx),%eax
+ 65c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 65f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 662:	8d 48 01             	lea    0x1(%eax),%ecx
+ 665:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 668:	0f b6 12             	movzbl (%edx),%edx
+ 66b:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 66d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 670:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 673:	89 55 10             	mov    %edx,0x10(%ebp)
+ 676:	85 c0                	test   %eax,%eax
+ 678:	7f dc                	jg     656 <memmove+0x14>
+  return vdst;
+ 67a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 67d:	c9                   	leave
+ 67e:	c3                   	ret
+
+0000067f <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 67f:	55                   	push   %ebp
+ 680:	89 e5                	mov    %esp,%ebp
+ 682:	57                   	push   %edi
+ 683:	56                   	push   %esi
+ 684:	83 ec 30             	sub    $0x30,%esp
+ 687:	8b 45 08             	mov    0x8(%ebp),%eax
+ 68a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 68d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 690:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 693:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 69a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 6a1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6a4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 6a7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 6aa:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 6ad:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 6b4:	e9 89 00 00 00       	jmp    742 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 6b9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6bc:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 6bf:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 6c3:	01 c0                	add    %eax,%eax
+ 6c5:	89 c6                	mov    %eax,%esi
+ 6c7:	89 d7                	mov    %edx,%edi
+ 6c9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 6cc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6cf:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6d2:	0f ad d0             	shrd   %cl,%edx,%eax
+ 6d5:	d3 ea                	shr    %cl,%edx
+ 6d7:	f6 c1 20             	test   $0x20,%cl
+ 6da:	74 04                	je     6e0 <udiv64+0x61>
+ 6dc:	89 d0                	mov    %edx,%eax
+ 6de:	31 d2                	xor    %edx,%edx
+ 6e0:	83 e0 01             	and    $0x1,%eax
+ 6e3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 6e6:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 6ed:	89 f0                	mov    %esi,%eax
+ 6ef:	89 fa                	mov    %edi,%edx
+ 6f1:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 6f4:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 6f7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 6fa:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 6fd:	8b 45 10             	mov    0x10(%ebp),%eax
+ 700:	ba 00 00 00 00       	mov    $0x0,%edx
+ 705:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 708:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 70b:	19 d1                	sbb    %edx,%ecx
+ 70d:	72 2f                	jb     73e <udiv64+0xbf>
+      r -= d;
+ 70f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 712:	ba 00 00 00 00       	mov    $0x0,%edx
+ 717:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 71a:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 71d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 720:	b8 01 00 00 00       	mov    $0x1,%eax
+ 725:	ba 00 00 00 00       	mov    $0x0,%edx
+ 72a:	0f a5 c2             	shld   %cl,%eax,%edx
+ 72d:	d3 e0                	shl    %cl,%eax
+ 72f:	f6 c1 20             	test   $0x20,%cl
+ 732:	74 04                	je     738 <udiv64+0xb9>
+ 734:	89 c2                	mov    %eax,%edx
+ 736:	31 c0                	xor    %eax,%eax
+ 738:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 73b:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 73e:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 742:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 746:	0f 89 6d ff ff ff    	jns    6b9 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 74c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 74f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 752:	83 c4 30             	add    $0x30,%esp
+ 755:	5e                   	pop    %esi
+ 756:	5f                   	pop    %edi
+ 757:	5d                   	pop    %ebp
+ 758:	c3                   	ret
+
+00000759 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 759:	b8 01 00 00 00       	mov    $0x1,%eax
+ 75e:	cd 40                	int    $0x40
+ 760:	c3                   	ret
+
+00000761 <exit>:
+SYSCALL(exit)
+ 761:	b8 02 00 00 00       	mov    $0x2,%eax
+ 766:	cd 40                	int    $0x40
+ 768:	c3                   	ret
+
+00000769 <wait>:
+SYSCALL(wait)
+ 769:	b8 03 00 00 00       	mov    $0x3,%eax
+ 76e:	cd 40                	int    $0x40
+ 770:	c3                   	ret
+
+00000771 <pipe>:
+SYSCALL(pipe)
+ 771:	b8 04 00 00 00       	mov    $0x4,%eax
+ 776:	cd 40                	int    $0x40
+ 778:	c3                   	ret
+
+00000779 <read>:
+SYSCALL(read)
+ 779:	b8 05 00 00 00       	mov    $0x5,%eax
+ 77e:	cd 40                	int    $0x40
+ 780:	c3                   	ret
+
+00000781 <write>:
+SYSCALL(write)
+ 781:	b8 10 00 00 00       	mov    $0x10,%eax
+ 786:	cd 40                	int    $0x40
+ 788:	c3                   	ret
+
+00000789 <close>:
+SYSCALL(close)
+ 789:	b8 15 00 00 00       	mov    $0x15,%eax
+ 78e:	cd 40                	int    $0x40
+ 790:	c3                   	ret
+
+00000791 <kill>:
+SYSCALL(kill)
+ 791:	b8 06 00 00 00       	mov    $0x6,%eax
+ 796:	cd 40                	int    $0x40
+ 798:	c3                   	ret
+
+00000799 <exec>:
+SYSCALL(exec)
+ 799:	b8 07 00 00 00       	mov    $0x7,%eax
+ 79e:	cd 40                	int    $0x40
+ 7a0:	c3                   	ret
+
+000007a1 <open>:
+SYSCALL(open)
+ 7a1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7a6:	cd 40                	int    $0x40
+ 7a8:	c3                   	ret
+
+000007a9 <mknod>:
+SYSCALL(mknod)
+ 7a9:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7ae:	cd 40                	int    $0x40
+ 7b0:	c3                   	ret
+
+000007b1 <unlink>:
+SYSCALL(unlink)
+ 7b1:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7b6:	cd 40                	int    $0x40
+ 7b8:	c3                   	ret
+
+000007b9 <fstat>:
+SYSCALL(fstat)
+ 7b9:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7be:	cd 40                	int    $0x40
+ 7c0:	c3                   	ret
+
+000007c1 <link>:
+SYSCALL(link)
+ 7c1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7c6:	cd 40                	int    $0x40
+ 7c8:	c3                   	ret
+
+000007c9 <mkdir>:
+SYSCALL(mkdir)
+ 7c9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7ce:	cd 40                	int    $0x40
+ 7d0:	c3                   	ret
+
+000007d1 <chdir>:
+SYSCALL(chdir)
+ 7d1:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7d6:	cd 40                	int    $0x40
+ 7d8:	c3                   	ret
+
+000007d9 <dup>:
+SYSCALL(dup)
+ 7d9:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7de:	cd 40                	int    $0x40
+ 7e0:	c3                   	ret
+
+000007e1 <getpid>:
+SYSCALL(getpid)
+ 7e1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7e6:	cd 40                	int    $0x40
+ 7e8:	c3                   	ret
+
+000007e9 <sbrk>:
+SYSCALL(sbrk)
+ 7e9:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7ee:	cd 40                	int    $0x40
+ 7f0:	c3                   	ret
+
+000007f1 <sleep>:
+SYSCALL(sleep)
+ 7f1:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7f6:	cd 40                	int    $0x40
+ 7f8:	c3                   	ret
+
+000007f9 <uptime>:
+SYSCALL(uptime)
+ 7f9:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7fe:	cd 40                	int    $0x40
+ 800:	c3                   	ret
+
+00000801 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 801:	b8 16 00 00 00       	mov    $0x16,%eax
+ 806:	cd 40                	int    $0x40
+ 808:	c3                   	ret
+
+00000809 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 809:	b8 17 00 00 00       	mov    $0x17,%eax
+ 80e:	cd 40                	int    $0x40
+ 810:	c3                   	ret
+
+00000811 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 811:	b8 18 00 00 00       	mov    $0x18,%eax
+ 816:	cd 40                	int    $0x40
+ 818:	c3                   	ret
+
+00000819 <copy_file>:
+SYSCALL(copy_file)
+ 819:	b8 19 00 00 00       	mov    $0x19,%eax
+ 81e:	cd 40                	int    $0x40
+ 820:	c3                   	ret
+
+00000821 <change_queue>:
+SYSCALL(change_queue)
+ 821:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 826:	cd 40                	int    $0x40
+ 828:	c3                   	ret
+
+00000829 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 829:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 82e:	cd 40                	int    $0x40
+ 830:	c3                   	ret
+
+00000831 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 831:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 836:	cd 40                	int    $0x40
+ 838:	c3                   	ret
+
+00000839 <print_process_info>:
+SYSCALL(print_process_info)
+ 839:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 83e:	cd 40                	int    $0x40
+ 840:	c3                   	ret
+
+00000841 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 841:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 846:	cd 40                	int    $0x40
+ 848:	c3                   	ret
+
+00000849 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 849:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 84e:	cd 40                	int    $0x40
+ 850:	c3                   	ret
+
+00000851 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 851:	b8 20 00 00 00       	mov    $0x20,%eax
+ 856:	cd 40                	int    $0x40
+ 858:	c3                   	ret
+
+00000859 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 859:	b8 21 00 00 00       	mov    $0x21,%eax
+ 85e:	cd 40                	int    $0x40
+ 860:	c3                   	ret
+
+00000861 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 861:	b8 22 00 00 00       	mov    $0x22,%eax
+ 866:	cd 40                	int    $0x40
+ 868:	c3                   	ret
+
+00000869 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 869:	b8 23 00 00 00       	mov    $0x23,%eax
+ 86e:	cd 40                	int    $0x40
+ 870:	c3                   	ret
+
+00000871 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 871:	b8 24 00 00 00       	mov    $0x24,%eax
+ 876:	cd 40                	int    $0x40
+ 878:	c3                   	ret
+
+00000879 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 879:	b8 25 00 00 00       	mov    $0x25,%eax
+ 87e:	cd 40                	int    $0x40
+ 880:	c3                   	ret
+
+00000881 <set_affinity>:
+SYSCALL(set_affinity)
+ 881:	b8 26 00 00 00       	mov    $0x26,%eax
+ 886:	cd 40                	int    $0x40
+ 888:	c3                   	ret
+
+00000889 <setsched>:
+SYSCALL(setsched)
+ 889:	b8 27 00 00 00       	mov    $0x27,%eax
+ 88e:	cd 40                	int    $0x40
+ 890:	c3                   	ret
+
+00000891 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 891:	b8 28 00 00 00       	mov    $0x28,%eax
+ 896:	cd 40                	int    $0x40
+ 898:	c3                   	ret
+
+00000899 <set_quantum>:
+SYSCALL(set_quantum)
+ 899:	b8 29 00 00 00       	mov    $0x29,%eax
+ 89e:	cd 40                	int    $0x40
+ 8a0:	c3                   	ret
+
+000008a1 <schedtrace>:
+SYSCALL(schedtrace)
+ 8a1:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 8a6:	cd 40                	int    $0x40
+ 8a8:	c3                   	ret
+
+000008a9 <getrusage>:
+SYSCALL(getrusage)
+ 8a9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 8ae:	cd 40                	int    $0x40
+ 8b0:	c3                   	ret
+
+000008b1 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 8b1:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8b6:	cd 40                	int    $0x40
+ 8b8:	c3                   	ret
+
+000008b9 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 8b9:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 8be:	cd 40                	int    $0x40
+ 8c0:	c3                   	ret
+
+000008c1 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 8c1:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 8c6:	cd 40                	int    $0x40
+ 8c8:	c3                   	ret
+
+000008c9 <futex_wait>:
+SYSCALL(futex_wait)
+ 8c9:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 8ce:	cd 40                	int    $0x40
+ 8d0:	c3                   	ret
+
+000008d1 <futex_wake>:
+SYSCALL(futex_wake)
+ 8d1:	b8 30 00 00 00       	mov    $0x30,%eax
+ 8d6:	cd 40                	int    $0x40
+ 8d8:	c3                   	ret
+
+000008d9 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 8d9:	b8 31 00 00 00       	mov    $0x31,%eax
+ 8de:	cd 40                	int    $0x40
+ 8e0:	c3                   	ret
+
+000008e1 <submit_batch>:
+SYSCALL(submit_batch)
+ 8e1:	b8 32 00 00 00       	mov    $0x32,%eax
+ 8e6:	cd 40                	int    $0x40
+ 8e8:	c3                   	ret
+
+000008e9 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 8e9:	b8 33 00 00 00       	mov    $0x33,%eax
+ 8ee:	cd 40                	int    $0x40
+ 8f0:	c3                   	ret
+
+000008f1 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 8f1:	b8 34 00 00 00       	mov    $0x34,%eax
+ 8f6:	cd 40                	int    $0x40
+ 8f8:	c3                   	ret
+
+000008f9 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 8f9:	55                   	push   %ebp
+ 8fa:	89 e5                	mov    %esp,%ebp
+ 8fc:	83 ec 18             	sub    $0x18,%esp
+ 8ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 902:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 905:	83 ec 04             	sub    $0x4,%esp
+ 908:	6a 01                	push   $0x1
+ 90a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 90d:	50                   	push   %eax
+ 90e:	ff 75 08             	push   0x8(%ebp)
+ 911:	e8 6b fe ff ff       	call   781 <write>
+ 916:	83 c4 10             	add    $0x10,%esp
+}
+ 919:	90                   	nop
+ 91a:	c9                   	leave
+ 91b:	c3                   	ret
+
+0000091c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 91c:	55                   	push   %ebp
+ 91d:	89 e5                	mov    %esp,%ebp
+ 91f:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 922:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 929:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 92d:	74 17                	je     946 <printint+0x2a>
+ 92f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 933:	79 11                	jns    946 <printint+0x2a>
+    neg = 1;
+ 935:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 93c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 93f:	f7 d8                	neg    %eax
+ 941:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 944:	eb 06                	jmp    94c <printint+0x30>
+  } else {
+    x = xx;
+ 946:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 949:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 94c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 953:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 956:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 959:	ba 00 00 00 00       	mov    $0x0,%edx
+ 95e:	f7 f1                	div    %ecx
+ 960:	89 d1                	mov    %edx,%ecx
+ 962:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 965:	8d 50 01             	lea    0x1(%eax),%edx
+ 968:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 96b:	0f b6 91 fc 14 00 00 	movzbl 0x14fc(%ecx),%edx
+ 972:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 976:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 979:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 97c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 981:	f7 f1                	div    %ecx
+ 983:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 986:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 98a:	75 c7                	jne    953 <printint+0x37>
+  if(neg)
+ 98c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 990:	74 2d                	je     9bf <printint+0xa3>
+    buf[i++] = '-';
+ 992:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 995:	8d 50 01             	lea    0x1(%eax),%edx
+ 998:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 99b:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 9a0:	eb 1d                	jmp    9bf <printint+0xa3>
+    putc(fd, buf[i]);
+ 9a2:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 9a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a8:	01 d0                	add    %edx,%eax
+ 9aa:	0f b6 00             	movzbl (%eax),%eax
+ 9ad:	0f be c0             	movsbl %al,%eax
+ 9b0:	83 ec 08             	sub    $0x8,%esp
+ 9b3:	50                   	push   %eax
+ 9b4:	ff 75 08             	push   0x8(%ebp)
+ 9b7:	e8 3d ff ff ff       	call   8f9 <putc>
+ 9bc:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 9bf:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 9c3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9c7:	79 d9                	jns    9a2 <printint+0x86>
+}
+ 9c9:	90                   	nop
+ 9ca:	90                   	nop
+ 9cb:	c9                   	leave
+ 9cc:	c3                   	ret
+
+000009cd <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9cd:	55                   	push   %ebp
+ 9ce:	89 e5                	mov    %esp,%ebp
+ 9d0:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 9d3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 9da:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 9dd:	83 c0 04             	add    $0x4,%eax
+ 9e0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9e3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 9ea:	e9 59 01 00 00       	jmp    b48 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 9ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9f2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9f5:	01 d0                	add    %edx,%eax
+ 9f7:	0f b6 00             	movzbl (%eax),%eax
+ 9fa:	0f be c0             	movsbl %al,%eax
+ 9fd:	25 ff 00 00 00       	and    $0xff,%eax
+ a02:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ a05:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ a09:	75 2c                	jne    a37 <printf+0x6a>
+      if(c == '%'){
+ a0b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a0f:	75 0c                	jne    a1d <printf+0x50>
+        state = '%';
+ a11:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ a18:	e9 27 01 00 00       	jmp    b44 <printf+0x177>
+      } else {
+        putc(fd, c);
+ a1d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a20:	0f be c0             	movsbl %al,%eax
+ a23:	83 ec 08             	sub    $0x8,%esp
+ a26:	50                   	push   %eax
+ a27:	ff 75 08             	push   0x8(%ebp)
+ a2a:	e8 ca fe ff ff       	call   8f9 <putc>
+ a2f:	83 c4 10             	add    $0x10,%esp
+ a32:	e9 0d 01 00 00       	jmp    b44 <printf+0x177>
+      }
+    } else if(state == '%'){
+ a37:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ a3b:	0f 85 03 01 00 00    	jne    b44 <printf+0x177>
+      if(c == 'd'){
+ a41:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ a45:	75 1e                	jne    a65 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ a47:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a4a:	8b 00                	mov    (%eax),%eax
+ a4c:	6a 01                	push   $0x1
+ a4e:	6a 0a                	push   $0xa
+ a50:	50                   	push   %eax
+ a51:	ff 75 08             	push   0x8(%ebp)
+ a54:	e8 c3 fe ff ff       	call   91c <printint>
+ a59:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a5c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a60:	e9 d8 00 00 00       	jmp    b3d <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ a65:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ a69:	74 06                	je     a71 <printf+0xa4>
+ a6b:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ a6f:	75 1e                	jne    a8f <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ a71:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a74:	8b 00                	mov    (%eax),%eax
+ a76:	6a 00                	push   $0x0
+ a78:	6a 10                	push   $0x10
+ a7a:	50                   	push   %eax
+ a7b:	ff 75 08             	push   0x8(%ebp)
+ a7e:	e8 99 fe ff ff       	call   91c <printint>
+ a83:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a86:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a8a:	e9 ae 00 00 00       	jmp    b3d <printf+0x170>
+      } else if(c == 's'){
+ a8f:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a93:	75 43                	jne    ad8 <printf+0x10b>
+        s = (char*)*ap;
+ a95:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a98:	8b 00                	mov    (%eax),%eax
+ a9a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a9d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ aa1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ aa5:	75 25                	jne    acc <printf+0xff>
+          s = "(null)";
+ aa7:	c7 45 f4 51 10 00 00 	movl   $0x1051,-0xc(%ebp)
+        while(*s != 0){
+ aae:	eb 1c                	jmp    acc <printf+0xff>
+          putc(fd, *s);
+ ab0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab3:	0f b6 00             	movzbl (%eax),%eax
+ ab6:	0f be c0             	movsbl %al,%eax
+ ab9:	83 ec 08             	sub    $0x8,%esp
+ abc:	50                   	push   %eax
+ abd:	ff 75 08             	push   0x8(%ebp)
+ ac0:	e8 34 fe ff ff       	call   8f9 <putc>
+ ac5:	83 c4 10             	add    $0x10,%esp
+          s++;
+ ac8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ acc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ acf:	0f b6 00             	movzbl (%eax),%eax
+ ad2:	84 c0                	test   %al,%al
+ ad4:	75 da                	jne    ab0 <printf+0xe3>
+ ad6:	eb 65                	jmp    b3d <printf+0x170>
+        }
+      } else if(c == 'c'){
+ ad8:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ adc:	75 1d                	jne    afb <printf+0x12e>
+        putc(fd, *ap);
+ ade:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ ae1:	8b 00                	mov    (%eax),%eax
+ ae3:	0f be c0             	movsbl %al,%eax
+ ae6:	83 ec 08             	sub    $0x8,%esp
+ ae9:	50                   	push   %eax
+ aea:	ff 75 08             	push   0x8(%ebp)
+ aed:	e8 07 fe ff ff       	call   8f9 <putc>
+ af2:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ af5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ af9:	eb 42                	jmp    b3d <printf+0x170>
+      } else if(c == '%'){
+ afb:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ aff:	75 17                	jne    b18 <printf+0x14b>
+        putc(fd, c);
+ b01:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b04:	0f be c0             	movsbl %al,%eax
+ b07:	83 ec 08             	sub    $0x8,%esp
+ b0a:	50                   	push   %eax
+ b0b:	ff 75 08             	push   0x8(%ebp)
+ b0e:	e8 e6 fd ff ff       	call   8f9 <putc>
+ b13:	83 c4 10             	add    $0x10,%esp
+ b16:	eb 25                	jmp    b3d <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ b18:	83 ec 08             	sub    $0x8,%esp
+ b1b:	6a 25                	push   $0x25
+ b1d:	ff 75 08             	push   0x8(%ebp)
+ b20:	e8 d4 fd ff ff       	call   8f9 <putc>
+ b25:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ b28:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b2b:	0f be c0             	movsbl %al,%eax
+ b2e:	83 ec 08             	sub    $0x8,%esp
+ b31:	50                   	push   %eax
+ b32:	ff 75 08             	push   0x8(%ebp)
+ b35:	e8 bf fd ff ff       	call   8f9 <putc>
+ b3a:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ b3d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b44:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b48:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b4b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b4e:	01 d0                	add    %edx,%eax
+ b50:	0f b6 00             	movzbl (%eax),%eax
+ b53:	84 c0                	test   %al,%al
+ b55:	0f 85 94 fe ff ff    	jne    9ef <printf+0x22>
+    }
+  }
+}
+ b5b:	90                   	nop
+ b5c:	90                   	nop
+ b5d:	c9                   	leave
+ b5e:	c3                   	ret
+
+00000b5f <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b5f:	55                   	push   %ebp
+ b60:	89 e5                	mov    %esp,%ebp
+ b62:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b65:	8b 45 08             	mov    0x8(%ebp),%eax
+ b68:	83 e8 08             	sub    $0x8,%eax
+ b6b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b6e:	a1 40 9c 00 00       	mov    0x9c40,%eax
+ b73:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b76:	eb 24                	jmp    b9c <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b78:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b7b:	8b 00                	mov    (%eax),%eax
+ b7d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b80:	72 12                	jb     b94 <free+0x35>
+ b82:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b85:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b88:	72 24                	jb     bae <free+0x4f>
+ b8a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b8d:	8b 00                	mov    (%eax),%eax
+ b8f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b92:	72 1a                	jb     bae <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b94:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b97:	8b 00                	mov    (%eax),%eax
+ b99:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b9c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b9f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ba2:	73 d4                	jae    b78 <free+0x19>
+ ba4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba7:	8b 00                	mov    (%eax),%eax
+ ba9:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ bac:	73 ca                	jae    b78 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bae:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bb1:	8b 40 04             	mov    0x4(%eax),%eax
+ bb4:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bbb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bbe:	01 c2                	add    %eax,%edx
+ bc0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc3:	8b 00                	mov    (%eax),%eax
+ bc5:	39 c2                	cmp    %eax,%edx
+ bc7:	75 24                	jne    bed <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ bc9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bcc:	8b 50 04             	mov    0x4(%eax),%edx
+ bcf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd2:	8b 00                	mov    (%eax),%eax
+ bd4:	8b 40 04             	mov    0x4(%eax),%eax
+ bd7:	01 c2                	add    %eax,%edx
+ bd9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bdc:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bdf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be2:	8b 00                	mov    (%eax),%eax
+ be4:	8b 10                	mov    (%eax),%edx
+ be6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ be9:	89 10                	mov    %edx,(%eax)
+ beb:	eb 0a                	jmp    bf7 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ bed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf0:	8b 10                	mov    (%eax),%edx
+ bf2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bf5:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ bf7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bfa:	8b 40 04             	mov    0x4(%eax),%eax
+ bfd:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c04:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c07:	01 d0                	add    %edx,%eax
+ c09:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ c0c:	75 20                	jne    c2e <free+0xcf>
+    p->s.size += bp->s.size;
+ c0e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c11:	8b 50 04             	mov    0x4(%eax),%edx
+ c14:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c17:	8b 40 04             	mov    0x4(%eax),%eax
+ c1a:	01 c2                	add    %eax,%edx
+ c1c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c1f:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c22:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c25:	8b 10                	mov    (%eax),%edx
+ c27:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c2a:	89 10                	mov    %edx,(%eax)
+ c2c:	eb 08                	jmp    c36 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ c2e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c31:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ c34:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c36:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c39:	a3 40 9c 00 00       	mov    %eax,0x9c40
+}
+ c3e:	90                   	nop
+ c3f:	c9                   	leave
+ c40:	c3                   	ret
+
+00000c41 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c41:	55                   	push   %ebp
+ c42:	89 e5                	mov    %esp,%ebp
+ c44:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c47:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c4e:	77 07                	ja     c57 <morecore+0x16>
+    nu = 4096;
+ c50:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c57:	8b 45 08             	mov    0x8(%ebp),%eax
+ c5a:	c1 e0 03             	shl    $0x3,%eax
+ c5d:	83 ec 0c             	sub    $0xc,%esp
+ c60:	50                   	push   %eax
+ c61:	e8 83 fb ff ff       	call   7e9 <sbrk>
+ c66:	83 c4 10             	add    $0x10,%esp
+ c69:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c6c:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c70:	75 07                	jne    c79 <morecore+0x38>
+    return 0;
+ c72:	b8 00 00 00 00       	mov    $0x0,%eax
+ c77:	eb 26                	jmp    c9f <morecore+0x5e>
+  hp = (Header*)p;
+ c79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c7c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c7f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c82:	8b 55 08             	mov    0x8(%ebp),%edx
+ c85:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ c88:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c8b:	83 c0 08             	add    $0x8,%eax
+ c8e:	83 ec 0c             	sub    $0xc,%esp
+ c91:	50                   	push   %eax
+ c92:	e8 c8 fe ff ff       	call   b5f <free>
+ c97:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c9a:	a1 40 9c 00 00       	mov    0x9c40,%eax
+}
+ c9f:	c9                   	leave
+ ca0:	c3                   	ret
+
+00000ca1 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ca1:	55                   	push   %ebp
+ ca2:	89 e5                	mov    %esp,%ebp
+ ca4:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ca7:	8b 45 08             	mov    0x8(%ebp),%eax
+ caa:	83 c0 07             	add    $0x7,%eax
+ cad:	c1 e8 03             	shr    $0x3,%eax
+ cb0:	83 c0 01             	add    $0x1,%eax
+ cb3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ cb6:	a1 40 9c 00 00       	mov    0x9c40,%eax
+ cbb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cbe:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ cc2:	75 23                	jne    ce7 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ cc4:	c7 45 f0 38 9c 00 00 	movl   $0x9c38,-0x10(%ebp)
+ ccb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cce:	a3 40 9c 00 00       	mov    %eax,0x9c40
+ cd3:	a1 40 9c 00 00       	mov    0x9c40,%eax
+ cd8:	a3 38 9c 00 00       	mov    %eax,0x9c38
+    base.s.size = 0;
+ cdd:	c7 05 3c 9c 00 00 00 	movl   $0x0,0x9c3c
+ ce4:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ce7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cea:	8b 00                	mov    (%eax),%eax
+ cec:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ cef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf2:	8b 40 04             	mov    0x4(%eax),%eax
+ cf5:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ cf8:	72 4d                	jb     d47 <malloc+0xa6>
+      if(p->s.size == nunits)
+ cfa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cfd:	8b 40 04             	mov    0x4(%eax),%eax
+ d00:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ d03:	75 0c                	jne    d11 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ d05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d08:	8b 10                	mov    (%eax),%edx
+ d0a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d0d:	89 10                	mov    %edx,(%eax)
+ d0f:	eb 26                	jmp    d37 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ d11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d14:	8b 40 04             	mov    0x4(%eax),%eax
+ d17:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ d1a:	89 c2                	mov    %eax,%edx
+ d1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d1f:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ d22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d25:	8b 40 04             	mov    0x4(%eax),%eax
+ d28:	c1 e0 03             	shl    $0x3,%eax
+ d2b:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d31:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ d34:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ d37:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d3a:	a3 40 9c 00 00       	mov    %eax,0x9c40
+      return (void*)(p + 1);
+ d3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d42:	83 c0 08             	add    $0x8,%eax
+ d45:	eb 3b                	jmp    d82 <malloc+0xe1>
+    }
+    if(p == freep)
+ d47:	a1 40 9c 00 00       	mov    0x9c40,%eax
+ d4c:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d4f:	75 1e                	jne    d6f <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ d51:	83 ec 0c             	sub    $0xc,%esp
+ d54:	ff 75 ec             	push   -0x14(%ebp)
+ d57:	e8 e5 fe ff ff       	call   c41 <morecore>
+ d5c:	83 c4 10             	add    $0x10,%esp
+ d5f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d62:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d66:	75 07                	jne    d6f <malloc+0xce>
+        return 0;
+ d68:	b8 00 00 00 00       	mov    $0x0,%eax
+ d6d:	eb 13                	jmp    d82 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d72:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d78:	8b 00                	mov    (%eax),%eax
+ d7a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d7d:	e9 6d ff ff ff       	jmp    cef <malloc+0x4e>
+  }
+}
+ d82:	c9                   	leave
+ d83:	c3                   	ret
+
+00000d84 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ d84:	55                   	push   %ebp
+ d85:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ d87:	8b 45 08             	mov    0x8(%ebp),%eax
+ d8a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ d90:	90                   	nop
+ d91:	5d                   	pop    %ebp
+ d92:	c3                   	ret
+
+00000d93 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ d93:	55                   	push   %ebp
+ d94:	89 e5                	mov    %esp,%ebp
+ d96:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ d99:	8b 55 08             	mov    0x8(%ebp),%edx
+ d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+ da1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ da6:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ daa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ dad:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ db1:	74 3b                	je     dee <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ db3:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ db7:	74 2d                	je     de6 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ db9:	8b 55 08             	mov    0x8(%ebp),%edx
+ dbc:	b8 02 00 00 00       	mov    $0x2,%eax
+ dc1:	87 02                	xchg   %eax,(%edx)
+ dc3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ dc6:	eb 1e                	jmp    de6 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ dc8:	8b 45 08             	mov    0x8(%ebp),%eax
+ dcb:	83 ec 08             	sub    $0x8,%esp
+ dce:	6a 02                	push   $0x2
+ dd0:	50                   	push   %eax
+ dd1:	e8 f3 fa ff ff       	call   8c9 <futex_wait>
+ dd6:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ dd9:	8b 55 08             	mov    0x8(%ebp),%edx
+ ddc:	b8 02 00 00 00       	mov    $0x2,%eax
+ de1:	87 02                	xchg   %eax,(%edx)
+ de3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ de6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ dea:	75 dc                	jne    dc8 <mutex_lock+0x35>
+ dec:	eb 01                	jmp    def <mutex_lock+0x5c>
+    return;
+ dee:	90                   	nop
+  }
+}
+ def:	c9                   	leave
+ df0:	c3                   	ret
+
+00000df1 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ df1:	55                   	push   %ebp
+ df2:	89 e5                	mov    %esp,%ebp
+ df4:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ df7:	8b 45 08             	mov    0x8(%ebp),%eax
+ dfa:	ba 01 00 00 00       	mov    $0x1,%edx
+ dff:	f7 da                	neg    %edx
+ e01:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ e05:	83 fa 01             	cmp    $0x1,%edx
+ e08:	74 1a                	je     e24 <mutex_unlock+0x33>
+    m->state = 0;
+ e0a:	8b 45 08             	mov    0x8(%ebp),%eax
+ e0d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ e13:	8b 45 08             	mov    0x8(%ebp),%eax
+ e16:	83 ec 08             	sub    $0x8,%esp
+ e19:	6a 01                	push   $0x1
+ e1b:	50                   	push   %eax
+ e1c:	e8 b0 fa ff ff       	call   8d1 <futex_wake>
+ e21:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ e24:	90                   	nop
+ e25:	c9                   	leave
+ e26:	c3                   	ret
+
+00000e27 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ e27:	55                   	push   %ebp
+ e28:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ e2a:	8b 45 08             	mov    0x8(%ebp),%eax
+ e2d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ e33:	8b 45 08             	mov    0x8(%ebp),%eax
+ e36:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ e3d:	90                   	nop
+ e3e:	5d                   	pop    %ebp
+ e3f:	c3                   	ret
+
+00000e40 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ e40:	55                   	push   %ebp
+ e41:	89 e5                	mov    %esp,%ebp
+ e43:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ e46:	8b 45 08             	mov    0x8(%ebp),%eax
+ e49:	83 c0 04             	add    $0x4,%eax
+ e4c:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ e50:	8b 45 08             	mov    0x8(%ebp),%eax
+ e53:	83 ec 08             	sub    $0x8,%esp
+ e56:	ff 75 0c             	push   0xc(%ebp)
+ e59:	50                   	push   %eax
+ e5a:	e8 6a fa ff ff       	call   8c9 <futex_wait>
+ e5f:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ e62:	8b 45 08             	mov    0x8(%ebp),%eax
+ e65:	83 c0 04             	add    $0x4,%eax
+ e68:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ e6c:	90                   	nop
+ e6d:	c9                   	leave
+ e6e:	c3                   	ret
+
+00000e6f <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ e6f:	55                   	push   %ebp
+ e70:	89 e5                	mov    %esp,%ebp
+ e72:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ e75:	8b 45 08             	mov    0x8(%ebp),%eax
+ e78:	8b 00                	mov    (%eax),%eax
+ e7a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ e7d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e81:	78 17                	js     e9a <rwlock_rdlock+0x2b>
+ e83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e86:	83 c0 01             	add    $0x1,%eax
+ e89:	89 c1                	mov    %eax,%ecx
+ e8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e8e:	8b 55 08             	mov    0x8(%ebp),%edx
+ e91:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ e95:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ e98:	74 19                	je     eb3 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ e9a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e9e:	79 d5                	jns    e75 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ ea0:	83 ec 08             	sub    $0x8,%esp
+ ea3:	ff 75 f4             	push   -0xc(%ebp)
+ ea6:	ff 75 08             	push   0x8(%ebp)
+ ea9:	e8 92 ff ff ff       	call   e40 <rwlock_sleep>
+ eae:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ eb1:	eb c2                	jmp    e75 <rwlock_rdlock+0x6>
+      return;
+ eb3:	90                   	nop
+  }
+}
+ eb4:	c9                   	leave
+ eb5:	c3                   	ret
+
+00000eb6 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ eb6:	55                   	push   %ebp
+ eb7:	89 e5                	mov    %esp,%ebp
+ eb9:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ ebc:	eb 11                	jmp    ecf <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ ebe:	83 ec 08             	sub    $0x8,%esp
+ ec1:	ff 75 f4             	push   -0xc(%ebp)
+ ec4:	ff 75 08             	push   0x8(%ebp)
+ ec7:	e8 74 ff ff ff       	call   e40 <rwlock_sleep>
+ ecc:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ ecf:	8b 55 08             	mov    0x8(%ebp),%edx
+ ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+ ed7:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ edc:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ ee0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ee3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ee7:	75 d5                	jne    ebe <rwlock_wrlock+0x8>
+}
+ ee9:	90                   	nop
+ eea:	90                   	nop
+ eeb:	c9                   	leave
+ eec:	c3                   	ret
+
+00000eed <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ eed:	55                   	push   %ebp
+ eee:	89 e5                	mov    %esp,%ebp
+ ef0:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ ef3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ef6:	8b 00                	mov    (%eax),%eax
+ ef8:	85 c0                	test   %eax,%eax
+ efa:	79 0c                	jns    f08 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ efc:	8b 45 08             	mov    0x8(%ebp),%eax
+ eff:	ba 00 00 00 00       	mov    $0x0,%edx
+ f04:	87 10                	xchg   %edx,(%eax)
+ f06:	eb 18                	jmp    f20 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ f08:	8b 55 08             	mov    0x8(%ebp),%edx
+ f0b:	b8 01 00 00 00       	mov    $0x1,%eax
+ f10:	f7 d8                	neg    %eax
+ f12:	89 c1                	mov    %eax,%ecx
+ f14:	89 c8                	mov    %ecx,%eax
+ f16:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ f1a:	01 c8                	add    %ecx,%eax
+ f1c:	85 c0                	test   %eax,%eax
+ f1e:	75 20                	jne    f40 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ f20:	8b 45 08             	mov    0x8(%ebp),%eax
+ f23:	8b 40 04             	mov    0x4(%eax),%eax
+ f26:	85 c0                	test   %eax,%eax
+ f28:	74 17                	je     f41 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ f2a:	8b 45 08             	mov    0x8(%ebp),%eax
+ f2d:	83 ec 08             	sub    $0x8,%esp
+ f30:	68 ff ff ff 7f       	push   $0x7fffffff
+ f35:	50                   	push   %eax
+ f36:	e8 96 f9 ff ff       	call   8d1 <futex_wake>
+ f3b:	83 c4 10             	add    $0x10,%esp
+ f3e:	eb 01                	jmp    f41 <rwlock_unlock+0x54>
+    return;
+ f40:	90                   	nop
+}
+ f41:	c9                   	leave
+ f42:	c3                   	ret
+
+00000f43 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ f43:	55                   	push   %ebp
+ f44:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ f46:	8b 45 08             	mov    0x8(%ebp),%eax
+ f49:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ f4f:	90                   	nop
+ f50:	5d                   	pop    %ebp
+ f51:	c3                   	ret
+
+00000f52 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ f52:	55                   	push   %ebp
+ f53:	89 e5                	mov    %esp,%ebp
+ f55:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ f58:	8b 45 08             	mov    0x8(%ebp),%eax
+ f5b:	8b 00                	mov    (%eax),%eax
+ f5d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ f60:	83 ec 0c             	sub    $0xc,%esp
+ f63:	ff 75 0c             	push   0xc(%ebp)
+ f66:	e8 86 fe ff ff       	call   df1 <mutex_unlock>
+ f6b:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ f6e:	8b 45 08             	mov    0x8(%ebp),%eax
+ f71:	83 ec 08             	sub    $0x8,%esp
+ f74:	ff 75 f4             	push   -0xc(%ebp)
+ f77:	50                   	push   %eax
+ f78:	e8 4c f9 ff ff       	call   8c9 <futex_wait>
+ f7d:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ f80:	83 ec 0c             	sub    $0xc,%esp
+ f83:	ff 75 0c             	push   0xc(%ebp)
+ f86:	e8 08 fe ff ff       	call   d93 <mutex_lock>
+ f8b:	83 c4 10             	add    $0x10,%esp
+}
+ f8e:	90                   	nop
+ f8f:	c9                   	leave
+ f90:	c3                   	ret
+
+00000f91 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ f91:	55                   	push   %ebp
+ f92:	89 e5                	mov    %esp,%ebp
+ f94:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ f97:	8b 45 08             	mov    0x8(%ebp),%eax
+ f9a:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ f9e:	8b 45 08             	mov    0x8(%ebp),%eax
+ fa1:	83 ec 08             	sub    $0x8,%esp
+ fa4:	6a 01                	push   $0x1
+ fa6:	50                   	push   %eax
+ fa7:	e8 25 f9 ff ff       	call   8d1 <futex_wake>
+ fac:	83 c4 10             	add    $0x10,%esp
+}
+ faf:	90                   	nop
+ fb0:	c9                   	leave
+ fb1:	c3                   	ret
+
+00000fb2 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ fb2:	55                   	push   %ebp
+ fb3:	89 e5                	mov    %esp,%ebp
+ fb5:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ fb8:	8b 45 08             	mov    0x8(%ebp),%eax
+ fbb:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ fbf:	8b 45 08             	mov    0x8(%ebp),%eax
+ fc2:	83 ec 08             	sub    $0x8,%esp
+ fc5:	68 ff ff ff 7f       	push   $0x7fffffff
+ fca:	50                   	push   %eax
+ fcb:	e8 01 f9 ff ff       	call   8d1 <futex_wake>
+ fd0:	83 c4 10             	add    $0x10,%esp
+}
+ fd3:	90                   	nop
+ fd4:	c9                   	leave
+ fd5:	c3                   	ret
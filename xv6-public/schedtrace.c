@@ -0,0 +1,128 @@
+#include "types.h"
+#include "user.h"
+#include "schedtrace.h"
+
+// Drains the kernel's scheduling event rings for a number of ticks
+// and prints, per MLFQ level, a log2 histogram of run-queue wait:
+// the cycles from a process being queued to it being dispatched.
+
+#define MAXEVENTS 2048 // NCPU * TRACE_RING
+#define NLEVELS 4      // UNSET, RR, LCFS, BJF
+#define NBUCKETS 64
+#define NWAITING 64
+
+struct waiting
+{
+    int pid;
+    uint64 since; // When it was queued, or 0 if it is not
+};
+
+static struct trace_event events[MAXEVENTS];
+static struct waiting waiting[NWAITING];
+static uint hist[NLEVELS][NBUCKETS];
+static uint dispatches[NLEVELS];
+static uint queue_changes, promotions;
+static char *levels[NLEVELS] = {"UNSET", "RR", "LCFS", "BJF"};
+
+int ilog2(uint64 v)
+{
+    int k = 0;
+    while (v >>= 1)
+        k++;
+    return k;
+}
+
+// The rings are drained one CPU after another; put the events
+// back into time order. Each CPU's run is already sorted.
+void sort_events(int n)
+{
+    struct trace_event e;
+    int i, j;
+
+    for (i = 1; i < n; i++)
+    {
+        e = events[i];
+        for (j = i; j > 0 && events[j - 1].tsc > e.tsc; j--)
+            events[j] = events[j - 1];
+        events[j] = e;
+    }
+}
+
+struct waiting *lookup(int pid)
+{
+    struct waiting *w = &waiting[pid % NWAITING];
+    if (w->pid != pid)
+    {
+        w->pid = pid;
+        w->since = 0;
+    }
+    return w;
+}
+
+void account(struct trace_event *e)
+{
+    struct waiting *w = lookup(e->pid);
+    int level = e->queue < NLEVELS ? e->queue : 0;
+
+    switch (e->type)
+    {
+    case TRACE_WAKEUP:
+        w->since = e->tsc;
+        break;
+    case TRACE_SWITCH_OUT:
+        // Preempted or yielded: it waits on a run queue again.
+        w->since = e->arg ? e->tsc : 0;
+        break;
+    case TRACE_SWITCH_IN:
+        if (w->since != 0 && e->tsc >= w->since)
+        {
+            hist[level][ilog2(e->tsc - w->since)]++;
+            dispatches[level]++;
+        }
+        w->since = 0;
+        break;
+    case TRACE_QUEUE_CHANGE:
+        queue_changes++;
+        break;
+    case TRACE_AGING:
+        promotions++;
+        break;
+    }
+}
+
+void report(void)
+{
+    int level, k;
+
+    for (level = 1; level < NLEVELS; level++)
+    {
+        printf(1, "%s: %d dispatches\n", levels[level], dispatches[level]);
+        for (k = 0; k < NBUCKETS; k++)
+            if (hist[level][k])
+                printf(1, "    2^%d cycles\t%d\n", k, hist[level][k]);
+    }
+    printf(1, "queue changes: %d, aging promotions: %d\n", queue_changes, promotions);
+}
+
+int main(int argc, char *argv[])
+{
+    int duration = 100, n, i, t;
+
+    if (argc > 1)
+        duration = atoi(argv[1]);
+
+    // Discard whatever was recorded before we started.
+    while (schedtrace(events, MAXEVENTS) == MAXEVENTS)
+        ;
+
+    for (t = 0; t < duration; t++)
+    {
+        sleep(1);
+        n = schedtrace(events, MAXEVENTS);
+        sort_events(n);
+        for (i = 0; i < n; i++)
+            account(&events[i]);
+    }
+    report();
+    exit();
+}
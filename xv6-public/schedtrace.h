@@ -0,0 +1,23 @@
+// Scheduling events recorded by trace.c and drained
+// to user space with the schedtrace system call.
+
+#define TRACE_RING 256 // Events per CPU; a power of two
+
+enum traceevent
+{
+  TRACE_SWITCH_IN,     // scheduler() dispatched the process
+  TRACE_SWITCH_OUT,    // The process gave the CPU back
+  TRACE_WAKEUP,        // The process was put on a run queue
+  TRACE_QUEUE_CHANGE,  // change_queue() moved it to another level
+  TRACE_AGING,         // age_proc() promoted it to RR
+};
+
+struct trace_event
+{
+  uint64 tsc;  // rdtsc() when the event happened
+  int pid;
+  uchar type;  // enum traceevent
+  uchar queue; // Level after the event
+  uchar cpu;   // CPU that recorded the event
+  uchar arg;   // SWITCH_OUT: still runnable; QUEUE_CHANGE, AGING: old level
+};
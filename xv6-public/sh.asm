@@ -0,0 +1,3255 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <runcmd>:
+void panic(char *);
+struct cmd *parsecmd(char *);
+
+// Execute cmd.  Never returns.
+void runcmd(struct cmd *cmd)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 28             	sub    $0x28,%esp
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if (cmd == 0)
+       6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+       a:	75 05                	jne    11 <runcmd+0x11>
+    exit();
+       c:	e8 a9 0f 00 00       	call   fba <exit>
+
+  switch (cmd->type)
+      11:	8b 45 08             	mov    0x8(%ebp),%eax
+      14:	8b 00                	mov    (%eax),%eax
+      16:	83 f8 05             	cmp    $0x5,%eax
+      19:	77 09                	ja     24 <runcmd+0x24>
+      1b:	8b 04 85 5c 18 00 00 	mov    0x185c(,%eax,4),%eax
+      22:	ff e0                	jmp    *%eax
+  {
+  default:
+    panic("runcmd");
+      24:	83 ec 0c             	sub    $0xc,%esp
+      27:	68 30 18 00 00       	push   $0x1830
+      2c:	e8 73 03 00 00       	call   3a4 <panic>
+      31:	83 c4 10             	add    $0x10,%esp
+
+  case EXEC:
+    ecmd = (struct execcmd *)cmd;
+      34:	8b 45 08             	mov    0x8(%ebp),%eax
+      37:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if (ecmd->argv[0] == 0)
+      3a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      3d:	8b 40 04             	mov    0x4(%eax),%eax
+      40:	85 c0                	test   %eax,%eax
+      42:	75 05                	jne    49 <runcmd+0x49>
+      exit();
+      44:	e8 71 0f 00 00       	call   fba <exit>
+    reset_syscall_count();
+      49:	e8 74 10 00 00       	call   10c2 <reset_syscall_count>
+    exec(ecmd->argv[0], ecmd->argv);
+      4e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      51:	8d 50 04             	lea    0x4(%eax),%edx
+      54:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      57:	8b 40 04             	mov    0x4(%eax),%eax
+      5a:	83 ec 08             	sub    $0x8,%esp
+      5d:	52                   	push   %edx
+      5e:	50                   	push   %eax
+      5f:	e8 8e 0f 00 00       	call   ff2 <exec>
+      64:	83 c4 10             	add    $0x10,%esp
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+      67:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      6a:	8b 40 04             	mov    0x4(%eax),%eax
+      6d:	83 ec 04             	sub    $0x4,%esp
+      70:	50                   	push   %eax
+      71:	68 37 18 00 00       	push   $0x1837
+      76:	6a 02                	push   $0x2
+      78:	e8 a9 11 00 00       	call   1226 <printf>
+      7d:	83 c4 10             	add    $0x10,%esp
+    break;
+      80:	e9 c6 01 00 00       	jmp    24b <runcmd+0x24b>
+
+  case REDIR:
+    rcmd = (struct redircmd *)cmd;
+      85:	8b 45 08             	mov    0x8(%ebp),%eax
+      88:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    close(rcmd->fd);
+      8b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      8e:	8b 40 14             	mov    0x14(%eax),%eax
+      91:	83 ec 0c             	sub    $0xc,%esp
+      94:	50                   	push   %eax
+      95:	e8 48 0f 00 00       	call   fe2 <close>
+      9a:	83 c4 10             	add    $0x10,%esp
+    if (open(rcmd->file, rcmd->mode) < 0)
+      9d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      a0:	8b 50 10             	mov    0x10(%eax),%edx
+      a3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      a6:	8b 40 08             	mov    0x8(%eax),%eax
+      a9:	83 ec 08             	sub    $0x8,%esp
+      ac:	52                   	push   %edx
+      ad:	50                   	push   %eax
+      ae:	e8 47 0f 00 00       	call   ffa <open>
+      b3:	83 c4 10             	add    $0x10,%esp
+      b6:	85 c0                	test   %eax,%eax
+      b8:	79 1e                	jns    d8 <runcmd+0xd8>
+    {
+      printf(2, "open %s failed\n", rcmd->file);
+      ba:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      bd:	8b 40 08             	mov    0x8(%eax),%eax
+      c0:	83 ec 04             	sub    $0x4,%esp
+      c3:	50                   	push   %eax
+      c4:	68 47 18 00 00       	push   $0x1847
+      c9:	6a 02                	push   $0x2
+      cb:	e8 56 11 00 00       	call   1226 <printf>
+      d0:	83 c4 10             	add    $0x10,%esp
+      exit();
+      d3:	e8 e2 0e 00 00       	call   fba <exit>
+    }
+    runcmd(rcmd->cmd);
+      d8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      db:	8b 40 04             	mov    0x4(%eax),%eax
+      de:	83 ec 0c             	sub    $0xc,%esp
+      e1:	50                   	push   %eax
+      e2:	e8 19 ff ff ff       	call   0 <runcmd>
+      e7:	83 c4 10             	add    $0x10,%esp
+    break;
+      ea:	e9 5c 01 00 00       	jmp    24b <runcmd+0x24b>
+
+  case LIST:
+    lcmd = (struct listcmd *)cmd;
+      ef:	8b 45 08             	mov    0x8(%ebp),%eax
+      f2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if (fork1() == 0)
+      f5:	e8 ca 02 00 00       	call   3c4 <fork1>
+      fa:	85 c0                	test   %eax,%eax
+      fc:	75 12                	jne    110 <runcmd+0x110>
+      runcmd(lcmd->left);
+      fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     101:	8b 40 04             	mov    0x4(%eax),%eax
+     104:	83 ec 0c             	sub    $0xc,%esp
+     107:	50                   	push   %eax
+     108:	e8 f3 fe ff ff       	call   0 <runcmd>
+     10d:	83 c4 10             	add    $0x10,%esp
+    wait();
+     110:	e8 ad 0e 00 00       	call   fc2 <wait>
+    runcmd(lcmd->right);
+     115:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     118:	8b 40 08             	mov    0x8(%eax),%eax
+     11b:	83 ec 0c             	sub    $0xc,%esp
+     11e:	50                   	push   %eax
+     11f:	e8 dc fe ff ff       	call   0 <runcmd>
+     124:	83 c4 10             	add    $0x10,%esp
+    break;
+     127:	e9 1f 01 00 00       	jmp    24b <runcmd+0x24b>
+
+  case PIPE:
+    pcmd = (struct pipecmd *)cmd;
+     12c:	8b 45 08             	mov    0x8(%ebp),%eax
+     12f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if (pipe(p) < 0)
+     132:	83 ec 0c             	sub    $0xc,%esp
+     135:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     138:	50                   	push   %eax
+     139:	e8 8c 0e 00 00       	call   fca <pipe>
+     13e:	83 c4 10             	add    $0x10,%esp
+     141:	85 c0                	test   %eax,%eax
+     143:	79 10                	jns    155 <runcmd+0x155>
+      panic("pipe");
+     145:	83 ec 0c             	sub    $0xc,%esp
+     148:	68 57 18 00 00       	push   $0x1857
+     14d:	e8 52 02 00 00       	call   3a4 <panic>
+     152:	83 c4 10             	add    $0x10,%esp
+    if (fork1() == 0)
+     155:	e8 6a 02 00 00       	call   3c4 <fork1>
+     15a:	85 c0                	test   %eax,%eax
+     15c:	75 4c                	jne    1aa <runcmd+0x1aa>
+    {
+      close(1);
+     15e:	83 ec 0c             	sub    $0xc,%esp
+     161:	6a 01                	push   $0x1
+     163:	e8 7a 0e 00 00       	call   fe2 <close>
+     168:	83 c4 10             	add    $0x10,%esp
+      dup(p[1]);
+     16b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     16e:	83 ec 0c             	sub    $0xc,%esp
+     171:	50                   	push   %eax
+     172:	e8 bb 0e 00 00       	call   1032 <dup>
+     177:	83 c4 10             	add    $0x10,%esp
+      close(p[0]);
+     17a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     17d:	83 ec 0c             	sub    $0xc,%esp
+     180:	50                   	push   %eax
+     181:	e8 5c 0e 00 00       	call   fe2 <close>
+     186:	83 c4 10             	add    $0x10,%esp
+      close(p[1]);
+     189:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     18c:	83 ec 0c             	sub    $0xc,%esp
+     18f:	50                   	push   %eax
+     190:	e8 4d 0e 00 00       	call   fe2 <close>
+     195:	83 c4 10             	add    $0x10,%esp
+      runcmd(pcmd->left);
+     198:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     19b:	8b 40 04             	mov    0x4(%eax),%eax
+     19e:	83 ec 0c             	sub    $0xc,%esp
+     1a1:	50                   	push   %eax
+     1a2:	e8 59 fe ff ff       	call   0 <runcmd>
+     1a7:	83 c4 10             	add    $0x10,%esp
+    }
+    if (fork1() == 0)
+     1aa:	e8 15 02 00 00       	call   3c4 <fork1>
+     1af:	85 c0                	test   %eax,%eax
+     1b1:	75 4c                	jne    1ff <runcmd+0x1ff>
+    {
+      close(0);
+     1b3:	83 ec 0c             	sub    $0xc,%esp
+     1b6:	6a 00                	push   $0x0
+     1b8:	e8 25 0e 00 00       	call   fe2 <close>
+     1bd:	83 c4 10             	add    $0x10,%esp
+      dup(p[0]);
+     1c0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1c3:	83 ec 0c             	sub    $0xc,%esp
+     1c6:	50                   	push   %eax
+     1c7:	e8 66 0e 00 00       	call   1032 <dup>
+     1cc:	83 c4 10             	add    $0x10,%esp
+      close(p[0]);
+     1cf:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1d2:	83 ec 0c             	sub    $0xc,%esp
+     1d5:	50                   	push   %eax
+     1d6:	e8 07 0e 00 00       	call   fe2 <close>
+     1db:	83 c4 10             	add    $0x10,%esp
+      close(p[1]);
+     1de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1e1:	83 ec 0c             	sub    $0xc,%esp
+     1e4:	50                   	push   %eax
+     1e5:	e8 f8 0d 00 00       	call   fe2 <close>
+     1ea:	83 c4 10             	add    $0x10,%esp
+      runcmd(pcmd->right);
+     1ed:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     1f0:	8b 40 08             	mov    0x8(%eax),%eax
+     1f3:	83 ec 0c             	sub    $0xc,%esp
+     1f6:	50                   	push   %eax
+     1f7:	e8 04 fe ff ff       	call   0 <runcmd>
+     1fc:	83 c4 10             	add    $0x10,%esp
+    }
+    close(p[0]);
+     1ff:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     202:	83 ec 0c             	sub    $0xc,%esp
+     205:	50                   	push   %eax
+     206:	e8 d7 0d 00 00       	call   fe2 <close>
+     20b:	83 c4 10             	add    $0x10,%esp
+    close(p[1]);
+     20e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     211:	83 ec 0c             	sub    $0xc,%esp
+     214:	50                   	push   %eax
+     215:	e8 c8 0d 00 00       	call   fe2 <close>
+     21a:	83 c4 10             	add    $0x10,%esp
+    wait();
+     21d:	e8 a0 0d 00 00       	call   fc2 <wait>
+    wait();
+     222:	e8 9b 0d 00 00       	call   fc2 <wait>
+    break;
+     227:	eb 22                	jmp    24b <runcmd+0x24b>
+
+  case BACK:
+    bcmd = (struct backcmd *)cmd;
+     229:	8b 45 08             	mov    0x8(%ebp),%eax
+     22c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if (fork1() == 0)
+     22f:	e8 90 01 00 00       	call   3c4 <fork1>
+     234:	85 c0                	test   %eax,%eax
+     236:	75 12                	jne    24a <runcmd+0x24a>
+      runcmd(bcmd->cmd);
+     238:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     23b:	8b 40 04             	mov    0x4(%eax),%eax
+     23e:	83 ec 0c             	sub    $0xc,%esp
+     241:	50                   	push   %eax
+     242:	e8 b9 fd ff ff       	call   0 <runcmd>
+     247:	83 c4 10             	add    $0x10,%esp
+    break;
+     24a:	90                   	nop
+  }
+  exit();
+     24b:	e8 6a 0d 00 00       	call   fba <exit>
+
+00000250 <getcmd>:
+}
+
+int getcmd(char *buf, int nbuf)
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "$ ");
+     256:	83 ec 08             	sub    $0x8,%esp
+     259:	68 74 18 00 00       	push   $0x1874
+     25e:	6a 02                	push   $0x2
+     260:	e8 c1 0f 00 00       	call   1226 <printf>
+     265:	83 c4 10             	add    $0x10,%esp
+  memset(buf, 0, nbuf);
+     268:	8b 45 0c             	mov    0xc(%ebp),%eax
+     26b:	83 ec 04             	sub    $0x4,%esp
+     26e:	50                   	push   %eax
+     26f:	6a 00                	push   $0x0
+     271:	ff 75 08             	push   0x8(%ebp)
+     274:	e8 cc 0a 00 00       	call   d45 <memset>
+     279:	83 c4 10             	add    $0x10,%esp
+  gets(buf, nbuf);
+     27c:	83 ec 08             	sub    $0x8,%esp
+     27f:	ff 75 0c             	push   0xc(%ebp)
+     282:	ff 75 08             	push   0x8(%ebp)
+     285:	e8 08 0b 00 00       	call   d92 <gets>
+     28a:	83 c4 10             	add    $0x10,%esp
+  if (buf[0] == 0) // EOF
+     28d:	8b 45 08             	mov    0x8(%ebp),%eax
+     290:	0f b6 00             	movzbl (%eax),%eax
+     293:	84 c0                	test   %al,%al
+     295:	75 07                	jne    29e <getcmd+0x4e>
+    return -1;
+     297:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     29c:	eb 05                	jmp    2a3 <getcmd+0x53>
+  return 0;
+     29e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     2a3:	c9                   	leave
+     2a4:	c3                   	ret
+
+000002a5 <main>:
+
+int main(void)
+{
+     2a5:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     2a9:	83 e4 f0             	and    $0xfffffff0,%esp
+     2ac:	ff 71 fc             	push   -0x4(%ecx)
+     2af:	55                   	push   %ebp
+     2b0:	89 e5                	mov    %esp,%ebp
+     2b2:	51                   	push   %ecx
+     2b3:	83 ec 14             	sub    $0x14,%esp
+  static char buf[100];
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while ((fd = open("console", O_RDWR)) >= 0)
+     2b6:	eb 16                	jmp    2ce <main+0x29>
+  {
+    if (fd >= 3)
+     2b8:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+     2bc:	7e 10                	jle    2ce <main+0x29>
+    {
+      close(fd);
+     2be:	83 ec 0c             	sub    $0xc,%esp
+     2c1:	ff 75 f4             	push   -0xc(%ebp)
+     2c4:	e8 19 0d 00 00       	call   fe2 <close>
+     2c9:	83 c4 10             	add    $0x10,%esp
+      break;
+     2cc:	eb 1b                	jmp    2e9 <main+0x44>
+  while ((fd = open("console", O_RDWR)) >= 0)
+     2ce:	83 ec 08             	sub    $0x8,%esp
+     2d1:	6a 02                	push   $0x2
+     2d3:	68 77 18 00 00       	push   $0x1877
+     2d8:	e8 1d 0d 00 00       	call   ffa <open>
+     2dd:	83 c4 10             	add    $0x10,%esp
+     2e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     2e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     2e7:	79 cf                	jns    2b8 <main+0x13>
+    }
+  }
+
+  // Read and run input commands.
+  while (getcmd(buf, sizeof(buf)) >= 0)
+     2e9:	e9 97 00 00 00       	jmp    385 <main+0xe0>
+  {
+    if (buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' ')
+     2ee:	0f b6 05 80 1f 00 00 	movzbl 0x1f80,%eax
+     2f5:	3c 63                	cmp    $0x63,%al
+     2f7:	75 5f                	jne    358 <main+0xb3>
+     2f9:	0f b6 05 81 1f 00 00 	movzbl 0x1f81,%eax
+     300:	3c 64                	cmp    $0x64,%al
+     302:	75 54                	jne    358 <main+0xb3>
+     304:	0f b6 05 82 1f 00 00 	movzbl 0x1f82,%eax
+     30b:	3c 20                	cmp    $0x20,%al
+     30d:	75 49                	jne    358 <main+0xb3>
+    {
+      // Chdir must be called by the parent, not the child.
+      buf[strlen(buf) - 1] = 0; // chop \n
+     30f:	83 ec 0c             	sub    $0xc,%esp
+     312:	68 80 1f 00 00       	push   $0x1f80
+     317:	e8 02 0a 00 00       	call   d1e <strlen>
+     31c:	83 c4 10             	add    $0x10,%esp
+     31f:	83 e8 01             	sub    $0x1,%eax
+     322:	c6 80 80 1f 00 00 00 	movb   $0x0,0x1f80(%eax)
+      if (chdir(buf + 3) < 0)
+     329:	b8 83 1f 00 00       	mov    $0x1f83,%eax
+     32e:	83 ec 0c             	sub    $0xc,%esp
+     331:	50                   	push   %eax
+     332:	e8 f3 0c 00 00       	call   102a <chdir>
+     337:	83 c4 10             	add    $0x10,%esp
+     33a:	85 c0                	test   %eax,%eax
+     33c:	79 46                	jns    384 <main+0xdf>
+        printf(2, "cannot cd %s\n", buf + 3);
+     33e:	b8 83 1f 00 00       	mov    $0x1f83,%eax
+     343:	83 ec 04             	sub    $0x4,%esp
+     346:	50                   	push   %eax
+     347:	68 7f 18 00 00       	push   $0x187f
+     34c:	6a 02                	push   $0x2
+     34e:	e8 d3 0e 00 00       	call   1226 <printf>
+     353:	83 c4 10             	add    $0x10,%esp
+      continue;
+     356:	eb 2c                	jmp    384 <main+0xdf>
+    }
+    if (fork1() == 0)
+     358:	e8 67 00 00 00       	call   3c4 <fork1>
+     35d:	85 c0                	test   %eax,%eax
+     35f:	75 1c                	jne    37d <main+0xd8>
+      runcmd(parsecmd(buf));
+     361:	83 ec 0c             	sub    $0xc,%esp
+     364:	68 80 1f 00 00       	push   $0x1f80
+     369:	e8 ad 03 00 00       	call   71b <parsecmd>
+     36e:	83 c4 10             	add    $0x10,%esp
+     371:	83 ec 0c             	sub    $0xc,%esp
+     374:	50                   	push   %eax
+     375:	e8 86 fc ff ff       	call   0 <runcmd>
+     37a:	83 c4 10             	add    $0x10,%esp
+    wait();
+     37d:	e8 40 0c 00 00       	call   fc2 <wait>
+     382:	eb 01                	jmp    385 <main+0xe0>
+      continue;
+     384:	90                   	nop
+  while (getcmd(buf, sizeof(buf)) >= 0)
+     385:	83 ec 08             	sub    $0x8,%esp
+     388:	6a 64                	push   $0x64
+     38a:	68 80 1f 00 00       	push   $0x1f80
+     38f:	e8 bc fe ff ff       	call   250 <getcmd>
+     394:	83 c4 10             	add    $0x10,%esp
+     397:	85 c0                	test   %eax,%eax
+     399:	0f 89 4f ff ff ff    	jns    2ee <main+0x49>
+  }
+  exit();
+     39f:	e8 16 0c 00 00       	call   fba <exit>
+
+000003a4 <panic>:
+}
+
+void panic(char *s)
+{
+     3a4:	55                   	push   %ebp
+     3a5:	89 e5                	mov    %esp,%ebp
+     3a7:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "%s\n", s);
+     3aa:	83 ec 04             	sub    $0x4,%esp
+     3ad:	ff 75 08             	push   0x8(%ebp)
+     3b0:	68 8d 18 00 00       	push   $0x188d
+     3b5:	6a 02                	push   $0x2
+     3b7:	e8 6a 0e 00 00       	call   1226 <printf>
+     3bc:	83 c4 10             	add    $0x10,%esp
+  exit();
+     3bf:	e8 f6 0b 00 00       	call   fba <exit>
+
+000003c4 <fork1>:
+}
+
+int fork1(void)
+{
+     3c4:	55                   	push   %ebp
+     3c5:	89 e5                	mov    %esp,%ebp
+     3c7:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  pid = fork();
+     3ca:	e8 e3 0b 00 00       	call   fb2 <fork>
+     3cf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if (pid == -1)
+     3d2:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     3d6:	75 10                	jne    3e8 <fork1+0x24>
+    panic("fork");
+     3d8:	83 ec 0c             	sub    $0xc,%esp
+     3db:	68 91 18 00 00       	push   $0x1891
+     3e0:	e8 bf ff ff ff       	call   3a4 <panic>
+     3e5:	83 c4 10             	add    $0x10,%esp
+  return pid;
+     3e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     3eb:	c9                   	leave
+     3ec:	c3                   	ret
+
+000003ed <execcmd>:
+// PAGEBREAK!
+//  Constructors
+
+struct cmd *
+execcmd(void)
+{
+     3ed:	55                   	push   %ebp
+     3ee:	89 e5                	mov    %esp,%ebp
+     3f0:	83 ec 18             	sub    $0x18,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3f3:	83 ec 0c             	sub    $0xc,%esp
+     3f6:	6a 54                	push   $0x54
+     3f8:	e8 fd 10 00 00       	call   14fa <malloc>
+     3fd:	83 c4 10             	add    $0x10,%esp
+     400:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     403:	83 ec 04             	sub    $0x4,%esp
+     406:	6a 54                	push   $0x54
+     408:	6a 00                	push   $0x0
+     40a:	ff 75 f4             	push   -0xc(%ebp)
+     40d:	e8 33 09 00 00       	call   d45 <memset>
+     412:	83 c4 10             	add    $0x10,%esp
+  cmd->type = EXEC;
+     415:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     418:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  return (struct cmd *)cmd;
+     41e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     421:	c9                   	leave
+     422:	c3                   	ret
+
+00000423 <redircmd>:
+
+struct cmd *
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     423:	55                   	push   %ebp
+     424:	89 e5                	mov    %esp,%ebp
+     426:	83 ec 18             	sub    $0x18,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     429:	83 ec 0c             	sub    $0xc,%esp
+     42c:	6a 18                	push   $0x18
+     42e:	e8 c7 10 00 00       	call   14fa <malloc>
+     433:	83 c4 10             	add    $0x10,%esp
+     436:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     439:	83 ec 04             	sub    $0x4,%esp
+     43c:	6a 18                	push   $0x18
+     43e:	6a 00                	push   $0x0
+     440:	ff 75 f4             	push   -0xc(%ebp)
+     443:	e8 fd 08 00 00       	call   d45 <memset>
+     448:	83 c4 10             	add    $0x10,%esp
+  cmd->type = REDIR;
+     44b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     44e:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+  cmd->cmd = subcmd;
+     454:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     457:	8b 55 08             	mov    0x8(%ebp),%edx
+     45a:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->file = file;
+     45d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     460:	8b 55 0c             	mov    0xc(%ebp),%edx
+     463:	89 50 08             	mov    %edx,0x8(%eax)
+  cmd->efile = efile;
+     466:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     469:	8b 55 10             	mov    0x10(%ebp),%edx
+     46c:	89 50 0c             	mov    %edx,0xc(%eax)
+  cmd->mode = mode;
+     46f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     472:	8b 55 14             	mov    0x14(%ebp),%edx
+     475:	89 50 10             	mov    %edx,0x10(%eax)
+  cmd->fd = fd;
+     478:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     47b:	8b 55 18             	mov    0x18(%ebp),%edx
+     47e:	89 50 14             	mov    %edx,0x14(%eax)
+  return (struct cmd *)cmd;
+     481:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     484:	c9                   	leave
+     485:	c3                   	ret
+
+00000486 <pipecmd>:
+
+struct cmd *
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     486:	55                   	push   %ebp
+     487:	89 e5                	mov    %esp,%ebp
+     489:	83 ec 18             	sub    $0x18,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     48c:	83 ec 0c             	sub    $0xc,%esp
+     48f:	6a 0c                	push   $0xc
+     491:	e8 64 10 00 00       	call   14fa <malloc>
+     496:	83 c4 10             	add    $0x10,%esp
+     499:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     49c:	83 ec 04             	sub    $0x4,%esp
+     49f:	6a 0c                	push   $0xc
+     4a1:	6a 00                	push   $0x0
+     4a3:	ff 75 f4             	push   -0xc(%ebp)
+     4a6:	e8 9a 08 00 00       	call   d45 <memset>
+     4ab:	83 c4 10             	add    $0x10,%esp
+  cmd->type = PIPE;
+     4ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4b1:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+  cmd->left = left;
+     4b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4ba:	8b 55 08             	mov    0x8(%ebp),%edx
+     4bd:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->right = right;
+     4c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+     4c6:	89 50 08             	mov    %edx,0x8(%eax)
+  return (struct cmd *)cmd;
+     4c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     4cc:	c9                   	leave
+     4cd:	c3                   	ret
+
+000004ce <listcmd>:
+
+struct cmd *
+listcmd(struct cmd *left, struct cmd *right)
+{
+     4ce:	55                   	push   %ebp
+     4cf:	89 e5                	mov    %esp,%ebp
+     4d1:	83 ec 18             	sub    $0x18,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4d4:	83 ec 0c             	sub    $0xc,%esp
+     4d7:	6a 0c                	push   $0xc
+     4d9:	e8 1c 10 00 00       	call   14fa <malloc>
+     4de:	83 c4 10             	add    $0x10,%esp
+     4e1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     4e4:	83 ec 04             	sub    $0x4,%esp
+     4e7:	6a 0c                	push   $0xc
+     4e9:	6a 00                	push   $0x0
+     4eb:	ff 75 f4             	push   -0xc(%ebp)
+     4ee:	e8 52 08 00 00       	call   d45 <memset>
+     4f3:	83 c4 10             	add    $0x10,%esp
+  cmd->type = LIST;
+     4f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4f9:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+  cmd->left = left;
+     4ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     502:	8b 55 08             	mov    0x8(%ebp),%edx
+     505:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->right = right;
+     508:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     50b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     50e:	89 50 08             	mov    %edx,0x8(%eax)
+  return (struct cmd *)cmd;
+     511:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     514:	c9                   	leave
+     515:	c3                   	ret
+
+00000516 <backcmd>:
+
+struct cmd *
+backcmd(struct cmd *subcmd)
+{
+     516:	55                   	push   %ebp
+     517:	89 e5                	mov    %esp,%ebp
+     519:	83 ec 18             	sub    $0x18,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     51c:	83 ec 0c             	sub    $0xc,%esp
+     51f:	6a 08                	push   $0x8
+     521:	e8 d4 0f 00 00       	call   14fa <malloc>
+     526:	83 c4 10             	add    $0x10,%esp
+     529:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     52c:	83 ec 04             	sub    $0x4,%esp
+     52f:	6a 08                	push   $0x8
+     531:	6a 00                	push   $0x0
+     533:	ff 75 f4             	push   -0xc(%ebp)
+     536:	e8 0a 08 00 00       	call   d45 <memset>
+     53b:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     53e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     541:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+  cmd->cmd = subcmd;
+     547:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     54a:	8b 55 08             	mov    0x8(%ebp),%edx
+     54d:	89 50 04             	mov    %edx,0x4(%eax)
+  return (struct cmd *)cmd;
+     550:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     553:	c9                   	leave
+     554:	c3                   	ret
+
+00000555 <gettoken>:
+
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int gettoken(char **ps, char *es, char **q, char **eq)
+{
+     555:	55                   	push   %ebp
+     556:	89 e5                	mov    %esp,%ebp
+     558:	83 ec 18             	sub    $0x18,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     55b:	8b 45 08             	mov    0x8(%ebp),%eax
+     55e:	8b 00                	mov    (%eax),%eax
+     560:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while (s < es && strchr(whitespace, *s))
+     563:	eb 04                	jmp    569 <gettoken+0x14>
+    s++;
+     565:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while (s < es && strchr(whitespace, *s))
+     569:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     56c:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     56f:	73 1e                	jae    58f <gettoken+0x3a>
+     571:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     574:	0f b6 00             	movzbl (%eax),%eax
+     577:	0f be c0             	movsbl %al,%eax
+     57a:	83 ec 08             	sub    $0x8,%esp
+     57d:	50                   	push   %eax
+     57e:	68 50 1f 00 00       	push   $0x1f50
+     583:	e8 d7 07 00 00       	call   d5f <strchr>
+     588:	83 c4 10             	add    $0x10,%esp
+     58b:	85 c0                	test   %eax,%eax
+     58d:	75 d6                	jne    565 <gettoken+0x10>
+  if (q)
+     58f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     593:	74 08                	je     59d <gettoken+0x48>
+    *q = s;
+     595:	8b 45 10             	mov    0x10(%ebp),%eax
+     598:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     59b:	89 10                	mov    %edx,(%eax)
+  ret = *s;
+     59d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5a0:	0f b6 00             	movzbl (%eax),%eax
+     5a3:	0f be c0             	movsbl %al,%eax
+     5a6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  switch (*s)
+     5a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5ac:	0f b6 00             	movzbl (%eax),%eax
+     5af:	0f be c0             	movsbl %al,%eax
+     5b2:	83 f8 7c             	cmp    $0x7c,%eax
+     5b5:	74 2c                	je     5e3 <gettoken+0x8e>
+     5b7:	83 f8 7c             	cmp    $0x7c,%eax
+     5ba:	7f 48                	jg     604 <gettoken+0xaf>
+     5bc:	83 f8 3e             	cmp    $0x3e,%eax
+     5bf:	74 28                	je     5e9 <gettoken+0x94>
+     5c1:	83 f8 3e             	cmp    $0x3e,%eax
+     5c4:	7f 3e                	jg     604 <gettoken+0xaf>
+     5c6:	83 f8 3c             	cmp    $0x3c,%eax
+     5c9:	7f 39                	jg     604 <gettoken+0xaf>
+     5cb:	83 f8 3b             	cmp    $0x3b,%eax
+     5ce:	7d 13                	jge    5e3 <gettoken+0x8e>
+     5d0:	83 f8 29             	cmp    $0x29,%eax
+     5d3:	7f 2f                	jg     604 <gettoken+0xaf>
+     5d5:	83 f8 28             	cmp    $0x28,%eax
+     5d8:	7d 09                	jge    5e3 <gettoken+0x8e>
+     5da:	85 c0                	test   %eax,%eax
+     5dc:	74 79                	je     657 <gettoken+0x102>
+     5de:	83 f8 26             	cmp    $0x26,%eax
+     5e1:	75 21                	jne    604 <gettoken+0xaf>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+     5e3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    break;
+     5e7:	eb 75                	jmp    65e <gettoken+0x109>
+  case '>':
+    s++;
+     5e9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    if (*s == '>')
+     5ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5f0:	0f b6 00             	movzbl (%eax),%eax
+     5f3:	3c 3e                	cmp    $0x3e,%al
+     5f5:	75 63                	jne    65a <gettoken+0x105>
+    {
+      ret = '+';
+     5f7:	c7 45 f0 2b 00 00 00 	movl   $0x2b,-0x10(%ebp)
+      s++;
+     5fe:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    }
+    break;
+     602:	eb 56                	jmp    65a <gettoken+0x105>
+  default:
+    ret = 'a';
+     604:	c7 45 f0 61 00 00 00 	movl   $0x61,-0x10(%ebp)
+    while (s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     60b:	eb 04                	jmp    611 <gettoken+0xbc>
+      s++;
+     60d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    while (s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     611:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     614:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     617:	73 44                	jae    65d <gettoken+0x108>
+     619:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     61c:	0f b6 00             	movzbl (%eax),%eax
+     61f:	0f be c0             	movsbl %al,%eax
+     622:	83 ec 08             	sub    $0x8,%esp
+     625:	50                   	push   %eax
+     626:	68 50 1f 00 00       	push   $0x1f50
+     62b:	e8 2f 07 00 00       	call   d5f <strchr>
+     630:	83 c4 10             	add    $0x10,%esp
+     633:	85 c0                	test   %eax,%eax
+     635:	75 26                	jne    65d <gettoken+0x108>
+     637:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     63a:	0f b6 00             	movzbl (%eax),%eax
+     63d:	0f be c0             	movsbl %al,%eax
+     640:	83 ec 08             	sub    $0x8,%esp
+     643:	50                   	push   %eax
+     644:	68 58 1f 00 00       	push   $0x1f58
+     649:	e8 11 07 00 00       	call   d5f <strchr>
+     64e:	83 c4 10             	add    $0x10,%esp
+     651:	85 c0                	test   %eax,%eax
+     653:	74 b8                	je     60d <gettoken+0xb8>
+    break;
+     655:	eb 06                	jmp    65d <gettoken+0x108>
+    break;
+     657:	90                   	nop
+     658:	eb 04                	jmp    65e <gettoken+0x109>
+    break;
+     65a:	90                   	nop
+     65b:	eb 01                	jmp    65e <gettoken+0x109>
+    break;
+     65d:	90                   	nop
+  }
+  if (eq)
+     65e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     662:	74 0e                	je     672 <gettoken+0x11d>
+    *eq = s;
+     664:	8b 45 14             	mov    0x14(%ebp),%eax
+     667:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     66a:	89 10                	mov    %edx,(%eax)
+
+  while (s < es && strchr(whitespace, *s))
+     66c:	eb 04                	jmp    672 <gettoken+0x11d>
+    s++;
+     66e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while (s < es && strchr(whitespace, *s))
+     672:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     675:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     678:	73 1e                	jae    698 <gettoken+0x143>
+     67a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     67d:	0f b6 00             	movzbl (%eax),%eax
+     680:	0f be c0             	movsbl %al,%eax
+     683:	83 ec 08             	sub    $0x8,%esp
+     686:	50                   	push   %eax
+     687:	68 50 1f 00 00       	push   $0x1f50
+     68c:	e8 ce 06 00 00       	call   d5f <strchr>
+     691:	83 c4 10             	add    $0x10,%esp
+     694:	85 c0                	test   %eax,%eax
+     696:	75 d6                	jne    66e <gettoken+0x119>
+  *ps = s;
+     698:	8b 45 08             	mov    0x8(%ebp),%eax
+     69b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     69e:	89 10                	mov    %edx,(%eax)
+  return ret;
+     6a0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     6a3:	c9                   	leave
+     6a4:	c3                   	ret
+
+000006a5 <peek>:
+
+int peek(char **ps, char *es, char *toks)
+{
+     6a5:	55                   	push   %ebp
+     6a6:	89 e5                	mov    %esp,%ebp
+     6a8:	83 ec 18             	sub    $0x18,%esp
+  char *s;
+
+  s = *ps;
+     6ab:	8b 45 08             	mov    0x8(%ebp),%eax
+     6ae:	8b 00                	mov    (%eax),%eax
+     6b0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while (s < es && strchr(whitespace, *s))
+     6b3:	eb 04                	jmp    6b9 <peek+0x14>
+    s++;
+     6b5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while (s < es && strchr(whitespace, *s))
+     6b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6bc:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     6bf:	73 1e                	jae    6df <peek+0x3a>
+     6c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6c4:	0f b6 00             	movzbl (%eax),%eax
+     6c7:	0f be c0             	movsbl %al,%eax
+     6ca:	83 ec 08             	sub    $0x8,%esp
+     6cd:	50                   	push   %eax
+     6ce:	68 50 1f 00 00       	push   $0x1f50
+     6d3:	e8 87 06 00 00       	call   d5f <strchr>
+     6d8:	83 c4 10             	add    $0x10,%esp
+     6db:	85 c0                	test   %eax,%eax
+     6dd:	75 d6                	jne    6b5 <peek+0x10>
+  *ps = s;
+     6df:	8b 45 08             	mov    0x8(%ebp),%eax
+     6e2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     6e5:	89 10                	mov    %edx,(%eax)
+  return *s && strchr(toks, *s);
+     6e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6ea:	0f b6 00             	movzbl (%eax),%eax
+     6ed:	84 c0                	test   %al,%al
+     6ef:	74 23                	je     714 <peek+0x6f>
+     6f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6f4:	0f b6 00             	movzbl (%eax),%eax
+     6f7:	0f be c0             	movsbl %al,%eax
+     6fa:	83 ec 08             	sub    $0x8,%esp
+     6fd:	50                   	push   %eax
+     6fe:	ff 75 10             	push   0x10(%ebp)
+     701:	e8 59 06 00 00       	call   d5f <strchr>
+     706:	83 c4 10             	add    $0x10,%esp
+     709:	85 c0                	test   %eax,%eax
+     70b:	74 07                	je     714 <peek+0x6f>
+     70d:	b8 01 00 00 00       	mov    $0x1,%eax
+     712:	eb 05                	jmp    719 <peek+0x74>
+     714:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     719:	c9                   	leave
+     71a:	c3                   	ret
+
+0000071b <parsecmd>:
+struct cmd *parseexec(char **, char *);
+struct cmd *nulterminate(struct cmd *);
+
+struct cmd *
+parsecmd(char *s)
+{
+     71b:	55                   	push   %ebp
+     71c:	89 e5                	mov    %esp,%ebp
+     71e:	53                   	push   %ebx
+     71f:	83 ec 14             	sub    $0x14,%esp
+  char *es;
+  struct cmd *cmd;
+
+  es = s + strlen(s);
+     722:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     725:	8b 45 08             	mov    0x8(%ebp),%eax
+     728:	83 ec 0c             	sub    $0xc,%esp
+     72b:	50                   	push   %eax
+     72c:	e8 ed 05 00 00       	call   d1e <strlen>
+     731:	83 c4 10             	add    $0x10,%esp
+     734:	01 d8                	add    %ebx,%eax
+     736:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  cmd = parseline(&s, es);
+     739:	83 ec 08             	sub    $0x8,%esp
+     73c:	ff 75 f4             	push   -0xc(%ebp)
+     73f:	8d 45 08             	lea    0x8(%ebp),%eax
+     742:	50                   	push   %eax
+     743:	e8 61 00 00 00       	call   7a9 <parseline>
+     748:	83 c4 10             	add    $0x10,%esp
+     74b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  peek(&s, es, "");
+     74e:	83 ec 04             	sub    $0x4,%esp
+     751:	68 96 18 00 00       	push   $0x1896
+     756:	ff 75 f4             	push   -0xc(%ebp)
+     759:	8d 45 08             	lea    0x8(%ebp),%eax
+     75c:	50                   	push   %eax
+     75d:	e8 43 ff ff ff       	call   6a5 <peek>
+     762:	83 c4 10             	add    $0x10,%esp
+  if (s != es)
+     765:	8b 45 08             	mov    0x8(%ebp),%eax
+     768:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     76b:	74 26                	je     793 <parsecmd+0x78>
+  {
+    printf(2, "leftovers: %s\n", s);
+     76d:	8b 45 08             	mov    0x8(%ebp),%eax
+     770:	83 ec 04             	sub    $0x4,%esp
+     773:	50                   	push   %eax
+     774:	68 97 18 00 00       	push   $0x1897
+     779:	6a 02                	push   $0x2
+     77b:	e8 a6 0a 00 00       	call   1226 <printf>
+     780:	83 c4 10             	add    $0x10,%esp
+    panic("syntax");
+     783:	83 ec 0c             	sub    $0xc,%esp
+     786:	68 a6 18 00 00       	push   $0x18a6
+     78b:	e8 14 fc ff ff       	call   3a4 <panic>
+     790:	83 c4 10             	add    $0x10,%esp
+  }
+  nulterminate(cmd);
+     793:	83 ec 0c             	sub    $0xc,%esp
+     796:	ff 75 f0             	push   -0x10(%ebp)
+     799:	e8 ef 03 00 00       	call   b8d <nulterminate>
+     79e:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     7a1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     7a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7a7:	c9                   	leave
+     7a8:	c3                   	ret
+
+000007a9 <parseline>:
+
+struct cmd *
+parseline(char **ps, char *es)
+{
+     7a9:	55                   	push   %ebp
+     7aa:	89 e5                	mov    %esp,%ebp
+     7ac:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  cmd = parsepipe(ps, es);
+     7af:	83 ec 08             	sub    $0x8,%esp
+     7b2:	ff 75 0c             	push   0xc(%ebp)
+     7b5:	ff 75 08             	push   0x8(%ebp)
+     7b8:	e8 99 00 00 00       	call   856 <parsepipe>
+     7bd:	83 c4 10             	add    $0x10,%esp
+     7c0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while (peek(ps, es, "&"))
+     7c3:	eb 23                	jmp    7e8 <parseline+0x3f>
+  {
+    gettoken(ps, es, 0, 0);
+     7c5:	6a 00                	push   $0x0
+     7c7:	6a 00                	push   $0x0
+     7c9:	ff 75 0c             	push   0xc(%ebp)
+     7cc:	ff 75 08             	push   0x8(%ebp)
+     7cf:	e8 81 fd ff ff       	call   555 <gettoken>
+     7d4:	83 c4 10             	add    $0x10,%esp
+    cmd = backcmd(cmd);
+     7d7:	83 ec 0c             	sub    $0xc,%esp
+     7da:	ff 75 f4             	push   -0xc(%ebp)
+     7dd:	e8 34 fd ff ff       	call   516 <backcmd>
+     7e2:	83 c4 10             	add    $0x10,%esp
+     7e5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while (peek(ps, es, "&"))
+     7e8:	83 ec 04             	sub    $0x4,%esp
+     7eb:	68 ad 18 00 00       	push   $0x18ad
+     7f0:	ff 75 0c             	push   0xc(%ebp)
+     7f3:	ff 75 08             	push   0x8(%ebp)
+     7f6:	e8 aa fe ff ff       	call   6a5 <peek>
+     7fb:	83 c4 10             	add    $0x10,%esp
+     7fe:	85 c0                	test   %eax,%eax
+     800:	75 c3                	jne    7c5 <parseline+0x1c>
+  }
+  if (peek(ps, es, ";"))
+     802:	83 ec 04             	sub    $0x4,%esp
+     805:	68 af 18 00 00       	push   $0x18af
+     80a:	ff 75 0c             	push   0xc(%ebp)
+     80d:	ff 75 08             	push   0x8(%ebp)
+     810:	e8 90 fe ff ff       	call   6a5 <peek>
+     815:	83 c4 10             	add    $0x10,%esp
+     818:	85 c0                	test   %eax,%eax
+     81a:	74 35                	je     851 <parseline+0xa8>
+  {
+    gettoken(ps, es, 0, 0);
+     81c:	6a 00                	push   $0x0
+     81e:	6a 00                	push   $0x0
+     820:	ff 75 0c             	push   0xc(%ebp)
+     823:	ff 75 08             	push   0x8(%ebp)
+     826:	e8 2a fd ff ff       	call   555 <gettoken>
+     82b:	83 c4 10             	add    $0x10,%esp
+    cmd = listcmd(cmd, parseline(ps, es));
+     82e:	83 ec 08             	sub    $0x8,%esp
+     831:	ff 75 0c             	push   0xc(%ebp)
+     834:	ff 75 08             	push   0x8(%ebp)
+     837:	e8 6d ff ff ff       	call   7a9 <parseline>
+     83c:	83 c4 10             	add    $0x10,%esp
+     83f:	83 ec 08             	sub    $0x8,%esp
+     842:	50                   	push   %eax
+     843:	ff 75 f4             	push   -0xc(%ebp)
+     846:	e8 83 fc ff ff       	call   4ce <listcmd>
+     84b:	83 c4 10             	add    $0x10,%esp
+     84e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  }
+  return cmd;
+     851:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     854:	c9                   	leave
+     855:	c3                   	ret
+
+00000856 <parsepipe>:
+
+struct cmd *
+parsepipe(char **ps, char *es)
+{
+     856:	55                   	push   %ebp
+     857:	89 e5                	mov    %esp,%ebp
+     859:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  cmd = parseexec(ps, es);
+     85c:	83 ec 08             	sub    $0x8,%esp
+     85f:	ff 75 0c             	push   0xc(%ebp)
+     862:	ff 75 08             	push   0x8(%ebp)
+     865:	e8 f0 01 00 00       	call   a5a <parseexec>
+     86a:	83 c4 10             	add    $0x10,%esp
+     86d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if (peek(ps, es, "|"))
+     870:	83 ec 04             	sub    $0x4,%esp
+     873:	68 b1 18 00 00       	push   $0x18b1
+     878:	ff 75 0c             	push   0xc(%ebp)
+     87b:	ff 75 08             	push   0x8(%ebp)
+     87e:	e8 22 fe ff ff       	call   6a5 <peek>
+     883:	83 c4 10             	add    $0x10,%esp
+     886:	85 c0                	test   %eax,%eax
+     888:	74 35                	je     8bf <parsepipe+0x69>
+  {
+    gettoken(ps, es, 0, 0);
+     88a:	6a 00                	push   $0x0
+     88c:	6a 00                	push   $0x0
+     88e:	ff 75 0c             	push   0xc(%ebp)
+     891:	ff 75 08             	push   0x8(%ebp)
+     894:	e8 bc fc ff ff       	call   555 <gettoken>
+     899:	83 c4 10             	add    $0x10,%esp
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     89c:	83 ec 08             	sub    $0x8,%esp
+     89f:	ff 75 0c             	push   0xc(%ebp)
+     8a2:	ff 75 08             	push   0x8(%ebp)
+     8a5:	e8 ac ff ff ff       	call   856 <parsepipe>
+     8aa:	83 c4 10             	add    $0x10,%esp
+     8ad:	83 ec 08             	sub    $0x8,%esp
+     8b0:	50                   	push   %eax
+     8b1:	ff 75 f4             	push   -0xc(%ebp)
+     8b4:	e8 cd fb ff ff       	call   486 <pipecmd>
+     8b9:	83 c4 10             	add    $0x10,%esp
+     8bc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  }
+  return cmd;
+     8bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     8c2:	c9                   	leave
+     8c3:	c3                   	ret
+
+000008c4 <parseredirs>:
+
+struct cmd *
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     8c4:	55                   	push   %ebp
+     8c5:	89 e5                	mov    %esp,%ebp
+     8c7:	83 ec 18             	sub    $0x18,%esp
+  int tok;
+  char *q, *eq;
+
+  while (peek(ps, es, "<>"))
+     8ca:	e9 ba 00 00 00       	jmp    989 <parseredirs+0xc5>
+  {
+    tok = gettoken(ps, es, 0, 0);
+     8cf:	6a 00                	push   $0x0
+     8d1:	6a 00                	push   $0x0
+     8d3:	ff 75 10             	push   0x10(%ebp)
+     8d6:	ff 75 0c             	push   0xc(%ebp)
+     8d9:	e8 77 fc ff ff       	call   555 <gettoken>
+     8de:	83 c4 10             	add    $0x10,%esp
+     8e1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if (gettoken(ps, es, &q, &eq) != 'a')
+     8e4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+     8e7:	50                   	push   %eax
+     8e8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     8eb:	50                   	push   %eax
+     8ec:	ff 75 10             	push   0x10(%ebp)
+     8ef:	ff 75 0c             	push   0xc(%ebp)
+     8f2:	e8 5e fc ff ff       	call   555 <gettoken>
+     8f7:	83 c4 10             	add    $0x10,%esp
+     8fa:	83 f8 61             	cmp    $0x61,%eax
+     8fd:	74 10                	je     90f <parseredirs+0x4b>
+      panic("missing file for redirection");
+     8ff:	83 ec 0c             	sub    $0xc,%esp
+     902:	68 b3 18 00 00       	push   $0x18b3
+     907:	e8 98 fa ff ff       	call   3a4 <panic>
+     90c:	83 c4 10             	add    $0x10,%esp
+    switch (tok)
+     90f:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%ebp)
+     913:	74 31                	je     946 <parseredirs+0x82>
+     915:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%ebp)
+     919:	7f 6e                	jg     989 <parseredirs+0xc5>
+     91b:	83 7d f4 2b          	cmpl   $0x2b,-0xc(%ebp)
+     91f:	74 47                	je     968 <parseredirs+0xa4>
+     921:	83 7d f4 3c          	cmpl   $0x3c,-0xc(%ebp)
+     925:	75 62                	jne    989 <parseredirs+0xc5>
+    {
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     927:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     92a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     92d:	83 ec 0c             	sub    $0xc,%esp
+     930:	6a 00                	push   $0x0
+     932:	6a 00                	push   $0x0
+     934:	52                   	push   %edx
+     935:	50                   	push   %eax
+     936:	ff 75 08             	push   0x8(%ebp)
+     939:	e8 e5 fa ff ff       	call   423 <redircmd>
+     93e:	83 c4 20             	add    $0x20,%esp
+     941:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     944:	eb 43                	jmp    989 <parseredirs+0xc5>
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY | O_CREATE, 1);
+     946:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     949:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     94c:	83 ec 0c             	sub    $0xc,%esp
+     94f:	6a 01                	push   $0x1
+     951:	68 01 02 00 00       	push   $0x201
+     956:	52                   	push   %edx
+     957:	50                   	push   %eax
+     958:	ff 75 08             	push   0x8(%ebp)
+     95b:	e8 c3 fa ff ff       	call   423 <redircmd>
+     960:	83 c4 20             	add    $0x20,%esp
+     963:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     966:	eb 21                	jmp    989 <parseredirs+0xc5>
+    case '+': // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY | O_CREATE, 1);
+     968:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     96b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     96e:	83 ec 0c             	sub    $0xc,%esp
+     971:	6a 01                	push   $0x1
+     973:	68 01 02 00 00       	push   $0x201
+     978:	52                   	push   %edx
+     979:	50                   	push   %eax
+     97a:	ff 75 08             	push   0x8(%ebp)
+     97d:	e8 a1 fa ff ff       	call   423 <redircmd>
+     982:	83 c4 20             	add    $0x20,%esp
+     985:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     988:	90                   	nop
+  while (peek(ps, es, "<>"))
+     989:	83 ec 04             	sub    $0x4,%esp
+     98c:	68 d0 18 00 00       	push   $0x18d0
+     991:	ff 75 10             	push   0x10(%ebp)
+     994:	ff 75 0c             	push   0xc(%ebp)
+     997:	e8 09 fd ff ff       	call   6a5 <peek>
+     99c:	83 c4 10             	add    $0x10,%esp
+     99f:	85 c0                	test   %eax,%eax
+     9a1:	0f 85 28 ff ff ff    	jne    8cf <parseredirs+0xb>
+    }
+  }
+  return cmd;
+     9a7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     9aa:	c9                   	leave
+     9ab:	c3                   	ret
+
+000009ac <parseblock>:
+
+struct cmd *
+parseblock(char **ps, char *es)
+{
+     9ac:	55                   	push   %ebp
+     9ad:	89 e5                	mov    %esp,%ebp
+     9af:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  if (!peek(ps, es, "("))
+     9b2:	83 ec 04             	sub    $0x4,%esp
+     9b5:	68 d3 18 00 00       	push   $0x18d3
+     9ba:	ff 75 0c             	push   0xc(%ebp)
+     9bd:	ff 75 08             	push   0x8(%ebp)
+     9c0:	e8 e0 fc ff ff       	call   6a5 <peek>
+     9c5:	83 c4 10             	add    $0x10,%esp
+     9c8:	85 c0                	test   %eax,%eax
+     9ca:	75 10                	jne    9dc <parseblock+0x30>
+    panic("parseblock");
+     9cc:	83 ec 0c             	sub    $0xc,%esp
+     9cf:	68 d5 18 00 00       	push   $0x18d5
+     9d4:	e8 cb f9 ff ff       	call   3a4 <panic>
+     9d9:	83 c4 10             	add    $0x10,%esp
+  gettoken(ps, es, 0, 0);
+     9dc:	6a 00                	push   $0x0
+     9de:	6a 00                	push   $0x0
+     9e0:	ff 75 0c             	push   0xc(%ebp)
+     9e3:	ff 75 08             	push   0x8(%ebp)
+     9e6:	e8 6a fb ff ff       	call   555 <gettoken>
+     9eb:	83 c4 10             	add    $0x10,%esp
+  cmd = parseline(ps, es);
+     9ee:	83 ec 08             	sub    $0x8,%esp
+     9f1:	ff 75 0c             	push   0xc(%ebp)
+     9f4:	ff 75 08             	push   0x8(%ebp)
+     9f7:	e8 ad fd ff ff       	call   7a9 <parseline>
+     9fc:	83 c4 10             	add    $0x10,%esp
+     9ff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if (!peek(ps, es, ")"))
+     a02:	83 ec 04             	sub    $0x4,%esp
+     a05:	68 e0 18 00 00       	push   $0x18e0
+     a0a:	ff 75 0c             	push   0xc(%ebp)
+     a0d:	ff 75 08             	push   0x8(%ebp)
+     a10:	e8 90 fc ff ff       	call   6a5 <peek>
+     a15:	83 c4 10             	add    $0x10,%esp
+     a18:	85 c0                	test   %eax,%eax
+     a1a:	75 10                	jne    a2c <parseblock+0x80>
+    panic("syntax - missing )");
+     a1c:	83 ec 0c             	sub    $0xc,%esp
+     a1f:	68 e2 18 00 00       	push   $0x18e2
+     a24:	e8 7b f9 ff ff       	call   3a4 <panic>
+     a29:	83 c4 10             	add    $0x10,%esp
+  gettoken(ps, es, 0, 0);
+     a2c:	6a 00                	push   $0x0
+     a2e:	6a 00                	push   $0x0
+     a30:	ff 75 0c             	push   0xc(%ebp)
+     a33:	ff 75 08             	push   0x8(%ebp)
+     a36:	e8 1a fb ff ff       	call   555 <gettoken>
+     a3b:	83 c4 10             	add    $0x10,%esp
+  cmd = parseredirs(cmd, ps, es);
+     a3e:	83 ec 04             	sub    $0x4,%esp
+     a41:	ff 75 0c             	push   0xc(%ebp)
+     a44:	ff 75 08             	push   0x8(%ebp)
+     a47:	ff 75 f4             	push   -0xc(%ebp)
+     a4a:	e8 75 fe ff ff       	call   8c4 <parseredirs>
+     a4f:	83 c4 10             	add    $0x10,%esp
+     a52:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  return cmd;
+     a55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     a58:	c9                   	leave
+     a59:	c3                   	ret
+
+00000a5a <parseexec>:
+
+struct cmd *
+parseexec(char **ps, char *es)
+{
+     a5a:	55                   	push   %ebp
+     a5b:	89 e5                	mov    %esp,%ebp
+     a5d:	83 ec 28             	sub    $0x28,%esp
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if (peek(ps, es, "("))
+     a60:	83 ec 04             	sub    $0x4,%esp
+     a63:	68 d3 18 00 00       	push   $0x18d3
+     a68:	ff 75 0c             	push   0xc(%ebp)
+     a6b:	ff 75 08             	push   0x8(%ebp)
+     a6e:	e8 32 fc ff ff       	call   6a5 <peek>
+     a73:	83 c4 10             	add    $0x10,%esp
+     a76:	85 c0                	test   %eax,%eax
+     a78:	74 16                	je     a90 <parseexec+0x36>
+    return parseblock(ps, es);
+     a7a:	83 ec 08             	sub    $0x8,%esp
+     a7d:	ff 75 0c             	push   0xc(%ebp)
+     a80:	ff 75 08             	push   0x8(%ebp)
+     a83:	e8 24 ff ff ff       	call   9ac <parseblock>
+     a88:	83 c4 10             	add    $0x10,%esp
+     a8b:	e9 fb 00 00 00       	jmp    b8b <parseexec+0x131>
+
+  ret = execcmd();
+     a90:	e8 58 f9 ff ff       	call   3ed <execcmd>
+     a95:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  cmd = (struct execcmd *)ret;
+     a98:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a9b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  argc = 0;
+     a9e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  ret = parseredirs(ret, ps, es);
+     aa5:	83 ec 04             	sub    $0x4,%esp
+     aa8:	ff 75 0c             	push   0xc(%ebp)
+     aab:	ff 75 08             	push   0x8(%ebp)
+     aae:	ff 75 f0             	push   -0x10(%ebp)
+     ab1:	e8 0e fe ff ff       	call   8c4 <parseredirs>
+     ab6:	83 c4 10             	add    $0x10,%esp
+     ab9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while (!peek(ps, es, "|)&;"))
+     abc:	e9 87 00 00 00       	jmp    b48 <parseexec+0xee>
+  {
+    if ((tok = gettoken(ps, es, &q, &eq)) == 0)
+     ac1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     ac4:	50                   	push   %eax
+     ac5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     ac8:	50                   	push   %eax
+     ac9:	ff 75 0c             	push   0xc(%ebp)
+     acc:	ff 75 08             	push   0x8(%ebp)
+     acf:	e8 81 fa ff ff       	call   555 <gettoken>
+     ad4:	83 c4 10             	add    $0x10,%esp
+     ad7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     ada:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     ade:	0f 84 84 00 00 00    	je     b68 <parseexec+0x10e>
+      break;
+    if (tok != 'a')
+     ae4:	83 7d e8 61          	cmpl   $0x61,-0x18(%ebp)
+     ae8:	74 10                	je     afa <parseexec+0xa0>
+      panic("syntax");
+     aea:	83 ec 0c             	sub    $0xc,%esp
+     aed:	68 a6 18 00 00       	push   $0x18a6
+     af2:	e8 ad f8 ff ff       	call   3a4 <panic>
+     af7:	83 c4 10             	add    $0x10,%esp
+    cmd->argv[argc] = q;
+     afa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     afd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b00:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     b03:	89 4c 90 04          	mov    %ecx,0x4(%eax,%edx,4)
+    cmd->eargv[argc] = eq;
+     b07:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     b0a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b0d:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     b10:	83 c1 08             	add    $0x8,%ecx
+     b13:	89 54 88 0c          	mov    %edx,0xc(%eax,%ecx,4)
+    argc++;
+     b17:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    if (argc >= MAXARGS)
+     b1b:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+     b1f:	7e 10                	jle    b31 <parseexec+0xd7>
+      panic("too many args");
+     b21:	83 ec 0c             	sub    $0xc,%esp
+     b24:	68 f5 18 00 00       	push   $0x18f5
+     b29:	e8 76 f8 ff ff       	call   3a4 <panic>
+     b2e:	83 c4 10             	add    $0x10,%esp
+    ret = parseredirs(ret, ps, es);
+     b31:	83 ec 04             	sub    $0x4,%esp
+     b34:	ff 75 0c             	push   0xc(%ebp)
+     b37:	ff 75 08             	push   0x8(%ebp)
+     b3a:	ff 75 f0             	push   -0x10(%ebp)
+     b3d:	e8 82 fd ff ff       	call   8c4 <parseredirs>
+     b42:	83 c4 10             	add    $0x10,%esp
+     b45:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while (!peek(ps, es, "|)&;"))
+     b48:	83 ec 04             	sub    $0x4,%esp
+     b4b:	68 03 19 00 00       	push   $0x1903
+     b50:	ff 75 0c             	push   0xc(%ebp)
+     b53:	ff 75 08             	push   0x8(%ebp)
+     b56:	e8 4a fb ff ff       	call   6a5 <peek>
+     b5b:	83 c4 10             	add    $0x10,%esp
+     b5e:	85 c0                	test   %eax,%eax
+     b60:	0f 84 5b ff ff ff    	je     ac1 <parseexec+0x67>
+     b66:	eb 01                	jmp    b69 <parseexec+0x10f>
+      break;
+     b68:	90                   	nop
+  }
+  cmd->argv[argc] = 0;
+     b69:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b6c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     b6f:	c7 44 90 04 00 00 00 	movl   $0x0,0x4(%eax,%edx,4)
+     b76:	00 
+  cmd->eargv[argc] = 0;
+     b77:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b7a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     b7d:	83 c2 08             	add    $0x8,%edx
+     b80:	c7 44 90 0c 00 00 00 	movl   $0x0,0xc(%eax,%edx,4)
+     b87:	00 
+  return ret;
+     b88:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     b8b:	c9                   	leave
+     b8c:	c3                   	ret
+
+00000b8d <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd *
+nulterminate(struct cmd *cmd)
+{
+     b8d:	55                   	push   %ebp
+     b8e:	89 e5                	mov    %esp,%ebp
+     b90:	83 ec 28             	sub    $0x28,%esp
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if (cmd == 0)
+     b93:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b97:	75 0a                	jne    ba3 <nulterminate+0x16>
+    return 0;
+     b99:	b8 00 00 00 00       	mov    $0x0,%eax
+     b9e:	e9 e4 00 00 00       	jmp    c87 <nulterminate+0xfa>
+
+  switch (cmd->type)
+     ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ba6:	8b 00                	mov    (%eax),%eax
+     ba8:	83 f8 05             	cmp    $0x5,%eax
+     bab:	0f 87 d3 00 00 00    	ja     c84 <nulterminate+0xf7>
+     bb1:	8b 04 85 08 19 00 00 	mov    0x1908(,%eax,4),%eax
+     bb8:	ff e0                	jmp    *%eax
+  {
+  case EXEC:
+    ecmd = (struct execcmd *)cmd;
+     bba:	8b 45 08             	mov    0x8(%ebp),%eax
+     bbd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for (i = 0; ecmd->argv[i]; i++)
+     bc0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     bc7:	eb 14                	jmp    bdd <nulterminate+0x50>
+      *ecmd->eargv[i] = 0;
+     bc9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     bcc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     bcf:	83 c2 08             	add    $0x8,%edx
+     bd2:	8b 44 90 0c          	mov    0xc(%eax,%edx,4),%eax
+     bd6:	c6 00 00             	movb   $0x0,(%eax)
+    for (i = 0; ecmd->argv[i]; i++)
+     bd9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     bdd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     be0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     be3:	8b 44 90 04          	mov    0x4(%eax,%edx,4),%eax
+     be7:	85 c0                	test   %eax,%eax
+     be9:	75 de                	jne    bc9 <nulterminate+0x3c>
+    break;
+     beb:	e9 94 00 00 00       	jmp    c84 <nulterminate+0xf7>
+
+  case REDIR:
+    rcmd = (struct redircmd *)cmd;
+     bf0:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    nulterminate(rcmd->cmd);
+     bf6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bf9:	8b 40 04             	mov    0x4(%eax),%eax
+     bfc:	83 ec 0c             	sub    $0xc,%esp
+     bff:	50                   	push   %eax
+     c00:	e8 88 ff ff ff       	call   b8d <nulterminate>
+     c05:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     c08:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c0b:	8b 40 0c             	mov    0xc(%eax),%eax
+     c0e:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     c11:	eb 71                	jmp    c84 <nulterminate+0xf7>
+
+  case PIPE:
+    pcmd = (struct pipecmd *)cmd;
+     c13:	8b 45 08             	mov    0x8(%ebp),%eax
+     c16:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    nulterminate(pcmd->left);
+     c19:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c1c:	8b 40 04             	mov    0x4(%eax),%eax
+     c1f:	83 ec 0c             	sub    $0xc,%esp
+     c22:	50                   	push   %eax
+     c23:	e8 65 ff ff ff       	call   b8d <nulterminate>
+     c28:	83 c4 10             	add    $0x10,%esp
+    nulterminate(pcmd->right);
+     c2b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c2e:	8b 40 08             	mov    0x8(%eax),%eax
+     c31:	83 ec 0c             	sub    $0xc,%esp
+     c34:	50                   	push   %eax
+     c35:	e8 53 ff ff ff       	call   b8d <nulterminate>
+     c3a:	83 c4 10             	add    $0x10,%esp
+    break;
+     c3d:	eb 45                	jmp    c84 <nulterminate+0xf7>
+
+  case LIST:
+    lcmd = (struct listcmd *)cmd;
+     c3f:	8b 45 08             	mov    0x8(%ebp),%eax
+     c42:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    nulterminate(lcmd->left);
+     c45:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c48:	8b 40 04             	mov    0x4(%eax),%eax
+     c4b:	83 ec 0c             	sub    $0xc,%esp
+     c4e:	50                   	push   %eax
+     c4f:	e8 39 ff ff ff       	call   b8d <nulterminate>
+     c54:	83 c4 10             	add    $0x10,%esp
+    nulterminate(lcmd->right);
+     c57:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c5a:	8b 40 08             	mov    0x8(%eax),%eax
+     c5d:	83 ec 0c             	sub    $0xc,%esp
+     c60:	50                   	push   %eax
+     c61:	e8 27 ff ff ff       	call   b8d <nulterminate>
+     c66:	83 c4 10             	add    $0x10,%esp
+    break;
+     c69:	eb 19                	jmp    c84 <nulterminate+0xf7>
+
+  case BACK:
+    bcmd = (struct backcmd *)cmd;
+     c6b:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    nulterminate(bcmd->cmd);
+     c71:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c74:	8b 40 04             	mov    0x4(%eax),%eax
+     c77:	83 ec 0c             	sub    $0xc,%esp
+     c7a:	50                   	push   %eax
+     c7b:	e8 0d ff ff ff       	call   b8d <nulterminate>
+     c80:	83 c4 10             	add    $0x10,%esp
+    break;
+     c83:	90                   	nop
+  }
+  return cmd;
+     c84:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     c87:	c9                   	leave
+     c88:	c3                   	ret
+
+00000c89 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+     c89:	55                   	push   %ebp
+     c8a:	89 e5                	mov    %esp,%ebp
+     c8c:	57                   	push   %edi
+     c8d:	53                   	push   %ebx
+{
+     c8e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c91:	8b 55 10             	mov    0x10(%ebp),%edx
+     c94:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c97:	89 cb                	mov    %ecx,%ebx
+     c99:	89 df                	mov    %ebx,%edi
+     c9b:	89 d1                	mov    %edx,%ecx
+     c9d:	fc                   	cld
+     c9e:	f3 aa                	rep stos %al,%es:(%edi)
+     ca0:	89 ca                	mov    %ecx,%edx
+     ca2:	89 fb                	mov    %edi,%ebx
+     ca4:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     ca7:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+     caa:	90                   	nop
+     cab:	5b                   	pop    %ebx
+     cac:	5f                   	pop    %edi
+     cad:	5d                   	pop    %ebp
+     cae:	c3                   	ret
+
+00000caf <strcpy>:
+{
+     caf:	55                   	push   %ebp
+     cb0:	89 e5                	mov    %esp,%ebp
+     cb2:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     cb5:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     cbb:	90                   	nop
+     cbc:	8b 55 0c             	mov    0xc(%ebp),%edx
+     cbf:	8d 42 01             	lea    0x1(%edx),%eax
+     cc2:	89 45 0c             	mov    %eax,0xc(%ebp)
+     cc5:	8b 45 08             	mov    0x8(%ebp),%eax
+     cc8:	8d 48 01             	lea    0x1(%eax),%ecx
+     ccb:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     cce:	0f b6 12             	movzbl (%edx),%edx
+     cd1:	88 10                	mov    %dl,(%eax)
+     cd3:	0f b6 00             	movzbl (%eax),%eax
+     cd6:	84 c0                	test   %al,%al
+     cd8:	75 e2                	jne    cbc <strcpy+0xd>
+  return os;
+     cda:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     cdd:	c9                   	leave
+     cde:	c3                   	ret
+
+00000cdf <strcmp>:
+{
+     cdf:	55                   	push   %ebp
+     ce0:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     ce2:	eb 08                	jmp    cec <strcmp+0xd>
+    p++, q++;
+     ce4:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     ce8:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     cec:	8b 45 08             	mov    0x8(%ebp),%eax
+     cef:	0f b6 00             	movzbl (%eax),%eax
+     cf2:	84 c0                	test   %al,%al
+     cf4:	74 10                	je     d06 <strcmp+0x27>
+     cf6:	8b 45 08             	mov    0x8(%ebp),%eax
+     cf9:	0f b6 10             	movzbl (%eax),%edx
+     cfc:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cff:	0f b6 00             	movzbl (%eax),%eax
+     d02:	38 c2                	cmp    %al,%dl
+     d04:	74 de                	je     ce4 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     d06:	8b 45 08             	mov    0x8(%ebp),%eax
+     d09:	0f b6 00             	movzbl (%eax),%eax
+     d0c:	0f b6 d0             	movzbl %al,%edx
+     d0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d12:	0f b6 00             	movzbl (%eax),%eax
+     d15:	0f b6 c0             	movzbl %al,%eax
+     d18:	29 c2                	sub    %eax,%edx
+     d1a:	89 d0                	mov    %edx,%eax
+}
+     d1c:	5d                   	pop    %ebp
+     d1d:	c3                   	ret
+
+00000d1e <strlen>:
+{
+     d1e:	55                   	push   %ebp
+     d1f:	89 e5                	mov    %esp,%ebp
+     d21:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     d24:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     d2b:	eb 04                	jmp    d31 <strlen+0x13>
+     d2d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     d31:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     d34:	8b 45 08             	mov    0x8(%ebp),%eax
+     d37:	01 d0                	add    %edx,%eax
+     d39:	0f b6 00             	movzbl (%eax),%eax
+     d3c:	84 c0                	test   %al,%al
+     d3e:	75 ed                	jne    d2d <strlen+0xf>
+  return n;
+     d40:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     d43:	c9                   	leave
+     d44:	c3                   	ret
+
+00000d45 <memset>:
+{
+     d45:	55                   	push   %ebp
+     d46:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     d48:	8b 45 10             	mov    0x10(%ebp),%eax
+     d4b:	50                   	push   %eax
+     d4c:	ff 75 0c             	push   0xc(%ebp)
+     d4f:	ff 75 08             	push   0x8(%ebp)
+     d52:	e8 32 ff ff ff       	call   c89 <stosb>
+     d57:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     d5a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     d5d:	c9                   	leave
+     d5e:	c3                   	ret
+
+00000d5f <strchr>:
+{
+     d5f:	55                   	push   %ebp
+     d60:	89 e5                	mov    %esp,%ebp
+     d62:	83 ec 04             	sub    $0x4,%esp
+     d65:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d68:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     d6b:	eb 14                	jmp    d81 <strchr+0x22>
+    if(*s == c)
+     d6d:	8b 45 08             	mov    0x8(%ebp),%eax
+     d70:	0f b6 00             	movzbl (%eax),%eax
+     d73:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     d76:	75 05                	jne    d7d <strchr+0x1e>
+      return (char*)s;
+     d78:	8b 45 08             	mov    0x8(%ebp),%eax
+     d7b:	eb 13                	jmp    d90 <strchr+0x31>
+  for(; *s; s++)
+     d7d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     d81:	8b 45 08             	mov    0x8(%ebp),%eax
+     d84:	0f b6 00             	movzbl (%eax),%eax
+     d87:	84 c0                	test   %al,%al
+     d89:	75 e2                	jne    d6d <strchr+0xe>
+  return 0;
+     d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d90:	c9                   	leave
+     d91:	c3                   	ret
+
+00000d92 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     d92:	55                   	push   %ebp
+     d93:	89 e5                	mov    %esp,%ebp
+     d95:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     d98:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     d9f:	eb 42                	jmp    de3 <gets+0x51>
+    cc = read(0, &c, 1);
+     da1:	83 ec 04             	sub    $0x4,%esp
+     da4:	6a 01                	push   $0x1
+     da6:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     da9:	50                   	push   %eax
+     daa:	6a 00                	push   $0x0
+     dac:	e8 21 02 00 00       	call   fd2 <read>
+     db1:	83 c4 10             	add    $0x10,%esp
+     db4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     db7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     dbb:	7e 33                	jle    df0 <gets+0x5e>
+      break;
+    buf[i++] = c;
+     dbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dc0:	8d 50 01             	lea    0x1(%eax),%edx
+     dc3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     dc6:	89 c2                	mov    %eax,%edx
+     dc8:	8b 45 08             	mov    0x8(%ebp),%eax
+     dcb:	01 c2                	add    %eax,%edx
+     dcd:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     dd1:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     dd3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     dd7:	3c 0a                	cmp    $0xa,%al
+     dd9:	74 16                	je     df1 <gets+0x5f>
+     ddb:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     ddf:	3c 0d                	cmp    $0xd,%al
+     de1:	74 0e                	je     df1 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     de3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     de6:	83 c0 01             	add    $0x1,%eax
+     de9:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     dec:	7f b3                	jg     da1 <gets+0xf>
+     dee:	eb 01                	jmp    df1 <gets+0x5f>
+      break;
+     df0:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     df1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     df4:	8b 45 08             	mov    0x8(%ebp),%eax
+     df7:	01 d0                	add    %edx,%eax
+     df9:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     dfc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     dff:	c9                   	leave
+     e00:	c3                   	ret
+
+00000e01 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     e01:	55                   	push   %ebp
+     e02:	89 e5                	mov    %esp,%ebp
+     e04:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     e07:	83 ec 08             	sub    $0x8,%esp
+     e0a:	6a 00                	push   $0x0
+     e0c:	ff 75 08             	push   0x8(%ebp)
+     e0f:	e8 e6 01 00 00       	call   ffa <open>
+     e14:	83 c4 10             	add    $0x10,%esp
+     e17:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     e1a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e1e:	79 07                	jns    e27 <stat+0x26>
+    return -1;
+     e20:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e25:	eb 25                	jmp    e4c <stat+0x4b>
+  r = fstat(fd, st);
+     e27:	83 ec 08             	sub    $0x8,%esp
+     e2a:	ff 75 0c             	push   0xc(%ebp)
+     e2d:	ff 75 f4             	push   -0xc(%ebp)
+     e30:	e8 dd 01 00 00       	call   1012 <fstat>
+     e35:	83 c4 10             	add    $0x10,%esp
+     e38:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     e3b:	83 ec 0c             	sub    $0xc,%esp
+     e3e:	ff 75 f4             	push   -0xc(%ebp)
+     e41:	e8 9c 01 00 00       	call   fe2 <close>
+     e46:	83 c4 10             	add    $0x10,%esp
+  return r;
+     e49:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     e4c:	c9                   	leave
+     e4d:	c3                   	ret
+
+00000e4e <atoi>:
+
+int
+atoi(const char *s)
+{
+     e4e:	55                   	push   %ebp
+     e4f:	89 e5                	mov    %esp,%ebp
+     e51:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     e54:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     e5b:	eb 25                	jmp    e82 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     e5d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     e60:	89 d0                	mov    %edx,%eax
+     e62:	c1 e0 02             	shl    $0x2,%eax
+     e65:	01 d0                	add    %edx,%eax
+     e67:	01 c0                	add    %eax,%eax
+     e69:	89 c1                	mov    %eax,%ecx
+     e6b:	8b 45 08             	mov    0x8(%ebp),%eax
+     e6e:	8d 50 01             	lea    0x1(%eax),%edx
+     e71:	89 55 08             	mov    %edx,0x8(%ebp)
+     e74:	0f b6 00             	movzbl (%eax),%eax
+     e77:	0f be c0             	movsbl %al,%eax
+     e7a:	01 c8                	add    %ecx,%eax
+     e7c:	83 e8 30             	sub    $0x30,%eax
+     e7f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     e82:	8b 45 08             	mov    0x8(%ebp),%eax
+     e85:	0f b6 00             	movzbl (%eax),%eax
+     e88:	3c 2f                	cmp    $0x2f,%al
+     e8a:	7e 0a                	jle    e96 <atoi+0x48>
+     e8c:	8b 45 08             	mov    0x8(%ebp),%eax
+     e8f:	0f b6 00             	movzbl (%eax),%eax
+     e92:	3c 39                	cmp    $0x39,%al
+     e94:	7e c7                	jle    e5d <atoi+0xf>
+  return n;
+     e96:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     e99:	c9                   	leave
+     e9a:	c3                   	ret
+
+00000e9b <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     e9b:	55                   	push   %ebp
+     e9c:	89 e5                	mov    %esp,%ebp
+     e9e:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+     ea1:	8b 45 08             	mov    0x8(%ebp),%eax
+     ea4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     ea7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     eaa:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     ead:	eb 17                	jmp    ec6 <memmove+0x2b>
+    *dst++ = *src++;
+     eaf:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     eb2:	8d 42 01             	lea    0x1(%edx),%eax
+     eb5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     eb8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ebb:	8d 48 01             	lea    0x1(%eax),%ecx
+     ebe:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     ec1:	0f b6 12             	movzbl (%edx),%edx
+     ec4:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     ec6:	8b 45 10             	mov    0x10(%ebp),%eax
+     ec9:	8d 50 ff             	lea    -0x1(%eax),%edx
+     ecc:	89 55 10             	mov    %edx,0x10(%ebp)
+     ecf:	85 c0                	test   %eax,%eax
+     ed1:	7f dc                	jg     eaf <memmove+0x14>
+  return vdst;
+     ed3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     ed6:	c9                   	leave
+     ed7:	c3                   	ret
+
+00000ed8 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+     ed8:	55                   	push   %ebp
+     ed9:	89 e5                	mov    %esp,%ebp
+     edb:	57                   	push   %edi
+     edc:	56                   	push   %esi
+     edd:	83 ec 30             	sub    $0x30,%esp
+     ee0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ee3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     ee6:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ee9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+     eec:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+     ef3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     efa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     efd:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     f00:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f03:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+     f06:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+     f0d:	e9 89 00 00 00       	jmp    f9b <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+     f12:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f15:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     f18:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+     f1c:	01 c0                	add    %eax,%eax
+     f1e:	89 c6                	mov    %eax,%esi
+     f20:	89 d7                	mov    %edx,%edi
+     f22:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     f25:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     f28:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f2b:	0f ad d0             	shrd   %cl,%edx,%eax
+     f2e:	d3 ea                	shr    %cl,%edx
+     f30:	f6 c1 20             	test   $0x20,%cl
+     f33:	74 04                	je     f39 <udiv64+0x61>
+     f35:	89 d0                	mov    %edx,%eax
+     f37:	31 d2                	xor    %edx,%edx
+     f39:	83 e0 01             	and    $0x1,%eax
+     f3c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+     f3f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+     f46:	89 f0                	mov    %esi,%eax
+     f48:	89 fa                	mov    %edi,%edx
+     f4a:	0b 45 c8             	or     -0x38(%ebp),%eax
+     f4d:	0b 55 cc             	or     -0x34(%ebp),%edx
+     f50:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     f53:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+     f56:	8b 45 10             	mov    0x10(%ebp),%eax
+     f59:	ba 00 00 00 00       	mov    $0x0,%edx
+     f5e:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     f61:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+     f64:	19 d1                	sbb    %edx,%ecx
+     f66:	72 2f                	jb     f97 <udiv64+0xbf>
+      r -= d;
+     f68:	8b 45 10             	mov    0x10(%ebp),%eax
+     f6b:	ba 00 00 00 00       	mov    $0x0,%edx
+     f70:	29 45 e8             	sub    %eax,-0x18(%ebp)
+     f73:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+     f76:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     f79:	b8 01 00 00 00       	mov    $0x1,%eax
+     f7e:	ba 00 00 00 00       	mov    $0x0,%edx
+     f83:	0f a5 c2             	shld   %cl,%eax,%edx
+     f86:	d3 e0                	shl    %cl,%eax
+     f88:	f6 c1 20             	test   $0x20,%cl
+     f8b:	74 04                	je     f91 <udiv64+0xb9>
+     f8d:	89 c2                	mov    %eax,%edx
+     f8f:	31 c0                	xor    %eax,%eax
+     f91:	09 45 f0             	or     %eax,-0x10(%ebp)
+     f94:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+     f97:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+     f9b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     f9f:	0f 89 6d ff ff ff    	jns    f12 <udiv64+0x3a>
+    }
+  }
+  return q;
+     fa5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fa8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+     fab:	83 c4 30             	add    $0x30,%esp
+     fae:	5e                   	pop    %esi
+     faf:	5f                   	pop    %edi
+     fb0:	5d                   	pop    %ebp
+     fb1:	c3                   	ret
+
+00000fb2 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     fb2:	b8 01 00 00 00       	mov    $0x1,%eax
+     fb7:	cd 40                	int    $0x40
+     fb9:	c3                   	ret
+
+00000fba <exit>:
+SYSCALL(exit)
+     fba:	b8 02 00 00 00       	mov    $0x2,%eax
+     fbf:	cd 40                	int    $0x40
+     fc1:	c3                   	ret
+
+00000fc2 <wait>:
+SYSCALL(wait)
+     fc2:	b8 03 00 00 00       	mov    $0x3,%eax
+     fc7:	cd 40                	int    $0x40
+     fc9:	c3                   	ret
+
+00000fca <pipe>:
+SYSCALL(pipe)
+     fca:	b8 04 00 00 00       	mov    $0x4,%eax
+     fcf:	cd 40                	int    $0x40
+     fd1:	c3                   	ret
+
+00000fd2 <read>:
+SYSCALL(read)
+     fd2:	b8 05 00 00 00       	mov    $0x5,%eax
+     fd7:	cd 40                	int    $0x40
+     fd9:	c3                   	ret
+
+00000fda <write>:
+SYSCALL(write)
+     fda:	b8 10 00 00 00       	mov    $0x10,%eax
+     fdf:	cd 40                	int    $0x40
+     fe1:	c3                   	ret
+
+00000fe2 <close>:
+SYSCALL(close)
+     fe2:	b8 15 00 00 00       	mov    $0x15,%eax
+     fe7:	cd 40                	int    $0x40
+     fe9:	c3                   	ret
+
+00000fea <kill>:
+SYSCALL(kill)
+     fea:	b8 06 00 00 00       	mov    $0x6,%eax
+     fef:	cd 40                	int    $0x40
+     ff1:	c3                   	ret
+
+00000ff2 <exec>:
+SYSCALL(exec)
+     ff2:	b8 07 00 00 00       	mov    $0x7,%eax
+     ff7:	cd 40                	int    $0x40
+     ff9:	c3                   	ret
+
+00000ffa <open>:
+SYSCALL(open)
+     ffa:	b8 0f 00 00 00       	mov    $0xf,%eax
+     fff:	cd 40                	int    $0x40
+    1001:	c3                   	ret
+
+00001002 <mknod>:
+SYSCALL(mknod)
+    1002:	b8 11 00 00 00       	mov    $0x11,%eax
+    1007:	cd 40                	int    $0x40
+    1009:	c3                   	ret
+
+0000100a <unlink>:
+SYSCALL(unlink)
+    100a:	b8 12 00 00 00       	mov    $0x12,%eax
+    100f:	cd 40                	int    $0x40
+    1011:	c3                   	ret
+
+00001012 <fstat>:
+SYSCALL(fstat)
+    1012:	b8 08 00 00 00       	mov    $0x8,%eax
+    1017:	cd 40                	int    $0x40
+    1019:	c3                   	ret
+
+0000101a <link>:
+SYSCALL(link)
+    101a:	b8 13 00 00 00       	mov    $0x13,%eax
+    101f:	cd 40                	int    $0x40
+    1021:	c3                   	ret
+
+00001022 <mkdir>:
+SYSCALL(mkdir)
+    1022:	b8 14 00 00 00       	mov    $0x14,%eax
+    1027:	cd 40                	int    $0x40
+    1029:	c3                   	ret
+
+0000102a <chdir>:
+SYSCALL(chdir)
+    102a:	b8 09 00 00 00       	mov    $0x9,%eax
+    102f:	cd 40                	int    $0x40
+    1031:	c3                   	ret
+
+00001032 <dup>:
+SYSCALL(dup)
+    1032:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1037:	cd 40                	int    $0x40
+    1039:	c3                   	ret
+
+0000103a <getpid>:
+SYSCALL(getpid)
+    103a:	b8 0b 00 00 00       	mov    $0xb,%eax
+    103f:	cd 40                	int    $0x40
+    1041:	c3                   	ret
+
+00001042 <sbrk>:
+SYSCALL(sbrk)
+    1042:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1047:	cd 40                	int    $0x40
+    1049:	c3                   	ret
+
+0000104a <sleep>:
+SYSCALL(sleep)
+    104a:	b8 0d 00 00 00       	mov    $0xd,%eax
+    104f:	cd 40                	int    $0x40
+    1051:	c3                   	ret
+
+00001052 <uptime>:
+SYSCALL(uptime)
+    1052:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1057:	cd 40                	int    $0x40
+    1059:	c3                   	ret
+
+0000105a <find_digital_root>:
+SYSCALL(find_digital_root)
+    105a:	b8 16 00 00 00       	mov    $0x16,%eax
+    105f:	cd 40                	int    $0x40
+    1061:	c3                   	ret
+
+00001062 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+    1062:	b8 17 00 00 00       	mov    $0x17,%eax
+    1067:	cd 40                	int    $0x40
+    1069:	c3                   	ret
+
+0000106a <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+    106a:	b8 18 00 00 00       	mov    $0x18,%eax
+    106f:	cd 40                	int    $0x40
+    1071:	c3                   	ret
+
+00001072 <copy_file>:
+SYSCALL(copy_file)
+    1072:	b8 19 00 00 00       	mov    $0x19,%eax
+    1077:	cd 40                	int    $0x40
+    1079:	c3                   	ret
+
+0000107a <change_queue>:
+SYSCALL(change_queue)
+    107a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    107f:	cd 40                	int    $0x40
+    1081:	c3                   	ret
+
+00001082 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+    1082:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1087:	cd 40                	int    $0x40
+    1089:	c3                   	ret
+
+0000108a <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+    108a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    108f:	cd 40                	int    $0x40
+    1091:	c3                   	ret
+
+00001092 <print_process_info>:
+SYSCALL(print_process_info)
+    1092:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1097:	cd 40                	int    $0x40
+    1099:	c3                   	ret
+
+0000109a <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+    109a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    109f:	cd 40                	int    $0x40
+    10a1:	c3                   	ret
+
+000010a2 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+    10a2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    10a7:	cd 40                	int    $0x40
+    10a9:	c3                   	ret
+
+000010aa <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+    10aa:	b8 20 00 00 00       	mov    $0x20,%eax
+    10af:	cd 40                	int    $0x40
+    10b1:	c3                   	ret
+
+000010b2 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+    10b2:	b8 21 00 00 00       	mov    $0x21,%eax
+    10b7:	cd 40                	int    $0x40
+    10b9:	c3                   	ret
+
+000010ba <print_syscall_count>:
+SYSCALL(print_syscall_count)
+    10ba:	b8 22 00 00 00       	mov    $0x22,%eax
+    10bf:	cd 40                	int    $0x40
+    10c1:	c3                   	ret
+
+000010c2 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+    10c2:	b8 23 00 00 00       	mov    $0x23,%eax
+    10c7:	cd 40                	int    $0x40
+    10c9:	c3                   	ret
+
+000010ca <open_sharedmem>:
+SYSCALL(open_sharedmem)
+    10ca:	b8 24 00 00 00       	mov    $0x24,%eax
+    10cf:	cd 40                	int    $0x40
+    10d1:	c3                   	ret
+
+000010d2 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+    10d2:	b8 25 00 00 00       	mov    $0x25,%eax
+    10d7:	cd 40                	int    $0x40
+    10d9:	c3                   	ret
+
+000010da <set_affinity>:
+SYSCALL(set_affinity)
+    10da:	b8 26 00 00 00       	mov    $0x26,%eax
+    10df:	cd 40                	int    $0x40
+    10e1:	c3                   	ret
+
+000010e2 <setsched>:
+SYSCALL(setsched)
+    10e2:	b8 27 00 00 00       	mov    $0x27,%eax
+    10e7:	cd 40                	int    $0x40
+    10e9:	c3                   	ret
+
+000010ea <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+    10ea:	b8 28 00 00 00       	mov    $0x28,%eax
+    10ef:	cd 40                	int    $0x40
+    10f1:	c3                   	ret
+
+000010f2 <set_quantum>:
+SYSCALL(set_quantum)
+    10f2:	b8 29 00 00 00       	mov    $0x29,%eax
+    10f7:	cd 40                	int    $0x40
+    10f9:	c3                   	ret
+
+000010fa <schedtrace>:
+SYSCALL(schedtrace)
+    10fa:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    10ff:	cd 40                	int    $0x40
+    1101:	c3                   	ret
+
+00001102 <getrusage>:
+SYSCALL(getrusage)
+    1102:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1107:	cd 40                	int    $0x40
+    1109:	c3                   	ret
+
+0000110a <create_prioritylock>:
+SYSCALL(create_prioritylock)
+    110a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    110f:	cd 40                	int    $0x40
+    1111:	c3                   	ret
+
+00001112 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+    1112:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1117:	cd 40                	int    $0x40
+    1119:	c3                   	ret
+
+0000111a <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+    111a:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    111f:	cd 40                	int    $0x40
+    1121:	c3                   	ret
+
+00001122 <futex_wait>:
+SYSCALL(futex_wait)
+    1122:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1127:	cd 40                	int    $0x40
+    1129:	c3                   	ret
+
+0000112a <futex_wake>:
+SYSCALL(futex_wake)
+    112a:	b8 30 00 00 00       	mov    $0x30,%eax
+    112f:	cd 40                	int    $0x40
+    1131:	c3                   	ret
+
+00001132 <syscall_latency>:
+SYSCALL(syscall_latency)
+    1132:	b8 31 00 00 00       	mov    $0x31,%eax
+    1137:	cd 40                	int    $0x40
+    1139:	c3                   	ret
+
+0000113a <submit_batch>:
+SYSCALL(submit_batch)
+    113a:	b8 32 00 00 00       	mov    $0x32,%eax
+    113f:	cd 40                	int    $0x40
+    1141:	c3                   	ret
+
+00001142 <kmem_stats>:
+SYSCALL(kmem_stats)
+    1142:	b8 33 00 00 00       	mov    $0x33,%eax
+    1147:	cd 40                	int    $0x40
+    1149:	c3                   	ret
+
+0000114a <kmem_junk>:
+SYSCALL(kmem_junk)
+    114a:	b8 34 00 00 00       	mov    $0x34,%eax
+    114f:	cd 40                	int    $0x40
+    1151:	c3                   	ret
+
+00001152 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    1152:	55                   	push   %ebp
+    1153:	89 e5                	mov    %esp,%ebp
+    1155:	83 ec 18             	sub    $0x18,%esp
+    1158:	8b 45 0c             	mov    0xc(%ebp),%eax
+    115b:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    115e:	83 ec 04             	sub    $0x4,%esp
+    1161:	6a 01                	push   $0x1
+    1163:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1166:	50                   	push   %eax
+    1167:	ff 75 08             	push   0x8(%ebp)
+    116a:	e8 6b fe ff ff       	call   fda <write>
+    116f:	83 c4 10             	add    $0x10,%esp
+}
+    1172:	90                   	nop
+    1173:	c9                   	leave
+    1174:	c3                   	ret
+
+00001175 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1175:	55                   	push   %ebp
+    1176:	89 e5                	mov    %esp,%ebp
+    1178:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    117b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    1182:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    1186:	74 17                	je     119f <printint+0x2a>
+    1188:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    118c:	79 11                	jns    119f <printint+0x2a>
+    neg = 1;
+    118e:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    1195:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1198:	f7 d8                	neg    %eax
+    119a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    119d:	eb 06                	jmp    11a5 <printint+0x30>
+  } else {
+    x = xx;
+    119f:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11a2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    11a5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    11ac:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11af:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11b2:	ba 00 00 00 00       	mov    $0x0,%edx
+    11b7:	f7 f1                	div    %ecx
+    11b9:	89 d1                	mov    %edx,%ecx
+    11bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11be:	8d 50 01             	lea    0x1(%eax),%edx
+    11c1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    11c4:	0f b6 91 60 1f 00 00 	movzbl 0x1f60(%ecx),%edx
+    11cb:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    11cf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    11d2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11d5:	ba 00 00 00 00       	mov    $0x0,%edx
+    11da:	f7 f1                	div    %ecx
+    11dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    11df:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    11e3:	75 c7                	jne    11ac <printint+0x37>
+  if(neg)
+    11e5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    11e9:	74 2d                	je     1218 <printint+0xa3>
+    buf[i++] = '-';
+    11eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11ee:	8d 50 01             	lea    0x1(%eax),%edx
+    11f1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    11f4:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    11f9:	eb 1d                	jmp    1218 <printint+0xa3>
+    putc(fd, buf[i]);
+    11fb:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    11fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1201:	01 d0                	add    %edx,%eax
+    1203:	0f b6 00             	movzbl (%eax),%eax
+    1206:	0f be c0             	movsbl %al,%eax
+    1209:	83 ec 08             	sub    $0x8,%esp
+    120c:	50                   	push   %eax
+    120d:	ff 75 08             	push   0x8(%ebp)
+    1210:	e8 3d ff ff ff       	call   1152 <putc>
+    1215:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    1218:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    121c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1220:	79 d9                	jns    11fb <printint+0x86>
+}
+    1222:	90                   	nop
+    1223:	90                   	nop
+    1224:	c9                   	leave
+    1225:	c3                   	ret
+
+00001226 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1226:	55                   	push   %ebp
+    1227:	89 e5                	mov    %esp,%ebp
+    1229:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    122c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    1233:	8d 45 0c             	lea    0xc(%ebp),%eax
+    1236:	83 c0 04             	add    $0x4,%eax
+    1239:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    123c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1243:	e9 59 01 00 00       	jmp    13a1 <printf+0x17b>
+    c = fmt[i] & 0xff;
+    1248:	8b 55 0c             	mov    0xc(%ebp),%edx
+    124b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    124e:	01 d0                	add    %edx,%eax
+    1250:	0f b6 00             	movzbl (%eax),%eax
+    1253:	0f be c0             	movsbl %al,%eax
+    1256:	25 ff 00 00 00       	and    $0xff,%eax
+    125b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    125e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1262:	75 2c                	jne    1290 <printf+0x6a>
+      if(c == '%'){
+    1264:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    1268:	75 0c                	jne    1276 <printf+0x50>
+        state = '%';
+    126a:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    1271:	e9 27 01 00 00       	jmp    139d <printf+0x177>
+      } else {
+        putc(fd, c);
+    1276:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1279:	0f be c0             	movsbl %al,%eax
+    127c:	83 ec 08             	sub    $0x8,%esp
+    127f:	50                   	push   %eax
+    1280:	ff 75 08             	push   0x8(%ebp)
+    1283:	e8 ca fe ff ff       	call   1152 <putc>
+    1288:	83 c4 10             	add    $0x10,%esp
+    128b:	e9 0d 01 00 00       	jmp    139d <printf+0x177>
+      }
+    } else if(state == '%'){
+    1290:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    1294:	0f 85 03 01 00 00    	jne    139d <printf+0x177>
+      if(c == 'd'){
+    129a:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    129e:	75 1e                	jne    12be <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    12a0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    12a3:	8b 00                	mov    (%eax),%eax
+    12a5:	6a 01                	push   $0x1
+    12a7:	6a 0a                	push   $0xa
+    12a9:	50                   	push   %eax
+    12aa:	ff 75 08             	push   0x8(%ebp)
+    12ad:	e8 c3 fe ff ff       	call   1175 <printint>
+    12b2:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    12b5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    12b9:	e9 d8 00 00 00       	jmp    1396 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+    12be:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    12c2:	74 06                	je     12ca <printf+0xa4>
+    12c4:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    12c8:	75 1e                	jne    12e8 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+    12ca:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    12cd:	8b 00                	mov    (%eax),%eax
+    12cf:	6a 00                	push   $0x0
+    12d1:	6a 10                	push   $0x10
+    12d3:	50                   	push   %eax
+    12d4:	ff 75 08             	push   0x8(%ebp)
+    12d7:	e8 99 fe ff ff       	call   1175 <printint>
+    12dc:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    12df:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    12e3:	e9 ae 00 00 00       	jmp    1396 <printf+0x170>
+      } else if(c == 's'){
+    12e8:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    12ec:	75 43                	jne    1331 <printf+0x10b>
+        s = (char*)*ap;
+    12ee:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    12f1:	8b 00                	mov    (%eax),%eax
+    12f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    12f6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    12fa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    12fe:	75 25                	jne    1325 <printf+0xff>
+          s = "(null)";
+    1300:	c7 45 f4 20 19 00 00 	movl   $0x1920,-0xc(%ebp)
+        while(*s != 0){
+    1307:	eb 1c                	jmp    1325 <printf+0xff>
+          putc(fd, *s);
+    1309:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    130c:	0f b6 00             	movzbl (%eax),%eax
+    130f:	0f be c0             	movsbl %al,%eax
+    1312:	83 ec 08             	sub    $0x8,%esp
+    1315:	50                   	push   %eax
+    1316:	ff 75 08             	push   0x8(%ebp)
+    1319:	e8 34 fe ff ff       	call   1152 <putc>
+    131e:	83 c4 10             	add    $0x10,%esp
+          s++;
+    1321:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    1325:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1328:	0f b6 00             	movzbl (%eax),%eax
+    132b:	84 c0                	test   %al,%al
+    132d:	75 da                	jne    1309 <printf+0xe3>
+    132f:	eb 65                	jmp    1396 <printf+0x170>
+        }
+      } else if(c == 'c'){
+    1331:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    1335:	75 1d                	jne    1354 <printf+0x12e>
+        putc(fd, *ap);
+    1337:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    133a:	8b 00                	mov    (%eax),%eax
+    133c:	0f be c0             	movsbl %al,%eax
+    133f:	83 ec 08             	sub    $0x8,%esp
+    1342:	50                   	push   %eax
+    1343:	ff 75 08             	push   0x8(%ebp)
+    1346:	e8 07 fe ff ff       	call   1152 <putc>
+    134b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    134e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1352:	eb 42                	jmp    1396 <printf+0x170>
+      } else if(c == '%'){
+    1354:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    1358:	75 17                	jne    1371 <printf+0x14b>
+        putc(fd, c);
+    135a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    135d:	0f be c0             	movsbl %al,%eax
+    1360:	83 ec 08             	sub    $0x8,%esp
+    1363:	50                   	push   %eax
+    1364:	ff 75 08             	push   0x8(%ebp)
+    1367:	e8 e6 fd ff ff       	call   1152 <putc>
+    136c:	83 c4 10             	add    $0x10,%esp
+    136f:	eb 25                	jmp    1396 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1371:	83 ec 08             	sub    $0x8,%esp
+    1374:	6a 25                	push   $0x25
+    1376:	ff 75 08             	push   0x8(%ebp)
+    1379:	e8 d4 fd ff ff       	call   1152 <putc>
+    137e:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    1381:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1384:	0f be c0             	movsbl %al,%eax
+    1387:	83 ec 08             	sub    $0x8,%esp
+    138a:	50                   	push   %eax
+    138b:	ff 75 08             	push   0x8(%ebp)
+    138e:	e8 bf fd ff ff       	call   1152 <putc>
+    1393:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    1396:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    139d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    13a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+    13a4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13a7:	01 d0                	add    %edx,%eax
+    13a9:	0f b6 00             	movzbl (%eax),%eax
+    13ac:	84 c0                	test   %al,%al
+    13ae:	0f 85 94 fe ff ff    	jne    1248 <printf+0x22>
+    }
+  }
+}
+    13b4:	90                   	nop
+    13b5:	90                   	nop
+    13b6:	c9                   	leave
+    13b7:	c3                   	ret
+
+000013b8 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    13b8:	55                   	push   %ebp
+    13b9:	89 e5                	mov    %esp,%ebp
+    13bb:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    13be:	8b 45 08             	mov    0x8(%ebp),%eax
+    13c1:	83 e8 08             	sub    $0x8,%eax
+    13c4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    13c7:	a1 ec 1f 00 00       	mov    0x1fec,%eax
+    13cc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    13cf:	eb 24                	jmp    13f5 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    13d1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    13d4:	8b 00                	mov    (%eax),%eax
+    13d6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    13d9:	72 12                	jb     13ed <free+0x35>
+    13db:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    13de:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    13e1:	72 24                	jb     1407 <free+0x4f>
+    13e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    13e6:	8b 00                	mov    (%eax),%eax
+    13e8:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    13eb:	72 1a                	jb     1407 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    13ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    13f0:	8b 00                	mov    (%eax),%eax
+    13f2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    13f5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    13f8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    13fb:	73 d4                	jae    13d1 <free+0x19>
+    13fd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1400:	8b 00                	mov    (%eax),%eax
+    1402:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    1405:	73 ca                	jae    13d1 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1407:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    140a:	8b 40 04             	mov    0x4(%eax),%eax
+    140d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1414:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1417:	01 c2                	add    %eax,%edx
+    1419:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    141c:	8b 00                	mov    (%eax),%eax
+    141e:	39 c2                	cmp    %eax,%edx
+    1420:	75 24                	jne    1446 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+    1422:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1425:	8b 50 04             	mov    0x4(%eax),%edx
+    1428:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    142b:	8b 00                	mov    (%eax),%eax
+    142d:	8b 40 04             	mov    0x4(%eax),%eax
+    1430:	01 c2                	add    %eax,%edx
+    1432:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1435:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1438:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    143b:	8b 00                	mov    (%eax),%eax
+    143d:	8b 10                	mov    (%eax),%edx
+    143f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1442:	89 10                	mov    %edx,(%eax)
+    1444:	eb 0a                	jmp    1450 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1446:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1449:	8b 10                	mov    (%eax),%edx
+    144b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    144e:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    1450:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1453:	8b 40 04             	mov    0x4(%eax),%eax
+    1456:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    145d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1460:	01 d0                	add    %edx,%eax
+    1462:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    1465:	75 20                	jne    1487 <free+0xcf>
+    p->s.size += bp->s.size;
+    1467:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    146a:	8b 50 04             	mov    0x4(%eax),%edx
+    146d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1470:	8b 40 04             	mov    0x4(%eax),%eax
+    1473:	01 c2                	add    %eax,%edx
+    1475:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1478:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    147b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    147e:	8b 10                	mov    (%eax),%edx
+    1480:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1483:	89 10                	mov    %edx,(%eax)
+    1485:	eb 08                	jmp    148f <free+0xd7>
+  } else
+    p->s.ptr = bp;
+    1487:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    148a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    148d:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    148f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1492:	a3 ec 1f 00 00       	mov    %eax,0x1fec
+}
+    1497:	90                   	nop
+    1498:	c9                   	leave
+    1499:	c3                   	ret
+
+0000149a <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    149a:	55                   	push   %ebp
+    149b:	89 e5                	mov    %esp,%ebp
+    149d:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    14a0:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    14a7:	77 07                	ja     14b0 <morecore+0x16>
+    nu = 4096;
+    14a9:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    14b0:	8b 45 08             	mov    0x8(%ebp),%eax
+    14b3:	c1 e0 03             	shl    $0x3,%eax
+    14b6:	83 ec 0c             	sub    $0xc,%esp
+    14b9:	50                   	push   %eax
+    14ba:	e8 83 fb ff ff       	call   1042 <sbrk>
+    14bf:	83 c4 10             	add    $0x10,%esp
+    14c2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    14c5:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    14c9:	75 07                	jne    14d2 <morecore+0x38>
+    return 0;
+    14cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    14d0:	eb 26                	jmp    14f8 <morecore+0x5e>
+  hp = (Header*)p;
+    14d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14d5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    14d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    14db:	8b 55 08             	mov    0x8(%ebp),%edx
+    14de:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+    14e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    14e4:	83 c0 08             	add    $0x8,%eax
+    14e7:	83 ec 0c             	sub    $0xc,%esp
+    14ea:	50                   	push   %eax
+    14eb:	e8 c8 fe ff ff       	call   13b8 <free>
+    14f0:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    14f3:	a1 ec 1f 00 00       	mov    0x1fec,%eax
+}
+    14f8:	c9                   	leave
+    14f9:	c3                   	ret
+
+000014fa <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    14fa:	55                   	push   %ebp
+    14fb:	89 e5                	mov    %esp,%ebp
+    14fd:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1500:	8b 45 08             	mov    0x8(%ebp),%eax
+    1503:	83 c0 07             	add    $0x7,%eax
+    1506:	c1 e8 03             	shr    $0x3,%eax
+    1509:	83 c0 01             	add    $0x1,%eax
+    150c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+    150f:	a1 ec 1f 00 00       	mov    0x1fec,%eax
+    1514:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1517:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    151b:	75 23                	jne    1540 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+    151d:	c7 45 f0 e4 1f 00 00 	movl   $0x1fe4,-0x10(%ebp)
+    1524:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1527:	a3 ec 1f 00 00       	mov    %eax,0x1fec
+    152c:	a1 ec 1f 00 00       	mov    0x1fec,%eax
+    1531:	a3 e4 1f 00 00       	mov    %eax,0x1fe4
+    base.s.size = 0;
+    1536:	c7 05 e8 1f 00 00 00 	movl   $0x0,0x1fe8
+    153d:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1540:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1543:	8b 00                	mov    (%eax),%eax
+    1545:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1548:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    154b:	8b 40 04             	mov    0x4(%eax),%eax
+    154e:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    1551:	72 4d                	jb     15a0 <malloc+0xa6>
+      if(p->s.size == nunits)
+    1553:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1556:	8b 40 04             	mov    0x4(%eax),%eax
+    1559:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    155c:	75 0c                	jne    156a <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    155e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1561:	8b 10                	mov    (%eax),%edx
+    1563:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1566:	89 10                	mov    %edx,(%eax)
+    1568:	eb 26                	jmp    1590 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    156a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    156d:	8b 40 04             	mov    0x4(%eax),%eax
+    1570:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    1573:	89 c2                	mov    %eax,%edx
+    1575:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1578:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    157b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    157e:	8b 40 04             	mov    0x4(%eax),%eax
+    1581:	c1 e0 03             	shl    $0x3,%eax
+    1584:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    1587:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    158a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    158d:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    1590:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1593:	a3 ec 1f 00 00       	mov    %eax,0x1fec
+      return (void*)(p + 1);
+    1598:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    159b:	83 c0 08             	add    $0x8,%eax
+    159e:	eb 3b                	jmp    15db <malloc+0xe1>
+    }
+    if(p == freep)
+    15a0:	a1 ec 1f 00 00       	mov    0x1fec,%eax
+    15a5:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    15a8:	75 1e                	jne    15c8 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    15aa:	83 ec 0c             	sub    $0xc,%esp
+    15ad:	ff 75 ec             	push   -0x14(%ebp)
+    15b0:	e8 e5 fe ff ff       	call   149a <morecore>
+    15b5:	83 c4 10             	add    $0x10,%esp
+    15b8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    15bb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    15bf:	75 07                	jne    15c8 <malloc+0xce>
+        return 0;
+    15c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    15c6:	eb 13                	jmp    15db <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    15c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15cb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    15ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15d1:	8b 00                	mov    (%eax),%eax
+    15d3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    15d6:	e9 6d ff ff ff       	jmp    1548 <malloc+0x4e>
+  }
+}
+    15db:	c9                   	leave
+    15dc:	c3                   	ret
+
+000015dd <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+    15dd:	55                   	push   %ebp
+    15de:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    15e0:	8b 45 08             	mov    0x8(%ebp),%eax
+    15e3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    15e9:	90                   	nop
+    15ea:	5d                   	pop    %ebp
+    15eb:	c3                   	ret
+
+000015ec <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+    15ec:	55                   	push   %ebp
+    15ed:	89 e5                	mov    %esp,%ebp
+    15ef:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    15f2:	8b 55 08             	mov    0x8(%ebp),%edx
+    15f5:	b8 00 00 00 00       	mov    $0x0,%eax
+    15fa:	b9 01 00 00 00       	mov    $0x1,%ecx
+    15ff:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+    1603:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1606:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    160a:	74 3b                	je     1647 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+    160c:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+    1610:	74 2d                	je     163f <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+    1612:	8b 55 08             	mov    0x8(%ebp),%edx
+    1615:	b8 02 00 00 00       	mov    $0x2,%eax
+    161a:	87 02                	xchg   %eax,(%edx)
+    161c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+    161f:	eb 1e                	jmp    163f <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+    1621:	8b 45 08             	mov    0x8(%ebp),%eax
+    1624:	83 ec 08             	sub    $0x8,%esp
+    1627:	6a 02                	push   $0x2
+    1629:	50                   	push   %eax
+    162a:	e8 f3 fa ff ff       	call   1122 <futex_wait>
+    162f:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+    1632:	8b 55 08             	mov    0x8(%ebp),%edx
+    1635:	b8 02 00 00 00       	mov    $0x2,%eax
+    163a:	87 02                	xchg   %eax,(%edx)
+    163c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+    163f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1643:	75 dc                	jne    1621 <mutex_lock+0x35>
+    1645:	eb 01                	jmp    1648 <mutex_lock+0x5c>
+    return;
+    1647:	90                   	nop
+  }
+}
+    1648:	c9                   	leave
+    1649:	c3                   	ret
+
+0000164a <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+    164a:	55                   	push   %ebp
+    164b:	89 e5                	mov    %esp,%ebp
+    164d:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1650:	8b 45 08             	mov    0x8(%ebp),%eax
+    1653:	ba 01 00 00 00       	mov    $0x1,%edx
+    1658:	f7 da                	neg    %edx
+    165a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    165e:	83 fa 01             	cmp    $0x1,%edx
+    1661:	74 1a                	je     167d <mutex_unlock+0x33>
+    m->state = 0;
+    1663:	8b 45 08             	mov    0x8(%ebp),%eax
+    1666:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    166c:	8b 45 08             	mov    0x8(%ebp),%eax
+    166f:	83 ec 08             	sub    $0x8,%esp
+    1672:	6a 01                	push   $0x1
+    1674:	50                   	push   %eax
+    1675:	e8 b0 fa ff ff       	call   112a <futex_wake>
+    167a:	83 c4 10             	add    $0x10,%esp
+  }
+}
+    167d:	90                   	nop
+    167e:	c9                   	leave
+    167f:	c3                   	ret
+
+00001680 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+    1680:	55                   	push   %ebp
+    1681:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+    1683:	8b 45 08             	mov    0x8(%ebp),%eax
+    1686:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+    168c:	8b 45 08             	mov    0x8(%ebp),%eax
+    168f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+    1696:	90                   	nop
+    1697:	5d                   	pop    %ebp
+    1698:	c3                   	ret
+
+00001699 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+    1699:	55                   	push   %ebp
+    169a:	89 e5                	mov    %esp,%ebp
+    169c:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+    169f:	8b 45 08             	mov    0x8(%ebp),%eax
+    16a2:	83 c0 04             	add    $0x4,%eax
+    16a5:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+    16a9:	8b 45 08             	mov    0x8(%ebp),%eax
+    16ac:	83 ec 08             	sub    $0x8,%esp
+    16af:	ff 75 0c             	push   0xc(%ebp)
+    16b2:	50                   	push   %eax
+    16b3:	e8 6a fa ff ff       	call   1122 <futex_wait>
+    16b8:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+    16bb:	8b 45 08             	mov    0x8(%ebp),%eax
+    16be:	83 c0 04             	add    $0x4,%eax
+    16c1:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+    16c5:	90                   	nop
+    16c6:	c9                   	leave
+    16c7:	c3                   	ret
+
+000016c8 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+    16c8:	55                   	push   %ebp
+    16c9:	89 e5                	mov    %esp,%ebp
+    16cb:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+    16ce:	8b 45 08             	mov    0x8(%ebp),%eax
+    16d1:	8b 00                	mov    (%eax),%eax
+    16d3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+    16d6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    16da:	78 17                	js     16f3 <rwlock_rdlock+0x2b>
+    16dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16df:	83 c0 01             	add    $0x1,%eax
+    16e2:	89 c1                	mov    %eax,%ecx
+    16e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16e7:	8b 55 08             	mov    0x8(%ebp),%edx
+    16ea:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+    16ee:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    16f1:	74 19                	je     170c <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+    16f3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    16f7:	79 d5                	jns    16ce <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+    16f9:	83 ec 08             	sub    $0x8,%esp
+    16fc:	ff 75 f4             	push   -0xc(%ebp)
+    16ff:	ff 75 08             	push   0x8(%ebp)
+    1702:	e8 92 ff ff ff       	call   1699 <rwlock_sleep>
+    1707:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+    170a:	eb c2                	jmp    16ce <rwlock_rdlock+0x6>
+      return;
+    170c:	90                   	nop
+  }
+}
+    170d:	c9                   	leave
+    170e:	c3                   	ret
+
+0000170f <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+    170f:	55                   	push   %ebp
+    1710:	89 e5                	mov    %esp,%ebp
+    1712:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+    1715:	eb 11                	jmp    1728 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+    1717:	83 ec 08             	sub    $0x8,%esp
+    171a:	ff 75 f4             	push   -0xc(%ebp)
+    171d:	ff 75 08             	push   0x8(%ebp)
+    1720:	e8 74 ff ff ff       	call   1699 <rwlock_sleep>
+    1725:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+    1728:	8b 55 08             	mov    0x8(%ebp),%edx
+    172b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1730:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+    1735:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+    1739:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    173c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1740:	75 d5                	jne    1717 <rwlock_wrlock+0x8>
+}
+    1742:	90                   	nop
+    1743:	90                   	nop
+    1744:	c9                   	leave
+    1745:	c3                   	ret
+
+00001746 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+    1746:	55                   	push   %ebp
+    1747:	89 e5                	mov    %esp,%ebp
+    1749:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+    174c:	8b 45 08             	mov    0x8(%ebp),%eax
+    174f:	8b 00                	mov    (%eax),%eax
+    1751:	85 c0                	test   %eax,%eax
+    1753:	79 0c                	jns    1761 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+    1755:	8b 45 08             	mov    0x8(%ebp),%eax
+    1758:	ba 00 00 00 00       	mov    $0x0,%edx
+    175d:	87 10                	xchg   %edx,(%eax)
+    175f:	eb 18                	jmp    1779 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+    1761:	8b 55 08             	mov    0x8(%ebp),%edx
+    1764:	b8 01 00 00 00       	mov    $0x1,%eax
+    1769:	f7 d8                	neg    %eax
+    176b:	89 c1                	mov    %eax,%ecx
+    176d:	89 c8                	mov    %ecx,%eax
+    176f:	f0 0f c1 02          	lock xadd %eax,(%edx)
+    1773:	01 c8                	add    %ecx,%eax
+    1775:	85 c0                	test   %eax,%eax
+    1777:	75 20                	jne    1799 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+    1779:	8b 45 08             	mov    0x8(%ebp),%eax
+    177c:	8b 40 04             	mov    0x4(%eax),%eax
+    177f:	85 c0                	test   %eax,%eax
+    1781:	74 17                	je     179a <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+    1783:	8b 45 08             	mov    0x8(%ebp),%eax
+    1786:	83 ec 08             	sub    $0x8,%esp
+    1789:	68 ff ff ff 7f       	push   $0x7fffffff
+    178e:	50                   	push   %eax
+    178f:	e8 96 f9 ff ff       	call   112a <futex_wake>
+    1794:	83 c4 10             	add    $0x10,%esp
+    1797:	eb 01                	jmp    179a <rwlock_unlock+0x54>
+    return;
+    1799:	90                   	nop
+}
+    179a:	c9                   	leave
+    179b:	c3                   	ret
+
+0000179c <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+    179c:	55                   	push   %ebp
+    179d:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    179f:	8b 45 08             	mov    0x8(%ebp),%eax
+    17a2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    17a8:	90                   	nop
+    17a9:	5d                   	pop    %ebp
+    17aa:	c3                   	ret
+
+000017ab <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+    17ab:	55                   	push   %ebp
+    17ac:	89 e5                	mov    %esp,%ebp
+    17ae:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+    17b1:	8b 45 08             	mov    0x8(%ebp),%eax
+    17b4:	8b 00                	mov    (%eax),%eax
+    17b6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+    17b9:	83 ec 0c             	sub    $0xc,%esp
+    17bc:	ff 75 0c             	push   0xc(%ebp)
+    17bf:	e8 86 fe ff ff       	call   164a <mutex_unlock>
+    17c4:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+    17c7:	8b 45 08             	mov    0x8(%ebp),%eax
+    17ca:	83 ec 08             	sub    $0x8,%esp
+    17cd:	ff 75 f4             	push   -0xc(%ebp)
+    17d0:	50                   	push   %eax
+    17d1:	e8 4c f9 ff ff       	call   1122 <futex_wait>
+    17d6:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+    17d9:	83 ec 0c             	sub    $0xc,%esp
+    17dc:	ff 75 0c             	push   0xc(%ebp)
+    17df:	e8 08 fe ff ff       	call   15ec <mutex_lock>
+    17e4:	83 c4 10             	add    $0x10,%esp
+}
+    17e7:	90                   	nop
+    17e8:	c9                   	leave
+    17e9:	c3                   	ret
+
+000017ea <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+    17ea:	55                   	push   %ebp
+    17eb:	89 e5                	mov    %esp,%ebp
+    17ed:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+    17f0:	8b 45 08             	mov    0x8(%ebp),%eax
+    17f3:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    17f7:	8b 45 08             	mov    0x8(%ebp),%eax
+    17fa:	83 ec 08             	sub    $0x8,%esp
+    17fd:	6a 01                	push   $0x1
+    17ff:	50                   	push   %eax
+    1800:	e8 25 f9 ff ff       	call   112a <futex_wake>
+    1805:	83 c4 10             	add    $0x10,%esp
+}
+    1808:	90                   	nop
+    1809:	c9                   	leave
+    180a:	c3                   	ret
+
+0000180b <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+    180b:	55                   	push   %ebp
+    180c:	89 e5                	mov    %esp,%ebp
+    180e:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+    1811:	8b 45 08             	mov    0x8(%ebp),%eax
+    1814:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+    1818:	8b 45 08             	mov    0x8(%ebp),%eax
+    181b:	83 ec 08             	sub    $0x8,%esp
+    181e:	68 ff ff ff 7f       	push   $0x7fffffff
+    1823:	50                   	push   %eax
+    1824:	e8 01 f9 ff ff       	call   112a <futex_wake>
+    1829:	83 c4 10             	add    $0x10,%esp
+}
+    182c:	90                   	nop
+    182d:	c9                   	leave
+    182e:	c3                   	ret
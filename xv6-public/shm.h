@@ -1,14 +1,20 @@
-#define MAX_SHARED_PAGES 16
+#define NSHMREGION 64 // shared memory regions system-wide
+#define NSHMBUCKET 32 // hash chains for finding a region by id
+#define SHM_MAXPAGES (PGSIZE / sizeof(char *)) // pages in one region
 
-struct shared_page
+struct shared_region
 {
     int id;
-    uint ref_count;
-    char *frame;
+    uint npages;
+    uint ref_count;              // mappings of the region, in all processes
+    char **frames;               // page of frame pointers, 0 until first touched
+    struct shared_region *next;  // hash chain, or free list
 };
 
 struct shared_memory
 {
-    struct shared_page shared_pages[MAX_SHARED_PAGES];
+    struct shared_region regions[NSHMREGION];
+    struct shared_region *buckets[NSHMBUCKET];
+    struct shared_region *free;
     struct spinlock slk;
 };
@@ -0,0 +1,1852 @@
+
+_shm_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#define SHM_ID 1
+#define SHM_SIZE 4096
+#define DEFAULT_LOCK 0
+
+int main(int argc, char const *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 20             	sub    $0x20,%esp
+
+    char *shared_mem = (char *)open_sharedmem(SHM_ID, SHM_SIZE);
+  12:	83 ec 08             	sub    $0x8,%esp
+  15:	68 00 10 00 00       	push   $0x1000
+  1a:	6a 01                	push   $0x1
+  1c:	e8 6c 05 00 00       	call   58d <open_sharedmem>
+  21:	83 c4 10             	add    $0x10,%esp
+  24:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    char *value = (char *)shared_mem;
+  27:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  2a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    *value = 0;
+  2d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  30:	c6 00 00             	movb   $0x0,(%eax)
+
+    for (int i = 0; i < NUM_CHILDREN; i++)
+  33:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  3a:	e9 8a 00 00 00       	jmp    c9 <main+0xc9>
+    {
+        int pid = fork();
+  3f:	e8 31 04 00 00       	call   475 <fork>
+  44:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if (pid < 0)
+  47:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  4b:	79 17                	jns    64 <main+0x64>
+        {
+            printf(1, "Error forking child process.\n");
+  4d:	83 ec 08             	sub    $0x8,%esp
+  50:	68 f4 0c 00 00       	push   $0xcf4
+  55:	6a 01                	push   $0x1
+  57:	e8 8d 06 00 00       	call   6e9 <printf>
+  5c:	83 c4 10             	add    $0x10,%esp
+            exit();
+  5f:	e8 19 04 00 00       	call   47d <exit>
+        }
+        else if (pid == 0)
+  64:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  68:	75 5b                	jne    c5 <main+0xc5>
+        {
+            // The region is inherited from the parent at the same address.
+            acquire_prioritylock(DEFAULT_LOCK);
+  6a:	83 ec 0c             	sub    $0xc,%esp
+  6d:	6a 00                	push   $0x0
+  6f:	e8 f9 04 00 00       	call   56d <acquire_prioritylock>
+  74:	83 c4 10             	add    $0x10,%esp
+            *value += 1;
+  77:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  7a:	0f b6 00             	movzbl (%eax),%eax
+  7d:	83 c0 01             	add    $0x1,%eax
+  80:	89 c2                	mov    %eax,%edx
+  82:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  85:	88 10                	mov    %dl,(%eax)
+            printf(1, "Child proc with pid %d shared memory value is : %d\n", getpid(), *value);
+  87:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8a:	0f b6 00             	movzbl (%eax),%eax
+  8d:	0f be d8             	movsbl %al,%ebx
+  90:	e8 68 04 00 00       	call   4fd <getpid>
+  95:	53                   	push   %ebx
+  96:	50                   	push   %eax
+  97:	68 14 0d 00 00       	push   $0xd14
+  9c:	6a 01                	push   $0x1
+  9e:	e8 46 06 00 00       	call   6e9 <printf>
+  a3:	83 c4 10             	add    $0x10,%esp
+            release_prioritylock(DEFAULT_LOCK);
+  a6:	83 ec 0c             	sub    $0xc,%esp
+  a9:	6a 00                	push   $0x0
+  ab:	e8 c5 04 00 00       	call   575 <release_prioritylock>
+  b0:	83 c4 10             	add    $0x10,%esp
+            close_sharedmem(SHM_ID);
+  b3:	83 ec 0c             	sub    $0xc,%esp
+  b6:	6a 01                	push   $0x1
+  b8:	e8 d8 04 00 00       	call   595 <close_sharedmem>
+  bd:	83 c4 10             	add    $0x10,%esp
+            exit();
+  c0:	e8 b8 03 00 00       	call   47d <exit>
+    for (int i = 0; i < NUM_CHILDREN; i++)
+  c5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  c9:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+  cd:	0f 8e 6c ff ff ff    	jle    3f <main+0x3f>
+        }
+    }
+
+    for (int i = 0; i < NUM_CHILDREN; i++)
+  d3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  da:	eb 09                	jmp    e5 <main+0xe5>
+    {
+        wait();
+  dc:	e8 a4 03 00 00       	call   485 <wait>
+    for (int i = 0; i < NUM_CHILDREN; i++)
+  e1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  e5:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+  e9:	7e f1                	jle    dc <main+0xdc>
+    }
+
+    printf(1, "Final shared memory value is : %d\n", *value);
+  eb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  ee:	0f b6 00             	movzbl (%eax),%eax
+  f1:	0f be c0             	movsbl %al,%eax
+  f4:	83 ec 04             	sub    $0x4,%esp
+  f7:	50                   	push   %eax
+  f8:	68 48 0d 00 00       	push   $0xd48
+  fd:	6a 01                	push   $0x1
+  ff:	e8 e5 05 00 00       	call   6e9 <printf>
+ 104:	83 c4 10             	add    $0x10,%esp
+
+    struct plstat st;
+    if (prioritylock_stats(DEFAULT_LOCK, &st) == 0)
+ 107:	83 ec 08             	sub    $0x8,%esp
+ 10a:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 10d:	50                   	push   %eax
+ 10e:	6a 00                	push   $0x0
+ 110:	e8 c8 04 00 00       	call   5dd <prioritylock_stats>
+ 115:	83 c4 10             	add    $0x10,%esp
+ 118:	85 c0                	test   %eax,%eax
+ 11a:	75 1e                	jne    13a <main+0x13a>
+        printf(1, "Lock acquired free: %d, spinning: %d, sleeping: %d\n", st.free, st.spun, st.slept);
+ 11c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 11f:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 122:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 125:	83 ec 0c             	sub    $0xc,%esp
+ 128:	51                   	push   %ecx
+ 129:	52                   	push   %edx
+ 12a:	50                   	push   %eax
+ 12b:	68 6c 0d 00 00       	push   $0xd6c
+ 130:	6a 01                	push   $0x1
+ 132:	e8 b2 05 00 00       	call   6e9 <printf>
+ 137:	83 c4 20             	add    $0x20,%esp
+    close_sharedmem(SHM_ID);
+ 13a:	83 ec 0c             	sub    $0xc,%esp
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 51 04 00 00       	call   595 <close_sharedmem>
+ 144:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 147:	e8 31 03 00 00       	call   47d <exit>
+
+0000014c <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 14c:	55                   	push   %ebp
+ 14d:	89 e5                	mov    %esp,%ebp
+ 14f:	57                   	push   %edi
+ 150:	53                   	push   %ebx
+{
+ 151:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 154:	8b 55 10             	mov    0x10(%ebp),%edx
+ 157:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 15a:	89 cb                	mov    %ecx,%ebx
+ 15c:	89 df                	mov    %ebx,%edi
+ 15e:	89 d1                	mov    %edx,%ecx
+ 160:	fc                   	cld
+ 161:	f3 aa                	rep stos %al,%es:(%edi)
+ 163:	89 ca                	mov    %ecx,%edx
+ 165:	89 fb                	mov    %edi,%ebx
+ 167:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 16a:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 16d:	90                   	nop
+ 16e:	5b                   	pop    %ebx
+ 16f:	5f                   	pop    %edi
+ 170:	5d                   	pop    %ebp
+ 171:	c3                   	ret
+
+00000172 <strcpy>:
+{
+ 172:	55                   	push   %ebp
+ 173:	89 e5                	mov    %esp,%ebp
+ 175:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 178:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 17e:	90                   	nop
+ 17f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 182:	8d 42 01             	lea    0x1(%edx),%eax
+ 185:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 188:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18b:	8d 48 01             	lea    0x1(%eax),%ecx
+ 18e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 191:	0f b6 12             	movzbl (%edx),%edx
+ 194:	88 10                	mov    %dl,(%eax)
+ 196:	0f b6 00             	movzbl (%eax),%eax
+ 199:	84 c0                	test   %al,%al
+ 19b:	75 e2                	jne    17f <strcpy+0xd>
+  return os;
+ 19d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1a0:	c9                   	leave
+ 1a1:	c3                   	ret
+
+000001a2 <strcmp>:
+{
+ 1a2:	55                   	push   %ebp
+ 1a3:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1a5:	eb 08                	jmp    1af <strcmp+0xd>
+    p++, q++;
+ 1a7:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1ab:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1af:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b2:	0f b6 00             	movzbl (%eax),%eax
+ 1b5:	84 c0                	test   %al,%al
+ 1b7:	74 10                	je     1c9 <strcmp+0x27>
+ 1b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bc:	0f b6 10             	movzbl (%eax),%edx
+ 1bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c2:	0f b6 00             	movzbl (%eax),%eax
+ 1c5:	38 c2                	cmp    %al,%dl
+ 1c7:	74 de                	je     1a7 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1cc:	0f b6 00             	movzbl (%eax),%eax
+ 1cf:	0f b6 d0             	movzbl %al,%edx
+ 1d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d5:	0f b6 00             	movzbl (%eax),%eax
+ 1d8:	0f b6 c0             	movzbl %al,%eax
+ 1db:	29 c2                	sub    %eax,%edx
+ 1dd:	89 d0                	mov    %edx,%eax
+}
+ 1df:	5d                   	pop    %ebp
+ 1e0:	c3                   	ret
+
+000001e1 <strlen>:
+{
+ 1e1:	55                   	push   %ebp
+ 1e2:	89 e5                	mov    %esp,%ebp
+ 1e4:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1e7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1ee:	eb 04                	jmp    1f4 <strlen+0x13>
+ 1f0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1f4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fa:	01 d0                	add    %edx,%eax
+ 1fc:	0f b6 00             	movzbl (%eax),%eax
+ 1ff:	84 c0                	test   %al,%al
+ 201:	75 ed                	jne    1f0 <strlen+0xf>
+  return n;
+ 203:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 206:	c9                   	leave
+ 207:	c3                   	ret
+
+00000208 <memset>:
+{
+ 208:	55                   	push   %ebp
+ 209:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 20b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 20e:	50                   	push   %eax
+ 20f:	ff 75 0c             	push   0xc(%ebp)
+ 212:	ff 75 08             	push   0x8(%ebp)
+ 215:	e8 32 ff ff ff       	call   14c <stosb>
+ 21a:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 21d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 220:	c9                   	leave
+ 221:	c3                   	ret
+
+00000222 <strchr>:
+{
+ 222:	55                   	push   %ebp
+ 223:	89 e5                	mov    %esp,%ebp
+ 225:	83 ec 04             	sub    $0x4,%esp
+ 228:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22b:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 22e:	eb 14                	jmp    244 <strchr+0x22>
+    if(*s == c)
+ 230:	8b 45 08             	mov    0x8(%ebp),%eax
+ 233:	0f b6 00             	movzbl (%eax),%eax
+ 236:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 239:	75 05                	jne    240 <strchr+0x1e>
+      return (char*)s;
+ 23b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23e:	eb 13                	jmp    253 <strchr+0x31>
+  for(; *s; s++)
+ 240:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 244:	8b 45 08             	mov    0x8(%ebp),%eax
+ 247:	0f b6 00             	movzbl (%eax),%eax
+ 24a:	84 c0                	test   %al,%al
+ 24c:	75 e2                	jne    230 <strchr+0xe>
+  return 0;
+ 24e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+
+00000255 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 255:	55                   	push   %ebp
+ 256:	89 e5                	mov    %esp,%ebp
+ 258:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 25b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 262:	eb 42                	jmp    2a6 <gets+0x51>
+    cc = read(0, &c, 1);
+ 264:	83 ec 04             	sub    $0x4,%esp
+ 267:	6a 01                	push   $0x1
+ 269:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 26c:	50                   	push   %eax
+ 26d:	6a 00                	push   $0x0
+ 26f:	e8 21 02 00 00       	call   495 <read>
+ 274:	83 c4 10             	add    $0x10,%esp
+ 277:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 27a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 27e:	7e 33                	jle    2b3 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 280:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 283:	8d 50 01             	lea    0x1(%eax),%edx
+ 286:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 289:	89 c2                	mov    %eax,%edx
+ 28b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28e:	01 c2                	add    %eax,%edx
+ 290:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 294:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 296:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 29a:	3c 0a                	cmp    $0xa,%al
+ 29c:	74 16                	je     2b4 <gets+0x5f>
+ 29e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a2:	3c 0d                	cmp    $0xd,%al
+ 2a4:	74 0e                	je     2b4 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2a9:	83 c0 01             	add    $0x1,%eax
+ 2ac:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2af:	7f b3                	jg     264 <gets+0xf>
+ 2b1:	eb 01                	jmp    2b4 <gets+0x5f>
+      break;
+ 2b3:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 2b4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ba:	01 d0                	add    %edx,%eax
+ 2bc:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2bf:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c2:	c9                   	leave
+ 2c3:	c3                   	ret
+
+000002c4 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2c4:	55                   	push   %ebp
+ 2c5:	89 e5                	mov    %esp,%ebp
+ 2c7:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2ca:	83 ec 08             	sub    $0x8,%esp
+ 2cd:	6a 00                	push   $0x0
+ 2cf:	ff 75 08             	push   0x8(%ebp)
+ 2d2:	e8 e6 01 00 00       	call   4bd <open>
+ 2d7:	83 c4 10             	add    $0x10,%esp
+ 2da:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2dd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2e1:	79 07                	jns    2ea <stat+0x26>
+    return -1;
+ 2e3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2e8:	eb 25                	jmp    30f <stat+0x4b>
+  r = fstat(fd, st);
+ 2ea:	83 ec 08             	sub    $0x8,%esp
+ 2ed:	ff 75 0c             	push   0xc(%ebp)
+ 2f0:	ff 75 f4             	push   -0xc(%ebp)
+ 2f3:	e8 dd 01 00 00       	call   4d5 <fstat>
+ 2f8:	83 c4 10             	add    $0x10,%esp
+ 2fb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2fe:	83 ec 0c             	sub    $0xc,%esp
+ 301:	ff 75 f4             	push   -0xc(%ebp)
+ 304:	e8 9c 01 00 00       	call   4a5 <close>
+ 309:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 30c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 30f:	c9                   	leave
+ 310:	c3                   	ret
+
+00000311 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 311:	55                   	push   %ebp
+ 312:	89 e5                	mov    %esp,%ebp
+ 314:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 317:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 31e:	eb 25                	jmp    345 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 320:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 323:	89 d0                	mov    %edx,%eax
+ 325:	c1 e0 02             	shl    $0x2,%eax
+ 328:	01 d0                	add    %edx,%eax
+ 32a:	01 c0                	add    %eax,%eax
+ 32c:	89 c1                	mov    %eax,%ecx
+ 32e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 331:	8d 50 01             	lea    0x1(%eax),%edx
+ 334:	89 55 08             	mov    %edx,0x8(%ebp)
+ 337:	0f b6 00             	movzbl (%eax),%eax
+ 33a:	0f be c0             	movsbl %al,%eax
+ 33d:	01 c8                	add    %ecx,%eax
+ 33f:	83 e8 30             	sub    $0x30,%eax
+ 342:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 345:	8b 45 08             	mov    0x8(%ebp),%eax
+ 348:	0f b6 00             	movzbl (%eax),%eax
+ 34b:	3c 2f                	cmp    $0x2f,%al
+ 34d:	7e 0a                	jle    359 <atoi+0x48>
+ 34f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 352:	0f b6 00             	movzbl (%eax),%eax
+ 355:	3c 39                	cmp    $0x39,%al
+ 357:	7e c7                	jle    320 <atoi+0xf>
+  return n;
+ 359:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 35c:	c9                   	leave
+ 35d:	c3                   	ret
+
+0000035e <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 35e:	55                   	push   %ebp
+ 35f:	89 e5                	mov    %esp,%ebp
+ 361:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 364:	8b 45 08             	mov    0x8(%ebp),%eax
+ 367:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 36a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 36d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 370:	eb 17                	jmp    389 <memmove+0x2b>
+    *dst++ = *src++;
+ 372:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 375:	8d 42 01             	lea    0x1(%edx),%eax
+ 378:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 37b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 37e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 381:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 384:	0f b6 12             	movzbl (%edx),%edx
+ 387:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 389:	8b 45 10             	mov    0x10(%ebp),%eax
+ 38c:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 38f:	89 55 10             	mov    %edx,0x10(%ebp)
+ 392:	85 c0                	test   %eax,%eax
+ 394:	7f dc                	jg     372 <memmove+0x14>
+  return vdst;
+ 396:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 399:	c9                   	leave
+ 39a:	c3                   	ret
+
+0000039b <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 39b:	55                   	push   %ebp
+ 39c:	89 e5                	mov    %esp,%ebp
+ 39e:	57                   	push   %edi
+ 39f:	56                   	push   %esi
+ 3a0:	83 ec 30             	sub    $0x30,%esp
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ac:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 3af:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 3b6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 3bd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3c0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3c3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 3c6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3c9:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 3d0:	e9 89 00 00 00       	jmp    45e <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 3d5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3d8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3db:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 3df:	01 c0                	add    %eax,%eax
+ 3e1:	89 c6                	mov    %eax,%esi
+ 3e3:	89 d7                	mov    %edx,%edi
+ 3e5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3e8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 3eb:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 3ee:	0f ad d0             	shrd   %cl,%edx,%eax
+ 3f1:	d3 ea                	shr    %cl,%edx
+ 3f3:	f6 c1 20             	test   $0x20,%cl
+ 3f6:	74 04                	je     3fc <udiv64+0x61>
+ 3f8:	89 d0                	mov    %edx,%eax
+ 3fa:	31 d2                	xor    %edx,%edx
+ 3fc:	83 e0 01             	and    $0x1,%eax
+ 3ff:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 402:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 409:	89 f0                	mov    %esi,%eax
+ 40b:	89 fa                	mov    %edi,%edx
+ 40d:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 410:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 413:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 416:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 419:	8b 45 10             	mov    0x10(%ebp),%eax
+ 41c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 421:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 424:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 427:	19 d1                	sbb    %edx,%ecx
+ 429:	72 2f                	jb     45a <udiv64+0xbf>
+      r -= d;
+ 42b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 42e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 433:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 436:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 439:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 43c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 441:	ba 00 00 00 00       	mov    $0x0,%edx
+ 446:	0f a5 c2             	shld   %cl,%eax,%edx
+ 449:	d3 e0                	shl    %cl,%eax
+ 44b:	f6 c1 20             	test   $0x20,%cl
+ 44e:	74 04                	je     454 <udiv64+0xb9>
+ 450:	89 c2                	mov    %eax,%edx
+ 452:	31 c0                	xor    %eax,%eax
+ 454:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 457:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 45a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 45e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 462:	0f 89 6d ff ff ff    	jns    3d5 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 468:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 46b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 46e:	83 c4 30             	add    $0x30,%esp
+ 471:	5e                   	pop    %esi
+ 472:	5f                   	pop    %edi
+ 473:	5d                   	pop    %ebp
+ 474:	c3                   	ret
+
+00000475 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 475:	b8 01 00 00 00       	mov    $0x1,%eax
+ 47a:	cd 40                	int    $0x40
+ 47c:	c3                   	ret
+
+0000047d <exit>:
+SYSCALL(exit)
+ 47d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 482:	cd 40                	int    $0x40
+ 484:	c3                   	ret
+
+00000485 <wait>:
+SYSCALL(wait)
+ 485:	b8 03 00 00 00       	mov    $0x3,%eax
+ 48a:	cd 40                	int    $0x40
+ 48c:	c3                   	ret
+
+0000048d <pipe>:
+SYSCALL(pipe)
+ 48d:	b8 04 00 00 00       	mov    $0x4,%eax
+ 492:	cd 40                	int    $0x40
+ 494:	c3                   	ret
+
+00000495 <read>:
+SYSCALL(read)
+ 495:	b8 05 00 00 00       	mov    $0x5,%eax
+ 49a:	cd 40                	int    $0x40
+ 49c:	c3                   	ret
+
+0000049d <write>:
+SYSCALL(write)
+ 49d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4a2:	cd 40                	int    $0x40
+ 4a4:	c3                   	ret
+
+000004a5 <close>:
+SYSCALL(close)
+ 4a5:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4aa:	cd 40                	int    $0x40
+ 4ac:	c3                   	ret
+
+000004ad <kill>:
+SYSCALL(kill)
+ 4ad:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4b2:	cd 40                	int    $0x40
+ 4b4:	c3                   	ret
+
+000004b5 <exec>:
+SYSCALL(exec)
+ 4b5:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4ba:	cd 40                	int    $0x40
+ 4bc:	c3                   	ret
+
+000004bd <open>:
+SYSCALL(open)
+ 4bd:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4c2:	cd 40                	int    $0x40
+ 4c4:	c3                   	ret
+
+000004c5 <mknod>:
+SYSCALL(mknod)
+ 4c5:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4ca:	cd 40                	int    $0x40
+ 4cc:	c3                   	ret
+
+000004cd <unlink>:
+SYSCALL(unlink)
+ 4cd:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4d2:	cd 40                	int    $0x40
+ 4d4:	c3                   	ret
+
+000004d5 <fstat>:
+SYSCALL(fstat)
+ 4d5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4da:	cd 40                	int    $0x40
+ 4dc:	c3                   	ret
+
+000004dd <link>:
+SYSCALL(link)
+ 4dd:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4e2:	cd 40                	int    $0x40
+ 4e4:	c3                   	ret
+
+000004e5 <mkdir>:
+SYSCALL(mkdir)
+ 4e5:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4ea:	cd 40                	int    $0x40
+ 4ec:	c3                   	ret
+
+000004ed <chdir>:
+SYSCALL(chdir)
+ 4ed:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4f2:	cd 40                	int    $0x40
+ 4f4:	c3                   	ret
+
+000004f5 <dup>:
+SYSCALL(dup)
+ 4f5:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4fa:	cd 40                	int    $0x40
+ 4fc:	c3                   	ret
+
+000004fd <getpid>:
+SYSCALL(getpid)
+ 4fd:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 502:	cd 40                	int    $0x40
+ 504:	c3                   	ret
+
+00000505 <sbrk>:
+SYSCALL(sbrk)
+ 505:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 50a:	cd 40                	int    $0x40
+ 50c:	c3                   	ret
+
+0000050d <sleep>:
+SYSCALL(sleep)
+ 50d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 512:	cd 40                	int    $0x40
+ 514:	c3                   	ret
+
+00000515 <uptime>:
+SYSCALL(uptime)
+ 515:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 51a:	cd 40                	int    $0x40
+ 51c:	c3                   	ret
+
+0000051d <find_digital_root>:
+SYSCALL(find_digital_root)
+ 51d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 522:	cd 40                	int    $0x40
+ 524:	c3                   	ret
+
+00000525 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 525:	b8 17 00 00 00       	mov    $0x17,%eax
+ 52a:	cd 40                	int    $0x40
+ 52c:	c3                   	ret
+
+0000052d <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 52d:	b8 18 00 00 00       	mov    $0x18,%eax
+ 532:	cd 40                	int    $0x40
+ 534:	c3                   	ret
+
+00000535 <copy_file>:
+SYSCALL(copy_file)
+ 535:	b8 19 00 00 00       	mov    $0x19,%eax
+ 53a:	cd 40                	int    $0x40
+ 53c:	c3                   	ret
+
+0000053d <change_queue>:
+SYSCALL(change_queue)
+ 53d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 542:	cd 40                	int    $0x40
+ 544:	c3                   	ret
+
+00000545 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 545:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 54a:	cd 40                	int    $0x40
+ 54c:	c3                   	ret
+
+0000054d <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 54d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 552:	cd 40                	int    $0x40
+ 554:	c3                   	ret
+
+00000555 <print_process_info>:
+SYSCALL(print_process_info)
+ 555:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 55a:	cd 40                	int    $0x40
+ 55c:	c3                   	ret
+
+0000055d <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 55d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 562:	cd 40                	int    $0x40
+ 564:	c3                   	ret
+
+00000565 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 565:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 56a:	cd 40                	int    $0x40
+ 56c:	c3                   	ret
+
+0000056d <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 56d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 572:	cd 40                	int    $0x40
+ 574:	c3                   	ret
+
+00000575 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 575:	b8 21 00 00 00       	mov    $0x21,%eax
+ 57a:	cd 40                	int    $0x40
+ 57c:	c3                   	ret
+
+0000057d <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 57d:	b8 22 00 00 00       	mov    $0x22,%eax
+ 582:	cd 40                	int    $0x40
+ 584:	c3                   	ret
+
+00000585 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 585:	b8 23 00 00 00       	mov    $0x23,%eax
+ 58a:	cd 40                	int    $0x40
+ 58c:	c3                   	ret
+
+0000058d <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 58d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 592:	cd 40                	int    $0x40
+ 594:	c3                   	ret
+
+00000595 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 595:	b8 25 00 00 00       	mov    $0x25,%eax
+ 59a:	cd 40                	int    $0x40
+ 59c:	c3                   	ret
+
+0000059d <set_affinity>:
+SYSCALL(set_affinity)
+ 59d:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5a2:	cd 40                	int    $0x40
+ 5a4:	c3                   	ret
+
+000005a5 <setsched>:
+SYSCALL(setsched)
+ 5a5:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5aa:	cd 40                	int    $0x40
+ 5ac:	c3                   	ret
+
+000005ad <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 5ad:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5b2:	cd 40                	int    $0x40
+ 5b4:	c3                   	ret
+
+000005b5 <set_quantum>:
+SYSCALL(set_quantum)
+ 5b5:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5ba:	cd 40                	int    $0x40
+ 5bc:	c3                   	ret
+
+000005bd <schedtrace>:
+SYSCALL(schedtrace)
+ 5bd:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5c2:	cd 40                	int    $0x40
+ 5c4:	c3                   	ret
+
+000005c5 <getrusage>:
+SYSCALL(getrusage)
+ 5c5:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5ca:	cd 40                	int    $0x40
+ 5cc:	c3                   	ret
+
+000005cd <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 5cd:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5d2:	cd 40                	int    $0x40
+ 5d4:	c3                   	ret
+
+000005d5 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 5d5:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5da:	cd 40                	int    $0x40
+ 5dc:	c3                   	ret
+
+000005dd <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 5dd:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5e2:	cd 40                	int    $0x40
+ 5e4:	c3                   	ret
+
+000005e5 <futex_wait>:
+SYSCALL(futex_wait)
+ 5e5:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5ea:	cd 40                	int    $0x40
+ 5ec:	c3                   	ret
+
+000005ed <futex_wake>:
+SYSCALL(futex_wake)
+ 5ed:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5f2:	cd 40                	int    $0x40
+ 5f4:	c3                   	ret
+
+000005f5 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 5f5:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5fa:	cd 40                	int    $0x40
+ 5fc:	c3                   	ret
+
+000005fd <submit_batch>:
+SYSCALL(submit_batch)
+ 5fd:	b8 32 00 00 00       	mov    $0x32,%eax
+ 602:	cd 40                	int    $0x40
+ 604:	c3                   	ret
+
+00000605 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 605:	b8 33 00 00 00       	mov    $0x33,%eax
+ 60a:	cd 40                	int    $0x40
+ 60c:	c3                   	ret
+
+0000060d <kmem_junk>:
+SYSCALL(kmem_junk)
+ 60d:	b8 34 00 00 00       	mov    $0x34,%eax
+ 612:	cd 40                	int    $0x40
+ 614:	c3                   	ret
+
+00000615 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 615:	55                   	push   %ebp
+ 616:	89 e5                	mov    %esp,%ebp
+ 618:	83 ec 18             	sub    $0x18,%esp
+ 61b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 61e:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 621:	83 ec 04             	sub    $0x4,%esp
+ 624:	6a 01                	push   $0x1
+ 626:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 629:	50                   	push   %eax
+ 62a:	ff 75 08             	push   0x8(%ebp)
+ 62d:	e8 6b fe ff ff       	call   49d <write>
+ 632:	83 c4 10             	add    $0x10,%esp
+}
+ 635:	90                   	nop
+ 636:	c9                   	leave
+ 637:	c3                   	ret
+
+00000638 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 638:	55                   	push   %ebp
+ 639:	89 e5                	mov    %esp,%ebp
+ 63b:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 63e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 645:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 649:	74 17                	je     662 <printint+0x2a>
+ 64b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 64f:	79 11                	jns    662 <printint+0x2a>
+    neg = 1;
+ 651:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 658:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 65b:	f7 d8                	neg    %eax
+ 65d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 660:	eb 06                	jmp    668 <printint+0x30>
+  } else {
+    x = xx;
+ 662:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 665:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 668:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 66f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 672:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 675:	ba 00 00 00 00       	mov    $0x0,%edx
+ 67a:	f7 f1                	div    %ecx
+ 67c:	89 d1                	mov    %edx,%ecx
+ 67e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 681:	8d 50 01             	lea    0x1(%eax),%edx
+ 684:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 687:	0f b6 91 98 11 00 00 	movzbl 0x1198(%ecx),%edx
+ 68e:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 692:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 695:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 698:	ba 00 00 00 00       	mov    $0x0,%edx
+ 69d:	f7 f1                	div    %ecx
+ 69f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6a2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6a6:	75 c7                	jne    66f <printint+0x37>
+  if(neg)
+ 6a8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6ac:	74 2d                	je     6db <printint+0xa3>
+    buf[i++] = '-';
+ 6ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6b1:	8d 50 01             	lea    0x1(%eax),%edx
+ 6b4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6b7:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 6bc:	eb 1d                	jmp    6db <printint+0xa3>
+    putc(fd, buf[i]);
+ 6be:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6c4:	01 d0                	add    %edx,%eax
+ 6c6:	0f b6 00             	movzbl (%eax),%eax
+ 6c9:	0f be c0             	movsbl %al,%eax
+ 6cc:	83 ec 08             	sub    $0x8,%esp
+ 6cf:	50                   	push   %eax
+ 6d0:	ff 75 08             	push   0x8(%ebp)
+ 6d3:	e8 3d ff ff ff       	call   615 <putc>
+ 6d8:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 6db:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 6df:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6e3:	79 d9                	jns    6be <printint+0x86>
+}
+ 6e5:	90                   	nop
+ 6e6:	90                   	nop
+ 6e7:	c9                   	leave
+ 6e8:	c3                   	ret
+
+000006e9 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6e9:	55                   	push   %ebp
+ 6ea:	89 e5                	mov    %esp,%ebp
+ 6ec:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 6ef:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6f6:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6f9:	83 c0 04             	add    $0x4,%eax
+ 6fc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6ff:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 706:	e9 59 01 00 00       	jmp    864 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 70b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 70e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 711:	01 d0                	add    %edx,%eax
+ 713:	0f b6 00             	movzbl (%eax),%eax
+ 716:	0f be c0             	movsbl %al,%eax
+ 719:	25 ff 00 00 00       	and    $0xff,%eax
+ 71e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 721:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 725:	75 2c                	jne    753 <printf+0x6a>
+      if(c == '%'){
+ 727:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 72b:	75 0c                	jne    739 <printf+0x50>
+        state = '%';
+ 72d:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 734:	e9 27 01 00 00       	jmp    860 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 739:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 73c:	0f be c0             	movsbl %al,%eax
+ 73f:	83 ec 08             	sub    $0x8,%esp
+ 742:	50                   	push   %eax
+ 743:	ff 75 08             	push   0x8(%ebp)
+ 746:	e8 ca fe ff ff       	call   615 <putc>
+ 74b:	83 c4 10             	add    $0x10,%esp
+ 74e:	e9 0d 01 00 00       	jmp    860 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 753:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 757:	0f 85 03 01 00 00    	jne    860 <printf+0x177>
+      if(c == 'd'){
+ 75d:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 761:	75 1e                	jne    781 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 763:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 766:	8b 00                	mov    (%eax),%eax
+ 768:	6a 01                	push   $0x1
+ 76a:	6a 0a                	push   $0xa
+ 76c:	50                   	push   %eax
+ 76d:	ff 75 08             	push   0x8(%ebp)
+ 770:	e8 c3 fe ff ff       	call   638 <printint>
+ 775:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 778:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 77c:	e9 d8 00 00 00       	jmp    859 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 781:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 785:	74 06                	je     78d <printf+0xa4>
+ 787:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 78b:	75 1e                	jne    7ab <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 78d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 790:	8b 00                	mov    (%eax),%eax
+ 792:	6a 00                	push   $0x0
+ 794:	6a 10                	push   $0x10
+ 796:	50                   	push   %eax
+ 797:	ff 75 08             	push   0x8(%ebp)
+ 79a:	e8 99 fe ff ff       	call   638 <printint>
+ 79f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7a2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7a6:	e9 ae 00 00 00       	jmp    859 <printf+0x170>
+      } else if(c == 's'){
+ 7ab:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7af:	75 43                	jne    7f4 <printf+0x10b>
+        s = (char*)*ap;
+ 7b1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7b4:	8b 00                	mov    (%eax),%eax
+ 7b6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 7b9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 7bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7c1:	75 25                	jne    7e8 <printf+0xff>
+          s = "(null)";
+ 7c3:	c7 45 f4 a0 0d 00 00 	movl   $0xda0,-0xc(%ebp)
+        while(*s != 0){
+ 7ca:	eb 1c                	jmp    7e8 <printf+0xff>
+          putc(fd, *s);
+ 7cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7cf:	0f b6 00             	movzbl (%eax),%eax
+ 7d2:	0f be c0             	movsbl %al,%eax
+ 7d5:	83 ec 08             	sub    $0x8,%esp
+ 7d8:	50                   	push   %eax
+ 7d9:	ff 75 08             	push   0x8(%ebp)
+ 7dc:	e8 34 fe ff ff       	call   615 <putc>
+ 7e1:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 7e4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 7e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7eb:	0f b6 00             	movzbl (%eax),%eax
+ 7ee:	84 c0                	test   %al,%al
+ 7f0:	75 da                	jne    7cc <printf+0xe3>
+ 7f2:	eb 65                	jmp    859 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 7f4:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 7f8:	75 1d                	jne    817 <printf+0x12e>
+        putc(fd, *ap);
+ 7fa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7fd:	8b 00                	mov    (%eax),%eax
+ 7ff:	0f be c0             	movsbl %al,%eax
+ 802:	83 ec 08             	sub    $0x8,%esp
+ 805:	50                   	push   %eax
+ 806:	ff 75 08             	push   0x8(%ebp)
+ 809:	e8 07 fe ff ff       	call   615 <putc>
+ 80e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 811:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 815:	eb 42                	jmp    859 <printf+0x170>
+      } else if(c == '%'){
+ 817:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 81b:	75 17                	jne    834 <printf+0x14b>
+        putc(fd, c);
+ 81d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 820:	0f be c0             	movsbl %al,%eax
+ 823:	83 ec 08             	sub    $0x8,%esp
+ 826:	50                   	push   %eax
+ 827:	ff 75 08             	push   0x8(%ebp)
+ 82a:	e8 e6 fd ff ff       	call   615 <putc>
+ 82f:	83 c4 10             	add    $0x10,%esp
+ 832:	eb 25                	jmp    859 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 834:	83 ec 08             	sub    $0x8,%esp
+ 837:	6a 25                	push   $0x25
+ 839:	ff 75 08             	push   0x8(%ebp)
+ 83c:	e8 d4 fd ff ff       	call   615 <putc>
+ 841:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 844:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 847:	0f be c0             	movsbl %al,%eax
+ 84a:	83 ec 08             	sub    $0x8,%esp
+ 84d:	50                   	push   %eax
+ 84e:	ff 75 08             	push   0x8(%ebp)
+ 851:	e8 bf fd ff ff       	call   615 <putc>
+ 856:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 859:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 860:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 864:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 867:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 86a:	01 d0                	add    %edx,%eax
+ 86c:	0f b6 00             	movzbl (%eax),%eax
+ 86f:	84 c0                	test   %al,%al
+ 871:	0f 85 94 fe ff ff    	jne    70b <printf+0x22>
+    }
+  }
+}
+ 877:	90                   	nop
+ 878:	90                   	nop
+ 879:	c9                   	leave
+ 87a:	c3                   	ret
+
+0000087b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 87b:	55                   	push   %ebp
+ 87c:	89 e5                	mov    %esp,%ebp
+ 87e:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 881:	8b 45 08             	mov    0x8(%ebp),%eax
+ 884:	83 e8 08             	sub    $0x8,%eax
+ 887:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 88a:	a1 b4 11 00 00       	mov    0x11b4,%eax
+ 88f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 892:	eb 24                	jmp    8b8 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 894:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 897:	8b 00                	mov    (%eax),%eax
+ 899:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 89c:	72 12                	jb     8b0 <free+0x35>
+ 89e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8a1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8a4:	72 24                	jb     8ca <free+0x4f>
+ 8a6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a9:	8b 00                	mov    (%eax),%eax
+ 8ab:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8ae:	72 1a                	jb     8ca <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b3:	8b 00                	mov    (%eax),%eax
+ 8b5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8b8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8bb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8be:	73 d4                	jae    894 <free+0x19>
+ 8c0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c3:	8b 00                	mov    (%eax),%eax
+ 8c5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8c8:	73 ca                	jae    894 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8ca:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8cd:	8b 40 04             	mov    0x4(%eax),%eax
+ 8d0:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8d7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8da:	01 c2                	add    %eax,%edx
+ 8dc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8df:	8b 00                	mov    (%eax),%eax
+ 8e1:	39 c2                	cmp    %eax,%edx
+ 8e3:	75 24                	jne    909 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 8e5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e8:	8b 50 04             	mov    0x4(%eax),%edx
+ 8eb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ee:	8b 00                	mov    (%eax),%eax
+ 8f0:	8b 40 04             	mov    0x4(%eax),%eax
+ 8f3:	01 c2                	add    %eax,%edx
+ 8f5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8f8:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8fe:	8b 00                	mov    (%eax),%eax
+ 900:	8b 10                	mov    (%eax),%edx
+ 902:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 905:	89 10                	mov    %edx,(%eax)
+ 907:	eb 0a                	jmp    913 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 909:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 90c:	8b 10                	mov    (%eax),%edx
+ 90e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 911:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 913:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 916:	8b 40 04             	mov    0x4(%eax),%eax
+ 919:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 920:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 923:	01 d0                	add    %edx,%eax
+ 925:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 928:	75 20                	jne    94a <free+0xcf>
+    p->s.size += bp->s.size;
+ 92a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 92d:	8b 50 04             	mov    0x4(%eax),%edx
+ 930:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 933:	8b 40 04             	mov    0x4(%eax),%eax
+ 936:	01 c2                	add    %eax,%edx
+ 938:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 93b:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 93e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 941:	8b 10                	mov    (%eax),%edx
+ 943:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 946:	89 10                	mov    %edx,(%eax)
+ 948:	eb 08                	jmp    952 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 94a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 94d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 950:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 952:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 955:	a3 b4 11 00 00       	mov    %eax,0x11b4
+}
+ 95a:	90                   	nop
+ 95b:	c9                   	leave
+ 95c:	c3                   	ret
+
+0000095d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 95d:	55                   	push   %ebp
+ 95e:	89 e5                	mov    %esp,%ebp
+ 960:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 963:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 96a:	77 07                	ja     973 <morecore+0x16>
+    nu = 4096;
+ 96c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 973:	8b 45 08             	mov    0x8(%ebp),%eax
+ 976:	c1 e0 03             	shl    $0x3,%eax
+ 979:	83 ec 0c             	sub    $0xc,%esp
+ 97c:	50                   	push   %eax
+ 97d:	e8 83 fb ff ff       	call   505 <sbrk>
+ 982:	83 c4 10             	add    $0x10,%esp
+ 985:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 988:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 98c:	75 07                	jne    995 <morecore+0x38>
+    return 0;
+ 98e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 993:	eb 26                	jmp    9bb <morecore+0x5e>
+  hp = (Header*)p;
+ 995:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 998:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 99b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 99e:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9a1:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9a4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9a7:	83 c0 08             	add    $0x8,%eax
+ 9aa:	83 ec 0c             	sub    $0xc,%esp
+ 9ad:	50                   	push   %eax
+ 9ae:	e8 c8 fe ff ff       	call   87b <free>
+ 9b3:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 9b6:	a1 b4 11 00 00       	mov    0x11b4,%eax
+}
+ 9bb:	c9                   	leave
+ 9bc:	c3                   	ret
+
+000009bd <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9bd:	55                   	push   %ebp
+ 9be:	89 e5                	mov    %esp,%ebp
+ 9c0:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9c6:	83 c0 07             	add    $0x7,%eax
+ 9c9:	c1 e8 03             	shr    $0x3,%eax
+ 9cc:	83 c0 01             	add    $0x1,%eax
+ 9cf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 9d2:	a1 b4 11 00 00       	mov    0x11b4,%eax
+ 9d7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9da:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9de:	75 23                	jne    a03 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 9e0:	c7 45 f0 ac 11 00 00 	movl   $0x11ac,-0x10(%ebp)
+ 9e7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9ea:	a3 b4 11 00 00       	mov    %eax,0x11b4
+ 9ef:	a1 b4 11 00 00       	mov    0x11b4,%eax
+ 9f4:	a3 ac 11 00 00       	mov    %eax,0x11ac
+    base.s.size = 0;
+ 9f9:	c7 05 b0 11 00 00 00 	movl   $0x0,0x11b0
+ a00:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a03:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a06:	8b 00                	mov    (%eax),%eax
+ a08:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a0e:	8b 40 04             	mov    0x4(%eax),%eax
+ a11:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a14:	72 4d                	jb     a63 <malloc+0xa6>
+      if(p->s.size == nunits)
+ a16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a19:	8b 40 04             	mov    0x4(%eax),%eax
+ a1c:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a1f:	75 0c                	jne    a2d <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a24:	8b 10                	mov    (%eax),%edx
+ a26:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a29:	89 10                	mov    %edx,(%eax)
+ a2b:	eb 26                	jmp    a53 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a30:	8b 40 04             	mov    0x4(%eax),%eax
+ a33:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a36:	89 c2                	mov    %eax,%edx
+ a38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a3b:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a41:	8b 40 04             	mov    0x4(%eax),%eax
+ a44:	c1 e0 03             	shl    $0x3,%eax
+ a47:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a4d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a50:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a53:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a56:	a3 b4 11 00 00       	mov    %eax,0x11b4
+      return (void*)(p + 1);
+ a5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a5e:	83 c0 08             	add    $0x8,%eax
+ a61:	eb 3b                	jmp    a9e <malloc+0xe1>
+    }
+    if(p == freep)
+ a63:	a1 b4 11 00 00       	mov    0x11b4,%eax
+ a68:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a6b:	75 1e                	jne    a8b <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a6d:	83 ec 0c             	sub    $0xc,%esp
+ a70:	ff 75 ec             	push   -0x14(%ebp)
+ a73:	e8 e5 fe ff ff       	call   95d <morecore>
+ a78:	83 c4 10             	add    $0x10,%esp
+ a7b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a7e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a82:	75 07                	jne    a8b <malloc+0xce>
+        return 0;
+ a84:	b8 00 00 00 00       	mov    $0x0,%eax
+ a89:	eb 13                	jmp    a9e <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a8e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a94:	8b 00                	mov    (%eax),%eax
+ a96:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a99:	e9 6d ff ff ff       	jmp    a0b <malloc+0x4e>
+  }
+}
+ a9e:	c9                   	leave
+ a9f:	c3                   	ret
+
+00000aa0 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ aa3:	8b 45 08             	mov    0x8(%ebp),%eax
+ aa6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ aac:	90                   	nop
+ aad:	5d                   	pop    %ebp
+ aae:	c3                   	ret
+
+00000aaf <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ aaf:	55                   	push   %ebp
+ ab0:	89 e5                	mov    %esp,%ebp
+ ab2:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ ab5:	8b 55 08             	mov    0x8(%ebp),%edx
+ ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+ abd:	b9 01 00 00 00       	mov    $0x1,%ecx
+ ac2:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ ac6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ac9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ acd:	74 3b                	je     b0a <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ acf:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ ad3:	74 2d                	je     b02 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ ad5:	8b 55 08             	mov    0x8(%ebp),%edx
+ ad8:	b8 02 00 00 00       	mov    $0x2,%eax
+ add:	87 02                	xchg   %eax,(%edx)
+ adf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ ae2:	eb 1e                	jmp    b02 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ ae4:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae7:	83 ec 08             	sub    $0x8,%esp
+ aea:	6a 02                	push   $0x2
+ aec:	50                   	push   %eax
+ aed:	e8 f3 fa ff ff       	call   5e5 <futex_wait>
+ af2:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ af5:	8b 55 08             	mov    0x8(%ebp),%edx
+ af8:	b8 02 00 00 00       	mov    $0x2,%eax
+ afd:	87 02                	xchg   %eax,(%edx)
+ aff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b02:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b06:	75 dc                	jne    ae4 <mutex_lock+0x35>
+ b08:	eb 01                	jmp    b0b <mutex_lock+0x5c>
+    return;
+ b0a:	90                   	nop
+  }
+}
+ b0b:	c9                   	leave
+ b0c:	c3                   	ret
+
+00000b0d <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ b0d:	55                   	push   %ebp
+ b0e:	89 e5                	mov    %esp,%ebp
+ b10:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ b13:	8b 45 08             	mov    0x8(%ebp),%eax
+ b16:	ba 01 00 00 00       	mov    $0x1,%edx
+ b1b:	f7 da                	neg    %edx
+ b1d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ b21:	83 fa 01             	cmp    $0x1,%edx
+ b24:	74 1a                	je     b40 <mutex_unlock+0x33>
+    m->state = 0;
+ b26:	8b 45 08             	mov    0x8(%ebp),%eax
+ b29:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b32:	83 ec 08             	sub    $0x8,%esp
+ b35:	6a 01                	push   $0x1
+ b37:	50                   	push   %eax
+ b38:	e8 b0 fa ff ff       	call   5ed <futex_wake>
+ b3d:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ b40:	90                   	nop
+ b41:	c9                   	leave
+ b42:	c3                   	ret
+
+00000b43 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ b43:	55                   	push   %ebp
+ b44:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ b46:	8b 45 08             	mov    0x8(%ebp),%eax
+ b49:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ b4f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b52:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ b59:	90                   	nop
+ b5a:	5d                   	pop    %ebp
+ b5b:	c3                   	ret
+
+00000b5c <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ b5c:	55                   	push   %ebp
+ b5d:	89 e5                	mov    %esp,%ebp
+ b5f:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ b62:	8b 45 08             	mov    0x8(%ebp),%eax
+ b65:	83 c0 04             	add    $0x4,%eax
+ b68:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ b6c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6f:	83 ec 08             	sub    $0x8,%esp
+ b72:	ff 75 0c             	push   0xc(%ebp)
+ b75:	50                   	push   %eax
+ b76:	e8 6a fa ff ff       	call   5e5 <futex_wait>
+ b7b:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ b7e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b81:	83 c0 04             	add    $0x4,%eax
+ b84:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ b88:	90                   	nop
+ b89:	c9                   	leave
+ b8a:	c3                   	ret
+
+00000b8b <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ b8b:	55                   	push   %ebp
+ b8c:	89 e5                	mov    %esp,%ebp
+ b8e:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ b91:	8b 45 08             	mov    0x8(%ebp),%eax
+ b94:	8b 00                	mov    (%eax),%eax
+ b96:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ b99:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b9d:	78 17                	js     bb6 <rwlock_rdlock+0x2b>
+ b9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba2:	83 c0 01             	add    $0x1,%eax
+ ba5:	89 c1                	mov    %eax,%ecx
+ ba7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ baa:	8b 55 08             	mov    0x8(%ebp),%edx
+ bad:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ bb1:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ bb4:	74 19                	je     bcf <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ bb6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bba:	79 d5                	jns    b91 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ bbc:	83 ec 08             	sub    $0x8,%esp
+ bbf:	ff 75 f4             	push   -0xc(%ebp)
+ bc2:	ff 75 08             	push   0x8(%ebp)
+ bc5:	e8 92 ff ff ff       	call   b5c <rwlock_sleep>
+ bca:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ bcd:	eb c2                	jmp    b91 <rwlock_rdlock+0x6>
+      return;
+ bcf:	90                   	nop
+  }
+}
+ bd0:	c9                   	leave
+ bd1:	c3                   	ret
+
+00000bd2 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ bd2:	55                   	push   %ebp
+ bd3:	89 e5                	mov    %esp,%ebp
+ bd5:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ bd8:	eb 11                	jmp    beb <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ bda:	83 ec 08             	sub    $0x8,%esp
+ bdd:	ff 75 f4             	push   -0xc(%ebp)
+ be0:	ff 75 08             	push   0x8(%ebp)
+ be3:	e8 74 ff ff ff       	call   b5c <rwlock_sleep>
+ be8:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ beb:	8b 55 08             	mov    0x8(%ebp),%edx
+ bee:	b8 00 00 00 00       	mov    $0x0,%eax
+ bf3:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ bf8:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ bfc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ bff:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c03:	75 d5                	jne    bda <rwlock_wrlock+0x8>
+}
+ c05:	90                   	nop
+ c06:	90                   	nop
+ c07:	c9                   	leave
+ c08:	c3                   	ret
+
+00000c09 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ c09:	55                   	push   %ebp
+ c0a:	89 e5                	mov    %esp,%ebp
+ c0c:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ c0f:	8b 45 08             	mov    0x8(%ebp),%eax
+ c12:	8b 00                	mov    (%eax),%eax
+ c14:	85 c0                	test   %eax,%eax
+ c16:	79 0c                	jns    c24 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ c18:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1b:	ba 00 00 00 00       	mov    $0x0,%edx
+ c20:	87 10                	xchg   %edx,(%eax)
+ c22:	eb 18                	jmp    c3c <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ c24:	8b 55 08             	mov    0x8(%ebp),%edx
+ c27:	b8 01 00 00 00       	mov    $0x1,%eax
+ c2c:	f7 d8                	neg    %eax
+ c2e:	89 c1                	mov    %eax,%ecx
+ c30:	89 c8                	mov    %ecx,%eax
+ c32:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ c36:	01 c8                	add    %ecx,%eax
+ c38:	85 c0                	test   %eax,%eax
+ c3a:	75 20                	jne    c5c <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ c3c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c3f:	8b 40 04             	mov    0x4(%eax),%eax
+ c42:	85 c0                	test   %eax,%eax
+ c44:	74 17                	je     c5d <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ c46:	8b 45 08             	mov    0x8(%ebp),%eax
+ c49:	83 ec 08             	sub    $0x8,%esp
+ c4c:	68 ff ff ff 7f       	push   $0x7fffffff
+ c51:	50                   	push   %eax
+ c52:	e8 96 f9 ff ff       	call   5ed <futex_wake>
+ c57:	83 c4 10             	add    $0x10,%esp
+ c5a:	eb 01                	jmp    c5d <rwlock_unlock+0x54>
+    return;
+ c5c:	90                   	nop
+}
+ c5d:	c9                   	leave
+ c5e:	c3                   	ret
+
+00000c5f <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ c5f:	55                   	push   %ebp
+ c60:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ c62:	8b 45 08             	mov    0x8(%ebp),%eax
+ c65:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c6b:	90                   	nop
+ c6c:	5d                   	pop    %ebp
+ c6d:	c3                   	ret
+
+00000c6e <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ c6e:	55                   	push   %ebp
+ c6f:	89 e5                	mov    %esp,%ebp
+ c71:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ c74:	8b 45 08             	mov    0x8(%ebp),%eax
+ c77:	8b 00                	mov    (%eax),%eax
+ c79:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ c7c:	83 ec 0c             	sub    $0xc,%esp
+ c7f:	ff 75 0c             	push   0xc(%ebp)
+ c82:	e8 86 fe ff ff       	call   b0d <mutex_unlock>
+ c87:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ c8a:	8b 45 08             	mov    0x8(%ebp),%eax
+ c8d:	83 ec 08             	sub    $0x8,%esp
+ c90:	ff 75 f4             	push   -0xc(%ebp)
+ c93:	50                   	push   %eax
+ c94:	e8 4c f9 ff ff       	call   5e5 <futex_wait>
+ c99:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ c9c:	83 ec 0c             	sub    $0xc,%esp
+ c9f:	ff 75 0c             	push   0xc(%ebp)
+ ca2:	e8 08 fe ff ff       	call   aaf <mutex_lock>
+ ca7:	83 c4 10             	add    $0x10,%esp
+}
+ caa:	90                   	nop
+ cab:	c9                   	leave
+ cac:	c3                   	ret
+
+00000cad <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ cad:	55                   	push   %ebp
+ cae:	89 e5                	mov    %esp,%ebp
+ cb0:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb6:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ cba:	8b 45 08             	mov    0x8(%ebp),%eax
+ cbd:	83 ec 08             	sub    $0x8,%esp
+ cc0:	6a 01                	push   $0x1
+ cc2:	50                   	push   %eax
+ cc3:	e8 25 f9 ff ff       	call   5ed <futex_wake>
+ cc8:	83 c4 10             	add    $0x10,%esp
+}
+ ccb:	90                   	nop
+ ccc:	c9                   	leave
+ ccd:	c3                   	ret
+
+00000cce <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ cce:	55                   	push   %ebp
+ ccf:	89 e5                	mov    %esp,%ebp
+ cd1:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ cd4:	8b 45 08             	mov    0x8(%ebp),%eax
+ cd7:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+ cde:	83 ec 08             	sub    $0x8,%esp
+ ce1:	68 ff ff ff 7f       	push   $0x7fffffff
+ ce6:	50                   	push   %eax
+ ce7:	e8 01 f9 ff ff       	call   5ed <futex_wake>
+ cec:	83 c4 10             	add    $0x10,%esp
+}
+ cef:	90                   	nop
+ cf0:	c9                   	leave
+ cf1:	c3                   	ret
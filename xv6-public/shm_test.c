@@ -1,13 +1,16 @@
 #include "types.h"
 #include "user.h"
+#include "plstat.h"
 
 #define NUM_CHILDREN 4
 #define SHM_ID 1
+#define SHM_SIZE 4096
+#define DEFAULT_LOCK 0
 
 int main(int argc, char const *argv[])
 {
 
-    char *shared_mem = (char *)open_sharedmem(SHM_ID);
+    char *shared_mem = (char *)open_sharedmem(SHM_ID, SHM_SIZE);
     char *value = (char *)shared_mem;
     *value = 0;
 
@@ -21,12 +24,11 @@ int main(int argc, char const *argv[])
         }
         else if (pid == 0)
         {
-            char *shared_mem = (char *)open_sharedmem(1);
-            acquire_prioritylock();
-            char *value = (char *)shared_mem;
+            // The region is inherited from the parent at the same address.
+            acquire_prioritylock(DEFAULT_LOCK);
             *value += 1;
             printf(1, "Child proc with pid %d shared memory value is : %d\n", getpid(), *value);
-            release_prioritylock();
+            release_prioritylock(DEFAULT_LOCK);
             close_sharedmem(SHM_ID);
             exit();
         }
@@ -38,6 +40,10 @@ int main(int argc, char const *argv[])
     }
 
     printf(1, "Final shared memory value is : %d\n", *value);
+
+    struct plstat st;
+    if (prioritylock_stats(DEFAULT_LOCK, &st) == 0)
+        printf(1, "Lock acquired free: %d, spinning: %d, sleeping: %d\n", st.free, st.spun, st.slept);
     close_sharedmem(SHM_ID);
     exit();
 }
\ No newline at end of file
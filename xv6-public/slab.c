@@ -0,0 +1,131 @@
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "slab.h"
+
+// Slab allocator for small kernel objects. A slab is one page
+// from kalloc(): this header, then perslab objects. Free objects
+// of a slab are linked through their first word; a slab with
+// none left is off the partial list until one comes back, and a
+// slab whose objects all came back goes back to kalloc().
+//
+// The magazines in front move objects in and out of the slabs
+// MAGSIZE/2 at a time, under the cache lock, when they run empty
+// or full. Otherwise a CPU only touches its own magazine, with
+// interrupts off.
+
+struct slab
+{
+  struct slab *next;   // On the cache's partial list
+  void *free;          // First free object
+  uint inuse;          // Objects handed out, magazines included
+};
+
+#define SLABHDR ((sizeof(struct slab) + 7) & ~7)
+
+void kmem_cache_init(struct kmem_cache *c, char *name, uint size)
+{
+  initlock(&c->lock, name);
+  c->name = name;
+  c->size = size < sizeof(void *) ? sizeof(void *) : (size + 3) & ~3;
+  c->perslab = (PGSIZE - SLABHDR) / c->size;
+  if (c->perslab == 0)
+    panic("kmem_cache_init: object too big");
+  c->partial = 0;
+  c->nslabs = 0;
+  memset(c->mag, 0, sizeof(c->mag));
+}
+
+// Take an object off the first partial slab, adding a fresh
+// slab if there is none. Caller holds c->lock.
+static void *slab_get(struct kmem_cache *c)
+{
+  struct slab *s;
+  char *obj;
+  uint i;
+
+  if ((s = c->partial) == 0)
+  {
+    if ((s = (struct slab *)kalloc()) == 0)
+      return 0;
+    obj = (char *)s + SLABHDR;
+    s->free = obj;
+    for (i = 0; i + 1 < c->perslab; i++, obj += c->size)
+      *(void **)obj = obj + c->size;
+    *(void **)obj = 0;
+    s->inuse = 0;
+    s->next = 0;
+    c->partial = s;
+    c->nslabs++;
+  }
+
+  obj = s->free;
+  s->free = *(void **)obj;
+  s->inuse++;
+  if (s->free == 0)
+    c->partial = s->next;
+  return obj;
+}
+
+// Put obj back in its slab. Caller holds c->lock.
+static void slab_put(struct kmem_cache *c, void *obj)
+{
+  struct slab *s, **sp;
+
+  s = (struct slab *)PGROUNDDOWN((uint)obj);
+  if (s->free == 0)
+  {
+    s->next = c->partial;
+    c->partial = s;
+  }
+  *(void **)obj = s->free;
+  s->free = obj;
+  if (--s->inuse > 0)
+    return;
+
+  for (sp = &c->partial; *sp != s; sp = &(*sp)->next)
+    ;
+  *sp = s->next;
+  c->nslabs--;
+  kfree((char *)s);
+}
+
+// Allocate an object of c, not cleared.
+// Returns 0 if the memory cannot be allocated.
+void *kmem_cache_alloc(struct kmem_cache *c)
+{
+  struct magazine *m;
+  void *obj;
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if (m->n == 0)
+  {
+    acquire(&c->lock);
+    while (m->n < MAGSIZE / 2 && (obj = slab_get(c)) != 0)
+      m->obj[m->n++] = obj;
+    release(&c->lock);
+  }
+  obj = m->n > 0 ? m->obj[--m->n] : 0;
+  popcli();
+  return obj;
+}
+
+void kmem_cache_free(struct kmem_cache *c, void *obj)
+{
+  struct magazine *m;
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if (m->n == MAGSIZE)
+  {
+    acquire(&c->lock);
+    while (m->n > MAGSIZE / 2)
+      slab_put(c, m->obj[--m->n]);
+    release(&c->lock);
+  }
+  m->obj[m->n++] = obj;
+  popcli();
+}
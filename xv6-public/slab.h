@@ -0,0 +1,23 @@
+// Caches of same-sized kernel objects, carved out of kalloc()
+// pages. Each CPU keeps a magazine of free objects in front of
+// the cache, so most allocs and frees take no lock at all.
+// Include spinlock.h first.
+
+#define MAGSIZE 16 // Free objects a CPU holds on to
+
+struct magazine
+{
+  int n;               // Objects in obj[]
+  void *obj[MAGSIZE];
+} __attribute__((aligned(CACHELINE)));
+
+struct kmem_cache
+{
+  struct spinlock lock;  // Protects the slabs
+  char *name;
+  uint size;             // Object size, rounded up to a word
+  uint perslab;          // Objects that fit in one slab page
+  struct slab *partial;  // Slabs with objects left to hand out
+  uint nslabs;           // Pages the cache holds
+  struct magazine mag[NCPU];
+};
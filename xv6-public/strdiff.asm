@@ -0,0 +1,2005 @@
+
+_strdiff:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cleanFile>:
+#include "user.h"
+#include "fcntl.h"
+
+
+
+void cleanFile(){
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+    int fptr=open("strdiff_result.txt",O_CREATE|O_RDWR);  
+   6:	83 ec 08             	sub    $0x8,%esp
+   9:	68 02 02 00 00       	push   $0x202
+   e:	68 49 0e 00 00       	push   $0xe49
+  13:	e8 fc 05 00 00       	call   614 <open>
+  18:	83 c4 10             	add    $0x10,%esp
+  1b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    int i=0;  
+  1e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    while(i<80){
+  25:	eb 19                	jmp    40 <cleanFile+0x40>
+        write(fptr," ",1);
+  27:	83 ec 04             	sub    $0x4,%esp
+  2a:	6a 01                	push   $0x1
+  2c:	68 5c 0e 00 00       	push   $0xe5c
+  31:	ff 75 f0             	push   -0x10(%ebp)
+  34:	e8 bb 05 00 00       	call   5f4 <write>
+  39:	83 c4 10             	add    $0x10,%esp
+        i++;
+  3c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    while(i<80){
+  40:	83 7d f4 4f          	cmpl   $0x4f,-0xc(%ebp)
+  44:	7e e1                	jle    27 <cleanFile+0x27>
+    }
+    close(fptr);
+  46:	83 ec 0c             	sub    $0xc,%esp
+  49:	ff 75 f0             	push   -0x10(%ebp)
+  4c:	e8 ab 05 00 00       	call   5fc <close>
+  51:	83 c4 10             	add    $0x10,%esp
+}
+  54:	90                   	nop
+  55:	c9                   	leave
+  56:	c3                   	ret
+
+00000057 <writeInFile>:
+void writeInFile(char* difference){
+  57:	55                   	push   %ebp
+  58:	89 e5                	mov    %esp,%ebp
+  5a:	83 ec 18             	sub    $0x18,%esp
+    int fptr=open("strdiff_result.txt",O_CREATE|O_RDWR);
+  5d:	83 ec 08             	sub    $0x8,%esp
+  60:	68 02 02 00 00       	push   $0x202
+  65:	68 49 0e 00 00       	push   $0xe49
+  6a:	e8 a5 05 00 00       	call   614 <open>
+  6f:	83 c4 10             	add    $0x10,%esp
+  72:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    write(fptr,difference,strlen(difference));
+  75:	83 ec 0c             	sub    $0xc,%esp
+  78:	ff 75 08             	push   0x8(%ebp)
+  7b:	e8 b8 02 00 00       	call   338 <strlen>
+  80:	83 c4 10             	add    $0x10,%esp
+  83:	83 ec 04             	sub    $0x4,%esp
+  86:	50                   	push   %eax
+  87:	ff 75 08             	push   0x8(%ebp)
+  8a:	ff 75 f4             	push   -0xc(%ebp)
+  8d:	e8 62 05 00 00       	call   5f4 <write>
+  92:	83 c4 10             	add    $0x10,%esp
+    close(fptr);
+  95:	83 ec 0c             	sub    $0xc,%esp
+  98:	ff 75 f4             	push   -0xc(%ebp)
+  9b:	e8 5c 05 00 00       	call   5fc <close>
+  a0:	83 c4 10             	add    $0x10,%esp
+}
+  a3:	90                   	nop
+  a4:	c9                   	leave
+  a5:	c3                   	ret
+
+000000a6 <computeDifference>:
+char* computeDifference(int maxSize,char* str1,char* str2){
+  a6:	55                   	push   %ebp
+  a7:	89 e5                	mov    %esp,%ebp
+  a9:	83 ec 18             	sub    $0x18,%esp
+    char *difference = (char *)malloc((maxSize+2) * sizeof(char));
+  ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  af:	83 c0 02             	add    $0x2,%eax
+  b2:	83 ec 0c             	sub    $0xc,%esp
+  b5:	50                   	push   %eax
+  b6:	e8 59 0a 00 00       	call   b14 <malloc>
+  bb:	83 c4 10             	add    $0x10,%esp
+  be:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    for (int i = 0; i < maxSize; i++) {
+  c1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  c8:	e9 f0 00 00 00       	jmp    1bd <computeDifference+0x117>
+        if (i >= strlen(str1)) {
+  cd:	83 ec 0c             	sub    $0xc,%esp
+  d0:	ff 75 0c             	push   0xc(%ebp)
+  d3:	e8 60 02 00 00       	call   338 <strlen>
+  d8:	83 c4 10             	add    $0x10,%esp
+  db:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  de:	39 c2                	cmp    %eax,%edx
+  e0:	72 10                	jb     f2 <computeDifference+0x4c>
+            difference[i] = '1';
+  e2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  e5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  e8:	01 d0                	add    %edx,%eax
+  ea:	c6 00 31             	movb   $0x31,(%eax)
+            continue;
+  ed:	e9 c7 00 00 00       	jmp    1b9 <computeDifference+0x113>
+        } 
+        else if (i >= strlen(str2)) {
+  f2:	83 ec 0c             	sub    $0xc,%esp
+  f5:	ff 75 10             	push   0x10(%ebp)
+  f8:	e8 3b 02 00 00       	call   338 <strlen>
+  fd:	83 c4 10             	add    $0x10,%esp
+ 100:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 103:	39 c2                	cmp    %eax,%edx
+ 105:	72 10                	jb     117 <computeDifference+0x71>
+            difference[i] = '0';
+ 107:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 10a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 10d:	01 d0                	add    %edx,%eax
+ 10f:	c6 00 30             	movb   $0x30,(%eax)
+            continue;
+ 112:	e9 a2 00 00 00       	jmp    1b9 <computeDifference+0x113>
+        }
+        if(str1[i]>=97 &&  str1[i]<=122)
+ 117:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 11a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 11d:	01 d0                	add    %edx,%eax
+ 11f:	0f b6 00             	movzbl (%eax),%eax
+ 122:	3c 60                	cmp    $0x60,%al
+ 124:	7e 29                	jle    14f <computeDifference+0xa9>
+ 126:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 129:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12c:	01 d0                	add    %edx,%eax
+ 12e:	0f b6 00             	movzbl (%eax),%eax
+ 131:	3c 7a                	cmp    $0x7a,%al
+ 133:	7f 1a                	jg     14f <computeDifference+0xa9>
+            str1[i]-=32;
+ 135:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 138:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13b:	01 d0                	add    %edx,%eax
+ 13d:	0f b6 00             	movzbl (%eax),%eax
+ 140:	8d 48 e0             	lea    -0x20(%eax),%ecx
+ 143:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 146:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 149:	01 d0                	add    %edx,%eax
+ 14b:	89 ca                	mov    %ecx,%edx
+ 14d:	88 10                	mov    %dl,(%eax)
+        if(str2[i]>=97 &&  str2[i]<=122)
+ 14f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 152:	8b 45 10             	mov    0x10(%ebp),%eax
+ 155:	01 d0                	add    %edx,%eax
+ 157:	0f b6 00             	movzbl (%eax),%eax
+ 15a:	3c 60                	cmp    $0x60,%al
+ 15c:	7e 29                	jle    187 <computeDifference+0xe1>
+ 15e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 161:	8b 45 10             	mov    0x10(%ebp),%eax
+ 164:	01 d0                	add    %edx,%eax
+ 166:	0f b6 00             	movzbl (%eax),%eax
+ 169:	3c 7a                	cmp    $0x7a,%al
+ 16b:	7f 1a                	jg     187 <computeDifference+0xe1>
+            str2[i]-=32;
+ 16d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 170:	8b 45 10             	mov    0x10(%ebp),%eax
+ 173:	01 d0                	add    %edx,%eax
+ 175:	0f b6 00             	movzbl (%eax),%eax
+ 178:	8d 48 e0             	lea    -0x20(%eax),%ecx
+ 17b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 17e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 181:	01 d0                	add    %edx,%eax
+ 183:	89 ca                	mov    %ecx,%edx
+ 185:	88 10                	mov    %dl,(%eax)
+        if (str1[i] >= str2[i]) {
+ 187:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 18a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18d:	01 d0                	add    %edx,%eax
+ 18f:	0f b6 10             	movzbl (%eax),%edx
+ 192:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+ 195:	8b 45 10             	mov    0x10(%ebp),%eax
+ 198:	01 c8                	add    %ecx,%eax
+ 19a:	0f b6 00             	movzbl (%eax),%eax
+ 19d:	38 c2                	cmp    %al,%dl
+ 19f:	7c 0d                	jl     1ae <computeDifference+0x108>
+            difference[i] = '0';
+ 1a1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1a4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1a7:	01 d0                	add    %edx,%eax
+ 1a9:	c6 00 30             	movb   $0x30,(%eax)
+ 1ac:	eb 0b                	jmp    1b9 <computeDifference+0x113>
+        } else {
+            difference[i] = '1';
+ 1ae:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1b1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1b4:	01 d0                	add    %edx,%eax
+ 1b6:	c6 00 31             	movb   $0x31,(%eax)
+    for (int i = 0; i < maxSize; i++) {
+ 1b9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c0:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 1c3:	0f 8c 04 ff ff ff    	jl     cd <computeDifference+0x27>
+        }
+    }
+    difference[maxSize]='\0';
+ 1c9:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1cf:	01 d0                	add    %edx,%eax
+ 1d1:	c6 00 00             	movb   $0x0,(%eax)
+    difference[maxSize+1]='\n';
+ 1d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d7:	8d 50 01             	lea    0x1(%eax),%edx
+ 1da:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1dd:	01 d0                	add    %edx,%eax
+ 1df:	c6 00 0a             	movb   $0xa,(%eax)
+    return difference;
+ 1e2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1e5:	c9                   	leave
+ 1e6:	c3                   	ret
+
+000001e7 <strdiff>:
+void strdiff(char *str1,char *str2) {
+ 1e7:	55                   	push   %ebp
+ 1e8:	89 e5                	mov    %esp,%ebp
+ 1ea:	53                   	push   %ebx
+ 1eb:	83 ec 14             	sub    $0x14,%esp
+    int maxSize = (strlen(str1) >= strlen(str2)) ? strlen(str1) : strlen(str2);
+ 1ee:	83 ec 0c             	sub    $0xc,%esp
+ 1f1:	ff 75 08             	push   0x8(%ebp)
+ 1f4:	e8 3f 01 00 00       	call   338 <strlen>
+ 1f9:	83 c4 10             	add    $0x10,%esp
+ 1fc:	89 c3                	mov    %eax,%ebx
+ 1fe:	83 ec 0c             	sub    $0xc,%esp
+ 201:	ff 75 0c             	push   0xc(%ebp)
+ 204:	e8 2f 01 00 00       	call   338 <strlen>
+ 209:	83 c4 10             	add    $0x10,%esp
+ 20c:	39 c3                	cmp    %eax,%ebx
+ 20e:	72 10                	jb     220 <strdiff+0x39>
+ 210:	83 ec 0c             	sub    $0xc,%esp
+ 213:	ff 75 08             	push   0x8(%ebp)
+ 216:	e8 1d 01 00 00       	call   338 <strlen>
+ 21b:	83 c4 10             	add    $0x10,%esp
+ 21e:	eb 0e                	jmp    22e <strdiff+0x47>
+ 220:	83 ec 0c             	sub    $0xc,%esp
+ 223:	ff 75 0c             	push   0xc(%ebp)
+ 226:	e8 0d 01 00 00       	call   338 <strlen>
+ 22b:	83 c4 10             	add    $0x10,%esp
+ 22e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    char *difference = computeDifference(maxSize,str1,str2);
+ 231:	83 ec 04             	sub    $0x4,%esp
+ 234:	ff 75 0c             	push   0xc(%ebp)
+ 237:	ff 75 08             	push   0x8(%ebp)
+ 23a:	ff 75 f4             	push   -0xc(%ebp)
+ 23d:	e8 64 fe ff ff       	call   a6 <computeDifference>
+ 242:	83 c4 10             	add    $0x10,%esp
+ 245:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    cleanFile();
+ 248:	e8 b3 fd ff ff       	call   0 <cleanFile>
+    if(maxSize<=15 && maxSize>0){
+ 24d:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+ 251:	7f 15                	jg     268 <strdiff+0x81>
+ 253:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 257:	7e 0f                	jle    268 <strdiff+0x81>
+        writeInFile(difference);
+ 259:	83 ec 0c             	sub    $0xc,%esp
+ 25c:	ff 75 f0             	push   -0x10(%ebp)
+ 25f:	e8 f3 fd ff ff       	call   57 <writeInFile>
+ 264:	83 c4 10             	add    $0x10,%esp
+    }
+    return ;
+ 267:	90                   	nop
+ 268:	90                   	nop
+}
+ 269:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 26c:	c9                   	leave
+ 26d:	c3                   	ret
+
+0000026e <main>:
+
+int main(int argc, char *argv[]){
+ 26e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 272:	83 e4 f0             	and    $0xfffffff0,%esp
+ 275:	ff 71 fc             	push   -0x4(%ecx)
+ 278:	55                   	push   %ebp
+ 279:	89 e5                	mov    %esp,%ebp
+ 27b:	51                   	push   %ecx
+ 27c:	83 ec 04             	sub    $0x4,%esp
+ 27f:	89 c8                	mov    %ecx,%eax
+    strdiff(argv[1],argv[2]);
+ 281:	8b 50 04             	mov    0x4(%eax),%edx
+ 284:	83 c2 08             	add    $0x8,%edx
+ 287:	8b 12                	mov    (%edx),%edx
+ 289:	8b 40 04             	mov    0x4(%eax),%eax
+ 28c:	83 c0 04             	add    $0x4,%eax
+ 28f:	8b 00                	mov    (%eax),%eax
+ 291:	83 ec 08             	sub    $0x8,%esp
+ 294:	52                   	push   %edx
+ 295:	50                   	push   %eax
+ 296:	e8 4c ff ff ff       	call   1e7 <strdiff>
+ 29b:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 29e:	e8 31 03 00 00       	call   5d4 <exit>
+
+000002a3 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 2a3:	55                   	push   %ebp
+ 2a4:	89 e5                	mov    %esp,%ebp
+ 2a6:	57                   	push   %edi
+ 2a7:	53                   	push   %ebx
+{
+ 2a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2ab:	8b 55 10             	mov    0x10(%ebp),%edx
+ 2ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b1:	89 cb                	mov    %ecx,%ebx
+ 2b3:	89 df                	mov    %ebx,%edi
+ 2b5:	89 d1                	mov    %edx,%ecx
+ 2b7:	fc                   	cld
+ 2b8:	f3 aa                	rep stos %al,%es:(%edi)
+ 2ba:	89 ca                	mov    %ecx,%edx
+ 2bc:	89 fb                	mov    %edi,%ebx
+ 2be:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 2c1:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 2c4:	90                   	nop
+ 2c5:	5b                   	pop    %ebx
+ 2c6:	5f                   	pop    %edi
+ 2c7:	5d                   	pop    %ebp
+ 2c8:	c3                   	ret
+
+000002c9 <strcpy>:
+{
+ 2c9:	55                   	push   %ebp
+ 2ca:	89 e5                	mov    %esp,%ebp
+ 2cc:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 2cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 2d5:	90                   	nop
+ 2d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2d9:	8d 42 01             	lea    0x1(%edx),%eax
+ 2dc:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 2df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2e5:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 2e8:	0f b6 12             	movzbl (%edx),%edx
+ 2eb:	88 10                	mov    %dl,(%eax)
+ 2ed:	0f b6 00             	movzbl (%eax),%eax
+ 2f0:	84 c0                	test   %al,%al
+ 2f2:	75 e2                	jne    2d6 <strcpy+0xd>
+  return os;
+ 2f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2f7:	c9                   	leave
+ 2f8:	c3                   	ret
+
+000002f9 <strcmp>:
+{
+ 2f9:	55                   	push   %ebp
+ 2fa:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 2fc:	eb 08                	jmp    306 <strcmp+0xd>
+    p++, q++;
+ 2fe:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 302:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 306:	8b 45 08             	mov    0x8(%ebp),%eax
+ 309:	0f b6 00             	movzbl (%eax),%eax
+ 30c:	84 c0                	test   %al,%al
+ 30e:	74 10                	je     320 <strcmp+0x27>
+ 310:	8b 45 08             	mov    0x8(%ebp),%eax
+ 313:	0f b6 10             	movzbl (%eax),%edx
+ 316:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 319:	0f b6 00             	movzbl (%eax),%eax
+ 31c:	38 c2                	cmp    %al,%dl
+ 31e:	74 de                	je     2fe <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 320:	8b 45 08             	mov    0x8(%ebp),%eax
+ 323:	0f b6 00             	movzbl (%eax),%eax
+ 326:	0f b6 d0             	movzbl %al,%edx
+ 329:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 32c:	0f b6 00             	movzbl (%eax),%eax
+ 32f:	0f b6 c0             	movzbl %al,%eax
+ 332:	29 c2                	sub    %eax,%edx
+ 334:	89 d0                	mov    %edx,%eax
+}
+ 336:	5d                   	pop    %ebp
+ 337:	c3                   	ret
+
+00000338 <strlen>:
+{
+ 338:	55                   	push   %ebp
+ 339:	89 e5                	mov    %esp,%ebp
+ 33b:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 33e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 345:	eb 04                	jmp    34b <strlen+0x13>
+ 347:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 34b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 34e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 351:	01 d0                	add    %edx,%eax
+ 353:	0f b6 00             	movzbl (%eax),%eax
+ 356:	84 c0                	test   %al,%al
+ 358:	75 ed                	jne    347 <strlen+0xf>
+  return n;
+ 35a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 35d:	c9                   	leave
+ 35e:	c3                   	ret
+
+0000035f <memset>:
+{
+ 35f:	55                   	push   %ebp
+ 360:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 362:	8b 45 10             	mov    0x10(%ebp),%eax
+ 365:	50                   	push   %eax
+ 366:	ff 75 0c             	push   0xc(%ebp)
+ 369:	ff 75 08             	push   0x8(%ebp)
+ 36c:	e8 32 ff ff ff       	call   2a3 <stosb>
+ 371:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 374:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 377:	c9                   	leave
+ 378:	c3                   	ret
+
+00000379 <strchr>:
+{
+ 379:	55                   	push   %ebp
+ 37a:	89 e5                	mov    %esp,%ebp
+ 37c:	83 ec 04             	sub    $0x4,%esp
+ 37f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 382:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 385:	eb 14                	jmp    39b <strchr+0x22>
+    if(*s == c)
+ 387:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38a:	0f b6 00             	movzbl (%eax),%eax
+ 38d:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 390:	75 05                	jne    397 <strchr+0x1e>
+      return (char*)s;
+ 392:	8b 45 08             	mov    0x8(%ebp),%eax
+ 395:	eb 13                	jmp    3aa <strchr+0x31>
+  for(; *s; s++)
+ 397:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 39b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39e:	0f b6 00             	movzbl (%eax),%eax
+ 3a1:	84 c0                	test   %al,%al
+ 3a3:	75 e2                	jne    387 <strchr+0xe>
+  return 0;
+ 3a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3aa:	c9                   	leave
+ 3ab:	c3                   	ret
+
+000003ac <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3ac:	55                   	push   %ebp
+ 3ad:	89 e5                	mov    %esp,%ebp
+ 3af:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3b2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3b9:	eb 42                	jmp    3fd <gets+0x51>
+    cc = read(0, &c, 1);
+ 3bb:	83 ec 04             	sub    $0x4,%esp
+ 3be:	6a 01                	push   $0x1
+ 3c0:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 3c3:	50                   	push   %eax
+ 3c4:	6a 00                	push   $0x0
+ 3c6:	e8 21 02 00 00       	call   5ec <read>
+ 3cb:	83 c4 10             	add    $0x10,%esp
+ 3ce:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 3d1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 3d5:	7e 33                	jle    40a <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 3d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3da:	8d 50 01             	lea    0x1(%eax),%edx
+ 3dd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3e0:	89 c2                	mov    %eax,%edx
+ 3e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e5:	01 c2                	add    %eax,%edx
+ 3e7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3eb:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 3ed:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3f1:	3c 0a                	cmp    $0xa,%al
+ 3f3:	74 16                	je     40b <gets+0x5f>
+ 3f5:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3f9:	3c 0d                	cmp    $0xd,%al
+ 3fb:	74 0e                	je     40b <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 3fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 400:	83 c0 01             	add    $0x1,%eax
+ 403:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 406:	7f b3                	jg     3bb <gets+0xf>
+ 408:	eb 01                	jmp    40b <gets+0x5f>
+      break;
+ 40a:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 40b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 40e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 411:	01 d0                	add    %edx,%eax
+ 413:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 416:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 419:	c9                   	leave
+ 41a:	c3                   	ret
+
+0000041b <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 41b:	55                   	push   %ebp
+ 41c:	89 e5                	mov    %esp,%ebp
+ 41e:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 421:	83 ec 08             	sub    $0x8,%esp
+ 424:	6a 00                	push   $0x0
+ 426:	ff 75 08             	push   0x8(%ebp)
+ 429:	e8 e6 01 00 00       	call   614 <open>
+ 42e:	83 c4 10             	add    $0x10,%esp
+ 431:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 434:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 438:	79 07                	jns    441 <stat+0x26>
+    return -1;
+ 43a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 43f:	eb 25                	jmp    466 <stat+0x4b>
+  r = fstat(fd, st);
+ 441:	83 ec 08             	sub    $0x8,%esp
+ 444:	ff 75 0c             	push   0xc(%ebp)
+ 447:	ff 75 f4             	push   -0xc(%ebp)
+ 44a:	e8 dd 01 00 00       	call   62c <fstat>
+ 44f:	83 c4 10             	add    $0x10,%esp
+ 452:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 455:	83 ec 0c             	sub    $0xc,%esp
+ 458:	ff 75 f4             	push   -0xc(%ebp)
+ 45b:	e8 9c 01 00 00       	call   5fc <close>
+ 460:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 463:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 466:	c9                   	leave
+ 467:	c3                   	ret
+
+00000468 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 468:	55                   	push   %ebp
+ 469:	89 e5                	mov    %esp,%ebp
+ 46b:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 46e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 475:	eb 25                	jmp    49c <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 477:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 47a:	89 d0                	mov    %edx,%eax
+ 47c:	c1 e0 02             	shl    $0x2,%eax
+ 47f:	01 d0                	add    %edx,%eax
+ 481:	01 c0                	add    %eax,%eax
+ 483:	89 c1                	mov    %eax,%ecx
+ 485:	8b 45 08             	mov    0x8(%ebp),%eax
+ 488:	8d 50 01             	lea    0x1(%eax),%edx
+ 48b:	89 55 08             	mov    %edx,0x8(%ebp)
+ 48e:	0f b6 00             	movzbl (%eax),%eax
+ 491:	0f be c0             	movsbl %al,%eax
+ 494:	01 c8                	add    %ecx,%eax
+ 496:	83 e8 30             	sub    $0x30,%eax
+ 499:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 49c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 49f:	0f b6 00             	movzbl (%eax),%eax
+ 4a2:	3c 2f                	cmp    $0x2f,%al
+ 4a4:	7e 0a                	jle    4b0 <atoi+0x48>
+ 4a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a9:	0f b6 00             	movzbl (%eax),%eax
+ 4ac:	3c 39                	cmp    $0x39,%al
+ 4ae:	7e c7                	jle    477 <atoi+0xf>
+  return n;
+ 4b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4b3:	c9                   	leave
+ 4b4:	c3                   	ret
+
+000004b5 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4b5:	55                   	push   %ebp
+ 4b6:	89 e5                	mov    %esp,%ebp
+ 4b8:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 4bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4be:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 4c7:	eb 17                	jmp    4e0 <memmove+0x2b>
+    *dst++ = *src++;
+ 4c9:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4cc:	8d 42 01             	lea    0x1(%edx),%eax
+ 4cf:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4d5:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4d8:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4db:	0f b6 12             	movzbl (%edx),%edx
+ 4de:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 4e0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4e3:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4e6:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4e9:	85 c0                	test   %eax,%eax
+ 4eb:	7f dc                	jg     4c9 <memmove+0x14>
+  return vdst;
+ 4ed:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4f0:	c9                   	leave
+ 4f1:	c3                   	ret
+
+000004f2 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 4f2:	55                   	push   %ebp
+ 4f3:	89 e5                	mov    %esp,%ebp
+ 4f5:	57                   	push   %edi
+ 4f6:	56                   	push   %esi
+ 4f7:	83 ec 30             	sub    $0x30,%esp
+ 4fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 500:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 503:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 506:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 50d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 514:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 517:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 51a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 51d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 520:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 527:	e9 89 00 00 00       	jmp    5b5 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 52c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 52f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 532:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 536:	01 c0                	add    %eax,%eax
+ 538:	89 c6                	mov    %eax,%esi
+ 53a:	89 d7                	mov    %edx,%edi
+ 53c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 53f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 542:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 545:	0f ad d0             	shrd   %cl,%edx,%eax
+ 548:	d3 ea                	shr    %cl,%edx
+ 54a:	f6 c1 20             	test   $0x20,%cl
+ 54d:	74 04                	je     553 <udiv64+0x61>
+ 54f:	89 d0                	mov    %edx,%eax
+ 551:	31 d2                	xor    %edx,%edx
+ 553:	83 e0 01             	and    $0x1,%eax
+ 556:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 559:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 560:	89 f0                	mov    %esi,%eax
+ 562:	89 fa                	mov    %edi,%edx
+ 564:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 567:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 56a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 56d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 570:	8b 45 10             	mov    0x10(%ebp),%eax
+ 573:	ba 00 00 00 00       	mov    $0x0,%edx
+ 578:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 57b:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 57e:	19 d1                	sbb    %edx,%ecx
+ 580:	72 2f                	jb     5b1 <udiv64+0xbf>
+      r -= d;
+ 582:	8b 45 10             	mov    0x10(%ebp),%eax
+ 585:	ba 00 00 00 00       	mov    $0x0,%edx
+ 58a:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 58d:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 590:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 593:	b8 01 00 00 00       	mov    $0x1,%eax
+ 598:	ba 00 00 00 00       	mov    $0x0,%edx
+ 59d:	0f a5 c2             	shld   %cl,%eax,%edx
+ 5a0:	d3 e0                	shl    %cl,%eax
+ 5a2:	f6 c1 20             	test   $0x20,%cl
+ 5a5:	74 04                	je     5ab <udiv64+0xb9>
+ 5a7:	89 c2                	mov    %eax,%edx
+ 5a9:	31 c0                	xor    %eax,%eax
+ 5ab:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 5ae:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 5b1:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 5b5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 5b9:	0f 89 6d ff ff ff    	jns    52c <udiv64+0x3a>
+    }
+  }
+  return q;
+ 5bf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 5c5:	83 c4 30             	add    $0x30,%esp
+ 5c8:	5e                   	pop    %esi
+ 5c9:	5f                   	pop    %edi
+ 5ca:	5d                   	pop    %ebp
+ 5cb:	c3                   	ret
+
+000005cc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5cc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5d1:	cd 40                	int    $0x40
+ 5d3:	c3                   	ret
+
+000005d4 <exit>:
+SYSCALL(exit)
+ 5d4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5d9:	cd 40                	int    $0x40
+ 5db:	c3                   	ret
+
+000005dc <wait>:
+SYSCALL(wait)
+ 5dc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5e1:	cd 40                	int    $0x40
+ 5e3:	c3                   	ret
+
+000005e4 <pipe>:
+SYSCALL(pipe)
+ 5e4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5e9:	cd 40                	int    $0x40
+ 5eb:	c3                   	ret
+
+000005ec <read>:
+SYSCALL(read)
+ 5ec:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5f1:	cd 40                	int    $0x40
+ 5f3:	c3                   	ret
+
+000005f4 <write>:
+SYSCALL(write)
+ 5f4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5f9:	cd 40                	int    $0x40
+ 5fb:	c3                   	ret
+
+000005fc <close>:
+SYSCALL(close)
+ 5fc:	b8 15 00 00 00       	mov    $0x15,%eax
+ 601:	cd 40                	int    $0x40
+ 603:	c3                   	ret
+
+00000604 <kill>:
+SYSCALL(kill)
+ 604:	b8 06 00 00 00       	mov    $0x6,%eax
+ 609:	cd 40                	int    $0x40
+ 60b:	c3                   	ret
+
+0000060c <exec>:
+SYSCALL(exec)
+ 60c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+
+00000614 <open>:
+SYSCALL(open)
+ 614:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 619:	cd 40                	int    $0x40
+ 61b:	c3                   	ret
+
+0000061c <mknod>:
+SYSCALL(mknod)
+ 61c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 621:	cd 40                	int    $0x40
+ 623:	c3                   	ret
+
+00000624 <unlink>:
+SYSCALL(unlink)
+ 624:	b8 12 00 00 00       	mov    $0x12,%eax
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <fstat>:
+SYSCALL(fstat)
+ 62c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 631:	cd 40                	int    $0x40
+ 633:	c3                   	ret
+
+00000634 <link>:
+SYSCALL(link)
+ 634:	b8 13 00 00 00       	mov    $0x13,%eax
+ 639:	cd 40                	int    $0x40
+ 63b:	c3                   	ret
+
+0000063c <mkdir>:
+SYSCALL(mkdir)
+ 63c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <chdir>:
+SYSCALL(chdir)
+ 644:	b8 09 00 00 00       	mov    $0x9,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <dup>:
+SYSCALL(dup)
+ 64c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <getpid>:
+SYSCALL(getpid)
+ 654:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <sbrk>:
+SYSCALL(sbrk)
+ 65c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <sleep>:
+SYSCALL(sleep)
+ 664:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <uptime>:
+SYSCALL(uptime)
+ 66c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 674:	b8 16 00 00 00       	mov    $0x16,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 67c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 684:	b8 18 00 00 00       	mov    $0x18,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <copy_file>:
+SYSCALL(copy_file)
+ 68c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <change_queue>:
+SYSCALL(change_queue)
+ 694:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 69c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 6a4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <print_process_info>:
+SYSCALL(print_process_info)
+ 6ac:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 6b4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 6bc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 6c4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 6cc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 6d4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 6dc:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 6e4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 6ec:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <set_affinity>:
+SYSCALL(set_affinity)
+ 6f4:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <setsched>:
+SYSCALL(setsched)
+ 6fc:	b8 27 00 00 00       	mov    $0x27,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 704:	b8 28 00 00 00       	mov    $0x28,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <set_quantum>:
+SYSCALL(set_quantum)
+ 70c:	b8 29 00 00 00       	mov    $0x29,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <schedtrace>:
+SYSCALL(schedtrace)
+ 714:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <getrusage>:
+SYSCALL(getrusage)
+ 71c:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 724:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 72c:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 734:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <futex_wait>:
+SYSCALL(futex_wait)
+ 73c:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <futex_wake>:
+SYSCALL(futex_wake)
+ 744:	b8 30 00 00 00       	mov    $0x30,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <syscall_latency>:
+SYSCALL(syscall_latency)
+ 74c:	b8 31 00 00 00       	mov    $0x31,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <submit_batch>:
+SYSCALL(submit_batch)
+ 754:	b8 32 00 00 00       	mov    $0x32,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <kmem_stats>:
+SYSCALL(kmem_stats)
+ 75c:	b8 33 00 00 00       	mov    $0x33,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 764:	b8 34 00 00 00       	mov    $0x34,%eax
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 76c:	55                   	push   %ebp
+ 76d:	89 e5                	mov    %esp,%ebp
+ 76f:	83 ec 18             	sub    $0x18,%esp
+ 772:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 775:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 778:	83 ec 04             	sub    $0x4,%esp
+ 77b:	6a 01                	push   $0x1
+ 77d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 780:	50                   	push   %eax
+ 781:	ff 75 08             	push   0x8(%ebp)
+ 784:	e8 6b fe ff ff       	call   5f4 <write>
+ 789:	83 c4 10             	add    $0x10,%esp
+}
+ 78c:	90                   	nop
+ 78d:	c9                   	leave
+ 78e:	c3                   	ret
+
+0000078f <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 78f:	55                   	push   %ebp
+ 790:	89 e5                	mov    %esp,%ebp
+ 792:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 795:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 79c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 7a0:	74 17                	je     7b9 <printint+0x2a>
+ 7a2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 7a6:	79 11                	jns    7b9 <printint+0x2a>
+    neg = 1;
+ 7a8:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 7af:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7b2:	f7 d8                	neg    %eax
+ 7b4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7b7:	eb 06                	jmp    7bf <printint+0x30>
+  } else {
+    x = xx;
+ 7b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7bc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 7bf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 7c6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7c9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7cc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7d1:	f7 f1                	div    %ecx
+ 7d3:	89 d1                	mov    %edx,%ecx
+ 7d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d8:	8d 50 01             	lea    0x1(%eax),%edx
+ 7db:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7de:	0f b6 91 d8 12 00 00 	movzbl 0x12d8(%ecx),%edx
+ 7e5:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 7e9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7ec:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7ef:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7f4:	f7 f1                	div    %ecx
+ 7f6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7f9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7fd:	75 c7                	jne    7c6 <printint+0x37>
+  if(neg)
+ 7ff:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 803:	74 2d                	je     832 <printint+0xa3>
+    buf[i++] = '-';
+ 805:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 808:	8d 50 01             	lea    0x1(%eax),%edx
+ 80b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 80e:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 813:	eb 1d                	jmp    832 <printint+0xa3>
+    putc(fd, buf[i]);
+ 815:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 818:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 81b:	01 d0                	add    %edx,%eax
+ 81d:	0f b6 00             	movzbl (%eax),%eax
+ 820:	0f be c0             	movsbl %al,%eax
+ 823:	83 ec 08             	sub    $0x8,%esp
+ 826:	50                   	push   %eax
+ 827:	ff 75 08             	push   0x8(%ebp)
+ 82a:	e8 3d ff ff ff       	call   76c <putc>
+ 82f:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 832:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 836:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 83a:	79 d9                	jns    815 <printint+0x86>
+}
+ 83c:	90                   	nop
+ 83d:	90                   	nop
+ 83e:	c9                   	leave
+ 83f:	c3                   	ret
+
+00000840 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 846:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 84d:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 850:	83 c0 04             	add    $0x4,%eax
+ 853:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 856:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 85d:	e9 59 01 00 00       	jmp    9bb <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 862:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 865:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 868:	01 d0                	add    %edx,%eax
+ 86a:	0f b6 00             	movzbl (%eax),%eax
+ 86d:	0f be c0             	movsbl %al,%eax
+ 870:	25 ff 00 00 00       	and    $0xff,%eax
+ 875:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 878:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 87c:	75 2c                	jne    8aa <printf+0x6a>
+      if(c == '%'){
+ 87e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 882:	75 0c                	jne    890 <printf+0x50>
+        state = '%';
+ 884:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 88b:	e9 27 01 00 00       	jmp    9b7 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 890:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 893:	0f be c0             	movsbl %al,%eax
+ 896:	83 ec 08             	sub    $0x8,%esp
+ 899:	50                   	push   %eax
+ 89a:	ff 75 08             	push   0x8(%ebp)
+ 89d:	e8 ca fe ff ff       	call   76c <putc>
+ 8a2:	83 c4 10             	add    $0x10,%esp
+ 8a5:	e9 0d 01 00 00       	jmp    9b7 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 8aa:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 8ae:	0f 85 03 01 00 00    	jne    9b7 <printf+0x177>
+      if(c == 'd'){
+ 8b4:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 8b8:	75 1e                	jne    8d8 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 8ba:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8bd:	8b 00                	mov    (%eax),%eax
+ 8bf:	6a 01                	push   $0x1
+ 8c1:	6a 0a                	push   $0xa
+ 8c3:	50                   	push   %eax
+ 8c4:	ff 75 08             	push   0x8(%ebp)
+ 8c7:	e8 c3 fe ff ff       	call   78f <printint>
+ 8cc:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8cf:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8d3:	e9 d8 00 00 00       	jmp    9b0 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 8d8:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 8dc:	74 06                	je     8e4 <printf+0xa4>
+ 8de:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 8e2:	75 1e                	jne    902 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 8e4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8e7:	8b 00                	mov    (%eax),%eax
+ 8e9:	6a 00                	push   $0x0
+ 8eb:	6a 10                	push   $0x10
+ 8ed:	50                   	push   %eax
+ 8ee:	ff 75 08             	push   0x8(%ebp)
+ 8f1:	e8 99 fe ff ff       	call   78f <printint>
+ 8f6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8f9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8fd:	e9 ae 00 00 00       	jmp    9b0 <printf+0x170>
+      } else if(c == 's'){
+ 902:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 906:	75 43                	jne    94b <printf+0x10b>
+        s = (char*)*ap;
+ 908:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 90b:	8b 00                	mov    (%eax),%eax
+ 90d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 910:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 914:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 918:	75 25                	jne    93f <printf+0xff>
+          s = "(null)";
+ 91a:	c7 45 f4 5e 0e 00 00 	movl   $0xe5e,-0xc(%ebp)
+        while(*s != 0){
+ 921:	eb 1c                	jmp    93f <printf+0xff>
+          putc(fd, *s);
+ 923:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 926:	0f b6 00             	movzbl (%eax),%eax
+ 929:	0f be c0             	movsbl %al,%eax
+ 92c:	83 ec 08             	sub    $0x8,%esp
+ 92f:	50                   	push   %eax
+ 930:	ff 75 08             	push   0x8(%ebp)
+ 933:	e8 34 fe ff ff       	call   76c <putc>
+ 938:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 93b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 93f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 942:	0f b6 00             	movzbl (%eax),%eax
+ 945:	84 c0                	test   %al,%al
+ 947:	75 da                	jne    923 <printf+0xe3>
+ 949:	eb 65                	jmp    9b0 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 94b:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 94f:	75 1d                	jne    96e <printf+0x12e>
+        putc(fd, *ap);
+ 951:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 954:	8b 00                	mov    (%eax),%eax
+ 956:	0f be c0             	movsbl %al,%eax
+ 959:	83 ec 08             	sub    $0x8,%esp
+ 95c:	50                   	push   %eax
+ 95d:	ff 75 08             	push   0x8(%ebp)
+ 960:	e8 07 fe ff ff       	call   76c <putc>
+ 965:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 968:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 96c:	eb 42                	jmp    9b0 <printf+0x170>
+      } else if(c == '%'){
+ 96e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 972:	75 17                	jne    98b <printf+0x14b>
+        putc(fd, c);
+ 974:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 977:	0f be c0             	movsbl %al,%eax
+ 97a:	83 ec 08             	sub    $0x8,%esp
+ 97d:	50                   	push   %eax
+ 97e:	ff 75 08             	push   0x8(%ebp)
+ 981:	e8 e6 fd ff ff       	call   76c <putc>
+ 986:	83 c4 10             	add    $0x10,%esp
+ 989:	eb 25                	jmp    9b0 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 98b:	83 ec 08             	sub    $0x8,%esp
+ 98e:	6a 25                	push   $0x25
+ 990:	ff 75 08             	push   0x8(%ebp)
+ 993:	e8 d4 fd ff ff       	call   76c <putc>
+ 998:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 99b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 99e:	0f be c0             	movsbl %al,%eax
+ 9a1:	83 ec 08             	sub    $0x8,%esp
+ 9a4:	50                   	push   %eax
+ 9a5:	ff 75 08             	push   0x8(%ebp)
+ 9a8:	e8 bf fd ff ff       	call   76c <putc>
+ 9ad:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 9b0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9b7:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 9bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9c1:	01 d0                	add    %edx,%eax
+ 9c3:	0f b6 00             	movzbl (%eax),%eax
+ 9c6:	84 c0                	test   %al,%al
+ 9c8:	0f 85 94 fe ff ff    	jne    862 <printf+0x22>
+    }
+  }
+}
+ 9ce:	90                   	nop
+ 9cf:	90                   	nop
+ 9d0:	c9                   	leave
+ 9d1:	c3                   	ret
+
+000009d2 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9d2:	55                   	push   %ebp
+ 9d3:	89 e5                	mov    %esp,%ebp
+ 9d5:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 9d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9db:	83 e8 08             	sub    $0x8,%eax
+ 9de:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9e1:	a1 f4 12 00 00       	mov    0x12f4,%eax
+ 9e6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9e9:	eb 24                	jmp    a0f <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9eb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ee:	8b 00                	mov    (%eax),%eax
+ 9f0:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9f3:	72 12                	jb     a07 <free+0x35>
+ 9f5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9f8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9fb:	72 24                	jb     a21 <free+0x4f>
+ 9fd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a00:	8b 00                	mov    (%eax),%eax
+ a02:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a05:	72 1a                	jb     a21 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a07:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a0a:	8b 00                	mov    (%eax),%eax
+ a0c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a0f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a12:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a15:	73 d4                	jae    9eb <free+0x19>
+ a17:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a1a:	8b 00                	mov    (%eax),%eax
+ a1c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a1f:	73 ca                	jae    9eb <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a21:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a24:	8b 40 04             	mov    0x4(%eax),%eax
+ a27:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a2e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a31:	01 c2                	add    %eax,%edx
+ a33:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a36:	8b 00                	mov    (%eax),%eax
+ a38:	39 c2                	cmp    %eax,%edx
+ a3a:	75 24                	jne    a60 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ a3c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a3f:	8b 50 04             	mov    0x4(%eax),%edx
+ a42:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a45:	8b 00                	mov    (%eax),%eax
+ a47:	8b 40 04             	mov    0x4(%eax),%eax
+ a4a:	01 c2                	add    %eax,%edx
+ a4c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a4f:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a52:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a55:	8b 00                	mov    (%eax),%eax
+ a57:	8b 10                	mov    (%eax),%edx
+ a59:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a5c:	89 10                	mov    %edx,(%eax)
+ a5e:	eb 0a                	jmp    a6a <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a60:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a63:	8b 10                	mov    (%eax),%edx
+ a65:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a68:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ a6a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a6d:	8b 40 04             	mov    0x4(%eax),%eax
+ a70:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a77:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a7a:	01 d0                	add    %edx,%eax
+ a7c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a7f:	75 20                	jne    aa1 <free+0xcf>
+    p->s.size += bp->s.size;
+ a81:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a84:	8b 50 04             	mov    0x4(%eax),%edx
+ a87:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a8a:	8b 40 04             	mov    0x4(%eax),%eax
+ a8d:	01 c2                	add    %eax,%edx
+ a8f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a92:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ a95:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a98:	8b 10                	mov    (%eax),%edx
+ a9a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a9d:	89 10                	mov    %edx,(%eax)
+ a9f:	eb 08                	jmp    aa9 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ aa1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa4:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ aa7:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ aa9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aac:	a3 f4 12 00 00       	mov    %eax,0x12f4
+}
+ ab1:	90                   	nop
+ ab2:	c9                   	leave
+ ab3:	c3                   	ret
+
+00000ab4 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ ab4:	55                   	push   %ebp
+ ab5:	89 e5                	mov    %esp,%ebp
+ ab7:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ aba:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ ac1:	77 07                	ja     aca <morecore+0x16>
+    nu = 4096;
+ ac3:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ aca:	8b 45 08             	mov    0x8(%ebp),%eax
+ acd:	c1 e0 03             	shl    $0x3,%eax
+ ad0:	83 ec 0c             	sub    $0xc,%esp
+ ad3:	50                   	push   %eax
+ ad4:	e8 83 fb ff ff       	call   65c <sbrk>
+ ad9:	83 c4 10             	add    $0x10,%esp
+ adc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ adf:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ ae3:	75 07                	jne    aec <morecore+0x38>
+    return 0;
+ ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+ aea:	eb 26                	jmp    b12 <morecore+0x5e>
+  hp = (Header*)p;
+ aec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aef:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ af2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ af5:	8b 55 08             	mov    0x8(%ebp),%edx
+ af8:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ afb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ afe:	83 c0 08             	add    $0x8,%eax
+ b01:	83 ec 0c             	sub    $0xc,%esp
+ b04:	50                   	push   %eax
+ b05:	e8 c8 fe ff ff       	call   9d2 <free>
+ b0a:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ b0d:	a1 f4 12 00 00       	mov    0x12f4,%eax
+}
+ b12:	c9                   	leave
+ b13:	c3                   	ret
+
+00000b14 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b14:	55                   	push   %ebp
+ b15:	89 e5                	mov    %esp,%ebp
+ b17:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b1a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b1d:	83 c0 07             	add    $0x7,%eax
+ b20:	c1 e8 03             	shr    $0x3,%eax
+ b23:	83 c0 01             	add    $0x1,%eax
+ b26:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ b29:	a1 f4 12 00 00       	mov    0x12f4,%eax
+ b2e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b31:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b35:	75 23                	jne    b5a <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ b37:	c7 45 f0 ec 12 00 00 	movl   $0x12ec,-0x10(%ebp)
+ b3e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b41:	a3 f4 12 00 00       	mov    %eax,0x12f4
+ b46:	a1 f4 12 00 00       	mov    0x12f4,%eax
+ b4b:	a3 ec 12 00 00       	mov    %eax,0x12ec
+    base.s.size = 0;
+ b50:	c7 05 f0 12 00 00 00 	movl   $0x0,0x12f0
+ b57:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b5a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b5d:	8b 00                	mov    (%eax),%eax
+ b5f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b65:	8b 40 04             	mov    0x4(%eax),%eax
+ b68:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b6b:	72 4d                	jb     bba <malloc+0xa6>
+      if(p->s.size == nunits)
+ b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b70:	8b 40 04             	mov    0x4(%eax),%eax
+ b73:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b76:	75 0c                	jne    b84 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ b78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b7b:	8b 10                	mov    (%eax),%edx
+ b7d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b80:	89 10                	mov    %edx,(%eax)
+ b82:	eb 26                	jmp    baa <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ b84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b87:	8b 40 04             	mov    0x4(%eax),%eax
+ b8a:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b8d:	89 c2                	mov    %eax,%edx
+ b8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b92:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ b95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b98:	8b 40 04             	mov    0x4(%eax),%eax
+ b9b:	c1 e0 03             	shl    $0x3,%eax
+ b9e:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ ba1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ ba7:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ baa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bad:	a3 f4 12 00 00       	mov    %eax,0x12f4
+      return (void*)(p + 1);
+ bb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bb5:	83 c0 08             	add    $0x8,%eax
+ bb8:	eb 3b                	jmp    bf5 <malloc+0xe1>
+    }
+    if(p == freep)
+ bba:	a1 f4 12 00 00       	mov    0x12f4,%eax
+ bbf:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ bc2:	75 1e                	jne    be2 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ bc4:	83 ec 0c             	sub    $0xc,%esp
+ bc7:	ff 75 ec             	push   -0x14(%ebp)
+ bca:	e8 e5 fe ff ff       	call   ab4 <morecore>
+ bcf:	83 c4 10             	add    $0x10,%esp
+ bd2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ bd5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bd9:	75 07                	jne    be2 <malloc+0xce>
+        return 0;
+ bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+ be0:	eb 13                	jmp    bf5 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ be2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ be5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ be8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ beb:	8b 00                	mov    (%eax),%eax
+ bed:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ bf0:	e9 6d ff ff ff       	jmp    b62 <malloc+0x4e>
+  }
+}
+ bf5:	c9                   	leave
+ bf6:	c3                   	ret
+
+00000bf7 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ bf7:	55                   	push   %ebp
+ bf8:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ bfa:	8b 45 08             	mov    0x8(%ebp),%eax
+ bfd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c03:	90                   	nop
+ c04:	5d                   	pop    %ebp
+ c05:	c3                   	ret
+
+00000c06 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ c06:	55                   	push   %ebp
+ c07:	89 e5                	mov    %esp,%ebp
+ c09:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ c0c:	8b 55 08             	mov    0x8(%ebp),%edx
+ c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+ c14:	b9 01 00 00 00       	mov    $0x1,%ecx
+ c19:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c1d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c20:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c24:	74 3b                	je     c61 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ c26:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ c2a:	74 2d                	je     c59 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ c2c:	8b 55 08             	mov    0x8(%ebp),%edx
+ c2f:	b8 02 00 00 00       	mov    $0x2,%eax
+ c34:	87 02                	xchg   %eax,(%edx)
+ c36:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ c39:	eb 1e                	jmp    c59 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ c3b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c3e:	83 ec 08             	sub    $0x8,%esp
+ c41:	6a 02                	push   $0x2
+ c43:	50                   	push   %eax
+ c44:	e8 f3 fa ff ff       	call   73c <futex_wait>
+ c49:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ c4c:	8b 55 08             	mov    0x8(%ebp),%edx
+ c4f:	b8 02 00 00 00       	mov    $0x2,%eax
+ c54:	87 02                	xchg   %eax,(%edx)
+ c56:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ c59:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c5d:	75 dc                	jne    c3b <mutex_lock+0x35>
+ c5f:	eb 01                	jmp    c62 <mutex_lock+0x5c>
+    return;
+ c61:	90                   	nop
+  }
+}
+ c62:	c9                   	leave
+ c63:	c3                   	ret
+
+00000c64 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ c64:	55                   	push   %ebp
+ c65:	89 e5                	mov    %esp,%ebp
+ c67:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+ c6d:	ba 01 00 00 00       	mov    $0x1,%edx
+ c72:	f7 da                	neg    %edx
+ c74:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ c78:	83 fa 01             	cmp    $0x1,%edx
+ c7b:	74 1a                	je     c97 <mutex_unlock+0x33>
+    m->state = 0;
+ c7d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c80:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ c86:	8b 45 08             	mov    0x8(%ebp),%eax
+ c89:	83 ec 08             	sub    $0x8,%esp
+ c8c:	6a 01                	push   $0x1
+ c8e:	50                   	push   %eax
+ c8f:	e8 b0 fa ff ff       	call   744 <futex_wake>
+ c94:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ c97:	90                   	nop
+ c98:	c9                   	leave
+ c99:	c3                   	ret
+
+00000c9a <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ c9a:	55                   	push   %ebp
+ c9b:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ c9d:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ cb0:	90                   	nop
+ cb1:	5d                   	pop    %ebp
+ cb2:	c3                   	ret
+
+00000cb3 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ cb3:	55                   	push   %ebp
+ cb4:	89 e5                	mov    %esp,%ebp
+ cb6:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+ cbc:	83 c0 04             	add    $0x4,%eax
+ cbf:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+ cc6:	83 ec 08             	sub    $0x8,%esp
+ cc9:	ff 75 0c             	push   0xc(%ebp)
+ ccc:	50                   	push   %eax
+ ccd:	e8 6a fa ff ff       	call   73c <futex_wait>
+ cd2:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ cd5:	8b 45 08             	mov    0x8(%ebp),%eax
+ cd8:	83 c0 04             	add    $0x4,%eax
+ cdb:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ cdf:	90                   	nop
+ ce0:	c9                   	leave
+ ce1:	c3                   	ret
+
+00000ce2 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ ce2:	55                   	push   %ebp
+ ce3:	89 e5                	mov    %esp,%ebp
+ ce5:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ ce8:	8b 45 08             	mov    0x8(%ebp),%eax
+ ceb:	8b 00                	mov    (%eax),%eax
+ ced:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ cf0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cf4:	78 17                	js     d0d <rwlock_rdlock+0x2b>
+ cf6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf9:	83 c0 01             	add    $0x1,%eax
+ cfc:	89 c1                	mov    %eax,%ecx
+ cfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d01:	8b 55 08             	mov    0x8(%ebp),%edx
+ d04:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ d08:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d0b:	74 19                	je     d26 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ d0d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d11:	79 d5                	jns    ce8 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ d13:	83 ec 08             	sub    $0x8,%esp
+ d16:	ff 75 f4             	push   -0xc(%ebp)
+ d19:	ff 75 08             	push   0x8(%ebp)
+ d1c:	e8 92 ff ff ff       	call   cb3 <rwlock_sleep>
+ d21:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ d24:	eb c2                	jmp    ce8 <rwlock_rdlock+0x6>
+      return;
+ d26:	90                   	nop
+  }
+}
+ d27:	c9                   	leave
+ d28:	c3                   	ret
+
+00000d29 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ d29:	55                   	push   %ebp
+ d2a:	89 e5                	mov    %esp,%ebp
+ d2c:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ d2f:	eb 11                	jmp    d42 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ d31:	83 ec 08             	sub    $0x8,%esp
+ d34:	ff 75 f4             	push   -0xc(%ebp)
+ d37:	ff 75 08             	push   0x8(%ebp)
+ d3a:	e8 74 ff ff ff       	call   cb3 <rwlock_sleep>
+ d3f:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ d42:	8b 55 08             	mov    0x8(%ebp),%edx
+ d45:	b8 00 00 00 00       	mov    $0x0,%eax
+ d4a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ d4f:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ d53:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d56:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d5a:	75 d5                	jne    d31 <rwlock_wrlock+0x8>
+}
+ d5c:	90                   	nop
+ d5d:	90                   	nop
+ d5e:	c9                   	leave
+ d5f:	c3                   	ret
+
+00000d60 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ d60:	55                   	push   %ebp
+ d61:	89 e5                	mov    %esp,%ebp
+ d63:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ d66:	8b 45 08             	mov    0x8(%ebp),%eax
+ d69:	8b 00                	mov    (%eax),%eax
+ d6b:	85 c0                	test   %eax,%eax
+ d6d:	79 0c                	jns    d7b <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ d6f:	8b 45 08             	mov    0x8(%ebp),%eax
+ d72:	ba 00 00 00 00       	mov    $0x0,%edx
+ d77:	87 10                	xchg   %edx,(%eax)
+ d79:	eb 18                	jmp    d93 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ d7b:	8b 55 08             	mov    0x8(%ebp),%edx
+ d7e:	b8 01 00 00 00       	mov    $0x1,%eax
+ d83:	f7 d8                	neg    %eax
+ d85:	89 c1                	mov    %eax,%ecx
+ d87:	89 c8                	mov    %ecx,%eax
+ d89:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ d8d:	01 c8                	add    %ecx,%eax
+ d8f:	85 c0                	test   %eax,%eax
+ d91:	75 20                	jne    db3 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ d93:	8b 45 08             	mov    0x8(%ebp),%eax
+ d96:	8b 40 04             	mov    0x4(%eax),%eax
+ d99:	85 c0                	test   %eax,%eax
+ d9b:	74 17                	je     db4 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ d9d:	8b 45 08             	mov    0x8(%ebp),%eax
+ da0:	83 ec 08             	sub    $0x8,%esp
+ da3:	68 ff ff ff 7f       	push   $0x7fffffff
+ da8:	50                   	push   %eax
+ da9:	e8 96 f9 ff ff       	call   744 <futex_wake>
+ dae:	83 c4 10             	add    $0x10,%esp
+ db1:	eb 01                	jmp    db4 <rwlock_unlock+0x54>
+    return;
+ db3:	90                   	nop
+}
+ db4:	c9                   	leave
+ db5:	c3                   	ret
+
+00000db6 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ db6:	55                   	push   %ebp
+ db7:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ db9:	8b 45 08             	mov    0x8(%ebp),%eax
+ dbc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ dc2:	90                   	nop
+ dc3:	5d                   	pop    %ebp
+ dc4:	c3                   	ret
+
+00000dc5 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ dc5:	55                   	push   %ebp
+ dc6:	89 e5                	mov    %esp,%ebp
+ dc8:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ dcb:	8b 45 08             	mov    0x8(%ebp),%eax
+ dce:	8b 00                	mov    (%eax),%eax
+ dd0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ dd3:	83 ec 0c             	sub    $0xc,%esp
+ dd6:	ff 75 0c             	push   0xc(%ebp)
+ dd9:	e8 86 fe ff ff       	call   c64 <mutex_unlock>
+ dde:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ de1:	8b 45 08             	mov    0x8(%ebp),%eax
+ de4:	83 ec 08             	sub    $0x8,%esp
+ de7:	ff 75 f4             	push   -0xc(%ebp)
+ dea:	50                   	push   %eax
+ deb:	e8 4c f9 ff ff       	call   73c <futex_wait>
+ df0:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ df3:	83 ec 0c             	sub    $0xc,%esp
+ df6:	ff 75 0c             	push   0xc(%ebp)
+ df9:	e8 08 fe ff ff       	call   c06 <mutex_lock>
+ dfe:	83 c4 10             	add    $0x10,%esp
+}
+ e01:	90                   	nop
+ e02:	c9                   	leave
+ e03:	c3                   	ret
+
+00000e04 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ e04:	55                   	push   %ebp
+ e05:	89 e5                	mov    %esp,%ebp
+ e07:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ e0a:	8b 45 08             	mov    0x8(%ebp),%eax
+ e0d:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ e11:	8b 45 08             	mov    0x8(%ebp),%eax
+ e14:	83 ec 08             	sub    $0x8,%esp
+ e17:	6a 01                	push   $0x1
+ e19:	50                   	push   %eax
+ e1a:	e8 25 f9 ff ff       	call   744 <futex_wake>
+ e1f:	83 c4 10             	add    $0x10,%esp
+}
+ e22:	90                   	nop
+ e23:	c9                   	leave
+ e24:	c3                   	ret
+
+00000e25 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ e25:	55                   	push   %ebp
+ e26:	89 e5                	mov    %esp,%ebp
+ e28:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ e2b:	8b 45 08             	mov    0x8(%ebp),%eax
+ e2e:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ e32:	8b 45 08             	mov    0x8(%ebp),%eax
+ e35:	83 ec 08             	sub    $0x8,%esp
+ e38:	68 ff ff ff 7f       	push   $0x7fffffff
+ e3d:	50                   	push   %eax
+ e3e:	e8 01 f9 ff ff       	call   744 <futex_wake>
+ e43:	83 c4 10             	add    $0x10,%esp
+}
+ e46:	90                   	nop
+ e47:	c9                   	leave
+ e48:	c3                   	ret
@@ -0,0 +1,1839 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+  14:	c7 45 e6 73 74 72 65 	movl   $0x65727473,-0x1a(%ebp)
+  1b:	c7 45 ea 73 73 66 73 	movl   $0x73667373,-0x16(%ebp)
+  22:	66 c7 45 ee 30 00    	movw   $0x30,-0x12(%ebp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  28:	83 ec 08             	sub    $0x8,%esp
+  2b:	68 f8 0c 00 00       	push   $0xcf8
+  30:	6a 01                	push   $0x1
+  32:	e8 b8 06 00 00       	call   6ef <printf>
+  37:	83 c4 10             	add    $0x10,%esp
+  memset(data, 'a', sizeof(data));
+  3a:	83 ec 04             	sub    $0x4,%esp
+  3d:	68 00 02 00 00       	push   $0x200
+  42:	6a 61                	push   $0x61
+  44:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  4a:	50                   	push   %eax
+  4b:	e8 be 01 00 00       	call   20e <memset>
+  50:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 4; i++)
+  53:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  5a:	eb 0d                	jmp    69 <main+0x69>
+    if(fork() > 0)
+  5c:	e8 1a 04 00 00       	call   47b <fork>
+  61:	85 c0                	test   %eax,%eax
+  63:	7f 0c                	jg     71 <main+0x71>
+  for(i = 0; i < 4; i++)
+  65:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  69:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+  6d:	7e ed                	jle    5c <main+0x5c>
+  6f:	eb 01                	jmp    72 <main+0x72>
+      break;
+  71:	90                   	nop
+
+  printf(1, "write %d\n", i);
+  72:	83 ec 04             	sub    $0x4,%esp
+  75:	ff 75 f4             	push   -0xc(%ebp)
+  78:	68 0b 0d 00 00       	push   $0xd0b
+  7d:	6a 01                	push   $0x1
+  7f:	e8 6b 06 00 00       	call   6ef <printf>
+  84:	83 c4 10             	add    $0x10,%esp
+
+  path[8] += i;
+  87:	0f b6 45 ee          	movzbl -0x12(%ebp),%eax
+  8b:	89 c2                	mov    %eax,%edx
+  8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  90:	01 d0                	add    %edx,%eax
+  92:	88 45 ee             	mov    %al,-0x12(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  95:	83 ec 08             	sub    $0x8,%esp
+  98:	68 02 02 00 00       	push   $0x202
+  9d:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  a0:	50                   	push   %eax
+  a1:	e8 1d 04 00 00       	call   4c3 <open>
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 20; i++)
+  ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  b3:	eb 1e                	jmp    d3 <main+0xd3>
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  b5:	83 ec 04             	sub    $0x4,%esp
+  b8:	68 00 02 00 00       	push   $0x200
+  bd:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  c3:	50                   	push   %eax
+  c4:	ff 75 f0             	push   -0x10(%ebp)
+  c7:	e8 d7 03 00 00       	call   4a3 <write>
+  cc:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 20; i++)
+  cf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  d3:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+  d7:	7e dc                	jle    b5 <main+0xb5>
+  close(fd);
+  d9:	83 ec 0c             	sub    $0xc,%esp
+  dc:	ff 75 f0             	push   -0x10(%ebp)
+  df:	e8 c7 03 00 00       	call   4ab <close>
+  e4:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "read\n");
+  e7:	83 ec 08             	sub    $0x8,%esp
+  ea:	68 15 0d 00 00       	push   $0xd15
+  ef:	6a 01                	push   $0x1
+  f1:	e8 f9 05 00 00       	call   6ef <printf>
+  f6:	83 c4 10             	add    $0x10,%esp
+
+  fd = open(path, O_RDONLY);
+  f9:	83 ec 08             	sub    $0x8,%esp
+  fc:	6a 00                	push   $0x0
+  fe:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+ 101:	50                   	push   %eax
+ 102:	e8 bc 03 00 00       	call   4c3 <open>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for (i = 0; i < 20; i++)
+ 10d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 114:	eb 1e                	jmp    134 <main+0x134>
+    read(fd, data, sizeof(data));
+ 116:	83 ec 04             	sub    $0x4,%esp
+ 119:	68 00 02 00 00       	push   $0x200
+ 11e:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+ 124:	50                   	push   %eax
+ 125:	ff 75 f0             	push   -0x10(%ebp)
+ 128:	e8 6e 03 00 00       	call   49b <read>
+ 12d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < 20; i++)
+ 130:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 134:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 138:	7e dc                	jle    116 <main+0x116>
+  close(fd);
+ 13a:	83 ec 0c             	sub    $0xc,%esp
+ 13d:	ff 75 f0             	push   -0x10(%ebp)
+ 140:	e8 66 03 00 00       	call   4ab <close>
+ 145:	83 c4 10             	add    $0x10,%esp
+
+  wait();
+ 148:	e8 3e 03 00 00       	call   48b <wait>
+
+  exit();
+ 14d:	e8 31 03 00 00       	call   483 <exit>
+
+00000152 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 152:	55                   	push   %ebp
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	57                   	push   %edi
+ 156:	53                   	push   %ebx
+{
+ 157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 15a:	8b 55 10             	mov    0x10(%ebp),%edx
+ 15d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 160:	89 cb                	mov    %ecx,%ebx
+ 162:	89 df                	mov    %ebx,%edi
+ 164:	89 d1                	mov    %edx,%ecx
+ 166:	fc                   	cld
+ 167:	f3 aa                	rep stos %al,%es:(%edi)
+ 169:	89 ca                	mov    %ecx,%edx
+ 16b:	89 fb                	mov    %edi,%ebx
+ 16d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 170:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 173:	90                   	nop
+ 174:	5b                   	pop    %ebx
+ 175:	5f                   	pop    %edi
+ 176:	5d                   	pop    %ebp
+ 177:	c3                   	ret
+
+00000178 <strcpy>:
+{
+ 178:	55                   	push   %ebp
+ 179:	89 e5                	mov    %esp,%ebp
+ 17b:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 17e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 181:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 184:	90                   	nop
+ 185:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 188:	8d 42 01             	lea    0x1(%edx),%eax
+ 18b:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 18e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 191:	8d 48 01             	lea    0x1(%eax),%ecx
+ 194:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 197:	0f b6 12             	movzbl (%edx),%edx
+ 19a:	88 10                	mov    %dl,(%eax)
+ 19c:	0f b6 00             	movzbl (%eax),%eax
+ 19f:	84 c0                	test   %al,%al
+ 1a1:	75 e2                	jne    185 <strcpy+0xd>
+  return os;
+ 1a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1a6:	c9                   	leave
+ 1a7:	c3                   	ret
+
+000001a8 <strcmp>:
+{
+ 1a8:	55                   	push   %ebp
+ 1a9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1ab:	eb 08                	jmp    1b5 <strcmp+0xd>
+    p++, q++;
+ 1ad:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1b1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b8:	0f b6 00             	movzbl (%eax),%eax
+ 1bb:	84 c0                	test   %al,%al
+ 1bd:	74 10                	je     1cf <strcmp+0x27>
+ 1bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c2:	0f b6 10             	movzbl (%eax),%edx
+ 1c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c8:	0f b6 00             	movzbl (%eax),%eax
+ 1cb:	38 c2                	cmp    %al,%dl
+ 1cd:	74 de                	je     1ad <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	0f b6 00             	movzbl (%eax),%eax
+ 1d5:	0f b6 d0             	movzbl %al,%edx
+ 1d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1db:	0f b6 00             	movzbl (%eax),%eax
+ 1de:	0f b6 c0             	movzbl %al,%eax
+ 1e1:	29 c2                	sub    %eax,%edx
+ 1e3:	89 d0                	mov    %edx,%eax
+}
+ 1e5:	5d                   	pop    %ebp
+ 1e6:	c3                   	ret
+
+000001e7 <strlen>:
+{
+ 1e7:	55                   	push   %ebp
+ 1e8:	89 e5                	mov    %esp,%ebp
+ 1ea:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1ed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1f4:	eb 04                	jmp    1fa <strlen+0x13>
+ 1f6:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1fa:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 200:	01 d0                	add    %edx,%eax
+ 202:	0f b6 00             	movzbl (%eax),%eax
+ 205:	84 c0                	test   %al,%al
+ 207:	75 ed                	jne    1f6 <strlen+0xf>
+  return n;
+ 209:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 20c:	c9                   	leave
+ 20d:	c3                   	ret
+
+0000020e <memset>:
+{
+ 20e:	55                   	push   %ebp
+ 20f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 211:	8b 45 10             	mov    0x10(%ebp),%eax
+ 214:	50                   	push   %eax
+ 215:	ff 75 0c             	push   0xc(%ebp)
+ 218:	ff 75 08             	push   0x8(%ebp)
+ 21b:	e8 32 ff ff ff       	call   152 <stosb>
+ 220:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 226:	c9                   	leave
+ 227:	c3                   	ret
+
+00000228 <strchr>:
+{
+ 228:	55                   	push   %ebp
+ 229:	89 e5                	mov    %esp,%ebp
+ 22b:	83 ec 04             	sub    $0x4,%esp
+ 22e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 231:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 234:	eb 14                	jmp    24a <strchr+0x22>
+    if(*s == c)
+ 236:	8b 45 08             	mov    0x8(%ebp),%eax
+ 239:	0f b6 00             	movzbl (%eax),%eax
+ 23c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 23f:	75 05                	jne    246 <strchr+0x1e>
+      return (char*)s;
+ 241:	8b 45 08             	mov    0x8(%ebp),%eax
+ 244:	eb 13                	jmp    259 <strchr+0x31>
+  for(; *s; s++)
+ 246:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 24a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24d:	0f b6 00             	movzbl (%eax),%eax
+ 250:	84 c0                	test   %al,%al
+ 252:	75 e2                	jne    236 <strchr+0xe>
+  return 0;
+ 254:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 259:	c9                   	leave
+ 25a:	c3                   	ret
+
+0000025b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 25b:	55                   	push   %ebp
+ 25c:	89 e5                	mov    %esp,%ebp
+ 25e:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 261:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 268:	eb 42                	jmp    2ac <gets+0x51>
+    cc = read(0, &c, 1);
+ 26a:	83 ec 04             	sub    $0x4,%esp
+ 26d:	6a 01                	push   $0x1
+ 26f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 272:	50                   	push   %eax
+ 273:	6a 00                	push   $0x0
+ 275:	e8 21 02 00 00       	call   49b <read>
+ 27a:	83 c4 10             	add    $0x10,%esp
+ 27d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 280:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 284:	7e 33                	jle    2b9 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 286:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 289:	8d 50 01             	lea    0x1(%eax),%edx
+ 28c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 28f:	89 c2                	mov    %eax,%edx
+ 291:	8b 45 08             	mov    0x8(%ebp),%eax
+ 294:	01 c2                	add    %eax,%edx
+ 296:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 29a:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 29c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a0:	3c 0a                	cmp    $0xa,%al
+ 2a2:	74 16                	je     2ba <gets+0x5f>
+ 2a4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a8:	3c 0d                	cmp    $0xd,%al
+ 2aa:	74 0e                	je     2ba <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2af:	83 c0 01             	add    $0x1,%eax
+ 2b2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2b5:	7f b3                	jg     26a <gets+0xf>
+ 2b7:	eb 01                	jmp    2ba <gets+0x5f>
+      break;
+ 2b9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 2ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c0:	01 d0                	add    %edx,%eax
+ 2c2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2c5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c8:	c9                   	leave
+ 2c9:	c3                   	ret
+
+000002ca <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2ca:	55                   	push   %ebp
+ 2cb:	89 e5                	mov    %esp,%ebp
+ 2cd:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d0:	83 ec 08             	sub    $0x8,%esp
+ 2d3:	6a 00                	push   $0x0
+ 2d5:	ff 75 08             	push   0x8(%ebp)
+ 2d8:	e8 e6 01 00 00       	call   4c3 <open>
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2e7:	79 07                	jns    2f0 <stat+0x26>
+    return -1;
+ 2e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2ee:	eb 25                	jmp    315 <stat+0x4b>
+  r = fstat(fd, st);
+ 2f0:	83 ec 08             	sub    $0x8,%esp
+ 2f3:	ff 75 0c             	push   0xc(%ebp)
+ 2f6:	ff 75 f4             	push   -0xc(%ebp)
+ 2f9:	e8 dd 01 00 00       	call   4db <fstat>
+ 2fe:	83 c4 10             	add    $0x10,%esp
+ 301:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 304:	83 ec 0c             	sub    $0xc,%esp
+ 307:	ff 75 f4             	push   -0xc(%ebp)
+ 30a:	e8 9c 01 00 00       	call   4ab <close>
+ 30f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 312:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 315:	c9                   	leave
+ 316:	c3                   	ret
+
+00000317 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 317:	55                   	push   %ebp
+ 318:	89 e5                	mov    %esp,%ebp
+ 31a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 31d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 324:	eb 25                	jmp    34b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 326:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 329:	89 d0                	mov    %edx,%eax
+ 32b:	c1 e0 02             	shl    $0x2,%eax
+ 32e:	01 d0                	add    %edx,%eax
+ 330:	01 c0                	add    %eax,%eax
+ 332:	89 c1                	mov    %eax,%ecx
+ 334:	8b 45 08             	mov    0x8(%ebp),%eax
+ 337:	8d 50 01             	lea    0x1(%eax),%edx
+ 33a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 33d:	0f b6 00             	movzbl (%eax),%eax
+ 340:	0f be c0             	movsbl %al,%eax
+ 343:	01 c8                	add    %ecx,%eax
+ 345:	83 e8 30             	sub    $0x30,%eax
+ 348:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34e:	0f b6 00             	movzbl (%eax),%eax
+ 351:	3c 2f                	cmp    $0x2f,%al
+ 353:	7e 0a                	jle    35f <atoi+0x48>
+ 355:	8b 45 08             	mov    0x8(%ebp),%eax
+ 358:	0f b6 00             	movzbl (%eax),%eax
+ 35b:	3c 39                	cmp    $0x39,%al
+ 35d:	7e c7                	jle    326 <atoi+0xf>
+  return n;
+ 35f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 362:	c9                   	leave
+ 363:	c3                   	ret
+
+00000364 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 364:	55                   	push   %ebp
+ 365:	89 e5                	mov    %esp,%ebp
+ 367:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 36a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 370:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 373:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 376:	eb 17                	jmp    38f <memmove+0x2b>
+    *dst++ = *src++;
+ 378:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 37b:	8d 42 01             	lea    0x1(%edx),%eax
+ 37e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 381:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 384:	8d 48 01             	lea    0x1(%eax),%ecx
+ 387:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 38a:	0f b6 12             	movzbl (%edx),%edx
+ 38d:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 38f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 392:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 395:	89 55 10             	mov    %edx,0x10(%ebp)
+ 398:	85 c0                	test   %eax,%eax
+ 39a:	7f dc                	jg     378 <memmove+0x14>
+  return vdst;
+ 39c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 39f:	c9                   	leave
+ 3a0:	c3                   	ret
+
+000003a1 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 3a1:	55                   	push   %ebp
+ 3a2:	89 e5                	mov    %esp,%ebp
+ 3a4:	57                   	push   %edi
+ 3a5:	56                   	push   %esi
+ 3a6:	83 ec 30             	sub    $0x30,%esp
+ 3a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3af:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3b2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 3b5:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 3bc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 3c3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3c6:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3c9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 3cc:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 3cf:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 3d6:	e9 89 00 00 00       	jmp    464 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 3db:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3de:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3e1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 3e5:	01 c0                	add    %eax,%eax
+ 3e7:	89 c6                	mov    %eax,%esi
+ 3e9:	89 d7                	mov    %edx,%edi
+ 3eb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3ee:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 3f1:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 3f4:	0f ad d0             	shrd   %cl,%edx,%eax
+ 3f7:	d3 ea                	shr    %cl,%edx
+ 3f9:	f6 c1 20             	test   $0x20,%cl
+ 3fc:	74 04                	je     402 <udiv64+0x61>
+ 3fe:	89 d0                	mov    %edx,%eax
+ 400:	31 d2                	xor    %edx,%edx
+ 402:	83 e0 01             	and    $0x1,%eax
+ 405:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 408:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 40f:	89 f0                	mov    %esi,%eax
+ 411:	89 fa                	mov    %edi,%edx
+ 413:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 416:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 419:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 41c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 41f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 422:	ba 00 00 00 00       	mov    $0x0,%edx
+ 427:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 42a:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 42d:	19 d1                	sbb    %edx,%ecx
+ 42f:	72 2f                	jb     460 <udiv64+0xbf>
+      r -= d;
+ 431:	8b 45 10             	mov    0x10(%ebp),%eax
+ 434:	ba 00 00 00 00       	mov    $0x0,%edx
+ 439:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 43c:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 43f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 442:	b8 01 00 00 00       	mov    $0x1,%eax
+ 447:	ba 00 00 00 00       	mov    $0x0,%edx
+ 44c:	0f a5 c2             	shld   %cl,%eax,%edx
+ 44f:	d3 e0                	shl    %cl,%eax
+ 451:	f6 c1 20             	test   $0x20,%cl
+ 454:	74 04                	je     45a <udiv64+0xb9>
+ 456:	89 c2                	mov    %eax,%edx
+ 458:	31 c0                	xor    %eax,%eax
+ 45a:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 45d:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 460:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 464:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 468:	0f 89 6d ff ff ff    	jns    3db <udiv64+0x3a>
+    }
+  }
+  return q;
+ 46e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 471:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 474:	83 c4 30             	add    $0x30,%esp
+ 477:	5e                   	pop    %esi
+ 478:	5f                   	pop    %edi
+ 479:	5d                   	pop    %ebp
+ 47a:	c3                   	ret
+
+0000047b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 47b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <exit>:
+SYSCALL(exit)
+ 483:	b8 02 00 00 00       	mov    $0x2,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <wait>:
+SYSCALL(wait)
+ 48b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <pipe>:
+SYSCALL(pipe)
+ 493:	b8 04 00 00 00       	mov    $0x4,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <read>:
+SYSCALL(read)
+ 49b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <write>:
+SYSCALL(write)
+ 4a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <close>:
+SYSCALL(close)
+ 4ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <kill>:
+SYSCALL(kill)
+ 4b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <exec>:
+SYSCALL(exec)
+ 4bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <open>:
+SYSCALL(open)
+ 4c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <mknod>:
+SYSCALL(mknod)
+ 4cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <unlink>:
+SYSCALL(unlink)
+ 4d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <fstat>:
+SYSCALL(fstat)
+ 4db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <link>:
+SYSCALL(link)
+ 4e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <mkdir>:
+SYSCALL(mkdir)
+ 4eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <chdir>:
+SYSCALL(chdir)
+ 4f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <dup>:
+SYSCALL(dup)
+ 4fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <getpid>:
+SYSCALL(getpid)
+ 503:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <sbrk>:
+SYSCALL(sbrk)
+ 50b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <sleep>:
+SYSCALL(sleep)
+ 513:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <uptime>:
+SYSCALL(uptime)
+ 51b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 523:	b8 16 00 00 00       	mov    $0x16,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 52b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 533:	b8 18 00 00 00       	mov    $0x18,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <copy_file>:
+SYSCALL(copy_file)
+ 53b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <change_queue>:
+SYSCALL(change_queue)
+ 543:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 54b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 553:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <print_process_info>:
+SYSCALL(print_process_info)
+ 55b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 563:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 56b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 573:	b8 20 00 00 00       	mov    $0x20,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 57b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 583:	b8 22 00 00 00       	mov    $0x22,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 58b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 593:	b8 24 00 00 00       	mov    $0x24,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 59b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <set_affinity>:
+SYSCALL(set_affinity)
+ 5a3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <setsched>:
+SYSCALL(setsched)
+ 5ab:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 5b3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <set_quantum>:
+SYSCALL(set_quantum)
+ 5bb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <schedtrace>:
+SYSCALL(schedtrace)
+ 5c3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <getrusage>:
+SYSCALL(getrusage)
+ 5cb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 5d3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 5db:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 5e3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <futex_wait>:
+SYSCALL(futex_wait)
+ 5eb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <futex_wake>:
+SYSCALL(futex_wake)
+ 5f3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <syscall_latency>:
+SYSCALL(syscall_latency)
+ 5fb:	b8 31 00 00 00       	mov    $0x31,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <submit_batch>:
+SYSCALL(submit_batch)
+ 603:	b8 32 00 00 00       	mov    $0x32,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <kmem_stats>:
+SYSCALL(kmem_stats)
+ 60b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 613:	b8 34 00 00 00       	mov    $0x34,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 61b:	55                   	push   %ebp
+ 61c:	89 e5                	mov    %esp,%ebp
+ 61e:	83 ec 18             	sub    $0x18,%esp
+ 621:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 624:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 627:	83 ec 04             	sub    $0x4,%esp
+ 62a:	6a 01                	push   $0x1
+ 62c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 62f:	50                   	push   %eax
+ 630:	ff 75 08             	push   0x8(%ebp)
+ 633:	e8 6b fe ff ff       	call   4a3 <write>
+ 638:	83 c4 10             	add    $0x10,%esp
+}
+ 63b:	90                   	nop
+ 63c:	c9                   	leave
+ 63d:	c3                   	ret
+
+0000063e <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 63e:	55                   	push   %ebp
+ 63f:	89 e5                	mov    %esp,%ebp
+ 641:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 644:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 64b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 64f:	74 17                	je     668 <printint+0x2a>
+ 651:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 655:	79 11                	jns    668 <printint+0x2a>
+    neg = 1;
+ 657:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 65e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 661:	f7 d8                	neg    %eax
+ 663:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 666:	eb 06                	jmp    66e <printint+0x30>
+  } else {
+    x = xx;
+ 668:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 66b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 66e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 675:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 678:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 67b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 680:	f7 f1                	div    %ecx
+ 682:	89 d1                	mov    %edx,%ecx
+ 684:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 687:	8d 50 01             	lea    0x1(%eax),%edx
+ 68a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 68d:	0f b6 91 10 11 00 00 	movzbl 0x1110(%ecx),%edx
+ 694:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 698:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 69b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 69e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6a3:	f7 f1                	div    %ecx
+ 6a5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6a8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6ac:	75 c7                	jne    675 <printint+0x37>
+  if(neg)
+ 6ae:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6b2:	74 2d                	je     6e1 <printint+0xa3>
+    buf[i++] = '-';
+ 6b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6b7:	8d 50 01             	lea    0x1(%eax),%edx
+ 6ba:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6bd:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 6c2:	eb 1d                	jmp    6e1 <printint+0xa3>
+    putc(fd, buf[i]);
+ 6c4:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6ca:	01 d0                	add    %edx,%eax
+ 6cc:	0f b6 00             	movzbl (%eax),%eax
+ 6cf:	0f be c0             	movsbl %al,%eax
+ 6d2:	83 ec 08             	sub    $0x8,%esp
+ 6d5:	50                   	push   %eax
+ 6d6:	ff 75 08             	push   0x8(%ebp)
+ 6d9:	e8 3d ff ff ff       	call   61b <putc>
+ 6de:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 6e1:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 6e5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6e9:	79 d9                	jns    6c4 <printint+0x86>
+}
+ 6eb:	90                   	nop
+ 6ec:	90                   	nop
+ 6ed:	c9                   	leave
+ 6ee:	c3                   	ret
+
+000006ef <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6ef:	55                   	push   %ebp
+ 6f0:	89 e5                	mov    %esp,%ebp
+ 6f2:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 6f5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6fc:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6ff:	83 c0 04             	add    $0x4,%eax
+ 702:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 705:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 70c:	e9 59 01 00 00       	jmp    86a <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 711:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 714:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 717:	01 d0                	add    %edx,%eax
+ 719:	0f b6 00             	movzbl (%eax),%eax
+ 71c:	0f be c0             	movsbl %al,%eax
+ 71f:	25 ff 00 00 00       	and    $0xff,%eax
+ 724:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 727:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 72b:	75 2c                	jne    759 <printf+0x6a>
+      if(c == '%'){
+ 72d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 731:	75 0c                	jne    73f <printf+0x50>
+        state = '%';
+ 733:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 73a:	e9 27 01 00 00       	jmp    866 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 73f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 742:	0f be c0             	movsbl %al,%eax
+ 745:	83 ec 08             	sub    $0x8,%esp
+ 748:	50                   	push   %eax
+ 749:	ff 75 08             	push   0x8(%ebp)
+ 74c:	e8 ca fe ff ff       	call   61b <putc>
+ 751:	83 c4 10             	add    $0x10,%esp
+ 754:	e9 0d 01 00 00       	jmp    866 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 759:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 75d:	0f 85 03 01 00 00    	jne    866 <printf+0x177>
+      if(c == 'd'){
+ 763:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 767:	75 1e                	jne    787 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 769:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 76c:	8b 00                	mov    (%eax),%eax
+ 76e:	6a 01                	push   $0x1
+ 770:	6a 0a                	push   $0xa
+ 772:	50                   	push   %eax
+ 773:	ff 75 08             	push   0x8(%ebp)
+ 776:	e8 c3 fe ff ff       	call   63e <printint>
+ 77b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 77e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 782:	e9 d8 00 00 00       	jmp    85f <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 787:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 78b:	74 06                	je     793 <printf+0xa4>
+ 78d:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 791:	75 1e                	jne    7b1 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 793:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 796:	8b 00                	mov    (%eax),%eax
+ 798:	6a 00                	push   $0x0
+ 79a:	6a 10                	push   $0x10
+ 79c:	50                   	push   %eax
+ 79d:	ff 75 08             	push   0x8(%ebp)
+ 7a0:	e8 99 fe ff ff       	call   63e <printint>
+ 7a5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7a8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7ac:	e9 ae 00 00 00       	jmp    85f <printf+0x170>
+      } else if(c == 's'){
+ 7b1:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7b5:	75 43                	jne    7fa <printf+0x10b>
+        s = (char*)*ap;
+ 7b7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7ba:	8b 00                	mov    (%eax),%eax
+ 7bc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 7bf:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 7c3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7c7:	75 25                	jne    7ee <printf+0xff>
+          s = "(null)";
+ 7c9:	c7 45 f4 1b 0d 00 00 	movl   $0xd1b,-0xc(%ebp)
+        while(*s != 0){
+ 7d0:	eb 1c                	jmp    7ee <printf+0xff>
+          putc(fd, *s);
+ 7d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d5:	0f b6 00             	movzbl (%eax),%eax
+ 7d8:	0f be c0             	movsbl %al,%eax
+ 7db:	83 ec 08             	sub    $0x8,%esp
+ 7de:	50                   	push   %eax
+ 7df:	ff 75 08             	push   0x8(%ebp)
+ 7e2:	e8 34 fe ff ff       	call   61b <putc>
+ 7e7:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 7ea:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 7ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7f1:	0f b6 00             	movzbl (%eax),%eax
+ 7f4:	84 c0                	test   %al,%al
+ 7f6:	75 da                	jne    7d2 <printf+0xe3>
+ 7f8:	eb 65                	jmp    85f <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 7fa:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 7fe:	75 1d                	jne    81d <printf+0x12e>
+        putc(fd, *ap);
+ 800:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 803:	8b 00                	mov    (%eax),%eax
+ 805:	0f be c0             	movsbl %al,%eax
+ 808:	83 ec 08             	sub    $0x8,%esp
+ 80b:	50                   	push   %eax
+ 80c:	ff 75 08             	push   0x8(%ebp)
+ 80f:	e8 07 fe ff ff       	call   61b <putc>
+ 814:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 817:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 81b:	eb 42                	jmp    85f <printf+0x170>
+      } else if(c == '%'){
+ 81d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 821:	75 17                	jne    83a <printf+0x14b>
+        putc(fd, c);
+ 823:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 826:	0f be c0             	movsbl %al,%eax
+ 829:	83 ec 08             	sub    $0x8,%esp
+ 82c:	50                   	push   %eax
+ 82d:	ff 75 08             	push   0x8(%ebp)
+ 830:	e8 e6 fd ff ff       	call   61b <putc>
+ 835:	83 c4 10             	add    $0x10,%esp
+ 838:	eb 25                	jmp    85f <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 83a:	83 ec 08             	sub    $0x8,%esp
+ 83d:	6a 25                	push   $0x25
+ 83f:	ff 75 08             	push   0x8(%ebp)
+ 842:	e8 d4 fd ff ff       	call   61b <putc>
+ 847:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 84a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 84d:	0f be c0             	movsbl %al,%eax
+ 850:	83 ec 08             	sub    $0x8,%esp
+ 853:	50                   	push   %eax
+ 854:	ff 75 08             	push   0x8(%ebp)
+ 857:	e8 bf fd ff ff       	call   61b <putc>
+ 85c:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 85f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 866:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 86a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 86d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 870:	01 d0                	add    %edx,%eax
+ 872:	0f b6 00             	movzbl (%eax),%eax
+ 875:	84 c0                	test   %al,%al
+ 877:	0f 85 94 fe ff ff    	jne    711 <printf+0x22>
+    }
+  }
+}
+ 87d:	90                   	nop
+ 87e:	90                   	nop
+ 87f:	c9                   	leave
+ 880:	c3                   	ret
+
+00000881 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 881:	55                   	push   %ebp
+ 882:	89 e5                	mov    %esp,%ebp
+ 884:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 887:	8b 45 08             	mov    0x8(%ebp),%eax
+ 88a:	83 e8 08             	sub    $0x8,%eax
+ 88d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 890:	a1 2c 11 00 00       	mov    0x112c,%eax
+ 895:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 898:	eb 24                	jmp    8be <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 89a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89d:	8b 00                	mov    (%eax),%eax
+ 89f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8a2:	72 12                	jb     8b6 <free+0x35>
+ 8a4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8a7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8aa:	72 24                	jb     8d0 <free+0x4f>
+ 8ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8af:	8b 00                	mov    (%eax),%eax
+ 8b1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8b4:	72 1a                	jb     8d0 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b9:	8b 00                	mov    (%eax),%eax
+ 8bb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8be:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8c4:	73 d4                	jae    89a <free+0x19>
+ 8c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c9:	8b 00                	mov    (%eax),%eax
+ 8cb:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8ce:	73 ca                	jae    89a <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8d0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d3:	8b 40 04             	mov    0x4(%eax),%eax
+ 8d6:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8dd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e0:	01 c2                	add    %eax,%edx
+ 8e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e5:	8b 00                	mov    (%eax),%eax
+ 8e7:	39 c2                	cmp    %eax,%edx
+ 8e9:	75 24                	jne    90f <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 8eb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ee:	8b 50 04             	mov    0x4(%eax),%edx
+ 8f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f4:	8b 00                	mov    (%eax),%eax
+ 8f6:	8b 40 04             	mov    0x4(%eax),%eax
+ 8f9:	01 c2                	add    %eax,%edx
+ 8fb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8fe:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 901:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 904:	8b 00                	mov    (%eax),%eax
+ 906:	8b 10                	mov    (%eax),%edx
+ 908:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 90b:	89 10                	mov    %edx,(%eax)
+ 90d:	eb 0a                	jmp    919 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 90f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 912:	8b 10                	mov    (%eax),%edx
+ 914:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 917:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 919:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 91c:	8b 40 04             	mov    0x4(%eax),%eax
+ 91f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 926:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 929:	01 d0                	add    %edx,%eax
+ 92b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 92e:	75 20                	jne    950 <free+0xcf>
+    p->s.size += bp->s.size;
+ 930:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 933:	8b 50 04             	mov    0x4(%eax),%edx
+ 936:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 939:	8b 40 04             	mov    0x4(%eax),%eax
+ 93c:	01 c2                	add    %eax,%edx
+ 93e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 941:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 944:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 947:	8b 10                	mov    (%eax),%edx
+ 949:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 94c:	89 10                	mov    %edx,(%eax)
+ 94e:	eb 08                	jmp    958 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 950:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 953:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 956:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 958:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 95b:	a3 2c 11 00 00       	mov    %eax,0x112c
+}
+ 960:	90                   	nop
+ 961:	c9                   	leave
+ 962:	c3                   	ret
+
+00000963 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 963:	55                   	push   %ebp
+ 964:	89 e5                	mov    %esp,%ebp
+ 966:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 969:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 970:	77 07                	ja     979 <morecore+0x16>
+    nu = 4096;
+ 972:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 979:	8b 45 08             	mov    0x8(%ebp),%eax
+ 97c:	c1 e0 03             	shl    $0x3,%eax
+ 97f:	83 ec 0c             	sub    $0xc,%esp
+ 982:	50                   	push   %eax
+ 983:	e8 83 fb ff ff       	call   50b <sbrk>
+ 988:	83 c4 10             	add    $0x10,%esp
+ 98b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 98e:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 992:	75 07                	jne    99b <morecore+0x38>
+    return 0;
+ 994:	b8 00 00 00 00       	mov    $0x0,%eax
+ 999:	eb 26                	jmp    9c1 <morecore+0x5e>
+  hp = (Header*)p;
+ 99b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 9a1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9a7:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9aa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9ad:	83 c0 08             	add    $0x8,%eax
+ 9b0:	83 ec 0c             	sub    $0xc,%esp
+ 9b3:	50                   	push   %eax
+ 9b4:	e8 c8 fe ff ff       	call   881 <free>
+ 9b9:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 9bc:	a1 2c 11 00 00       	mov    0x112c,%eax
+}
+ 9c1:	c9                   	leave
+ 9c2:	c3                   	ret
+
+000009c3 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9c3:	55                   	push   %ebp
+ 9c4:	89 e5                	mov    %esp,%ebp
+ 9c6:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9cc:	83 c0 07             	add    $0x7,%eax
+ 9cf:	c1 e8 03             	shr    $0x3,%eax
+ 9d2:	83 c0 01             	add    $0x1,%eax
+ 9d5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 9d8:	a1 2c 11 00 00       	mov    0x112c,%eax
+ 9dd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9e0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9e4:	75 23                	jne    a09 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 9e6:	c7 45 f0 24 11 00 00 	movl   $0x1124,-0x10(%ebp)
+ 9ed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9f0:	a3 2c 11 00 00       	mov    %eax,0x112c
+ 9f5:	a1 2c 11 00 00       	mov    0x112c,%eax
+ 9fa:	a3 24 11 00 00       	mov    %eax,0x1124
+    base.s.size = 0;
+ 9ff:	c7 05 28 11 00 00 00 	movl   $0x0,0x1128
+ a06:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a09:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a0c:	8b 00                	mov    (%eax),%eax
+ a0e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a14:	8b 40 04             	mov    0x4(%eax),%eax
+ a17:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a1a:	72 4d                	jb     a69 <malloc+0xa6>
+      if(p->s.size == nunits)
+ a1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a1f:	8b 40 04             	mov    0x4(%eax),%eax
+ a22:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a25:	75 0c                	jne    a33 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a2a:	8b 10                	mov    (%eax),%edx
+ a2c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a2f:	89 10                	mov    %edx,(%eax)
+ a31:	eb 26                	jmp    a59 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a36:	8b 40 04             	mov    0x4(%eax),%eax
+ a39:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a3c:	89 c2                	mov    %eax,%edx
+ a3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a41:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a47:	8b 40 04             	mov    0x4(%eax),%eax
+ a4a:	c1 e0 03             	shl    $0x3,%eax
+ a4d:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a53:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a56:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a59:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a5c:	a3 2c 11 00 00       	mov    %eax,0x112c
+      return (void*)(p + 1);
+ a61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a64:	83 c0 08             	add    $0x8,%eax
+ a67:	eb 3b                	jmp    aa4 <malloc+0xe1>
+    }
+    if(p == freep)
+ a69:	a1 2c 11 00 00       	mov    0x112c,%eax
+ a6e:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a71:	75 1e                	jne    a91 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a73:	83 ec 0c             	sub    $0xc,%esp
+ a76:	ff 75 ec             	push   -0x14(%ebp)
+ a79:	e8 e5 fe ff ff       	call   963 <morecore>
+ a7e:	83 c4 10             	add    $0x10,%esp
+ a81:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a84:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a88:	75 07                	jne    a91 <malloc+0xce>
+        return 0;
+ a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+ a8f:	eb 13                	jmp    aa4 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a94:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a9a:	8b 00                	mov    (%eax),%eax
+ a9c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a9f:	e9 6d ff ff ff       	jmp    a11 <malloc+0x4e>
+  }
+}
+ aa4:	c9                   	leave
+ aa5:	c3                   	ret
+
+00000aa6 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ aa6:	55                   	push   %ebp
+ aa7:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ aa9:	8b 45 08             	mov    0x8(%ebp),%eax
+ aac:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ ab2:	90                   	nop
+ ab3:	5d                   	pop    %ebp
+ ab4:	c3                   	ret
+
+00000ab5 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ ab5:	55                   	push   %ebp
+ ab6:	89 e5                	mov    %esp,%ebp
+ ab8:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ abb:	8b 55 08             	mov    0x8(%ebp),%edx
+ abe:	b8 00 00 00 00       	mov    $0x0,%eax
+ ac3:	b9 01 00 00 00       	mov    $0x1,%ecx
+ ac8:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ acc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ acf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ad3:	74 3b                	je     b10 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ ad5:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ ad9:	74 2d                	je     b08 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ adb:	8b 55 08             	mov    0x8(%ebp),%edx
+ ade:	b8 02 00 00 00       	mov    $0x2,%eax
+ ae3:	87 02                	xchg   %eax,(%edx)
+ ae5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ ae8:	eb 1e                	jmp    b08 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ aea:	8b 45 08             	mov    0x8(%ebp),%eax
+ aed:	83 ec 08             	sub    $0x8,%esp
+ af0:	6a 02                	push   $0x2
+ af2:	50                   	push   %eax
+ af3:	e8 f3 fa ff ff       	call   5eb <futex_wait>
+ af8:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ afb:	8b 55 08             	mov    0x8(%ebp),%edx
+ afe:	b8 02 00 00 00       	mov    $0x2,%eax
+ b03:	87 02                	xchg   %eax,(%edx)
+ b05:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b08:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b0c:	75 dc                	jne    aea <mutex_lock+0x35>
+ b0e:	eb 01                	jmp    b11 <mutex_lock+0x5c>
+    return;
+ b10:	90                   	nop
+  }
+}
+ b11:	c9                   	leave
+ b12:	c3                   	ret
+
+00000b13 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ b13:	55                   	push   %ebp
+ b14:	89 e5                	mov    %esp,%ebp
+ b16:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ b19:	8b 45 08             	mov    0x8(%ebp),%eax
+ b1c:	ba 01 00 00 00       	mov    $0x1,%edx
+ b21:	f7 da                	neg    %edx
+ b23:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ b27:	83 fa 01             	cmp    $0x1,%edx
+ b2a:	74 1a                	je     b46 <mutex_unlock+0x33>
+    m->state = 0;
+ b2c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b2f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ b35:	8b 45 08             	mov    0x8(%ebp),%eax
+ b38:	83 ec 08             	sub    $0x8,%esp
+ b3b:	6a 01                	push   $0x1
+ b3d:	50                   	push   %eax
+ b3e:	e8 b0 fa ff ff       	call   5f3 <futex_wake>
+ b43:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ b46:	90                   	nop
+ b47:	c9                   	leave
+ b48:	c3                   	ret
+
+00000b49 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ b49:	55                   	push   %ebp
+ b4a:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ b4c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b4f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ b55:	8b 45 08             	mov    0x8(%ebp),%eax
+ b58:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ b5f:	90                   	nop
+ b60:	5d                   	pop    %ebp
+ b61:	c3                   	ret
+
+00000b62 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ b62:	55                   	push   %ebp
+ b63:	89 e5                	mov    %esp,%ebp
+ b65:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ b68:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6b:	83 c0 04             	add    $0x4,%eax
+ b6e:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ b72:	8b 45 08             	mov    0x8(%ebp),%eax
+ b75:	83 ec 08             	sub    $0x8,%esp
+ b78:	ff 75 0c             	push   0xc(%ebp)
+ b7b:	50                   	push   %eax
+ b7c:	e8 6a fa ff ff       	call   5eb <futex_wait>
+ b81:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ b84:	8b 45 08             	mov    0x8(%ebp),%eax
+ b87:	83 c0 04             	add    $0x4,%eax
+ b8a:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ b8e:	90                   	nop
+ b8f:	c9                   	leave
+ b90:	c3                   	ret
+
+00000b91 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ b91:	55                   	push   %ebp
+ b92:	89 e5                	mov    %esp,%ebp
+ b94:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ b97:	8b 45 08             	mov    0x8(%ebp),%eax
+ b9a:	8b 00                	mov    (%eax),%eax
+ b9c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ b9f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ba3:	78 17                	js     bbc <rwlock_rdlock+0x2b>
+ ba5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba8:	83 c0 01             	add    $0x1,%eax
+ bab:	89 c1                	mov    %eax,%ecx
+ bad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bb0:	8b 55 08             	mov    0x8(%ebp),%edx
+ bb3:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ bb7:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ bba:	74 19                	je     bd5 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ bbc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bc0:	79 d5                	jns    b97 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ bc2:	83 ec 08             	sub    $0x8,%esp
+ bc5:	ff 75 f4             	push   -0xc(%ebp)
+ bc8:	ff 75 08             	push   0x8(%ebp)
+ bcb:	e8 92 ff ff ff       	call   b62 <rwlock_sleep>
+ bd0:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ bd3:	eb c2                	jmp    b97 <rwlock_rdlock+0x6>
+      return;
+ bd5:	90                   	nop
+  }
+}
+ bd6:	c9                   	leave
+ bd7:	c3                   	ret
+
+00000bd8 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ bd8:	55                   	push   %ebp
+ bd9:	89 e5                	mov    %esp,%ebp
+ bdb:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ bde:	eb 11                	jmp    bf1 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ be0:	83 ec 08             	sub    $0x8,%esp
+ be3:	ff 75 f4             	push   -0xc(%ebp)
+ be6:	ff 75 08             	push   0x8(%ebp)
+ be9:	e8 74 ff ff ff       	call   b62 <rwlock_sleep>
+ bee:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ bf1:	8b 55 08             	mov    0x8(%ebp),%edx
+ bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+ bf9:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ bfe:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c02:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c05:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c09:	75 d5                	jne    be0 <rwlock_wrlock+0x8>
+}
+ c0b:	90                   	nop
+ c0c:	90                   	nop
+ c0d:	c9                   	leave
+ c0e:	c3                   	ret
+
+00000c0f <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ c0f:	55                   	push   %ebp
+ c10:	89 e5                	mov    %esp,%ebp
+ c12:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ c15:	8b 45 08             	mov    0x8(%ebp),%eax
+ c18:	8b 00                	mov    (%eax),%eax
+ c1a:	85 c0                	test   %eax,%eax
+ c1c:	79 0c                	jns    c2a <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ c1e:	8b 45 08             	mov    0x8(%ebp),%eax
+ c21:	ba 00 00 00 00       	mov    $0x0,%edx
+ c26:	87 10                	xchg   %edx,(%eax)
+ c28:	eb 18                	jmp    c42 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ c2a:	8b 55 08             	mov    0x8(%ebp),%edx
+ c2d:	b8 01 00 00 00       	mov    $0x1,%eax
+ c32:	f7 d8                	neg    %eax
+ c34:	89 c1                	mov    %eax,%ecx
+ c36:	89 c8                	mov    %ecx,%eax
+ c38:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ c3c:	01 c8                	add    %ecx,%eax
+ c3e:	85 c0                	test   %eax,%eax
+ c40:	75 20                	jne    c62 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ c42:	8b 45 08             	mov    0x8(%ebp),%eax
+ c45:	8b 40 04             	mov    0x4(%eax),%eax
+ c48:	85 c0                	test   %eax,%eax
+ c4a:	74 17                	je     c63 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ c4c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c4f:	83 ec 08             	sub    $0x8,%esp
+ c52:	68 ff ff ff 7f       	push   $0x7fffffff
+ c57:	50                   	push   %eax
+ c58:	e8 96 f9 ff ff       	call   5f3 <futex_wake>
+ c5d:	83 c4 10             	add    $0x10,%esp
+ c60:	eb 01                	jmp    c63 <rwlock_unlock+0x54>
+    return;
+ c62:	90                   	nop
+}
+ c63:	c9                   	leave
+ c64:	c3                   	ret
+
+00000c65 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ c65:	55                   	push   %ebp
+ c66:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ c68:	8b 45 08             	mov    0x8(%ebp),%eax
+ c6b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c71:	90                   	nop
+ c72:	5d                   	pop    %ebp
+ c73:	c3                   	ret
+
+00000c74 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ c74:	55                   	push   %ebp
+ c75:	89 e5                	mov    %esp,%ebp
+ c77:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ c7a:	8b 45 08             	mov    0x8(%ebp),%eax
+ c7d:	8b 00                	mov    (%eax),%eax
+ c7f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ c82:	83 ec 0c             	sub    $0xc,%esp
+ c85:	ff 75 0c             	push   0xc(%ebp)
+ c88:	e8 86 fe ff ff       	call   b13 <mutex_unlock>
+ c8d:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ c90:	8b 45 08             	mov    0x8(%ebp),%eax
+ c93:	83 ec 08             	sub    $0x8,%esp
+ c96:	ff 75 f4             	push   -0xc(%ebp)
+ c99:	50                   	push   %eax
+ c9a:	e8 4c f9 ff ff       	call   5eb <futex_wait>
+ c9f:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ ca2:	83 ec 0c             	sub    $0xc,%esp
+ ca5:	ff 75 0c             	push   0xc(%ebp)
+ ca8:	e8 08 fe ff ff       	call   ab5 <mutex_lock>
+ cad:	83 c4 10             	add    $0x10,%esp
+}
+ cb0:	90                   	nop
+ cb1:	c9                   	leave
+ cb2:	c3                   	ret
+
+00000cb3 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ cb3:	55                   	push   %ebp
+ cb4:	89 e5                	mov    %esp,%ebp
+ cb6:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+ cbc:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ cc0:	8b 45 08             	mov    0x8(%ebp),%eax
+ cc3:	83 ec 08             	sub    $0x8,%esp
+ cc6:	6a 01                	push   $0x1
+ cc8:	50                   	push   %eax
+ cc9:	e8 25 f9 ff ff       	call   5f3 <futex_wake>
+ cce:	83 c4 10             	add    $0x10,%esp
+}
+ cd1:	90                   	nop
+ cd2:	c9                   	leave
+ cd3:	c3                   	ret
+
+00000cd4 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ cd4:	55                   	push   %ebp
+ cd5:	89 e5                	mov    %esp,%ebp
+ cd7:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ cda:	8b 45 08             	mov    0x8(%ebp),%eax
+ cdd:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ ce1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce4:	83 ec 08             	sub    $0x8,%esp
+ ce7:	68 ff ff ff 7f       	push   $0x7fffffff
+ cec:	50                   	push   %eax
+ ced:	e8 01 f9 ff ff       	call   5f3 <futex_wake>
+ cf2:	83 c4 10             	add    $0x10,%esp
+}
+ cf5:	90                   	nop
+ cf6:	c9                   	leave
+ cf7:	c3                   	ret
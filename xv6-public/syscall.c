@@ -6,6 +6,7 @@
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "batch.h"
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
@@ -20,17 +21,9 @@ int fetchint(uint addr, int *ip)
 
   if (addr >= curproc->sz || addr + 4 > curproc->sz)
     return -1;
-  *ip = *(int *)(addr);
-  return 0;
-}
-
-int fetchfloat(uint addr, float *fp)
-{
-  struct proc *curproc = myproc();
-
-  if (addr >= curproc->sz || addr + 4 > curproc->sz)
+  if (uvmprefault(curproc, addr, 4, 0) < 0)
     return -1;
-  *fp = *(float *)(addr);
+  *ip = *(int *)(addr);
   return 0;
 }
 
@@ -48,6 +41,8 @@ int fetchstr(uint addr, char **pp)
   ep = (char *)curproc->sz;
   for (s = *pp; s < ep; s++)
   {
+    if ((s == *pp || (uint)s % PGSIZE == 0) && uvmprefault(curproc, (uint)s, 1, 0) < 0)
+      return -1;
     if (*s == 0)
       return s - *pp;
   }
@@ -60,9 +55,32 @@ int argint(int n, int *ip)
   return fetchint((myproc()->tf->esp) + 4 + 4 * n, ip);
 }
 
-int argfloat(int n, float *fp)
+// Fetch the nth system call argument, passed by the user as a
+// float, as a BJF fixed-point number. The IEEE-754 bits are decoded
+// with integer arithmetic so the kernel never touches the FPU.
+// Magnitudes too large for the fixed-point range saturate.
+int argfixed(int n, int *fp)
 {
-  return fetchfloat((myproc()->tf->esp) + 4 + 4 * n, fp);
+  int bits, exp, shift, fixed;
+  uint mant;
+
+  if (argint(n, &bits) < 0)
+    return -1;
+  exp = (bits >> 23) & 0xff;
+  mant = (bits & 0x7fffff) | 0x800000;
+  if (exp == 0xff)
+    return -1; // infinity or NaN
+  shift = exp - 127 - 23 + BJF_FIX_SHIFT;
+  if (exp == 0 || shift <= -24)
+    fixed = 0; // zero, denormal, or below the fixed-point resolution
+  else if (shift < 0)
+    fixed = mant >> -shift;
+  else if (shift < 8)
+    fixed = mant << shift;
+  else
+    fixed = 0x7fffffff;
+  *fp = bits < 0 ? -fixed : fixed;
+  return 0;
 }
 
 // Fetch the nth word-sized system call argument as a pointer
@@ -75,7 +93,16 @@ int argptr(int n, char **pp, int size)
 
   if (argint(n, &i) < 0)
     return -1;
-  if (size < 0 || (uint)i >= curproc->sz || (uint)i + size > curproc->sz)
+  if (size < 0)
+    return -1;
+  // Buffers in shared memory are fine too, so I/O can go straight
+  // to and from a region. Pages not backed yet are backed here,
+  // heap and shared memory alike, and copy-on-write ones copied,
+  // since the handler may write; see uvmprefault().
+  if (((uint)i >= curproc->sz || (uint)i + size > curproc->sz) &&
+      !shm_mapped(curproc, i, size ? size : 1))
+    return -1;
+  if (uvmprefault(curproc, i, size, 1) < 0)
     return -1;
   *pp = (char *)i;
   return 0;
@@ -83,8 +110,9 @@ int argptr(int n, char **pp, int size)
 
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// (fetchstr() only accepts strings below sz, never in a shared
+// memory region, so no other process can change the string
+// between this check and its use by the kernel.)
 int argstr(int n, char **pp)
 {
   int addr;
@@ -130,6 +158,21 @@ extern int sys_print_syscall_count(void);
 extern int sys_reset_syscall_count(void);
 extern void *sys_open_sharedmem(void);
 extern int sys_close_sharedmem(void);
+extern int sys_set_affinity(void);
+extern int sys_setsched(void);
+extern int sys_get_idle_cycles(void);
+extern int sys_set_quantum(void);
+extern int sys_schedtrace(void);
+extern int sys_getrusage(void);
+extern int sys_create_prioritylock(void);
+extern int sys_destroy_prioritylock(void);
+extern int sys_prioritylock_stats(void);
+extern int sys_futex_wait(void);
+extern int sys_futex_wake(void);
+extern int sys_syscall_latency(void);
+extern int sys_submit_batch(void);
+extern int sys_kmem_stats(void);
+extern int sys_kmem_junk(void);
 
 static int (*syscalls[])(void) = {
     [SYS_fork] sys_fork,
@@ -169,24 +212,158 @@ static int (*syscalls[])(void) = {
     [SYS_reset_syscall_count] sys_reset_syscall_count,
     [SYS_open_sharedmem] sys_open_sharedmem,
     [SYS_close_sharedmem] sys_close_sharedmem,
+    [SYS_set_affinity] sys_set_affinity,
+    [SYS_setsched] sys_setsched,
+    [SYS_get_idle_cycles] sys_get_idle_cycles,
+    [SYS_set_quantum] sys_set_quantum,
+    [SYS_schedtrace] sys_schedtrace,
+    [SYS_getrusage] sys_getrusage,
+    [SYS_create_prioritylock] sys_create_prioritylock,
+    [SYS_destroy_prioritylock] sys_destroy_prioritylock,
+    [SYS_prioritylock_stats] sys_prioritylock_stats,
+    [SYS_futex_wait] sys_futex_wait,
+    [SYS_futex_wake] sys_futex_wake,
+    [SYS_syscall_latency] sys_syscall_latency,
+    [SYS_submit_batch] sys_submit_batch,
+    [SYS_kmem_stats] sys_kmem_stats,
+    [SYS_kmem_junk] sys_kmem_junk,
 };
 
-void syscall(void)
+struct syscallstat syscallstats[NCPU];
+
+// Count a call to num that took the given number of cycles in
+// the latency histogram of cpu, the CPU it finished on. Called
+// with interrupts off on that CPU, so plain adds are safe.
+static void record_latency(int cpu, int num, uint64 cycles)
+{
+  struct syslat *lat = &syscallstats[cpu].lat;
+  uint c = cycles > 0xffffffff ? 0xffffffff : cycles;
+
+  lat->hist[num][31 - __builtin_clz(c | 1)]++;
+  if (c > lat->max[num])
+    lat->max[num] = c;
+}
+
+// Sum the latency histograms of all CPUs into lat. lat may be
+// user memory that another process shares, so each sum is made
+// in a local and only stored, never read back.
+void syscall_latency(struct syslat *lat)
+{
+  uint sum, max;
+
+  for (int num = 0; num < NSYSCALL; num++)
+  {
+    for (int k = 0; k < NLATBUCKET; k++)
+    {
+      sum = 0;
+      for (int i = 0; i < ncpu; i++)
+        sum += syscallstats[i].lat.hist[num][k];
+      lat->hist[num][k] = sum;
+    }
+    max = 0;
+    for (int i = 0; i < ncpu; i++)
+      if (syscallstats[i].lat.max[num] > max)
+        max = syscallstats[i].lat.max[num];
+    lat->max[num] = max;
+  }
+}
+
+static int valid_syscall(int num)
+{
+  return num > 0 && num < NELEM(syscalls) && syscalls[num];
+}
+
+// Run system call num for the current process, counting and
+// timing it, and return its result.
+static int dispatch(struct proc *curproc, int num)
+{
+  uint64 start;
+  int result;
+
+  // With interrupts off we stay on this CPU, and only this CPU
+  // writes its counters, so no locked instruction is needed.
+  pushcli();
+  syscallstats[cpuid()].count[num]++;
+  popcli();
+  curproc->syscall_count++;
+  start = rdtsc();
+  result = syscalls[num]();
+  pushcli();
+  record_latency(cpuid(), num, rdtsc() - start);
+  popcli();
+  return result;
+}
+
+// Calls that may not run from a batch: they replace or copy the
+// trap frame submit_batch() is borrowing, never return, change
+// the address space the ring lives in, or would nest.
+static int batchable(int num)
+{
+  return valid_syscall(num) && num != SYS_fork && num != SYS_exit &&
+         num != SYS_exec && num != SYS_sbrk && num != SYS_submit_batch &&
+         num != SYS_open_sharedmem && num != SYS_close_sharedmem;
+}
+
+// Run the requests queued in a user batch_ring in this one kernel
+// entry, until the submission queue is empty or the completion
+// queue full. The handlers read their arguments with argint() and
+// friends as usual: tf->esp is pointed just below each request's
+// args, where a return address would sit for an int T_SYSCALL.
+// Returns the number of requests run.
+//
+// The ring must be in the process's own memory, not a shared
+// region another process could rewrite under us. Its indexes and
+// each request number are read once into locals, which are what
+// get checked and used; a request that writes over the ring can
+// only garble its own args and results.
+int sys_submit_batch(void)
 {
-  int num;
   struct proc *curproc = myproc();
+  struct batch_ring *r;
+  uint esp = curproc->tf->esp;
+  uint sq_head, sq_tail, cq_head, cq_tail;
+  int num, result, done = 0;
 
-  cli();
-  mycpu()->syscall_count++;
-  sti();
-  syscall_count_total++;
-  __sync_synchronize();
+  if (argptr(0, (char **)&r, sizeof(*r)) < 0 ||
+      (uint)r + sizeof(*r) > curproc->sz)
+    return -1;
 
-  num = curproc->tf->eax;
-  if (num > 0 && num < NELEM(syscalls) && syscalls[num])
+  sq_head = r->sq_head;
+  sq_tail = r->sq_tail;
+  cq_head = r->cq_head;
+  cq_tail = r->cq_tail;
+  if (sq_tail - sq_head > NBATCH || cq_tail - cq_head > NBATCH)
+    return -1;
+
+  while (sq_head != sq_tail && cq_tail - cq_head < NBATCH && !curproc->killed)
   {
-    curproc->tf->eax = syscalls[num]();
+    num = r->sq[sq_head % NBATCH].num;
+    if (batchable(num))
+    {
+      curproc->tf->esp = (uint)r->sq[sq_head % NBATCH].args - 4;
+      result = dispatch(curproc, num);
+      curproc->tf->esp = esp;
+    }
+    else
+      result = -1;
+    r->cq[cq_tail % NBATCH].result = result;
+    cq_tail++;
+    sq_head++;
+    done++;
   }
+  r->cq_tail = cq_tail;
+  r->sq_head = sq_head;
+  return done;
+}
+
+void syscall(void)
+{
+  int num;
+  struct proc *curproc = myproc();
+
+  num = curproc->tf->eax;
+  if (valid_syscall(num))
+    curproc->tf->eax = dispatch(curproc, num);
   else
   {
     cprintf("%d %s: unknown sys call %d\n",
@@ -36,3 +36,18 @@
 #define SYS_reset_syscall_count 35
 #define SYS_open_sharedmem 36
 #define SYS_close_sharedmem 37
+#define SYS_set_affinity 38
+#define SYS_setsched 39
+#define SYS_get_idle_cycles 40
+#define SYS_set_quantum 41
+#define SYS_schedtrace 42
+#define SYS_getrusage 43
+#define SYS_create_prioritylock 44
+#define SYS_destroy_prioritylock 45
+#define SYS_prioritylock_stats 46
+#define SYS_futex_wait 47
+#define SYS_futex_wake 48
+#define SYS_syscall_latency 49
+#define SYS_submit_batch 50
+#define SYS_kmem_stats 51
+#define SYS_kmem_junk 52
@@ -0,0 +1,2110 @@
+
+_syscall_count_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <strcat>:
+#include "fcntl.h"
+
+#define NUM_PROCESSES 4
+
+char *strcat(const char *str1, const char *str2)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 14             	sub    $0x14,%esp
+    int dest_len = strlen(str1) + strlen(str2);
+   7:	83 ec 0c             	sub    $0xc,%esp
+   a:	ff 75 08             	push   0x8(%ebp)
+   d:	e8 d5 03 00 00       	call   3e7 <strlen>
+  12:	83 c4 10             	add    $0x10,%esp
+  15:	89 c3                	mov    %eax,%ebx
+  17:	83 ec 0c             	sub    $0xc,%esp
+  1a:	ff 75 0c             	push   0xc(%ebp)
+  1d:	e8 c5 03 00 00       	call   3e7 <strlen>
+  22:	83 c4 10             	add    $0x10,%esp
+  25:	01 d8                	add    %ebx,%eax
+  27:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    int i;
+    int j = 0;
+  2a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    char *dest = (char *)malloc(dest_len + 1);
+  31:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  34:	83 c0 01             	add    $0x1,%eax
+  37:	83 ec 0c             	sub    $0xc,%esp
+  3a:	50                   	push   %eax
+  3b:	e8 83 0b 00 00       	call   bc3 <malloc>
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	89 45 e8             	mov    %eax,-0x18(%ebp)
+
+    for (i = 0; str1[i] != '\0'; i++)
+  46:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  4d:	eb 19                	jmp    68 <strcat+0x68>
+    {
+        dest[i] = str1[i];
+  4f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  52:	8b 45 08             	mov    0x8(%ebp),%eax
+  55:	01 d0                	add    %edx,%eax
+  57:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  5a:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  5d:	01 ca                	add    %ecx,%edx
+  5f:	0f b6 00             	movzbl (%eax),%eax
+  62:	88 02                	mov    %al,(%edx)
+    for (i = 0; str1[i] != '\0'; i++)
+  64:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  68:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  6e:	01 d0                	add    %edx,%eax
+  70:	0f b6 00             	movzbl (%eax),%eax
+  73:	84 c0                	test   %al,%al
+  75:	75 d8                	jne    4f <strcat+0x4f>
+    }
+
+    for (j = 0; str2[j] != '\0'; j++)
+  77:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  7e:	eb 1d                	jmp    9d <strcat+0x9d>
+    {
+        dest[i] = str2[j];
+  80:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  83:	8b 45 0c             	mov    0xc(%ebp),%eax
+  86:	01 d0                	add    %edx,%eax
+  88:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8b:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  8e:	01 ca                	add    %ecx,%edx
+  90:	0f b6 00             	movzbl (%eax),%eax
+  93:	88 02                	mov    %al,(%edx)
+        i++;
+  95:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    for (j = 0; str2[j] != '\0'; j++)
+  99:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  9d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a3:	01 d0                	add    %edx,%eax
+  a5:	0f b6 00             	movzbl (%eax),%eax
+  a8:	84 c0                	test   %al,%al
+  aa:	75 d4                	jne    80 <strcat+0x80>
+    }
+
+    dest[dest_len] = '\0';
+  ac:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  af:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  b2:	01 d0                	add    %edx,%eax
+  b4:	c6 00 00             	movb   $0x0,(%eax)
+
+    return dest;
+  b7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+}
+  ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  bd:	c9                   	leave
+  be:	c3                   	ret
+
+000000bf <itoa>:
+
+void itoa(int num, char *str)
+{
+  bf:	55                   	push   %ebp
+  c0:	89 e5                	mov    %esp,%ebp
+  c2:	83 ec 20             	sub    $0x20,%esp
+    int i = 0;
+  c5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    int is_negative = 0;
+  cc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+
+    if (num < 0)
+  d3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  d7:	79 0a                	jns    e3 <itoa+0x24>
+    {
+        is_negative = 1;
+  d9:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%ebp)
+        num = -num;
+  e0:	f7 5d 08             	negl   0x8(%ebp)
+    }
+
+    if (num == 0)
+  e3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  e7:	75 6c                	jne    155 <itoa+0x96>
+    {
+        str[i++] = '0';
+  e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  ec:	8d 50 01             	lea    0x1(%eax),%edx
+  ef:	89 55 fc             	mov    %edx,-0x4(%ebp)
+  f2:	89 c2                	mov    %eax,%edx
+  f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  f7:	01 d0                	add    %edx,%eax
+  f9:	c6 00 30             	movb   $0x30,(%eax)
+  fc:	eb 5d                	jmp    15b <itoa+0x9c>
+    }
+    else
+    {
+        while (num != 0)
+        {
+            str[i++] = '0' + (num % 10);
+  fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 101:	ba 67 66 66 66       	mov    $0x66666667,%edx
+ 106:	89 c8                	mov    %ecx,%eax
+ 108:	f7 ea                	imul   %edx
+ 10a:	c1 fa 02             	sar    $0x2,%edx
+ 10d:	89 c8                	mov    %ecx,%eax
+ 10f:	c1 f8 1f             	sar    $0x1f,%eax
+ 112:	29 c2                	sub    %eax,%edx
+ 114:	89 d0                	mov    %edx,%eax
+ 116:	c1 e0 02             	shl    $0x2,%eax
+ 119:	01 d0                	add    %edx,%eax
+ 11b:	01 c0                	add    %eax,%eax
+ 11d:	29 c1                	sub    %eax,%ecx
+ 11f:	89 ca                	mov    %ecx,%edx
+ 121:	89 d0                	mov    %edx,%eax
+ 123:	8d 48 30             	lea    0x30(%eax),%ecx
+ 126:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 129:	8d 50 01             	lea    0x1(%eax),%edx
+ 12c:	89 55 fc             	mov    %edx,-0x4(%ebp)
+ 12f:	89 c2                	mov    %eax,%edx
+ 131:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 134:	01 d0                	add    %edx,%eax
+ 136:	89 ca                	mov    %ecx,%edx
+ 138:	88 10                	mov    %dl,(%eax)
+            num /= 10;
+ 13a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 13d:	ba 67 66 66 66       	mov    $0x66666667,%edx
+ 142:	89 c8                	mov    %ecx,%eax
+ 144:	f7 ea                	imul   %edx
+ 146:	89 d0                	mov    %edx,%eax
+ 148:	c1 f8 02             	sar    $0x2,%eax
+ 14b:	c1 f9 1f             	sar    $0x1f,%ecx
+ 14e:	89 ca                	mov    %ecx,%edx
+ 150:	29 d0                	sub    %edx,%eax
+ 152:	89 45 08             	mov    %eax,0x8(%ebp)
+        while (num != 0)
+ 155:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 159:	75 a3                	jne    fe <itoa+0x3f>
+        }
+    }
+
+    if (is_negative)
+ 15b:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+ 15f:	74 13                	je     174 <itoa+0xb5>
+    {
+        str[i++] = '-';
+ 161:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 164:	8d 50 01             	lea    0x1(%eax),%edx
+ 167:	89 55 fc             	mov    %edx,-0x4(%ebp)
+ 16a:	89 c2                	mov    %eax,%edx
+ 16c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16f:	01 d0                	add    %edx,%eax
+ 171:	c6 00 2d             	movb   $0x2d,(%eax)
+    }
+    int j;
+    int len = i;
+ 174:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 177:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    for (j = 0; j < len / 2; j++)
+ 17a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 181:	eb 41                	jmp    1c4 <itoa+0x105>
+    {
+        char temp = str[j];
+ 183:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 186:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 189:	01 d0                	add    %edx,%eax
+ 18b:	0f b6 00             	movzbl (%eax),%eax
+ 18e:	88 45 ef             	mov    %al,-0x11(%ebp)
+        str[j] = str[len - j - 1];
+ 191:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 194:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 197:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 19a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 19d:	01 d0                	add    %edx,%eax
+ 19f:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+ 1a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1a5:	01 ca                	add    %ecx,%edx
+ 1a7:	0f b6 00             	movzbl (%eax),%eax
+ 1aa:	88 02                	mov    %al,(%edx)
+        str[len - j - 1] = temp;
+ 1ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1af:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 1b2:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 1b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1b8:	01 c2                	add    %eax,%edx
+ 1ba:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1be:	88 02                	mov    %al,(%edx)
+    for (j = 0; j < len / 2; j++)
+ 1c0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1c4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1c7:	89 c2                	mov    %eax,%edx
+ 1c9:	c1 ea 1f             	shr    $0x1f,%edx
+ 1cc:	01 d0                	add    %edx,%eax
+ 1ce:	d1 f8                	sar    %eax
+ 1d0:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 1d3:	7c ae                	jl     183 <itoa+0xc4>
+    }
+
+    str[i] = '\0';
+ 1d5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1db:	01 d0                	add    %edx,%eax
+ 1dd:	c6 00 00             	movb   $0x0,(%eax)
+}
+ 1e0:	90                   	nop
+ 1e1:	c9                   	leave
+ 1e2:	c3                   	ret
+
+000001e3 <write_text>:
+
+void write_text(const char *text)
+{
+ 1e3:	55                   	push   %ebp
+ 1e4:	89 e5                	mov    %esp,%ebp
+ 1e6:	83 ec 28             	sub    $0x28,%esp
+    char stringify_pid[20];
+    itoa(getpid(), stringify_pid);
+ 1e9:	e8 15 05 00 00       	call   703 <getpid>
+ 1ee:	83 ec 08             	sub    $0x8,%esp
+ 1f1:	8d 55 e0             	lea    -0x20(%ebp),%edx
+ 1f4:	52                   	push   %edx
+ 1f5:	50                   	push   %eax
+ 1f6:	e8 c4 fe ff ff       	call   bf <itoa>
+ 1fb:	83 c4 10             	add    $0x10,%esp
+    int fd = open(strcat(strcat("output", stringify_pid), ".txt"), O_WRONLY | O_CREATE);
+ 1fe:	83 ec 08             	sub    $0x8,%esp
+ 201:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 204:	50                   	push   %eax
+ 205:	68 f8 0e 00 00       	push   $0xef8
+ 20a:	e8 f1 fd ff ff       	call   0 <strcat>
+ 20f:	83 c4 10             	add    $0x10,%esp
+ 212:	83 ec 08             	sub    $0x8,%esp
+ 215:	68 ff 0e 00 00       	push   $0xeff
+ 21a:	50                   	push   %eax
+ 21b:	e8 e0 fd ff ff       	call   0 <strcat>
+ 220:	83 c4 10             	add    $0x10,%esp
+ 223:	83 ec 08             	sub    $0x8,%esp
+ 226:	68 01 02 00 00       	push   $0x201
+ 22b:	50                   	push   %eax
+ 22c:	e8 92 04 00 00       	call   6c3 <open>
+ 231:	83 c4 10             	add    $0x10,%esp
+ 234:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if (fd < 0)
+ 237:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 23b:	79 17                	jns    254 <write_text+0x71>
+    {
+        printf(2, "Failed to open file for writing\n");
+ 23d:	83 ec 08             	sub    $0x8,%esp
+ 240:	68 04 0f 00 00       	push   $0xf04
+ 245:	6a 02                	push   $0x2
+ 247:	e8 a3 06 00 00       	call   8ef <printf>
+ 24c:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 24f:	e8 2f 04 00 00       	call   683 <exit>
+    }
+
+    write(fd, text, strlen(text));
+ 254:	83 ec 0c             	sub    $0xc,%esp
+ 257:	ff 75 08             	push   0x8(%ebp)
+ 25a:	e8 88 01 00 00       	call   3e7 <strlen>
+ 25f:	83 c4 10             	add    $0x10,%esp
+ 262:	83 ec 04             	sub    $0x4,%esp
+ 265:	50                   	push   %eax
+ 266:	ff 75 08             	push   0x8(%ebp)
+ 269:	ff 75 f4             	push   -0xc(%ebp)
+ 26c:	e8 32 04 00 00       	call   6a3 <write>
+ 271:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 274:	83 ec 0c             	sub    $0xc,%esp
+ 277:	ff 75 f4             	push   -0xc(%ebp)
+ 27a:	e8 2c 04 00 00       	call   6ab <close>
+ 27f:	83 c4 10             	add    $0x10,%esp
+}
+ 282:	90                   	nop
+ 283:	c9                   	leave
+ 284:	c3                   	ret
+
+00000285 <main>:
+
+int main()
+{
+ 285:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 289:	83 e4 f0             	and    $0xfffffff0,%esp
+ 28c:	ff 71 fc             	push   -0x4(%ecx)
+ 28f:	55                   	push   %ebp
+ 290:	89 e5                	mov    %esp,%ebp
+ 292:	51                   	push   %ecx
+ 293:	83 ec 24             	sub    $0x24,%esp
+    int i;
+    int pid;
+
+    for (i = 0; i < NUM_PROCESSES; i++)
+ 296:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 29d:	e9 84 00 00 00       	jmp    326 <main+0xa1>
+    {
+        pid = fork();
+ 2a2:	e8 d4 03 00 00       	call   67b <fork>
+ 2a7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if (pid < 0)
+ 2aa:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2ae:	79 17                	jns    2c7 <main+0x42>
+        {
+            printf(2, "Fork failed\n");
+ 2b0:	83 ec 08             	sub    $0x8,%esp
+ 2b3:	68 25 0f 00 00       	push   $0xf25
+ 2b8:	6a 02                	push   $0x2
+ 2ba:	e8 30 06 00 00       	call   8ef <printf>
+ 2bf:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 2c2:	e8 bc 03 00 00       	call   683 <exit>
+        }
+        else if (pid == 0)
+ 2c7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2cb:	75 55                	jne    322 <main+0x9d>
+        {
+            char stringify_pid[20];
+            itoa(getpid(), stringify_pid);
+ 2cd:	e8 31 04 00 00       	call   703 <getpid>
+ 2d2:	83 ec 08             	sub    $0x8,%esp
+ 2d5:	8d 55 d8             	lea    -0x28(%ebp),%edx
+ 2d8:	52                   	push   %edx
+ 2d9:	50                   	push   %eax
+ 2da:	e8 e0 fd ff ff       	call   bf <itoa>
+ 2df:	83 c4 10             	add    $0x10,%esp
+            char* message = strcat("Hello from Process ", stringify_pid);
+ 2e2:	83 ec 08             	sub    $0x8,%esp
+ 2e5:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 2e8:	50                   	push   %eax
+ 2e9:	68 32 0f 00 00       	push   $0xf32
+ 2ee:	e8 0d fd ff ff       	call   0 <strcat>
+ 2f3:	83 c4 10             	add    $0x10,%esp
+ 2f6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+            message = strcat(message, "\n");
+ 2f9:	83 ec 08             	sub    $0x8,%esp
+ 2fc:	68 46 0f 00 00       	push   $0xf46
+ 301:	ff 75 ec             	push   -0x14(%ebp)
+ 304:	e8 f7 fc ff ff       	call   0 <strcat>
+ 309:	83 c4 10             	add    $0x10,%esp
+ 30c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+            write_text(message);
+ 30f:	83 ec 0c             	sub    $0xc,%esp
+ 312:	ff 75 ec             	push   -0x14(%ebp)
+ 315:	e8 c9 fe ff ff       	call   1e3 <write_text>
+ 31a:	83 c4 10             	add    $0x10,%esp
+            exit();
+ 31d:	e8 61 03 00 00       	call   683 <exit>
+    for (i = 0; i < NUM_PROCESSES; i++)
+ 322:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 326:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+ 32a:	0f 8e 72 ff ff ff    	jle    2a2 <main+0x1d>
+        }
+    }
+
+    for (i = 0; i < NUM_PROCESSES; i++)
+ 330:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 337:	eb 09                	jmp    342 <main+0xbd>
+    {
+        wait();
+ 339:	e8 4d 03 00 00       	call   68b <wait>
+    for (i = 0; i < NUM_PROCESSES; i++)
+ 33e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 342:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+ 346:	7e f1                	jle    339 <main+0xb4>
+    }
+
+    print_syscall_count();
+ 348:	e8 36 04 00 00       	call   783 <print_syscall_count>
+
+    exit();
+ 34d:	e8 31 03 00 00       	call   683 <exit>
+
+00000352 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 352:	55                   	push   %ebp
+ 353:	89 e5                	mov    %esp,%ebp
+ 355:	57                   	push   %edi
+ 356:	53                   	push   %ebx
+{
+ 357:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 35a:	8b 55 10             	mov    0x10(%ebp),%edx
+ 35d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 360:	89 cb                	mov    %ecx,%ebx
+ 362:	89 df                	mov    %ebx,%edi
+ 364:	89 d1                	mov    %edx,%ecx
+ 366:	fc                   	cld
+ 367:	f3 aa                	rep stos %al,%es:(%edi)
+ 369:	89 ca                	mov    %ecx,%edx
+ 36b:	89 fb                	mov    %edi,%ebx
+ 36d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 370:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 373:	90                   	nop
+ 374:	5b                   	pop    %ebx
+ 375:	5f                   	pop    %edi
+ 376:	5d                   	pop    %ebp
+ 377:	c3                   	ret
+
+00000378 <strcpy>:
+{
+ 378:	55                   	push   %ebp
+ 379:	89 e5                	mov    %esp,%ebp
+ 37b:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 37e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 381:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 384:	90                   	nop
+ 385:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 388:	8d 42 01             	lea    0x1(%edx),%eax
+ 38b:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 38e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 391:	8d 48 01             	lea    0x1(%eax),%ecx
+ 394:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 397:	0f b6 12             	movzbl (%edx),%edx
+ 39a:	88 10                	mov    %dl,(%eax)
+ 39c:	0f b6 00             	movzbl (%eax),%eax
+ 39f:	84 c0                	test   %al,%al
+ 3a1:	75 e2                	jne    385 <strcpy+0xd>
+  return os;
+ 3a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3a6:	c9                   	leave
+ 3a7:	c3                   	ret
+
+000003a8 <strcmp>:
+{
+ 3a8:	55                   	push   %ebp
+ 3a9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 3ab:	eb 08                	jmp    3b5 <strcmp+0xd>
+    p++, q++;
+ 3ad:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3b1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 3b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b8:	0f b6 00             	movzbl (%eax),%eax
+ 3bb:	84 c0                	test   %al,%al
+ 3bd:	74 10                	je     3cf <strcmp+0x27>
+ 3bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c2:	0f b6 10             	movzbl (%eax),%edx
+ 3c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3c8:	0f b6 00             	movzbl (%eax),%eax
+ 3cb:	38 c2                	cmp    %al,%dl
+ 3cd:	74 de                	je     3ad <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 3cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d2:	0f b6 00             	movzbl (%eax),%eax
+ 3d5:	0f b6 d0             	movzbl %al,%edx
+ 3d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3db:	0f b6 00             	movzbl (%eax),%eax
+ 3de:	0f b6 c0             	movzbl %al,%eax
+ 3e1:	29 c2                	sub    %eax,%edx
+ 3e3:	89 d0                	mov    %edx,%eax
+}
+ 3e5:	5d                   	pop    %ebp
+ 3e6:	c3                   	ret
+
+000003e7 <strlen>:
+{
+ 3e7:	55                   	push   %ebp
+ 3e8:	89 e5                	mov    %esp,%ebp
+ 3ea:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 3ed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3f4:	eb 04                	jmp    3fa <strlen+0x13>
+ 3f6:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3fa:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 400:	01 d0                	add    %edx,%eax
+ 402:	0f b6 00             	movzbl (%eax),%eax
+ 405:	84 c0                	test   %al,%al
+ 407:	75 ed                	jne    3f6 <strlen+0xf>
+  return n;
+ 409:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 40c:	c9                   	leave
+ 40d:	c3                   	ret
+
+0000040e <memset>:
+{
+ 40e:	55                   	push   %ebp
+ 40f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 411:	8b 45 10             	mov    0x10(%ebp),%eax
+ 414:	50                   	push   %eax
+ 415:	ff 75 0c             	push   0xc(%ebp)
+ 418:	ff 75 08             	push   0x8(%ebp)
+ 41b:	e8 32 ff ff ff       	call   352 <stosb>
+ 420:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 426:	c9                   	leave
+ 427:	c3                   	ret
+
+00000428 <strchr>:
+{
+ 428:	55                   	push   %ebp
+ 429:	89 e5                	mov    %esp,%ebp
+ 42b:	83 ec 04             	sub    $0x4,%esp
+ 42e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 431:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 434:	eb 14                	jmp    44a <strchr+0x22>
+    if(*s == c)
+ 436:	8b 45 08             	mov    0x8(%ebp),%eax
+ 439:	0f b6 00             	movzbl (%eax),%eax
+ 43c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 43f:	75 05                	jne    446 <strchr+0x1e>
+      return (char*)s;
+ 441:	8b 45 08             	mov    0x8(%ebp),%eax
+ 444:	eb 13                	jmp    459 <strchr+0x31>
+  for(; *s; s++)
+ 446:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 44a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 44d:	0f b6 00             	movzbl (%eax),%eax
+ 450:	84 c0                	test   %al,%al
+ 452:	75 e2                	jne    436 <strchr+0xe>
+  return 0;
+ 454:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 459:	c9                   	leave
+ 45a:	c3                   	ret
+
+0000045b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 45b:	55                   	push   %ebp
+ 45c:	89 e5                	mov    %esp,%ebp
+ 45e:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 461:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 468:	eb 42                	jmp    4ac <gets+0x51>
+    cc = read(0, &c, 1);
+ 46a:	83 ec 04             	sub    $0x4,%esp
+ 46d:	6a 01                	push   $0x1
+ 46f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 472:	50                   	push   %eax
+ 473:	6a 00                	push   $0x0
+ 475:	e8 21 02 00 00       	call   69b <read>
+ 47a:	83 c4 10             	add    $0x10,%esp
+ 47d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 480:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 484:	7e 33                	jle    4b9 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 486:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 489:	8d 50 01             	lea    0x1(%eax),%edx
+ 48c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 48f:	89 c2                	mov    %eax,%edx
+ 491:	8b 45 08             	mov    0x8(%ebp),%eax
+ 494:	01 c2                	add    %eax,%edx
+ 496:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 49a:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 49c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4a0:	3c 0a                	cmp    $0xa,%al
+ 4a2:	74 16                	je     4ba <gets+0x5f>
+ 4a4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4a8:	3c 0d                	cmp    $0xd,%al
+ 4aa:	74 0e                	je     4ba <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 4ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4af:	83 c0 01             	add    $0x1,%eax
+ 4b2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 4b5:	7f b3                	jg     46a <gets+0xf>
+ 4b7:	eb 01                	jmp    4ba <gets+0x5f>
+      break;
+ 4b9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 4ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c0:	01 d0                	add    %edx,%eax
+ 4c2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 4c5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4c8:	c9                   	leave
+ 4c9:	c3                   	ret
+
+000004ca <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4ca:	55                   	push   %ebp
+ 4cb:	89 e5                	mov    %esp,%ebp
+ 4cd:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4d0:	83 ec 08             	sub    $0x8,%esp
+ 4d3:	6a 00                	push   $0x0
+ 4d5:	ff 75 08             	push   0x8(%ebp)
+ 4d8:	e8 e6 01 00 00       	call   6c3 <open>
+ 4dd:	83 c4 10             	add    $0x10,%esp
+ 4e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 4e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4e7:	79 07                	jns    4f0 <stat+0x26>
+    return -1;
+ 4e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4ee:	eb 25                	jmp    515 <stat+0x4b>
+  r = fstat(fd, st);
+ 4f0:	83 ec 08             	sub    $0x8,%esp
+ 4f3:	ff 75 0c             	push   0xc(%ebp)
+ 4f6:	ff 75 f4             	push   -0xc(%ebp)
+ 4f9:	e8 dd 01 00 00       	call   6db <fstat>
+ 4fe:	83 c4 10             	add    $0x10,%esp
+ 501:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 504:	83 ec 0c             	sub    $0xc,%esp
+ 507:	ff 75 f4             	push   -0xc(%ebp)
+ 50a:	e8 9c 01 00 00       	call   6ab <close>
+ 50f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 512:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 515:	c9                   	leave
+ 516:	c3                   	ret
+
+00000517 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 517:	55                   	push   %ebp
+ 518:	89 e5                	mov    %esp,%ebp
+ 51a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 51d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 524:	eb 25                	jmp    54b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 526:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 529:	89 d0                	mov    %edx,%eax
+ 52b:	c1 e0 02             	shl    $0x2,%eax
+ 52e:	01 d0                	add    %edx,%eax
+ 530:	01 c0                	add    %eax,%eax
+ 532:	89 c1                	mov    %eax,%ecx
+ 534:	8b 45 08             	mov    0x8(%ebp),%eax
+ 537:	8d 50 01             	lea    0x1(%eax),%edx
+ 53a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 53d:	0f b6 00             	movzbl (%eax),%eax
+ 540:	0f be c0             	movsbl %al,%eax
+ 543:	01 c8                	add    %ecx,%eax
+ 545:	83 e8 30             	sub    $0x30,%eax
+ 548:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 54b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54e:	0f b6 00             	movzbl (%eax),%eax
+ 551:	3c 2f                	cmp    $0x2f,%al
+ 553:	7e 0a                	jle    55f <atoi+0x48>
+ 555:	8b 45 08             	mov    0x8(%ebp),%eax
+ 558:	0f b6 00             	movzbl (%eax),%eax
+ 55b:	3c 39                	cmp    $0x39,%al
+ 55d:	7e c7                	jle    526 <atoi+0xf>
+  return n;
+ 55f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 562:	c9                   	leave
+ 563:	c3                   	ret
+
+00000564 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 564:	55                   	push   %ebp
+ 565:	89 e5                	mov    %esp,%ebp
+ 567:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 56a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 570:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 573:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 576:	eb 17                	jmp    58f <memmove+0x2b>
+    *dst++ = *src++;
+ 578:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 57b:	8d 42 01             	lea    0x1(%edx),%eax
+ 57e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 581:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 584:	8d 48 01             	lea    0x1(%eax),%ecx
+ 587:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 58a:	0f b6 12             	movzbl (%edx),%edx
+ 58d:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 58f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 592:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 595:	89 55 10             	mov    %edx,0x10(%ebp)
+ 598:	85 c0                	test   %eax,%eax
+ 59a:	7f dc                	jg     578 <memmove+0x14>
+  return vdst;
+ 59c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 59f:	c9                   	leave
+ 5a0:	c3                   	ret
+
+000005a1 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 5a1:	55                   	push   %ebp
+ 5a2:	89 e5                	mov    %esp,%ebp
+ 5a4:	57                   	push   %edi
+ 5a5:	56                   	push   %esi
+ 5a6:	83 ec 30             	sub    $0x30,%esp
+ 5a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 5af:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5b2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 5b5:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 5bc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 5c3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5c6:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5c9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 5cc:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 5cf:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 5d6:	e9 89 00 00 00       	jmp    664 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 5db:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5de:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 5e1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 5e5:	01 c0                	add    %eax,%eax
+ 5e7:	89 c6                	mov    %eax,%esi
+ 5e9:	89 d7                	mov    %edx,%edi
+ 5eb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 5ee:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5f1:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5f4:	0f ad d0             	shrd   %cl,%edx,%eax
+ 5f7:	d3 ea                	shr    %cl,%edx
+ 5f9:	f6 c1 20             	test   $0x20,%cl
+ 5fc:	74 04                	je     602 <udiv64+0x61>
+ 5fe:	89 d0                	mov    %edx,%eax
+ 600:	31 d2                	xor    %edx,%edx
+ 602:	83 e0 01             	and    $0x1,%eax
+ 605:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 608:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 60f:	89 f0                	mov    %esi,%eax
+ 611:	89 fa                	mov    %edi,%edx
+ 613:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 616:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 619:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 61c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 61f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 622:	ba 00 00 00 00       	mov    $0x0,%edx
+ 627:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 62a:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 62d:	19 d1                	sbb    %edx,%ecx
+ 62f:	72 2f                	jb     660 <udiv64+0xbf>
+      r -= d;
+ 631:	8b 45 10             	mov    0x10(%ebp),%eax
+ 634:	ba 00 00 00 00       	mov    $0x0,%edx
+ 639:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 63c:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 63f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 642:	b8 01 00 00 00       	mov    $0x1,%eax
+ 647:	ba 00 00 00 00       	mov    $0x0,%edx
+ 64c:	0f a5 c2             	shld   %cl,%eax,%edx
+ 64f:	d3 e0                	shl    %cl,%eax
+ 651:	f6 c1 20             	test   $0x20,%cl
+ 654:	74 04                	je     65a <udiv64+0xb9>
+ 656:	89 c2                	mov    %eax,%edx
+ 658:	31 c0                	xor    %eax,%eax
+ 65a:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 65d:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 660:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 664:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 668:	0f 89 6d ff ff ff    	jns    5db <udiv64+0x3a>
+    }
+  }
+  return q;
+ 66e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 671:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 674:	83 c4 30             	add    $0x30,%esp
+ 677:	5e                   	pop    %esi
+ 678:	5f                   	pop    %edi
+ 679:	5d                   	pop    %ebp
+ 67a:	c3                   	ret
+
+0000067b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 67b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <exit>:
+SYSCALL(exit)
+ 683:	b8 02 00 00 00       	mov    $0x2,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <wait>:
+SYSCALL(wait)
+ 68b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <pipe>:
+SYSCALL(pipe)
+ 693:	b8 04 00 00 00       	mov    $0x4,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <read>:
+SYSCALL(read)
+ 69b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <write>:
+SYSCALL(write)
+ 6a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <close>:
+SYSCALL(close)
+ 6ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <kill>:
+SYSCALL(kill)
+ 6b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <exec>:
+SYSCALL(exec)
+ 6bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <open>:
+SYSCALL(open)
+ 6c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <mknod>:
+SYSCALL(mknod)
+ 6cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <unlink>:
+SYSCALL(unlink)
+ 6d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <fstat>:
+SYSCALL(fstat)
+ 6db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <link>:
+SYSCALL(link)
+ 6e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <mkdir>:
+SYSCALL(mkdir)
+ 6eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <chdir>:
+SYSCALL(chdir)
+ 6f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <dup>:
+SYSCALL(dup)
+ 6fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <getpid>:
+SYSCALL(getpid)
+ 703:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <sbrk>:
+SYSCALL(sbrk)
+ 70b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <sleep>:
+SYSCALL(sleep)
+ 713:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <uptime>:
+SYSCALL(uptime)
+ 71b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 723:	b8 16 00 00 00       	mov    $0x16,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 72b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 733:	b8 18 00 00 00       	mov    $0x18,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <copy_file>:
+SYSCALL(copy_file)
+ 73b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <change_queue>:
+SYSCALL(change_queue)
+ 743:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 74b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 753:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <print_process_info>:
+SYSCALL(print_process_info)
+ 75b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 763:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 76b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 773:	b8 20 00 00 00       	mov    $0x20,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 77b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 783:	b8 22 00 00 00       	mov    $0x22,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 78b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 793:	b8 24 00 00 00       	mov    $0x24,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 79b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <set_affinity>:
+SYSCALL(set_affinity)
+ 7a3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <setsched>:
+SYSCALL(setsched)
+ 7ab:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 7b3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <set_quantum>:
+SYSCALL(set_quantum)
+ 7bb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <schedtrace>:
+SYSCALL(schedtrace)
+ 7c3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <getrusage>:
+SYSCALL(getrusage)
+ 7cb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 7d3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 7db:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 7e3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <futex_wait>:
+SYSCALL(futex_wait)
+ 7eb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <futex_wake>:
+SYSCALL(futex_wake)
+ 7f3:	b8 30 00 00 00       	mov    $0x30,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <syscall_latency>:
+SYSCALL(syscall_latency)
+ 7fb:	b8 31 00 00 00       	mov    $0x31,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <submit_batch>:
+SYSCALL(submit_batch)
+ 803:	b8 32 00 00 00       	mov    $0x32,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <kmem_stats>:
+SYSCALL(kmem_stats)
+ 80b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 813:	b8 34 00 00 00       	mov    $0x34,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 81b:	55                   	push   %ebp
+ 81c:	89 e5                	mov    %esp,%ebp
+ 81e:	83 ec 18             	sub    $0x18,%esp
+ 821:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 824:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 827:	83 ec 04             	sub    $0x4,%esp
+ 82a:	6a 01                	push   $0x1
+ 82c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 82f:	50                   	push   %eax
+ 830:	ff 75 08             	push   0x8(%ebp)
+ 833:	e8 6b fe ff ff       	call   6a3 <write>
+ 838:	83 c4 10             	add    $0x10,%esp
+}
+ 83b:	90                   	nop
+ 83c:	c9                   	leave
+ 83d:	c3                   	ret
+
+0000083e <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 83e:	55                   	push   %ebp
+ 83f:	89 e5                	mov    %esp,%ebp
+ 841:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 844:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 84b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 84f:	74 17                	je     868 <printint+0x2a>
+ 851:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 855:	79 11                	jns    868 <printint+0x2a>
+    neg = 1;
+ 857:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 85e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 861:	f7 d8                	neg    %eax
+ 863:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 866:	eb 06                	jmp    86e <printint+0x30>
+  } else {
+    x = xx;
+ 868:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 86b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 86e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 875:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 878:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 87b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 880:	f7 f1                	div    %ecx
+ 882:	89 d1                	mov    %edx,%ecx
+ 884:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 887:	8d 50 01             	lea    0x1(%eax),%edx
+ 88a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 88d:	0f b6 91 a0 13 00 00 	movzbl 0x13a0(%ecx),%edx
+ 894:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 898:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 89b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 89e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8a3:	f7 f1                	div    %ecx
+ 8a5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8a8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8ac:	75 c7                	jne    875 <printint+0x37>
+  if(neg)
+ 8ae:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8b2:	74 2d                	je     8e1 <printint+0xa3>
+    buf[i++] = '-';
+ 8b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b7:	8d 50 01             	lea    0x1(%eax),%edx
+ 8ba:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8bd:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 8c2:	eb 1d                	jmp    8e1 <printint+0xa3>
+    putc(fd, buf[i]);
+ 8c4:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 8c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ca:	01 d0                	add    %edx,%eax
+ 8cc:	0f b6 00             	movzbl (%eax),%eax
+ 8cf:	0f be c0             	movsbl %al,%eax
+ 8d2:	83 ec 08             	sub    $0x8,%esp
+ 8d5:	50                   	push   %eax
+ 8d6:	ff 75 08             	push   0x8(%ebp)
+ 8d9:	e8 3d ff ff ff       	call   81b <putc>
+ 8de:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 8e1:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 8e5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8e9:	79 d9                	jns    8c4 <printint+0x86>
+}
+ 8eb:	90                   	nop
+ 8ec:	90                   	nop
+ 8ed:	c9                   	leave
+ 8ee:	c3                   	ret
+
+000008ef <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8ef:	55                   	push   %ebp
+ 8f0:	89 e5                	mov    %esp,%ebp
+ 8f2:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 8f5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 8fc:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 8ff:	83 c0 04             	add    $0x4,%eax
+ 902:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 905:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 90c:	e9 59 01 00 00       	jmp    a6a <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 911:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 914:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 917:	01 d0                	add    %edx,%eax
+ 919:	0f b6 00             	movzbl (%eax),%eax
+ 91c:	0f be c0             	movsbl %al,%eax
+ 91f:	25 ff 00 00 00       	and    $0xff,%eax
+ 924:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 927:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 92b:	75 2c                	jne    959 <printf+0x6a>
+      if(c == '%'){
+ 92d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 931:	75 0c                	jne    93f <printf+0x50>
+        state = '%';
+ 933:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 93a:	e9 27 01 00 00       	jmp    a66 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 93f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 942:	0f be c0             	movsbl %al,%eax
+ 945:	83 ec 08             	sub    $0x8,%esp
+ 948:	50                   	push   %eax
+ 949:	ff 75 08             	push   0x8(%ebp)
+ 94c:	e8 ca fe ff ff       	call   81b <putc>
+ 951:	83 c4 10             	add    $0x10,%esp
+ 954:	e9 0d 01 00 00       	jmp    a66 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 959:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 95d:	0f 85 03 01 00 00    	jne    a66 <printf+0x177>
+      if(c == 'd'){
+ 963:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 967:	75 1e                	jne    987 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 969:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 96c:	8b 00                	mov    (%eax),%eax
+ 96e:	6a 01                	push   $0x1
+ 970:	6a 0a                	push   $0xa
+ 972:	50                   	push   %eax
+ 973:	ff 75 08             	push   0x8(%ebp)
+ 976:	e8 c3 fe ff ff       	call   83e <printint>
+ 97b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 97e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 982:	e9 d8 00 00 00       	jmp    a5f <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 987:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 98b:	74 06                	je     993 <printf+0xa4>
+ 98d:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 991:	75 1e                	jne    9b1 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 993:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 996:	8b 00                	mov    (%eax),%eax
+ 998:	6a 00                	push   $0x0
+ 99a:	6a 10                	push   $0x10
+ 99c:	50                   	push   %eax
+ 99d:	ff 75 08             	push   0x8(%ebp)
+ 9a0:	e8 99 fe ff ff       	call   83e <printint>
+ 9a5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9a8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9ac:	e9 ae 00 00 00       	jmp    a5f <printf+0x170>
+      } else if(c == 's'){
+ 9b1:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 9b5:	75 43                	jne    9fa <printf+0x10b>
+        s = (char*)*ap;
+ 9b7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9ba:	8b 00                	mov    (%eax),%eax
+ 9bc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 9bf:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 9c3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9c7:	75 25                	jne    9ee <printf+0xff>
+          s = "(null)";
+ 9c9:	c7 45 f4 48 0f 00 00 	movl   $0xf48,-0xc(%ebp)
+        while(*s != 0){
+ 9d0:	eb 1c                	jmp    9ee <printf+0xff>
+          putc(fd, *s);
+ 9d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d5:	0f b6 00             	movzbl (%eax),%eax
+ 9d8:	0f be c0             	movsbl %al,%eax
+ 9db:	83 ec 08             	sub    $0x8,%esp
+ 9de:	50                   	push   %eax
+ 9df:	ff 75 08             	push   0x8(%ebp)
+ 9e2:	e8 34 fe ff ff       	call   81b <putc>
+ 9e7:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 9ea:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 9ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9f1:	0f b6 00             	movzbl (%eax),%eax
+ 9f4:	84 c0                	test   %al,%al
+ 9f6:	75 da                	jne    9d2 <printf+0xe3>
+ 9f8:	eb 65                	jmp    a5f <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 9fa:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 9fe:	75 1d                	jne    a1d <printf+0x12e>
+        putc(fd, *ap);
+ a00:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a03:	8b 00                	mov    (%eax),%eax
+ a05:	0f be c0             	movsbl %al,%eax
+ a08:	83 ec 08             	sub    $0x8,%esp
+ a0b:	50                   	push   %eax
+ a0c:	ff 75 08             	push   0x8(%ebp)
+ a0f:	e8 07 fe ff ff       	call   81b <putc>
+ a14:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a17:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a1b:	eb 42                	jmp    a5f <printf+0x170>
+      } else if(c == '%'){
+ a1d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a21:	75 17                	jne    a3a <printf+0x14b>
+        putc(fd, c);
+ a23:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a26:	0f be c0             	movsbl %al,%eax
+ a29:	83 ec 08             	sub    $0x8,%esp
+ a2c:	50                   	push   %eax
+ a2d:	ff 75 08             	push   0x8(%ebp)
+ a30:	e8 e6 fd ff ff       	call   81b <putc>
+ a35:	83 c4 10             	add    $0x10,%esp
+ a38:	eb 25                	jmp    a5f <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ a3a:	83 ec 08             	sub    $0x8,%esp
+ a3d:	6a 25                	push   $0x25
+ a3f:	ff 75 08             	push   0x8(%ebp)
+ a42:	e8 d4 fd ff ff       	call   81b <putc>
+ a47:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ a4a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a4d:	0f be c0             	movsbl %al,%eax
+ a50:	83 ec 08             	sub    $0x8,%esp
+ a53:	50                   	push   %eax
+ a54:	ff 75 08             	push   0x8(%ebp)
+ a57:	e8 bf fd ff ff       	call   81b <putc>
+ a5c:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a5f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a66:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a6d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a70:	01 d0                	add    %edx,%eax
+ a72:	0f b6 00             	movzbl (%eax),%eax
+ a75:	84 c0                	test   %al,%al
+ a77:	0f 85 94 fe ff ff    	jne    911 <printf+0x22>
+    }
+  }
+}
+ a7d:	90                   	nop
+ a7e:	90                   	nop
+ a7f:	c9                   	leave
+ a80:	c3                   	ret
+
+00000a81 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a81:	55                   	push   %ebp
+ a82:	89 e5                	mov    %esp,%ebp
+ a84:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ a87:	8b 45 08             	mov    0x8(%ebp),%eax
+ a8a:	83 e8 08             	sub    $0x8,%eax
+ a8d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a90:	a1 bc 13 00 00       	mov    0x13bc,%eax
+ a95:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a98:	eb 24                	jmp    abe <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a9a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a9d:	8b 00                	mov    (%eax),%eax
+ a9f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ aa2:	72 12                	jb     ab6 <free+0x35>
+ aa4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aa7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ aaa:	72 24                	jb     ad0 <free+0x4f>
+ aac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aaf:	8b 00                	mov    (%eax),%eax
+ ab1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ ab4:	72 1a                	jb     ad0 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ab6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab9:	8b 00                	mov    (%eax),%eax
+ abb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ abe:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ac1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ac4:	73 d4                	jae    a9a <free+0x19>
+ ac6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac9:	8b 00                	mov    (%eax),%eax
+ acb:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ ace:	73 ca                	jae    a9a <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ad0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ad3:	8b 40 04             	mov    0x4(%eax),%eax
+ ad6:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ add:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ae0:	01 c2                	add    %eax,%edx
+ ae2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae5:	8b 00                	mov    (%eax),%eax
+ ae7:	39 c2                	cmp    %eax,%edx
+ ae9:	75 24                	jne    b0f <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ aeb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aee:	8b 50 04             	mov    0x4(%eax),%edx
+ af1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af4:	8b 00                	mov    (%eax),%eax
+ af6:	8b 40 04             	mov    0x4(%eax),%eax
+ af9:	01 c2                	add    %eax,%edx
+ afb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ afe:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b01:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b04:	8b 00                	mov    (%eax),%eax
+ b06:	8b 10                	mov    (%eax),%edx
+ b08:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b0b:	89 10                	mov    %edx,(%eax)
+ b0d:	eb 0a                	jmp    b19 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ b0f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b12:	8b 10                	mov    (%eax),%edx
+ b14:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b17:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ b19:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b1c:	8b 40 04             	mov    0x4(%eax),%eax
+ b1f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b26:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b29:	01 d0                	add    %edx,%eax
+ b2b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b2e:	75 20                	jne    b50 <free+0xcf>
+    p->s.size += bp->s.size;
+ b30:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b33:	8b 50 04             	mov    0x4(%eax),%edx
+ b36:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b39:	8b 40 04             	mov    0x4(%eax),%eax
+ b3c:	01 c2                	add    %eax,%edx
+ b3e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b41:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ b44:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b47:	8b 10                	mov    (%eax),%edx
+ b49:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b4c:	89 10                	mov    %edx,(%eax)
+ b4e:	eb 08                	jmp    b58 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ b50:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b53:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ b56:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b58:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b5b:	a3 bc 13 00 00       	mov    %eax,0x13bc
+}
+ b60:	90                   	nop
+ b61:	c9                   	leave
+ b62:	c3                   	ret
+
+00000b63 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ b63:	55                   	push   %ebp
+ b64:	89 e5                	mov    %esp,%ebp
+ b66:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ b69:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ b70:	77 07                	ja     b79 <morecore+0x16>
+    nu = 4096;
+ b72:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ b79:	8b 45 08             	mov    0x8(%ebp),%eax
+ b7c:	c1 e0 03             	shl    $0x3,%eax
+ b7f:	83 ec 0c             	sub    $0xc,%esp
+ b82:	50                   	push   %eax
+ b83:	e8 83 fb ff ff       	call   70b <sbrk>
+ b88:	83 c4 10             	add    $0x10,%esp
+ b8b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ b8e:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b92:	75 07                	jne    b9b <morecore+0x38>
+    return 0;
+ b94:	b8 00 00 00 00       	mov    $0x0,%eax
+ b99:	eb 26                	jmp    bc1 <morecore+0x5e>
+  hp = (Header*)p;
+ b9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b9e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ ba1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ba4:	8b 55 08             	mov    0x8(%ebp),%edx
+ ba7:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ baa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bad:	83 c0 08             	add    $0x8,%eax
+ bb0:	83 ec 0c             	sub    $0xc,%esp
+ bb3:	50                   	push   %eax
+ bb4:	e8 c8 fe ff ff       	call   a81 <free>
+ bb9:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ bbc:	a1 bc 13 00 00       	mov    0x13bc,%eax
+}
+ bc1:	c9                   	leave
+ bc2:	c3                   	ret
+
+00000bc3 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ bc3:	55                   	push   %ebp
+ bc4:	89 e5                	mov    %esp,%ebp
+ bc6:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+ bcc:	83 c0 07             	add    $0x7,%eax
+ bcf:	c1 e8 03             	shr    $0x3,%eax
+ bd2:	83 c0 01             	add    $0x1,%eax
+ bd5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ bd8:	a1 bc 13 00 00       	mov    0x13bc,%eax
+ bdd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ be0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ be4:	75 23                	jne    c09 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ be6:	c7 45 f0 b4 13 00 00 	movl   $0x13b4,-0x10(%ebp)
+ bed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bf0:	a3 bc 13 00 00       	mov    %eax,0x13bc
+ bf5:	a1 bc 13 00 00       	mov    0x13bc,%eax
+ bfa:	a3 b4 13 00 00       	mov    %eax,0x13b4
+    base.s.size = 0;
+ bff:	c7 05 b8 13 00 00 00 	movl   $0x0,0x13b8
+ c06:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c09:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c0c:	8b 00                	mov    (%eax),%eax
+ c0e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c14:	8b 40 04             	mov    0x4(%eax),%eax
+ c17:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ c1a:	72 4d                	jb     c69 <malloc+0xa6>
+      if(p->s.size == nunits)
+ c1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c1f:	8b 40 04             	mov    0x4(%eax),%eax
+ c22:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ c25:	75 0c                	jne    c33 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ c27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c2a:	8b 10                	mov    (%eax),%edx
+ c2c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c2f:	89 10                	mov    %edx,(%eax)
+ c31:	eb 26                	jmp    c59 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ c33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c36:	8b 40 04             	mov    0x4(%eax),%eax
+ c39:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ c3c:	89 c2                	mov    %eax,%edx
+ c3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c41:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ c44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c47:	8b 40 04             	mov    0x4(%eax),%eax
+ c4a:	c1 e0 03             	shl    $0x3,%eax
+ c4d:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ c50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c53:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ c56:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ c59:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c5c:	a3 bc 13 00 00       	mov    %eax,0x13bc
+      return (void*)(p + 1);
+ c61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c64:	83 c0 08             	add    $0x8,%eax
+ c67:	eb 3b                	jmp    ca4 <malloc+0xe1>
+    }
+    if(p == freep)
+ c69:	a1 bc 13 00 00       	mov    0x13bc,%eax
+ c6e:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c71:	75 1e                	jne    c91 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ c73:	83 ec 0c             	sub    $0xc,%esp
+ c76:	ff 75 ec             	push   -0x14(%ebp)
+ c79:	e8 e5 fe ff ff       	call   b63 <morecore>
+ c7e:	83 c4 10             	add    $0x10,%esp
+ c81:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c84:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c88:	75 07                	jne    c91 <malloc+0xce>
+        return 0;
+ c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+ c8f:	eb 13                	jmp    ca4 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c94:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c9a:	8b 00                	mov    (%eax),%eax
+ c9c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c9f:	e9 6d ff ff ff       	jmp    c11 <malloc+0x4e>
+  }
+}
+ ca4:	c9                   	leave
+ ca5:	c3                   	ret
+
+00000ca6 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ ca6:	55                   	push   %ebp
+ ca7:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+ cac:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ cb2:	90                   	nop
+ cb3:	5d                   	pop    %ebp
+ cb4:	c3                   	ret
+
+00000cb5 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ cb5:	55                   	push   %ebp
+ cb6:	89 e5                	mov    %esp,%ebp
+ cb8:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+ cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+ cc3:	b9 01 00 00 00       	mov    $0x1,%ecx
+ cc8:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ ccc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ccf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cd3:	74 3b                	je     d10 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ cd5:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ cd9:	74 2d                	je     d08 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ cdb:	8b 55 08             	mov    0x8(%ebp),%edx
+ cde:	b8 02 00 00 00       	mov    $0x2,%eax
+ ce3:	87 02                	xchg   %eax,(%edx)
+ ce5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ ce8:	eb 1e                	jmp    d08 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ cea:	8b 45 08             	mov    0x8(%ebp),%eax
+ ced:	83 ec 08             	sub    $0x8,%esp
+ cf0:	6a 02                	push   $0x2
+ cf2:	50                   	push   %eax
+ cf3:	e8 f3 fa ff ff       	call   7eb <futex_wait>
+ cf8:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ cfb:	8b 55 08             	mov    0x8(%ebp),%edx
+ cfe:	b8 02 00 00 00       	mov    $0x2,%eax
+ d03:	87 02                	xchg   %eax,(%edx)
+ d05:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ d08:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d0c:	75 dc                	jne    cea <mutex_lock+0x35>
+ d0e:	eb 01                	jmp    d11 <mutex_lock+0x5c>
+    return;
+ d10:	90                   	nop
+  }
+}
+ d11:	c9                   	leave
+ d12:	c3                   	ret
+
+00000d13 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ d13:	55                   	push   %ebp
+ d14:	89 e5                	mov    %esp,%ebp
+ d16:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ d19:	8b 45 08             	mov    0x8(%ebp),%eax
+ d1c:	ba 01 00 00 00       	mov    $0x1,%edx
+ d21:	f7 da                	neg    %edx
+ d23:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ d27:	83 fa 01             	cmp    $0x1,%edx
+ d2a:	74 1a                	je     d46 <mutex_unlock+0x33>
+    m->state = 0;
+ d2c:	8b 45 08             	mov    0x8(%ebp),%eax
+ d2f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ d35:	8b 45 08             	mov    0x8(%ebp),%eax
+ d38:	83 ec 08             	sub    $0x8,%esp
+ d3b:	6a 01                	push   $0x1
+ d3d:	50                   	push   %eax
+ d3e:	e8 b0 fa ff ff       	call   7f3 <futex_wake>
+ d43:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ d46:	90                   	nop
+ d47:	c9                   	leave
+ d48:	c3                   	ret
+
+00000d49 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ d49:	55                   	push   %ebp
+ d4a:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ d4c:	8b 45 08             	mov    0x8(%ebp),%eax
+ d4f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ d55:	8b 45 08             	mov    0x8(%ebp),%eax
+ d58:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ d5f:	90                   	nop
+ d60:	5d                   	pop    %ebp
+ d61:	c3                   	ret
+
+00000d62 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ d62:	55                   	push   %ebp
+ d63:	89 e5                	mov    %esp,%ebp
+ d65:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ d68:	8b 45 08             	mov    0x8(%ebp),%eax
+ d6b:	83 c0 04             	add    $0x4,%eax
+ d6e:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ d72:	8b 45 08             	mov    0x8(%ebp),%eax
+ d75:	83 ec 08             	sub    $0x8,%esp
+ d78:	ff 75 0c             	push   0xc(%ebp)
+ d7b:	50                   	push   %eax
+ d7c:	e8 6a fa ff ff       	call   7eb <futex_wait>
+ d81:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ d84:	8b 45 08             	mov    0x8(%ebp),%eax
+ d87:	83 c0 04             	add    $0x4,%eax
+ d8a:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ d8e:	90                   	nop
+ d8f:	c9                   	leave
+ d90:	c3                   	ret
+
+00000d91 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ d91:	55                   	push   %ebp
+ d92:	89 e5                	mov    %esp,%ebp
+ d94:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ d97:	8b 45 08             	mov    0x8(%ebp),%eax
+ d9a:	8b 00                	mov    (%eax),%eax
+ d9c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ d9f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ da3:	78 17                	js     dbc <rwlock_rdlock+0x2b>
+ da5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ da8:	83 c0 01             	add    $0x1,%eax
+ dab:	89 c1                	mov    %eax,%ecx
+ dad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ db0:	8b 55 08             	mov    0x8(%ebp),%edx
+ db3:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ db7:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ dba:	74 19                	je     dd5 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ dbc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ dc0:	79 d5                	jns    d97 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ dc2:	83 ec 08             	sub    $0x8,%esp
+ dc5:	ff 75 f4             	push   -0xc(%ebp)
+ dc8:	ff 75 08             	push   0x8(%ebp)
+ dcb:	e8 92 ff ff ff       	call   d62 <rwlock_sleep>
+ dd0:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ dd3:	eb c2                	jmp    d97 <rwlock_rdlock+0x6>
+      return;
+ dd5:	90                   	nop
+  }
+}
+ dd6:	c9                   	leave
+ dd7:	c3                   	ret
+
+00000dd8 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ dd8:	55                   	push   %ebp
+ dd9:	89 e5                	mov    %esp,%ebp
+ ddb:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ dde:	eb 11                	jmp    df1 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ de0:	83 ec 08             	sub    $0x8,%esp
+ de3:	ff 75 f4             	push   -0xc(%ebp)
+ de6:	ff 75 08             	push   0x8(%ebp)
+ de9:	e8 74 ff ff ff       	call   d62 <rwlock_sleep>
+ dee:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ df1:	8b 55 08             	mov    0x8(%ebp),%edx
+ df4:	b8 00 00 00 00       	mov    $0x0,%eax
+ df9:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ dfe:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ e02:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e05:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e09:	75 d5                	jne    de0 <rwlock_wrlock+0x8>
+}
+ e0b:	90                   	nop
+ e0c:	90                   	nop
+ e0d:	c9                   	leave
+ e0e:	c3                   	ret
+
+00000e0f <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ e0f:	55                   	push   %ebp
+ e10:	89 e5                	mov    %esp,%ebp
+ e12:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ e15:	8b 45 08             	mov    0x8(%ebp),%eax
+ e18:	8b 00                	mov    (%eax),%eax
+ e1a:	85 c0                	test   %eax,%eax
+ e1c:	79 0c                	jns    e2a <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ e1e:	8b 45 08             	mov    0x8(%ebp),%eax
+ e21:	ba 00 00 00 00       	mov    $0x0,%edx
+ e26:	87 10                	xchg   %edx,(%eax)
+ e28:	eb 18                	jmp    e42 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ e2a:	8b 55 08             	mov    0x8(%ebp),%edx
+ e2d:	b8 01 00 00 00       	mov    $0x1,%eax
+ e32:	f7 d8                	neg    %eax
+ e34:	89 c1                	mov    %eax,%ecx
+ e36:	89 c8                	mov    %ecx,%eax
+ e38:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ e3c:	01 c8                	add    %ecx,%eax
+ e3e:	85 c0                	test   %eax,%eax
+ e40:	75 20                	jne    e62 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ e42:	8b 45 08             	mov    0x8(%ebp),%eax
+ e45:	8b 40 04             	mov    0x4(%eax),%eax
+ e48:	85 c0                	test   %eax,%eax
+ e4a:	74 17                	je     e63 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ e4c:	8b 45 08             	mov    0x8(%ebp),%eax
+ e4f:	83 ec 08             	sub    $0x8,%esp
+ e52:	68 ff ff ff 7f       	push   $0x7fffffff
+ e57:	50                   	push   %eax
+ e58:	e8 96 f9 ff ff       	call   7f3 <futex_wake>
+ e5d:	83 c4 10             	add    $0x10,%esp
+ e60:	eb 01                	jmp    e63 <rwlock_unlock+0x54>
+    return;
+ e62:	90                   	nop
+}
+ e63:	c9                   	leave
+ e64:	c3                   	ret
+
+00000e65 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ e65:	55                   	push   %ebp
+ e66:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ e68:	8b 45 08             	mov    0x8(%ebp),%eax
+ e6b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ e71:	90                   	nop
+ e72:	5d                   	pop    %ebp
+ e73:	c3                   	ret
+
+00000e74 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ e74:	55                   	push   %ebp
+ e75:	89 e5                	mov    %esp,%ebp
+ e77:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ e7a:	8b 45 08             	mov    0x8(%ebp),%eax
+ e7d:	8b 00                	mov    (%eax),%eax
+ e7f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ e82:	83 ec 0c             	sub    $0xc,%esp
+ e85:	ff 75 0c             	push   0xc(%ebp)
+ e88:	e8 86 fe ff ff       	call   d13 <mutex_unlock>
+ e8d:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ e90:	8b 45 08             	mov    0x8(%ebp),%eax
+ e93:	83 ec 08             	sub    $0x8,%esp
+ e96:	ff 75 f4             	push   -0xc(%ebp)
+ e99:	50                   	push   %eax
+ e9a:	e8 4c f9 ff ff       	call   7eb <futex_wait>
+ e9f:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ ea2:	83 ec 0c             	sub    $0xc,%esp
+ ea5:	ff 75 0c             	push   0xc(%ebp)
+ ea8:	e8 08 fe ff ff       	call   cb5 <mutex_lock>
+ ead:	83 c4 10             	add    $0x10,%esp
+}
+ eb0:	90                   	nop
+ eb1:	c9                   	leave
+ eb2:	c3                   	ret
+
+00000eb3 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ eb3:	55                   	push   %ebp
+ eb4:	89 e5                	mov    %esp,%ebp
+ eb6:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ eb9:	8b 45 08             	mov    0x8(%ebp),%eax
+ ebc:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ ec0:	8b 45 08             	mov    0x8(%ebp),%eax
+ ec3:	83 ec 08             	sub    $0x8,%esp
+ ec6:	6a 01                	push   $0x1
+ ec8:	50                   	push   %eax
+ ec9:	e8 25 f9 ff ff       	call   7f3 <futex_wake>
+ ece:	83 c4 10             	add    $0x10,%esp
+}
+ ed1:	90                   	nop
+ ed2:	c9                   	leave
+ ed3:	c3                   	ret
+
+00000ed4 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ ed4:	55                   	push   %ebp
+ ed5:	89 e5                	mov    %esp,%ebp
+ ed7:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ eda:	8b 45 08             	mov    0x8(%ebp),%eax
+ edd:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ ee1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ee4:	83 ec 08             	sub    $0x8,%esp
+ ee7:	68 ff ff ff 7f       	push   $0x7fffffff
+ eec:	50                   	push   %eax
+ eed:	e8 01 f9 ff ff       	call   7f3 <futex_wake>
+ ef2:	83 c4 10             	add    $0x10,%esp
+}
+ ef5:	90                   	nop
+ ef6:	c9                   	leave
+ ef7:	c3                   	ret
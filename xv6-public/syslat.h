@@ -0,0 +1,11 @@
+// System call latency histograms, kept per CPU by syscall()
+// and summed over CPUs by the syscall_latency system call.
+
+#define NSYSCALL 64   // Above every SYS_ number
+#define NLATBUCKET 32 // Bucket k counts calls of 2^k up to 2^(k+1) TSC cycles
+
+struct syslat
+{
+  uint hist[NSYSCALL][NLATBUCKET];
+  uint max[NSYSCALL]; // Slowest call in cycles, saturating
+};
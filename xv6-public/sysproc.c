@@ -5,6 +5,8 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "schedtrace.h"
+#include "kmemstat.h"
 
 int sys_fork(void)
 {
@@ -114,12 +116,12 @@ int sys_change_queue(void)
 int sys_set_bjf_params_for_process(void)
 {
   int pid;
-  float priority_ratio, arrival_time_ratio, executed_cycle_ratio, process_size_ratio;
+  int priority_ratio, arrival_time_ratio, executed_cycle_ratio, process_size_ratio;
   if (argint(0, &pid) < 0 ||
-      argfloat(1, &priority_ratio) < 0 ||
-      argfloat(2, &arrival_time_ratio) < 0 ||
-      argfloat(3, &executed_cycle_ratio) < 0 ||
-      argfloat(4, &process_size_ratio) < 0)
+      argfixed(1, &priority_ratio) < 0 ||
+      argfixed(2, &arrival_time_ratio) < 0 ||
+      argfixed(3, &executed_cycle_ratio) < 0 ||
+      argfixed(4, &process_size_ratio) < 0)
   {
     return -1;
   }
@@ -129,11 +131,11 @@ int sys_set_bjf_params_for_process(void)
 
 int sys_set_bjf_params_for_system(void)
 {
-  float priority_ratio, arrival_time_ratio, executed_cycle_ratio, process_size_ratio;
-  if (argfloat(0, &priority_ratio) < 0 ||
-      argfloat(1, &arrival_time_ratio) < 0 ||
-      argfloat(2, &executed_cycle_ratio) < 0 ||
-      argfloat(3, &process_size_ratio) < 0)
+  int priority_ratio, arrival_time_ratio, executed_cycle_ratio, process_size_ratio;
+  if (argfixed(0, &priority_ratio) < 0 ||
+      argfixed(1, &arrival_time_ratio) < 0 ||
+      argfixed(2, &executed_cycle_ratio) < 0 ||
+      argfixed(3, &process_size_ratio) < 0)
   {
     return -1;
   }
@@ -162,12 +164,7 @@ int sys_set_bjf_priority(void)
 
 int sys_print_syscall_count()
 {
-  for (int i = 0; i < NCPU; i++)
-  {
-    cprintf("cpu number %d has run %d systemcalls\n", cpus[i].apicid, cpus[i].syscall_count);
-  }
-
-  cprintf("total number of system calls are %d\n", syscall_count_total);
+  print_syscall_count();
   return 0;
 }
 
@@ -179,13 +176,13 @@ int sys_reset_syscall_count()
 
 void *sys_open_sharedmem()
 {
-  int id;
+  int id, size;
   char *pointer;
 
-  if (argint(0, &id) < 0)
+  if (argint(0, &id) < 0 || argint(1, &size) < 0)
     return -1;
 
-  pointer = (char *)shm_open(id);
+  pointer = (char *)shm_open(id, size);
 
   if (pointer == (char *)-1)
   {
@@ -207,4 +204,113 @@ int sys_close_sharedmem()
     cprintf("Failed to close shared memory region!\n");
   }
   return res;
-}
\ No newline at end of file
+}
+
+int sys_set_affinity(void)
+{
+  int pid, mask;
+  if (argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+
+  return set_affinity(pid, mask);
+}
+
+int sys_setsched(void)
+{
+  int pid, sched_class;
+  if (argint(0, &pid) < 0 || argint(1, &sched_class) < 0)
+    return -1;
+
+  return setsched(pid, sched_class);
+}
+
+int sys_get_idle_cycles(void)
+{
+  int cpu;
+  uint64 *cycles;
+  if (argint(0, &cpu) < 0 || argptr(1, (char **)&cycles, sizeof(*cycles)) < 0)
+    return -1;
+
+  return get_idle_cycles(cpu, cycles);
+}
+
+int sys_set_quantum(void)
+{
+  int queue, nticks;
+  if (argint(0, &queue) < 0 || argint(1, &nticks) < 0)
+    return -1;
+
+  return set_quantum(queue, nticks);
+}
+
+int sys_schedtrace(void)
+{
+  int n;
+  struct trace_event *buf;
+  if (argint(1, &n) < 0 || n < 0)
+    return -1;
+  if (n > NCPU * TRACE_RING)
+    n = NCPU * TRACE_RING;
+  if (argptr(0, (char **)&buf, n * sizeof(*buf)) < 0)
+    return -1;
+
+  return drain_schedtrace(buf, n);
+}
+
+int sys_getrusage(void)
+{
+  int who;
+  struct rusage *ru;
+  if (argint(0, &who) < 0 || argptr(1, (char **)&ru, sizeof(*ru)) < 0)
+    return -1;
+
+  return getrusage(who, ru);
+}
+
+int sys_futex_wait(void)
+{
+  int addr, val;
+  if (argint(0, &addr) < 0 || argint(1, &val) < 0)
+    return -1;
+
+  return futex_wait(addr, val);
+}
+
+int sys_futex_wake(void)
+{
+  int addr, n;
+  if (argint(0, &addr) < 0 || argint(1, &n) < 0)
+    return -1;
+
+  return futex_wake(addr, n);
+}
+
+int sys_syscall_latency(void)
+{
+  struct syslat *lat;
+  if (argptr(0, (char **)&lat, sizeof(*lat)) < 0)
+    return -1;
+
+  syscall_latency(lat);
+  return 0;
+}
+
+int sys_kmem_stats(void)
+{
+  struct kmemstat *st;
+  int n;
+  if (argint(1, &n) < 0 || n < 0 || n > NCPU ||
+      argptr(0, (char **)&st, n * sizeof(*st)) < 0)
+    return -1;
+
+  return kmem_stats(st, n);
+}
+
+int sys_kmem_junk(void)
+{
+  int on;
+  if (argint(0, &on) < 0)
+    return -1;
+
+  return kmem_junk(on != 0);
+}
@@ -0,0 +1,1976 @@
+
+_systat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printuint>:
+    [SYS_kmem_stats] "kmem_stats",
+    [SYS_kmem_junk] "kmem_junk",
+};
+
+void printuint(uint v)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+    if (v >= 10)
+   6:	83 7d 08 09          	cmpl   $0x9,0x8(%ebp)
+   a:	76 1b                	jbe    27 <printuint+0x27>
+        printuint(v / 10);
+   c:	8b 45 08             	mov    0x8(%ebp),%eax
+   f:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+  14:	f7 e2                	mul    %edx
+  16:	89 d0                	mov    %edx,%eax
+  18:	c1 e8 03             	shr    $0x3,%eax
+  1b:	83 ec 0c             	sub    $0xc,%esp
+  1e:	50                   	push   %eax
+  1f:	e8 dc ff ff ff       	call   0 <printuint>
+  24:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d", v % 10);
+  27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  2a:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+  2f:	89 c8                	mov    %ecx,%eax
+  31:	f7 e2                	mul    %edx
+  33:	c1 ea 03             	shr    $0x3,%edx
+  36:	89 d0                	mov    %edx,%eax
+  38:	c1 e0 02             	shl    $0x2,%eax
+  3b:	01 d0                	add    %edx,%eax
+  3d:	01 c0                	add    %eax,%eax
+  3f:	29 c1                	sub    %eax,%ecx
+  41:	89 ca                	mov    %ecx,%edx
+  43:	83 ec 04             	sub    $0x4,%esp
+  46:	52                   	push   %edx
+  47:	68 ae 10 00 00       	push   $0x10ae
+  4c:	6a 01                	push   $0x1
+  4e:	e8 e6 07 00 00       	call   839 <printf>
+  53:	83 c4 10             	add    $0x10,%esp
+}
+  56:	90                   	nop
+  57:	c9                   	leave
+  58:	c3                   	ret
+
+00000059 <percentile>:
+
+// Upper bound, in cycles, of the bucket holding the pct-th
+// percentile of the count calls to num.
+uint percentile(int num, uint count, int pct)
+{
+  59:	55                   	push   %ebp
+  5a:	89 e5                	mov    %esp,%ebp
+  5c:	83 ec 10             	sub    $0x10,%esp
+    uint seen = 0;
+  5f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    int k;
+
+    for (k = 0; k < NLATBUCKET - 1; k++)
+  66:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+  6d:	eb 2c                	jmp    9b <percentile+0x42>
+    {
+        seen += lat.hist[num][k];
+  6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  72:	c1 e0 05             	shl    $0x5,%eax
+  75:	89 c2                	mov    %eax,%edx
+  77:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  7a:	01 d0                	add    %edx,%eax
+  7c:	8b 04 85 60 16 00 00 	mov    0x1660(,%eax,4),%eax
+  83:	01 45 fc             	add    %eax,-0x4(%ebp)
+        if (seen * 100 >= count * pct)
+  86:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  89:	6b d0 64             	imul   $0x64,%eax,%edx
+  8c:	8b 45 10             	mov    0x10(%ebp),%eax
+  8f:	0f af 45 0c          	imul   0xc(%ebp),%eax
+  93:	39 c2                	cmp    %eax,%edx
+  95:	73 0c                	jae    a3 <percentile+0x4a>
+    for (k = 0; k < NLATBUCKET - 1; k++)
+  97:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  9b:	83 7d f8 1e          	cmpl   $0x1e,-0x8(%ebp)
+  9f:	7e ce                	jle    6f <percentile+0x16>
+  a1:	eb 01                	jmp    a4 <percentile+0x4b>
+            break;
+  a3:	90                   	nop
+    }
+    return k == NLATBUCKET - 1 ? 0xffffffff : (2u << k) - 1;
+  a4:	83 7d f8 1f          	cmpl   $0x1f,-0x8(%ebp)
+  a8:	74 13                	je     bd <percentile+0x64>
+  aa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  ad:	ba 02 00 00 00       	mov    $0x2,%edx
+  b2:	89 c1                	mov    %eax,%ecx
+  b4:	d3 e2                	shl    %cl,%edx
+  b6:	89 d0                	mov    %edx,%eax
+  b8:	83 e8 01             	sub    $0x1,%eax
+  bb:	eb 05                	jmp    c2 <percentile+0x69>
+  bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  c2:	c9                   	leave
+  c3:	c3                   	ret
+
+000000c4 <main>:
+
+int main(int argc, char *argv[])
+{
+  c4:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  c8:	83 e4 f0             	and    $0xfffffff0,%esp
+  cb:	ff 71 fc             	push   -0x4(%ecx)
+  ce:	55                   	push   %ebp
+  cf:	89 e5                	mov    %esp,%ebp
+  d1:	51                   	push   %ecx
+  d2:	83 ec 14             	sub    $0x14,%esp
+    uint count;
+
+    if (syscall_latency(&lat) < 0)
+  d5:	83 ec 0c             	sub    $0xc,%esp
+  d8:	68 60 16 00 00       	push   $0x1660
+  dd:	e8 63 06 00 00       	call   745 <syscall_latency>
+  e2:	83 c4 10             	add    $0x10,%esp
+  e5:	85 c0                	test   %eax,%eax
+  e7:	79 17                	jns    100 <main+0x3c>
+    {
+        printf(2, "systat: cannot read latency histograms\n");
+  e9:	83 ec 08             	sub    $0x8,%esp
+  ec:	68 b4 10 00 00       	push   $0x10b4
+  f1:	6a 02                	push   $0x2
+  f3:	e8 41 07 00 00       	call   839 <printf>
+  f8:	83 c4 10             	add    $0x10,%esp
+        exit();
+  fb:	e8 cd 04 00 00       	call   5cd <exit>
+    }
+
+    printf(1, "syscall\t\t\tcalls\tp50\tp99\tmax (cycles)\n");
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	68 dc 10 00 00       	push   $0x10dc
+ 108:	6a 01                	push   $0x1
+ 10a:	e8 2a 07 00 00       	call   839 <printf>
+ 10f:	83 c4 10             	add    $0x10,%esp
+    for (int num = 0; num < NSYSCALL; num++)
+ 112:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 119:	e9 6f 01 00 00       	jmp    28d <main+0x1c9>
+    {
+        count = 0;
+ 11e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+        for (int k = 0; k < NLATBUCKET; k++)
+ 125:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 12c:	eb 1b                	jmp    149 <main+0x85>
+            count += lat.hist[num][k];
+ 12e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 131:	c1 e0 05             	shl    $0x5,%eax
+ 134:	89 c2                	mov    %eax,%edx
+ 136:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 139:	01 d0                	add    %edx,%eax
+ 13b:	8b 04 85 60 16 00 00 	mov    0x1660(,%eax,4),%eax
+ 142:	01 45 f4             	add    %eax,-0xc(%ebp)
+        for (int k = 0; k < NLATBUCKET; k++)
+ 145:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+ 149:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%ebp)
+ 14d:	7e df                	jle    12e <main+0x6a>
+        if (count == 0)
+ 14f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 153:	0f 84 2f 01 00 00    	je     288 <main+0x1c4>
+            continue;
+
+        printf(1, "%s", names[num] ? names[num] : "?");
+ 159:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 15c:	8b 04 85 40 15 00 00 	mov    0x1540(,%eax,4),%eax
+ 163:	85 c0                	test   %eax,%eax
+ 165:	74 0c                	je     173 <main+0xaf>
+ 167:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 16a:	8b 04 85 40 15 00 00 	mov    0x1540(,%eax,4),%eax
+ 171:	eb 05                	jmp    178 <main+0xb4>
+ 173:	b8 02 11 00 00       	mov    $0x1102,%eax
+ 178:	83 ec 04             	sub    $0x4,%esp
+ 17b:	50                   	push   %eax
+ 17c:	68 04 11 00 00       	push   $0x1104
+ 181:	6a 01                	push   $0x1
+ 183:	e8 b1 06 00 00       	call   839 <printf>
+ 188:	83 c4 10             	add    $0x10,%esp
+        for (int n = names[num] ? strlen(names[num]) : 1; n < 24; n += 8)
+ 18b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 18e:	8b 04 85 40 15 00 00 	mov    0x1540(,%eax,4),%eax
+ 195:	85 c0                	test   %eax,%eax
+ 197:	74 18                	je     1b1 <main+0xed>
+ 199:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 19c:	8b 04 85 40 15 00 00 	mov    0x1540(,%eax,4),%eax
+ 1a3:	83 ec 0c             	sub    $0xc,%esp
+ 1a6:	50                   	push   %eax
+ 1a7:	e8 85 01 00 00       	call   331 <strlen>
+ 1ac:	83 c4 10             	add    $0x10,%esp
+ 1af:	eb 05                	jmp    1b6 <main+0xf2>
+ 1b1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 1b6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 1b9:	eb 16                	jmp    1d1 <main+0x10d>
+            printf(1, "\t");
+ 1bb:	83 ec 08             	sub    $0x8,%esp
+ 1be:	68 07 11 00 00       	push   $0x1107
+ 1c3:	6a 01                	push   $0x1
+ 1c5:	e8 6f 06 00 00       	call   839 <printf>
+ 1ca:	83 c4 10             	add    $0x10,%esp
+        for (int n = names[num] ? strlen(names[num]) : 1; n < 24; n += 8)
+ 1cd:	83 45 e8 08          	addl   $0x8,-0x18(%ebp)
+ 1d1:	83 7d e8 17          	cmpl   $0x17,-0x18(%ebp)
+ 1d5:	7e e4                	jle    1bb <main+0xf7>
+        printuint(count);
+ 1d7:	83 ec 0c             	sub    $0xc,%esp
+ 1da:	ff 75 f4             	push   -0xc(%ebp)
+ 1dd:	e8 1e fe ff ff       	call   0 <printuint>
+ 1e2:	83 c4 10             	add    $0x10,%esp
+        printf(1, "\t");
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	68 07 11 00 00       	push   $0x1107
+ 1ed:	6a 01                	push   $0x1
+ 1ef:	e8 45 06 00 00       	call   839 <printf>
+ 1f4:	83 c4 10             	add    $0x10,%esp
+        printuint(percentile(num, count, 50));
+ 1f7:	83 ec 04             	sub    $0x4,%esp
+ 1fa:	6a 32                	push   $0x32
+ 1fc:	ff 75 f4             	push   -0xc(%ebp)
+ 1ff:	ff 75 f0             	push   -0x10(%ebp)
+ 202:	e8 52 fe ff ff       	call   59 <percentile>
+ 207:	83 c4 10             	add    $0x10,%esp
+ 20a:	83 ec 0c             	sub    $0xc,%esp
+ 20d:	50                   	push   %eax
+ 20e:	e8 ed fd ff ff       	call   0 <printuint>
+ 213:	83 c4 10             	add    $0x10,%esp
+        printf(1, "\t");
+ 216:	83 ec 08             	sub    $0x8,%esp
+ 219:	68 07 11 00 00       	push   $0x1107
+ 21e:	6a 01                	push   $0x1
+ 220:	e8 14 06 00 00       	call   839 <printf>
+ 225:	83 c4 10             	add    $0x10,%esp
+        printuint(percentile(num, count, 99));
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	6a 63                	push   $0x63
+ 22d:	ff 75 f4             	push   -0xc(%ebp)
+ 230:	ff 75 f0             	push   -0x10(%ebp)
+ 233:	e8 21 fe ff ff       	call   59 <percentile>
+ 238:	83 c4 10             	add    $0x10,%esp
+ 23b:	83 ec 0c             	sub    $0xc,%esp
+ 23e:	50                   	push   %eax
+ 23f:	e8 bc fd ff ff       	call   0 <printuint>
+ 244:	83 c4 10             	add    $0x10,%esp
+        printf(1, "\t");
+ 247:	83 ec 08             	sub    $0x8,%esp
+ 24a:	68 07 11 00 00       	push   $0x1107
+ 24f:	6a 01                	push   $0x1
+ 251:	e8 e3 05 00 00       	call   839 <printf>
+ 256:	83 c4 10             	add    $0x10,%esp
+        printuint(lat.max[num]);
+ 259:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 25c:	05 00 08 00 00       	add    $0x800,%eax
+ 261:	8b 04 85 60 16 00 00 	mov    0x1660(,%eax,4),%eax
+ 268:	83 ec 0c             	sub    $0xc,%esp
+ 26b:	50                   	push   %eax
+ 26c:	e8 8f fd ff ff       	call   0 <printuint>
+ 271:	83 c4 10             	add    $0x10,%esp
+        printf(1, "\n");
+ 274:	83 ec 08             	sub    $0x8,%esp
+ 277:	68 09 11 00 00       	push   $0x1109
+ 27c:	6a 01                	push   $0x1
+ 27e:	e8 b6 05 00 00       	call   839 <printf>
+ 283:	83 c4 10             	add    $0x10,%esp
+ 286:	eb 01                	jmp    289 <main+0x1c5>
+            continue;
+ 288:	90                   	nop
+    for (int num = 0; num < NSYSCALL; num++)
+ 289:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 28d:	83 7d f0 3f          	cmpl   $0x3f,-0x10(%ebp)
+ 291:	0f 8e 87 fe ff ff    	jle    11e <main+0x5a>
+    }
+    exit();
+ 297:	e8 31 03 00 00       	call   5cd <exit>
+
+0000029c <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 29c:	55                   	push   %ebp
+ 29d:	89 e5                	mov    %esp,%ebp
+ 29f:	57                   	push   %edi
+ 2a0:	53                   	push   %ebx
+{
+ 2a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2a4:	8b 55 10             	mov    0x10(%ebp),%edx
+ 2a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2aa:	89 cb                	mov    %ecx,%ebx
+ 2ac:	89 df                	mov    %ebx,%edi
+ 2ae:	89 d1                	mov    %edx,%ecx
+ 2b0:	fc                   	cld
+ 2b1:	f3 aa                	rep stos %al,%es:(%edi)
+ 2b3:	89 ca                	mov    %ecx,%edx
+ 2b5:	89 fb                	mov    %edi,%ebx
+ 2b7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 2ba:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 2bd:	90                   	nop
+ 2be:	5b                   	pop    %ebx
+ 2bf:	5f                   	pop    %edi
+ 2c0:	5d                   	pop    %ebp
+ 2c1:	c3                   	ret
+
+000002c2 <strcpy>:
+{
+ 2c2:	55                   	push   %ebp
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 2c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 2ce:	90                   	nop
+ 2cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2d2:	8d 42 01             	lea    0x1(%edx),%eax
+ 2d5:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 2d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2db:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2de:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 2e1:	0f b6 12             	movzbl (%edx),%edx
+ 2e4:	88 10                	mov    %dl,(%eax)
+ 2e6:	0f b6 00             	movzbl (%eax),%eax
+ 2e9:	84 c0                	test   %al,%al
+ 2eb:	75 e2                	jne    2cf <strcpy+0xd>
+  return os;
+ 2ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2f0:	c9                   	leave
+ 2f1:	c3                   	ret
+
+000002f2 <strcmp>:
+{
+ 2f2:	55                   	push   %ebp
+ 2f3:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 2f5:	eb 08                	jmp    2ff <strcmp+0xd>
+    p++, q++;
+ 2f7:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2fb:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 2ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 302:	0f b6 00             	movzbl (%eax),%eax
+ 305:	84 c0                	test   %al,%al
+ 307:	74 10                	je     319 <strcmp+0x27>
+ 309:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30c:	0f b6 10             	movzbl (%eax),%edx
+ 30f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 312:	0f b6 00             	movzbl (%eax),%eax
+ 315:	38 c2                	cmp    %al,%dl
+ 317:	74 de                	je     2f7 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 319:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31c:	0f b6 00             	movzbl (%eax),%eax
+ 31f:	0f b6 d0             	movzbl %al,%edx
+ 322:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 325:	0f b6 00             	movzbl (%eax),%eax
+ 328:	0f b6 c0             	movzbl %al,%eax
+ 32b:	29 c2                	sub    %eax,%edx
+ 32d:	89 d0                	mov    %edx,%eax
+}
+ 32f:	5d                   	pop    %ebp
+ 330:	c3                   	ret
+
+00000331 <strlen>:
+{
+ 331:	55                   	push   %ebp
+ 332:	89 e5                	mov    %esp,%ebp
+ 334:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 337:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 33e:	eb 04                	jmp    344 <strlen+0x13>
+ 340:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 344:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 347:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34a:	01 d0                	add    %edx,%eax
+ 34c:	0f b6 00             	movzbl (%eax),%eax
+ 34f:	84 c0                	test   %al,%al
+ 351:	75 ed                	jne    340 <strlen+0xf>
+  return n;
+ 353:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 356:	c9                   	leave
+ 357:	c3                   	ret
+
+00000358 <memset>:
+{
+ 358:	55                   	push   %ebp
+ 359:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 35b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 35e:	50                   	push   %eax
+ 35f:	ff 75 0c             	push   0xc(%ebp)
+ 362:	ff 75 08             	push   0x8(%ebp)
+ 365:	e8 32 ff ff ff       	call   29c <stosb>
+ 36a:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 36d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 370:	c9                   	leave
+ 371:	c3                   	ret
+
+00000372 <strchr>:
+{
+ 372:	55                   	push   %ebp
+ 373:	89 e5                	mov    %esp,%ebp
+ 375:	83 ec 04             	sub    $0x4,%esp
+ 378:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 37b:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 37e:	eb 14                	jmp    394 <strchr+0x22>
+    if(*s == c)
+ 380:	8b 45 08             	mov    0x8(%ebp),%eax
+ 383:	0f b6 00             	movzbl (%eax),%eax
+ 386:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 389:	75 05                	jne    390 <strchr+0x1e>
+      return (char*)s;
+ 38b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38e:	eb 13                	jmp    3a3 <strchr+0x31>
+  for(; *s; s++)
+ 390:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 394:	8b 45 08             	mov    0x8(%ebp),%eax
+ 397:	0f b6 00             	movzbl (%eax),%eax
+ 39a:	84 c0                	test   %al,%al
+ 39c:	75 e2                	jne    380 <strchr+0xe>
+  return 0;
+ 39e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3a3:	c9                   	leave
+ 3a4:	c3                   	ret
+
+000003a5 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3a5:	55                   	push   %ebp
+ 3a6:	89 e5                	mov    %esp,%ebp
+ 3a8:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3ab:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3b2:	eb 42                	jmp    3f6 <gets+0x51>
+    cc = read(0, &c, 1);
+ 3b4:	83 ec 04             	sub    $0x4,%esp
+ 3b7:	6a 01                	push   $0x1
+ 3b9:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 3bc:	50                   	push   %eax
+ 3bd:	6a 00                	push   $0x0
+ 3bf:	e8 21 02 00 00       	call   5e5 <read>
+ 3c4:	83 c4 10             	add    $0x10,%esp
+ 3c7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 3ca:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 3ce:	7e 33                	jle    403 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 3d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3d3:	8d 50 01             	lea    0x1(%eax),%edx
+ 3d6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3d9:	89 c2                	mov    %eax,%edx
+ 3db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3de:	01 c2                	add    %eax,%edx
+ 3e0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3e4:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 3e6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3ea:	3c 0a                	cmp    $0xa,%al
+ 3ec:	74 16                	je     404 <gets+0x5f>
+ 3ee:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3f2:	3c 0d                	cmp    $0xd,%al
+ 3f4:	74 0e                	je     404 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 3f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3f9:	83 c0 01             	add    $0x1,%eax
+ 3fc:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 3ff:	7f b3                	jg     3b4 <gets+0xf>
+ 401:	eb 01                	jmp    404 <gets+0x5f>
+      break;
+ 403:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 404:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 407:	8b 45 08             	mov    0x8(%ebp),%eax
+ 40a:	01 d0                	add    %edx,%eax
+ 40c:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 40f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 412:	c9                   	leave
+ 413:	c3                   	ret
+
+00000414 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 414:	55                   	push   %ebp
+ 415:	89 e5                	mov    %esp,%ebp
+ 417:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 41a:	83 ec 08             	sub    $0x8,%esp
+ 41d:	6a 00                	push   $0x0
+ 41f:	ff 75 08             	push   0x8(%ebp)
+ 422:	e8 e6 01 00 00       	call   60d <open>
+ 427:	83 c4 10             	add    $0x10,%esp
+ 42a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 42d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 431:	79 07                	jns    43a <stat+0x26>
+    return -1;
+ 433:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 438:	eb 25                	jmp    45f <stat+0x4b>
+  r = fstat(fd, st);
+ 43a:	83 ec 08             	sub    $0x8,%esp
+ 43d:	ff 75 0c             	push   0xc(%ebp)
+ 440:	ff 75 f4             	push   -0xc(%ebp)
+ 443:	e8 dd 01 00 00       	call   625 <fstat>
+ 448:	83 c4 10             	add    $0x10,%esp
+ 44b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 44e:	83 ec 0c             	sub    $0xc,%esp
+ 451:	ff 75 f4             	push   -0xc(%ebp)
+ 454:	e8 9c 01 00 00       	call   5f5 <close>
+ 459:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 45c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 45f:	c9                   	leave
+ 460:	c3                   	ret
+
+00000461 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 461:	55                   	push   %ebp
+ 462:	89 e5                	mov    %esp,%ebp
+ 464:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 467:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 46e:	eb 25                	jmp    495 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 470:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 473:	89 d0                	mov    %edx,%eax
+ 475:	c1 e0 02             	shl    $0x2,%eax
+ 478:	01 d0                	add    %edx,%eax
+ 47a:	01 c0                	add    %eax,%eax
+ 47c:	89 c1                	mov    %eax,%ecx
+ 47e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 481:	8d 50 01             	lea    0x1(%eax),%edx
+ 484:	89 55 08             	mov    %edx,0x8(%ebp)
+ 487:	0f b6 00             	movzbl (%eax),%eax
+ 48a:	0f be c0             	movsbl %al,%eax
+ 48d:	01 c8                	add    %ecx,%eax
+ 48f:	83 e8 30             	sub    $0x30,%eax
+ 492:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 495:	8b 45 08             	mov    0x8(%ebp),%eax
+ 498:	0f b6 00             	movzbl (%eax),%eax
+ 49b:	3c 2f                	cmp    $0x2f,%al
+ 49d:	7e 0a                	jle    4a9 <atoi+0x48>
+ 49f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a2:	0f b6 00             	movzbl (%eax),%eax
+ 4a5:	3c 39                	cmp    $0x39,%al
+ 4a7:	7e c7                	jle    470 <atoi+0xf>
+  return n;
+ 4a9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4ac:	c9                   	leave
+ 4ad:	c3                   	ret
+
+000004ae <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4ae:	55                   	push   %ebp
+ 4af:	89 e5                	mov    %esp,%ebp
+ 4b1:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 4b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4bd:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 4c0:	eb 17                	jmp    4d9 <memmove+0x2b>
+    *dst++ = *src++;
+ 4c2:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4c5:	8d 42 01             	lea    0x1(%edx),%eax
+ 4c8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4ce:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4d1:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4d4:	0f b6 12             	movzbl (%edx),%edx
+ 4d7:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 4d9:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4dc:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4df:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4e2:	85 c0                	test   %eax,%eax
+ 4e4:	7f dc                	jg     4c2 <memmove+0x14>
+  return vdst;
+ 4e6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4e9:	c9                   	leave
+ 4ea:	c3                   	ret
+
+000004eb <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 4eb:	55                   	push   %ebp
+ 4ec:	89 e5                	mov    %esp,%ebp
+ 4ee:	57                   	push   %edi
+ 4ef:	56                   	push   %esi
+ 4f0:	83 ec 30             	sub    $0x30,%esp
+ 4f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 4f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4fc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 4ff:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 506:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 50d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 510:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 513:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 516:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 519:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 520:	e9 89 00 00 00       	jmp    5ae <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 525:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 528:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 52b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 52f:	01 c0                	add    %eax,%eax
+ 531:	89 c6                	mov    %eax,%esi
+ 533:	89 d7                	mov    %edx,%edi
+ 535:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 538:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 53b:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 53e:	0f ad d0             	shrd   %cl,%edx,%eax
+ 541:	d3 ea                	shr    %cl,%edx
+ 543:	f6 c1 20             	test   $0x20,%cl
+ 546:	74 04                	je     54c <udiv64+0x61>
+ 548:	89 d0                	mov    %edx,%eax
+ 54a:	31 d2                	xor    %edx,%edx
+ 54c:	83 e0 01             	and    $0x1,%eax
+ 54f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 552:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 559:	89 f0                	mov    %esi,%eax
+ 55b:	89 fa                	mov    %edi,%edx
+ 55d:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 560:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 563:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 566:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 569:	8b 45 10             	mov    0x10(%ebp),%eax
+ 56c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 571:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 574:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 577:	19 d1                	sbb    %edx,%ecx
+ 579:	72 2f                	jb     5aa <udiv64+0xbf>
+      r -= d;
+ 57b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 57e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 583:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 586:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 589:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 58c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 591:	ba 00 00 00 00       	mov    $0x0,%edx
+ 596:	0f a5 c2             	shld   %cl,%eax,%edx
+ 599:	d3 e0                	shl    %cl,%eax
+ 59b:	f6 c1 20             	test   $0x20,%cl
+ 59e:	74 04                	je     5a4 <udiv64+0xb9>
+ 5a0:	89 c2                	mov    %eax,%edx
+ 5a2:	31 c0                	xor    %eax,%eax
+ 5a4:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 5a7:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 5aa:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 5ae:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 5b2:	0f 89 6d ff ff ff    	jns    525 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 5b8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5bb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 5be:	83 c4 30             	add    $0x30,%esp
+ 5c1:	5e                   	pop    %esi
+ 5c2:	5f                   	pop    %edi
+ 5c3:	5d                   	pop    %ebp
+ 5c4:	c3                   	ret
+
+000005c5 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5c5:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5ca:	cd 40                	int    $0x40
+ 5cc:	c3                   	ret
+
+000005cd <exit>:
+SYSCALL(exit)
+ 5cd:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5d2:	cd 40                	int    $0x40
+ 5d4:	c3                   	ret
+
+000005d5 <wait>:
+SYSCALL(wait)
+ 5d5:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5da:	cd 40                	int    $0x40
+ 5dc:	c3                   	ret
+
+000005dd <pipe>:
+SYSCALL(pipe)
+ 5dd:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5e2:	cd 40                	int    $0x40
+ 5e4:	c3                   	ret
+
+000005e5 <read>:
+SYSCALL(read)
+ 5e5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5ea:	cd 40                	int    $0x40
+ 5ec:	c3                   	ret
+
+000005ed <write>:
+SYSCALL(write)
+ 5ed:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5f2:	cd 40                	int    $0x40
+ 5f4:	c3                   	ret
+
+000005f5 <close>:
+SYSCALL(close)
+ 5f5:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5fa:	cd 40                	int    $0x40
+ 5fc:	c3                   	ret
+
+000005fd <kill>:
+SYSCALL(kill)
+ 5fd:	b8 06 00 00 00       	mov    $0x6,%eax
+ 602:	cd 40                	int    $0x40
+ 604:	c3                   	ret
+
+00000605 <exec>:
+SYSCALL(exec)
+ 605:	b8 07 00 00 00       	mov    $0x7,%eax
+ 60a:	cd 40                	int    $0x40
+ 60c:	c3                   	ret
+
+0000060d <open>:
+SYSCALL(open)
+ 60d:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 612:	cd 40                	int    $0x40
+ 614:	c3                   	ret
+
+00000615 <mknod>:
+SYSCALL(mknod)
+ 615:	b8 11 00 00 00       	mov    $0x11,%eax
+ 61a:	cd 40                	int    $0x40
+ 61c:	c3                   	ret
+
+0000061d <unlink>:
+SYSCALL(unlink)
+ 61d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 622:	cd 40                	int    $0x40
+ 624:	c3                   	ret
+
+00000625 <fstat>:
+SYSCALL(fstat)
+ 625:	b8 08 00 00 00       	mov    $0x8,%eax
+ 62a:	cd 40                	int    $0x40
+ 62c:	c3                   	ret
+
+0000062d <link>:
+SYSCALL(link)
+ 62d:	b8 13 00 00 00       	mov    $0x13,%eax
+ 632:	cd 40                	int    $0x40
+ 634:	c3                   	ret
+
+00000635 <mkdir>:
+SYSCALL(mkdir)
+ 635:	b8 14 00 00 00       	mov    $0x14,%eax
+ 63a:	cd 40                	int    $0x40
+ 63c:	c3                   	ret
+
+0000063d <chdir>:
+SYSCALL(chdir)
+ 63d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 642:	cd 40                	int    $0x40
+ 644:	c3                   	ret
+
+00000645 <dup>:
+SYSCALL(dup)
+ 645:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 64a:	cd 40                	int    $0x40
+ 64c:	c3                   	ret
+
+0000064d <getpid>:
+SYSCALL(getpid)
+ 64d:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 652:	cd 40                	int    $0x40
+ 654:	c3                   	ret
+
+00000655 <sbrk>:
+SYSCALL(sbrk)
+ 655:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 65a:	cd 40                	int    $0x40
+ 65c:	c3                   	ret
+
+0000065d <sleep>:
+SYSCALL(sleep)
+ 65d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 662:	cd 40                	int    $0x40
+ 664:	c3                   	ret
+
+00000665 <uptime>:
+SYSCALL(uptime)
+ 665:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 66a:	cd 40                	int    $0x40
+ 66c:	c3                   	ret
+
+0000066d <find_digital_root>:
+SYSCALL(find_digital_root)
+ 66d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 672:	cd 40                	int    $0x40
+ 674:	c3                   	ret
+
+00000675 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 675:	b8 17 00 00 00       	mov    $0x17,%eax
+ 67a:	cd 40                	int    $0x40
+ 67c:	c3                   	ret
+
+0000067d <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 67d:	b8 18 00 00 00       	mov    $0x18,%eax
+ 682:	cd 40                	int    $0x40
+ 684:	c3                   	ret
+
+00000685 <copy_file>:
+SYSCALL(copy_file)
+ 685:	b8 19 00 00 00       	mov    $0x19,%eax
+ 68a:	cd 40                	int    $0x40
+ 68c:	c3                   	ret
+
+0000068d <change_queue>:
+SYSCALL(change_queue)
+ 68d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 692:	cd 40                	int    $0x40
+ 694:	c3                   	ret
+
+00000695 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 695:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 69a:	cd 40                	int    $0x40
+ 69c:	c3                   	ret
+
+0000069d <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 69d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6a2:	cd 40                	int    $0x40
+ 6a4:	c3                   	ret
+
+000006a5 <print_process_info>:
+SYSCALL(print_process_info)
+ 6a5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6aa:	cd 40                	int    $0x40
+ 6ac:	c3                   	ret
+
+000006ad <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 6ad:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6b2:	cd 40                	int    $0x40
+ 6b4:	c3                   	ret
+
+000006b5 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 6b5:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6ba:	cd 40                	int    $0x40
+ 6bc:	c3                   	ret
+
+000006bd <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 6bd:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6c2:	cd 40                	int    $0x40
+ 6c4:	c3                   	ret
+
+000006c5 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 6c5:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6ca:	cd 40                	int    $0x40
+ 6cc:	c3                   	ret
+
+000006cd <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 6cd:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6d2:	cd 40                	int    $0x40
+ 6d4:	c3                   	ret
+
+000006d5 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 6d5:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6da:	cd 40                	int    $0x40
+ 6dc:	c3                   	ret
+
+000006dd <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 6dd:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6e2:	cd 40                	int    $0x40
+ 6e4:	c3                   	ret
+
+000006e5 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 6e5:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6ea:	cd 40                	int    $0x40
+ 6ec:	c3                   	ret
+
+000006ed <set_affinity>:
+SYSCALL(set_affinity)
+ 6ed:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6f2:	cd 40                	int    $0x40
+ 6f4:	c3                   	ret
+
+000006f5 <setsched>:
+SYSCALL(setsched)
+ 6f5:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6fa:	cd 40                	int    $0x40
+ 6fc:	c3                   	ret
+
+000006fd <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 6fd:	b8 28 00 00 00       	mov    $0x28,%eax
+ 702:	cd 40                	int    $0x40
+ 704:	c3                   	ret
+
+00000705 <set_quantum>:
+SYSCALL(set_quantum)
+ 705:	b8 29 00 00 00       	mov    $0x29,%eax
+ 70a:	cd 40                	int    $0x40
+ 70c:	c3                   	ret
+
+0000070d <schedtrace>:
+SYSCALL(schedtrace)
+ 70d:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 712:	cd 40                	int    $0x40
+ 714:	c3                   	ret
+
+00000715 <getrusage>:
+SYSCALL(getrusage)
+ 715:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 71a:	cd 40                	int    $0x40
+ 71c:	c3                   	ret
+
+0000071d <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 71d:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 722:	cd 40                	int    $0x40
+ 724:	c3                   	ret
+
+00000725 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 725:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 72a:	cd 40                	int    $0x40
+ 72c:	c3                   	ret
+
+0000072d <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 72d:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 732:	cd 40                	int    $0x40
+ 734:	c3                   	ret
+
+00000735 <futex_wait>:
+SYSCALL(futex_wait)
+ 735:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 73a:	cd 40                	int    $0x40
+ 73c:	c3                   	ret
+
+0000073d <futex_wake>:
+SYSCALL(futex_wake)
+ 73d:	b8 30 00 00 00       	mov    $0x30,%eax
+ 742:	cd 40                	int    $0x40
+ 744:	c3                   	ret
+
+00000745 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 745:	b8 31 00 00 00       	mov    $0x31,%eax
+ 74a:	cd 40                	int    $0x40
+ 74c:	c3                   	ret
+
+0000074d <submit_batch>:
+SYSCALL(submit_batch)
+ 74d:	b8 32 00 00 00       	mov    $0x32,%eax
+ 752:	cd 40                	int    $0x40
+ 754:	c3                   	ret
+
+00000755 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 755:	b8 33 00 00 00       	mov    $0x33,%eax
+ 75a:	cd 40                	int    $0x40
+ 75c:	c3                   	ret
+
+0000075d <kmem_junk>:
+SYSCALL(kmem_junk)
+ 75d:	b8 34 00 00 00       	mov    $0x34,%eax
+ 762:	cd 40                	int    $0x40
+ 764:	c3                   	ret
+
+00000765 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 765:	55                   	push   %ebp
+ 766:	89 e5                	mov    %esp,%ebp
+ 768:	83 ec 18             	sub    $0x18,%esp
+ 76b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 76e:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 771:	83 ec 04             	sub    $0x4,%esp
+ 774:	6a 01                	push   $0x1
+ 776:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 779:	50                   	push   %eax
+ 77a:	ff 75 08             	push   0x8(%ebp)
+ 77d:	e8 6b fe ff ff       	call   5ed <write>
+ 782:	83 c4 10             	add    $0x10,%esp
+}
+ 785:	90                   	nop
+ 786:	c9                   	leave
+ 787:	c3                   	ret
+
+00000788 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 788:	55                   	push   %ebp
+ 789:	89 e5                	mov    %esp,%ebp
+ 78b:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 78e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 795:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 799:	74 17                	je     7b2 <printint+0x2a>
+ 79b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 79f:	79 11                	jns    7b2 <printint+0x2a>
+    neg = 1;
+ 7a1:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 7a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7ab:	f7 d8                	neg    %eax
+ 7ad:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7b0:	eb 06                	jmp    7b8 <printint+0x30>
+  } else {
+    x = xx;
+ 7b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7b5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 7b8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 7bf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7c2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7c5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7ca:	f7 f1                	div    %ecx
+ 7cc:	89 d1                	mov    %edx,%ecx
+ 7ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d1:	8d 50 01             	lea    0x1(%eax),%edx
+ 7d4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7d7:	0f b6 91 40 16 00 00 	movzbl 0x1640(%ecx),%edx
+ 7de:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 7e2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7e5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7e8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7ed:	f7 f1                	div    %ecx
+ 7ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7f6:	75 c7                	jne    7bf <printint+0x37>
+  if(neg)
+ 7f8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7fc:	74 2d                	je     82b <printint+0xa3>
+    buf[i++] = '-';
+ 7fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 801:	8d 50 01             	lea    0x1(%eax),%edx
+ 804:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 807:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 80c:	eb 1d                	jmp    82b <printint+0xa3>
+    putc(fd, buf[i]);
+ 80e:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 811:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 814:	01 d0                	add    %edx,%eax
+ 816:	0f b6 00             	movzbl (%eax),%eax
+ 819:	0f be c0             	movsbl %al,%eax
+ 81c:	83 ec 08             	sub    $0x8,%esp
+ 81f:	50                   	push   %eax
+ 820:	ff 75 08             	push   0x8(%ebp)
+ 823:	e8 3d ff ff ff       	call   765 <putc>
+ 828:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 82b:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 82f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 833:	79 d9                	jns    80e <printint+0x86>
+}
+ 835:	90                   	nop
+ 836:	90                   	nop
+ 837:	c9                   	leave
+ 838:	c3                   	ret
+
+00000839 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 839:	55                   	push   %ebp
+ 83a:	89 e5                	mov    %esp,%ebp
+ 83c:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 83f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 846:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 849:	83 c0 04             	add    $0x4,%eax
+ 84c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 84f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 856:	e9 59 01 00 00       	jmp    9b4 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 85b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 85e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 861:	01 d0                	add    %edx,%eax
+ 863:	0f b6 00             	movzbl (%eax),%eax
+ 866:	0f be c0             	movsbl %al,%eax
+ 869:	25 ff 00 00 00       	and    $0xff,%eax
+ 86e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 871:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 875:	75 2c                	jne    8a3 <printf+0x6a>
+      if(c == '%'){
+ 877:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 87b:	75 0c                	jne    889 <printf+0x50>
+        state = '%';
+ 87d:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 884:	e9 27 01 00 00       	jmp    9b0 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 889:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 88c:	0f be c0             	movsbl %al,%eax
+ 88f:	83 ec 08             	sub    $0x8,%esp
+ 892:	50                   	push   %eax
+ 893:	ff 75 08             	push   0x8(%ebp)
+ 896:	e8 ca fe ff ff       	call   765 <putc>
+ 89b:	83 c4 10             	add    $0x10,%esp
+ 89e:	e9 0d 01 00 00       	jmp    9b0 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 8a3:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 8a7:	0f 85 03 01 00 00    	jne    9b0 <printf+0x177>
+      if(c == 'd'){
+ 8ad:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 8b1:	75 1e                	jne    8d1 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 8b3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8b6:	8b 00                	mov    (%eax),%eax
+ 8b8:	6a 01                	push   $0x1
+ 8ba:	6a 0a                	push   $0xa
+ 8bc:	50                   	push   %eax
+ 8bd:	ff 75 08             	push   0x8(%ebp)
+ 8c0:	e8 c3 fe ff ff       	call   788 <printint>
+ 8c5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8c8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8cc:	e9 d8 00 00 00       	jmp    9a9 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 8d1:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 8d5:	74 06                	je     8dd <printf+0xa4>
+ 8d7:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 8db:	75 1e                	jne    8fb <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 8dd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8e0:	8b 00                	mov    (%eax),%eax
+ 8e2:	6a 00                	push   $0x0
+ 8e4:	6a 10                	push   $0x10
+ 8e6:	50                   	push   %eax
+ 8e7:	ff 75 08             	push   0x8(%ebp)
+ 8ea:	e8 99 fe ff ff       	call   788 <printint>
+ 8ef:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8f2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8f6:	e9 ae 00 00 00       	jmp    9a9 <printf+0x170>
+      } else if(c == 's'){
+ 8fb:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 8ff:	75 43                	jne    944 <printf+0x10b>
+        s = (char*)*ap;
+ 901:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 904:	8b 00                	mov    (%eax),%eax
+ 906:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 909:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 90d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 911:	75 25                	jne    938 <printf+0xff>
+          s = "(null)";
+ 913:	c7 45 f4 0b 11 00 00 	movl   $0x110b,-0xc(%ebp)
+        while(*s != 0){
+ 91a:	eb 1c                	jmp    938 <printf+0xff>
+          putc(fd, *s);
+ 91c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 91f:	0f b6 00             	movzbl (%eax),%eax
+ 922:	0f be c0             	movsbl %al,%eax
+ 925:	83 ec 08             	sub    $0x8,%esp
+ 928:	50                   	push   %eax
+ 929:	ff 75 08             	push   0x8(%ebp)
+ 92c:	e8 34 fe ff ff       	call   765 <putc>
+ 931:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 934:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 938:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 93b:	0f b6 00             	movzbl (%eax),%eax
+ 93e:	84 c0                	test   %al,%al
+ 940:	75 da                	jne    91c <printf+0xe3>
+ 942:	eb 65                	jmp    9a9 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 944:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 948:	75 1d                	jne    967 <printf+0x12e>
+        putc(fd, *ap);
+ 94a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 94d:	8b 00                	mov    (%eax),%eax
+ 94f:	0f be c0             	movsbl %al,%eax
+ 952:	83 ec 08             	sub    $0x8,%esp
+ 955:	50                   	push   %eax
+ 956:	ff 75 08             	push   0x8(%ebp)
+ 959:	e8 07 fe ff ff       	call   765 <putc>
+ 95e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 961:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 965:	eb 42                	jmp    9a9 <printf+0x170>
+      } else if(c == '%'){
+ 967:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 96b:	75 17                	jne    984 <printf+0x14b>
+        putc(fd, c);
+ 96d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 970:	0f be c0             	movsbl %al,%eax
+ 973:	83 ec 08             	sub    $0x8,%esp
+ 976:	50                   	push   %eax
+ 977:	ff 75 08             	push   0x8(%ebp)
+ 97a:	e8 e6 fd ff ff       	call   765 <putc>
+ 97f:	83 c4 10             	add    $0x10,%esp
+ 982:	eb 25                	jmp    9a9 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 984:	83 ec 08             	sub    $0x8,%esp
+ 987:	6a 25                	push   $0x25
+ 989:	ff 75 08             	push   0x8(%ebp)
+ 98c:	e8 d4 fd ff ff       	call   765 <putc>
+ 991:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 994:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 997:	0f be c0             	movsbl %al,%eax
+ 99a:	83 ec 08             	sub    $0x8,%esp
+ 99d:	50                   	push   %eax
+ 99e:	ff 75 08             	push   0x8(%ebp)
+ 9a1:	e8 bf fd ff ff       	call   765 <putc>
+ 9a6:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 9a9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9b0:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 9b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9b7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9ba:	01 d0                	add    %edx,%eax
+ 9bc:	0f b6 00             	movzbl (%eax),%eax
+ 9bf:	84 c0                	test   %al,%al
+ 9c1:	0f 85 94 fe ff ff    	jne    85b <printf+0x22>
+    }
+  }
+}
+ 9c7:	90                   	nop
+ 9c8:	90                   	nop
+ 9c9:	c9                   	leave
+ 9ca:	c3                   	ret
+
+000009cb <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9cb:	55                   	push   %ebp
+ 9cc:	89 e5                	mov    %esp,%ebp
+ 9ce:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 9d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9d4:	83 e8 08             	sub    $0x8,%eax
+ 9d7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9da:	a1 68 37 00 00       	mov    0x3768,%eax
+ 9df:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9e2:	eb 24                	jmp    a08 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9e4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e7:	8b 00                	mov    (%eax),%eax
+ 9e9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9ec:	72 12                	jb     a00 <free+0x35>
+ 9ee:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9f1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9f4:	72 24                	jb     a1a <free+0x4f>
+ 9f6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f9:	8b 00                	mov    (%eax),%eax
+ 9fb:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9fe:	72 1a                	jb     a1a <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a00:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a03:	8b 00                	mov    (%eax),%eax
+ a05:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a08:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a0b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a0e:	73 d4                	jae    9e4 <free+0x19>
+ a10:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a13:	8b 00                	mov    (%eax),%eax
+ a15:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a18:	73 ca                	jae    9e4 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a1a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a1d:	8b 40 04             	mov    0x4(%eax),%eax
+ a20:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a27:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a2a:	01 c2                	add    %eax,%edx
+ a2c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a2f:	8b 00                	mov    (%eax),%eax
+ a31:	39 c2                	cmp    %eax,%edx
+ a33:	75 24                	jne    a59 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ a35:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a38:	8b 50 04             	mov    0x4(%eax),%edx
+ a3b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a3e:	8b 00                	mov    (%eax),%eax
+ a40:	8b 40 04             	mov    0x4(%eax),%eax
+ a43:	01 c2                	add    %eax,%edx
+ a45:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a48:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a4b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a4e:	8b 00                	mov    (%eax),%eax
+ a50:	8b 10                	mov    (%eax),%edx
+ a52:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a55:	89 10                	mov    %edx,(%eax)
+ a57:	eb 0a                	jmp    a63 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a59:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a5c:	8b 10                	mov    (%eax),%edx
+ a5e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a61:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ a63:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a66:	8b 40 04             	mov    0x4(%eax),%eax
+ a69:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a70:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a73:	01 d0                	add    %edx,%eax
+ a75:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a78:	75 20                	jne    a9a <free+0xcf>
+    p->s.size += bp->s.size;
+ a7a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a7d:	8b 50 04             	mov    0x4(%eax),%edx
+ a80:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a83:	8b 40 04             	mov    0x4(%eax),%eax
+ a86:	01 c2                	add    %eax,%edx
+ a88:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a8b:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ a8e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a91:	8b 10                	mov    (%eax),%edx
+ a93:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a96:	89 10                	mov    %edx,(%eax)
+ a98:	eb 08                	jmp    aa2 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ a9a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a9d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ aa0:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ aa2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa5:	a3 68 37 00 00       	mov    %eax,0x3768
+}
+ aaa:	90                   	nop
+ aab:	c9                   	leave
+ aac:	c3                   	ret
+
+00000aad <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ aad:	55                   	push   %ebp
+ aae:	89 e5                	mov    %esp,%ebp
+ ab0:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ ab3:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ aba:	77 07                	ja     ac3 <morecore+0x16>
+    nu = 4096;
+ abc:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac6:	c1 e0 03             	shl    $0x3,%eax
+ ac9:	83 ec 0c             	sub    $0xc,%esp
+ acc:	50                   	push   %eax
+ acd:	e8 83 fb ff ff       	call   655 <sbrk>
+ ad2:	83 c4 10             	add    $0x10,%esp
+ ad5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ ad8:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ adc:	75 07                	jne    ae5 <morecore+0x38>
+    return 0;
+ ade:	b8 00 00 00 00       	mov    $0x0,%eax
+ ae3:	eb 26                	jmp    b0b <morecore+0x5e>
+  hp = (Header*)p;
+ ae5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ aeb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aee:	8b 55 08             	mov    0x8(%ebp),%edx
+ af1:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ af4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ af7:	83 c0 08             	add    $0x8,%eax
+ afa:	83 ec 0c             	sub    $0xc,%esp
+ afd:	50                   	push   %eax
+ afe:	e8 c8 fe ff ff       	call   9cb <free>
+ b03:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ b06:	a1 68 37 00 00       	mov    0x3768,%eax
+}
+ b0b:	c9                   	leave
+ b0c:	c3                   	ret
+
+00000b0d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b0d:	55                   	push   %ebp
+ b0e:	89 e5                	mov    %esp,%ebp
+ b10:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b13:	8b 45 08             	mov    0x8(%ebp),%eax
+ b16:	83 c0 07             	add    $0x7,%eax
+ b19:	c1 e8 03             	shr    $0x3,%eax
+ b1c:	83 c0 01             	add    $0x1,%eax
+ b1f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ b22:	a1 68 37 00 00       	mov    0x3768,%eax
+ b27:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b2a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b2e:	75 23                	jne    b53 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ b30:	c7 45 f0 60 37 00 00 	movl   $0x3760,-0x10(%ebp)
+ b37:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b3a:	a3 68 37 00 00       	mov    %eax,0x3768
+ b3f:	a1 68 37 00 00       	mov    0x3768,%eax
+ b44:	a3 60 37 00 00       	mov    %eax,0x3760
+    base.s.size = 0;
+ b49:	c7 05 64 37 00 00 00 	movl   $0x0,0x3764
+ b50:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b53:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b56:	8b 00                	mov    (%eax),%eax
+ b58:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b5e:	8b 40 04             	mov    0x4(%eax),%eax
+ b61:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b64:	72 4d                	jb     bb3 <malloc+0xa6>
+      if(p->s.size == nunits)
+ b66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b69:	8b 40 04             	mov    0x4(%eax),%eax
+ b6c:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b6f:	75 0c                	jne    b7d <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ b71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b74:	8b 10                	mov    (%eax),%edx
+ b76:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b79:	89 10                	mov    %edx,(%eax)
+ b7b:	eb 26                	jmp    ba3 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ b7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b80:	8b 40 04             	mov    0x4(%eax),%eax
+ b83:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b86:	89 c2                	mov    %eax,%edx
+ b88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b8b:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ b8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b91:	8b 40 04             	mov    0x4(%eax),%eax
+ b94:	c1 e0 03             	shl    $0x3,%eax
+ b97:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ b9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b9d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ ba0:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ ba3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ba6:	a3 68 37 00 00       	mov    %eax,0x3768
+      return (void*)(p + 1);
+ bab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bae:	83 c0 08             	add    $0x8,%eax
+ bb1:	eb 3b                	jmp    bee <malloc+0xe1>
+    }
+    if(p == freep)
+ bb3:	a1 68 37 00 00       	mov    0x3768,%eax
+ bb8:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ bbb:	75 1e                	jne    bdb <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ bbd:	83 ec 0c             	sub    $0xc,%esp
+ bc0:	ff 75 ec             	push   -0x14(%ebp)
+ bc3:	e8 e5 fe ff ff       	call   aad <morecore>
+ bc8:	83 c4 10             	add    $0x10,%esp
+ bcb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ bce:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bd2:	75 07                	jne    bdb <malloc+0xce>
+        return 0;
+ bd4:	b8 00 00 00 00       	mov    $0x0,%eax
+ bd9:	eb 13                	jmp    bee <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bdb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bde:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ be1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ be4:	8b 00                	mov    (%eax),%eax
+ be6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ be9:	e9 6d ff ff ff       	jmp    b5b <malloc+0x4e>
+  }
+}
+ bee:	c9                   	leave
+ bef:	c3                   	ret
+
+00000bf0 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ bf0:	55                   	push   %ebp
+ bf1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ bfc:	90                   	nop
+ bfd:	5d                   	pop    %ebp
+ bfe:	c3                   	ret
+
+00000bff <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ bff:	55                   	push   %ebp
+ c00:	89 e5                	mov    %esp,%ebp
+ c02:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ c05:	8b 55 08             	mov    0x8(%ebp),%edx
+ c08:	b8 00 00 00 00       	mov    $0x0,%eax
+ c0d:	b9 01 00 00 00       	mov    $0x1,%ecx
+ c12:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c16:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c19:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c1d:	74 3b                	je     c5a <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ c1f:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ c23:	74 2d                	je     c52 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ c25:	8b 55 08             	mov    0x8(%ebp),%edx
+ c28:	b8 02 00 00 00       	mov    $0x2,%eax
+ c2d:	87 02                	xchg   %eax,(%edx)
+ c2f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ c32:	eb 1e                	jmp    c52 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ c34:	8b 45 08             	mov    0x8(%ebp),%eax
+ c37:	83 ec 08             	sub    $0x8,%esp
+ c3a:	6a 02                	push   $0x2
+ c3c:	50                   	push   %eax
+ c3d:	e8 f3 fa ff ff       	call   735 <futex_wait>
+ c42:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ c45:	8b 55 08             	mov    0x8(%ebp),%edx
+ c48:	b8 02 00 00 00       	mov    $0x2,%eax
+ c4d:	87 02                	xchg   %eax,(%edx)
+ c4f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ c52:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c56:	75 dc                	jne    c34 <mutex_lock+0x35>
+ c58:	eb 01                	jmp    c5b <mutex_lock+0x5c>
+    return;
+ c5a:	90                   	nop
+  }
+}
+ c5b:	c9                   	leave
+ c5c:	c3                   	ret
+
+00000c5d <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ c5d:	55                   	push   %ebp
+ c5e:	89 e5                	mov    %esp,%ebp
+ c60:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ c63:	8b 45 08             	mov    0x8(%ebp),%eax
+ c66:	ba 01 00 00 00       	mov    $0x1,%edx
+ c6b:	f7 da                	neg    %edx
+ c6d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ c71:	83 fa 01             	cmp    $0x1,%edx
+ c74:	74 1a                	je     c90 <mutex_unlock+0x33>
+    m->state = 0;
+ c76:	8b 45 08             	mov    0x8(%ebp),%eax
+ c79:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+ c82:	83 ec 08             	sub    $0x8,%esp
+ c85:	6a 01                	push   $0x1
+ c87:	50                   	push   %eax
+ c88:	e8 b0 fa ff ff       	call   73d <futex_wake>
+ c8d:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ c90:	90                   	nop
+ c91:	c9                   	leave
+ c92:	c3                   	ret
+
+00000c93 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ c93:	55                   	push   %ebp
+ c94:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ c96:	8b 45 08             	mov    0x8(%ebp),%eax
+ c99:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ c9f:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca2:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ ca9:	90                   	nop
+ caa:	5d                   	pop    %ebp
+ cab:	c3                   	ret
+
+00000cac <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ cac:	55                   	push   %ebp
+ cad:	89 e5                	mov    %esp,%ebp
+ caf:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ cb2:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb5:	83 c0 04             	add    $0x4,%eax
+ cb8:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ cbc:	8b 45 08             	mov    0x8(%ebp),%eax
+ cbf:	83 ec 08             	sub    $0x8,%esp
+ cc2:	ff 75 0c             	push   0xc(%ebp)
+ cc5:	50                   	push   %eax
+ cc6:	e8 6a fa ff ff       	call   735 <futex_wait>
+ ccb:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ cce:	8b 45 08             	mov    0x8(%ebp),%eax
+ cd1:	83 c0 04             	add    $0x4,%eax
+ cd4:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ cd8:	90                   	nop
+ cd9:	c9                   	leave
+ cda:	c3                   	ret
+
+00000cdb <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ cdb:	55                   	push   %ebp
+ cdc:	89 e5                	mov    %esp,%ebp
+ cde:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ ce1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce4:	8b 00                	mov    (%eax),%eax
+ ce6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ ce9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ced:	78 17                	js     d06 <rwlock_rdlock+0x2b>
+ cef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf2:	83 c0 01             	add    $0x1,%eax
+ cf5:	89 c1                	mov    %eax,%ecx
+ cf7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cfa:	8b 55 08             	mov    0x8(%ebp),%edx
+ cfd:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ d01:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d04:	74 19                	je     d1f <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ d06:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d0a:	79 d5                	jns    ce1 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ d0c:	83 ec 08             	sub    $0x8,%esp
+ d0f:	ff 75 f4             	push   -0xc(%ebp)
+ d12:	ff 75 08             	push   0x8(%ebp)
+ d15:	e8 92 ff ff ff       	call   cac <rwlock_sleep>
+ d1a:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ d1d:	eb c2                	jmp    ce1 <rwlock_rdlock+0x6>
+      return;
+ d1f:	90                   	nop
+  }
+}
+ d20:	c9                   	leave
+ d21:	c3                   	ret
+
+00000d22 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ d22:	55                   	push   %ebp
+ d23:	89 e5                	mov    %esp,%ebp
+ d25:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ d28:	eb 11                	jmp    d3b <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ d2a:	83 ec 08             	sub    $0x8,%esp
+ d2d:	ff 75 f4             	push   -0xc(%ebp)
+ d30:	ff 75 08             	push   0x8(%ebp)
+ d33:	e8 74 ff ff ff       	call   cac <rwlock_sleep>
+ d38:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ d3b:	8b 55 08             	mov    0x8(%ebp),%edx
+ d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+ d43:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ d48:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ d4c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d4f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d53:	75 d5                	jne    d2a <rwlock_wrlock+0x8>
+}
+ d55:	90                   	nop
+ d56:	90                   	nop
+ d57:	c9                   	leave
+ d58:	c3                   	ret
+
+00000d59 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ d59:	55                   	push   %ebp
+ d5a:	89 e5                	mov    %esp,%ebp
+ d5c:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ d5f:	8b 45 08             	mov    0x8(%ebp),%eax
+ d62:	8b 00                	mov    (%eax),%eax
+ d64:	85 c0                	test   %eax,%eax
+ d66:	79 0c                	jns    d74 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ d68:	8b 45 08             	mov    0x8(%ebp),%eax
+ d6b:	ba 00 00 00 00       	mov    $0x0,%edx
+ d70:	87 10                	xchg   %edx,(%eax)
+ d72:	eb 18                	jmp    d8c <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ d74:	8b 55 08             	mov    0x8(%ebp),%edx
+ d77:	b8 01 00 00 00       	mov    $0x1,%eax
+ d7c:	f7 d8                	neg    %eax
+ d7e:	89 c1                	mov    %eax,%ecx
+ d80:	89 c8                	mov    %ecx,%eax
+ d82:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ d86:	01 c8                	add    %ecx,%eax
+ d88:	85 c0                	test   %eax,%eax
+ d8a:	75 20                	jne    dac <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ d8c:	8b 45 08             	mov    0x8(%ebp),%eax
+ d8f:	8b 40 04             	mov    0x4(%eax),%eax
+ d92:	85 c0                	test   %eax,%eax
+ d94:	74 17                	je     dad <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ d96:	8b 45 08             	mov    0x8(%ebp),%eax
+ d99:	83 ec 08             	sub    $0x8,%esp
+ d9c:	68 ff ff ff 7f       	push   $0x7fffffff
+ da1:	50                   	push   %eax
+ da2:	e8 96 f9 ff ff       	call   73d <futex_wake>
+ da7:	83 c4 10             	add    $0x10,%esp
+ daa:	eb 01                	jmp    dad <rwlock_unlock+0x54>
+    return;
+ dac:	90                   	nop
+}
+ dad:	c9                   	leave
+ dae:	c3                   	ret
+
+00000daf <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ daf:	55                   	push   %ebp
+ db0:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ db2:	8b 45 08             	mov    0x8(%ebp),%eax
+ db5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ dbb:	90                   	nop
+ dbc:	5d                   	pop    %ebp
+ dbd:	c3                   	ret
+
+00000dbe <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ dbe:	55                   	push   %ebp
+ dbf:	89 e5                	mov    %esp,%ebp
+ dc1:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ dc4:	8b 45 08             	mov    0x8(%ebp),%eax
+ dc7:	8b 00                	mov    (%eax),%eax
+ dc9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ dcc:	83 ec 0c             	sub    $0xc,%esp
+ dcf:	ff 75 0c             	push   0xc(%ebp)
+ dd2:	e8 86 fe ff ff       	call   c5d <mutex_unlock>
+ dd7:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ dda:	8b 45 08             	mov    0x8(%ebp),%eax
+ ddd:	83 ec 08             	sub    $0x8,%esp
+ de0:	ff 75 f4             	push   -0xc(%ebp)
+ de3:	50                   	push   %eax
+ de4:	e8 4c f9 ff ff       	call   735 <futex_wait>
+ de9:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ dec:	83 ec 0c             	sub    $0xc,%esp
+ def:	ff 75 0c             	push   0xc(%ebp)
+ df2:	e8 08 fe ff ff       	call   bff <mutex_lock>
+ df7:	83 c4 10             	add    $0x10,%esp
+}
+ dfa:	90                   	nop
+ dfb:	c9                   	leave
+ dfc:	c3                   	ret
+
+00000dfd <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ dfd:	55                   	push   %ebp
+ dfe:	89 e5                	mov    %esp,%ebp
+ e00:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ e03:	8b 45 08             	mov    0x8(%ebp),%eax
+ e06:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ e0a:	8b 45 08             	mov    0x8(%ebp),%eax
+ e0d:	83 ec 08             	sub    $0x8,%esp
+ e10:	6a 01                	push   $0x1
+ e12:	50                   	push   %eax
+ e13:	e8 25 f9 ff ff       	call   73d <futex_wake>
+ e18:	83 c4 10             	add    $0x10,%esp
+}
+ e1b:	90                   	nop
+ e1c:	c9                   	leave
+ e1d:	c3                   	ret
+
+00000e1e <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ e1e:	55                   	push   %ebp
+ e1f:	89 e5                	mov    %esp,%ebp
+ e21:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ e24:	8b 45 08             	mov    0x8(%ebp),%eax
+ e27:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ e2b:	8b 45 08             	mov    0x8(%ebp),%eax
+ e2e:	83 ec 08             	sub    $0x8,%esp
+ e31:	68 ff ff ff 7f       	push   $0x7fffffff
+ e36:	50                   	push   %eax
+ e37:	e8 01 f9 ff ff       	call   73d <futex_wake>
+ e3c:	83 c4 10             	add    $0x10,%esp
+}
+ e3f:	90                   	nop
+ e40:	c9                   	leave
+ e41:	c3                   	ret
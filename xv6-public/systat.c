@@ -0,0 +1,122 @@
+#include "types.h"
+#include "user.h"
+#include "syscall.h"
+#include "syslat.h"
+
+// Print p50, p99 and max latency of every system call that has
+// run, from the kernel's log2 histograms. Percentiles are the
+// upper bound of the bucket they fall in, in TSC cycles.
+
+static struct syslat lat;
+
+static char *names[NSYSCALL] = {
+    [SYS_fork] "fork",
+    [SYS_exit] "exit",
+    [SYS_wait] "wait",
+    [SYS_pipe] "pipe",
+    [SYS_read] "read",
+    [SYS_kill] "kill",
+    [SYS_exec] "exec",
+    [SYS_fstat] "fstat",
+    [SYS_chdir] "chdir",
+    [SYS_dup] "dup",
+    [SYS_getpid] "getpid",
+    [SYS_sbrk] "sbrk",
+    [SYS_sleep] "sleep",
+    [SYS_uptime] "uptime",
+    [SYS_open] "open",
+    [SYS_write] "write",
+    [SYS_mknod] "mknod",
+    [SYS_unlink] "unlink",
+    [SYS_link] "link",
+    [SYS_mkdir] "mkdir",
+    [SYS_close] "close",
+    [SYS_find_digital_root] "find_digital_root",
+    [SYS_get_uncle_count] "get_uncle_count",
+    [SYS_get_process_lifetime] "get_process_lifetime",
+    [SYS_copy_file] "copy_file",
+    [SYS_change_queue] "change_queue",
+    [SYS_set_bjf_params_for_process] "set_bjf_params_for_process",
+    [SYS_set_bjf_params_for_system] "set_bjf_params_for_system",
+    [SYS_print_process_info] "print_process_info",
+    [SYS_set_bjf_priority] "set_bjf_priority",
+    [SYS_init_prioritylock] "init_prioritylock",
+    [SYS_acquire_prioritylock] "acquire_prioritylock",
+    [SYS_release_prioritylock] "release_prioritylock",
+    [SYS_print_syscall_count] "print_syscall_count",
+    [SYS_reset_syscall_count] "reset_syscall_count",
+    [SYS_open_sharedmem] "open_sharedmem",
+    [SYS_close_sharedmem] "close_sharedmem",
+    [SYS_set_affinity] "set_affinity",
+    [SYS_setsched] "setsched",
+    [SYS_get_idle_cycles] "get_idle_cycles",
+    [SYS_set_quantum] "set_quantum",
+    [SYS_schedtrace] "schedtrace",
+    [SYS_getrusage] "getrusage",
+    [SYS_create_prioritylock] "create_prioritylock",
+    [SYS_destroy_prioritylock] "destroy_prioritylock",
+    [SYS_prioritylock_stats] "prioritylock_stats",
+    [SYS_futex_wait] "futex_wait",
+    [SYS_futex_wake] "futex_wake",
+    [SYS_syscall_latency] "syscall_latency",
+    [SYS_submit_batch] "submit_batch",
+    [SYS_kmem_stats] "kmem_stats",
+    [SYS_kmem_junk] "kmem_junk",
+};
+
+void printuint(uint v)
+{
+    if (v >= 10)
+        printuint(v / 10);
+    printf(1, "%d", v % 10);
+}
+
+// Upper bound, in cycles, of the bucket holding the pct-th
+// percentile of the count calls to num.
+uint percentile(int num, uint count, int pct)
+{
+    uint seen = 0;
+    int k;
+
+    for (k = 0; k < NLATBUCKET - 1; k++)
+    {
+        seen += lat.hist[num][k];
+        if (seen * 100 >= count * pct)
+            break;
+    }
+    return k == NLATBUCKET - 1 ? 0xffffffff : (2u << k) - 1;
+}
+
+int main(int argc, char *argv[])
+{
+    uint count;
+
+    if (syscall_latency(&lat) < 0)
+    {
+        printf(2, "systat: cannot read latency histograms\n");
+        exit();
+    }
+
+    printf(1, "syscall\t\t\tcalls\tp50\tp99\tmax (cycles)\n");
+    for (int num = 0; num < NSYSCALL; num++)
+    {
+        count = 0;
+        for (int k = 0; k < NLATBUCKET; k++)
+            count += lat.hist[num][k];
+        if (count == 0)
+            continue;
+
+        printf(1, "%s", names[num] ? names[num] : "?");
+        for (int n = names[num] ? strlen(names[num]) : 1; n < 24; n += 8)
+            printf(1, "\t");
+        printuint(count);
+        printf(1, "\t");
+        printuint(percentile(num, count, 50));
+        printf(1, "\t");
+        printuint(percentile(num, count, 99));
+        printf(1, "\t");
+        printuint(lat.max[num]);
+        printf(1, "\n");
+    }
+    exit();
+}
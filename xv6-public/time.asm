@@ -0,0 +1,1836 @@
+
+_time:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+// Run a command and report the CPU time it used, in millions
+// of TSC cycles (2^20), split into user and kernel time, and
+// the page faults the kernel served for it.
+int main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 3c             	sub    $0x3c,%esp
+  13:	89 cb                	mov    %ecx,%ebx
+    struct rusage ru;
+    int start, pid;
+
+    if (argc < 2)
+  15:	83 3b 01             	cmpl   $0x1,(%ebx)
+  18:	7f 17                	jg     31 <main+0x31>
+    {
+        printf(2, "usage: time <command> <args>\n");
+  1a:	83 ec 08             	sub    $0x8,%esp
+  1d:	68 bc 0c 00 00       	push   $0xcbc
+  22:	6a 02                	push   $0x2
+  24:	e8 87 06 00 00       	call   6b0 <printf>
+  29:	83 c4 10             	add    $0x10,%esp
+        exit();
+  2c:	e8 13 04 00 00       	call   444 <exit>
+    }
+
+    start = uptime();
+  31:	e8 a6 04 00 00       	call   4dc <uptime>
+  36:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    pid = fork();
+  39:	e8 fe 03 00 00       	call   43c <fork>
+  3e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if (pid < 0)
+  41:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  45:	79 17                	jns    5e <main+0x5e>
+    {
+        printf(2, "time: fork failed\n");
+  47:	83 ec 08             	sub    $0x8,%esp
+  4a:	68 da 0c 00 00       	push   $0xcda
+  4f:	6a 02                	push   $0x2
+  51:	e8 5a 06 00 00       	call   6b0 <printf>
+  56:	83 c4 10             	add    $0x10,%esp
+        exit();
+  59:	e8 e6 03 00 00       	call   444 <exit>
+    }
+    if (pid == 0)
+  5e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  62:	75 3b                	jne    9f <main+0x9f>
+    {
+        exec(argv[1], argv + 1);
+  64:	8b 43 04             	mov    0x4(%ebx),%eax
+  67:	8d 50 04             	lea    0x4(%eax),%edx
+  6a:	8b 43 04             	mov    0x4(%ebx),%eax
+  6d:	83 c0 04             	add    $0x4,%eax
+  70:	8b 00                	mov    (%eax),%eax
+  72:	83 ec 08             	sub    $0x8,%esp
+  75:	52                   	push   %edx
+  76:	50                   	push   %eax
+  77:	e8 00 04 00 00       	call   47c <exec>
+  7c:	83 c4 10             	add    $0x10,%esp
+        printf(2, "time: exec %s failed\n", argv[1]);
+  7f:	8b 43 04             	mov    0x4(%ebx),%eax
+  82:	83 c0 04             	add    $0x4,%eax
+  85:	8b 00                	mov    (%eax),%eax
+  87:	83 ec 04             	sub    $0x4,%esp
+  8a:	50                   	push   %eax
+  8b:	68 ed 0c 00 00       	push   $0xced
+  90:	6a 02                	push   $0x2
+  92:	e8 19 06 00 00       	call   6b0 <printf>
+  97:	83 c4 10             	add    $0x10,%esp
+        exit();
+  9a:	e8 a5 03 00 00       	call   444 <exit>
+    }
+    wait();
+  9f:	e8 a8 03 00 00       	call   44c <wait>
+
+    getrusage(RUSAGE_CHILDREN, &ru);
+  a4:	83 ec 08             	sub    $0x8,%esp
+  a7:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  aa:	50                   	push   %eax
+  ab:	6a ff                	push   $0xffffffff
+  ad:	e8 da 04 00 00       	call   58c <getrusage>
+  b2:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d ticks real, %d Mcycles user, %d Mcycles sys\n",
+           uptime() - start, (int)(ru.utime >> 20), (int)(ru.stime >> 20));
+  b5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  b8:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  bb:	0f ac d0 14          	shrd   $0x14,%edx,%eax
+  bf:	c1 ea 14             	shr    $0x14,%edx
+    printf(1, "%d ticks real, %d Mcycles user, %d Mcycles sys\n",
+  c2:	89 c6                	mov    %eax,%esi
+           uptime() - start, (int)(ru.utime >> 20), (int)(ru.stime >> 20));
+  c4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  c7:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  ca:	0f ac d0 14          	shrd   $0x14,%edx,%eax
+  ce:	c1 ea 14             	shr    $0x14,%edx
+    printf(1, "%d ticks real, %d Mcycles user, %d Mcycles sys\n",
+  d1:	89 c3                	mov    %eax,%ebx
+           uptime() - start, (int)(ru.utime >> 20), (int)(ru.stime >> 20));
+  d3:	e8 04 04 00 00       	call   4dc <uptime>
+    printf(1, "%d ticks real, %d Mcycles user, %d Mcycles sys\n",
+  d8:	2b 45 e4             	sub    -0x1c(%ebp),%eax
+  db:	83 ec 0c             	sub    $0xc,%esp
+  de:	56                   	push   %esi
+  df:	53                   	push   %ebx
+  e0:	50                   	push   %eax
+  e1:	68 04 0d 00 00       	push   $0xd04
+  e6:	6a 01                	push   $0x1
+  e8:	e8 c3 05 00 00       	call   6b0 <printf>
+  ed:	83 c4 20             	add    $0x20,%esp
+    printf(1, "page faults: %d zero-fill, %d copy-on-write, %d shared memory\n",
+  f0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  f3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  f6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  f9:	83 ec 0c             	sub    $0xc,%esp
+  fc:	51                   	push   %ecx
+  fd:	52                   	push   %edx
+  fe:	50                   	push   %eax
+  ff:	68 34 0d 00 00       	push   $0xd34
+ 104:	6a 01                	push   $0x1
+ 106:	e8 a5 05 00 00       	call   6b0 <printf>
+ 10b:	83 c4 20             	add    $0x20,%esp
+           ru.faults[FAULT_ZERO], ru.faults[FAULT_COW], ru.faults[FAULT_SHM]);
+    exit();
+ 10e:	e8 31 03 00 00       	call   444 <exit>
+
+00000113 <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 113:	55                   	push   %ebp
+ 114:	89 e5                	mov    %esp,%ebp
+ 116:	57                   	push   %edi
+ 117:	53                   	push   %ebx
+{
+ 118:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 11b:	8b 55 10             	mov    0x10(%ebp),%edx
+ 11e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 121:	89 cb                	mov    %ecx,%ebx
+ 123:	89 df                	mov    %ebx,%edi
+ 125:	89 d1                	mov    %edx,%ecx
+ 127:	fc                   	cld
+ 128:	f3 aa                	rep stos %al,%es:(%edi)
+ 12a:	89 ca                	mov    %ecx,%edx
+ 12c:	89 fb                	mov    %edi,%ebx
+ 12e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 131:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 134:	90                   	nop
+ 135:	5b                   	pop    %ebx
+ 136:	5f                   	pop    %edi
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+
+00000139 <strcpy>:
+{
+ 139:	55                   	push   %ebp
+ 13a:	89 e5                	mov    %esp,%ebp
+ 13c:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 13f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 142:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 145:	90                   	nop
+ 146:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 149:	8d 42 01             	lea    0x1(%edx),%eax
+ 14c:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 14f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 152:	8d 48 01             	lea    0x1(%eax),%ecx
+ 155:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 158:	0f b6 12             	movzbl (%edx),%edx
+ 15b:	88 10                	mov    %dl,(%eax)
+ 15d:	0f b6 00             	movzbl (%eax),%eax
+ 160:	84 c0                	test   %al,%al
+ 162:	75 e2                	jne    146 <strcpy+0xd>
+  return os;
+ 164:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 167:	c9                   	leave
+ 168:	c3                   	ret
+
+00000169 <strcmp>:
+{
+ 169:	55                   	push   %ebp
+ 16a:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 16c:	eb 08                	jmp    176 <strcmp+0xd>
+    p++, q++;
+ 16e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 172:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 176:	8b 45 08             	mov    0x8(%ebp),%eax
+ 179:	0f b6 00             	movzbl (%eax),%eax
+ 17c:	84 c0                	test   %al,%al
+ 17e:	74 10                	je     190 <strcmp+0x27>
+ 180:	8b 45 08             	mov    0x8(%ebp),%eax
+ 183:	0f b6 10             	movzbl (%eax),%edx
+ 186:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 189:	0f b6 00             	movzbl (%eax),%eax
+ 18c:	38 c2                	cmp    %al,%dl
+ 18e:	74 de                	je     16e <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 190:	8b 45 08             	mov    0x8(%ebp),%eax
+ 193:	0f b6 00             	movzbl (%eax),%eax
+ 196:	0f b6 d0             	movzbl %al,%edx
+ 199:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 19c:	0f b6 00             	movzbl (%eax),%eax
+ 19f:	0f b6 c0             	movzbl %al,%eax
+ 1a2:	29 c2                	sub    %eax,%edx
+ 1a4:	89 d0                	mov    %edx,%eax
+}
+ 1a6:	5d                   	pop    %ebp
+ 1a7:	c3                   	ret
+
+000001a8 <strlen>:
+{
+ 1a8:	55                   	push   %ebp
+ 1a9:	89 e5                	mov    %esp,%ebp
+ 1ab:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1ae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1b5:	eb 04                	jmp    1bb <strlen+0x13>
+ 1b7:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1bb:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c1:	01 d0                	add    %edx,%eax
+ 1c3:	0f b6 00             	movzbl (%eax),%eax
+ 1c6:	84 c0                	test   %al,%al
+ 1c8:	75 ed                	jne    1b7 <strlen+0xf>
+  return n;
+ 1ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1cd:	c9                   	leave
+ 1ce:	c3                   	ret
+
+000001cf <memset>:
+{
+ 1cf:	55                   	push   %ebp
+ 1d0:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1d2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1d5:	50                   	push   %eax
+ 1d6:	ff 75 0c             	push   0xc(%ebp)
+ 1d9:	ff 75 08             	push   0x8(%ebp)
+ 1dc:	e8 32 ff ff ff       	call   113 <stosb>
+ 1e1:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1e4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+
+000001e9 <strchr>:
+{
+ 1e9:	55                   	push   %ebp
+ 1ea:	89 e5                	mov    %esp,%ebp
+ 1ec:	83 ec 04             	sub    $0x4,%esp
+ 1ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1f2:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1f5:	eb 14                	jmp    20b <strchr+0x22>
+    if(*s == c)
+ 1f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fa:	0f b6 00             	movzbl (%eax),%eax
+ 1fd:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 200:	75 05                	jne    207 <strchr+0x1e>
+      return (char*)s;
+ 202:	8b 45 08             	mov    0x8(%ebp),%eax
+ 205:	eb 13                	jmp    21a <strchr+0x31>
+  for(; *s; s++)
+ 207:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 20b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20e:	0f b6 00             	movzbl (%eax),%eax
+ 211:	84 c0                	test   %al,%al
+ 213:	75 e2                	jne    1f7 <strchr+0xe>
+  return 0;
+ 215:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 21a:	c9                   	leave
+ 21b:	c3                   	ret
+
+0000021c <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 21c:	55                   	push   %ebp
+ 21d:	89 e5                	mov    %esp,%ebp
+ 21f:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 222:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 229:	eb 42                	jmp    26d <gets+0x51>
+    cc = read(0, &c, 1);
+ 22b:	83 ec 04             	sub    $0x4,%esp
+ 22e:	6a 01                	push   $0x1
+ 230:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 233:	50                   	push   %eax
+ 234:	6a 00                	push   $0x0
+ 236:	e8 21 02 00 00       	call   45c <read>
+ 23b:	83 c4 10             	add    $0x10,%esp
+ 23e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 241:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 245:	7e 33                	jle    27a <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 247:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 24a:	8d 50 01             	lea    0x1(%eax),%edx
+ 24d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 250:	89 c2                	mov    %eax,%edx
+ 252:	8b 45 08             	mov    0x8(%ebp),%eax
+ 255:	01 c2                	add    %eax,%edx
+ 257:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 25b:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 25d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 261:	3c 0a                	cmp    $0xa,%al
+ 263:	74 16                	je     27b <gets+0x5f>
+ 265:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 269:	3c 0d                	cmp    $0xd,%al
+ 26b:	74 0e                	je     27b <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 26d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 270:	83 c0 01             	add    $0x1,%eax
+ 273:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 276:	7f b3                	jg     22b <gets+0xf>
+ 278:	eb 01                	jmp    27b <gets+0x5f>
+      break;
+ 27a:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 27b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 27e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 281:	01 d0                	add    %edx,%eax
+ 283:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 286:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 289:	c9                   	leave
+ 28a:	c3                   	ret
+
+0000028b <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 28b:	55                   	push   %ebp
+ 28c:	89 e5                	mov    %esp,%ebp
+ 28e:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 291:	83 ec 08             	sub    $0x8,%esp
+ 294:	6a 00                	push   $0x0
+ 296:	ff 75 08             	push   0x8(%ebp)
+ 299:	e8 e6 01 00 00       	call   484 <open>
+ 29e:	83 c4 10             	add    $0x10,%esp
+ 2a1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2a4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2a8:	79 07                	jns    2b1 <stat+0x26>
+    return -1;
+ 2aa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2af:	eb 25                	jmp    2d6 <stat+0x4b>
+  r = fstat(fd, st);
+ 2b1:	83 ec 08             	sub    $0x8,%esp
+ 2b4:	ff 75 0c             	push   0xc(%ebp)
+ 2b7:	ff 75 f4             	push   -0xc(%ebp)
+ 2ba:	e8 dd 01 00 00       	call   49c <fstat>
+ 2bf:	83 c4 10             	add    $0x10,%esp
+ 2c2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2c5:	83 ec 0c             	sub    $0xc,%esp
+ 2c8:	ff 75 f4             	push   -0xc(%ebp)
+ 2cb:	e8 9c 01 00 00       	call   46c <close>
+ 2d0:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2d3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2d6:	c9                   	leave
+ 2d7:	c3                   	ret
+
+000002d8 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2d8:	55                   	push   %ebp
+ 2d9:	89 e5                	mov    %esp,%ebp
+ 2db:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2de:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2e5:	eb 25                	jmp    30c <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2e7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2ea:	89 d0                	mov    %edx,%eax
+ 2ec:	c1 e0 02             	shl    $0x2,%eax
+ 2ef:	01 d0                	add    %edx,%eax
+ 2f1:	01 c0                	add    %eax,%eax
+ 2f3:	89 c1                	mov    %eax,%ecx
+ 2f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f8:	8d 50 01             	lea    0x1(%eax),%edx
+ 2fb:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2fe:	0f b6 00             	movzbl (%eax),%eax
+ 301:	0f be c0             	movsbl %al,%eax
+ 304:	01 c8                	add    %ecx,%eax
+ 306:	83 e8 30             	sub    $0x30,%eax
+ 309:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 30c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30f:	0f b6 00             	movzbl (%eax),%eax
+ 312:	3c 2f                	cmp    $0x2f,%al
+ 314:	7e 0a                	jle    320 <atoi+0x48>
+ 316:	8b 45 08             	mov    0x8(%ebp),%eax
+ 319:	0f b6 00             	movzbl (%eax),%eax
+ 31c:	3c 39                	cmp    $0x39,%al
+ 31e:	7e c7                	jle    2e7 <atoi+0xf>
+  return n;
+ 320:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 323:	c9                   	leave
+ 324:	c3                   	ret
+
+00000325 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 325:	55                   	push   %ebp
+ 326:	89 e5                	mov    %esp,%ebp
+ 328:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 32b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 331:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 334:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 337:	eb 17                	jmp    350 <memmove+0x2b>
+    *dst++ = *src++;
+ 339:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 33c:	8d 42 01             	lea    0x1(%edx),%eax
+ 33f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 342:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 345:	8d 48 01             	lea    0x1(%eax),%ecx
+ 348:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 34b:	0f b6 12             	movzbl (%edx),%edx
+ 34e:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 350:	8b 45 10             	mov    0x10(%ebp),%eax
+ 353:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 356:	89 55 10             	mov    %edx,0x10(%ebp)
+ 359:	85 c0                	test   %eax,%eax
+ 35b:	7f dc                	jg     339 <memmove+0x14>
+  return vdst;
+ 35d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 360:	c9                   	leave
+ 361:	c3                   	ret
+
+00000362 <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 362:	55                   	push   %ebp
+ 363:	89 e5                	mov    %esp,%ebp
+ 365:	57                   	push   %edi
+ 366:	56                   	push   %esi
+ 367:	83 ec 30             	sub    $0x30,%esp
+ 36a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 370:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 373:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 376:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 37d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 384:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 387:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 38a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 38d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 390:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 397:	e9 89 00 00 00       	jmp    425 <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 39c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 39f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 3a2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 3a6:	01 c0                	add    %eax,%eax
+ 3a8:	89 c6                	mov    %eax,%esi
+ 3aa:	89 d7                	mov    %edx,%edi
+ 3ac:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 3af:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 3b2:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 3b5:	0f ad d0             	shrd   %cl,%edx,%eax
+ 3b8:	d3 ea                	shr    %cl,%edx
+ 3ba:	f6 c1 20             	test   $0x20,%cl
+ 3bd:	74 04                	je     3c3 <udiv64+0x61>
+ 3bf:	89 d0                	mov    %edx,%eax
+ 3c1:	31 d2                	xor    %edx,%edx
+ 3c3:	83 e0 01             	and    $0x1,%eax
+ 3c6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 3c9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 3d0:	89 f0                	mov    %esi,%eax
+ 3d2:	89 fa                	mov    %edi,%edx
+ 3d4:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 3d7:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 3da:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 3dd:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 3e0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3e8:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 3eb:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 3ee:	19 d1                	sbb    %edx,%ecx
+ 3f0:	72 2f                	jb     421 <udiv64+0xbf>
+      r -= d;
+ 3f2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3f5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3fa:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 3fd:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 400:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 403:	b8 01 00 00 00       	mov    $0x1,%eax
+ 408:	ba 00 00 00 00       	mov    $0x0,%edx
+ 40d:	0f a5 c2             	shld   %cl,%eax,%edx
+ 410:	d3 e0                	shl    %cl,%eax
+ 412:	f6 c1 20             	test   $0x20,%cl
+ 415:	74 04                	je     41b <udiv64+0xb9>
+ 417:	89 c2                	mov    %eax,%edx
+ 419:	31 c0                	xor    %eax,%eax
+ 41b:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 41e:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 421:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 425:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 429:	0f 89 6d ff ff ff    	jns    39c <udiv64+0x3a>
+    }
+  }
+  return q;
+ 42f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 432:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 435:	83 c4 30             	add    $0x30,%esp
+ 438:	5e                   	pop    %esi
+ 439:	5f                   	pop    %edi
+ 43a:	5d                   	pop    %ebp
+ 43b:	c3                   	ret
+
+0000043c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 43c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <exit>:
+SYSCALL(exit)
+ 444:	b8 02 00 00 00       	mov    $0x2,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <wait>:
+SYSCALL(wait)
+ 44c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <pipe>:
+SYSCALL(pipe)
+ 454:	b8 04 00 00 00       	mov    $0x4,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <read>:
+SYSCALL(read)
+ 45c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <write>:
+SYSCALL(write)
+ 464:	b8 10 00 00 00       	mov    $0x10,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <close>:
+SYSCALL(close)
+ 46c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <kill>:
+SYSCALL(kill)
+ 474:	b8 06 00 00 00       	mov    $0x6,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <exec>:
+SYSCALL(exec)
+ 47c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <open>:
+SYSCALL(open)
+ 484:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <mknod>:
+SYSCALL(mknod)
+ 48c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <unlink>:
+SYSCALL(unlink)
+ 494:	b8 12 00 00 00       	mov    $0x12,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <fstat>:
+SYSCALL(fstat)
+ 49c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <link>:
+SYSCALL(link)
+ 4a4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <mkdir>:
+SYSCALL(mkdir)
+ 4ac:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <chdir>:
+SYSCALL(chdir)
+ 4b4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <dup>:
+SYSCALL(dup)
+ 4bc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <getpid>:
+SYSCALL(getpid)
+ 4c4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <sbrk>:
+SYSCALL(sbrk)
+ 4cc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <sleep>:
+SYSCALL(sleep)
+ 4d4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <uptime>:
+SYSCALL(uptime)
+ 4dc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <find_digital_root>:
+SYSCALL(find_digital_root)
+ 4e4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 4ec:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4f1:	cd 40                	int    $0x40
+ 4f3:	c3                   	ret
+
+000004f4 <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 4f4:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4f9:	cd 40                	int    $0x40
+ 4fb:	c3                   	ret
+
+000004fc <copy_file>:
+SYSCALL(copy_file)
+ 4fc:	b8 19 00 00 00       	mov    $0x19,%eax
+ 501:	cd 40                	int    $0x40
+ 503:	c3                   	ret
+
+00000504 <change_queue>:
+SYSCALL(change_queue)
+ 504:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 50c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 511:	cd 40                	int    $0x40
+ 513:	c3                   	ret
+
+00000514 <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 514:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <print_process_info>:
+SYSCALL(print_process_info)
+ 51c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 521:	cd 40                	int    $0x40
+ 523:	c3                   	ret
+
+00000524 <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 524:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 52c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 531:	cd 40                	int    $0x40
+ 533:	c3                   	ret
+
+00000534 <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 534:	b8 20 00 00 00       	mov    $0x20,%eax
+ 539:	cd 40                	int    $0x40
+ 53b:	c3                   	ret
+
+0000053c <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 53c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 544:	b8 22 00 00 00       	mov    $0x22,%eax
+ 549:	cd 40                	int    $0x40
+ 54b:	c3                   	ret
+
+0000054c <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 54c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 551:	cd 40                	int    $0x40
+ 553:	c3                   	ret
+
+00000554 <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 554:	b8 24 00 00 00       	mov    $0x24,%eax
+ 559:	cd 40                	int    $0x40
+ 55b:	c3                   	ret
+
+0000055c <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 55c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 561:	cd 40                	int    $0x40
+ 563:	c3                   	ret
+
+00000564 <set_affinity>:
+SYSCALL(set_affinity)
+ 564:	b8 26 00 00 00       	mov    $0x26,%eax
+ 569:	cd 40                	int    $0x40
+ 56b:	c3                   	ret
+
+0000056c <setsched>:
+SYSCALL(setsched)
+ 56c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 571:	cd 40                	int    $0x40
+ 573:	c3                   	ret
+
+00000574 <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 574:	b8 28 00 00 00       	mov    $0x28,%eax
+ 579:	cd 40                	int    $0x40
+ 57b:	c3                   	ret
+
+0000057c <set_quantum>:
+SYSCALL(set_quantum)
+ 57c:	b8 29 00 00 00       	mov    $0x29,%eax
+ 581:	cd 40                	int    $0x40
+ 583:	c3                   	ret
+
+00000584 <schedtrace>:
+SYSCALL(schedtrace)
+ 584:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 589:	cd 40                	int    $0x40
+ 58b:	c3                   	ret
+
+0000058c <getrusage>:
+SYSCALL(getrusage)
+ 58c:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 591:	cd 40                	int    $0x40
+ 593:	c3                   	ret
+
+00000594 <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 594:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 599:	cd 40                	int    $0x40
+ 59b:	c3                   	ret
+
+0000059c <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 59c:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5a1:	cd 40                	int    $0x40
+ 5a3:	c3                   	ret
+
+000005a4 <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 5a4:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5a9:	cd 40                	int    $0x40
+ 5ab:	c3                   	ret
+
+000005ac <futex_wait>:
+SYSCALL(futex_wait)
+ 5ac:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5b1:	cd 40                	int    $0x40
+ 5b3:	c3                   	ret
+
+000005b4 <futex_wake>:
+SYSCALL(futex_wake)
+ 5b4:	b8 30 00 00 00       	mov    $0x30,%eax
+ 5b9:	cd 40                	int    $0x40
+ 5bb:	c3                   	ret
+
+000005bc <syscall_latency>:
+SYSCALL(syscall_latency)
+ 5bc:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5c1:	cd 40                	int    $0x40
+ 5c3:	c3                   	ret
+
+000005c4 <submit_batch>:
+SYSCALL(submit_batch)
+ 5c4:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5c9:	cd 40                	int    $0x40
+ 5cb:	c3                   	ret
+
+000005cc <kmem_stats>:
+SYSCALL(kmem_stats)
+ 5cc:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5d1:	cd 40                	int    $0x40
+ 5d3:	c3                   	ret
+
+000005d4 <kmem_junk>:
+SYSCALL(kmem_junk)
+ 5d4:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5d9:	cd 40                	int    $0x40
+ 5db:	c3                   	ret
+
+000005dc <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5dc:	55                   	push   %ebp
+ 5dd:	89 e5                	mov    %esp,%ebp
+ 5df:	83 ec 18             	sub    $0x18,%esp
+ 5e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5e5:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 5e8:	83 ec 04             	sub    $0x4,%esp
+ 5eb:	6a 01                	push   $0x1
+ 5ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5f0:	50                   	push   %eax
+ 5f1:	ff 75 08             	push   0x8(%ebp)
+ 5f4:	e8 6b fe ff ff       	call   464 <write>
+ 5f9:	83 c4 10             	add    $0x10,%esp
+}
+ 5fc:	90                   	nop
+ 5fd:	c9                   	leave
+ 5fe:	c3                   	ret
+
+000005ff <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5ff:	55                   	push   %ebp
+ 600:	89 e5                	mov    %esp,%ebp
+ 602:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 605:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 60c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 610:	74 17                	je     629 <printint+0x2a>
+ 612:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 616:	79 11                	jns    629 <printint+0x2a>
+    neg = 1;
+ 618:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 61f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 622:	f7 d8                	neg    %eax
+ 624:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 627:	eb 06                	jmp    62f <printint+0x30>
+  } else {
+    x = xx;
+ 629:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 62c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 62f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 636:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 639:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 63c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 641:	f7 f1                	div    %ecx
+ 643:	89 d1                	mov    %edx,%ecx
+ 645:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 648:	8d 50 01             	lea    0x1(%eax),%edx
+ 64b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 64e:	0f b6 91 70 11 00 00 	movzbl 0x1170(%ecx),%edx
+ 655:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 659:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 65c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 65f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 664:	f7 f1                	div    %ecx
+ 666:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 669:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 66d:	75 c7                	jne    636 <printint+0x37>
+  if(neg)
+ 66f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 673:	74 2d                	je     6a2 <printint+0xa3>
+    buf[i++] = '-';
+ 675:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 678:	8d 50 01             	lea    0x1(%eax),%edx
+ 67b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 67e:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 683:	eb 1d                	jmp    6a2 <printint+0xa3>
+    putc(fd, buf[i]);
+ 685:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 688:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 68b:	01 d0                	add    %edx,%eax
+ 68d:	0f b6 00             	movzbl (%eax),%eax
+ 690:	0f be c0             	movsbl %al,%eax
+ 693:	83 ec 08             	sub    $0x8,%esp
+ 696:	50                   	push   %eax
+ 697:	ff 75 08             	push   0x8(%ebp)
+ 69a:	e8 3d ff ff ff       	call   5dc <putc>
+ 69f:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 6a2:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 6a6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6aa:	79 d9                	jns    685 <printint+0x86>
+}
+ 6ac:	90                   	nop
+ 6ad:	90                   	nop
+ 6ae:	c9                   	leave
+ 6af:	c3                   	ret
+
+000006b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 6b6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6bd:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6c0:	83 c0 04             	add    $0x4,%eax
+ 6c3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6c6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6cd:	e9 59 01 00 00       	jmp    82b <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 6d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6d5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6d8:	01 d0                	add    %edx,%eax
+ 6da:	0f b6 00             	movzbl (%eax),%eax
+ 6dd:	0f be c0             	movsbl %al,%eax
+ 6e0:	25 ff 00 00 00       	and    $0xff,%eax
+ 6e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 6e8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6ec:	75 2c                	jne    71a <printf+0x6a>
+      if(c == '%'){
+ 6ee:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6f2:	75 0c                	jne    700 <printf+0x50>
+        state = '%';
+ 6f4:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6fb:	e9 27 01 00 00       	jmp    827 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 700:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 703:	0f be c0             	movsbl %al,%eax
+ 706:	83 ec 08             	sub    $0x8,%esp
+ 709:	50                   	push   %eax
+ 70a:	ff 75 08             	push   0x8(%ebp)
+ 70d:	e8 ca fe ff ff       	call   5dc <putc>
+ 712:	83 c4 10             	add    $0x10,%esp
+ 715:	e9 0d 01 00 00       	jmp    827 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 71a:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 71e:	0f 85 03 01 00 00    	jne    827 <printf+0x177>
+      if(c == 'd'){
+ 724:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 728:	75 1e                	jne    748 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 72a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 72d:	8b 00                	mov    (%eax),%eax
+ 72f:	6a 01                	push   $0x1
+ 731:	6a 0a                	push   $0xa
+ 733:	50                   	push   %eax
+ 734:	ff 75 08             	push   0x8(%ebp)
+ 737:	e8 c3 fe ff ff       	call   5ff <printint>
+ 73c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 73f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 743:	e9 d8 00 00 00       	jmp    820 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 748:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 74c:	74 06                	je     754 <printf+0xa4>
+ 74e:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 752:	75 1e                	jne    772 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 754:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 757:	8b 00                	mov    (%eax),%eax
+ 759:	6a 00                	push   $0x0
+ 75b:	6a 10                	push   $0x10
+ 75d:	50                   	push   %eax
+ 75e:	ff 75 08             	push   0x8(%ebp)
+ 761:	e8 99 fe ff ff       	call   5ff <printint>
+ 766:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 769:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 76d:	e9 ae 00 00 00       	jmp    820 <printf+0x170>
+      } else if(c == 's'){
+ 772:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 776:	75 43                	jne    7bb <printf+0x10b>
+        s = (char*)*ap;
+ 778:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 77b:	8b 00                	mov    (%eax),%eax
+ 77d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 780:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 784:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 788:	75 25                	jne    7af <printf+0xff>
+          s = "(null)";
+ 78a:	c7 45 f4 73 0d 00 00 	movl   $0xd73,-0xc(%ebp)
+        while(*s != 0){
+ 791:	eb 1c                	jmp    7af <printf+0xff>
+          putc(fd, *s);
+ 793:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 796:	0f b6 00             	movzbl (%eax),%eax
+ 799:	0f be c0             	movsbl %al,%eax
+ 79c:	83 ec 08             	sub    $0x8,%esp
+ 79f:	50                   	push   %eax
+ 7a0:	ff 75 08             	push   0x8(%ebp)
+ 7a3:	e8 34 fe ff ff       	call   5dc <putc>
+ 7a8:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 7ab:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 7af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b2:	0f b6 00             	movzbl (%eax),%eax
+ 7b5:	84 c0                	test   %al,%al
+ 7b7:	75 da                	jne    793 <printf+0xe3>
+ 7b9:	eb 65                	jmp    820 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 7bb:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 7bf:	75 1d                	jne    7de <printf+0x12e>
+        putc(fd, *ap);
+ 7c1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7c4:	8b 00                	mov    (%eax),%eax
+ 7c6:	0f be c0             	movsbl %al,%eax
+ 7c9:	83 ec 08             	sub    $0x8,%esp
+ 7cc:	50                   	push   %eax
+ 7cd:	ff 75 08             	push   0x8(%ebp)
+ 7d0:	e8 07 fe ff ff       	call   5dc <putc>
+ 7d5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7d8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7dc:	eb 42                	jmp    820 <printf+0x170>
+      } else if(c == '%'){
+ 7de:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7e2:	75 17                	jne    7fb <printf+0x14b>
+        putc(fd, c);
+ 7e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7e7:	0f be c0             	movsbl %al,%eax
+ 7ea:	83 ec 08             	sub    $0x8,%esp
+ 7ed:	50                   	push   %eax
+ 7ee:	ff 75 08             	push   0x8(%ebp)
+ 7f1:	e8 e6 fd ff ff       	call   5dc <putc>
+ 7f6:	83 c4 10             	add    $0x10,%esp
+ 7f9:	eb 25                	jmp    820 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 7fb:	83 ec 08             	sub    $0x8,%esp
+ 7fe:	6a 25                	push   $0x25
+ 800:	ff 75 08             	push   0x8(%ebp)
+ 803:	e8 d4 fd ff ff       	call   5dc <putc>
+ 808:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 80b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 80e:	0f be c0             	movsbl %al,%eax
+ 811:	83 ec 08             	sub    $0x8,%esp
+ 814:	50                   	push   %eax
+ 815:	ff 75 08             	push   0x8(%ebp)
+ 818:	e8 bf fd ff ff       	call   5dc <putc>
+ 81d:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 820:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 827:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 82b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 82e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 831:	01 d0                	add    %edx,%eax
+ 833:	0f b6 00             	movzbl (%eax),%eax
+ 836:	84 c0                	test   %al,%al
+ 838:	0f 85 94 fe ff ff    	jne    6d2 <printf+0x22>
+    }
+  }
+}
+ 83e:	90                   	nop
+ 83f:	90                   	nop
+ 840:	c9                   	leave
+ 841:	c3                   	ret
+
+00000842 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 842:	55                   	push   %ebp
+ 843:	89 e5                	mov    %esp,%ebp
+ 845:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 848:	8b 45 08             	mov    0x8(%ebp),%eax
+ 84b:	83 e8 08             	sub    $0x8,%eax
+ 84e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 851:	a1 8c 11 00 00       	mov    0x118c,%eax
+ 856:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 859:	eb 24                	jmp    87f <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 85b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 85e:	8b 00                	mov    (%eax),%eax
+ 860:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 863:	72 12                	jb     877 <free+0x35>
+ 865:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 868:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 86b:	72 24                	jb     891 <free+0x4f>
+ 86d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 870:	8b 00                	mov    (%eax),%eax
+ 872:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 875:	72 1a                	jb     891 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 877:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 87a:	8b 00                	mov    (%eax),%eax
+ 87c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 87f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 882:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 885:	73 d4                	jae    85b <free+0x19>
+ 887:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88a:	8b 00                	mov    (%eax),%eax
+ 88c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 88f:	73 ca                	jae    85b <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 891:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 894:	8b 40 04             	mov    0x4(%eax),%eax
+ 897:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 89e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8a1:	01 c2                	add    %eax,%edx
+ 8a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a6:	8b 00                	mov    (%eax),%eax
+ 8a8:	39 c2                	cmp    %eax,%edx
+ 8aa:	75 24                	jne    8d0 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 8ac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8af:	8b 50 04             	mov    0x4(%eax),%edx
+ 8b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b5:	8b 00                	mov    (%eax),%eax
+ 8b7:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ba:	01 c2                	add    %eax,%edx
+ 8bc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8bf:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c5:	8b 00                	mov    (%eax),%eax
+ 8c7:	8b 10                	mov    (%eax),%edx
+ 8c9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8cc:	89 10                	mov    %edx,(%eax)
+ 8ce:	eb 0a                	jmp    8da <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 8d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d3:	8b 10                	mov    (%eax),%edx
+ 8d5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d8:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 8da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8dd:	8b 40 04             	mov    0x4(%eax),%eax
+ 8e0:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ea:	01 d0                	add    %edx,%eax
+ 8ec:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8ef:	75 20                	jne    911 <free+0xcf>
+    p->s.size += bp->s.size;
+ 8f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f4:	8b 50 04             	mov    0x4(%eax),%edx
+ 8f7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8fa:	8b 40 04             	mov    0x4(%eax),%eax
+ 8fd:	01 c2                	add    %eax,%edx
+ 8ff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 902:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 905:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 908:	8b 10                	mov    (%eax),%edx
+ 90a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 90d:	89 10                	mov    %edx,(%eax)
+ 90f:	eb 08                	jmp    919 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 911:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 914:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 917:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 919:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 91c:	a3 8c 11 00 00       	mov    %eax,0x118c
+}
+ 921:	90                   	nop
+ 922:	c9                   	leave
+ 923:	c3                   	ret
+
+00000924 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 924:	55                   	push   %ebp
+ 925:	89 e5                	mov    %esp,%ebp
+ 927:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 92a:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 931:	77 07                	ja     93a <morecore+0x16>
+    nu = 4096;
+ 933:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 93a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 93d:	c1 e0 03             	shl    $0x3,%eax
+ 940:	83 ec 0c             	sub    $0xc,%esp
+ 943:	50                   	push   %eax
+ 944:	e8 83 fb ff ff       	call   4cc <sbrk>
+ 949:	83 c4 10             	add    $0x10,%esp
+ 94c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 94f:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 953:	75 07                	jne    95c <morecore+0x38>
+    return 0;
+ 955:	b8 00 00 00 00       	mov    $0x0,%eax
+ 95a:	eb 26                	jmp    982 <morecore+0x5e>
+  hp = (Header*)p;
+ 95c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 95f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 962:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 965:	8b 55 08             	mov    0x8(%ebp),%edx
+ 968:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 96b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 96e:	83 c0 08             	add    $0x8,%eax
+ 971:	83 ec 0c             	sub    $0xc,%esp
+ 974:	50                   	push   %eax
+ 975:	e8 c8 fe ff ff       	call   842 <free>
+ 97a:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 97d:	a1 8c 11 00 00       	mov    0x118c,%eax
+}
+ 982:	c9                   	leave
+ 983:	c3                   	ret
+
+00000984 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 984:	55                   	push   %ebp
+ 985:	89 e5                	mov    %esp,%ebp
+ 987:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 98a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 98d:	83 c0 07             	add    $0x7,%eax
+ 990:	c1 e8 03             	shr    $0x3,%eax
+ 993:	83 c0 01             	add    $0x1,%eax
+ 996:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 999:	a1 8c 11 00 00       	mov    0x118c,%eax
+ 99e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9a1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9a5:	75 23                	jne    9ca <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 9a7:	c7 45 f0 84 11 00 00 	movl   $0x1184,-0x10(%ebp)
+ 9ae:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9b1:	a3 8c 11 00 00       	mov    %eax,0x118c
+ 9b6:	a1 8c 11 00 00       	mov    0x118c,%eax
+ 9bb:	a3 84 11 00 00       	mov    %eax,0x1184
+    base.s.size = 0;
+ 9c0:	c7 05 88 11 00 00 00 	movl   $0x0,0x1188
+ 9c7:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9ca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9cd:	8b 00                	mov    (%eax),%eax
+ 9cf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d5:	8b 40 04             	mov    0x4(%eax),%eax
+ 9d8:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 9db:	72 4d                	jb     a2a <malloc+0xa6>
+      if(p->s.size == nunits)
+ 9dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e0:	8b 40 04             	mov    0x4(%eax),%eax
+ 9e3:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9e6:	75 0c                	jne    9f4 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 9e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9eb:	8b 10                	mov    (%eax),%edx
+ 9ed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9f0:	89 10                	mov    %edx,(%eax)
+ 9f2:	eb 26                	jmp    a1a <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 9f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9f7:	8b 40 04             	mov    0x4(%eax),%eax
+ 9fa:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9fd:	89 c2                	mov    %eax,%edx
+ 9ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a02:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a08:	8b 40 04             	mov    0x4(%eax),%eax
+ a0b:	c1 e0 03             	shl    $0x3,%eax
+ a0e:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a14:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a17:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a1a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a1d:	a3 8c 11 00 00       	mov    %eax,0x118c
+      return (void*)(p + 1);
+ a22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a25:	83 c0 08             	add    $0x8,%eax
+ a28:	eb 3b                	jmp    a65 <malloc+0xe1>
+    }
+    if(p == freep)
+ a2a:	a1 8c 11 00 00       	mov    0x118c,%eax
+ a2f:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a32:	75 1e                	jne    a52 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a34:	83 ec 0c             	sub    $0xc,%esp
+ a37:	ff 75 ec             	push   -0x14(%ebp)
+ a3a:	e8 e5 fe ff ff       	call   924 <morecore>
+ a3f:	83 c4 10             	add    $0x10,%esp
+ a42:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a45:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a49:	75 07                	jne    a52 <malloc+0xce>
+        return 0;
+ a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+ a50:	eb 13                	jmp    a65 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a55:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a5b:	8b 00                	mov    (%eax),%eax
+ a5d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a60:	e9 6d ff ff ff       	jmp    9d2 <malloc+0x4e>
+  }
+}
+ a65:	c9                   	leave
+ a66:	c3                   	ret
+
+00000a67 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ a67:	55                   	push   %ebp
+ a68:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a6d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ a73:	90                   	nop
+ a74:	5d                   	pop    %ebp
+ a75:	c3                   	ret
+
+00000a76 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ a76:	55                   	push   %ebp
+ a77:	89 e5                	mov    %esp,%ebp
+ a79:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ a7c:	8b 55 08             	mov    0x8(%ebp),%edx
+ a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+ a84:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a89:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ a8d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a90:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a94:	74 3b                	je     ad1 <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ a96:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ a9a:	74 2d                	je     ac9 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ a9c:	8b 55 08             	mov    0x8(%ebp),%edx
+ a9f:	b8 02 00 00 00       	mov    $0x2,%eax
+ aa4:	87 02                	xchg   %eax,(%edx)
+ aa6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ aa9:	eb 1e                	jmp    ac9 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ aab:	8b 45 08             	mov    0x8(%ebp),%eax
+ aae:	83 ec 08             	sub    $0x8,%esp
+ ab1:	6a 02                	push   $0x2
+ ab3:	50                   	push   %eax
+ ab4:	e8 f3 fa ff ff       	call   5ac <futex_wait>
+ ab9:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ abc:	8b 55 08             	mov    0x8(%ebp),%edx
+ abf:	b8 02 00 00 00       	mov    $0x2,%eax
+ ac4:	87 02                	xchg   %eax,(%edx)
+ ac6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ ac9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ acd:	75 dc                	jne    aab <mutex_lock+0x35>
+ acf:	eb 01                	jmp    ad2 <mutex_lock+0x5c>
+    return;
+ ad1:	90                   	nop
+  }
+}
+ ad2:	c9                   	leave
+ ad3:	c3                   	ret
+
+00000ad4 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ ad4:	55                   	push   %ebp
+ ad5:	89 e5                	mov    %esp,%ebp
+ ad7:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ ada:	8b 45 08             	mov    0x8(%ebp),%eax
+ add:	ba 01 00 00 00       	mov    $0x1,%edx
+ ae2:	f7 da                	neg    %edx
+ ae4:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ ae8:	83 fa 01             	cmp    $0x1,%edx
+ aeb:	74 1a                	je     b07 <mutex_unlock+0x33>
+    m->state = 0;
+ aed:	8b 45 08             	mov    0x8(%ebp),%eax
+ af0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ af6:	8b 45 08             	mov    0x8(%ebp),%eax
+ af9:	83 ec 08             	sub    $0x8,%esp
+ afc:	6a 01                	push   $0x1
+ afe:	50                   	push   %eax
+ aff:	e8 b0 fa ff ff       	call   5b4 <futex_wake>
+ b04:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ b07:	90                   	nop
+ b08:	c9                   	leave
+ b09:	c3                   	ret
+
+00000b0a <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ b0a:	55                   	push   %ebp
+ b0b:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ b0d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b10:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ b16:	8b 45 08             	mov    0x8(%ebp),%eax
+ b19:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ b20:	90                   	nop
+ b21:	5d                   	pop    %ebp
+ b22:	c3                   	ret
+
+00000b23 <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ b23:	55                   	push   %ebp
+ b24:	89 e5                	mov    %esp,%ebp
+ b26:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ b29:	8b 45 08             	mov    0x8(%ebp),%eax
+ b2c:	83 c0 04             	add    $0x4,%eax
+ b2f:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ b33:	8b 45 08             	mov    0x8(%ebp),%eax
+ b36:	83 ec 08             	sub    $0x8,%esp
+ b39:	ff 75 0c             	push   0xc(%ebp)
+ b3c:	50                   	push   %eax
+ b3d:	e8 6a fa ff ff       	call   5ac <futex_wait>
+ b42:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ b45:	8b 45 08             	mov    0x8(%ebp),%eax
+ b48:	83 c0 04             	add    $0x4,%eax
+ b4b:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ b4f:	90                   	nop
+ b50:	c9                   	leave
+ b51:	c3                   	ret
+
+00000b52 <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ b52:	55                   	push   %ebp
+ b53:	89 e5                	mov    %esp,%ebp
+ b55:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ b58:	8b 45 08             	mov    0x8(%ebp),%eax
+ b5b:	8b 00                	mov    (%eax),%eax
+ b5d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ b60:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b64:	78 17                	js     b7d <rwlock_rdlock+0x2b>
+ b66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b69:	83 c0 01             	add    $0x1,%eax
+ b6c:	89 c1                	mov    %eax,%ecx
+ b6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b71:	8b 55 08             	mov    0x8(%ebp),%edx
+ b74:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b78:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b7b:	74 19                	je     b96 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ b7d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b81:	79 d5                	jns    b58 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ b83:	83 ec 08             	sub    $0x8,%esp
+ b86:	ff 75 f4             	push   -0xc(%ebp)
+ b89:	ff 75 08             	push   0x8(%ebp)
+ b8c:	e8 92 ff ff ff       	call   b23 <rwlock_sleep>
+ b91:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ b94:	eb c2                	jmp    b58 <rwlock_rdlock+0x6>
+      return;
+ b96:	90                   	nop
+  }
+}
+ b97:	c9                   	leave
+ b98:	c3                   	ret
+
+00000b99 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ b99:	55                   	push   %ebp
+ b9a:	89 e5                	mov    %esp,%ebp
+ b9c:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ b9f:	eb 11                	jmp    bb2 <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ ba1:	83 ec 08             	sub    $0x8,%esp
+ ba4:	ff 75 f4             	push   -0xc(%ebp)
+ ba7:	ff 75 08             	push   0x8(%ebp)
+ baa:	e8 74 ff ff ff       	call   b23 <rwlock_sleep>
+ baf:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ bb2:	8b 55 08             	mov    0x8(%ebp),%edx
+ bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+ bba:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ bbf:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ bc3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ bc6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bca:	75 d5                	jne    ba1 <rwlock_wrlock+0x8>
+}
+ bcc:	90                   	nop
+ bcd:	90                   	nop
+ bce:	c9                   	leave
+ bcf:	c3                   	ret
+
+00000bd0 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ bd0:	55                   	push   %ebp
+ bd1:	89 e5                	mov    %esp,%ebp
+ bd3:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ bd6:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd9:	8b 00                	mov    (%eax),%eax
+ bdb:	85 c0                	test   %eax,%eax
+ bdd:	79 0c                	jns    beb <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+ be2:	ba 00 00 00 00       	mov    $0x0,%edx
+ be7:	87 10                	xchg   %edx,(%eax)
+ be9:	eb 18                	jmp    c03 <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ beb:	8b 55 08             	mov    0x8(%ebp),%edx
+ bee:	b8 01 00 00 00       	mov    $0x1,%eax
+ bf3:	f7 d8                	neg    %eax
+ bf5:	89 c1                	mov    %eax,%ecx
+ bf7:	89 c8                	mov    %ecx,%eax
+ bf9:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ bfd:	01 c8                	add    %ecx,%eax
+ bff:	85 c0                	test   %eax,%eax
+ c01:	75 20                	jne    c23 <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ c03:	8b 45 08             	mov    0x8(%ebp),%eax
+ c06:	8b 40 04             	mov    0x4(%eax),%eax
+ c09:	85 c0                	test   %eax,%eax
+ c0b:	74 17                	je     c24 <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ c0d:	8b 45 08             	mov    0x8(%ebp),%eax
+ c10:	83 ec 08             	sub    $0x8,%esp
+ c13:	68 ff ff ff 7f       	push   $0x7fffffff
+ c18:	50                   	push   %eax
+ c19:	e8 96 f9 ff ff       	call   5b4 <futex_wake>
+ c1e:	83 c4 10             	add    $0x10,%esp
+ c21:	eb 01                	jmp    c24 <rwlock_unlock+0x54>
+    return;
+ c23:	90                   	nop
+}
+ c24:	c9                   	leave
+ c25:	c3                   	ret
+
+00000c26 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ c26:	55                   	push   %ebp
+ c27:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ c29:	8b 45 08             	mov    0x8(%ebp),%eax
+ c2c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ c32:	90                   	nop
+ c33:	5d                   	pop    %ebp
+ c34:	c3                   	ret
+
+00000c35 <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ c35:	55                   	push   %ebp
+ c36:	89 e5                	mov    %esp,%ebp
+ c38:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ c3b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c3e:	8b 00                	mov    (%eax),%eax
+ c40:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ c43:	83 ec 0c             	sub    $0xc,%esp
+ c46:	ff 75 0c             	push   0xc(%ebp)
+ c49:	e8 86 fe ff ff       	call   ad4 <mutex_unlock>
+ c4e:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ c51:	8b 45 08             	mov    0x8(%ebp),%eax
+ c54:	83 ec 08             	sub    $0x8,%esp
+ c57:	ff 75 f4             	push   -0xc(%ebp)
+ c5a:	50                   	push   %eax
+ c5b:	e8 4c f9 ff ff       	call   5ac <futex_wait>
+ c60:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ c63:	83 ec 0c             	sub    $0xc,%esp
+ c66:	ff 75 0c             	push   0xc(%ebp)
+ c69:	e8 08 fe ff ff       	call   a76 <mutex_lock>
+ c6e:	83 c4 10             	add    $0x10,%esp
+}
+ c71:	90                   	nop
+ c72:	c9                   	leave
+ c73:	c3                   	ret
+
+00000c74 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ c74:	55                   	push   %ebp
+ c75:	89 e5                	mov    %esp,%ebp
+ c77:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c7a:	8b 45 08             	mov    0x8(%ebp),%eax
+ c7d:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ c81:	8b 45 08             	mov    0x8(%ebp),%eax
+ c84:	83 ec 08             	sub    $0x8,%esp
+ c87:	6a 01                	push   $0x1
+ c89:	50                   	push   %eax
+ c8a:	e8 25 f9 ff ff       	call   5b4 <futex_wake>
+ c8f:	83 c4 10             	add    $0x10,%esp
+}
+ c92:	90                   	nop
+ c93:	c9                   	leave
+ c94:	c3                   	ret
+
+00000c95 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ c95:	55                   	push   %ebp
+ c96:	89 e5                	mov    %esp,%ebp
+ c98:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c9b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c9e:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ ca2:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca5:	83 ec 08             	sub    $0x8,%esp
+ ca8:	68 ff ff ff 7f       	push   $0x7fffffff
+ cad:	50                   	push   %eax
+ cae:	e8 01 f9 ff ff       	call   5b4 <futex_wake>
+ cb3:	83 c4 10             	add    $0x10,%esp
+}
+ cb6:	90                   	nop
+ cb7:	c9                   	leave
+ cb8:	c3                   	ret
@@ -0,0 +1,40 @@
+#include "types.h"
+#include "user.h"
+#include "rusage.h"
+
+// Run a command and report the CPU time it used, in millions
+// of TSC cycles (2^20), split into user and kernel time, and
+// the page faults the kernel served for it.
+int main(int argc, char *argv[])
+{
+    struct rusage ru;
+    int start, pid;
+
+    if (argc < 2)
+    {
+        printf(2, "usage: time <command> <args>\n");
+        exit();
+    }
+
+    start = uptime();
+    pid = fork();
+    if (pid < 0)
+    {
+        printf(2, "time: fork failed\n");
+        exit();
+    }
+    if (pid == 0)
+    {
+        exec(argv[1], argv + 1);
+        printf(2, "time: exec %s failed\n", argv[1]);
+        exit();
+    }
+    wait();
+
+    getrusage(RUSAGE_CHILDREN, &ru);
+    printf(1, "%d ticks real, %d Mcycles user, %d Mcycles sys\n",
+           uptime() - start, (int)(ru.utime >> 20), (int)(ru.stime >> 20));
+    printf(1, "page faults: %d zero-fill, %d copy-on-write, %d shared memory\n",
+           ru.faults[FAULT_ZERO], ru.faults[FAULT_COW], ru.faults[FAULT_SHM]);
+    exit();
+}
@@ -0,0 +1,76 @@
+// Per-CPU rings of scheduling events.
+//
+// Each CPU appends only to its own ring, with interrupts off, so
+// the writer needs no lock. Readers are serialised by tracelock
+// and only ever advance tail; a full ring drops new events.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "schedtrace.h"
+
+struct tracering
+{
+  struct trace_event ev[TRACE_RING];
+  volatile uint head; // Next slot the owning CPU writes
+  volatile uint tail; // Next slot drain_schedtrace() reads
+};
+
+static struct tracering rings[NCPU];
+static struct spinlock tracelock;
+
+void initschedtrace(void)
+{
+  initlock(&tracelock, "schedtrace");
+}
+
+// Record an event for p. Caller has interrupts off
+// (it holds ptable.lock or a run queue lock).
+void trace_sched(int type, struct proc *p, int arg)
+{
+  struct cpu *c = mycpu();
+  struct tracering *r = &rings[c - cpus];
+  struct trace_event *e;
+
+  if (r->head - r->tail == TRACE_RING)
+    return;
+  e = &r->ev[r->head & (TRACE_RING - 1)];
+  e->tsc = rdtsc();
+  e->pid = p->pid;
+  e->type = type;
+  e->queue = p->queue;
+  e->cpu = c - cpus;
+  e->arg = arg;
+  // Publish the event before the slot is counted as written.
+  __sync_synchronize();
+  r->head++;
+}
+
+// Move up to n recorded events into buf, oldest first on each
+// CPU, and return how many were copied.
+int drain_schedtrace(struct trace_event *buf, int n)
+{
+  struct tracering *r;
+  uint head;
+  int copied = 0;
+
+  acquire(&tracelock);
+  for (r = rings; r < &rings[ncpu] && copied < n; r++)
+  {
+    head = r->head;
+    __sync_synchronize();
+    while (r->tail != head && copied < n)
+    {
+      buf[copied++] = r->ev[r->tail & (TRACE_RING - 1)];
+      __sync_synchronize();
+      r->tail++;
+    }
+  }
+  release(&tracelock);
+  return copied;
+}
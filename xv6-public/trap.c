@@ -33,6 +33,9 @@ void idtinit(void)
 // PAGEBREAK: 41
 void trap(struct trapframe *tf)
 {
+  if ((tf->cs & 3) == DPL_USER)
+    charge_cycles(1);
+
   if (tf->trapno == T_SYSCALL)
   {
     if (myproc()->killed)
@@ -41,6 +44,7 @@ void trap(struct trapframe *tf)
     syscall();
     if (myproc()->killed)
       exit();
+    charge_cycles(0);
     return;
   }
 
@@ -54,9 +58,15 @@ void trap(struct trapframe *tf)
       wakeup(&ticks);
       release(&tickslock);
       age_proc(ticks);
+      if (ticks % BALANCE_INTERVAL == 0)
+        balance_load();
     }
     lapiceoi();
     break;
+  case T_WAKEUP:
+    // Nothing to do: the interrupt itself ends the hlt in scheduler().
+    lapiceoi();
+    break;
   case T_IRQ0 + IRQ_IDE:
     ideintr();
     lapiceoi();
@@ -80,6 +90,13 @@ void trap(struct trapframe *tf)
     break;
 
   // PAGEBREAK: 13
+  case T_PGFLT:
+    // A write to a copy-on-write page, or the first touch of
+    // heap or shared memory; from user code or from the kernel
+    // copying to or from user memory.
+    if (myproc() && pagefault(myproc(), rcr2(), tf->err) == 0)
+      break;
+    // fall through
   default:
     if (myproc() == 0 || (tf->cs & 3) == 0)
     {
@@ -102,13 +119,16 @@ void trap(struct trapframe *tf)
   if (myproc() && myproc()->killed && (tf->cs & 3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU once its quantum is used up.
   // If interrupts were on while locks held, would need to check nlock.
   if (myproc() && myproc()->state == RUNNING &&
-      tf->trapno == T_IRQ0 + IRQ_TIMER)
+      tf->trapno == T_IRQ0 + IRQ_TIMER && slice_expired())
     yield();
 
   // Check if the process has been killed since we yielded
   if (myproc() && myproc()->killed && (tf->cs & 3) == DPL_USER)
     exit();
+
+  if ((tf->cs & 3) == DPL_USER)
+    charge_cycles(0);
 }
@@ -1,5 +1,11 @@
 struct stat;
 struct rtcdate;
+struct trace_event;
+struct rusage;
+struct plstat;
+struct syslat;
+struct batch_ring;
+struct kmemstat;
 
 // system calls
 int fork(void);
@@ -33,12 +39,27 @@ void set_bjf_params_for_system(float, float, float, float);
 void print_process_info();
 int set_bjf_priority(int, int);
 void init_prioritylock(void);
-void acquire_prioritylock(void);
-void release_prioritylock(void);
+int acquire_prioritylock(int);
+int release_prioritylock(int);
+int create_prioritylock(const char *);
+int destroy_prioritylock(int);
+int prioritylock_stats(int, struct plstat *);
+int futex_wait(volatile int *, int);
+int futex_wake(volatile int *, int);
+int syscall_latency(struct syslat *);
+int submit_batch(struct batch_ring *);
+int kmem_stats(struct kmemstat *, int);
+int kmem_junk(int);
 void print_syscall_count(void);
 void reset_syscall_count(void);
-void *open_sharedmem(int);
+void *open_sharedmem(int, int);
 void close_sharedmem(int);
+int set_affinity(int, int);
+int setsched(int, int);
+int get_idle_cycles(int, uint64 *);
+int set_quantum(int, int);
+int schedtrace(struct trace_event *, int);
+int getrusage(int, struct rusage *);
 
 // ulib.c
 int stat(const char *, struct stat *);
@@ -53,3 +74,4 @@ void *memset(void *, int, uint);
 void *malloc(uint);
 void free(void *);
 int atoi(const char *);
+uint64 udiv64(uint64, uint);
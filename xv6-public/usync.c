@@ -0,0 +1,120 @@
+#include "types.h"
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+  m->state = 0;
+}
+
+void
+mutex_lock(struct mutex *m)
+{
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+    c = __sync_lock_test_and_set(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    c = __sync_lock_test_and_set(&m->state, 2);
+  }
+}
+
+void
+mutex_unlock(struct mutex *m)
+{
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+  rw->state = 0;
+  rw->waiters = 0;
+}
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+  futex_wait(&rw->state, seen);
+  __sync_fetch_and_sub(&rw->waiters, 1);
+}
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+  int s;
+
+  for(;;){
+    s = rw->state;
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+      return;
+    if(s < 0)
+      rwlock_sleep(rw, s);
+  }
+}
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+    rwlock_sleep(rw, s);
+}
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+  if(rw->state < 0)
+    __sync_lock_test_and_set(&rw->state, 0);
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+    return;
+  if(rw->waiters)
+    futex_wake(&rw->state, WAKE_ALL);
+}
+
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  int seq = c->seq;
+
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+  mutex_lock(m);
+}
+
+void
+cond_signal(struct cond *c)
+{
+  __sync_fetch_and_add(&c->seq, 1);
+  futex_wake(&c->seq, 1);
+}
+
+void
+cond_broadcast(struct cond *c)
+{
+  __sync_fetch_and_add(&c->seq, 1);
+  futex_wake(&c->seq, WAKE_ALL);
+}
@@ -0,0 +1,33 @@
+// User-space locks built on futexes. They must live in a shared
+// memory page (open_sharedmem) to be shared between processes;
+// the uncontended paths are a single atomic instruction.
+
+struct mutex
+{
+  volatile int state; // 0 free, 1 locked, 2 locked and maybe waited on
+};
+
+struct rwlock
+{
+  volatile int state;   // -1 write locked, else the number of readers
+  volatile int waiters; // Processes asleep on state
+};
+
+struct cond
+{
+  volatile int seq; // Bumped by every signal and broadcast
+};
+
+#define WAKE_ALL 0x7fffffff // futex_wake() count that wakes every waiter
+
+void mutex_init(struct mutex *);
+void mutex_lock(struct mutex *);
+void mutex_unlock(struct mutex *);
+void rwlock_init(struct rwlock *);
+void rwlock_rdlock(struct rwlock *);
+void rwlock_wrlock(struct rwlock *);
+void rwlock_unlock(struct rwlock *);
+void cond_init(struct cond *);
+void cond_wait(struct cond *, struct mutex *);
+void cond_signal(struct cond *);
+void cond_broadcast(struct cond *);
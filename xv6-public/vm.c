@@ -44,10 +44,9 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   }
   else
   {
-    if (!alloc || (pgtab = (pte_t *)kalloc()) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if (!alloc || (pgtab = (pte_t *)kzalloc()) == 0)
+      return 0;
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -89,8 +88,9 @@ int mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 //
 // setupkvm() and exec() set up every page table like this:
 //
-//   0..KERNBASE: user memory (text+data+stack+heap), mapped to
+//   0..SHMBASE: user memory (text+data+stack+heap), mapped to
 //                phys memory allocated by the kernel
+//   SHMBASE..KERNBASE: shared memory regions (see shm_open in proc.c)
 //   KERNBASE..KERNBASE+EXTMEM: mapped to 0..EXTMEM (for I/O space)
 //   KERNBASE+EXTMEM..data: mapped to EXTMEM..V2P(data)
 //                for the kernel's instructions and r/o data
@@ -124,9 +124,8 @@ setupkvm(void)
   pde_t *pgdir;
   struct kmap *k;
 
-  if ((pgdir = (pde_t *)kalloc()) == 0)
+  if ((pgdir = (pde_t *)kzalloc()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
   if (P2V(PHYSTOP) > (void *)DEVSPACE)
     panic("PHYSTOP too high");
   for (k = kmap; k < &kmap[NELEM(kmap)]; k++)
@@ -186,8 +185,7 @@ void inituvm(pde_t *pgdir, char *init, uint sz)
 
   if (sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kzalloc();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W | PTE_U);
   memmove(mem, init, sz);
 }
@@ -223,7 +221,7 @@ int allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   char *mem;
   uint a;
 
-  if (newsz >= KERNBASE)
+  if (newsz > SHMBASE)
     return 0;
   if (newsz < oldsz)
     return oldsz;
@@ -231,14 +229,13 @@ int allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   a = PGROUNDUP(oldsz);
   for (; a < newsz; a += PGSIZE)
   {
-    mem = kalloc();
+    mem = kzalloc();
     if (mem == 0)
     {
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if (mappages(pgdir, (char *)a, PGSIZE, V2P(mem), PTE_W | PTE_U) < 0)
     {
       cprintf("allocuvm out of memory (2)\n");
@@ -314,41 +311,142 @@ void clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child. Pages are not copied: both map the
+// same frames, with writable ones made read-only and
+// PTE_COW until cowfault() copies them on a write.
+// pgdir must be the current page table.
 pde_t *
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
   pte_t *pte;
   uint pa, i, flags;
-  char *mem;
 
   if ((d = setupkvm()) == 0)
     return 0;
   for (i = 0; i < sz; i += PGSIZE)
   {
     if ((pte = walkpgdir(pgdir, (void *)i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+    {
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
     if (!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+      continue; // Heap not touched yet; the child faults it in too.
+    if (*pte & PTE_W)
+      *pte = (*pte & ~PTE_W) | PTE_COW;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if ((mem = kalloc()) == 0)
+    if (mappages(d, (void *)i, PGSIZE, pa, flags) < 0)
       goto bad;
-    memmove(mem, (char *)P2V(pa), PGSIZE);
-    if (mappages(d, (void *)i, PGSIZE, V2P(mem), flags) < 0)
-    {
-      kfree(mem);
-      goto bad;
-    }
+    kref((char *)P2V(pa));
   }
+  lcr3(V2P(pgdir)); // The parent's pages may have become read-only.
   return d;
 
 bad:
+  lcr3(V2P(pgdir));
   freevm(d);
   return 0;
 }
 
+// Handle a write fault at va on a copy-on-write page: copy
+// the page, or if no one else maps it any more just make it
+// writable again. Returns -1 if va is not a COW page or no
+// memory is left for the copy.
+int cowfault(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  uint pa;
+  char *mem;
+
+  if (va >= KERNBASE || (pte = walkpgdir(pgdir, (void *)va, 0)) == 0)
+    return -1;
+  if ((*pte & (PTE_P | PTE_U | PTE_COW)) != (PTE_P | PTE_U | PTE_COW))
+    return -1;
+  pa = PTE_ADDR(*pte);
+  if (krefs((char *)P2V(pa)) == 1)
+    *pte = (*pte & ~PTE_COW) | PTE_W;
+  else
+  {
+    if ((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, (char *)P2V(pa), PGSIZE);
+    *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+    kfree((char *)P2V(pa));
+  }
+  lcr3(V2P(pgdir));
+  return 0;
+}
+
+// Back the page holding va with a zeroed frame, if it lies
+// below sz and has no frame yet: heap that growproc() handed
+// out without allocating. Returns -1 otherwise.
+int lazyfault(pde_t *pgdir, uint sz, uint va)
+{
+  pte_t *pte;
+  char *mem;
+
+  if (va >= sz)
+    return -1;
+  if ((pte = walkpgdir(pgdir, (void *)va, 0)) != 0 && (*pte & PTE_P))
+    return -1;
+  if ((mem = kzalloc()) == 0)
+    return -1;
+  if (mappages(pgdir, (char *)PGROUNDDOWN(va), PGSIZE, V2P(mem), PTE_W | PTE_U) < 0)
+  {
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Serve a page fault at va in process p, err being the fault's
+// error code. Returns 0 if the faulting access can be retried.
+int pagefault(struct proc *p, uint va, uint err)
+{
+  int kind;
+
+  if ((err & FEC_WR) && cowfault(p->pgdir, va) == 0)
+    kind = FAULT_COW;
+  else if (lazyfault(p->pgdir, p->sz, va) == 0)
+    kind = FAULT_ZERO;
+  else if (shm_fault(p, va) == 0)
+    kind = FAULT_SHM;
+  else
+    return -1;
+  p->faults[kind]++;
+  return 0;
+}
+
+// Back every page of [va, va+len) in process p that has no frame
+// yet, and if write is set copy the copy-on-write ones, as the
+// faults a kernel access would take do. System calls do this
+// before touching user memory, so a page that cannot be backed
+// fails the call rather than faulting in the kernel, where trap()
+// could only panic. Returns -1 if some page can't be.
+int uvmprefault(struct proc *p, uint va, uint len, int write)
+{
+  pte_t *pte;
+  uint a, last;
+
+  if (len == 0)
+    return 0;
+  a = PGROUNDDOWN(va);
+  last = PGROUNDDOWN(va + len - 1);
+  for (;; a += PGSIZE)
+  {
+    pte = walkpgdir(p->pgdir, (void *)a, 0);
+    if ((pte == 0 || !(*pte & PTE_P)) && pagefault(p, a, 0) < 0)
+      return -1;
+    if (write && (pte = walkpgdir(p->pgdir, (void *)a, 0)) != 0 &&
+        (*pte & PTE_COW) && pagefault(p, a, FEC_WR) < 0)
+      return -1;
+    if (a == last)
+      return 0;
+  }
+}
+
 // PAGEBREAK!
 //  Map user virtual address to kernel address.
 char *
@@ -0,0 +1,1891 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+   6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+   d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  10:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  13:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  inword = 0;
+  19:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  20:	eb 69                	jmp    8b <wc+0x8b>
+    for(i=0; i<n; i++){
+  22:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  29:	eb 58                	jmp    83 <wc+0x83>
+      c++;
+  2b:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+      if(buf[i] == '\n')
+  2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  32:	05 e0 11 00 00       	add    $0x11e0,%eax
+  37:	0f b6 00             	movzbl (%eax),%eax
+  3a:	3c 0a                	cmp    $0xa,%al
+  3c:	75 04                	jne    42 <wc+0x42>
+        l++;
+  3e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(strchr(" \r\t\n\v", buf[i]))
+  42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  45:	05 e0 11 00 00       	add    $0x11e0,%eax
+  4a:	0f b6 00             	movzbl (%eax),%eax
+  4d:	0f be c0             	movsbl %al,%eax
+  50:	83 ec 08             	sub    $0x8,%esp
+  53:	50                   	push   %eax
+  54:	68 63 0d 00 00       	push   $0xd63
+  59:	e8 35 02 00 00       	call   293 <strchr>
+  5e:	83 c4 10             	add    $0x10,%esp
+  61:	85 c0                	test   %eax,%eax
+  63:	74 09                	je     6e <wc+0x6e>
+        inword = 0;
+  65:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  6c:	eb 11                	jmp    7f <wc+0x7f>
+      else if(!inword){
+  6e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  72:	75 0b                	jne    7f <wc+0x7f>
+        w++;
+  74:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+        inword = 1;
+  78:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+  7f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  86:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+  89:	7c a0                	jl     2b <wc+0x2b>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  8b:	83 ec 04             	sub    $0x4,%esp
+  8e:	68 00 02 00 00       	push   $0x200
+  93:	68 e0 11 00 00       	push   $0x11e0
+  98:	ff 75 08             	push   0x8(%ebp)
+  9b:	e8 66 04 00 00       	call   506 <read>
+  a0:	83 c4 10             	add    $0x10,%esp
+  a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  aa:	0f 8f 72 ff ff ff    	jg     22 <wc+0x22>
+      }
+    }
+  }
+  if(n < 0){
+  b0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  b4:	79 17                	jns    cd <wc+0xcd>
+    printf(1, "wc: read error\n");
+  b6:	83 ec 08             	sub    $0x8,%esp
+  b9:	68 69 0d 00 00       	push   $0xd69
+  be:	6a 01                	push   $0x1
+  c0:	e8 95 06 00 00       	call   75a <printf>
+  c5:	83 c4 10             	add    $0x10,%esp
+    exit();
+  c8:	e8 21 04 00 00       	call   4ee <exit>
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+  cd:	83 ec 08             	sub    $0x8,%esp
+  d0:	ff 75 0c             	push   0xc(%ebp)
+  d3:	ff 75 e8             	push   -0x18(%ebp)
+  d6:	ff 75 ec             	push   -0x14(%ebp)
+  d9:	ff 75 f0             	push   -0x10(%ebp)
+  dc:	68 79 0d 00 00       	push   $0xd79
+  e1:	6a 01                	push   $0x1
+  e3:	e8 72 06 00 00       	call   75a <printf>
+  e8:	83 c4 20             	add    $0x20,%esp
+}
+  eb:	90                   	nop
+  ec:	c9                   	leave
+  ed:	c3                   	ret
+
+000000ee <main>:
+
+int
+main(int argc, char *argv[])
+{
+  ee:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f2:	83 e4 f0             	and    $0xfffffff0,%esp
+  f5:	ff 71 fc             	push   -0x4(%ecx)
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	53                   	push   %ebx
+  fc:	51                   	push   %ecx
+  fd:	83 ec 10             	sub    $0x10,%esp
+ 100:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+ 102:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 105:	7f 17                	jg     11e <main+0x30>
+    wc(0, "");
+ 107:	83 ec 08             	sub    $0x8,%esp
+ 10a:	68 86 0d 00 00       	push   $0xd86
+ 10f:	6a 00                	push   $0x0
+ 111:	e8 ea fe ff ff       	call   0 <wc>
+ 116:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 119:	e8 d0 03 00 00       	call   4ee <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+ 11e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 125:	e9 83 00 00 00       	jmp    1ad <main+0xbf>
+    if((fd = open(argv[i], 0)) < 0){
+ 12a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 12d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 134:	8b 43 04             	mov    0x4(%ebx),%eax
+ 137:	01 d0                	add    %edx,%eax
+ 139:	8b 00                	mov    (%eax),%eax
+ 13b:	83 ec 08             	sub    $0x8,%esp
+ 13e:	6a 00                	push   $0x0
+ 140:	50                   	push   %eax
+ 141:	e8 e8 03 00 00       	call   52e <open>
+ 146:	83 c4 10             	add    $0x10,%esp
+ 149:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 14c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 150:	79 29                	jns    17b <main+0x8d>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+ 152:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 155:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 15c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 15f:	01 d0                	add    %edx,%eax
+ 161:	8b 00                	mov    (%eax),%eax
+ 163:	83 ec 04             	sub    $0x4,%esp
+ 166:	50                   	push   %eax
+ 167:	68 87 0d 00 00       	push   $0xd87
+ 16c:	6a 01                	push   $0x1
+ 16e:	e8 e7 05 00 00       	call   75a <printf>
+ 173:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 176:	e8 73 03 00 00       	call   4ee <exit>
+    }
+    wc(fd, argv[i]);
+ 17b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17e:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 185:	8b 43 04             	mov    0x4(%ebx),%eax
+ 188:	01 d0                	add    %edx,%eax
+ 18a:	8b 00                	mov    (%eax),%eax
+ 18c:	83 ec 08             	sub    $0x8,%esp
+ 18f:	50                   	push   %eax
+ 190:	ff 75 f0             	push   -0x10(%ebp)
+ 193:	e8 68 fe ff ff       	call   0 <wc>
+ 198:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 19b:	83 ec 0c             	sub    $0xc,%esp
+ 19e:	ff 75 f0             	push   -0x10(%ebp)
+ 1a1:	e8 70 03 00 00       	call   516 <close>
+ 1a6:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+ 1a9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1b0:	3b 03                	cmp    (%ebx),%eax
+ 1b2:	0f 8c 72 ff ff ff    	jl     12a <main+0x3c>
+  }
+  exit();
+ 1b8:	e8 31 03 00 00       	call   4ee <exit>
+
+000001bd <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+ 1bd:	55                   	push   %ebp
+ 1be:	89 e5                	mov    %esp,%ebp
+ 1c0:	57                   	push   %edi
+ 1c1:	53                   	push   %ebx
+{
+ 1c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c5:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cb:	89 cb                	mov    %ecx,%ebx
+ 1cd:	89 df                	mov    %ebx,%edi
+ 1cf:	89 d1                	mov    %edx,%ecx
+ 1d1:	fc                   	cld
+ 1d2:	f3 aa                	rep stos %al,%es:(%edi)
+ 1d4:	89 ca                	mov    %ecx,%edx
+ 1d6:	89 fb                	mov    %edi,%ebx
+ 1d8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1db:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+ 1de:	90                   	nop
+ 1df:	5b                   	pop    %ebx
+ 1e0:	5f                   	pop    %edi
+ 1e1:	5d                   	pop    %ebp
+ 1e2:	c3                   	ret
+
+000001e3 <strcpy>:
+{
+ 1e3:	55                   	push   %ebp
+ 1e4:	89 e5                	mov    %esp,%ebp
+ 1e6:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ec:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1ef:	90                   	nop
+ 1f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1f3:	8d 42 01             	lea    0x1(%edx),%eax
+ 1f6:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fc:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1ff:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 202:	0f b6 12             	movzbl (%edx),%edx
+ 205:	88 10                	mov    %dl,(%eax)
+ 207:	0f b6 00             	movzbl (%eax),%eax
+ 20a:	84 c0                	test   %al,%al
+ 20c:	75 e2                	jne    1f0 <strcpy+0xd>
+  return os;
+ 20e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 211:	c9                   	leave
+ 212:	c3                   	ret
+
+00000213 <strcmp>:
+{
+ 213:	55                   	push   %ebp
+ 214:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 216:	eb 08                	jmp    220 <strcmp+0xd>
+    p++, q++;
+ 218:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 21c:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 220:	8b 45 08             	mov    0x8(%ebp),%eax
+ 223:	0f b6 00             	movzbl (%eax),%eax
+ 226:	84 c0                	test   %al,%al
+ 228:	74 10                	je     23a <strcmp+0x27>
+ 22a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22d:	0f b6 10             	movzbl (%eax),%edx
+ 230:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 233:	0f b6 00             	movzbl (%eax),%eax
+ 236:	38 c2                	cmp    %al,%dl
+ 238:	74 de                	je     218 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 23a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23d:	0f b6 00             	movzbl (%eax),%eax
+ 240:	0f b6 d0             	movzbl %al,%edx
+ 243:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 246:	0f b6 00             	movzbl (%eax),%eax
+ 249:	0f b6 c0             	movzbl %al,%eax
+ 24c:	29 c2                	sub    %eax,%edx
+ 24e:	89 d0                	mov    %edx,%eax
+}
+ 250:	5d                   	pop    %ebp
+ 251:	c3                   	ret
+
+00000252 <strlen>:
+{
+ 252:	55                   	push   %ebp
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 258:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 25f:	eb 04                	jmp    265 <strlen+0x13>
+ 261:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 265:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 268:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26b:	01 d0                	add    %edx,%eax
+ 26d:	0f b6 00             	movzbl (%eax),%eax
+ 270:	84 c0                	test   %al,%al
+ 272:	75 ed                	jne    261 <strlen+0xf>
+  return n;
+ 274:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+
+00000279 <memset>:
+{
+ 279:	55                   	push   %ebp
+ 27a:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 27c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 27f:	50                   	push   %eax
+ 280:	ff 75 0c             	push   0xc(%ebp)
+ 283:	ff 75 08             	push   0x8(%ebp)
+ 286:	e8 32 ff ff ff       	call   1bd <stosb>
+ 28b:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 28e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 291:	c9                   	leave
+ 292:	c3                   	ret
+
+00000293 <strchr>:
+{
+ 293:	55                   	push   %ebp
+ 294:	89 e5                	mov    %esp,%ebp
+ 296:	83 ec 04             	sub    $0x4,%esp
+ 299:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29c:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 29f:	eb 14                	jmp    2b5 <strchr+0x22>
+    if(*s == c)
+ 2a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a4:	0f b6 00             	movzbl (%eax),%eax
+ 2a7:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2aa:	75 05                	jne    2b1 <strchr+0x1e>
+      return (char*)s;
+ 2ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2af:	eb 13                	jmp    2c4 <strchr+0x31>
+  for(; *s; s++)
+ 2b1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b8:	0f b6 00             	movzbl (%eax),%eax
+ 2bb:	84 c0                	test   %al,%al
+ 2bd:	75 e2                	jne    2a1 <strchr+0xe>
+  return 0;
+ 2bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+
+000002c6 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2c6:	55                   	push   %ebp
+ 2c7:	89 e5                	mov    %esp,%ebp
+ 2c9:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2d3:	eb 42                	jmp    317 <gets+0x51>
+    cc = read(0, &c, 1);
+ 2d5:	83 ec 04             	sub    $0x4,%esp
+ 2d8:	6a 01                	push   $0x1
+ 2da:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2dd:	50                   	push   %eax
+ 2de:	6a 00                	push   $0x0
+ 2e0:	e8 21 02 00 00       	call   506 <read>
+ 2e5:	83 c4 10             	add    $0x10,%esp
+ 2e8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2eb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2ef:	7e 33                	jle    324 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 2f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2f4:	8d 50 01             	lea    0x1(%eax),%edx
+ 2f7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2fa:	89 c2                	mov    %eax,%edx
+ 2fc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ff:	01 c2                	add    %eax,%edx
+ 301:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 305:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 307:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 30b:	3c 0a                	cmp    $0xa,%al
+ 30d:	74 16                	je     325 <gets+0x5f>
+ 30f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 313:	3c 0d                	cmp    $0xd,%al
+ 315:	74 0e                	je     325 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 31a:	83 c0 01             	add    $0x1,%eax
+ 31d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 320:	7f b3                	jg     2d5 <gets+0xf>
+ 322:	eb 01                	jmp    325 <gets+0x5f>
+      break;
+ 324:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 325:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 328:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32b:	01 d0                	add    %edx,%eax
+ 32d:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 330:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 333:	c9                   	leave
+ 334:	c3                   	ret
+
+00000335 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 335:	55                   	push   %ebp
+ 336:	89 e5                	mov    %esp,%ebp
+ 338:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 33b:	83 ec 08             	sub    $0x8,%esp
+ 33e:	6a 00                	push   $0x0
+ 340:	ff 75 08             	push   0x8(%ebp)
+ 343:	e8 e6 01 00 00       	call   52e <open>
+ 348:	83 c4 10             	add    $0x10,%esp
+ 34b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 34e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 352:	79 07                	jns    35b <stat+0x26>
+    return -1;
+ 354:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 359:	eb 25                	jmp    380 <stat+0x4b>
+  r = fstat(fd, st);
+ 35b:	83 ec 08             	sub    $0x8,%esp
+ 35e:	ff 75 0c             	push   0xc(%ebp)
+ 361:	ff 75 f4             	push   -0xc(%ebp)
+ 364:	e8 dd 01 00 00       	call   546 <fstat>
+ 369:	83 c4 10             	add    $0x10,%esp
+ 36c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 36f:	83 ec 0c             	sub    $0xc,%esp
+ 372:	ff 75 f4             	push   -0xc(%ebp)
+ 375:	e8 9c 01 00 00       	call   516 <close>
+ 37a:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 37d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 380:	c9                   	leave
+ 381:	c3                   	ret
+
+00000382 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 382:	55                   	push   %ebp
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 388:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 38f:	eb 25                	jmp    3b6 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 391:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 394:	89 d0                	mov    %edx,%eax
+ 396:	c1 e0 02             	shl    $0x2,%eax
+ 399:	01 d0                	add    %edx,%eax
+ 39b:	01 c0                	add    %eax,%eax
+ 39d:	89 c1                	mov    %eax,%ecx
+ 39f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a2:	8d 50 01             	lea    0x1(%eax),%edx
+ 3a5:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3a8:	0f b6 00             	movzbl (%eax),%eax
+ 3ab:	0f be c0             	movsbl %al,%eax
+ 3ae:	01 c8                	add    %ecx,%eax
+ 3b0:	83 e8 30             	sub    $0x30,%eax
+ 3b3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b9:	0f b6 00             	movzbl (%eax),%eax
+ 3bc:	3c 2f                	cmp    $0x2f,%al
+ 3be:	7e 0a                	jle    3ca <atoi+0x48>
+ 3c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c3:	0f b6 00             	movzbl (%eax),%eax
+ 3c6:	3c 39                	cmp    $0x39,%al
+ 3c8:	7e c7                	jle    391 <atoi+0xf>
+  return n;
+ 3ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3cd:	c9                   	leave
+ 3ce:	c3                   	ret
+
+000003cf <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3cf:	55                   	push   %ebp
+ 3d0:	89 e5                	mov    %esp,%ebp
+ 3d2:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 3d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3db:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3de:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3e1:	eb 17                	jmp    3fa <memmove+0x2b>
+    *dst++ = *src++;
+ 3e3:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3e6:	8d 42 01             	lea    0x1(%edx),%eax
+ 3e9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3ef:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3f2:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3f5:	0f b6 12             	movzbl (%edx),%edx
+ 3f8:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3fa:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3fd:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 400:	89 55 10             	mov    %edx,0x10(%ebp)
+ 403:	85 c0                	test   %eax,%eax
+ 405:	7f dc                	jg     3e3 <memmove+0x14>
+  return vdst;
+ 407:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 40a:	c9                   	leave
+ 40b:	c3                   	ret
+
+0000040c <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 40c:	55                   	push   %ebp
+ 40d:	89 e5                	mov    %esp,%ebp
+ 40f:	57                   	push   %edi
+ 410:	56                   	push   %esi
+ 411:	83 ec 30             	sub    $0x30,%esp
+ 414:	8b 45 08             	mov    0x8(%ebp),%eax
+ 417:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 41a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 41d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 420:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 427:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 42e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 431:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 434:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 437:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 43a:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 441:	e9 89 00 00 00       	jmp    4cf <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 446:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 449:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 44c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 450:	01 c0                	add    %eax,%eax
+ 452:	89 c6                	mov    %eax,%esi
+ 454:	89 d7                	mov    %edx,%edi
+ 456:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 459:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 45c:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 45f:	0f ad d0             	shrd   %cl,%edx,%eax
+ 462:	d3 ea                	shr    %cl,%edx
+ 464:	f6 c1 20             	test   $0x20,%cl
+ 467:	74 04                	je     46d <udiv64+0x61>
+ 469:	89 d0                	mov    %edx,%eax
+ 46b:	31 d2                	xor    %edx,%edx
+ 46d:	83 e0 01             	and    $0x1,%eax
+ 470:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 473:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 47a:	89 f0                	mov    %esi,%eax
+ 47c:	89 fa                	mov    %edi,%edx
+ 47e:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 481:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 484:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 487:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 48a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 48d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 492:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 495:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 498:	19 d1                	sbb    %edx,%ecx
+ 49a:	72 2f                	jb     4cb <udiv64+0xbf>
+      r -= d;
+ 49c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 49f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4a4:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 4a7:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 4aa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 4ad:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4b2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4b7:	0f a5 c2             	shld   %cl,%eax,%edx
+ 4ba:	d3 e0                	shl    %cl,%eax
+ 4bc:	f6 c1 20             	test   $0x20,%cl
+ 4bf:	74 04                	je     4c5 <udiv64+0xb9>
+ 4c1:	89 c2                	mov    %eax,%edx
+ 4c3:	31 c0                	xor    %eax,%eax
+ 4c5:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 4c8:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 4cb:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 4cf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 4d3:	0f 89 6d ff ff ff    	jns    446 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 4d9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 4dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 4df:	83 c4 30             	add    $0x30,%esp
+ 4e2:	5e                   	pop    %esi
+ 4e3:	5f                   	pop    %edi
+ 4e4:	5d                   	pop    %ebp
+ 4e5:	c3                   	ret
+
+000004e6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4e6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4eb:	cd 40                	int    $0x40
+ 4ed:	c3                   	ret
+
+000004ee <exit>:
+SYSCALL(exit)
+ 4ee:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4f3:	cd 40                	int    $0x40
+ 4f5:	c3                   	ret
+
+000004f6 <wait>:
+SYSCALL(wait)
+ 4f6:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4fb:	cd 40                	int    $0x40
+ 4fd:	c3                   	ret
+
+000004fe <pipe>:
+SYSCALL(pipe)
+ 4fe:	b8 04 00 00 00       	mov    $0x4,%eax
+ 503:	cd 40                	int    $0x40
+ 505:	c3                   	ret
+
+00000506 <read>:
+SYSCALL(read)
+ 506:	b8 05 00 00 00       	mov    $0x5,%eax
+ 50b:	cd 40                	int    $0x40
+ 50d:	c3                   	ret
+
+0000050e <write>:
+SYSCALL(write)
+ 50e:	b8 10 00 00 00       	mov    $0x10,%eax
+ 513:	cd 40                	int    $0x40
+ 515:	c3                   	ret
+
+00000516 <close>:
+SYSCALL(close)
+ 516:	b8 15 00 00 00       	mov    $0x15,%eax
+ 51b:	cd 40                	int    $0x40
+ 51d:	c3                   	ret
+
+0000051e <kill>:
+SYSCALL(kill)
+ 51e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 523:	cd 40                	int    $0x40
+ 525:	c3                   	ret
+
+00000526 <exec>:
+SYSCALL(exec)
+ 526:	b8 07 00 00 00       	mov    $0x7,%eax
+ 52b:	cd 40                	int    $0x40
+ 52d:	c3                   	ret
+
+0000052e <open>:
+SYSCALL(open)
+ 52e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 533:	cd 40                	int    $0x40
+ 535:	c3                   	ret
+
+00000536 <mknod>:
+SYSCALL(mknod)
+ 536:	b8 11 00 00 00       	mov    $0x11,%eax
+ 53b:	cd 40                	int    $0x40
+ 53d:	c3                   	ret
+
+0000053e <unlink>:
+SYSCALL(unlink)
+ 53e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <fstat>:
+SYSCALL(fstat)
+ 546:	b8 08 00 00 00       	mov    $0x8,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <link>:
+SYSCALL(link)
+ 54e:	b8 13 00 00 00       	mov    $0x13,%eax
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <mkdir>:
+SYSCALL(mkdir)
+ 556:	b8 14 00 00 00       	mov    $0x14,%eax
+ 55b:	cd 40                	int    $0x40
+ 55d:	c3                   	ret
+
+0000055e <chdir>:
+SYSCALL(chdir)
+ 55e:	b8 09 00 00 00       	mov    $0x9,%eax
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <dup>:
+SYSCALL(dup)
+ 566:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 56b:	cd 40                	int    $0x40
+ 56d:	c3                   	ret
+
+0000056e <getpid>:
+SYSCALL(getpid)
+ 56e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 573:	cd 40                	int    $0x40
+ 575:	c3                   	ret
+
+00000576 <sbrk>:
+SYSCALL(sbrk)
+ 576:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 57b:	cd 40                	int    $0x40
+ 57d:	c3                   	ret
+
+0000057e <sleep>:
+SYSCALL(sleep)
+ 57e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 583:	cd 40                	int    $0x40
+ 585:	c3                   	ret
+
+00000586 <uptime>:
+SYSCALL(uptime)
+ 586:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 58b:	cd 40                	int    $0x40
+ 58d:	c3                   	ret
+
+0000058e <find_digital_root>:
+SYSCALL(find_digital_root)
+ 58e:	b8 16 00 00 00       	mov    $0x16,%eax
+ 593:	cd 40                	int    $0x40
+ 595:	c3                   	ret
+
+00000596 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 596:	b8 17 00 00 00       	mov    $0x17,%eax
+ 59b:	cd 40                	int    $0x40
+ 59d:	c3                   	ret
+
+0000059e <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 59e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5a3:	cd 40                	int    $0x40
+ 5a5:	c3                   	ret
+
+000005a6 <copy_file>:
+SYSCALL(copy_file)
+ 5a6:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5ab:	cd 40                	int    $0x40
+ 5ad:	c3                   	ret
+
+000005ae <change_queue>:
+SYSCALL(change_queue)
+ 5ae:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5b3:	cd 40                	int    $0x40
+ 5b5:	c3                   	ret
+
+000005b6 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 5b6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5bb:	cd 40                	int    $0x40
+ 5bd:	c3                   	ret
+
+000005be <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 5be:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5c3:	cd 40                	int    $0x40
+ 5c5:	c3                   	ret
+
+000005c6 <print_process_info>:
+SYSCALL(print_process_info)
+ 5c6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5cb:	cd 40                	int    $0x40
+ 5cd:	c3                   	ret
+
+000005ce <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 5ce:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5d3:	cd 40                	int    $0x40
+ 5d5:	c3                   	ret
+
+000005d6 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 5d6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5db:	cd 40                	int    $0x40
+ 5dd:	c3                   	ret
+
+000005de <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 5de:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5e3:	cd 40                	int    $0x40
+ 5e5:	c3                   	ret
+
+000005e6 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 5e6:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5eb:	cd 40                	int    $0x40
+ 5ed:	c3                   	ret
+
+000005ee <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 5ee:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5f3:	cd 40                	int    $0x40
+ 5f5:	c3                   	ret
+
+000005f6 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 5f6:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5fb:	cd 40                	int    $0x40
+ 5fd:	c3                   	ret
+
+000005fe <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 5fe:	b8 24 00 00 00       	mov    $0x24,%eax
+ 603:	cd 40                	int    $0x40
+ 605:	c3                   	ret
+
+00000606 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 606:	b8 25 00 00 00       	mov    $0x25,%eax
+ 60b:	cd 40                	int    $0x40
+ 60d:	c3                   	ret
+
+0000060e <set_affinity>:
+SYSCALL(set_affinity)
+ 60e:	b8 26 00 00 00       	mov    $0x26,%eax
+ 613:	cd 40                	int    $0x40
+ 615:	c3                   	ret
+
+00000616 <setsched>:
+SYSCALL(setsched)
+ 616:	b8 27 00 00 00       	mov    $0x27,%eax
+ 61b:	cd 40                	int    $0x40
+ 61d:	c3                   	ret
+
+0000061e <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 61e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 623:	cd 40                	int    $0x40
+ 625:	c3                   	ret
+
+00000626 <set_quantum>:
+SYSCALL(set_quantum)
+ 626:	b8 29 00 00 00       	mov    $0x29,%eax
+ 62b:	cd 40                	int    $0x40
+ 62d:	c3                   	ret
+
+0000062e <schedtrace>:
+SYSCALL(schedtrace)
+ 62e:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 633:	cd 40                	int    $0x40
+ 635:	c3                   	ret
+
+00000636 <getrusage>:
+SYSCALL(getrusage)
+ 636:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 63b:	cd 40                	int    $0x40
+ 63d:	c3                   	ret
+
+0000063e <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 63e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 643:	cd 40                	int    $0x40
+ 645:	c3                   	ret
+
+00000646 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 646:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 64b:	cd 40                	int    $0x40
+ 64d:	c3                   	ret
+
+0000064e <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 64e:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 653:	cd 40                	int    $0x40
+ 655:	c3                   	ret
+
+00000656 <futex_wait>:
+SYSCALL(futex_wait)
+ 656:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 65b:	cd 40                	int    $0x40
+ 65d:	c3                   	ret
+
+0000065e <futex_wake>:
+SYSCALL(futex_wake)
+ 65e:	b8 30 00 00 00       	mov    $0x30,%eax
+ 663:	cd 40                	int    $0x40
+ 665:	c3                   	ret
+
+00000666 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 666:	b8 31 00 00 00       	mov    $0x31,%eax
+ 66b:	cd 40                	int    $0x40
+ 66d:	c3                   	ret
+
+0000066e <submit_batch>:
+SYSCALL(submit_batch)
+ 66e:	b8 32 00 00 00       	mov    $0x32,%eax
+ 673:	cd 40                	int    $0x40
+ 675:	c3                   	ret
+
+00000676 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 676:	b8 33 00 00 00       	mov    $0x33,%eax
+ 67b:	cd 40                	int    $0x40
+ 67d:	c3                   	ret
+
+0000067e <kmem_junk>:
+SYSCALL(kmem_junk)
+ 67e:	b8 34 00 00 00       	mov    $0x34,%eax
+ 683:	cd 40                	int    $0x40
+ 685:	c3                   	ret
+
+00000686 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 686:	55                   	push   %ebp
+ 687:	89 e5                	mov    %esp,%ebp
+ 689:	83 ec 18             	sub    $0x18,%esp
+ 68c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 68f:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 692:	83 ec 04             	sub    $0x4,%esp
+ 695:	6a 01                	push   $0x1
+ 697:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 69a:	50                   	push   %eax
+ 69b:	ff 75 08             	push   0x8(%ebp)
+ 69e:	e8 6b fe ff ff       	call   50e <write>
+ 6a3:	83 c4 10             	add    $0x10,%esp
+}
+ 6a6:	90                   	nop
+ 6a7:	c9                   	leave
+ 6a8:	c3                   	ret
+
+000006a9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6a9:	55                   	push   %ebp
+ 6aa:	89 e5                	mov    %esp,%ebp
+ 6ac:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 6af:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6b6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6ba:	74 17                	je     6d3 <printint+0x2a>
+ 6bc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6c0:	79 11                	jns    6d3 <printint+0x2a>
+    neg = 1;
+ 6c2:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 6c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6cc:	f7 d8                	neg    %eax
+ 6ce:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6d1:	eb 06                	jmp    6d9 <printint+0x30>
+  } else {
+    x = xx;
+ 6d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6d6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 6d9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6e0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6e3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6e6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6eb:	f7 f1                	div    %ecx
+ 6ed:	89 d1                	mov    %edx,%ecx
+ 6ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6f2:	8d 50 01             	lea    0x1(%eax),%edx
+ 6f5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6f8:	0f b6 91 b4 11 00 00 	movzbl 0x11b4(%ecx),%edx
+ 6ff:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 703:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 706:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 709:	ba 00 00 00 00       	mov    $0x0,%edx
+ 70e:	f7 f1                	div    %ecx
+ 710:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 713:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 717:	75 c7                	jne    6e0 <printint+0x37>
+  if(neg)
+ 719:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 71d:	74 2d                	je     74c <printint+0xa3>
+    buf[i++] = '-';
+ 71f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 722:	8d 50 01             	lea    0x1(%eax),%edx
+ 725:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 728:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 72d:	eb 1d                	jmp    74c <printint+0xa3>
+    putc(fd, buf[i]);
+ 72f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 732:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 735:	01 d0                	add    %edx,%eax
+ 737:	0f b6 00             	movzbl (%eax),%eax
+ 73a:	0f be c0             	movsbl %al,%eax
+ 73d:	83 ec 08             	sub    $0x8,%esp
+ 740:	50                   	push   %eax
+ 741:	ff 75 08             	push   0x8(%ebp)
+ 744:	e8 3d ff ff ff       	call   686 <putc>
+ 749:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 74c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 750:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 754:	79 d9                	jns    72f <printint+0x86>
+}
+ 756:	90                   	nop
+ 757:	90                   	nop
+ 758:	c9                   	leave
+ 759:	c3                   	ret
+
+0000075a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 75a:	55                   	push   %ebp
+ 75b:	89 e5                	mov    %esp,%ebp
+ 75d:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 760:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 767:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 76a:	83 c0 04             	add    $0x4,%eax
+ 76d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 770:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 777:	e9 59 01 00 00       	jmp    8d5 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 77c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 77f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 782:	01 d0                	add    %edx,%eax
+ 784:	0f b6 00             	movzbl (%eax),%eax
+ 787:	0f be c0             	movsbl %al,%eax
+ 78a:	25 ff 00 00 00       	and    $0xff,%eax
+ 78f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 792:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 796:	75 2c                	jne    7c4 <printf+0x6a>
+      if(c == '%'){
+ 798:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 79c:	75 0c                	jne    7aa <printf+0x50>
+        state = '%';
+ 79e:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 7a5:	e9 27 01 00 00       	jmp    8d1 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 7aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7ad:	0f be c0             	movsbl %al,%eax
+ 7b0:	83 ec 08             	sub    $0x8,%esp
+ 7b3:	50                   	push   %eax
+ 7b4:	ff 75 08             	push   0x8(%ebp)
+ 7b7:	e8 ca fe ff ff       	call   686 <putc>
+ 7bc:	83 c4 10             	add    $0x10,%esp
+ 7bf:	e9 0d 01 00 00       	jmp    8d1 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 7c4:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 7c8:	0f 85 03 01 00 00    	jne    8d1 <printf+0x177>
+      if(c == 'd'){
+ 7ce:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 7d2:	75 1e                	jne    7f2 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 7d4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7d7:	8b 00                	mov    (%eax),%eax
+ 7d9:	6a 01                	push   $0x1
+ 7db:	6a 0a                	push   $0xa
+ 7dd:	50                   	push   %eax
+ 7de:	ff 75 08             	push   0x8(%ebp)
+ 7e1:	e8 c3 fe ff ff       	call   6a9 <printint>
+ 7e6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7e9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7ed:	e9 d8 00 00 00       	jmp    8ca <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 7f2:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 7f6:	74 06                	je     7fe <printf+0xa4>
+ 7f8:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7fc:	75 1e                	jne    81c <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 7fe:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 801:	8b 00                	mov    (%eax),%eax
+ 803:	6a 00                	push   $0x0
+ 805:	6a 10                	push   $0x10
+ 807:	50                   	push   %eax
+ 808:	ff 75 08             	push   0x8(%ebp)
+ 80b:	e8 99 fe ff ff       	call   6a9 <printint>
+ 810:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 813:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 817:	e9 ae 00 00 00       	jmp    8ca <printf+0x170>
+      } else if(c == 's'){
+ 81c:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 820:	75 43                	jne    865 <printf+0x10b>
+        s = (char*)*ap;
+ 822:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 825:	8b 00                	mov    (%eax),%eax
+ 827:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 82a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 82e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 832:	75 25                	jne    859 <printf+0xff>
+          s = "(null)";
+ 834:	c7 45 f4 9b 0d 00 00 	movl   $0xd9b,-0xc(%ebp)
+        while(*s != 0){
+ 83b:	eb 1c                	jmp    859 <printf+0xff>
+          putc(fd, *s);
+ 83d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 840:	0f b6 00             	movzbl (%eax),%eax
+ 843:	0f be c0             	movsbl %al,%eax
+ 846:	83 ec 08             	sub    $0x8,%esp
+ 849:	50                   	push   %eax
+ 84a:	ff 75 08             	push   0x8(%ebp)
+ 84d:	e8 34 fe ff ff       	call   686 <putc>
+ 852:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 855:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 859:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 85c:	0f b6 00             	movzbl (%eax),%eax
+ 85f:	84 c0                	test   %al,%al
+ 861:	75 da                	jne    83d <printf+0xe3>
+ 863:	eb 65                	jmp    8ca <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 865:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 869:	75 1d                	jne    888 <printf+0x12e>
+        putc(fd, *ap);
+ 86b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 86e:	8b 00                	mov    (%eax),%eax
+ 870:	0f be c0             	movsbl %al,%eax
+ 873:	83 ec 08             	sub    $0x8,%esp
+ 876:	50                   	push   %eax
+ 877:	ff 75 08             	push   0x8(%ebp)
+ 87a:	e8 07 fe ff ff       	call   686 <putc>
+ 87f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 882:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 886:	eb 42                	jmp    8ca <printf+0x170>
+      } else if(c == '%'){
+ 888:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 88c:	75 17                	jne    8a5 <printf+0x14b>
+        putc(fd, c);
+ 88e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 891:	0f be c0             	movsbl %al,%eax
+ 894:	83 ec 08             	sub    $0x8,%esp
+ 897:	50                   	push   %eax
+ 898:	ff 75 08             	push   0x8(%ebp)
+ 89b:	e8 e6 fd ff ff       	call   686 <putc>
+ 8a0:	83 c4 10             	add    $0x10,%esp
+ 8a3:	eb 25                	jmp    8ca <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 8a5:	83 ec 08             	sub    $0x8,%esp
+ 8a8:	6a 25                	push   $0x25
+ 8aa:	ff 75 08             	push   0x8(%ebp)
+ 8ad:	e8 d4 fd ff ff       	call   686 <putc>
+ 8b2:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 8b5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8b8:	0f be c0             	movsbl %al,%eax
+ 8bb:	83 ec 08             	sub    $0x8,%esp
+ 8be:	50                   	push   %eax
+ 8bf:	ff 75 08             	push   0x8(%ebp)
+ 8c2:	e8 bf fd ff ff       	call   686 <putc>
+ 8c7:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 8ca:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8d1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 8d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8db:	01 d0                	add    %edx,%eax
+ 8dd:	0f b6 00             	movzbl (%eax),%eax
+ 8e0:	84 c0                	test   %al,%al
+ 8e2:	0f 85 94 fe ff ff    	jne    77c <printf+0x22>
+    }
+  }
+}
+ 8e8:	90                   	nop
+ 8e9:	90                   	nop
+ 8ea:	c9                   	leave
+ 8eb:	c3                   	ret
+
+000008ec <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8ec:	55                   	push   %ebp
+ 8ed:	89 e5                	mov    %esp,%ebp
+ 8ef:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 8f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8f5:	83 e8 08             	sub    $0x8,%eax
+ 8f8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8fb:	a1 e8 13 00 00       	mov    0x13e8,%eax
+ 900:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 903:	eb 24                	jmp    929 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 905:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 908:	8b 00                	mov    (%eax),%eax
+ 90a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 90d:	72 12                	jb     921 <free+0x35>
+ 90f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 912:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 915:	72 24                	jb     93b <free+0x4f>
+ 917:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 91a:	8b 00                	mov    (%eax),%eax
+ 91c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 91f:	72 1a                	jb     93b <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 921:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 924:	8b 00                	mov    (%eax),%eax
+ 926:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 929:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 92c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 92f:	73 d4                	jae    905 <free+0x19>
+ 931:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 934:	8b 00                	mov    (%eax),%eax
+ 936:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 939:	73 ca                	jae    905 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 93b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 93e:	8b 40 04             	mov    0x4(%eax),%eax
+ 941:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 948:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 94b:	01 c2                	add    %eax,%edx
+ 94d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 950:	8b 00                	mov    (%eax),%eax
+ 952:	39 c2                	cmp    %eax,%edx
+ 954:	75 24                	jne    97a <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 956:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 959:	8b 50 04             	mov    0x4(%eax),%edx
+ 95c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 95f:	8b 00                	mov    (%eax),%eax
+ 961:	8b 40 04             	mov    0x4(%eax),%eax
+ 964:	01 c2                	add    %eax,%edx
+ 966:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 969:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 96c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 96f:	8b 00                	mov    (%eax),%eax
+ 971:	8b 10                	mov    (%eax),%edx
+ 973:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 976:	89 10                	mov    %edx,(%eax)
+ 978:	eb 0a                	jmp    984 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 97a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 97d:	8b 10                	mov    (%eax),%edx
+ 97f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 982:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 984:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 987:	8b 40 04             	mov    0x4(%eax),%eax
+ 98a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 991:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 994:	01 d0                	add    %edx,%eax
+ 996:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 999:	75 20                	jne    9bb <free+0xcf>
+    p->s.size += bp->s.size;
+ 99b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 99e:	8b 50 04             	mov    0x4(%eax),%edx
+ 9a1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9a4:	8b 40 04             	mov    0x4(%eax),%eax
+ 9a7:	01 c2                	add    %eax,%edx
+ 9a9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ac:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 9af:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b2:	8b 10                	mov    (%eax),%edx
+ 9b4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b7:	89 10                	mov    %edx,(%eax)
+ 9b9:	eb 08                	jmp    9c3 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 9bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9be:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 9c1:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 9c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9c6:	a3 e8 13 00 00       	mov    %eax,0x13e8
+}
+ 9cb:	90                   	nop
+ 9cc:	c9                   	leave
+ 9cd:	c3                   	ret
+
+000009ce <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 9ce:	55                   	push   %ebp
+ 9cf:	89 e5                	mov    %esp,%ebp
+ 9d1:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 9d4:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 9db:	77 07                	ja     9e4 <morecore+0x16>
+    nu = 4096;
+ 9dd:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 9e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9e7:	c1 e0 03             	shl    $0x3,%eax
+ 9ea:	83 ec 0c             	sub    $0xc,%esp
+ 9ed:	50                   	push   %eax
+ 9ee:	e8 83 fb ff ff       	call   576 <sbrk>
+ 9f3:	83 c4 10             	add    $0x10,%esp
+ 9f6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 9f9:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 9fd:	75 07                	jne    a06 <morecore+0x38>
+    return 0;
+ 9ff:	b8 00 00 00 00       	mov    $0x0,%eax
+ a04:	eb 26                	jmp    a2c <morecore+0x5e>
+  hp = (Header*)p;
+ a06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a09:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ a0c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a0f:	8b 55 08             	mov    0x8(%ebp),%edx
+ a12:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ a15:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a18:	83 c0 08             	add    $0x8,%eax
+ a1b:	83 ec 0c             	sub    $0xc,%esp
+ a1e:	50                   	push   %eax
+ a1f:	e8 c8 fe ff ff       	call   8ec <free>
+ a24:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ a27:	a1 e8 13 00 00       	mov    0x13e8,%eax
+}
+ a2c:	c9                   	leave
+ a2d:	c3                   	ret
+
+00000a2e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a2e:	55                   	push   %ebp
+ a2f:	89 e5                	mov    %esp,%ebp
+ a31:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a34:	8b 45 08             	mov    0x8(%ebp),%eax
+ a37:	83 c0 07             	add    $0x7,%eax
+ a3a:	c1 e8 03             	shr    $0x3,%eax
+ a3d:	83 c0 01             	add    $0x1,%eax
+ a40:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ a43:	a1 e8 13 00 00       	mov    0x13e8,%eax
+ a48:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a4b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a4f:	75 23                	jne    a74 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ a51:	c7 45 f0 e0 13 00 00 	movl   $0x13e0,-0x10(%ebp)
+ a58:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a5b:	a3 e8 13 00 00       	mov    %eax,0x13e8
+ a60:	a1 e8 13 00 00       	mov    0x13e8,%eax
+ a65:	a3 e0 13 00 00       	mov    %eax,0x13e0
+    base.s.size = 0;
+ a6a:	c7 05 e4 13 00 00 00 	movl   $0x0,0x13e4
+ a71:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a74:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a77:	8b 00                	mov    (%eax),%eax
+ a79:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a7f:	8b 40 04             	mov    0x4(%eax),%eax
+ a82:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a85:	72 4d                	jb     ad4 <malloc+0xa6>
+      if(p->s.size == nunits)
+ a87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a8a:	8b 40 04             	mov    0x4(%eax),%eax
+ a8d:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a90:	75 0c                	jne    a9e <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a95:	8b 10                	mov    (%eax),%edx
+ a97:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a9a:	89 10                	mov    %edx,(%eax)
+ a9c:	eb 26                	jmp    ac4 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aa1:	8b 40 04             	mov    0x4(%eax),%eax
+ aa4:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ aa7:	89 c2                	mov    %eax,%edx
+ aa9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aac:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ aaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab2:	8b 40 04             	mov    0x4(%eax),%eax
+ ab5:	c1 e0 03             	shl    $0x3,%eax
+ ab8:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ abb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ abe:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ ac1:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ ac4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ac7:	a3 e8 13 00 00       	mov    %eax,0x13e8
+      return (void*)(p + 1);
+ acc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ acf:	83 c0 08             	add    $0x8,%eax
+ ad2:	eb 3b                	jmp    b0f <malloc+0xe1>
+    }
+    if(p == freep)
+ ad4:	a1 e8 13 00 00       	mov    0x13e8,%eax
+ ad9:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ adc:	75 1e                	jne    afc <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ ade:	83 ec 0c             	sub    $0xc,%esp
+ ae1:	ff 75 ec             	push   -0x14(%ebp)
+ ae4:	e8 e5 fe ff ff       	call   9ce <morecore>
+ ae9:	83 c4 10             	add    $0x10,%esp
+ aec:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ aef:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ af3:	75 07                	jne    afc <malloc+0xce>
+        return 0;
+ af5:	b8 00 00 00 00       	mov    $0x0,%eax
+ afa:	eb 13                	jmp    b0f <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ afc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aff:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b05:	8b 00                	mov    (%eax),%eax
+ b07:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b0a:	e9 6d ff ff ff       	jmp    a7c <malloc+0x4e>
+  }
+}
+ b0f:	c9                   	leave
+ b10:	c3                   	ret
+
+00000b11 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ b11:	55                   	push   %ebp
+ b12:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ b14:	8b 45 08             	mov    0x8(%ebp),%eax
+ b17:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b1d:	90                   	nop
+ b1e:	5d                   	pop    %ebp
+ b1f:	c3                   	ret
+
+00000b20 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ b20:	55                   	push   %ebp
+ b21:	89 e5                	mov    %esp,%ebp
+ b23:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ b26:	8b 55 08             	mov    0x8(%ebp),%edx
+ b29:	b8 00 00 00 00       	mov    $0x0,%eax
+ b2e:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b33:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ b37:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b3a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b3e:	74 3b                	je     b7b <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ b40:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ b44:	74 2d                	je     b73 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ b46:	8b 55 08             	mov    0x8(%ebp),%edx
+ b49:	b8 02 00 00 00       	mov    $0x2,%eax
+ b4e:	87 02                	xchg   %eax,(%edx)
+ b50:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b53:	eb 1e                	jmp    b73 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ b55:	8b 45 08             	mov    0x8(%ebp),%eax
+ b58:	83 ec 08             	sub    $0x8,%esp
+ b5b:	6a 02                	push   $0x2
+ b5d:	50                   	push   %eax
+ b5e:	e8 f3 fa ff ff       	call   656 <futex_wait>
+ b63:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ b66:	8b 55 08             	mov    0x8(%ebp),%edx
+ b69:	b8 02 00 00 00       	mov    $0x2,%eax
+ b6e:	87 02                	xchg   %eax,(%edx)
+ b70:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b73:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b77:	75 dc                	jne    b55 <mutex_lock+0x35>
+ b79:	eb 01                	jmp    b7c <mutex_lock+0x5c>
+    return;
+ b7b:	90                   	nop
+  }
+}
+ b7c:	c9                   	leave
+ b7d:	c3                   	ret
+
+00000b7e <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ b7e:	55                   	push   %ebp
+ b7f:	89 e5                	mov    %esp,%ebp
+ b81:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ b84:	8b 45 08             	mov    0x8(%ebp),%eax
+ b87:	ba 01 00 00 00       	mov    $0x1,%edx
+ b8c:	f7 da                	neg    %edx
+ b8e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ b92:	83 fa 01             	cmp    $0x1,%edx
+ b95:	74 1a                	je     bb1 <mutex_unlock+0x33>
+    m->state = 0;
+ b97:	8b 45 08             	mov    0x8(%ebp),%eax
+ b9a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ ba0:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba3:	83 ec 08             	sub    $0x8,%esp
+ ba6:	6a 01                	push   $0x1
+ ba8:	50                   	push   %eax
+ ba9:	e8 b0 fa ff ff       	call   65e <futex_wake>
+ bae:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ bb1:	90                   	nop
+ bb2:	c9                   	leave
+ bb3:	c3                   	ret
+
+00000bb4 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ bb4:	55                   	push   %ebp
+ bb5:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ bb7:	8b 45 08             	mov    0x8(%ebp),%eax
+ bba:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ bc0:	8b 45 08             	mov    0x8(%ebp),%eax
+ bc3:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ bca:	90                   	nop
+ bcb:	5d                   	pop    %ebp
+ bcc:	c3                   	ret
+
+00000bcd <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ bcd:	55                   	push   %ebp
+ bce:	89 e5                	mov    %esp,%ebp
+ bd0:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+ bd6:	83 c0 04             	add    $0x4,%eax
+ bd9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ bdd:	8b 45 08             	mov    0x8(%ebp),%eax
+ be0:	83 ec 08             	sub    $0x8,%esp
+ be3:	ff 75 0c             	push   0xc(%ebp)
+ be6:	50                   	push   %eax
+ be7:	e8 6a fa ff ff       	call   656 <futex_wait>
+ bec:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ bef:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf2:	83 c0 04             	add    $0x4,%eax
+ bf5:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ bf9:	90                   	nop
+ bfa:	c9                   	leave
+ bfb:	c3                   	ret
+
+00000bfc <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ bfc:	55                   	push   %ebp
+ bfd:	89 e5                	mov    %esp,%ebp
+ bff:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ c02:	8b 45 08             	mov    0x8(%ebp),%eax
+ c05:	8b 00                	mov    (%eax),%eax
+ c07:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ c0a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c0e:	78 17                	js     c27 <rwlock_rdlock+0x2b>
+ c10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c13:	83 c0 01             	add    $0x1,%eax
+ c16:	89 c1                	mov    %eax,%ecx
+ c18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c1b:	8b 55 08             	mov    0x8(%ebp),%edx
+ c1e:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c22:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c25:	74 19                	je     c40 <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ c27:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c2b:	79 d5                	jns    c02 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ c2d:	83 ec 08             	sub    $0x8,%esp
+ c30:	ff 75 f4             	push   -0xc(%ebp)
+ c33:	ff 75 08             	push   0x8(%ebp)
+ c36:	e8 92 ff ff ff       	call   bcd <rwlock_sleep>
+ c3b:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ c3e:	eb c2                	jmp    c02 <rwlock_rdlock+0x6>
+      return;
+ c40:	90                   	nop
+  }
+}
+ c41:	c9                   	leave
+ c42:	c3                   	ret
+
+00000c43 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ c43:	55                   	push   %ebp
+ c44:	89 e5                	mov    %esp,%ebp
+ c46:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ c49:	eb 11                	jmp    c5c <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ c4b:	83 ec 08             	sub    $0x8,%esp
+ c4e:	ff 75 f4             	push   -0xc(%ebp)
+ c51:	ff 75 08             	push   0x8(%ebp)
+ c54:	e8 74 ff ff ff       	call   bcd <rwlock_sleep>
+ c59:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ c5c:	8b 55 08             	mov    0x8(%ebp),%edx
+ c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+ c64:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ c69:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ c6d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c70:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c74:	75 d5                	jne    c4b <rwlock_wrlock+0x8>
+}
+ c76:	90                   	nop
+ c77:	90                   	nop
+ c78:	c9                   	leave
+ c79:	c3                   	ret
+
+00000c7a <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ c7a:	55                   	push   %ebp
+ c7b:	89 e5                	mov    %esp,%ebp
+ c7d:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ c80:	8b 45 08             	mov    0x8(%ebp),%eax
+ c83:	8b 00                	mov    (%eax),%eax
+ c85:	85 c0                	test   %eax,%eax
+ c87:	79 0c                	jns    c95 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ c89:	8b 45 08             	mov    0x8(%ebp),%eax
+ c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+ c91:	87 10                	xchg   %edx,(%eax)
+ c93:	eb 18                	jmp    cad <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ c95:	8b 55 08             	mov    0x8(%ebp),%edx
+ c98:	b8 01 00 00 00       	mov    $0x1,%eax
+ c9d:	f7 d8                	neg    %eax
+ c9f:	89 c1                	mov    %eax,%ecx
+ ca1:	89 c8                	mov    %ecx,%eax
+ ca3:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ ca7:	01 c8                	add    %ecx,%eax
+ ca9:	85 c0                	test   %eax,%eax
+ cab:	75 20                	jne    ccd <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ cad:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb0:	8b 40 04             	mov    0x4(%eax),%eax
+ cb3:	85 c0                	test   %eax,%eax
+ cb5:	74 17                	je     cce <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ cb7:	8b 45 08             	mov    0x8(%ebp),%eax
+ cba:	83 ec 08             	sub    $0x8,%esp
+ cbd:	68 ff ff ff 7f       	push   $0x7fffffff
+ cc2:	50                   	push   %eax
+ cc3:	e8 96 f9 ff ff       	call   65e <futex_wake>
+ cc8:	83 c4 10             	add    $0x10,%esp
+ ccb:	eb 01                	jmp    cce <rwlock_unlock+0x54>
+    return;
+ ccd:	90                   	nop
+}
+ cce:	c9                   	leave
+ ccf:	c3                   	ret
+
+00000cd0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ cd0:	55                   	push   %ebp
+ cd1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ cd3:	8b 45 08             	mov    0x8(%ebp),%eax
+ cd6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ cdc:	90                   	nop
+ cdd:	5d                   	pop    %ebp
+ cde:	c3                   	ret
+
+00000cdf <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ cdf:	55                   	push   %ebp
+ ce0:	89 e5                	mov    %esp,%ebp
+ ce2:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ ce5:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce8:	8b 00                	mov    (%eax),%eax
+ cea:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ ced:	83 ec 0c             	sub    $0xc,%esp
+ cf0:	ff 75 0c             	push   0xc(%ebp)
+ cf3:	e8 86 fe ff ff       	call   b7e <mutex_unlock>
+ cf8:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ cfb:	8b 45 08             	mov    0x8(%ebp),%eax
+ cfe:	83 ec 08             	sub    $0x8,%esp
+ d01:	ff 75 f4             	push   -0xc(%ebp)
+ d04:	50                   	push   %eax
+ d05:	e8 4c f9 ff ff       	call   656 <futex_wait>
+ d0a:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ d0d:	83 ec 0c             	sub    $0xc,%esp
+ d10:	ff 75 0c             	push   0xc(%ebp)
+ d13:	e8 08 fe ff ff       	call   b20 <mutex_lock>
+ d18:	83 c4 10             	add    $0x10,%esp
+}
+ d1b:	90                   	nop
+ d1c:	c9                   	leave
+ d1d:	c3                   	ret
+
+00000d1e <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ d1e:	55                   	push   %ebp
+ d1f:	89 e5                	mov    %esp,%ebp
+ d21:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ d24:	8b 45 08             	mov    0x8(%ebp),%eax
+ d27:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ d2b:	8b 45 08             	mov    0x8(%ebp),%eax
+ d2e:	83 ec 08             	sub    $0x8,%esp
+ d31:	6a 01                	push   $0x1
+ d33:	50                   	push   %eax
+ d34:	e8 25 f9 ff ff       	call   65e <futex_wake>
+ d39:	83 c4 10             	add    $0x10,%esp
+}
+ d3c:	90                   	nop
+ d3d:	c9                   	leave
+ d3e:	c3                   	ret
+
+00000d3f <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ d3f:	55                   	push   %ebp
+ d40:	89 e5                	mov    %esp,%ebp
+ d42:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ d45:	8b 45 08             	mov    0x8(%ebp),%eax
+ d48:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ d4c:	8b 45 08             	mov    0x8(%ebp),%eax
+ d4f:	83 ec 08             	sub    $0x8,%esp
+ d52:	68 ff ff ff 7f       	push   $0x7fffffff
+ d57:	50                   	push   %eax
+ d58:	e8 01 f9 ff ff       	call   65e <futex_wake>
+ d5d:	83 c4 10             	add    $0x10,%esp
+}
+ d60:	90                   	nop
+ d61:	c9                   	leave
+ d62:	c3                   	ret
@@ -0,0 +1,1728 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 3f 03 00 00       	call   355 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 c9 03 00 00       	call   3ed <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 31 03 00 00       	call   35d <exit>
+
+0000002c <stosb>:
+  stosb(dst, c, n);
+  return dst;
+}
+
+char*
+strchr(const char *s, char c)
+  2c:	55                   	push   %ebp
+  2d:	89 e5                	mov    %esp,%ebp
+  2f:	57                   	push   %edi
+  30:	53                   	push   %ebx
+{
+  31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  34:	8b 55 10             	mov    0x10(%ebp),%edx
+  37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  3a:	89 cb                	mov    %ecx,%ebx
+  3c:	89 df                	mov    %ebx,%edi
+  3e:	89 d1                	mov    %edx,%ecx
+  40:	fc                   	cld
+  41:	f3 aa                	rep stos %al,%es:(%edi)
+  43:	89 ca                	mov    %ecx,%edx
+  45:	89 fb                	mov    %edi,%ebx
+  47:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  4a:	89 55 10             	mov    %edx,0x10(%ebp)
+  for(; *s; s++)
+    if(*s == c)
+      return (char*)s;
+  return 0;
+  4d:	90                   	nop
+  4e:	5b                   	pop    %ebx
+  4f:	5f                   	pop    %edi
+  50:	5d                   	pop    %ebp
+  51:	c3                   	ret
+
+00000052 <strcpy>:
+{
+  52:	55                   	push   %ebp
+  53:	89 e5                	mov    %esp,%ebp
+  55:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  58:	8b 45 08             	mov    0x8(%ebp),%eax
+  5b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  5e:	90                   	nop
+  5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  62:	8d 42 01             	lea    0x1(%edx),%eax
+  65:	89 45 0c             	mov    %eax,0xc(%ebp)
+  68:	8b 45 08             	mov    0x8(%ebp),%eax
+  6b:	8d 48 01             	lea    0x1(%eax),%ecx
+  6e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  71:	0f b6 12             	movzbl (%edx),%edx
+  74:	88 10                	mov    %dl,(%eax)
+  76:	0f b6 00             	movzbl (%eax),%eax
+  79:	84 c0                	test   %al,%al
+  7b:	75 e2                	jne    5f <strcpy+0xd>
+  return os;
+  7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  80:	c9                   	leave
+  81:	c3                   	ret
+
+00000082 <strcmp>:
+{
+  82:	55                   	push   %ebp
+  83:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  85:	eb 08                	jmp    8f <strcmp+0xd>
+    p++, q++;
+  87:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  8b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  92:	0f b6 00             	movzbl (%eax),%eax
+  95:	84 c0                	test   %al,%al
+  97:	74 10                	je     a9 <strcmp+0x27>
+  99:	8b 45 08             	mov    0x8(%ebp),%eax
+  9c:	0f b6 10             	movzbl (%eax),%edx
+  9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a2:	0f b6 00             	movzbl (%eax),%eax
+  a5:	38 c2                	cmp    %al,%dl
+  a7:	74 de                	je     87 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  ac:	0f b6 00             	movzbl (%eax),%eax
+  af:	0f b6 d0             	movzbl %al,%edx
+  b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b5:	0f b6 00             	movzbl (%eax),%eax
+  b8:	0f b6 c0             	movzbl %al,%eax
+  bb:	29 c2                	sub    %eax,%edx
+  bd:	89 d0                	mov    %edx,%eax
+}
+  bf:	5d                   	pop    %ebp
+  c0:	c3                   	ret
+
+000000c1 <strlen>:
+{
+  c1:	55                   	push   %ebp
+  c2:	89 e5                	mov    %esp,%ebp
+  c4:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+  c7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  ce:	eb 04                	jmp    d4 <strlen+0x13>
+  d0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  d4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  da:	01 d0                	add    %edx,%eax
+  dc:	0f b6 00             	movzbl (%eax),%eax
+  df:	84 c0                	test   %al,%al
+  e1:	75 ed                	jne    d0 <strlen+0xf>
+  return n;
+  e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e6:	c9                   	leave
+  e7:	c3                   	ret
+
+000000e8 <memset>:
+{
+  e8:	55                   	push   %ebp
+  e9:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+  eb:	8b 45 10             	mov    0x10(%ebp),%eax
+  ee:	50                   	push   %eax
+  ef:	ff 75 0c             	push   0xc(%ebp)
+  f2:	ff 75 08             	push   0x8(%ebp)
+  f5:	e8 32 ff ff ff       	call   2c <stosb>
+  fa:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 100:	c9                   	leave
+ 101:	c3                   	ret
+
+00000102 <strchr>:
+{
+ 102:	55                   	push   %ebp
+ 103:	89 e5                	mov    %esp,%ebp
+ 105:	83 ec 04             	sub    $0x4,%esp
+ 108:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10b:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 10e:	eb 14                	jmp    124 <strchr+0x22>
+    if(*s == c)
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	0f b6 00             	movzbl (%eax),%eax
+ 116:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 119:	75 05                	jne    120 <strchr+0x1e>
+      return (char*)s;
+ 11b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11e:	eb 13                	jmp    133 <strchr+0x31>
+  for(; *s; s++)
+ 120:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 124:	8b 45 08             	mov    0x8(%ebp),%eax
+ 127:	0f b6 00             	movzbl (%eax),%eax
+ 12a:	84 c0                	test   %al,%al
+ 12c:	75 e2                	jne    110 <strchr+0xe>
+  return 0;
+ 12e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+
+00000135 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 13b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 142:	eb 42                	jmp    186 <gets+0x51>
+    cc = read(0, &c, 1);
+ 144:	83 ec 04             	sub    $0x4,%esp
+ 147:	6a 01                	push   $0x1
+ 149:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 14c:	50                   	push   %eax
+ 14d:	6a 00                	push   $0x0
+ 14f:	e8 21 02 00 00       	call   375 <read>
+ 154:	83 c4 10             	add    $0x10,%esp
+ 157:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 15a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 15e:	7e 33                	jle    193 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 160:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 163:	8d 50 01             	lea    0x1(%eax),%edx
+ 166:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 169:	89 c2                	mov    %eax,%edx
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	01 c2                	add    %eax,%edx
+ 170:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 174:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 176:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 17a:	3c 0a                	cmp    $0xa,%al
+ 17c:	74 16                	je     194 <gets+0x5f>
+ 17e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 182:	3c 0d                	cmp    $0xd,%al
+ 184:	74 0e                	je     194 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 186:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 189:	83 c0 01             	add    $0x1,%eax
+ 18c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 18f:	7f b3                	jg     144 <gets+0xf>
+ 191:	eb 01                	jmp    194 <gets+0x5f>
+      break;
+ 193:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 194:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 197:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19a:	01 d0                	add    %edx,%eax
+ 19c:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 19f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1a2:	c9                   	leave
+ 1a3:	c3                   	ret
+
+000001a4 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1a4:	55                   	push   %ebp
+ 1a5:	89 e5                	mov    %esp,%ebp
+ 1a7:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1aa:	83 ec 08             	sub    $0x8,%esp
+ 1ad:	6a 00                	push   $0x0
+ 1af:	ff 75 08             	push   0x8(%ebp)
+ 1b2:	e8 e6 01 00 00       	call   39d <open>
+ 1b7:	83 c4 10             	add    $0x10,%esp
+ 1ba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1c1:	79 07                	jns    1ca <stat+0x26>
+    return -1;
+ 1c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1c8:	eb 25                	jmp    1ef <stat+0x4b>
+  r = fstat(fd, st);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	ff 75 0c             	push   0xc(%ebp)
+ 1d0:	ff 75 f4             	push   -0xc(%ebp)
+ 1d3:	e8 dd 01 00 00       	call   3b5 <fstat>
+ 1d8:	83 c4 10             	add    $0x10,%esp
+ 1db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 1de:	83 ec 0c             	sub    $0xc,%esp
+ 1e1:	ff 75 f4             	push   -0xc(%ebp)
+ 1e4:	e8 9c 01 00 00       	call   385 <close>
+ 1e9:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 1ec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1ef:	c9                   	leave
+ 1f0:	c3                   	ret
+
+000001f1 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 1f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 1fe:	eb 25                	jmp    225 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 200:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 203:	89 d0                	mov    %edx,%eax
+ 205:	c1 e0 02             	shl    $0x2,%eax
+ 208:	01 d0                	add    %edx,%eax
+ 20a:	01 c0                	add    %eax,%eax
+ 20c:	89 c1                	mov    %eax,%ecx
+ 20e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 211:	8d 50 01             	lea    0x1(%eax),%edx
+ 214:	89 55 08             	mov    %edx,0x8(%ebp)
+ 217:	0f b6 00             	movzbl (%eax),%eax
+ 21a:	0f be c0             	movsbl %al,%eax
+ 21d:	01 c8                	add    %ecx,%eax
+ 21f:	83 e8 30             	sub    $0x30,%eax
+ 222:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 225:	8b 45 08             	mov    0x8(%ebp),%eax
+ 228:	0f b6 00             	movzbl (%eax),%eax
+ 22b:	3c 2f                	cmp    $0x2f,%al
+ 22d:	7e 0a                	jle    239 <atoi+0x48>
+ 22f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 232:	0f b6 00             	movzbl (%eax),%eax
+ 235:	3c 39                	cmp    $0x39,%al
+ 237:	7e c7                	jle    200 <atoi+0xf>
+  return n;
+ 239:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 23c:	c9                   	leave
+ 23d:	c3                   	ret
+
+0000023e <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 23e:	55                   	push   %ebp
+ 23f:	89 e5                	mov    %esp,%ebp
+ 241:	83 ec 10             	sub    $0x10,%esp
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 244:	8b 45 08             	mov    0x8(%ebp),%eax
+ 247:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 250:	eb 17                	jmp    269 <memmove+0x2b>
+    *dst++ = *src++;
+ 252:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 255:	8d 42 01             	lea    0x1(%edx),%eax
+ 258:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 25b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 25e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 261:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 264:	0f b6 12             	movzbl (%edx),%edx
+ 267:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 269:	8b 45 10             	mov    0x10(%ebp),%eax
+ 26c:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 26f:	89 55 10             	mov    %edx,0x10(%ebp)
+ 272:	85 c0                	test   %eax,%eax
+ 274:	7f dc                	jg     252 <memmove+0x14>
+  return vdst;
+ 276:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 279:	c9                   	leave
+ 27a:	c3                   	ret
+
+0000027b <udiv64>:
+
+// n / d for a 64-bit n. There is no libgcc to do 64-bit
+// division, so it is done a bit at a time.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 27b:	55                   	push   %ebp
+ 27c:	89 e5                	mov    %esp,%ebp
+ 27e:	57                   	push   %edi
+ 27f:	56                   	push   %esi
+ 280:	83 ec 30             	sub    $0x30,%esp
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 289:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+ 28f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 296:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 29d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2a0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 2a3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 2a6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 2a9:	c7 45 e4 3f 00 00 00 	movl   $0x3f,-0x1c(%ebp)
+ 2b0:	e9 89 00 00 00       	jmp    33e <udiv64+0xc3>
+    r = (r << 1) | ((n >> i) & 1);
+ 2b5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2b8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 2bb:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+ 2bf:	01 c0                	add    %eax,%eax
+ 2c1:	89 c6                	mov    %eax,%esi
+ 2c3:	89 d7                	mov    %edx,%edi
+ 2c5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 2c8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 2cb:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 2ce:	0f ad d0             	shrd   %cl,%edx,%eax
+ 2d1:	d3 ea                	shr    %cl,%edx
+ 2d3:	f6 c1 20             	test   $0x20,%cl
+ 2d6:	74 04                	je     2dc <udiv64+0x61>
+ 2d8:	89 d0                	mov    %edx,%eax
+ 2da:	31 d2                	xor    %edx,%edx
+ 2dc:	83 e0 01             	and    $0x1,%eax
+ 2df:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 2e2:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+ 2e9:	89 f0                	mov    %esi,%eax
+ 2eb:	89 fa                	mov    %edi,%edx
+ 2ed:	0b 45 c8             	or     -0x38(%ebp),%eax
+ 2f0:	0b 55 cc             	or     -0x34(%ebp),%edx
+ 2f3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 2f6:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(r >= d){
+ 2f9:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2fc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 301:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 304:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 307:	19 d1                	sbb    %edx,%ecx
+ 309:	72 2f                	jb     33a <udiv64+0xbf>
+      r -= d;
+ 30b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 30e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 313:	29 45 e8             	sub    %eax,-0x18(%ebp)
+ 316:	19 55 ec             	sbb    %edx,-0x14(%ebp)
+      q |= (uint64)1 << i;
+ 319:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 31c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 321:	ba 00 00 00 00       	mov    $0x0,%edx
+ 326:	0f a5 c2             	shld   %cl,%eax,%edx
+ 329:	d3 e0                	shl    %cl,%eax
+ 32b:	f6 c1 20             	test   $0x20,%cl
+ 32e:	74 04                	je     334 <udiv64+0xb9>
+ 330:	89 c2                	mov    %eax,%edx
+ 332:	31 c0                	xor    %eax,%eax
+ 334:	09 45 f0             	or     %eax,-0x10(%ebp)
+ 337:	09 55 f4             	or     %edx,-0xc(%ebp)
+  for(i = 63; i >= 0; i--){
+ 33a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+ 33e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 342:	0f 89 6d ff ff ff    	jns    2b5 <udiv64+0x3a>
+    }
+  }
+  return q;
+ 348:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 34b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+}
+ 34e:	83 c4 30             	add    $0x30,%esp
+ 351:	5e                   	pop    %esi
+ 352:	5f                   	pop    %edi
+ 353:	5d                   	pop    %ebp
+ 354:	c3                   	ret
+
+00000355 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 355:	b8 01 00 00 00       	mov    $0x1,%eax
+ 35a:	cd 40                	int    $0x40
+ 35c:	c3                   	ret
+
+0000035d <exit>:
+SYSCALL(exit)
+ 35d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 362:	cd 40                	int    $0x40
+ 364:	c3                   	ret
+
+00000365 <wait>:
+SYSCALL(wait)
+ 365:	b8 03 00 00 00       	mov    $0x3,%eax
+ 36a:	cd 40                	int    $0x40
+ 36c:	c3                   	ret
+
+0000036d <pipe>:
+SYSCALL(pipe)
+ 36d:	b8 04 00 00 00       	mov    $0x4,%eax
+ 372:	cd 40                	int    $0x40
+ 374:	c3                   	ret
+
+00000375 <read>:
+SYSCALL(read)
+ 375:	b8 05 00 00 00       	mov    $0x5,%eax
+ 37a:	cd 40                	int    $0x40
+ 37c:	c3                   	ret
+
+0000037d <write>:
+SYSCALL(write)
+ 37d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 382:	cd 40                	int    $0x40
+ 384:	c3                   	ret
+
+00000385 <close>:
+SYSCALL(close)
+ 385:	b8 15 00 00 00       	mov    $0x15,%eax
+ 38a:	cd 40                	int    $0x40
+ 38c:	c3                   	ret
+
+0000038d <kill>:
+SYSCALL(kill)
+ 38d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 392:	cd 40                	int    $0x40
+ 394:	c3                   	ret
+
+00000395 <exec>:
+SYSCALL(exec)
+ 395:	b8 07 00 00 00       	mov    $0x7,%eax
+ 39a:	cd 40                	int    $0x40
+ 39c:	c3                   	ret
+
+0000039d <open>:
+SYSCALL(open)
+ 39d:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3a2:	cd 40                	int    $0x40
+ 3a4:	c3                   	ret
+
+000003a5 <mknod>:
+SYSCALL(mknod)
+ 3a5:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3aa:	cd 40                	int    $0x40
+ 3ac:	c3                   	ret
+
+000003ad <unlink>:
+SYSCALL(unlink)
+ 3ad:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3b2:	cd 40                	int    $0x40
+ 3b4:	c3                   	ret
+
+000003b5 <fstat>:
+SYSCALL(fstat)
+ 3b5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3ba:	cd 40                	int    $0x40
+ 3bc:	c3                   	ret
+
+000003bd <link>:
+SYSCALL(link)
+ 3bd:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3c2:	cd 40                	int    $0x40
+ 3c4:	c3                   	ret
+
+000003c5 <mkdir>:
+SYSCALL(mkdir)
+ 3c5:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3ca:	cd 40                	int    $0x40
+ 3cc:	c3                   	ret
+
+000003cd <chdir>:
+SYSCALL(chdir)
+ 3cd:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3d2:	cd 40                	int    $0x40
+ 3d4:	c3                   	ret
+
+000003d5 <dup>:
+SYSCALL(dup)
+ 3d5:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3da:	cd 40                	int    $0x40
+ 3dc:	c3                   	ret
+
+000003dd <getpid>:
+SYSCALL(getpid)
+ 3dd:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3e2:	cd 40                	int    $0x40
+ 3e4:	c3                   	ret
+
+000003e5 <sbrk>:
+SYSCALL(sbrk)
+ 3e5:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3ea:	cd 40                	int    $0x40
+ 3ec:	c3                   	ret
+
+000003ed <sleep>:
+SYSCALL(sleep)
+ 3ed:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3f2:	cd 40                	int    $0x40
+ 3f4:	c3                   	ret
+
+000003f5 <uptime>:
+SYSCALL(uptime)
+ 3f5:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3fa:	cd 40                	int    $0x40
+ 3fc:	c3                   	ret
+
+000003fd <find_digital_root>:
+SYSCALL(find_digital_root)
+ 3fd:	b8 16 00 00 00       	mov    $0x16,%eax
+ 402:	cd 40                	int    $0x40
+ 404:	c3                   	ret
+
+00000405 <get_uncle_count>:
+SYSCALL(get_uncle_count)
+ 405:	b8 17 00 00 00       	mov    $0x17,%eax
+ 40a:	cd 40                	int    $0x40
+ 40c:	c3                   	ret
+
+0000040d <get_process_lifetime>:
+SYSCALL(get_process_lifetime)
+ 40d:	b8 18 00 00 00       	mov    $0x18,%eax
+ 412:	cd 40                	int    $0x40
+ 414:	c3                   	ret
+
+00000415 <copy_file>:
+SYSCALL(copy_file)
+ 415:	b8 19 00 00 00       	mov    $0x19,%eax
+ 41a:	cd 40                	int    $0x40
+ 41c:	c3                   	ret
+
+0000041d <change_queue>:
+SYSCALL(change_queue)
+ 41d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 422:	cd 40                	int    $0x40
+ 424:	c3                   	ret
+
+00000425 <set_bjf_params_for_process>:
+SYSCALL(set_bjf_params_for_process)
+ 425:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 42a:	cd 40                	int    $0x40
+ 42c:	c3                   	ret
+
+0000042d <set_bjf_params_for_system>:
+SYSCALL(set_bjf_params_for_system)
+ 42d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 432:	cd 40                	int    $0x40
+ 434:	c3                   	ret
+
+00000435 <print_process_info>:
+SYSCALL(print_process_info)
+ 435:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 43a:	cd 40                	int    $0x40
+ 43c:	c3                   	ret
+
+0000043d <set_bjf_priority>:
+SYSCALL(set_bjf_priority)
+ 43d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 442:	cd 40                	int    $0x40
+ 444:	c3                   	ret
+
+00000445 <init_prioritylock>:
+SYSCALL(init_prioritylock)
+ 445:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 44a:	cd 40                	int    $0x40
+ 44c:	c3                   	ret
+
+0000044d <acquire_prioritylock>:
+SYSCALL(acquire_prioritylock)
+ 44d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 452:	cd 40                	int    $0x40
+ 454:	c3                   	ret
+
+00000455 <release_prioritylock>:
+SYSCALL(release_prioritylock)
+ 455:	b8 21 00 00 00       	mov    $0x21,%eax
+ 45a:	cd 40                	int    $0x40
+ 45c:	c3                   	ret
+
+0000045d <print_syscall_count>:
+SYSCALL(print_syscall_count)
+ 45d:	b8 22 00 00 00       	mov    $0x22,%eax
+ 462:	cd 40                	int    $0x40
+ 464:	c3                   	ret
+
+00000465 <reset_syscall_count>:
+SYSCALL(reset_syscall_count)
+ 465:	b8 23 00 00 00       	mov    $0x23,%eax
+ 46a:	cd 40                	int    $0x40
+ 46c:	c3                   	ret
+
+0000046d <open_sharedmem>:
+SYSCALL(open_sharedmem)
+ 46d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 472:	cd 40                	int    $0x40
+ 474:	c3                   	ret
+
+00000475 <close_sharedmem>:
+SYSCALL(close_sharedmem)
+ 475:	b8 25 00 00 00       	mov    $0x25,%eax
+ 47a:	cd 40                	int    $0x40
+ 47c:	c3                   	ret
+
+0000047d <set_affinity>:
+SYSCALL(set_affinity)
+ 47d:	b8 26 00 00 00       	mov    $0x26,%eax
+ 482:	cd 40                	int    $0x40
+ 484:	c3                   	ret
+
+00000485 <setsched>:
+SYSCALL(setsched)
+ 485:	b8 27 00 00 00       	mov    $0x27,%eax
+ 48a:	cd 40                	int    $0x40
+ 48c:	c3                   	ret
+
+0000048d <get_idle_cycles>:
+SYSCALL(get_idle_cycles)
+ 48d:	b8 28 00 00 00       	mov    $0x28,%eax
+ 492:	cd 40                	int    $0x40
+ 494:	c3                   	ret
+
+00000495 <set_quantum>:
+SYSCALL(set_quantum)
+ 495:	b8 29 00 00 00       	mov    $0x29,%eax
+ 49a:	cd 40                	int    $0x40
+ 49c:	c3                   	ret
+
+0000049d <schedtrace>:
+SYSCALL(schedtrace)
+ 49d:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4a2:	cd 40                	int    $0x40
+ 4a4:	c3                   	ret
+
+000004a5 <getrusage>:
+SYSCALL(getrusage)
+ 4a5:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4aa:	cd 40                	int    $0x40
+ 4ac:	c3                   	ret
+
+000004ad <create_prioritylock>:
+SYSCALL(create_prioritylock)
+ 4ad:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4b2:	cd 40                	int    $0x40
+ 4b4:	c3                   	ret
+
+000004b5 <destroy_prioritylock>:
+SYSCALL(destroy_prioritylock)
+ 4b5:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4ba:	cd 40                	int    $0x40
+ 4bc:	c3                   	ret
+
+000004bd <prioritylock_stats>:
+SYSCALL(prioritylock_stats)
+ 4bd:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4c2:	cd 40                	int    $0x40
+ 4c4:	c3                   	ret
+
+000004c5 <futex_wait>:
+SYSCALL(futex_wait)
+ 4c5:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4ca:	cd 40                	int    $0x40
+ 4cc:	c3                   	ret
+
+000004cd <futex_wake>:
+SYSCALL(futex_wake)
+ 4cd:	b8 30 00 00 00       	mov    $0x30,%eax
+ 4d2:	cd 40                	int    $0x40
+ 4d4:	c3                   	ret
+
+000004d5 <syscall_latency>:
+SYSCALL(syscall_latency)
+ 4d5:	b8 31 00 00 00       	mov    $0x31,%eax
+ 4da:	cd 40                	int    $0x40
+ 4dc:	c3                   	ret
+
+000004dd <submit_batch>:
+SYSCALL(submit_batch)
+ 4dd:	b8 32 00 00 00       	mov    $0x32,%eax
+ 4e2:	cd 40                	int    $0x40
+ 4e4:	c3                   	ret
+
+000004e5 <kmem_stats>:
+SYSCALL(kmem_stats)
+ 4e5:	b8 33 00 00 00       	mov    $0x33,%eax
+ 4ea:	cd 40                	int    $0x40
+ 4ec:	c3                   	ret
+
+000004ed <kmem_junk>:
+SYSCALL(kmem_junk)
+ 4ed:	b8 34 00 00 00       	mov    $0x34,%eax
+ 4f2:	cd 40                	int    $0x40
+ 4f4:	c3                   	ret
+
+000004f5 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4f5:	55                   	push   %ebp
+ 4f6:	89 e5                	mov    %esp,%ebp
+ 4f8:	83 ec 18             	sub    $0x18,%esp
+ 4fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4fe:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 501:	83 ec 04             	sub    $0x4,%esp
+ 504:	6a 01                	push   $0x1
+ 506:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 509:	50                   	push   %eax
+ 50a:	ff 75 08             	push   0x8(%ebp)
+ 50d:	e8 6b fe ff ff       	call   37d <write>
+ 512:	83 c4 10             	add    $0x10,%esp
+}
+ 515:	90                   	nop
+ 516:	c9                   	leave
+ 517:	c3                   	ret
+
+00000518 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 518:	55                   	push   %ebp
+ 519:	89 e5                	mov    %esp,%ebp
+ 51b:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 51e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 525:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 529:	74 17                	je     542 <printint+0x2a>
+ 52b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 52f:	79 11                	jns    542 <printint+0x2a>
+    neg = 1;
+ 531:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 538:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 53b:	f7 d8                	neg    %eax
+ 53d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 540:	eb 06                	jmp    548 <printint+0x30>
+  } else {
+    x = xx;
+ 542:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 545:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 548:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 54f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 552:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 555:	ba 00 00 00 00       	mov    $0x0,%edx
+ 55a:	f7 f1                	div    %ecx
+ 55c:	89 d1                	mov    %edx,%ecx
+ 55e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 561:	8d 50 01             	lea    0x1(%eax),%edx
+ 564:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 567:	0f b6 91 c8 0f 00 00 	movzbl 0xfc8(%ecx),%edx
+ 56e:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 572:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 575:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 578:	ba 00 00 00 00       	mov    $0x0,%edx
+ 57d:	f7 f1                	div    %ecx
+ 57f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 582:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 586:	75 c7                	jne    54f <printint+0x37>
+  if(neg)
+ 588:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 58c:	74 2d                	je     5bb <printint+0xa3>
+    buf[i++] = '-';
+ 58e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 591:	8d 50 01             	lea    0x1(%eax),%edx
+ 594:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 597:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 59c:	eb 1d                	jmp    5bb <printint+0xa3>
+    putc(fd, buf[i]);
+ 59e:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5a4:	01 d0                	add    %edx,%eax
+ 5a6:	0f b6 00             	movzbl (%eax),%eax
+ 5a9:	0f be c0             	movsbl %al,%eax
+ 5ac:	83 ec 08             	sub    $0x8,%esp
+ 5af:	50                   	push   %eax
+ 5b0:	ff 75 08             	push   0x8(%ebp)
+ 5b3:	e8 3d ff ff ff       	call   4f5 <putc>
+ 5b8:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 5bb:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 5bf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5c3:	79 d9                	jns    59e <printint+0x86>
+}
+ 5c5:	90                   	nop
+ 5c6:	90                   	nop
+ 5c7:	c9                   	leave
+ 5c8:	c3                   	ret
+
+000005c9 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5c9:	55                   	push   %ebp
+ 5ca:	89 e5                	mov    %esp,%ebp
+ 5cc:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 5cf:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 5d6:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 5d9:	83 c0 04             	add    $0x4,%eax
+ 5dc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5df:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 5e6:	e9 59 01 00 00       	jmp    744 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 5eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5ee:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5f1:	01 d0                	add    %edx,%eax
+ 5f3:	0f b6 00             	movzbl (%eax),%eax
+ 5f6:	0f be c0             	movsbl %al,%eax
+ 5f9:	25 ff 00 00 00       	and    $0xff,%eax
+ 5fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 601:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 605:	75 2c                	jne    633 <printf+0x6a>
+      if(c == '%'){
+ 607:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 60b:	75 0c                	jne    619 <printf+0x50>
+        state = '%';
+ 60d:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 614:	e9 27 01 00 00       	jmp    740 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 619:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 61c:	0f be c0             	movsbl %al,%eax
+ 61f:	83 ec 08             	sub    $0x8,%esp
+ 622:	50                   	push   %eax
+ 623:	ff 75 08             	push   0x8(%ebp)
+ 626:	e8 ca fe ff ff       	call   4f5 <putc>
+ 62b:	83 c4 10             	add    $0x10,%esp
+ 62e:	e9 0d 01 00 00       	jmp    740 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 633:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 637:	0f 85 03 01 00 00    	jne    740 <printf+0x177>
+      if(c == 'd'){
+ 63d:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 641:	75 1e                	jne    661 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 643:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 646:	8b 00                	mov    (%eax),%eax
+ 648:	6a 01                	push   $0x1
+ 64a:	6a 0a                	push   $0xa
+ 64c:	50                   	push   %eax
+ 64d:	ff 75 08             	push   0x8(%ebp)
+ 650:	e8 c3 fe ff ff       	call   518 <printint>
+ 655:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 658:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 65c:	e9 d8 00 00 00       	jmp    739 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 661:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 665:	74 06                	je     66d <printf+0xa4>
+ 667:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 66b:	75 1e                	jne    68b <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 66d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 670:	8b 00                	mov    (%eax),%eax
+ 672:	6a 00                	push   $0x0
+ 674:	6a 10                	push   $0x10
+ 676:	50                   	push   %eax
+ 677:	ff 75 08             	push   0x8(%ebp)
+ 67a:	e8 99 fe ff ff       	call   518 <printint>
+ 67f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 682:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 686:	e9 ae 00 00 00       	jmp    739 <printf+0x170>
+      } else if(c == 's'){
+ 68b:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 68f:	75 43                	jne    6d4 <printf+0x10b>
+        s = (char*)*ap;
+ 691:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 694:	8b 00                	mov    (%eax),%eax
+ 696:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 699:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 69d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6a1:	75 25                	jne    6c8 <printf+0xff>
+          s = "(null)";
+ 6a3:	c7 45 f4 d2 0b 00 00 	movl   $0xbd2,-0xc(%ebp)
+        while(*s != 0){
+ 6aa:	eb 1c                	jmp    6c8 <printf+0xff>
+          putc(fd, *s);
+ 6ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6af:	0f b6 00             	movzbl (%eax),%eax
+ 6b2:	0f be c0             	movsbl %al,%eax
+ 6b5:	83 ec 08             	sub    $0x8,%esp
+ 6b8:	50                   	push   %eax
+ 6b9:	ff 75 08             	push   0x8(%ebp)
+ 6bc:	e8 34 fe ff ff       	call   4f5 <putc>
+ 6c1:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 6c4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 6c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6cb:	0f b6 00             	movzbl (%eax),%eax
+ 6ce:	84 c0                	test   %al,%al
+ 6d0:	75 da                	jne    6ac <printf+0xe3>
+ 6d2:	eb 65                	jmp    739 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 6d4:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 6d8:	75 1d                	jne    6f7 <printf+0x12e>
+        putc(fd, *ap);
+ 6da:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6dd:	8b 00                	mov    (%eax),%eax
+ 6df:	0f be c0             	movsbl %al,%eax
+ 6e2:	83 ec 08             	sub    $0x8,%esp
+ 6e5:	50                   	push   %eax
+ 6e6:	ff 75 08             	push   0x8(%ebp)
+ 6e9:	e8 07 fe ff ff       	call   4f5 <putc>
+ 6ee:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6f1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6f5:	eb 42                	jmp    739 <printf+0x170>
+      } else if(c == '%'){
+ 6f7:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6fb:	75 17                	jne    714 <printf+0x14b>
+        putc(fd, c);
+ 6fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 700:	0f be c0             	movsbl %al,%eax
+ 703:	83 ec 08             	sub    $0x8,%esp
+ 706:	50                   	push   %eax
+ 707:	ff 75 08             	push   0x8(%ebp)
+ 70a:	e8 e6 fd ff ff       	call   4f5 <putc>
+ 70f:	83 c4 10             	add    $0x10,%esp
+ 712:	eb 25                	jmp    739 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 714:	83 ec 08             	sub    $0x8,%esp
+ 717:	6a 25                	push   $0x25
+ 719:	ff 75 08             	push   0x8(%ebp)
+ 71c:	e8 d4 fd ff ff       	call   4f5 <putc>
+ 721:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 724:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 727:	0f be c0             	movsbl %al,%eax
+ 72a:	83 ec 08             	sub    $0x8,%esp
+ 72d:	50                   	push   %eax
+ 72e:	ff 75 08             	push   0x8(%ebp)
+ 731:	e8 bf fd ff ff       	call   4f5 <putc>
+ 736:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 739:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 740:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 744:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 747:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 74a:	01 d0                	add    %edx,%eax
+ 74c:	0f b6 00             	movzbl (%eax),%eax
+ 74f:	84 c0                	test   %al,%al
+ 751:	0f 85 94 fe ff ff    	jne    5eb <printf+0x22>
+    }
+  }
+}
+ 757:	90                   	nop
+ 758:	90                   	nop
+ 759:	c9                   	leave
+ 75a:	c3                   	ret
+
+0000075b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 75b:	55                   	push   %ebp
+ 75c:	89 e5                	mov    %esp,%ebp
+ 75e:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 761:	8b 45 08             	mov    0x8(%ebp),%eax
+ 764:	83 e8 08             	sub    $0x8,%eax
+ 767:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 76a:	a1 e4 0f 00 00       	mov    0xfe4,%eax
+ 76f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 772:	eb 24                	jmp    798 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 774:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 777:	8b 00                	mov    (%eax),%eax
+ 779:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 77c:	72 12                	jb     790 <free+0x35>
+ 77e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 781:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 784:	72 24                	jb     7aa <free+0x4f>
+ 786:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 789:	8b 00                	mov    (%eax),%eax
+ 78b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 78e:	72 1a                	jb     7aa <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 790:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 793:	8b 00                	mov    (%eax),%eax
+ 795:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 798:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 79b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 79e:	73 d4                	jae    774 <free+0x19>
+ 7a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a3:	8b 00                	mov    (%eax),%eax
+ 7a5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7a8:	73 ca                	jae    774 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7aa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ad:	8b 40 04             	mov    0x4(%eax),%eax
+ 7b0:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7b7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ba:	01 c2                	add    %eax,%edx
+ 7bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7bf:	8b 00                	mov    (%eax),%eax
+ 7c1:	39 c2                	cmp    %eax,%edx
+ 7c3:	75 24                	jne    7e9 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 7c5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7c8:	8b 50 04             	mov    0x4(%eax),%edx
+ 7cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ce:	8b 00                	mov    (%eax),%eax
+ 7d0:	8b 40 04             	mov    0x4(%eax),%eax
+ 7d3:	01 c2                	add    %eax,%edx
+ 7d5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7d8:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7db:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7de:	8b 00                	mov    (%eax),%eax
+ 7e0:	8b 10                	mov    (%eax),%edx
+ 7e2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7e5:	89 10                	mov    %edx,(%eax)
+ 7e7:	eb 0a                	jmp    7f3 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 7e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ec:	8b 10                	mov    (%eax),%edx
+ 7ee:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f1:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 7f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f6:	8b 40 04             	mov    0x4(%eax),%eax
+ 7f9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 800:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 803:	01 d0                	add    %edx,%eax
+ 805:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 808:	75 20                	jne    82a <free+0xcf>
+    p->s.size += bp->s.size;
+ 80a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 80d:	8b 50 04             	mov    0x4(%eax),%edx
+ 810:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 813:	8b 40 04             	mov    0x4(%eax),%eax
+ 816:	01 c2                	add    %eax,%edx
+ 818:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 81b:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 81e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 821:	8b 10                	mov    (%eax),%edx
+ 823:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 826:	89 10                	mov    %edx,(%eax)
+ 828:	eb 08                	jmp    832 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 82a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 82d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 830:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 832:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 835:	a3 e4 0f 00 00       	mov    %eax,0xfe4
+}
+ 83a:	90                   	nop
+ 83b:	c9                   	leave
+ 83c:	c3                   	ret
+
+0000083d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 83d:	55                   	push   %ebp
+ 83e:	89 e5                	mov    %esp,%ebp
+ 840:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 843:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 84a:	77 07                	ja     853 <morecore+0x16>
+    nu = 4096;
+ 84c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 853:	8b 45 08             	mov    0x8(%ebp),%eax
+ 856:	c1 e0 03             	shl    $0x3,%eax
+ 859:	83 ec 0c             	sub    $0xc,%esp
+ 85c:	50                   	push   %eax
+ 85d:	e8 83 fb ff ff       	call   3e5 <sbrk>
+ 862:	83 c4 10             	add    $0x10,%esp
+ 865:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 868:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 86c:	75 07                	jne    875 <morecore+0x38>
+    return 0;
+ 86e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 873:	eb 26                	jmp    89b <morecore+0x5e>
+  hp = (Header*)p;
+ 875:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 878:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 87b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 87e:	8b 55 08             	mov    0x8(%ebp),%edx
+ 881:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 884:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 887:	83 c0 08             	add    $0x8,%eax
+ 88a:	83 ec 0c             	sub    $0xc,%esp
+ 88d:	50                   	push   %eax
+ 88e:	e8 c8 fe ff ff       	call   75b <free>
+ 893:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 896:	a1 e4 0f 00 00       	mov    0xfe4,%eax
+}
+ 89b:	c9                   	leave
+ 89c:	c3                   	ret
+
+0000089d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 89d:	55                   	push   %ebp
+ 89e:	89 e5                	mov    %esp,%ebp
+ 8a0:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8a6:	83 c0 07             	add    $0x7,%eax
+ 8a9:	c1 e8 03             	shr    $0x3,%eax
+ 8ac:	83 c0 01             	add    $0x1,%eax
+ 8af:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 8b2:	a1 e4 0f 00 00       	mov    0xfe4,%eax
+ 8b7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8ba:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8be:	75 23                	jne    8e3 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 8c0:	c7 45 f0 dc 0f 00 00 	movl   $0xfdc,-0x10(%ebp)
+ 8c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8ca:	a3 e4 0f 00 00       	mov    %eax,0xfe4
+ 8cf:	a1 e4 0f 00 00       	mov    0xfe4,%eax
+ 8d4:	a3 dc 0f 00 00       	mov    %eax,0xfdc
+    base.s.size = 0;
+ 8d9:	c7 05 e0 0f 00 00 00 	movl   $0x0,0xfe0
+ 8e0:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8e3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8e6:	8b 00                	mov    (%eax),%eax
+ 8e8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ee:	8b 40 04             	mov    0x4(%eax),%eax
+ 8f1:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 8f4:	72 4d                	jb     943 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 8f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f9:	8b 40 04             	mov    0x4(%eax),%eax
+ 8fc:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 8ff:	75 0c                	jne    90d <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 901:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 904:	8b 10                	mov    (%eax),%edx
+ 906:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 909:	89 10                	mov    %edx,(%eax)
+ 90b:	eb 26                	jmp    933 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 90d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 910:	8b 40 04             	mov    0x4(%eax),%eax
+ 913:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 916:	89 c2                	mov    %eax,%edx
+ 918:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 91b:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 91e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 921:	8b 40 04             	mov    0x4(%eax),%eax
+ 924:	c1 e0 03             	shl    $0x3,%eax
+ 927:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 92a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 92d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 930:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 933:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 936:	a3 e4 0f 00 00       	mov    %eax,0xfe4
+      return (void*)(p + 1);
+ 93b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 93e:	83 c0 08             	add    $0x8,%eax
+ 941:	eb 3b                	jmp    97e <malloc+0xe1>
+    }
+    if(p == freep)
+ 943:	a1 e4 0f 00 00       	mov    0xfe4,%eax
+ 948:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 94b:	75 1e                	jne    96b <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 94d:	83 ec 0c             	sub    $0xc,%esp
+ 950:	ff 75 ec             	push   -0x14(%ebp)
+ 953:	e8 e5 fe ff ff       	call   83d <morecore>
+ 958:	83 c4 10             	add    $0x10,%esp
+ 95b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 95e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 962:	75 07                	jne    96b <malloc+0xce>
+        return 0;
+ 964:	b8 00 00 00 00       	mov    $0x0,%eax
+ 969:	eb 13                	jmp    97e <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 96b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 96e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 971:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 974:	8b 00                	mov    (%eax),%eax
+ 976:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 979:	e9 6d ff ff ff       	jmp    8eb <malloc+0x4e>
+  }
+}
+ 97e:	c9                   	leave
+ 97f:	c3                   	ret
+
+00000980 <mutex_init>:
+#include "user.h"
+#include "usync.h"
+
+void
+mutex_init(struct mutex *m)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 983:	8b 45 08             	mov    0x8(%ebp),%eax
+ 986:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 98c:	90                   	nop
+ 98d:	5d                   	pop    %ebp
+ 98e:	c3                   	ret
+
+0000098f <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 98f:	55                   	push   %ebp
+ 990:	89 e5                	mov    %esp,%ebp
+ 992:	83 ec 18             	sub    $0x18,%esp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 995:	8b 55 08             	mov    0x8(%ebp),%edx
+ 998:	b8 00 00 00 00       	mov    $0x0,%eax
+ 99d:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 9a2:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ 9a6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9a9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9ad:	74 3b                	je     9ea <mutex_lock+0x5b>
+    return;
+  // Contended: mark the mutex as waited on, then sleep until
+  // we are the one who swaps it from free to locked.
+  if(c != 2)
+ 9af:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 9b3:	74 2d                	je     9e2 <mutex_lock+0x53>
+    c = __sync_lock_test_and_set(&m->state, 2);
+ 9b5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9b8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 9bd:	87 02                	xchg   %eax,(%edx)
+ 9bf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 9c2:	eb 1e                	jmp    9e2 <mutex_lock+0x53>
+    futex_wait(&m->state, 2);
+ 9c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9c7:	83 ec 08             	sub    $0x8,%esp
+ 9ca:	6a 02                	push   $0x2
+ 9cc:	50                   	push   %eax
+ 9cd:	e8 f3 fa ff ff       	call   4c5 <futex_wait>
+ 9d2:	83 c4 10             	add    $0x10,%esp
+    c = __sync_lock_test_and_set(&m->state, 2);
+ 9d5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9d8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 9dd:	87 02                	xchg   %eax,(%edx)
+ 9df:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 9e2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9e6:	75 dc                	jne    9c4 <mutex_lock+0x35>
+ 9e8:	eb 01                	jmp    9eb <mutex_lock+0x5c>
+    return;
+ 9ea:	90                   	nop
+  }
+}
+ 9eb:	c9                   	leave
+ 9ec:	c3                   	ret
+
+000009ed <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 9ed:	55                   	push   %ebp
+ 9ee:	89 e5                	mov    %esp,%ebp
+ 9f0:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ 9f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9f6:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9fb:	f7 da                	neg    %edx
+ 9fd:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ a01:	83 fa 01             	cmp    $0x1,%edx
+ a04:	74 1a                	je     a20 <mutex_unlock+0x33>
+    m->state = 0;
+ a06:	8b 45 08             	mov    0x8(%ebp),%eax
+ a09:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+ a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+ a12:	83 ec 08             	sub    $0x8,%esp
+ a15:	6a 01                	push   $0x1
+ a17:	50                   	push   %eax
+ a18:	e8 b0 fa ff ff       	call   4cd <futex_wake>
+ a1d:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ a20:	90                   	nop
+ a21:	c9                   	leave
+ a22:	c3                   	ret
+
+00000a23 <rwlock_init>:
+
+// Readers are preferred: a writer waits until there are none.
+
+void
+rwlock_init(struct rwlock *rw)
+{
+ a23:	55                   	push   %ebp
+ a24:	89 e5                	mov    %esp,%ebp
+  rw->state = 0;
+ a26:	8b 45 08             	mov    0x8(%ebp),%eax
+ a29:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  rw->waiters = 0;
+ a2f:	8b 45 08             	mov    0x8(%ebp),%eax
+ a32:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+ a39:	90                   	nop
+ a3a:	5d                   	pop    %ebp
+ a3b:	c3                   	ret
+
+00000a3c <rwlock_sleep>:
+
+static void
+rwlock_sleep(struct rwlock *rw, int seen)
+{
+ a3c:	55                   	push   %ebp
+ a3d:	89 e5                	mov    %esp,%ebp
+ a3f:	83 ec 08             	sub    $0x8,%esp
+  // waiters is raised before futex_wait() rechecks state, so an
+  // unlock either sees us or changes state before we sleep.
+  __sync_fetch_and_add(&rw->waiters, 1);
+ a42:	8b 45 08             	mov    0x8(%ebp),%eax
+ a45:	83 c0 04             	add    $0x4,%eax
+ a48:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wait(&rw->state, seen);
+ a4c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a4f:	83 ec 08             	sub    $0x8,%esp
+ a52:	ff 75 0c             	push   0xc(%ebp)
+ a55:	50                   	push   %eax
+ a56:	e8 6a fa ff ff       	call   4c5 <futex_wait>
+ a5b:	83 c4 10             	add    $0x10,%esp
+  __sync_fetch_and_sub(&rw->waiters, 1);
+ a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+ a61:	83 c0 04             	add    $0x4,%eax
+ a64:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+ a68:	90                   	nop
+ a69:	c9                   	leave
+ a6a:	c3                   	ret
+
+00000a6b <rwlock_rdlock>:
+
+void
+rwlock_rdlock(struct rwlock *rw)
+{
+ a6b:	55                   	push   %ebp
+ a6c:	89 e5                	mov    %esp,%ebp
+ a6e:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  for(;;){
+    s = rw->state;
+ a71:	8b 45 08             	mov    0x8(%ebp),%eax
+ a74:	8b 00                	mov    (%eax),%eax
+ a76:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(s >= 0 && __sync_val_compare_and_swap(&rw->state, s, s + 1) == s)
+ a79:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a7d:	78 17                	js     a96 <rwlock_rdlock+0x2b>
+ a7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a82:	83 c0 01             	add    $0x1,%eax
+ a85:	89 c1                	mov    %eax,%ecx
+ a87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a8a:	8b 55 08             	mov    0x8(%ebp),%edx
+ a8d:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ a91:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a94:	74 19                	je     aaf <rwlock_rdlock+0x44>
+      return;
+    if(s < 0)
+ a96:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a9a:	79 d5                	jns    a71 <rwlock_rdlock+0x6>
+      rwlock_sleep(rw, s);
+ a9c:	83 ec 08             	sub    $0x8,%esp
+ a9f:	ff 75 f4             	push   -0xc(%ebp)
+ aa2:	ff 75 08             	push   0x8(%ebp)
+ aa5:	e8 92 ff ff ff       	call   a3c <rwlock_sleep>
+ aaa:	83 c4 10             	add    $0x10,%esp
+    s = rw->state;
+ aad:	eb c2                	jmp    a71 <rwlock_rdlock+0x6>
+      return;
+ aaf:	90                   	nop
+  }
+}
+ ab0:	c9                   	leave
+ ab1:	c3                   	ret
+
+00000ab2 <rwlock_wrlock>:
+
+void
+rwlock_wrlock(struct rwlock *rw)
+{
+ ab2:	55                   	push   %ebp
+ ab3:	89 e5                	mov    %esp,%ebp
+ ab5:	83 ec 18             	sub    $0x18,%esp
+  int s;
+
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ ab8:	eb 11                	jmp    acb <rwlock_wrlock+0x19>
+    rwlock_sleep(rw, s);
+ aba:	83 ec 08             	sub    $0x8,%esp
+ abd:	ff 75 f4             	push   -0xc(%ebp)
+ ac0:	ff 75 08             	push   0x8(%ebp)
+ ac3:	e8 74 ff ff ff       	call   a3c <rwlock_sleep>
+ ac8:	83 c4 10             	add    $0x10,%esp
+  while((s = __sync_val_compare_and_swap(&rw->state, 0, -1)) != 0)
+ acb:	8b 55 08             	mov    0x8(%ebp),%edx
+ ace:	b8 00 00 00 00       	mov    $0x0,%eax
+ ad3:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+ ad8:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ adc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ adf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ae3:	75 d5                	jne    aba <rwlock_wrlock+0x8>
+}
+ ae5:	90                   	nop
+ ae6:	90                   	nop
+ ae7:	c9                   	leave
+ ae8:	c3                   	ret
+
+00000ae9 <rwlock_unlock>:
+
+void
+rwlock_unlock(struct rwlock *rw)
+{
+ ae9:	55                   	push   %ebp
+ aea:	89 e5                	mov    %esp,%ebp
+ aec:	83 ec 08             	sub    $0x8,%esp
+  if(rw->state < 0)
+ aef:	8b 45 08             	mov    0x8(%ebp),%eax
+ af2:	8b 00                	mov    (%eax),%eax
+ af4:	85 c0                	test   %eax,%eax
+ af6:	79 0c                	jns    b04 <rwlock_unlock+0x1b>
+    __sync_lock_test_and_set(&rw->state, 0);
+ af8:	8b 45 08             	mov    0x8(%ebp),%eax
+ afb:	ba 00 00 00 00       	mov    $0x0,%edx
+ b00:	87 10                	xchg   %edx,(%eax)
+ b02:	eb 18                	jmp    b1c <rwlock_unlock+0x33>
+  else if(__sync_sub_and_fetch(&rw->state, 1) != 0)
+ b04:	8b 55 08             	mov    0x8(%ebp),%edx
+ b07:	b8 01 00 00 00       	mov    $0x1,%eax
+ b0c:	f7 d8                	neg    %eax
+ b0e:	89 c1                	mov    %eax,%ecx
+ b10:	89 c8                	mov    %ecx,%eax
+ b12:	f0 0f c1 02          	lock xadd %eax,(%edx)
+ b16:	01 c8                	add    %ecx,%eax
+ b18:	85 c0                	test   %eax,%eax
+ b1a:	75 20                	jne    b3c <rwlock_unlock+0x53>
+    return;
+  if(rw->waiters)
+ b1c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b1f:	8b 40 04             	mov    0x4(%eax),%eax
+ b22:	85 c0                	test   %eax,%eax
+ b24:	74 17                	je     b3d <rwlock_unlock+0x54>
+    futex_wake(&rw->state, WAKE_ALL);
+ b26:	8b 45 08             	mov    0x8(%ebp),%eax
+ b29:	83 ec 08             	sub    $0x8,%esp
+ b2c:	68 ff ff ff 7f       	push   $0x7fffffff
+ b31:	50                   	push   %eax
+ b32:	e8 96 f9 ff ff       	call   4cd <futex_wake>
+ b37:	83 c4 10             	add    $0x10,%esp
+ b3a:	eb 01                	jmp    b3d <rwlock_unlock+0x54>
+    return;
+ b3c:	90                   	nop
+}
+ b3d:	c9                   	leave
+ b3e:	c3                   	ret
+
+00000b3f <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ b3f:	55                   	push   %ebp
+ b40:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ b42:	8b 45 08             	mov    0x8(%ebp),%eax
+ b45:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b4b:	90                   	nop
+ b4c:	5d                   	pop    %ebp
+ b4d:	c3                   	ret
+
+00000b4e <cond_wait>:
+
+// Atomically release m and wait for a signal, then retake m.
+// As with any condition variable, wakeups may be spurious.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ b4e:	55                   	push   %ebp
+ b4f:	89 e5                	mov    %esp,%ebp
+ b51:	83 ec 18             	sub    $0x18,%esp
+  int seq = c->seq;
+ b54:	8b 45 08             	mov    0x8(%ebp),%eax
+ b57:	8b 00                	mov    (%eax),%eax
+ b59:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+  mutex_unlock(m);
+ b5c:	83 ec 0c             	sub    $0xc,%esp
+ b5f:	ff 75 0c             	push   0xc(%ebp)
+ b62:	e8 86 fe ff ff       	call   9ed <mutex_unlock>
+ b67:	83 c4 10             	add    $0x10,%esp
+  futex_wait(&c->seq, seq);
+ b6a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6d:	83 ec 08             	sub    $0x8,%esp
+ b70:	ff 75 f4             	push   -0xc(%ebp)
+ b73:	50                   	push   %eax
+ b74:	e8 4c f9 ff ff       	call   4c5 <futex_wait>
+ b79:	83 c4 10             	add    $0x10,%esp
+  mutex_lock(m);
+ b7c:	83 ec 0c             	sub    $0xc,%esp
+ b7f:	ff 75 0c             	push   0xc(%ebp)
+ b82:	e8 08 fe ff ff       	call   98f <mutex_lock>
+ b87:	83 c4 10             	add    $0x10,%esp
+}
+ b8a:	90                   	nop
+ b8b:	c9                   	leave
+ b8c:	c3                   	ret
+
+00000b8d <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ b8d:	55                   	push   %ebp
+ b8e:	89 e5                	mov    %esp,%ebp
+ b90:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ b93:	8b 45 08             	mov    0x8(%ebp),%eax
+ b96:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ b9a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b9d:	83 ec 08             	sub    $0x8,%esp
+ ba0:	6a 01                	push   $0x1
+ ba2:	50                   	push   %eax
+ ba3:	e8 25 f9 ff ff       	call   4cd <futex_wake>
+ ba8:	83 c4 10             	add    $0x10,%esp
+}
+ bab:	90                   	nop
+ bac:	c9                   	leave
+ bad:	c3                   	ret
+
+00000bae <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ bae:	55                   	push   %ebp
+ baf:	89 e5                	mov    %esp,%ebp
+ bb1:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ bb4:	8b 45 08             	mov    0x8(%ebp),%eax
+ bb7:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, WAKE_ALL);
+ bbb:	8b 45 08             	mov    0x8(%ebp),%eax
+ bbe:	83 ec 08             	sub    $0x8,%esp
+ bc1:	68 ff ff ff 7f       	push   $0x7fffffff
+ bc6:	50                   	push   %eax
+ bc7:	e8 01 f9 ff ff       	call   4cd <futex_wake>
+ bcc:	83 c4 10             	add    $0x10,%esp
+}
+ bcf:	90                   	nop
+ bd0:	c9                   	leave
+ bd1:	c3                   	ret